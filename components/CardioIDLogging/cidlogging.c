@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <time.h>
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
@@ -18,6 +19,7 @@
 #include "esp_netif.h"
 
 #include "cidLogging.h"
+#include "logindex.h"
 #include "ssh.h"
 #include "sntp.h"
 #include "utils.h"
@@ -32,6 +34,8 @@ TaskHandle_t loggingTaskHandle = NULL;
 
 // This file stream will be used for logging
 static FILE *log_file;
+// Index entry of the log file being written
+static LogIndexEntry log_entry;
 // This example can use SDMMC and SPI peripherals to communicate with SD card.
 // By default, SDMMC peripheral is used.
 // To enable SPI mode, uncomment the following line:
@@ -51,6 +55,33 @@ static FILE *log_file;
 #define PIN_NUM_CS 13
 #endif // USE_SPI_MODE
 
+/**
+ * @brief Get the level of a log event from its format string
+ *
+ * @note The esp logging library starts the format with the level letter, after the color escape sequence if any
+ *
+ * @param  fmt 		Format specifier
+ *
+ * @return Level (0 = error ... 4 = verbose), LOG_INDEX_LEVEL_UNKNOWN if not recognized
+ *
+ */
+static uint8_t GET_LOG_LEVEL(const char *fmt)
+{
+	const char *levels = "EWIDV";
+	const char *p;
+
+	// Skip the color escape sequence
+	if (fmt[0] == '\033')
+	{
+		p = strchr(fmt, 'm');
+		fmt = (p != NULL) ? p + 1 : fmt;
+	}
+
+	p = (fmt[0] != '\0') ? strchr(levels, fmt[0]) : NULL;
+
+	return (p != NULL) ? (uint8_t)(p - levels) : LOG_INDEX_LEVEL_UNKNOWN;
+}
+
 /**
  * @brief Executed function every time an event is logged.
  * The list of arguments is added to a new line on the file.
@@ -83,6 +114,19 @@ static int PRINT_TO_SD_CARD(const char *fmt, va_list list)
 	// or after 100ms passed since last fsync, and so on.
 	fsync(fileno(log_file));
 
+	// Keep track of the time span and the most severe level of the file
+	uint32_t now = (uint32_t)time(NULL);
+	uint8_t level = GET_LOG_LEVEL(fmt);
+	if (log_entry.firstTime == 0)
+	{
+		log_entry.firstTime = now;
+	}
+	log_entry.lastTime = now;
+	if (level < log_entry.maxLevel)
+	{
+		log_entry.maxLevel = level;
+	}
+
 	return res;
 }
 
@@ -194,6 +238,12 @@ void CREATE_LOG_FILE()
 	else
 	{
 		ESP_LOGI(TAG, "File %s opened", filename);
+		// Register the file in the pending-upload index
+		memset(&log_entry, 0, sizeof(log_entry));
+		strncpy(log_entry.name, filename + strlen(LOG_FILE_DIR "/"), LOG_INDEX_NAME_SIZE - 1);
+		log_entry.maxLevel = LOG_INDEX_LEVEL_UNKNOWN;
+		log_entry.state = LOG_INDEX_STATE_OPEN;
+		LOG_INDEX_APPEND(&log_entry);
 		ESP_LOGI(TAG, "Redirecting log output to SD card!");
 		esp_log_set_vprintf(PRINT_TO_SD_CARD);
 	}
@@ -253,9 +303,19 @@ void CARDIO_LOG(char *TAG, char *message, int level)
  */
 void SEND_LOG_OVER_SSH()
 {
+	esp_log_set_vprintf(&vprintf);
 	fclose(log_file);
 	log_file = NULL;
-	esp_log_set_vprintf(&vprintf);
+	// Seal the file so that the uploader picks it up
+	struct stat st;
+	char filename[100];
+	sprintf(filename, "%s/%s", LOG_FILE_DIR, log_entry.name);
+	if (stat(filename, &st) == 0)
+	{
+		log_entry.size = st.st_size;
+	}
+	log_entry.state = LOG_INDEX_STATE_SEALED;
+	LOG_INDEX_APPEND(&log_entry);
 	// Delete the logging task
 	vTaskDelete(loggingTaskHandle);
 	WIFI_INIT();
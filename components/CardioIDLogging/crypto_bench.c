@@ -0,0 +1,691 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "core/crypto.h"
+#include "hash/hash_algorithms.h"
+#include "cipher/cipher_algorithms.h"
+#include "cipher_modes/cipher_modes.h"
+#include "aead/aead_algorithms.h"
+#include "mac/mac_algorithms.h"
+#include "pkc/dh.h"
+#include "pkc/rsa.h"
+#include "ecc/ec_curves.h"
+#include "ecc/ecdh.h"
+#include "ecc/ecdsa.h"
+#include "ecc/ed25519.h"
+#include "rng/yarrow.h"
+#include "ssh/ssh_modp_groups.h"
+#include "debug.h"
+
+#include "crypto_bench.h"
+#include "utils.h"
+
+/*
+ * Every algorithm enabled in crypto_config.h is run in a loop for at least
+ * APP_CRYPTO_BENCH_MIN_TIME. Hashes, MACs, ciphers and AEADs are measured at
+ * several message sizes and reported in cycles per byte, public-key
+ * operations in operations per second. The cycle counts are derived from the
+ * high resolution timer and the nominal CPU frequency, so that a task moving
+ * between the two cores does not skew them. The results are printed one per
+ * line, as CSV or JSON, for regression tracking.
+ */
+
+// Largest message size, also used as scratch buffer for the public-key operations
+#define CRYPTO_BENCH_MAX_SIZE 8192
+
+// Operation being measured
+typedef error_list (*CryptoBenchFunc)(void *param, uint8_t *data, size_t length);
+
+// Symmetric algorithm and the state it runs on
+typedef struct
+{
+    const HashAlgo *hashAlgo;
+    const CipherAlgo *cipherAlgo;
+    HashContext hashContext;
+    CipherContext cipherContext;
+#if (HMAC_SUPPORT == ENABLED)
+    HmacContext hmacContext;
+    HmacKeySchedule hmacKeySchedule;
+#endif
+#if (GCM_SUPPORT == ENABLED)
+    GcmContext gcmContext;
+#endif
+#if (CHACHA_SUPPORT == ENABLED)
+    ChachaContext chachaContext;
+#endif
+#if (POLY1305_SUPPORT == ENABLED)
+    Poly1305Context poly1305Context;
+#endif
+    uint8_t key[32];
+    uint8_t iv[16];
+    uint8_t tag[64];
+} CryptoBenchSym;
+
+// Symmetric algorithm to be measured
+typedef struct
+{
+    const char *kind;
+    const char *name;
+    const HashAlgo *hashAlgo;
+    const CipherAlgo *cipherAlgo;
+    size_t keyLen;
+    CryptoBenchFunc func;
+} CryptoBenchSymEntry;
+
+// Message sizes of the symmetric algorithms (bytes)
+static const size_t cryptoBenchSizes[] = {16, 64, 256, 512, 1024, CRYPTO_BENCH_MAX_SIZE};
+
+// PRNG seeded by WIFI_INIT
+extern YarrowContext yarrowContext;
+
+/**
+ * @brief Print the result of a measurement
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchReport(const char *kind, const char *name, size_t length,
+                              uint32_t iterations, int64_t elapsed)
+{
+    double cycles = (double)elapsed * CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ / iterations;
+    double cyclesPerByte = (length > 0) ? cycles / length : 0.0;
+    double opsPerSec = (double)iterations * 1000000.0 / elapsed;
+
+#if (APP_CRYPTO_BENCH_JSON == ENABLED)
+    printf("{\"kind\":\"%s\",\"algorithm\":\"%s\",\"bytes\":%u,\"iterations\":%" PRIu32
+           ",\"cycles_per_op\":%.0f,\"cycles_per_byte\":%.2f,\"ops_per_sec\":%.2f}\n",
+           kind, name, (unsigned int)length, iterations, cycles, cyclesPerByte, opsPerSec);
+#else
+    printf("%s,%s,%u,%" PRIu32 ",%.0f,%.2f,%.2f\n",
+           kind, name, (unsigned int)length, iterations, cycles, cyclesPerByte, opsPerSec);
+#endif
+}
+
+/**
+ * @brief Run an operation for at least APP_CRYPTO_BENCH_MIN_TIME and report its cost
+ *
+ * @note -
+ *
+ */
+static error_list cryptoBenchRun(const char *kind, const char *name, size_t length,
+                                 CryptoBenchFunc func, void *param, uint8_t *data)
+{
+    error_list error;
+    uint32_t iterations = 0;
+    int64_t start = esp_timer_get_time();
+    int64_t elapsed;
+
+    do
+    {
+        error = func(param, data, length);
+        iterations++;
+        elapsed = esp_timer_get_time() - start;
+    } while (!error && elapsed < (int64_t)APP_CRYPTO_BENCH_MIN_TIME * 1000);
+
+    if (error)
+    {
+        TRACE_WARNING("Crypto benchmark: %s failed (%d)\r\n", name, error);
+    }
+    else
+    {
+        cryptoBenchReport(kind, name, length, iterations, elapsed);
+    }
+
+    // Let the idle task run between measurements
+    osDelayTask(10);
+
+    return error;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////// SYMMETRIC ALGORITHMS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static error_list cryptoBenchHash(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    sym->hashAlgo->init(&sym->hashContext);
+    sym->hashAlgo->update(&sym->hashContext, data, length);
+    sym->hashAlgo->final(&sym->hashContext, sym->tag);
+
+    return NO_ERROR;
+}
+
+#if (HMAC_SUPPORT == ENABLED)
+static error_list cryptoBenchHmac(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+    error_list error;
+
+    error = hmacInit(&sym->hmacContext, sym->hashAlgo, sym->key, sizeof(sym->key));
+    if (!error)
+    {
+        hmacUpdate(&sym->hmacContext, data, length);
+        hmacFinal(&sym->hmacContext, sym->tag);
+    }
+
+    return error;
+}
+
+static error_list cryptoBenchHmacKeySchedule(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    // The padded keys are hashed once per key, as in SSH
+    hmacInitWithKeySchedule(&sym->hmacContext, &sym->hmacKeySchedule);
+    hmacUpdate(&sym->hmacContext, data, length);
+    hmacFinal(&sym->hmacContext, sym->tag);
+
+    return NO_ERROR;
+}
+#endif
+
+#if (CBC_SUPPORT == ENABLED)
+static error_list cryptoBenchCbc(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    return cbcEncrypt(sym->cipherAlgo, &sym->cipherContext, sym->iv, data, data, length);
+}
+#endif
+
+#if (CTR_SUPPORT == ENABLED)
+static error_list cryptoBenchCtr(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    return ctrEncrypt(sym->cipherAlgo, &sym->cipherContext, sym->cipherAlgo->blockSize * 8,
+                      sym->iv, data, data, length);
+}
+#endif
+
+#if (GCM_SUPPORT == ENABLED)
+static error_list cryptoBenchGcm(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    // The key schedule and the GHASH table are set up once per key, as in SSH
+    return gcmEncrypt(&sym->gcmContext, sym->iv, 12, NULL, 0, data, data, length, sym->tag, 16);
+}
+#endif
+
+#if (CHACHA_SUPPORT == ENABLED)
+static error_list cryptoBenchChacha20(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+    error_list error;
+
+    error = chachaInit(&sym->chachaContext, 20, sym->key, 32, sym->iv, 12);
+    if (!error)
+    {
+        chachaCipher(&sym->chachaContext, data, data, length);
+    }
+
+    return error;
+}
+#endif
+
+#if (POLY1305_SUPPORT == ENABLED)
+static error_list cryptoBenchPoly1305(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+
+    poly1305Init(&sym->poly1305Context, sym->key);
+    poly1305Update(&sym->poly1305Context, data, length);
+    poly1305Final(&sym->poly1305Context, sym->tag);
+
+    return NO_ERROR;
+}
+#endif
+
+#if (CHACHA_SUPPORT == ENABLED && POLY1305_SUPPORT == ENABLED)
+static error_list cryptoBenchChacha20Poly1305(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchSym *sym = (CryptoBenchSym *)param;
+    error_list error;
+
+    error = chachaInit(&sym->chachaContext, 20, sym->key, 32, sym->iv, 12);
+    if (!error)
+    {
+        // The one-time Poly1305 key is the first block of key stream (RFC 8439, section 2.6)
+        chachaCipher(&sym->chachaContext, NULL, sym->tag, 64);
+        poly1305Init(&sym->poly1305Context, sym->tag);
+        chachaCipher(&sym->chachaContext, data, data, length);
+        poly1305Update(&sym->poly1305Context, data, length);
+        poly1305Final(&sym->poly1305Context, sym->tag);
+    }
+
+    return error;
+}
+#endif
+
+// Symmetric algorithms enabled in crypto_config.h
+static const CryptoBenchSymEntry cryptoBenchSymEntries[] =
+{
+#if (SHA1_SUPPORT == ENABLED)
+    {"hash", "sha1", SHA1_HASH_ALGO, NULL, 0, cryptoBenchHash},
+#endif
+#if (SHA256_SUPPORT == ENABLED)
+    {"hash", "sha256", SHA256_HASH_ALGO, NULL, 0, cryptoBenchHash},
+#endif
+#if (SHA384_SUPPORT == ENABLED)
+    {"hash", "sha384", SHA384_HASH_ALGO, NULL, 0, cryptoBenchHash},
+#endif
+#if (SHA512_SUPPORT == ENABLED)
+    {"hash", "sha512", SHA512_HASH_ALGO, NULL, 0, cryptoBenchHash},
+#endif
+#if (HMAC_SUPPORT == ENABLED && SHA1_SUPPORT == ENABLED)
+    {"mac", "hmac-sha1", SHA1_HASH_ALGO, NULL, 0, cryptoBenchHmac},
+#endif
+#if (HMAC_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+    {"mac", "hmac-sha256", SHA256_HASH_ALGO, NULL, 0, cryptoBenchHmac},
+    {"mac", "hmac-sha256-ks", SHA256_HASH_ALGO, NULL, 0, cryptoBenchHmacKeySchedule},
+#endif
+#if (HMAC_SUPPORT == ENABLED && SHA512_SUPPORT == ENABLED)
+    {"mac", "hmac-sha512", SHA512_HASH_ALGO, NULL, 0, cryptoBenchHmac},
+#endif
+#if (POLY1305_SUPPORT == ENABLED)
+    {"mac", "poly1305", NULL, NULL, 0, cryptoBenchPoly1305},
+#endif
+#if (AES_SUPPORT == ENABLED && CBC_SUPPORT == ENABLED)
+    {"cipher", "aes128-cbc", NULL, AES_CIPHER_ALGO, 16, cryptoBenchCbc},
+    {"cipher", "aes256-cbc", NULL, AES_CIPHER_ALGO, 32, cryptoBenchCbc},
+#endif
+#if (AES_SUPPORT == ENABLED && CTR_SUPPORT == ENABLED)
+    {"cipher", "aes128-ctr", NULL, AES_CIPHER_ALGO, 16, cryptoBenchCtr},
+    {"cipher", "aes256-ctr", NULL, AES_CIPHER_ALGO, 32, cryptoBenchCtr},
+#endif
+#if (CHACHA_SUPPORT == ENABLED)
+    {"cipher", "chacha20", NULL, NULL, 0, cryptoBenchChacha20},
+#endif
+#if (AES_SUPPORT == ENABLED && GCM_SUPPORT == ENABLED)
+    {"aead", "aes128-gcm", NULL, AES_CIPHER_ALGO, 16, cryptoBenchGcm},
+    {"aead", "aes256-gcm", NULL, AES_CIPHER_ALGO, 32, cryptoBenchGcm},
+#endif
+#if (CHACHA_SUPPORT == ENABLED && POLY1305_SUPPORT == ENABLED)
+    {"aead", "chacha20-poly1305", NULL, NULL, 0, cryptoBenchChacha20Poly1305},
+#endif
+};
+
+/**
+ * @brief Measure the symmetric algorithms at every message size
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchSymmetric(uint8_t *data)
+{
+    CryptoBenchSym *sym;
+    const CryptoBenchSymEntry *entry;
+    error_list error;
+    size_t i;
+    size_t j;
+
+    sym = cryptoAllocMem(sizeof(CryptoBenchSym));
+    if (sym == NULL)
+        return;
+
+    for (i = 0; i < arraysize(cryptoBenchSymEntries); i++)
+    {
+        entry = &cryptoBenchSymEntries[i];
+
+        memset(sym, 0, sizeof(CryptoBenchSym));
+        memset(sym->key, 0x5A, sizeof(sym->key));
+        sym->hashAlgo = entry->hashAlgo;
+        sym->cipherAlgo = entry->cipherAlgo;
+
+        error = NO_ERROR;
+
+        // Key schedule
+        if (entry->cipherAlgo != NULL)
+        {
+            error = entry->cipherAlgo->init(&sym->cipherContext, sym->key, entry->keyLen);
+        }
+#if (HMAC_SUPPORT == ENABLED)
+        if (entry->func == cryptoBenchHmacKeySchedule)
+        {
+            error = hmacInitKeySchedule(&sym->hmacKeySchedule, entry->hashAlgo, sym->key, sizeof(sym->key));
+        }
+#endif
+#if (GCM_SUPPORT == ENABLED)
+        if (!error && entry->func == cryptoBenchGcm)
+        {
+            error = gcmInit(&sym->gcmContext, entry->cipherAlgo, &sym->cipherContext);
+        }
+#endif
+
+        for (j = 0; j < arraysize(cryptoBenchSizes) && !error; j++)
+        {
+            error = cryptoBenchRun(entry->kind, entry->name, cryptoBenchSizes[j], entry->func, sym, data);
+        }
+
+        if (entry->cipherAlgo != NULL)
+        {
+            entry->cipherAlgo->deinit(&sym->cipherContext);
+        }
+    }
+
+    cryptoFreeMem(sym);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////// PUBLIC-KEY ALGORITHMS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if (DH_SUPPORT == ENABLED && SSH_DH_KEX_SUPPORT == ENABLED && SSH_MAX_DH_MODULUS_SIZE >= 2048)
+static error_list cryptoBenchDhKeyGen(void *param, uint8_t *data, size_t length)
+{
+    return dhGenerateKeyPair((DhContext *)param, YARROW_PRNG_ALGO, &yarrowContext);
+}
+
+static error_list cryptoBenchDhSharedSecret(void *param, uint8_t *data, size_t length)
+{
+    return dhComputeSharedSecret((DhContext *)param, data, CRYPTO_BENCH_MAX_SIZE, &length);
+}
+
+/**
+ * @brief Measure a Diffie-Hellman key exchange over the 2048-bit MODP group
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchDh(uint8_t *data)
+{
+    DhContext dhContext;
+    error_list error;
+
+    dhInit(&dhContext);
+
+    error = sshLoadDhModpGroup(&dhContext.params, "diffie-hellman-group14-sha256");
+    if (!error)
+        error = cryptoBenchRun("pkc", "dh2048-keygen", 0, cryptoBenchDhKeyGen, &dhContext, data);
+    // Agree with ourselves, the cost is the same as with a peer
+    if (!error)
+        error = mpiCopy(&dhContext.yb, &dhContext.ya);
+    if (!error)
+        cryptoBenchRun("pkc", "dh2048-shared", 0, cryptoBenchDhSharedSecret, &dhContext, data);
+
+    dhFree(&dhContext);
+}
+#endif
+
+#if (ECDH_SUPPORT == ENABLED)
+static error_list cryptoBenchEcdhKeyGen(void *param, uint8_t *data, size_t length)
+{
+    return ecdhGenerateKeyPair((EcdhContext *)param, YARROW_PRNG_ALGO, &yarrowContext);
+}
+
+static error_list cryptoBenchEcdhSharedSecret(void *param, uint8_t *data, size_t length)
+{
+    return ecdhComputeSharedSecret((EcdhContext *)param, data, CRYPTO_BENCH_MAX_SIZE, &length);
+}
+
+/**
+ * @brief Measure an ECDH key exchange over the given curve
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchEcdh(const EcCurveInfo *curveInfo, const char *keyGenName,
+                            const char *sharedName, uint8_t *data)
+{
+    EcdhContext ecdhContext;
+    error_list error;
+
+    ecdhInit(&ecdhContext);
+
+    error = ecLoadDomainParameters(&ecdhContext.params, curveInfo);
+    if (!error)
+        error = cryptoBenchRun("pkc", keyGenName, 0, cryptoBenchEcdhKeyGen, &ecdhContext, data);
+    if (!error)
+        error = ecCopy(&ecdhContext.qb.q, &ecdhContext.qa.q);
+    if (!error)
+        cryptoBenchRun("pkc", sharedName, 0, cryptoBenchEcdhSharedSecret, &ecdhContext, data);
+
+    ecdhFree(&ecdhContext);
+}
+#endif
+
+#if (ECDSA_SUPPORT == ENABLED)
+// ECDSA key pair and signature
+typedef struct
+{
+    EcDomainParameters params;
+    EcPrivateKey privateKey;
+    EcPublicKey publicKey;
+    EcdsaSignature signature;
+    uint8_t digest[64];
+    size_t digestLen;
+} CryptoBenchEcdsa;
+
+static error_list cryptoBenchEcdsaSign(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchEcdsa *ecdsa = (CryptoBenchEcdsa *)param;
+
+    return ecdsaGenerateSignature(YARROW_PRNG_ALGO, &yarrowContext, &ecdsa->params, &ecdsa->privateKey,
+                                  ecdsa->digest, ecdsa->digestLen, &ecdsa->signature);
+}
+
+static error_list cryptoBenchEcdsaVerify(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchEcdsa *ecdsa = (CryptoBenchEcdsa *)param;
+
+    return ecdsaVerifySignature(&ecdsa->params, &ecdsa->publicKey, ecdsa->digest, ecdsa->digestLen,
+                                &ecdsa->signature);
+}
+
+/**
+ * @brief Measure ECDSA signature generation and verification over the given curve
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchEcdsa(const EcCurveInfo *curveInfo, size_t digestLen, const char *signName,
+                             const char *verifyName, uint8_t *data)
+{
+    CryptoBenchEcdsa ecdsa;
+    error_list error;
+
+    ecInitDomainParameters(&ecdsa.params);
+    ecInitPrivateKey(&ecdsa.privateKey);
+    ecInitPublicKey(&ecdsa.publicKey);
+    ecdsaInitSignature(&ecdsa.signature);
+    memset(ecdsa.digest, 0xA5, sizeof(ecdsa.digest));
+    ecdsa.digestLen = digestLen;
+
+    error = ecLoadDomainParameters(&ecdsa.params, curveInfo);
+    if (!error)
+        error = ecGenerateKeyPair(YARROW_PRNG_ALGO, &yarrowContext, &ecdsa.params, &ecdsa.privateKey,
+                                  &ecdsa.publicKey);
+    if (!error)
+        error = cryptoBenchRun("pkc", signName, 0, cryptoBenchEcdsaSign, &ecdsa, data);
+    if (!error)
+        cryptoBenchRun("pkc", verifyName, 0, cryptoBenchEcdsaVerify, &ecdsa, data);
+
+    ecdsaFreeSignature(&ecdsa.signature);
+    ecFreePublicKey(&ecdsa.publicKey);
+    ecFreePrivateKey(&ecdsa.privateKey);
+    ecFreeDomainParameters(&ecdsa.params);
+}
+#endif
+
+#if (ED25519_SUPPORT == ENABLED)
+// Ed25519 key pair and signature
+typedef struct
+{
+    uint8_t privateKey[ED25519_PRIVATE_KEY_LEN];
+    uint8_t publicKey[ED25519_PUBLIC_KEY_LEN];
+    uint8_t signature[ED25519_SIGNATURE_LEN];
+} CryptoBenchEd25519;
+
+static error_list cryptoBenchEd25519Sign(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchEd25519 *ed25519 = (CryptoBenchEd25519 *)param;
+
+    // Same message size as an SSH exchange hash
+    return ed25519GenerateSignature(ed25519->privateKey, ed25519->publicKey, data, 32, NULL, 0, 0,
+                                    ed25519->signature);
+}
+
+static error_list cryptoBenchEd25519Verify(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchEd25519 *ed25519 = (CryptoBenchEd25519 *)param;
+
+    return ed25519VerifySignature(ed25519->publicKey, data, 32, NULL, 0, 0, ed25519->signature);
+}
+
+/**
+ * @brief Measure Ed25519 signature generation and verification
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchEd25519(uint8_t *data)
+{
+    CryptoBenchEd25519 ed25519;
+    error_list error;
+
+    error = ed25519GenerateKeyPair(YARROW_PRNG_ALGO, &yarrowContext, ed25519.privateKey, ed25519.publicKey);
+    if (!error)
+        error = cryptoBenchRun("pkc", "ed25519-sign", 0, cryptoBenchEd25519Sign, &ed25519, data);
+    if (!error)
+        cryptoBenchRun("pkc", "ed25519-verify", 0, cryptoBenchEd25519Verify, &ed25519, data);
+}
+#endif
+
+#if (RSA_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+// RSA key pair and signature
+typedef struct
+{
+    RsaPrivateKey privateKey;
+    RsaPublicKey publicKey;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    uint8_t signature[256];
+    size_t signatureLen;
+} CryptoBenchRsa;
+
+static error_list cryptoBenchRsaKeyGen(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchRsa *rsa = (CryptoBenchRsa *)param;
+
+    rsaFreePrivateKey(&rsa->privateKey);
+    rsaFreePublicKey(&rsa->publicKey);
+    rsaInitPrivateKey(&rsa->privateKey);
+    rsaInitPublicKey(&rsa->publicKey);
+
+    return rsaGenerateKeyPair(YARROW_PRNG_ALGO, &yarrowContext, 2048, 65537, &rsa->privateKey,
+                              &rsa->publicKey);
+}
+
+static error_list cryptoBenchRsaSign(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchRsa *rsa = (CryptoBenchRsa *)param;
+
+    return rsassaPkcs1v15Sign(&rsa->privateKey, SHA256_HASH_ALGO, rsa->digest, rsa->signature,
+                              &rsa->signatureLen);
+}
+
+static error_list cryptoBenchRsaVerify(void *param, uint8_t *data, size_t length)
+{
+    CryptoBenchRsa *rsa = (CryptoBenchRsa *)param;
+
+    return rsassaPkcs1v15Verify(&rsa->publicKey, SHA256_HASH_ALGO, rsa->digest, rsa->signature,
+                                rsa->signatureLen);
+}
+
+/**
+ * @brief Measure RSA-2048 key generation, signature generation and verification
+ *
+ * @note Key generation takes seconds, so it is usually measured over a single run
+ *
+ */
+static void cryptoBenchRsa(uint8_t *data)
+{
+    CryptoBenchRsa rsa;
+    error_list error;
+
+    rsaInitPrivateKey(&rsa.privateKey);
+    rsaInitPublicKey(&rsa.publicKey);
+    memset(rsa.digest, 0xA5, sizeof(rsa.digest));
+
+    error = cryptoBenchRun("pkc", "rsa2048-keygen", 0, cryptoBenchRsaKeyGen, &rsa, data);
+    if (!error)
+        error = cryptoBenchRun("pkc", "rsa2048-sign", 0, cryptoBenchRsaSign, &rsa, data);
+    if (!error)
+        cryptoBenchRun("pkc", "rsa2048-verify", 0, cryptoBenchRsaVerify, &rsa, data);
+
+    rsaFreePublicKey(&rsa.publicKey);
+    rsaFreePrivateKey(&rsa.privateKey);
+}
+#endif
+
+/**
+ * @brief Measure the public-key operations of the SSH key exchange and authentication
+ *
+ * @note -
+ *
+ */
+static void cryptoBenchPublicKey(uint8_t *data)
+{
+#if (ECDH_SUPPORT == ENABLED && X25519_SUPPORT == ENABLED)
+    cryptoBenchEcdh(X25519_CURVE, "x25519-keygen", "x25519-shared", data);
+#endif
+#if (ECDH_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED)
+    cryptoBenchEcdh(SECP256R1_CURVE, "ecdh-p256-keygen", "ecdh-p256-shared", data);
+#endif
+#if (ECDH_SUPPORT == ENABLED && SECP384R1_SUPPORT == ENABLED)
+    cryptoBenchEcdh(SECP384R1_CURVE, "ecdh-p384-keygen", "ecdh-p384-shared", data);
+#endif
+#if (ECDH_SUPPORT == ENABLED && SECP521R1_SUPPORT == ENABLED)
+    cryptoBenchEcdh(SECP521R1_CURVE, "ecdh-p521-keygen", "ecdh-p521-shared", data);
+#endif
+#if (DH_SUPPORT == ENABLED && SSH_DH_KEX_SUPPORT == ENABLED && SSH_MAX_DH_MODULUS_SIZE >= 2048)
+    cryptoBenchDh(data);
+#endif
+#if (ECDSA_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED)
+    cryptoBenchEcdsa(SECP256R1_CURVE, 32, "ecdsa-p256-sign", "ecdsa-p256-verify", data);
+#endif
+#if (ECDSA_SUPPORT == ENABLED && SECP384R1_SUPPORT == ENABLED)
+    cryptoBenchEcdsa(SECP384R1_CURVE, 48, "ecdsa-p384-sign", "ecdsa-p384-verify", data);
+#endif
+#if (ED25519_SUPPORT == ENABLED)
+    cryptoBenchEd25519(data);
+#endif
+#if (RSA_SUPPORT == ENABLED && SHA256_SUPPORT == ENABLED)
+    cryptoBenchRsa(data);
+#endif
+}
+
+/**
+ * @brief Measure every crypto algorithm enabled in crypto_config.h and print the results
+ *
+ * @note Must be called after WIFI_INIT, which initializes the hardware accelerators and seeds
+ * the PRNG. The hardware backends enabled in crypto_config.h are measured, not the software
+ * fallbacks
+ *
+ */
+void CRYPTO_BENCH_RUN(void)
+{
+    uint8_t *data;
+
+    data = cryptoAllocMem(CRYPTO_BENCH_MAX_SIZE);
+    if (data == NULL)
+    {
+        TRACE_WARNING("Crypto benchmark: out of memory\r\n");
+        return;
+    }
+    memset(data, 0xA5, CRYPTO_BENCH_MAX_SIZE);
+
+#if (APP_CRYPTO_BENCH_JSON == DISABLED)
+    printf("kind,algorithm,bytes,iterations,cycles_per_op,cycles_per_byte,ops_per_sec\n");
+#endif
+
+    cryptoBenchSymmetric(data);
+    cryptoBenchPublicKey(data);
+
+    cryptoFreeMem(data);
+}
@@ -275,6 +275,7 @@ extern "C"
       ERROR_UNKNOWN_SERVICE,
       ERROR_UNKNOWN_REQUEST,
       ERROR_FLOW_CONTROL,
+      ERROR_DECOMPRESSION_FAILED,
 
       ERROR_INVALID_PASSWORD,
       ERROR_INVALID_HANDLE,
@@ -145,6 +145,18 @@ void osDeleteTask(OsTaskId taskId)
 }
 
 
+/**
+ * @brief Retrieve the identifier of the calling task
+ * @return Task identifier referencing the current task
+ **/
+
+OsTaskId osGetCurrentTask(void)
+{
+   //Get the handle of the currently running task
+   return (OsTaskId) xTaskGetCurrentTaskHandle();
+}
+
+
 /**
  * @brief Delay routine
  * @param[in] delay Amount of time for which the calling task should block
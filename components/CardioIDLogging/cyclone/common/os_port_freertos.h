@@ -217,6 +217,7 @@ OsTaskId osCreateStaticTask(const char_t *name, OsTaskCode taskCode,
    int_t priority);
 
 void osDeleteTask(OsTaskId taskId);
+OsTaskId osGetCurrentTask(void);
 void osDelayTask(systime_t delay);
 void osSwitchTask(void);
 void osSuspendAllTasks(void);
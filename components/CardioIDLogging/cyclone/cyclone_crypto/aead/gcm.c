@@ -40,6 +40,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "aead/gcm.h"
+#include "cipher_modes/ctr.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -211,6 +212,9 @@ __weak_func error_list gcmEncrypt(GcmContext *context, const uint8_t *iv,
    size_t ivLen, const uint8_t *a, size_t aLen, const uint8_t *p,
    uint8_t *c, size_t length, uint8_t *t, size_t tLen)
 {
+#if (CTR_SUPPORT == ENABLED)
+   error_list error;
+#endif
    size_t k;
    size_t n;
    uint8_t b[16];
@@ -295,6 +299,27 @@ __weak_func error_list gcmEncrypt(GcmContext *context, const uint8_t *iv,
       n -= k;
    }
 
+#if (CTR_SUPPORT == ENABLED)
+   //Increment counter
+   gcmIncCounter(j);
+
+   //Encrypt the whole plaintext at once. The counter blocks are consecutive,
+   //so that a hardware cipher engine can process them without reloading the
+   //key for each block
+   error = ctrEncrypt(context->cipherAlgo, context->cipherContext, 32, j, p,
+      c, length);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Process ciphertext
+   for(n = 0; n < length; n += 16)
+   {
+      //Apply GHASH function
+      gcmXorBlock(s, s, c + n, MIN(length - n, 16));
+      gcmMul(context, s);
+   }
+#else
    //Length of the plaintext
    n = length;
 
@@ -320,6 +345,7 @@ __weak_func error_list gcmEncrypt(GcmContext *context, const uint8_t *iv,
       c += k;
       n -= k;
    }
+#endif
 
    //Append the 64-bit representation of the length of the AAD and the
    //ciphertext
@@ -358,6 +384,9 @@ __weak_func error_list gcmDecrypt(GcmContext *context, const uint8_t *iv,
    size_t ivLen, const uint8_t *a, size_t aLen, const uint8_t *c,
    uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
 {
+#if (CTR_SUPPORT == ENABLED)
+   error_list error;
+#endif
    uint8_t mask;
    size_t k;
    size_t n;
@@ -444,6 +473,26 @@ __weak_func error_list gcmDecrypt(GcmContext *context, const uint8_t *iv,
       n -= k;
    }
 
+#if (CTR_SUPPORT == ENABLED)
+   //Process ciphertext
+   for(n = 0; n < length; n += 16)
+   {
+      //Apply GHASH function
+      gcmXorBlock(s, s, c + n, MIN(length - n, 16));
+      gcmMul(context, s);
+   }
+
+   //Increment counter
+   gcmIncCounter(j);
+
+   //Decrypt the whole ciphertext at once. GHASH has already gone through
+   //the ciphertext, so that the plaintext may overwrite it
+   error = ctrEncrypt(context->cipherAlgo, context->cipherContext, 32, j, c,
+      p, length);
+   //Any error to report?
+   if(error)
+      return error;
+#else
    //Length of the ciphertext
    n = length;
 
@@ -469,6 +518,7 @@ __weak_func error_list gcmDecrypt(GcmContext *context, const uint8_t *iv,
       p += k;
       n -= k;
    }
+#endif
 
    //Append the 64-bit representation of the length of the AAD and the
    //ciphertext
@@ -213,8 +213,23 @@ void chachaCipher(ChachaContext *context, const uint8_t *input,
       //Compute the number of bytes to encrypt/decrypt at a time
       n = MIN(length, 64 - context->pos);
 
+      //Whole keystream block and word-aligned buffers?
+      if(n == 64 && input != NULL && output != NULL &&
+         (((uintptr_t) input | (uintptr_t) output) & 3) == 0)
+      {
+         //XOR the input data with the keystream a word at a time
+         for(i = 0; i < 16; i++)
+         {
+            ((uint32_t *) output)[i] = ((const uint32_t *) input)[i] ^
+               context->block[i];
+         }
+
+         //Advance data pointers
+         input += n;
+         output += n;
+      }
       //Valid output pointer?
-      if(output != NULL)
+      else if(output != NULL)
       {
          //Point to the keystream
          k = (uint8_t *) context->block + context->pos;
@@ -260,12 +275,11 @@ void chachaCipher(ChachaContext *context, const uint8_t *input,
 void chachaProcessBlock(ChachaContext *context)
 {
    uint_t i;
-   uint32_t *w;
-
-   //Point to the working state
-   w = (uint32_t *) context->block;
+   uint32_t w[16];
 
-   //Copy the state to the working state
+   //Copy the state to the working state. The working state is a local
+   //array, so that the compiler can keep it in registers instead of
+   //reloading it from the context after each store
    for(i = 0; i < 16; i++)
    {
       w[i] = context->state[i];
@@ -291,17 +305,11 @@ void chachaProcessBlock(ChachaContext *context)
       QUARTER_ROUND(w[3], w[4], w[9], w[14]);
    }
 
-   //Add the original input words to the output words
-   for(i = 0; i < 16; i++)
-   {
-      w[i] += context->state[i];
-   }
-
-   //Serialize the result by sequencing the words one-by-one in little-endian
-   //order
+   //Add the original input words to the output words, and serialize the
+   //result by sequencing the words one-by-one in little-endian order
    for(i = 0; i < 16; i++)
    {
-      w[i] = htole32(w[i]);
+      context->block[i] = htole32(w[i] + context->state[i]);
    }
 }
 
@@ -34,6 +34,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "ecc/ec.h"
+#include "ecc/ec_nist.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -990,6 +991,15 @@ __weak_func error_list ecMult(const EcDomainParameters *params, EcPoint *r, cons
    uint_t i;
    Mpi h;
 
+#if (EC_NIST_FAST_SUPPORT == ENABLED)
+   //P-256 or P-384 curve?
+   if(ecNistGetCurve(params) != NULL)
+   {
+      //Use the fixed-width implementation
+      return ecNistMult(params, r, d, s);
+   }
+#endif
+
    //Initialize multiple precision integer
    mpiInit(&h);
 
@@ -1149,6 +1159,15 @@ error_list ecTwinMult(const EcDomainParameters *params, EcPoint *r,
    EcPoint spt;
    EcPoint smt;
 
+#if (EC_NIST_FAST_SUPPORT == ENABLED)
+   //P-256 or P-384 curve?
+   if(ecNistGetCurve(params) != NULL)
+   {
+      //Use the fixed-width implementation
+      return ecNistTwinMult(params, r, d0, s, d1, t);
+   }
+#endif
+
    //Initialize EC points
    ecInit(&spt);
    ecInit(&smt);
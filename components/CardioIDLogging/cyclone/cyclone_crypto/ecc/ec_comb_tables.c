@@ -0,0 +1,6453 @@
+/**
+ * @file ec_comb_tables.c
+ * @brief Fixed-base comb tables (generated by tools/gen_comb_tables.py)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Do not edit. Each table holds the 2^w - 1 non-trivial combinations of
+ * the points 2^(i * d).G, 0 <= i < w, in affine coordinates
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_comb_tables.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && EC_NIST_FAST_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED)
+
+#if (SECP256R1_COMB_WIDTH == 4)
+
+//Comb table (4 teeth, 64 columns)
+const uint32_t ecNistP256Comb[] =
+{
+   //T[0]
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81,
+   0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357,
+   0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   //T[1]
+   0x8E14DB63, 0x90E75CB4, 0xAD651F7E, 0x29493BAA,
+   0x326E25DE, 0x8492592E, 0x2811AAA5, 0x0FA822BC,
+   0x5F462EE7, 0xE4112454, 0x50FE82F5, 0x34B1A650,
+   0xB3DF188B, 0x6F4AD4BC, 0xF5DBA80D, 0xBFF44AE8,
+   //T[2]
+   0x097992AF, 0x93391CE2, 0x0D35F1FA, 0xE96C98FD,
+   0x95E02789, 0xB257C0DE, 0x89D6726F, 0x300A4BBC,
+   0xC08127A0, 0xAA54A291, 0xA9D806A5, 0x5BB1EEAD,
+   0xFF1E3C6F, 0x7F1DDB25, 0xD09B4644, 0x72AAC7E0,
+   //T[3]
+   0xD789BD85, 0x57C84FC9, 0xC297EAC3, 0xFC35FF7D,
+   0x88C6766E, 0xFB982FD5, 0xEEDB5E67, 0x447D739B,
+   0x72E25B32, 0x0C7E33C9, 0xA7FAE500, 0x3D349B95,
+   0x3A4AAFF7, 0xE12E9D95, 0x834131EE, 0x2D4825AB,
+   //T[4]
+   0x2A1D367F, 0x13949C93, 0x1A0A11B7, 0xEF7FBD2B,
+   0xB91DFC60, 0xDDC6068B, 0x8A9C72FF, 0xEF951932,
+   0x7376D8A8, 0x196035A7, 0x95CA1740, 0x23183B08,
+   0x022C219C, 0xC1EE9807, 0x7DBB2C9B, 0x611E9FC3,
+   //T[5]
+   0x0B57F4BC, 0xCAE2B192, 0xC6C9BC36, 0x2936DF5E,
+   0xE11238BF, 0x7DEA6482, 0x7B51F5D8, 0x55066379,
+   0x348A964C, 0x44FFE216, 0xDBDEFBE1, 0x9FB3D576,
+   0x8D9D50E5, 0x0AFA4001, 0x8AECB851, 0x15716484,
+   //T[6]
+   0xFC5CDE01, 0xE48ECAFF, 0x0D715F26, 0x7CCD84E7,
+   0xF43E4391, 0xA2E8F483, 0xB21141EA, 0xEB5D7745,
+   0x731A3479, 0xCAC917E2, 0x2844B645, 0x85F22CFE,
+   0x58006CEE, 0x0990E6A1, 0xDBECC17B, 0xEAFD72EB,
+   //T[7]
+   0x313728BE, 0x6CF20FFB, 0xA3C6B94A, 0x96439591,
+   0x44315FC5, 0x2736FF83, 0xA7849276, 0xA6D39677,
+   0xC357F5F4, 0xF2BAB833, 0x2284059B, 0x824A920C,
+   0x2D27ECDF, 0x66B8BABD, 0x9B0B8816, 0x674F8474,
+   //T[8]
+   0x677C8A3E, 0x2DF48C04, 0x0203A56B, 0x74E02F08,
+   0xB8C7FEDB, 0x31855F7D, 0x72C9DDAD, 0x4E769E76,
+   0xB824BBB0, 0xA4C36165, 0x3B9122A5, 0xFB9AE16F,
+   0x06947281, 0x1EC00572, 0xDE830663, 0x42B99082,
+   //T[9]
+   0xDDA868B9, 0x6EF95150, 0x9C0CE131, 0xD1F89E79,
+   0x08A1C478, 0x7FDC1CA0, 0x1C6CE04D, 0x78878EF6,
+   0x1FE0D976, 0x9C62B912, 0xBDE08D4F, 0x6ACE570E,
+   0x12309DEF, 0xDE53142C, 0x7B72C321, 0xB6CB3F5D,
+   //T[10]
+   0xC31A3573, 0x7F991ED2, 0xD54FB496, 0x5B82DD5B,
+   0x812FFCAE, 0x595C5220, 0x716B1287, 0x0C88BC4D,
+   0x5F48ACA8, 0x3A57BF63, 0xDF2564F3, 0x7C8181F4,
+   0x9C04E6AA, 0x18D1B5B3, 0xF3901DC6, 0xDD5DDEA3,
+   //T[11]
+   0x3E72AD0C, 0xE96A79FB, 0x42BA792F, 0x43A0A28C,
+   0x083E49F3, 0xEFE0A423, 0x6B317466, 0x68F344AF,
+   0x3FB24D4A, 0xCDFE17DB, 0x71F5C626, 0x668BFC22,
+   0x24D67FF3, 0x604ED93C, 0xF8540A20, 0x31B9C405,
+   //T[12]
+   0xA2582E7F, 0xD36B4789, 0x4EC39C28, 0x0D1A1014,
+   0xEDBAD7A0, 0x663C62C3, 0x6F461DB9, 0x4052BF4B,
+   0x188D25EB, 0x235A27C3, 0x99BFCC5B, 0xE724F339,
+   0x71D70CC8, 0x862BE6BD, 0x90B0FC61, 0xFECF4D51,
+   //T[13]
+   0xA1D4CFAC, 0x74346C10, 0x8526A7A4, 0xAFDF5CC0,
+   0xF62BFF7A, 0x123202A8, 0xC802E41A, 0x1EDDBAE2,
+   0xD603F844, 0x8FA0AF2D, 0x4C701917, 0x36E06B7E,
+   0x73DB33A0, 0x0C45F452, 0x560EBCFC, 0x43104D86,
+   //T[14]
+   0x0D1D78E5, 0x9615B511, 0x25C4744B, 0x66B0DE32,
+   0x6AAF363A, 0x0A4A46FB, 0x84F7A21C, 0xB48E26B4,
+   0x21A01B2D, 0x06EBB0F6, 0x8B7B0F98, 0xC004E404,
+   0xFED6F668, 0x64131BCD, 0x4D4D3DAB, 0xFAC01540
+};
+
+#elif (SECP256R1_COMB_WIDTH == 6)
+
+//Comb table (6 teeth, 43 columns)
+const uint32_t ecNistP256Comb[] =
+{
+   //T[0]
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81,
+   0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357,
+   0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   //T[1]
+   0xB049E7CD, 0xCD013F88, 0xE57FDC00, 0xE8F9257A,
+   0xFC3A9301, 0x3BE71969, 0x58CFF937, 0x987F256D,
+   0x6EFA35D6, 0xB7254BBC, 0x07AAFFDB, 0x47B46052,
+   0x0007E39E, 0xE860EBD6, 0x94EC505C, 0x8E926956,
+   //T[2]
+   0x5A1C3FB1, 0x59DB167C, 0xBF318EB2, 0x98B3CE2A,
+   0xD2BC2FA6, 0x2DF1C41E, 0x6ED1B2AF, 0xEFCC2C43,
+   0x97B25513, 0x17FE07F1, 0x3734A589, 0x46824533,
+   0xED34F543, 0xA5384A77, 0x8D9F3863, 0xF3684F9C,
+   //T[3]
+   0xBF780C2C, 0xFDC73E83, 0x2D666817, 0xFFDC6794,
+   0x02436893, 0xC14B66DD, 0x0D54650C, 0x6EEC9567,
+   0xEDBFCD32, 0x089EC1A1, 0x3A07FF89, 0x79AB6615,
+   0x65EA0105, 0xFC281DE0, 0x997732C2, 0x14BB5350,
+   //T[4]
+   0x7318188E, 0xAEC90264, 0xCA167099, 0x410BEC28,
+   0x099C202B, 0xBF664D2F, 0x55FA625C, 0x13CCCA34,
+   0x05421C0C, 0xAA84C231, 0x6CDB0D71, 0x6B647521,
+   0xFB216A5E, 0xE90446B1, 0xAF46893D, 0x4B5BA5A5,
+   //T[5]
+   0x4862C5DB, 0xACA2FA08, 0xA1717F8A, 0xDDFFC222,
+   0xE4E09FD2, 0xAB839A14, 0x980330F5, 0xF86A9078,
+   0xC1DD7DCC, 0x6890F24C, 0xEA6EFD98, 0xF75DCCFA,
+   0xFF9A093B, 0xBA2612B8, 0x2568653C, 0x20347D0C,
+   //T[6]
+   0xCBDB1C78, 0xD3B22809, 0x30F6CDA4, 0x5591C8EB,
+   0xBFE80F8B, 0xB6E28740, 0x40E7E7E7, 0x0F74342A,
+   0x351C51F2, 0xD2968E87, 0xF5E17B5E, 0x65C5C581,
+   0x9D994E2E, 0x6F58F02A, 0xF5C1EC07, 0x531C0B00,
+   //T[7]
+   0x1A6B665E, 0xEB042121, 0xA7F6803A, 0x802F779E,
+   0x3C0804C3, 0x47501F2A, 0x4945A1D4, 0xA263919B,
+   0x30BCDCFB, 0x9EE40400, 0x4C00EFE2, 0xAC3F83DF,
+   0xE60D60C5, 0x2E9D3C9D, 0x2AED20FC, 0x873200BD,
+   //T[8]
+   0x8B21AA51, 0x2B52C47D, 0x5A7E870D, 0x0F503629,
+   0x88B45127, 0xBAA92814, 0xC402E050, 0x27D6451E,
+   0x5567432D, 0x5C96EC14, 0x0F4150C7, 0xCDEB9829,
+   0xCDEEF566, 0x5D91740C, 0x1BE9E583, 0x2A58FA5E,
+   //T[9]
+   0x5788C0F6, 0xD8142DFF, 0x247FDE25, 0x89BF5229,
+   0x14E2280F, 0x5C971DDB, 0x09904E3F, 0x785B7E91,
+   0x2E7E6F0B, 0x445E4519, 0x4CE293DD, 0x8789440E,
+   0xC797BE30, 0x96B84F57, 0xFA3EA32D, 0x6B44059D,
+   //T[10]
+   0x2195A979, 0x73B7C550, 0xB8DD5813, 0x2D7ED474,
+   0xE104E9AC, 0xC0B9ECD2, 0xA2BD0ED8, 0xDC90D975,
+   0x4DD6EB2E, 0x9FB55203, 0xC01DFDE8, 0x50D554BB,
+   0xF0977A30, 0x4CFD3277, 0x815374C4, 0xC87CE232,
+   //T[11]
+   0xCF9A3CA9, 0xE4B541B6, 0x08B49B2F, 0x1C650587,
+   0xF552641E, 0xB95F91B3, 0x5C301277, 0xBDDC23AC,
+   0x04DABA43, 0x519D0700, 0x8450CFA2, 0xC003DCC3,
+   0x4E48EFDE, 0x73A1C8F5, 0x5B04F761, 0x7D0CA942,
+   //T[12]
+   0x1703406D, 0xCB4DC35B, 0x75DAC54C, 0x4FD3AFC9,
+   0x29F02878, 0x112321EB, 0xAD6B225F, 0xAFB18D2F,
+   0xF1776A67, 0xDDF58273, 0xF6B96C2F, 0x96889755,
+   0x22208FFB, 0x31A8D663, 0xFCCA4877, 0x5ED81C10,
+   //T[13]
+   0xE834A3C4, 0xFF0E1F34, 0x1C4AB236, 0x0D59B6AE,
+   0x015A211B, 0x10EB194A, 0x3892DDC5, 0xED6E13E0,
+   0xFB3F678D, 0xAC88DF04, 0x544026A9, 0x6F0FBF44,
+   0x619CECBA, 0xCDE8CD7A, 0x80D9A8CC, 0x02F322E5,
+   //T[14]
+   0x336AAF40, 0x2DC61E1B, 0x4251F5B7, 0x897E87BD,
+   0x6511B370, 0x2FB32023, 0x2341F499, 0x460FA9CF,
+   0xCBAF01A7, 0x03E63B79, 0x44157434, 0x937E123F,
+   0x809E4A1A, 0x9D59226E, 0x41775E62, 0x18D6F63A,
+   //T[15]
+   0xA9AA52DF, 0x3CD5F4E4, 0xB42A627F, 0x18C452B1,
+   0xD991ECE6, 0x6DBC4189, 0x7F608BF7, 0x45A511C9,
+   0x125EC16C, 0x7B52BD12, 0xD22955CE, 0x5A919B27,
+   0xCB625AD2, 0x3FE3337F, 0x73EA9B6D, 0x73BE0EC7,
+   //T[16]
+   0x016476EA, 0xC6E4B6D0, 0xD4EC2510, 0x71B9A7E5,
+   0xCBE490D2, 0x1975B71E, 0xB52ACD25, 0xDF6B472F,
+   0x784055EB, 0xF1738716, 0xB87D399E, 0xCCC7B0B3,
+   0x1BB51119, 0x3C9A1337, 0xA88FD593, 0xB42639E1,
+   //T[17]
+   0xC219C20B, 0x86A38D54, 0xB50A4733, 0xAFCDD2CA,
+   0x72096638, 0xF4CF8797, 0x24CE0E94, 0xD949CAA2,
+   0x96F9AE13, 0x678664AE, 0xC984DE46, 0x00EF5BA9,
+   0x8D549567, 0x622ABC7F, 0x57DB924D, 0x673ED500,
+   //T[18]
+   0x20B4D697, 0x41E94206, 0x29FA0DF9, 0xA10FD0D9,
+   0x76022C38, 0xF11EB0A7, 0xA5621C63, 0xFFCB7DDC,
+   0x0927965A, 0x24E37B1B, 0xBD2C199E, 0x8D9FC102,
+   0x907F3F85, 0x862DE75E, 0x5A9C778E, 0xD3985129,
+   //T[19]
+   0xB56BC451, 0x48D63748, 0xA939440A, 0x0544DE81,
+   0x664EC19C, 0xDA24EB0B, 0x41F42BF6, 0x4FB6E562,
+   0x66BB5D6B, 0x21B2C80E, 0xD25BD41B, 0xA4123924,
+   0xBCE2D418, 0x6F95F5F2, 0x4D6D91D8, 0xA9232776,
+   //T[20]
+   0xF119B8CC, 0x546A08E7, 0x8AFC696A, 0x03B7D523,
+   0x459F70B4, 0x0A896132, 0xA86A9116, 0x57A46257,
+   0xBB314C65, 0xFAA56FEF, 0x74795C6D, 0xF4E61F40,
+   0x437850D6, 0x1A3C5652, 0x6621EC11, 0x7C4B127D,
+   //T[21]
+   0xE83CFA35, 0x6DD25E26, 0x1FF3BDDC, 0x61E44DA0,
+   0x121733FA, 0xB7B67B02, 0xFCD798CA, 0x7C48F60D,
+   0x090F5154, 0x244D234A, 0x8CAE33BB, 0x93B7F2FB,
+   0x426D1516, 0x158BF2F6, 0xA801E86E, 0xA8A947A8,
+   //T[22]
+   0x56C8815E, 0xF41E0307, 0x7D37A2F1, 0xBAF647E3,
+   0xFEFAFBF5, 0x7791EB36, 0x35B7F606, 0x158262FB,
+   0x32DCE9E5, 0xF6C32255, 0x361B4780, 0x6C7CD4CE,
+   0x3F85288F, 0xE5BE5E70, 0xC98E624A, 0x4C281AA3,
+   //T[23]
+   0x7FD58AE5, 0x9D7F749E, 0x37EA57A2, 0xC78BA263,
+   0x4F5AB5B7, 0xB5C05127, 0x5F2D643B, 0x6FD3F54D,
+   0x2116B8CE, 0x3428E311, 0x71B28987, 0xC52D1D24,
+   0x8299421F, 0x87F70BE9, 0x64F49798, 0x0A5FD098,
+   //T[24]
+   0x4D6A3DEF, 0x5B2911DD, 0xB96008F1, 0x4BEDD07C,
+   0xE36E7D64, 0xEE748A6F, 0x4BBF5CF4, 0xBFC49934,
+   0x8E74750F, 0x55C6F62D, 0x48919902, 0x22639F87,
+   0x958A248F, 0xFA01AA94, 0xED51AA40, 0x2743AE8A,
+   //T[25]
+   0xE76CCBC0, 0x75EA69CB, 0xA762DEB7, 0xC9736051,
+   0xAF2BFF4C, 0xA720D4C6, 0xBE6D6DBA, 0x8E4C7B10,
+   0x2F128433, 0xAF5C0EFE, 0xA1FE85EC, 0x834CBF1F,
+   0x2685F018, 0xD321C5A6, 0x717A5340, 0xB5B09CF6,
+   //T[26]
+   0x86EB7815, 0x9CDDA821, 0xCE413265, 0x8C003612,
+   0x91B577F5, 0x8BCE1FAB, 0x488F730C, 0x0F3F29FF,
+   0xE6960D55, 0xEBB08063, 0xAECBF467, 0x1A9699E2,
+   0x4CE5761B, 0x6B1564A4, 0x81382996, 0x08F00EA5,
+   //T[27]
+   0x96BF8EA5, 0x6C10CDD2, 0xE8CD868F, 0xE28C488A,
+   0x46442D00, 0xBA9226C3, 0xFA1F864B, 0x9125CAED,
+   0x2E21B4AF, 0xF33BD66E, 0x68DBE58C, 0x12DC5537,
+   0xE5353044, 0xD9B85123, 0x07BC6B60, 0xF4925BDE,
+   //T[28]
+   0x70514A21, 0x0D17FF39, 0xDADD80EE, 0xD2A7B5BA,
+   0x8126C8C4, 0x941E33C3, 0x1D57C1DE, 0xB9E156D0,
+   0xEA8105AD, 0x220D500D, 0x0202F3AE, 0x6A2AA462,
+   0x3DC96356, 0x450056AB, 0x452142C3, 0x506AB6AA,
+   //T[29]
+   0x1B20D599, 0xE0CB1029, 0x10A5FBA0, 0x7B1ED83D,
+   0x04007713, 0x7D5FB32B, 0x79C82639, 0x93BAB590,
+   0x49B97D9D, 0x977FA5A6, 0x3551254A, 0xA3592333,
+   0xA9F7A3EB, 0x8F277388, 0xE3026E2C, 0x36ABA935,
+   //T[30]
+   0xC05131CD, 0xF197735B, 0x22BEB567, 0x05650768,
+   0xF7F55B1F, 0xDBF2B189, 0x132C2614, 0xAA144C82,
+   0xB3822251, 0xF41CBE14, 0xFFD0AFBE, 0xB1CE72B2,
+   0x844743FA, 0x01A14D18, 0x923739B8, 0xC1D89FE3,
+   //T[31]
+   0x0B79847D, 0xF0F679F1, 0x6BB19BE6, 0x3719A8B6,
+   0xDC7F43D5, 0x2DDB6C3D, 0xDA0982E2, 0x2800043A,
+   0x908D9EDA, 0xFE5B0083, 0xB8513AE9, 0xA87058DB,
+   0x84A4DC3B, 0xB6C07965, 0x67E82909, 0x0F991746,
+   //T[32]
+   0x5F3F5B80, 0x12416A5C, 0xDA522422, 0x58E903DB,
+   0x4291867E, 0x18CC80F1, 0x7A152C2B, 0xB2035CF8,
+   0x95C80EDE, 0x71125691, 0xAF97C5B0, 0xBFE02568,
+   0x8A14E493, 0x603E1DC5, 0x749680DE, 0xF12F359C,
+   //T[33]
+   0x6AA2B49D, 0x1CAAB0BA, 0x6F7FC502, 0x6A75A768,
+   0x57EA120F, 0x6A5EA5A8, 0xDB6BDF96, 0x998CD5F9,
+   0x467184A9, 0xD2D7BA4C, 0x25C03723, 0xBE178E54,
+   0xBC389EF3, 0x6BFC1707, 0x7B7D9FB3, 0x3256A8A0,
+   //T[34]
+   0xFEA77B0C, 0x40429D1B, 0x595E9A31, 0x4651A4DC,
+   0xE712693A, 0x8900AAB1, 0x84BF612D, 0x90EA7767,
+   0x0D02F2B6, 0xBDD10425, 0xFB4D594F, 0xF5583BCC,
+   0x5BA7B6A1, 0x75754462, 0x101E86F4, 0xD1A321D3,
+   //T[35]
+   0x5AC0B3DB, 0x7A2F10B2, 0xF0B98928, 0xE6DEFFA0,
+   0xE6B0B01A, 0xB4B2939B, 0x0A3F2CA8, 0xA03E1D52,
+   0x2CBEAD24, 0xFC779531, 0xD30FA3F9, 0xE8362908,
+   0xF23B00BB, 0x6F29D6F4, 0xEBB82E0A, 0xEA1AD22F,
+   //T[36]
+   0xE62DA069, 0x6890B26C, 0x7C586265, 0xA5702319,
+   0x865672AB, 0xE64E19BF, 0xA07D9893, 0xA66503F5,
+   0x21FE4743, 0xE4DEB7C0, 0x7D7100BE, 0x3BAE847D,
+   0xE17B1D29, 0x1769FCA7, 0x320AFC60, 0xADBA60EC,
+   //T[37]
+   0x89806E19, 0x74814E1C, 0xF9EC85DE, 0x9135FC8D,
+   0x09AFD25B, 0x0EE660A6, 0x6740A284, 0x943DE3B7,
+   0x622227D9, 0xDBA0327F, 0xD4C486E8, 0xA524C6D6,
+   0x7134581A, 0x217FB779, 0xE4254A7E, 0xAFA3B65F,
+   //T[38]
+   0xC4E48158, 0xA3C9D614, 0xAE8FC508, 0xB26B4A98,
+   0x38B68E18, 0x44EF8BE0, 0xDB271FCD, 0xBE9CF596,
+   0x8E6F95AD, 0x737B653E, 0x9B9E4D0A, 0x73DBE6FF,
+   0xA4139F59, 0x4B772A8C, 0x66C67E8A, 0xA1F335E5,
+   //T[39]
+   0x2D00715B, 0x0ABFA3EE, 0xC8297B47, 0xF3F65DC1,
+   0x00669E85, 0x4199B659, 0x23C09567, 0x7588DF7F,
+   0x868D3227, 0xABDF62FA, 0x8099A8FC, 0xA0844D34,
+   0x3BABBC72, 0x3361B9C0, 0x6D5BF03B, 0xBB0357A4,
+   //T[40]
+   0xF77CF152, 0xC0B161FB, 0x8CE30043, 0x243C4FED,
+   0x050E20DF, 0xB1B4A2D0, 0xC34999AE, 0x5A61A286,
+   0x70214EB7, 0x8C7BAF68, 0xF2C261FE, 0x975BCA7D,
+   0x1ED91AE8, 0x03C6DF31, 0xA1380D38, 0xE8CFAAAD,
+   //T[41]
+   0x016F613C, 0xA6BCC84D, 0xC2EC4E56, 0xAE5CE038,
+   0xF8BE76B4, 0xAD80F035, 0x84642DD4, 0x00456C5C,
+   0xDE3648C8, 0x0EF7079F, 0x68D0A170, 0x7BF0B3AB,
+   0x56C684E3, 0xA85C96B8, 0x91D65C88, 0xFD39B0F2,
+   //T[42]
+   0x966D28DD, 0xC79E3178, 0x89F8A2C1, 0x67BA8686,
+   0x4ACF8D42, 0xAF1F9C6D, 0xE0847F7D, 0x2D2B4273,
+   0x69130CEC, 0x1D9E1A90, 0x9383E7B5, 0x95CB10FD,
+   0x44CC71AE, 0x73438A26, 0x1EE4EA49, 0x37EAEB10,
+   //T[43]
+   0x620C767B, 0x2A675B54, 0x5AE6598E, 0xF1235F08,
+   0x48A35E9B, 0x3CF6A1CD, 0xD8A1B5F8, 0xF11A113E,
+   0x1742A887, 0xA401985D, 0xB6A73D9B, 0x3F83BD07,
+   0x82736067, 0x3C7307A0, 0x1F12FBB6, 0x64A1A66D,
+   //T[44]
+   0xD84A37DE, 0x1C12B5CB, 0xC7B1EA1A, 0x56D66DB4,
+   0x2CE31E9A, 0x852BE420, 0xE40FAF48, 0x17BE9C2D,
+   0x38CC8797, 0x735B3CCB, 0x34B1093E, 0x1F8D9D80,
+   0xE75B81C0, 0xD8CC6E86, 0x3FDBE697, 0x6914BF94,
+   //T[45]
+   0x0CCF3981, 0x422618C9, 0x8DAB3936, 0x7F5F9610,
+   0x8E0A6A28, 0xCA4AB750, 0xD5BAB133, 0x8266E2FE,
+   0xAB5500F6, 0xFAA7545B, 0x5D994D86, 0xA91EDAEB,
+   0x67FB462D, 0x0A5B194B, 0x287178CE, 0x089CFD68,
+   //T[46]
+   0x00B16F35, 0x54B44D33, 0x002D5707, 0x59988EF3,
+   0xD0494F94, 0x256FE1EB, 0x7F710DE4, 0xAEF84169,
+   0x8BD49604, 0xCA38FB1F, 0xBFA0B15C, 0xAEC9DAAE,
+   0x642CF6DD, 0x1551365E, 0x160E8FFF, 0x75B8B0FA,
+   //T[47]
+   0x01FEEA35, 0xB2466027, 0x317C61F1, 0xEA17F580,
+   0x786AACEB, 0x8D71EABA, 0x1CC47DAB, 0x7DE7454A,
+   0xFF1B1266, 0x10B69D62, 0xB9AB079C, 0xE22CC59B,
+   0x42B2D441, 0x9A57E43F, 0xE8C85F85, 0x22340FEC,
+   //T[48]
+   0xEDAB9CB9, 0x6033D113, 0xE69D45EE, 0x1DF87BA3,
+   0xE4D65A03, 0x93436236, 0x3F98A508, 0x5893F6F9,
+   0xAAD54FAB, 0xB3832E15, 0x6BC7365E, 0x3277FF0D,
+   0x200C4FB8, 0xE8301118, 0xD4E9384D, 0x26E471BC,
+   //T[49]
+   0x68C28F39, 0x1C1DD91A, 0xF35669CA, 0xFA494334,
+   0x51ABB743, 0x77B40ABD, 0xE7873A25, 0xEE7400BA,
+   0xED2309D9, 0xF15D9BF5, 0x3DA8785A, 0x8A90D13F,
+   0x1BE8B67D, 0x7E4FB96C, 0xCAE9ED81, 0x196C1BA4,
+   //T[50]
+   0xC52427D8, 0x3276C5A4, 0xF5A34B64, 0x66958243,
+   0xF36E0D92, 0x04166798, 0xC6E9E63F, 0x43E33927,
+   0xF0CA8D2B, 0x899AED76, 0x0AF50DD8, 0x43B89CDE,
+   0x5951E13B, 0x805EA21E, 0x28413043, 0xE210DAA4,
+   //T[51]
+   0x98A174FC, 0xE17F627B, 0x4DFA285E, 0x5EBCE1FF,
+   0x54C5F925, 0xC95FE23D, 0x3188BA78, 0x5EA59A09,
+   0x2D2D8163, 0x6615BB54, 0x5DB03D95, 0x37BE4A1E,
+   0x4FC47762, 0xC51B5692, 0xD142931D, 0xB994CA42,
+   //T[52]
+   0x0758035B, 0xCE46A165, 0xE070A0C9, 0xB33DF1AD,
+   0x686934C9, 0xBF01FB38, 0xF0F16ED0, 0x1CBA6257,
+   0xEE93409C, 0xE538A9B6, 0x4A6B38DA, 0xD82429A1,
+   0xA5C215B1, 0x1488770D, 0x891D7658, 0x4ADE1F8E,
+   //T[53]
+   0x51A03105, 0xBF93CDA8, 0x7BE433ED, 0xB14F4A60,
+   0xFA1C97A1, 0x0AA4C4C3, 0xBCED726E, 0xFE1A6375,
+   0x0409C304, 0x4DB68287, 0xEBF37AF4, 0x08FB9622,
+   0xF6ABDFF4, 0x677003EC, 0x3FB7CC37, 0xE6B2E872,
+   //T[54]
+   0x27ADE63F, 0xFE702B4B, 0xA105673A, 0x5DF11A33,
+   0xA362B9CE, 0x0D33CB80, 0x855BB209, 0xA7BB42F5,
+   0xC95FE575, 0xFDCC6096, 0x2351DEC6, 0xFF0E08D7,
+   0xBB6A5B28, 0xA3323FF5, 0x89F7A2AB, 0x2CAA2DAE,
+   //T[55]
+   0x51FF89BB, 0x252566B6, 0xDB973DDC, 0x453C333E,
+   0xD83F2CC2, 0xFBCD5A09, 0x3121DBD5, 0x187818EC,
+   0x3B46B949, 0xAEA1B45F, 0x55F753E0, 0x42314623,
+   0xB09991FA, 0xD59AB00B, 0x0AE0C8D7, 0xEE05650D,
+   //T[56]
+   0x2DA7EB49, 0x2096D676, 0xFB775E41, 0x6E04768E,
+   0xAF24F76C, 0xC3349C3D, 0xDE0C90F6, 0xE6DB6CCA,
+   0xA416FD87, 0x98AA01F5, 0x781EC427, 0x84C3270B,
+   0x021034B2, 0x37680F04, 0x654BF735, 0xEB90FE3C,
+   //T[57]
+   0xE4976DD8, 0xEAF7623C, 0xE29BD0B4, 0x92528B1A,
+   0x645CEC2A, 0x78158ECD, 0xB11325E9, 0x3265EAD8,
+   0xC04780B7, 0x1CA27AF8, 0x2465867D, 0x14EF0845,
+   0x2FEEFE38, 0xB45C1887, 0x5D8730E9, 0x7C4D96BC,
+   //T[58]
+   0xB3571976, 0x8E35BF16, 0x346864E7, 0xE2EB0C63,
+   0x7E9B6C7F, 0x2B7B57E0, 0x70B35A98, 0x3157CF6F,
+   0x5AC49EA5, 0xFEC24C14, 0x6B1A32AE, 0xC20C5690,
+   0x345FA335, 0xEAEF7B4E, 0x4077475F, 0xB4C9655D,
+   //T[59]
+   0x6C38B3DA, 0x3C3D8C9B, 0x754433E3, 0x80818302,
+   0xE29E542A, 0xFE68AB07, 0xD12CBB2C, 0x81A25A61,
+   0x8F685647, 0x559948A7, 0x83A56574, 0xE14EBCF6,
+   0x7A77DB0F, 0x1A606632, 0x0892CE93, 0xF49D838F,
+   //T[60]
+   0xFCF866B9, 0xF3F4E3FE, 0xE18B0AD5, 0x152A0807,
+   0x1B9B2E7B, 0x2EC4C706, 0xDADD006F, 0x41D7E92B,
+   0x1D4B6EF7, 0xFF0A8A79, 0xB2AA2F47, 0x02344DFF,
+   0x357A0681, 0x1726D704, 0xC1BC85F4, 0x4CE6BB77,
+   //T[61]
+   0x8916A00D, 0x651EBB86, 0x001E908D, 0xBA4D2DA9,
+   0x1684FCB0, 0x5F2B68E6, 0x10AC6EDF, 0xC3FF8D75,
+   0xF5C49A61, 0x6997E3EA, 0xB1A4DC68, 0x8F4FF372,
+   0xC95C2DB2, 0xBEA7CE04, 0x9D10F761, 0x2ACCB4F4,
+   //T[62]
+   0xAFCC2BEF, 0xB9E437F4, 0x3ADA2B53, 0x4F1FB2D6,
+   0xBB580C9A, 0xE6C0E12D, 0x33C7546D, 0x25183734,
+   0xBFD92FB9, 0xAB12D90F, 0xA185AE46, 0x2CB9B9B3,
+   0x9CE6F49F, 0x2A0C7A7E, 0xB48F21F2, 0x531F307F
+};
+
+#elif (SECP256R1_COMB_WIDTH == 8)
+
+//Comb table (8 teeth, 32 columns)
+const uint32_t ecNistP256Comb[] =
+{
+   //T[0]
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81,
+   0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2,
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357,
+   0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2,
+   //T[1]
+   0x185A5943, 0x3A5A9E22, 0x5C65DFB6, 0x1AB91936,
+   0x262C71DA, 0x21656B32, 0xAF22AF89, 0x7FE36B40,
+   0x699CA101, 0xD50D152C, 0x7B8AF212, 0x74B3D586,
+   0x07DCA6F1, 0x9F09F404, 0x25B63624, 0xE697D458,
+   //T[2]
+   0x8101E6E4, 0x16FC51FF, 0xFCCC3AC2, 0x830895E4,
+   0x4AA7358F, 0x608548C2, 0x0CEDC02A, 0xE3579822,
+   0x52C392C3, 0xAAD2B998, 0xC523E6EF, 0xF0570BED,
+   0x768A3299, 0xF3E4B396, 0x1F433A2D, 0x700F948E,
+   //T[3]
+   0x8E14DB63, 0x90E75CB4, 0xAD651F7E, 0x29493BAA,
+   0x326E25DE, 0x8492592E, 0x2811AAA5, 0x0FA822BC,
+   0x5F462EE7, 0xE4112454, 0x50FE82F5, 0x34B1A650,
+   0xB3DF188B, 0x6F4AD4BC, 0xF5DBA80D, 0xBFF44AE8,
+   //T[4]
+   0x097992AF, 0x93391CE2, 0x0D35F1FA, 0xE96C98FD,
+   0x95E02789, 0xB257C0DE, 0x89D6726F, 0x300A4BBC,
+   0xC08127A0, 0xAA54A291, 0xA9D806A5, 0x5BB1EEAD,
+   0xFF1E3C6F, 0x7F1DDB25, 0xD09B4644, 0x72AAC7E0,
+   //T[5]
+   0xEE4039A0, 0xD6E260F8, 0x6C224571, 0xE0D3EB33,
+   0x680A7DAA, 0xA9CAD33B, 0x606A4A62, 0x14CB5692,
+   0x9D83BC01, 0xFE93D315, 0x8039927C, 0x5205EF8D,
+   0x997A9A3B, 0x878487ED, 0x3E1E4663, 0x53098CFA,
+   //T[6]
+   0xD945111E, 0x30368CB6, 0xF5C4AD42, 0x585A137E,
+   0xFFEA17C1, 0xC22C48C5, 0x958F1608, 0xA5AB9E10,
+   0x785B4ED9, 0xC34A47B8, 0x49A10F77, 0x46ED771C,
+   0xAD0648F4, 0x629E17EB, 0x8B1AA09A, 0xD3EBC611,
+   //T[7]
+   0x7512218E, 0xA84AA939, 0x74CA0141, 0xE9A521B0,
+   0x18A2E902, 0x57880B3A, 0x12A677A6, 0x4A5B5066,
+   0x4C4F3840, 0x0BEADA7A, 0x19E26D9D, 0x626DB154,
+   0xE1627D40, 0xC42604FB, 0xEAC089F1, 0xEB13461C,
+   //T[8]
+   0xCC049786, 0xC761C1FE, 0x5E98C12D, 0x48F9C187,
+   0xFD208DFB, 0x00D1A0A5, 0xA0642197, 0x418D68DE,
+   0x51B50759, 0x481EEF55, 0xC16CAAD0, 0x17429C50,
+   0x2EF8D320, 0x43563962, 0xA5BA6DD4, 0x5D7B26F6,
+   //T[9]
+   0x27A43281, 0xF9FAED09, 0x4103ECBC, 0x5E52C414,
+   0xA815C857, 0xC342967A, 0x1C6A220A, 0x0781B829,
+   0xEAC55F80, 0x5A8343CE, 0xE54A05E3, 0x88F80EEE,
+   0x12916434, 0x97B2A14F, 0xF0151593, 0x690CDE8D,
+   //T[10]
+   0xE38E3820, 0xC52C00CA, 0xDD561BEC, 0x82D789A6,
+   0x74647EBE, 0x54A0FE52, 0xA7B5D4FB, 0x57F62EEC,
+   0x48F81460, 0xAA60759D, 0xEC356DCE, 0x0D300594,
+   0xEFEA8F48, 0x60E9C067, 0x89BFE2AD, 0x5E5FF8BF,
+   //T[11]
+   0xFA3289D5, 0x5920D7B0, 0x28994439, 0x54D5DAD9,
+   0x27CAA747, 0x27035D26, 0x88E9843C, 0x91C821D4,
+   0x9AA8A566, 0xE130DEAD, 0x0408EBAD, 0x7B7DF6EA,
+   0x34938DAC, 0x919ADC37, 0x8F879F44, 0xDB7AECC7,
+   //T[12]
+   0xC6FAE6D7, 0xBC499EE7, 0x7E1C792E, 0xEDDF9C6C,
+   0x5BF70C35, 0xC9C6F541, 0x90422D81, 0x06F0AFDB,
+   0x4DBC747A, 0x214F0AD0, 0xAF7AE617, 0x41A7CF1A,
+   0xDDE64646, 0x7BAB8955, 0x3F9804C4, 0x77F9E8F7,
+   //T[13]
+   0xC96900D8, 0x5D01A765, 0x5E4EC965, 0xF0698FF7,
+   0xBCDF6567, 0x92052D44, 0xD6536C02, 0xBC07BB82,
+   0x83762C71, 0x5FE58CCF, 0xC2E7BA73, 0x635F210E,
+   0xC7B19A1E, 0xA17BF29F, 0x1D90902A, 0xEB165F9C,
+   //T[14]
+   0xF2159928, 0xAF972B45, 0x4760C41E, 0xD86848C8,
+   0x6B47957B, 0x269843F1, 0x2086A46C, 0xE018AAA2,
+   0x99698420, 0x21A03322, 0x4FED7BB9, 0xD36D88B3,
+   0xBA0DBC83, 0xF2FE8863, 0x7F10EE50, 0x383F4DB0,
+   //T[15]
+   0xD789BD85, 0x57C84FC9, 0xC297EAC3, 0xFC35FF7D,
+   0x88C6766E, 0xFB982FD5, 0xEEDB5E67, 0x447D739B,
+   0x72E25B32, 0x0C7E33C9, 0xA7FAE500, 0x3D349B95,
+   0x3A4AAFF7, 0xE12E9D95, 0x834131EE, 0x2D4825AB,
+   //T[16]
+   0x2A1D367F, 0x13949C93, 0x1A0A11B7, 0xEF7FBD2B,
+   0xB91DFC60, 0xDDC6068B, 0x8A9C72FF, 0xEF951932,
+   0x7376D8A8, 0x196035A7, 0x95CA1740, 0x23183B08,
+   0x022C219C, 0xC1EE9807, 0x7DBB2C9B, 0x611E9FC3,
+   //T[17]
+   0x0AF44892, 0x9DDA03E1, 0xFFA77F1E, 0xDD78A219,
+   0x8AEE6CBA, 0x67AA472A, 0xA822A856, 0xE42C3142,
+   0xF20DB957, 0xBEE346FE, 0xD00F7365, 0xBD464186,
+   0x032C4F8E, 0x21774E51, 0xC011817A, 0x8AD034D0,
+   //T[18]
+   0xD94B1A05, 0x1F969276, 0xADF9E430, 0xCA9B1154,
+   0x4B3CF7FB, 0x8930DE36, 0xB9A7112B, 0x4EE298BB,
+   0xCABA1C4A, 0xC7551F59, 0xFB972962, 0x79A86B84,
+   0xB38A628C, 0xE47C8AC6, 0x463A6A4C, 0x2CBBF338,
+   //T[19]
+   0x0B57F4BC, 0xCAE2B192, 0xC6C9BC36, 0x2936DF5E,
+   0xE11238BF, 0x7DEA6482, 0x7B51F5D8, 0x55066379,
+   0x348A964C, 0x44FFE216, 0xDBDEFBE1, 0x9FB3D576,
+   0x8D9D50E5, 0x0AFA4001, 0x8AECB851, 0x15716484,
+   //T[20]
+   0xFC5CDE01, 0xE48ECAFF, 0x0D715F26, 0x7CCD84E7,
+   0xF43E4391, 0xA2E8F483, 0xB21141EA, 0xEB5D7745,
+   0x731A3479, 0xCAC917E2, 0x2844B645, 0x85F22CFE,
+   0x58006CEE, 0x0990E6A1, 0xDBECC17B, 0xEAFD72EB,
+   //T[21]
+   0xA7DDE09F, 0x9F95A5AB, 0x221AA522, 0xC1E70873,
+   0x724A8B0A, 0x3774353A, 0xF0FE9DFE, 0xB942B33F,
+   0x34FC7653, 0xE9601AC3, 0xC2BEAA26, 0xAE3E0880,
+   0x4FAB6AE5, 0xD6C52E03, 0xA61E51EF, 0x0B909273,
+   //T[22]
+   0x1A780592, 0x91BA25B5, 0x1500D337, 0xEE59A574,
+   0x9288E474, 0xE36F1C44, 0xD85F6D65, 0xD3E89ACC,
+   0xD8871D87, 0x0F5590EC, 0x92E2F47A, 0x565C81CA,
+   0x841FB007, 0x55942307, 0xA5DC1163, 0xA4F12B40,
+   //T[23]
+   0x471BD072, 0x298AD9C1, 0xF6D4B375, 0xB286A3B3,
+   0xDA5F8ABD, 0xB6CBD28C, 0x700BA968, 0x529DC0B0,
+   0xAA8C414A, 0x44672963, 0xBC3089DA, 0x99685E9C,
+   0x1E39FCE6, 0x9AB4C983, 0xC49BC6A7, 0x9B5426C7,
+   //T[24]
+   0xAB0C3E88, 0x1FE36FFC, 0xBA8303D2, 0xC2B3B386,
+   0xADC757CA, 0x72AABF6E, 0x5EEC7013, 0x1240B6FD,
+   0x1A9310A3, 0x106308A8, 0x2C136832, 0xB9F4AB88,
+   0xF43CC68F, 0x48A48000, 0x214B70D9, 0xE54F16A7,
+   //T[25]
+   0x0FEE06C8, 0xD9D5E5C8, 0x41D13F39, 0x8BF29817,
+   0xFDAA2B5F, 0x7F25BF81, 0x5EC68BBF, 0x0A70F85C,
+   0xD5E4D954, 0xF2CFC922, 0x83421B3D, 0x5D404051,
+   0x20A2E32F, 0x383E025C, 0x848EF239, 0x63228D59,
+   //T[26]
+   0x52FFCEF3, 0xBAF7D307, 0x9EEC8A3E, 0x46B57E18,
+   0xF7EA3BDB, 0x77A91D71, 0x2BC76AF7, 0x771F4575,
+   0xFCE5C8B5, 0xD918B424, 0x53DF5F8F, 0xEF6A2851,
+   0x2615A6D0, 0xC375B434, 0x42161A6E, 0x32E41149,
+   //T[27]
+   0x5543F33F, 0xFA268BC1, 0x79A1E862, 0x057848F6,
+   0xE778C5D5, 0x2ACC9E80, 0x1F24FB5C, 0x81CF6721,
+   0x0F94BCE2, 0x87656E35, 0x9851BB7E, 0x9650C9C8,
+   0x92E85C53, 0x0D41954D, 0x45B0A71A, 0xEF55045A,
+   //T[28]
+   0x9EF0F09E, 0xEA5D651D, 0xCAD74DC7, 0x2FE6A994,
+   0x8003A37E, 0xA6C44B75, 0x8579357A, 0xDB525471,
+   0x2ED0F0B1, 0x8732A3E3, 0xB0BB5647, 0xBE207A55,
+   0x32D4ECEB, 0x4335FDE2, 0x72C4AD3E, 0x91B67E63,
+   //T[29]
+   0xAB018C7E, 0xCDEDCB0D, 0xAD8CEE06, 0xF29E7E82,
+   0xC417B614, 0x7CE355B7, 0xF8BFF7EB, 0xCD20145A,
+   0xE5457EB3, 0xAEC6A202, 0x75459F98, 0xEF934B95,
+   0xC00F55DE, 0x10475DF1, 0xCB510C09, 0xD4619F15,
+   //T[30]
+   0x152B9A0E, 0x7FF55FC4, 0x8473875D, 0x3F68C71C,
+   0x57862556, 0xE52B3F50, 0x97B14C6E, 0xE3DDB10A,
+   0x68DBA9F2, 0x36758574, 0xD269DE87, 0xD1D4F5DD,
+   0x41C3DEF2, 0x57392917, 0x72836177, 0xD3B0F1BF,
+   //T[31]
+   0xF7F82F2A, 0xAEE9C75D, 0x4AFDF43A, 0x9E4C3587,
+   0x37371326, 0xF5622DF4, 0x6EC73617, 0x8A535F56,
+   0x223094B7, 0xC5F9A0AC, 0x4C8C7669, 0xCDE53386,
+   0x085A92BF, 0x37E02819, 0x68B08BD7, 0x0455C084,
+   //T[32]
+   0x374E4457, 0x9BF49908, 0x5EECB703, 0x40BF984B,
+   0x68F1F6F1, 0x9B6F997E, 0x9D565A0C, 0x47B54B04,
+   0x69900111, 0x241301C3, 0x776F48BB, 0x4E2A6EA3,
+   0x0FEB1CC1, 0x77368E75, 0x15A4A7DF, 0xE7AFEA29,
+   //T[33]
+   0x9477B5D9, 0x0C0A6E2C, 0x876DC444, 0xF9A4BF62,
+   0xB6CDC279, 0x5050A949, 0xB77F8276, 0x06BADA7A,
+   0xEA48DAC9, 0xC8B4AED1, 0x7EA1070F, 0xDEBD8A4B,
+   0x1366EB70, 0x427D4910, 0x0E6CB18A, 0x5B476DFD,
+   //T[34]
+   0xD961D446, 0x03220FB8, 0x0626C5D7, 0x176324E4,
+   0x722425CC, 0xD43B2EBC, 0x86DBC8F8, 0x29D6274E,
+   0xC08D73DB, 0x58185A44, 0xE1239EA5, 0x9C8C1CBF,
+   0xBAC64731, 0x2B1CFE87, 0xA5816948, 0x6C16B472,
+   //T[35]
+   0x23A81FFB, 0xE2753CB1, 0xB82A9F20, 0x22278FA5,
+   0xF09C4BE2, 0x4B032745, 0x059FFD23, 0x5F68C836,
+   0x1DBF8F8D, 0xBF3AE369, 0xF9FB8D66, 0xB2B1552C,
+   0x34925367, 0x0C84BFB3, 0x9E109AF7, 0x0639E57E,
+   //T[36]
+   0xC60C4684, 0xD8218845, 0x0859A19E, 0x66A66447,
+   0x3ED6DFCA, 0x9E18931E, 0x6FEA0609, 0x3B5B03E6,
+   0xA9D7EDBB, 0xD8BC19B5, 0x64477877, 0x95FFD112,
+   0xF35C8263, 0x2CD1CA07, 0x38E14DDC, 0x76F1E0C8,
+   //T[37]
+   0x611D1A41, 0xA3D21037, 0x4B11663F, 0x62B730A1,
+   0xEDF0F22E, 0x9EBD9FA2, 0xCB79EA5A, 0x2C1A2336,
+   0xAC53B363, 0x294B5675, 0x729CB7FE, 0x2C2988BE,
+   0xB587C2E9, 0x146454FF, 0x1DFC32E7, 0x2E1C4770,
+   //T[38]
+   0x67429E4D, 0x8722658C, 0x0561F51E, 0xBE9522AA,
+   0xD9D59F46, 0x3D622057, 0x89EF69A2, 0x76E96B46,
+   0xB797FAED, 0x16AA0650, 0x15FF8993, 0x75B78E22,
+   0x27F9FB88, 0x1575C0CB, 0xF705E319, 0xCF218959,
+   //T[39]
+   0x278C340A, 0x7C5C3E44, 0x12D66F3B, 0x4D546068,
+   0xAE23C5D8, 0x29A751B1, 0x8A2EC908, 0x3E29864E,
+   0x26DBB850, 0x142D2A66, 0x765BD780, 0xAD1744C4,
+   0xE322D1ED, 0x1F150E68, 0x3DC31E7E, 0x239B90EA,
+   //T[40]
+   0x87617F0E, 0xCF15DC9C, 0x6858D44B, 0x85B40DEE,
+   0x121421DE, 0xA96C9E4B, 0x05D45C5A, 0x191EB33A,
+   0x199CF43B, 0xC9C16E10, 0x28EE6E02, 0xF245C57B,
+   0x45E9654F, 0xF3EB80DD, 0x592282A1, 0x8A9365FF,
+   //T[41]
+   0x7A53322A, 0x78C41652, 0x09776F8E, 0x305DDE67,
+   0xF8862ED4, 0xDBCAB759, 0x49F72FF7, 0x820F4DD9,
+   0x2B5DEBD4, 0x6CC544A6, 0x7B4E8CC4, 0x75BE5D93,
+   0x215C14D3, 0x1B481B1B, 0x783A05EC, 0x140406EC,
+   //T[42]
+   0x7E0E3190, 0x44F65F50, 0xEA3F501A, 0x1370D12F,
+   0x8C6615B0, 0xB8635F9A, 0xB3CD1C0F, 0xFF29DC0F,
+   0x738114F6, 0x07F8A15D, 0xEECC62E3, 0x14DEF0AB,
+   0x09B8E6B6, 0x24DD6595, 0x3439A422, 0xC43831F3,
+   //T[43]
+   0x93501899, 0x42293CDF, 0x1CC1E2E5, 0xE7F0390C,
+   0xCBF28253, 0xE1EF732A, 0x1F2B6B79, 0xE21F15F3,
+   0xD622619A, 0xCFC0F97C, 0x726B5A08, 0xC056B494,
+   0x4D24EE97, 0x38C94CB1, 0xBC052D44, 0x4A3FC23C,
+   //T[44]
+   0x60D54267, 0xA30935F7, 0x652F6CD5, 0x5C5093BA,
+   0x0B854DA9, 0x8720D196, 0x2C10D86C, 0xF361D706,
+   0x723B99E4, 0xD11A3D27, 0x2F7D40C8, 0x8A18CE4B,
+   0xC3D3516D, 0x44BDB2FA, 0x6B183CFB, 0x2C990DBB,
+   //T[45]
+   0x96480CA6, 0xED303F4C, 0xCE200B86, 0xE2DBE559,
+   0x4CEB95A3, 0x87704E32, 0x21CD1C8D, 0x5991DAA2,
+   0x75C04EE0, 0x20A4BDAD, 0xD3AB3659, 0x9FE5ED7D,
+   0x1DD427E8, 0x0EFB4BEA, 0x8CE1431A, 0xDE5D5896,
+   //T[46]
+   0xA52342B3, 0xAF31D989, 0xC03EB194, 0x918E1FB4,
+   0x6B6CB7B9, 0x303E35F0, 0xE062A8C2, 0x33FEF524,
+   0x512E5BC0, 0x692A4FBE, 0xF5162C74, 0x067CFB0D,
+   0x20859BD2, 0x519AD6FF, 0xD84DBD4E, 0x0A5B4CAA,
+   //T[47]
+   0xFBB7F12D, 0x4193640B, 0xDFD6C3F3, 0xEF8BF285,
+   0x010729AC, 0x23FE7442, 0x2C214CD9, 0xFF25F55A,
+   0xF30F0FC8, 0xD77BF411, 0x2AB82B74, 0x1A08EBC7,
+   0x74A58D77, 0x00C15BA7, 0x8A405100, 0x94F114D3,
+   //T[48]
+   0xD0A62B2C, 0x1FD07AB7, 0x9F776819, 0x31C6F056,
+   0x8EDC0D13, 0xE0443B93, 0x63AE46A6, 0x1B9D594E,
+   0xC14453E5, 0x5AB358FC, 0x9A58AB51, 0xFB52863B,
+   0x01683CEF, 0x473AB211, 0xED96C8E1, 0xED16BA54,
+   //T[49]
+   0x29BA369A, 0x2641769D, 0xCD922263, 0xE498612F,
+   0x1898EAD9, 0x861B8E4C, 0x95BAF610, 0xC3948BD4,
+   0x3FF24345, 0xB529A79B, 0xBE0A3DA8, 0xA2B8624A,
+   0x94743717, 0x2F5B7F80, 0x218A7B61, 0xBE92ADA7,
+   //T[50]
+   0xFD943A71, 0xEF977470, 0xEF2D93E1, 0x2DBFBC52,
+   0x62B812A7, 0xFBE20B47, 0x3EF44B43, 0xA1547557,
+   0x89BC18D0, 0xF18068CB, 0xB7E40A72, 0xD0702163,
+   0x92EFAF4F, 0xB5115AD4, 0x8C4B8A43, 0x384D5627,
+   //T[51]
+   0xC0B0755E, 0x80D58211, 0xB4CACF23, 0xCA274A6D,
+   0xECF21B69, 0xAE21F1B4, 0x03B2B318, 0x8D84F419,
+   0x9F10418F, 0xC518F894, 0xD91762A0, 0xC73B5FDF,
+   0xEC26C110, 0xC98ECBF6, 0x6953FD62, 0x15BCD7D0,
+   //T[52]
+   0x061457FE, 0xC877DB08, 0xC6471595, 0x60EB5C88,
+   0x808EC0ED, 0x03CE1E41, 0xE27F462A, 0x4A014325,
+   0xA4FBA4FC, 0x7961A1CD, 0x662743C7, 0x206D4BEB,
+   0x41CDA791, 0x47F12714, 0x2F381BB9, 0xB069F7E0,
+   //T[53]
+   0xCB87DEA8, 0x6E6F4859, 0x39546374, 0x4787EC66,
+   0x6121B977, 0x1CBF27B3, 0x44E182AB, 0xCA7EE915,
+   0x7F985B5B, 0x40BD566D, 0x6D5FDB9A, 0x4225339A,
+   0x2FC8C2A3, 0x4CD02584, 0x70F14A3D, 0x0D4C0016,
+   //T[54]
+   0x9B6D8676, 0x9A89A4CC, 0xAD3055B9, 0xCBE46247,
+   0x6B4F6A92, 0x8A8C8B10, 0x570E8F0F, 0xD96633A7,
+   0xE8B04CC1, 0xD1FDA6E8, 0x40BA4A72, 0x215D4CE6,
+   0xF64C3358, 0xD7533270, 0x9825B9FD, 0x4D144DEA,
+   //T[55]
+   0x66FDC380, 0xA3BAAF1D, 0x4CD0C836, 0x1B08F73D,
+   0x9D67FF49, 0x563F9FBA, 0x5AF864EC, 0x1577ACA8,
+   0x0C0B7B43, 0xE61A8C7E, 0xA8E5EC0A, 0xCDBE96B5,
+   0x8E1D9252, 0xE3061205, 0x138E5EF8, 0x78286CC9,
+   //T[56]
+   0x253BCBF0, 0x0F8364C4, 0x03BB9180, 0xF26390C7,
+   0xAD1E3BB3, 0x4EBCCDA4, 0x85A5D1EB, 0xB08C91A3,
+   0xB643475C, 0x60DC9158, 0x2BA0101B, 0x39BD97D6,
+   0xC502FBE0, 0x6FD29D96, 0x3158A73C, 0xB8FE20C1,
+   //T[57]
+   0xE0106368, 0xFC0DDF3B, 0x93F52B68, 0xD3C72BA5,
+   0xA8787924, 0x7C6BDF85, 0x532189D3, 0x9645C64A,
+   0x824E2771, 0x58D3CC9B, 0x6E82DC91, 0x9B7E75E1,
+   0xE0ED1CC0, 0xBF4EC9F6, 0x3260F488, 0xFFB683E6,
+   //T[58]
+   0xA4F0C81B, 0x8821C701, 0x881D4342, 0xEAA11D49,
+   0x79A87EEF, 0x346FAB79, 0x39848086, 0xA9C3643E,
+   0xF6C6E053, 0xE040A053, 0xE1F9D4BA, 0x0D287400,
+   0xBD4AA53C, 0xA48CF15D, 0x11E94CEF, 0x76CDF40C,
+   //T[59]
+   0x7EF30E41, 0x3F023041, 0x4CE753C8, 0x9184493F,
+   0x2A7516CA, 0x5A228849, 0x660402F4, 0x97C0AF3A,
+   0x8A23E934, 0xD0DB8CE7, 0xE707A0B2, 0x4F22360C,
+   0x2032D181, 0xB487DBB9, 0xCB5623FD, 0xC6D1B0F9,
+   //T[60]
+   0x2BC5C755, 0x8746F483, 0x775A0FE2, 0x3DC6F57F,
+   0x0F21C2C9, 0x87BCCBE9, 0xEAE51818, 0xDB93A6B1,
+   0xA87AA88A, 0xF5754A37, 0x73972E83, 0x2791BF54,
+   0xDEAC962D, 0x65FE92B6, 0x5DB3C2A5, 0x7675343A,
+   //T[61]
+   0x1C77336E, 0x5C2CE444, 0xD14B1A55, 0x6FD6234A,
+   0x10C24E9E, 0x1E25C808, 0xD88C3194, 0x7E941CEF,
+   0xE4B9453F, 0xBFA7A9BA, 0xDB055169, 0x6256B1BF,
+   0xD4956F06, 0x835E6CD4, 0x2948048D, 0x7D3BCF9D,
+   //T[62]
+   0x18064104, 0x82480753, 0x0891878C, 0xF3C2F9C4,
+   0x29AF296D, 0x1D6CBEF1, 0x55B9ED41, 0xA57DDAA3,
+   0x903A1CDF, 0x4F47C7F1, 0x197DB90D, 0x45057FCF,
+   0xCA13FA12, 0xC125BB25, 0xD7F746DF, 0x5BCFD6F3,
+   //T[63]
+   0x313728BE, 0x6CF20FFB, 0xA3C6B94A, 0x96439591,
+   0x44315FC5, 0x2736FF83, 0xA7849276, 0xA6D39677,
+   0xC357F5F4, 0xF2BAB833, 0x2284059B, 0x824A920C,
+   0x2D27ECDF, 0x66B8BABD, 0x9B0B8816, 0x674F8474,
+   //T[64]
+   0x677C8A3E, 0x2DF48C04, 0x0203A56B, 0x74E02F08,
+   0xB8C7FEDB, 0x31855F7D, 0x72C9DDAD, 0x4E769E76,
+   0xB824BBB0, 0xA4C36165, 0x3B9122A5, 0xFB9AE16F,
+   0x06947281, 0x1EC00572, 0xDE830663, 0x42B99082,
+   //T[65]
+   0xBB162B85, 0x40B11C79, 0x5A890653, 0x426E2F71,
+   0x7586E3C3, 0xE9E180A6, 0x65DBB34A, 0x507B542A,
+   0xE489B8AD, 0x225F912A, 0x301369C1, 0x33520333,
+   0xD338ECDE, 0xCA383CE7, 0xD11A51D6, 0x5EB5701E,
+   //T[66]
+   0xFBCBC0C3, 0x490E66BC, 0x15065B98, 0xE8D7B164,
+   0x3E1A841C, 0xF2F80E3E, 0x7696FCF5, 0x62D4A49F,
+   0xF521F731, 0x86EDDEE7, 0x77305B14, 0x90337684,
+   0xF36FA83E, 0x56193ECB, 0xD347D332, 0xD18B33EB,
+   //T[67]
+   0xDDA868B9, 0x6EF95150, 0x9C0CE131, 0xD1F89E79,
+   0x08A1C478, 0x7FDC1CA0, 0x1C6CE04D, 0x78878EF6,
+   0x1FE0D976, 0x9C62B912, 0xBDE08D4F, 0x6ACE570E,
+   0x12309DEF, 0xDE53142C, 0x7B72C321, 0xB6CB3F5D,
+   //T[68]
+   0xC31A3573, 0x7F991ED2, 0xD54FB496, 0x5B82DD5B,
+   0x812FFCAE, 0x595C5220, 0x716B1287, 0x0C88BC4D,
+   0x5F48ACA8, 0x3A57BF63, 0xDF2564F3, 0x7C8181F4,
+   0x9C04E6AA, 0x18D1B5B3, 0xF3901DC6, 0xDD5DDEA3,
+   //T[69]
+   0xFB696D7B, 0x8B030FEA, 0x400CFA69, 0x9D11BDCA,
+   0x8FA8A597, 0x3BCFB88D, 0xFF476EF0, 0xAA59E783,
+   0x88F5A016, 0xFBAD3413, 0x5C0ABA02, 0x2A4147FA,
+   0xD831450E, 0xDA2C96D0, 0x30E77DD1, 0x30A12AAD,
+   //T[70]
+   0x30076ED0, 0xDFA412E5, 0xECE43EFE, 0x90E7EFC3,
+   0xE9C9C2A2, 0x7D021B57, 0xB498993D, 0xE3DDF1B7,
+   0x846B4D7E, 0x5B955C48, 0xAE7C855E, 0x959131AD,
+   0x77227A7B, 0x8490E467, 0xA60CE85F, 0x283833A8,
+   //T[71]
+   0x2FB3062C, 0xFB5A3D22, 0xB65437EC, 0x5682157E,
+   0x76FD0872, 0x7657711B, 0x4AD70BCC, 0xCE6D933A,
+   0xFC3E65C1, 0xA9CEBBA1, 0xD4111C9D, 0x0FDA9930,
+   0x9A834DD3, 0xD1EDB57B, 0x5D2C8BB7, 0xA8839960,
+   //T[72]
+   0x8C4150CC, 0x88BC6C8D, 0xAD6C3923, 0x73758B21,
+   0x29928820, 0xD43A7503, 0x95EA9FEB, 0x790ECF86,
+   0x1BFB5292, 0x59A580F7, 0x9F51DE15, 0x0F7A900F,
+   0x9D6239F6, 0xF444C49A, 0xD87DECF6, 0xE340D641,
+   //T[73]
+   0x1026B033, 0x1EBB28AC, 0x3A50D3AC, 0xFF199A09,
+   0xE869A58E, 0xA2C053E4, 0x414DD6BE, 0xB05E35AA,
+   0x6754449F, 0xFBCB4C4A, 0xF8427D60, 0xC25C0899,
+   0xC5AE69DE, 0xD7E45688, 0x6646039A, 0x47270F9C,
+   //T[74]
+   0xE872889A, 0x0DFAB50A, 0x703913A8, 0xFAB939D7,
+   0x16B20242, 0x4EBC7144, 0xD2F8BAE8, 0x22BC5020,
+   0x9D713946, 0xABEAAAE6, 0x3EF21012, 0x3C2CD39E,
+   0xAEF98A9B, 0xAC67692C, 0x78E64C2E, 0x616222E4,
+   //T[75]
+   0xB6A8A95D, 0xFFCDCC28, 0xF068C865, 0x61948CC6,
+   0x48A3FBB6, 0x02790B8C, 0x93239BC6, 0xFAA43BED,
+   0x77A8FE3D, 0x97747046, 0x3E4708BD, 0x5F83CA7A,
+   0x43482E7D, 0x1388E9E2, 0x026921CA, 0xD21A75F1,
+   //T[76]
+   0xA15BBAE6, 0x7549F1B1, 0x8BA6BBCF, 0xA9C4EBBC,
+   0x3AB26D77, 0xF3DEB351, 0x7F94BBB6, 0xFD3BCF2D,
+   0x46FE3DDC, 0xFA8344D7, 0xD2F4FDAB, 0xBAD3E545,
+   0xF8DE5D37, 0xBA4CCB8E, 0xD97112DB, 0xADA514FE,
+   //T[77]
+   0x8BCF4DBF, 0x017FA5E2, 0x80217643, 0xABCAEADA,
+   0x4BBF5A9F, 0xEFB61274, 0x5144598E, 0xF28DC88B,
+   0xB384A585, 0x2FD4905E, 0x73DF56D7, 0x30987256,
+   0x671DD081, 0xE1913CA6, 0x8249B59B, 0x1A242940,
+   //T[78]
+   0x1F70723F, 0xDA398393, 0xB21AC825, 0x6CFE750A,
+   0xF4EB6E64, 0x92C6A768, 0x47C9E925, 0x4290DB0B,
+   0x413464C5, 0xF9D2FB88, 0xC8971F1A, 0x64AA8AD3,
+   0xF2EBCD3C, 0x263BEAD1, 0x3374C163, 0xB5D01E33,
+   //T[79]
+   0x3E72AD0C, 0xE96A79FB, 0x42BA792F, 0x43A0A28C,
+   0x083E49F3, 0xEFE0A423, 0x6B317466, 0x68F344AF,
+   0x3FB24D4A, 0xCDFE17DB, 0x71F5C626, 0x668BFC22,
+   0x24D67FF3, 0x604ED93C, 0xF8540A20, 0x31B9C405,
+   //T[80]
+   0xA2582E7F, 0xD36B4789, 0x4EC39C28, 0x0D1A1014,
+   0xEDBAD7A0, 0x663C62C3, 0x6F461DB9, 0x4052BF4B,
+   0x188D25EB, 0x235A27C3, 0x99BFCC5B, 0xE724F339,
+   0x71D70CC8, 0x862BE6BD, 0x90B0FC61, 0xFECF4D51,
+   //T[81]
+   0x15A27295, 0x63FEC45F, 0x74D2B111, 0xA41A773E,
+   0x12DDE90D, 0x9341BC09, 0xAA83C35C, 0x5583DAFA,
+   0x05F406F4, 0xBC93AE0B, 0xC427F2EC, 0xCF73A836,
+   0x2C6E92A6, 0x0AF26BE5, 0x49B67CD6, 0xE096722B,
+   //T[82]
+   0x00AEF6E0, 0xF4B1AD53, 0x92448EC8, 0x51D353E9,
+   0x4F5F7050, 0xBDA23624, 0x5172DDF2, 0x38641E4C,
+   0x0DAFE306, 0xD076B5AE, 0x042F9B7F, 0xBAF02E13,
+   0x7BB9888D, 0xEFB76553, 0xEEE3A756, 0x28AC3017,
+   //T[83]
+   0xA1D4CFAC, 0x74346C10, 0x8526A7A4, 0xAFDF5CC0,
+   0xF62BFF7A, 0x123202A8, 0xC802E41A, 0x1EDDBAE2,
+   0xD603F844, 0x8FA0AF2D, 0x4C701917, 0x36E06B7E,
+   0x73DB33A0, 0x0C45F452, 0x560EBCFC, 0x43104D86,
+   //T[84]
+   0x0D1D78E5, 0x9615B511, 0x25C4744B, 0x66B0DE32,
+   0x6AAF363A, 0x0A4A46FB, 0x84F7A21C, 0xB48E26B4,
+   0x21A01B2D, 0x06EBB0F6, 0x8B7B0F98, 0xC004E404,
+   0xFED6F668, 0x64131BCD, 0x4D4D3DAB, 0xFAC01540,
+   //T[85]
+   0x72600E54, 0xFF8D09C0, 0x10203D11, 0x1960EDAF,
+   0x377756FC, 0x429DD48F, 0x884D880E, 0x4FA4A1EA,
+   0x8D24AD69, 0x7FA9EAF1, 0xAE16E60F, 0x4B9A578C,
+   0x35364B6A, 0x7E8849F3, 0x426F03FE, 0x3A6681DB,
+   //T[86]
+   0x8FA9F0A4, 0x62427D34, 0xA7621AA3, 0xEF92AAC0,
+   0x6BC20D7F, 0x9A3BFB57, 0x57ADD1CF, 0xE00F53AF,
+   0x9A8E182B, 0xAA091420, 0x65870ACD, 0x6DBADF70,
+   0x9E7FA3D9, 0x1873E2CB, 0xAE5822E9, 0x15B8C5B7,
+   //T[87]
+   0x593D097F, 0x6B53BF21, 0x84D5959A, 0xBF667BEA,
+   0xEEB4BEAC, 0xD1609F4F, 0xCAC8251D, 0x69A5B074,
+   0x5318ECB3, 0x612D6531, 0xD420D3E0, 0x66A6AEBC,
+   0x685D7231, 0x6840955E, 0x1DAA4128, 0x454F241C,
+   //T[88]
+   0xA5D67E8A, 0x8D3E6D40, 0xA18B743B, 0xE139639F,
+   0x948E7DC2, 0x63749EA0, 0x526BDE8F, 0xABD4C85F,
+   0x2D812DFE, 0x731DA794, 0x67ED8673, 0x9A9C0DDD,
+   0xA83F2506, 0x63FEBA54, 0xF64A622E, 0x475BAED2,
+   //T[89]
+   0xB40AAB96, 0x1AA70AD1, 0xF911EC64, 0xF7ACCAED,
+   0x70FA959C, 0x637899CE, 0x109A2589, 0xE9BC4FE4,
+   0x1BF979E4, 0x7BCCE0D0, 0xBB65D9BE, 0x2941C273,
+   0xBAE3365E, 0x4997CC24, 0x8B08213E, 0x20EFCFBB,
+   //T[90]
+   0xBDD6FA57, 0xDDE6C1B0, 0x6877584C, 0x64DA38DC,
+   0x88A2EA3B, 0x5EFD04D6, 0x8DE94787, 0x5E12F389,
+   0x4C229E61, 0x822DC6F3, 0x32C58CE1, 0x0220A965,
+   0x12104D90, 0xBFF58F54, 0x6F430C30, 0xCC9C71A8,
+   //T[91]
+   0x146A91DD, 0x69A3F7AF, 0x77603291, 0x66FB0376,
+   0x34331450, 0xF8BA5650, 0x5D12FC47, 0x4D88F26E,
+   0xDE1D8482, 0x52E87A6F, 0xD84F6DC4, 0x71FC3D27,
+   0x1C1BFC10, 0x80660EB4, 0x39AD0A51, 0x2F4241DD,
+   //T[92]
+   0x5DA65E89, 0xCEA18FED, 0xB6030005, 0x89D02E3A,
+   0x16B45EAB, 0x593303DB, 0x40B36824, 0xF5D40404,
+   0xB6E6CA16, 0x8E62C398, 0xA0F8DB73, 0xB6680F4A,
+   0x3735F704, 0xE2CB53AB, 0x005E4955, 0x90EAF4B0,
+   //T[93]
+   0xD030702A, 0x4EA9BF09, 0xCE4824BB, 0xE8E44EA4,
+   0x821E5B58, 0x0AAA6A0A, 0x117DA962, 0x2090FA8E,
+   0x80902901, 0x1B68C306, 0x0B4E7472, 0xAF0A7E97,
+   0x0393F96B, 0xEBB4408C, 0xEC32F258, 0x984BD632,
+   //T[94]
+   0x1159F10E, 0x807D9AF8, 0xB42511BC, 0xE05EFF00,
+   0x61B05022, 0x2EE9F026, 0x29FB81A6, 0x3D45853A,
+   0xF75BC3A9, 0xA6B9C16E, 0x515A90E0, 0x82111A06,
+   0xEDFC125E, 0x87211449, 0xA80A8311, 0x4E4DE334,
+   //T[95]
+   0x637D797D, 0x270A098D, 0xFF736545, 0x60FF39ED,
+   0x9D6B4A9B, 0xEB3DF8BF, 0x0E6155FA, 0x0AC9835F,
+   0x640BC0E9, 0x50C04B69, 0x3FE89B08, 0xFA24F733,
+   0x5C6872B2, 0xD8AC7B19, 0x3D00D534, 0xD6882B26,
+   //T[96]
+   0x0236A83D, 0xE0052323, 0xCD9A2912, 0x1FB825A3,
+   0x3F92D724, 0x69479CBC, 0x38EC3DDD, 0x389EFF26,
+   0x1EB367C1, 0xE9FFEA6C, 0x91F3A0DE, 0x113A50C5,
+   0xB7B0AF9E, 0xCFD0310C, 0x31EA1AC9, 0x5E1B21C9,
+   //T[97]
+   0x48ACEFF5, 0xDA6E2F06, 0xEA0DFE34, 0x78DDC159,
+   0x14DB328C, 0xB5F5FB47, 0xE6F3BA6A, 0x9419ACF5,
+   0xC66C1B27, 0xB19CD157, 0xF91BDB7B, 0x473BE3D3,
+   0xEE3174A1, 0x08A1F515, 0x1B427E86, 0x565A9071,
+   //T[98]
+   0x863DEF2F, 0x71DB5C74, 0x86DB595A, 0x46FC6CC6,
+   0xB0578F7C, 0x41A41F2A, 0x00C9BC26, 0x3AF24209,
+   0xB3C9AB1A, 0x134233FD, 0xB6070F59, 0x7870F3A9,
+   0xDF2AF343, 0x39B1F3B2, 0x4AB472AB, 0x6013DA0E,
+   //T[99]
+   0xF319CA96, 0xA4AB1856, 0xF8F15FAC, 0xFAD93FE2,
+   0xA833145E, 0x9A143FF7, 0xF19E3798, 0xB7F41BBE,
+   0x88FBA40D, 0xE71B2D47, 0xFD3B7782, 0xFBE87B9F,
+   0xDEF04692, 0x51BED9BE, 0x0A92FE70, 0x9D86B0CC,
+   //T[100]
+   0x901D3434, 0xE4269DBE, 0xFE90A0F6, 0x93B1C84F,
+   0xC4383C70, 0x9E0AB0CF, 0x9EF8F7F3, 0x94A875B9,
+   0x7BD07E21, 0x7C54E527, 0x24C1F8A1, 0x4426E751,
+   0xA59E4156, 0x88D04FF3, 0x2E3F9185, 0xCA552076,
+   //T[101]
+   0x3F32BEF2, 0xC6C3BAAE, 0xCCBF8EB6, 0x130EE8F7,
+   0x8E7E89C3, 0x09EC2B46, 0xBC2625F9, 0x3FBFBD74,
+   0xB27173D1, 0x88502A08, 0x3CF0D529, 0xBB3271FF,
+   0xEB6FC065, 0x1409DF32, 0x75196790, 0x21531773,
+   //T[102]
+   0x0DA1427C, 0x93EB1D71, 0x410E3F28, 0xB5F1A270,
+   0xA9325717, 0x7E9D484B, 0x576B2B28, 0xF883C4AB,
+   0x15B0CC94, 0x8471E075, 0x560FAB54, 0xAEE70132,
+   0xDD9DEC7A, 0xB461EFE8, 0x488AB1D0, 0x6086F208,
+   //T[103]
+   0xD41345EB, 0x8A9B3774, 0x4320BEC3, 0xE42D2EA2,
+   0xD72435FF, 0xEBB176E7, 0xCA2C0E18, 0x3841166E,
+   0xD372BE35, 0x9C27A301, 0xE329D0DF, 0x7518195C,
+   0xCA99FE01, 0x203C98CB, 0x89F4CED9, 0x84D9C1A6,
+   //T[104]
+   0xB789034E, 0xA7F47395, 0xE3ACD77C, 0x5378515C,
+   0xA20BCD3F, 0x29D692E0, 0x59E44B71, 0xBFD07180,
+   0x6733F199, 0x92CD3E15, 0x99F9141A, 0x43428C81,
+   0x07E9C6E8, 0x47E891EC, 0x75DEAF04, 0x47103963,
+   //T[105]
+   0x07888C81, 0xE2403426, 0x87490006, 0x03547365,
+   0x1FCA7F34, 0x48369A11, 0x6E2F531D, 0x383707D0,
+   0x9F7D10DC, 0xDC6A8214, 0xC9D5EF32, 0xCA0B8578,
+   0xCDB6F94D, 0x8A4A5B65, 0x9B236F7A, 0x287FF192,
+   //T[106]
+   0x48C1555E, 0x886878CA, 0xAF70DB2D, 0x5FB1FBC9,
+   0xB15FDA95, 0xDFFFF48F, 0x8FB2FA61, 0xFD98525D,
+   0x57F0C9A8, 0x9A481E75, 0x27069783, 0x9BAB3B2A,
+   0xA223C95E, 0x9569DFFB, 0x0F6B2D61, 0x93840D78,
+   //T[107]
+   0x23BAEB04, 0xEAAAA5D8, 0x3A4708FA, 0xB7ADCA0C,
+   0x17B23442, 0x1394CBDC, 0x1D926D0F, 0xB241AA94,
+   0x1DE2521D, 0xDA7549F5, 0xE4B48A02, 0xEE7534C9,
+   0x46BA6568, 0x1DDE0DEE, 0x21B920E4, 0x85AA7EED,
+   //T[108]
+   0xBAF91228, 0x348857EA, 0x4ECB2AF2, 0x892D0A81,
+   0x91E8B82B, 0x06136E7F, 0x495431AD, 0x0869EC0D,
+   0x2E051CDF, 0x54FA49C4, 0x823C9B51, 0xCB47ADCA,
+   0x265EB81A, 0x70A00076, 0x9B7675A0, 0x5572895C,
+   //T[109]
+   0x96C14E8F, 0x9D1ADF60, 0x2C06A25A, 0x06597793,
+   0x58D5A91A, 0xB2DCBD1F, 0xDE733F89, 0x1283033B,
+   0x9BBD6A2D, 0xB4020E0E, 0x7D383846, 0xE8B07157,
+   0xA635C7BE, 0x84AF4665, 0x34DD7D5F, 0x549C0EAA,
+   //T[110]
+   0xE86E02AB, 0xF29FB08F, 0x0D5C06CA, 0xA8266DC1,
+   0x2F48F49F, 0x25D5E27D, 0xE6F31BB3, 0xA2EBF469,
+   0x0382A8EB, 0x86AE97D9, 0x363F04F7, 0xCB92F44B,
+   0x002D76F6, 0x391B9654, 0x4432235D, 0x27BEBD8C,
+   //T[111]
+   0x3765581E, 0x7B3068D0, 0x1DC2D82E, 0x561D30F5,
+   0xB1F23D69, 0x8A404541, 0x1B4084CE, 0x6A25FB20,
+   0x60206329, 0x50180E1B, 0x5CF443D5, 0x1E15941A,
+   0xD06A4007, 0xF5763393, 0x19CFB424, 0x5A0AEBFC,
+   //T[112]
+   0xE529A049, 0xA2D545DA, 0xC73A541A, 0xA581A768,
+   0xE0950A67, 0xAFE88B1E, 0x52B8FCCA, 0x62778F74,
+   0x0B8483FC, 0x44BB1BFA, 0x6E882C24, 0x5D727F5A,
+   0x553A776C, 0x4E4CBE60, 0x1AE91088, 0xE155B2F8,
+   //T[113]
+   0x1B207A93, 0x5D84A3A3, 0xB71B2F04, 0xFBAE3D63,
+   0x6013B8BA, 0xAA9CEBC1, 0xD1C608D1, 0xFC9AA3CF,
+   0xCF8CD72D, 0x1E3F596C, 0xDA16B20C, 0x26152558,
+   0x85AC096C, 0x6DB0B1CD, 0x2BB637DA, 0x34AB0E43,
+   //T[114]
+   0x12C953E4, 0xA9F4F5C1, 0x2A6A470A, 0xFE518080,
+   0x0B17775B, 0x5455FBCB, 0xC1752BB7, 0x4F117894,
+   0x544A3BE7, 0x5B5E49DE, 0x22C3EC1C, 0x0DDE356F,
+   0x01DA56C9, 0xE26AE66A, 0x35FFD9DC, 0xAB3B6155,
+   //T[115]
+   0xC94F4326, 0x21AD037B, 0x01F60A81, 0xDD3C9AAD,
+   0xA3106421, 0x4F11EE65, 0xADBACC80, 0x4751FE00,
+   0xD3C2917E, 0xE4683589, 0x71D43F65, 0xFA8BD144,
+   0x11A422F6, 0x200697F3, 0x1FA0772B, 0xE83D7D4F,
+   //T[116]
+   0x59B21469, 0xCA907BFF, 0xC44627DE, 0xECFDA9FD,
+   0x5AF99278, 0x8B32C8BB, 0x51C0A6FC, 0x2298506C,
+   0x9D7BFC5F, 0x2227244E, 0xBC8DCDBC, 0xD903A0C9,
+   0xA5809F67, 0x8916ACEC, 0x4C45BBD7, 0xFEF3434A,
+   //T[117]
+   0xC5332D4D, 0x12749619, 0x076108B7, 0x78346549,
+   0x52F84FDE, 0x44F0646E, 0x9B855F0E, 0xACA1B2FA,
+   0xBB5ACC3E, 0x9F40EDD1, 0x5CB0077A, 0x341DD551,
+   0x7731C386, 0x4162BF6F, 0x7D37F6E4, 0x30FC315C,
+   //T[118]
+   0xBE224934, 0x07C6577E, 0x133B52F5, 0x0BD79C64,
+   0x26EA9A30, 0x6D440B9B, 0x8AF95AF2, 0xDC9823E4,
+   0x951A08EB, 0xF3DCB38A, 0xCD6F6B4F, 0xCAEDC3A2,
+   0x55572EFD, 0xB648EFDB, 0x043C56DD, 0xB2656A22,
+   //T[119]
+   0x7CAB3106, 0x24C2E7A2, 0x45DDCBCC, 0xE70143A5,
+   0xE23C4D47, 0x121738AA, 0xC9729043, 0xD3559359,
+   0x5F6E4215, 0xD0ABCEDD, 0xD8C94522, 0xF09EF638,
+   0xFBF9AB22, 0x7BDDE51F, 0x95EDB586, 0x7AA22698,
+   //T[120]
+   0x530E8727, 0xC7E05F58, 0x88A132F3, 0xD41592D9,
+   0x4835F583, 0x7CB9B486, 0x8F603959, 0x0D5CABA2,
+   0x7D850A76, 0xB97C361D, 0x0751FEDF, 0x75D0638A,
+   0xEB862FBE, 0xAD213D44, 0x597D997B, 0xCB814263,
+   //T[121]
+   0x85FBA82B, 0x5E2A21F5, 0xEE80D718, 0xE2B23452,
+   0x8F8D3AD4, 0x61CD936D, 0xAEA80A6B, 0x537E0FAA,
+   0x65C03360, 0xE8A1913B, 0xE9A48461, 0xAD915586,
+   0xC9E7C92D, 0x197C7BE0, 0x0476E6DB, 0x98FF32E1,
+   //T[122]
+   0xF8D734CA, 0x56131598, 0x32AB6115, 0xA90C803B,
+   0x294F6172, 0xF20B6904, 0x29BB4956, 0x9C4C8C6B,
+   0xA3443E3C, 0x72523CBC, 0x1AAF4A8F, 0x403FC2D5,
+   0xF99A6339, 0x264BCAA0, 0x6437CEC7, 0xF837CA9F,
+   //T[123]
+   0x15685448, 0x3BB78084, 0x1186BDE2, 0x0FC3A28F,
+   0xCF4EEBDF, 0xD41F0CFA, 0xAE3A0DDC, 0x8384F799,
+   0x10B4F451, 0xF4EE653F, 0x833D3476, 0xC2F5D30F,
+   0x38E0E1CE, 0x6C3BCEB3, 0xAA489E30, 0x76570D52,
+   //T[124]
+   0xA38218CF, 0xB7AEAB38, 0xA9E0D3C4, 0x2B07AEB1,
+   0x47A4C94D, 0xF0D16BE2, 0x91FD763C, 0x5AF88695,
+   0x2A9DA273, 0x053AB914, 0x61EBE016, 0x10D130AB,
+   0xD34E284A, 0x5099B9C8, 0x6ED4DE65, 0xB21A4103,
+   //T[125]
+   0xF8E85A02, 0x940F3648, 0x555E9CA4, 0x014FF0A9,
+   0x2EBFF5CE, 0x656E0598, 0x7CD3977C, 0x7104DED9,
+   0x6385DFE7, 0x9A4C0512, 0x0830E76D, 0x0627BE3C,
+   0xB14A50BF, 0xF8C14705, 0x8C3FAA7E, 0x3B4A1D7F,
+   //T[126]
+   0xE6A868A0, 0x84B1E14B, 0x47BC1E4F, 0x7B98A2BB,
+   0xCC803733, 0x0E6DF4E4, 0x7958E14D, 0xB751A536,
+   0x5B9871B7, 0xF925771B, 0xE16ED05E, 0xEFFA615A,
+   0xC695DDD6, 0x3141411A, 0x61468D10, 0x91EB562A,
+   //T[127]
+   0xE895DF07, 0x6A703F10, 0x01876BD8, 0xFD75F3FA,
+   0x0CE08FFE, 0xEB5B06E7, 0x2783DFEE, 0x68F6B854,
+   0x78712655, 0x90C76F8A, 0xF310BF7F, 0xCF5293D2,
+   0xFDA45028, 0xFBC8044D, 0x92E40CE6, 0xCBE1FEBA,
+   //T[128]
+   0xC0C1CE9F, 0xFD4C1473, 0x7EDA11D3, 0x27F187B9,
+   0xD9845057, 0x024CD871, 0xA174D4D3, 0xCF6B116F,
+   0xD279352F, 0xD300B23F, 0x23F12526, 0x364BC658,
+   0x2AB7B709, 0xC7908819, 0xB6BFC532, 0xC2DE1FA1,
+   //T[129]
+   0x4396E4C1, 0xE998CEEA, 0x6ACEA274, 0xFC82EF0B,
+   0x2250E927, 0x230F729F, 0x2F420109, 0xD0B2F94D,
+   0xB38D4966, 0x4305ADDD, 0x624C3B45, 0x10B838F8,
+   0x58954E7A, 0x7DB26366, 0x8B0719E5, 0x97145982,
+   //T[130]
+   0xD93F535C, 0x64549B3D, 0xA76E5BF3, 0x93978B4D,
+   0x5A01C10E, 0xE2B1F3EE, 0xA9D19EA8, 0x76F210AF,
+   0xC4264D57, 0xF04ACA7A, 0x483487BA, 0x9F989031,
+   0xE6280F91, 0x84132D01, 0xB3A040CF, 0xF34B31CE,
+   //T[131]
+   0xEEE8CB7E, 0x75CEC1FF, 0xF8735FB1, 0x566BF7FA,
+   0x5975D2FD, 0xC360C19A, 0xF075EC6C, 0x93B3CE8D,
+   0x815D65CE, 0x718B6E47, 0xD1C39345, 0x17EC17C1,
+   0x6DAC86B0, 0x4A1D862F, 0xE6DFAB8E, 0x268C55B1,
+   //T[132]
+   0xCFFCAF2D, 0xB535FD34, 0xA23B8B1B, 0x9C8838DF,
+   0xE178F644, 0xB2FB47FD, 0xF5D8BE2C, 0x201173F5,
+   0x9968EEEE, 0x485E1C8D, 0xF856B514, 0x165D69EA,
+   0x756B5779, 0x17B6206C, 0xAFE2AE9A, 0x8DAC7611,
+   //T[133]
+   0xDBDF389D, 0x0C55F223, 0x61EDA89E, 0x76030246,
+   0xA1150650, 0x18975AE2, 0xC911375C, 0x77AAEBAB,
+   0x2FE056E6, 0xEDAE9AD1, 0x2DDE44E4, 0x8AA8F740,
+   0xE2873522, 0x9D288103, 0xFB60CD48, 0xF34AACA7,
+   //T[134]
+   0x08BDF594, 0xBC7BCC73, 0xA9178A0B, 0x8FEC77F2,
+   0x949EDFB7, 0x7BB27826, 0xF137D62F, 0x77B0D0C5,
+   0x88F8A9EA, 0x5ADD7B4B, 0x966CDA49, 0x133EDFBD,
+   0xEAB66F18, 0x0189CA26, 0x55F452B1, 0x40C07B47,
+   //T[135]
+   0x23369FC9, 0x4BD6B726, 0x53D0B876, 0x57F2929E,
+   0xF2340687, 0xC2D5CBA4, 0x4A866ABA, 0x96161000,
+   0x2E407A5E, 0x49997BCD, 0x92DDCB24, 0x69AB197D,
+   0x8FE5131C, 0x2CF1F243, 0xCEE75E44, 0x7ACB9FAD,
+   //T[136]
+   0xB34983B1, 0xFB5F7E26, 0xD3FBB145, 0x7E38E207,
+   0xAF71ED7F, 0xF608EE91, 0x686E5AEA, 0x6D78F612,
+   0x607E751E, 0x2F9D2E63, 0x2748BA3B, 0x8607CB37,
+   0xF4FE56A9, 0x006F6D32, 0x6D242B89, 0x2980BD5A,
+   //T[137]
+   0x23D2D4C0, 0x254E8394, 0x7AEA685B, 0xF57F0C91,
+   0x6F75AAEA, 0xA60D880F, 0xA333BF5B, 0x24EB9ACC,
+   0x1CDA5DEA, 0xE3DE4CCB, 0xC51A6B4F, 0xFEEF9341,
+   0x8BAC4C4D, 0x743125F8, 0xACD079CC, 0x69F891C5,
+   //T[138]
+   0x3DBA87E7, 0x6384AB74, 0xB78A63AC, 0xE8F20516,
+   0x03FA5C24, 0xC6D198DE, 0xB50C2893, 0x7AFB3D4F,
+   0x3A4CF320, 0xE4D418B9, 0x4FAA9ACC, 0xAAC22A0E,
+   0x552C1F31, 0x08A7CC67, 0xD6668BEB, 0x36009A3A,
+   //T[139]
+   0xB34D794F, 0x09A16E3B, 0x4E743813, 0x8C3F4A31,
+   0x651C9834, 0xE8A7B747, 0xD2C76536, 0x4667EBB9,
+   0xB8A887AB, 0x1F6884FA, 0xA08DF843, 0xD021BC8D,
+   0x55F59432, 0xFC2D4609, 0x38D06677, 0x2D5C1AC7,
+   //T[140]
+   0xFAECB3E4, 0x1D348841, 0x0406E1CE, 0xE2E6D3B5,
+   0x87679B85, 0x504B9726, 0x78812B43, 0x25279D03,
+   0x56676779, 0x7E329009, 0xB002BCF5, 0xF0184A5B,
+   0xD630DA82, 0x49E88336, 0xF08564A7, 0x92D01B0B,
+   //T[141]
+   0x36CFA9E8, 0x9460F46A, 0x84A462F7, 0x6800B8A8,
+   0xC06A6673, 0x9F5D99A2, 0xB101B4F6, 0x1AB172C7,
+   0x5321C59C, 0xF699C703, 0xED13BC1F, 0x0B9ACA14,
+   0xDFAA5EAA, 0x91C6EEBB, 0x4F346816, 0x885AE502,
+   //T[142]
+   0xC9757170, 0xDBDEB29D, 0xCBF1B409, 0x55B5A898,
+   0xA4C0CBD2, 0x01B3DFD4, 0xD97E4324, 0x38611618,
+   0x57BEE79E, 0xF3EA3774, 0xBC20E2C6, 0x60941F4E,
+   0x53C47B89, 0x21D8F508, 0xB8F41362, 0x7E7D03D3,
+   //T[143]
+   0xF202481A, 0xCC38452E, 0xABC96FED, 0x50D19D86,
+   0xC62CD055, 0x83FB2D63, 0x7B81568E, 0xBD6058B0,
+   0x70737BB6, 0x628271F1, 0x83F257D4, 0xC51419ED,
+   0x09EF7DD9, 0x9EE514E4, 0xF8467E37, 0xF78E1FBE,
+   //T[144]
+   0x339FE5CE, 0x045EF431, 0xD24C26D1, 0xEF414A60,
+   0x661F3BBE, 0xC4151215, 0xA31D0A51, 0xCA270C0B,
+   0x89D02271, 0x0BDDC41D, 0x55B9AE92, 0x5DA2412A,
+   0x1B6552CC, 0xE2A468E2, 0x29CBEEE5, 0x0920500E,
+   //T[145]
+   0x92873D50, 0x8272EF36, 0x79CC84D1, 0xE6325D26,
+   0x38675522, 0xD634F48D, 0xE4D5882C, 0x1D96882C,
+   0x5C7604C9, 0x7F0B5356, 0xD43110A3, 0x3C33B393,
+   0x96DE3985, 0x4BCB6430, 0x9F50539E, 0x35C125A1,
+   //T[146]
+   0x8C720A67, 0xBAD5F61F, 0x16BFC3DD, 0x2C3C19BC,
+   0x65D64E56, 0x997D4265, 0x49504379, 0xAB25034F,
+   0x1410392E, 0x1F6297F6, 0x12E86D68, 0xBEF8D14A,
+   0x1DFBD10B, 0xD6405555, 0x0D44FBAA, 0x53CAD2BD,
+   //T[147]
+   0x0D25CA56, 0x60D14D0E, 0xBCF946FF, 0x31CCE9A5,
+   0xBEF23766, 0x7F2E2C69, 0x0D8E4B51, 0x4E3C677A,
+   0x6BB0D0CE, 0xA7C52ECA, 0xD0391CA8, 0x1A2389C8,
+   0x7E8B1D46, 0x41165173, 0xA70684B1, 0x71094B90,
+   //T[148]
+   0x66554187, 0x76F6C646, 0xD3BAC858, 0xDE2A1E0E,
+   0xCA976E8B, 0xA81F6685, 0xF60C851C, 0x48A9D631,
+   0x336936E6, 0x95A81B38, 0xF7934CBD, 0x588C234F,
+   0x68DB8031, 0x5603885C, 0x5C1A48C7, 0x9C777837,
+   //T[149]
+   0x8709B816, 0xFC9C7AFB, 0xD4AB7632, 0xF0190802,
+   0x4C80BD1E, 0x609275B0, 0x3680A202, 0x791851E2,
+   0x5899EF09, 0x0B4FD3FB, 0xACB207B3, 0x53B13F9C,
+   0x7C507F60, 0x3C993D16, 0x8D9E3B7C, 0xF1EF5083,
+   //T[150]
+   0x0AD2FE5C, 0xF426FE06, 0x9022C4CB, 0xB8746069,
+   0x403EFCE0, 0xA1F27672, 0x53E2CC9A, 0xC34B4A30,
+   0xD0E57D9F, 0x7E49B3AB, 0x13463806, 0x9906218B,
+   0x8BFF74A6, 0x91A140B9, 0xE37C6EA3, 0x52DE5611,
+   //T[151]
+   0xE28B1B92, 0xAD1E58C9, 0x77A11D29, 0xBFC3EAD0,
+   0xBA1DE923, 0x9F5D367A, 0xAFB30E89, 0xC1EE712F,
+   0x75876AC6, 0x04886F34, 0x54B5C1C3, 0xB1D36D27,
+   0x18CBA903, 0xB36B5FD0, 0x696A7139, 0x9B4A54BC,
+   //T[152]
+   0x519E0427, 0xDB84065D, 0xB863AF57, 0xD69DDA22,
+   0x6AD4BC18, 0x71BB07B4, 0xC29564F8, 0x41CDAD11,
+   0x503CC09B, 0x7272B74C, 0x46BA501D, 0x72E4D2B6,
+   0x5033CCA7, 0xF477717D, 0xF3DF9D57, 0xFEEEC42C,
+   //T[153]
+   0x57186AC4, 0x435B40EE, 0x97B24F3D, 0xA16130EA,
+   0x453C442E, 0xF2B8C361, 0x647E46E4, 0x532DE1CF,
+   0x64CCD9EF, 0xFAF3C94F, 0x182EB339, 0x4E7192EC,
+   0xF2DFEA04, 0x45CBEDA8, 0x539889DC, 0xCB652C2D,
+   //T[154]
+   0xD34C847E, 0x8E6576BB, 0xD5DE9A09, 0xCCAEB5EE,
+   0xBF91842D, 0x604CA87D, 0x7DE9E9ED, 0x363B9C74,
+   0x84919F51, 0x20E28AF4, 0x7279A592, 0x8EA65E9C,
+   0xADEC5331, 0x1DF4B333, 0x0B1573DF, 0x1B42A7C7,
+   //T[155]
+   0x55EF6C3C, 0xE9EE350D, 0x058A3BA9, 0xF84A8CAD,
+   0xE079D281, 0x5316A4FB, 0x11A280E5, 0xC9BF6F15,
+   0x860E512E, 0x77414A7A, 0xD9430464, 0xB5722BCF,
+   0xFCD817BA, 0x631D68D7, 0x20F282F6, 0xCB8DE2D9,
+   //T[156]
+   0x86AF53CA, 0xE3CC6151, 0x609C485F, 0x3CBBE8D7,
+   0x2024DE09, 0xED635088, 0x3ED70F65, 0x3B9B4F1C,
+   0x4E292129, 0x9C0B92E3, 0x137DF53D, 0x4ADD5ADC,
+   0xECDB4D15, 0x74BAD233, 0x1A3D8634, 0x90610274,
+   //T[157]
+   0x2374F412, 0x12022915, 0x162247D9, 0xC1C05129,
+   0x04B21320, 0x4A49989B, 0xCB478149, 0xDA65930F,
+   0x69FB4789, 0xED96215F, 0xAD7FCCB6, 0x3CFCE1CF,
+   0x00687BBD, 0xE454254F, 0xB30413B9, 0x5D96FDDD,
+   //T[158]
+   0x5DEE2192, 0x20F89C80, 0x5CFB0642, 0x6919A925,
+   0xE8E3E133, 0x94A30525, 0x68585ED2, 0x66209C61,
+   0x6DE12C85, 0x0C904364, 0xF0248824, 0xDAC80D74,
+   0xF320F71F, 0x7B7FA943, 0xD5882C26, 0x0A244A2A,
+   //T[159]
+   0x702476B5, 0xEEE44B35, 0xE45C2258, 0x7ED031A0,
+   0xBD6F8514, 0xB422D1E7, 0x5972A107, 0xE51F547C,
+   0xC9CF343D, 0xA25BCD6F, 0x097C184E, 0x8CA922EE,
+   0xA9FE9A06, 0xA62F98B3, 0x25BB1387, 0x1C309A2B,
+   //T[160]
+   0xC6EE75B0, 0xA352A845, 0x4AFAFBAB, 0x0D667013,
+   0x824A9C3F, 0xF2C9F8CC, 0x6671EA61, 0x1123CED9,
+   0xC4C0426B, 0xE2064C2B, 0x5DDA8F0C, 0xAE8A4AC7,
+   0x8B03F8D0, 0x4789D01E, 0x2FD8BEC7, 0x6D8A6838,
+   //T[161]
+   0x1967C459, 0x9295DBEB, 0x3472C98E, 0xB0014883,
+   0x08011828, 0xC5049777, 0xA2C4E503, 0x20B87B8A,
+   0xE057C277, 0x3063175D, 0x8FE582DD, 0x1BD53933,
+   0x5F69A044, 0x0D11ADEF, 0x919776BE, 0xF5C6FA49,
+   //T[162]
+   0xE418DAAD, 0x27326510, 0x625C8DDA, 0x31C73944,
+   0x43030723, 0x32B46D0D, 0xCFD15D0C, 0x39A10292,
+   0x99961DEA, 0x1EF74176, 0x175F71EE, 0xA0BA92F0,
+   0x08F50113, 0x33F788B2, 0x71A8271D, 0xFB83754A,
+   //T[163]
+   0x16898779, 0x60FFEE0C, 0xF624C894, 0x07F24F18,
+   0x0ADC727D, 0xA3B4C6E6, 0x68229401, 0xBE61FBAE,
+   0x634FE770, 0xE7C012BF, 0xBC5336ED, 0x1B4108E0,
+   0x34E57C7E, 0x68A1116B, 0xCD615837, 0x39012BA1,
+   //T[164]
+   0xBD26C6AE, 0x2C8CA159, 0xCCCFC5A6, 0x843D7F20,
+   0x81FBACAD, 0x03349CE1, 0x656B250F, 0xEB34EF6F,
+   0x0C299BCE, 0x66E79036, 0x4FF14D30, 0xF50639F6,
+   0x1E49DD7A, 0x9B887542, 0xF0B88704, 0xA64BFF59,
+   //T[165]
+   0xB7F335BB, 0x00A5A2C3, 0x48AF3A1A, 0x0DFAF15D,
+   0xAAE1AE3A, 0x3C0A7831, 0x8CDCA788, 0x4832590D,
+   0xECF2985C, 0x9937352D, 0x18129BFB, 0x069199D7,
+   0xD9875FCC, 0xD747E700, 0xBFEC3698, 0x0707E099,
+   //T[166]
+   0x03541F94, 0xB1A8E69A, 0x3DFED107, 0xCE50F2C0,
+   0xEDD8D48C, 0xE235CB04, 0xD14FF204, 0x06DE6B81,
+   0xC4600A5E, 0x5CA05CA3, 0xDD87634B, 0x00AA7AA4,
+   0x4817FB86, 0xC00F85A4, 0xC3977369, 0xDAD5C91C,
+   //T[167]
+   0x0FD59E11, 0x8C944E76, 0x102FAD5F, 0x3876CBA1,
+   0xD83FAA56, 0xA454C3FA, 0x332010B9, 0x1ED7D1B9,
+   0x0024B889, 0xA1011A27, 0xAC0CD344, 0x05E4D0DC,
+   0xEB6A2A24, 0x52B520F0, 0x3217257A, 0x3A2B03F0,
+   //T[168]
+   0xB315365B, 0x0B25C598, 0xA33802F1, 0x4F9FBBF4,
+   0xDF1000B7, 0xF17BBAF7, 0x92ED176A, 0xD7F06111,
+   0xE9AED821, 0xE6D03F9E, 0xC3C2C608, 0x6479A7FB,
+   0x833FE7D0, 0x4D4AD114, 0x5DC730B9, 0x0633F165,
+   //T[169]
+   0xDF1D043D, 0xF20FC2AF, 0xB58D5A62, 0xF330240D,
+   0xA0058C3B, 0xFC7D229C, 0xC78DD9F6, 0x15FEE545,
+   0x5BC98CDA, 0x501E8288, 0xD046AC04, 0x41EF80E5,
+   0x461210FB, 0x557D9F49, 0xB8753F81, 0x4AB5B6B2,
+   //T[170]
+   0x8618EDF1, 0x9CDA05E2, 0xDBF91167, 0xD9BBBDF1,
+   0x5B3F7F24, 0x210E5999, 0x3290E994, 0x5556C6A3,
+   0xFD9D9264, 0xDFA4617F, 0xA4034316, 0x35F67E2C,
+   0xA6F5D2C1, 0xE732B3C2, 0xB6D666F1, 0x6384A08E,
+   //T[171]
+   0x2DC58892, 0xB2D37DA4, 0x03BDEB8D, 0xED936A9C,
+   0x1F8ED30F, 0x13CA866A, 0xE07DE033, 0xCEEDB9C0,
+   0x3E5135B4, 0x88F742D4, 0x0EC7D64C, 0xF329DAA7,
+   0x9A484A31, 0x0D463E11, 0x70CDDDCF, 0x978E9348,
+   //T[172]
+   0x8939CA0B, 0xC5D60AB4, 0x9378F406, 0x95ADEBE4,
+   0x9718F642, 0x097B65A7, 0x8EA4A221, 0x93CB902B,
+   0x7B6D5FDB, 0xF072428C, 0xE51424D6, 0x7C4E4DBB,
+   0x2DB584DF, 0xEEEA7C18, 0xE8141B67, 0xD3B0DC0A,
+   //T[173]
+   0x8E33832B, 0xC42BB0BD, 0x82B2725C, 0x3B6D0EF3,
+   0x8CFC624B, 0x85918AF4, 0x8EE47C9B, 0xDF895BD3,
+   0xC15185F0, 0x8BB5D0BB, 0x585C96B0, 0x819D351A,
+   0x154BE8DD, 0x6A83828D, 0xC36963D6, 0x299C4DA5,
+   //T[174]
+   0x289149A5, 0xEA4C1463, 0xAC879905, 0xF3FCCCF2,
+   0xE13A9610, 0x2185DC73, 0xF3CF0208, 0xCD651AA7,
+   0x46927D66, 0xA481D874, 0x28198BBA, 0x6A9A3C39,
+   0x3F54042D, 0xFC590FAA, 0xB0EE6067, 0x10DD490F,
+   //T[175]
+   0xAAC4170A, 0x9BAF4D7A, 0x0D75821E, 0x6DA147F0,
+   0x3879D7D8, 0x58E0A73C, 0xA60BCD77, 0x86699898,
+   0x598A46EB, 0xAE7CD4DA, 0x0187F877, 0x428DEDE8,
+   0x2AF12355, 0x32CA235D, 0xA4B075F4, 0xC0D84AEC,
+   //T[176]
+   0xD35D8953, 0x48CED071, 0x7E1EEDBE, 0x867C3459,
+   0x1A074661, 0x36DC5AD7, 0x9E6861CB, 0x939EE1B7,
+   0x5B609C5B, 0x0E5E70EB, 0x28282282, 0xA8796969,
+   0x7BA8BB79, 0xC617BAC6, 0x152DAE15, 0x194A24F2,
+   //T[177]
+   0xDED33571, 0x39F582C5, 0x91F4FB95, 0x2B9A8ED7,
+   0x82A3EF27, 0x0442464E, 0x87B3FAC1, 0xA7E35647,
+   0xA367DEA6, 0x005BAD87, 0x019DA0DD, 0x0F3CDD60,
+   0xA59305FF, 0x306F746A, 0xB2909721, 0x971F1ED8,
+   //T[178]
+   0xB852CDD7, 0x4511C44C, 0x975B995D, 0xEB6BF1DD,
+   0x572ADD8D, 0x2601F683, 0xD054B296, 0x21121447,
+   0x42CF0265, 0xF4F62401, 0xE3A79A2A, 0x6467317B,
+   0xAF927B35, 0xF04ED2D1, 0x6534B5A1, 0x8E96E1CF,
+   //T[179]
+   0xAF4247B2, 0x58ADB933, 0x0537352E, 0x48CEBF9B,
+   0x966FF1FA, 0x8DF30A42, 0xE788E9C4, 0x239E0726,
+   0xD79B48B0, 0x5C6958A2, 0x4E914E8E, 0x22272E55,
+   0x7E106A1F, 0x191CBB75, 0x5F71C539, 0x4F8A6029,
+   //T[180]
+   0xF7158BEA, 0x25B336A3, 0x27774720, 0x2C80A110,
+   0x0A0B4413, 0x14D2F6A4, 0x43D8D04A, 0x13A5BEE3,
+   0xE4A44502, 0x93B68C5F, 0x364957B2, 0x5DA5D14C,
+   0x26D8258C, 0x75168F8A, 0xEB43C098, 0xB455E8A4,
+   //T[181]
+   0xB1EBE50C, 0x640614A3, 0x76ACAA65, 0x3F805476,
+   0x8B4D91FF, 0x69530604, 0x519859D3, 0x903BB9EA,
+   0x9F5FAC7F, 0x93A59E69, 0x390D8900, 0x1DF54929,
+   0x8CE5FA33, 0x823DBA18, 0x2350281B, 0x5574F271,
+   //T[182]
+   0x0309488A, 0xF111B200, 0xED2E78BE, 0x6DBA1852,
+   0xC5F6A056, 0xA848D319, 0x8C4B59C2, 0xF1AE1709,
+   0x881BD57F, 0x757D507B, 0xED484551, 0xD7DB6879,
+   0x8529CC2B, 0x0CE00C9C, 0xEBD18AC3, 0xFB339802,
+   //T[183]
+   0x1FC78E0C, 0x250C5AF3, 0x04F7FDA9, 0x84EEB8E9,
+   0x9FFE80E6, 0xA5A17E06, 0x703285CF, 0xDE96F184,
+   0x3FE41E6F, 0xCCEABB01, 0x8724D28E, 0x2F674547,
+   0xB8BD6D72, 0x7BABF7E2, 0xFCBEF7CB, 0x0D6B8AB0,
+   //T[184]
+   0x19ABCAF5, 0x9BE634CC, 0x02919487, 0xC0EEBAC0,
+   0x3BD130B6, 0x9F1BFEDD, 0x22D625C1, 0x24DAB3A1,
+   0xB4206E3A, 0x46AB327C, 0x555042A3, 0x232D3373,
+   0x0EB9EA81, 0x8DDAE1B5, 0xCB9F9E6D, 0xBE1CF505,
+   //T[185]
+   0xCBCDAFE6, 0xE854E0A5, 0x43534D5A, 0xF1E98103,
+   0x340F393C, 0xA7273058, 0x8CFD2794, 0x7329508C,
+   0x538E99CD, 0xE715886A, 0x651E2938, 0x494D5A8F,
+   0x694B2061, 0xE8E08261, 0xC40BE3CA, 0x0971A6FF,
+   //T[186]
+   0x455D0D81, 0x56643934, 0x73F8FCEF, 0x10C24D59,
+   0xBB38A630, 0xA612C437, 0x92F1445E, 0x4EF9A80E,
+   0x1EE44719, 0xA9A648E2, 0x0D1DC166, 0x2F62FECA,
+   0x97178BA3, 0x69C3D990, 0x9FF67325, 0xEC8A3AD8,
+   //T[187]
+   0x90828F9A, 0x7CE0D6AC, 0x5C9531CE, 0xB2BD1A02,
+   0xBB10AB9D, 0x5C1B4412, 0xAEEE4C0E, 0x387518CD,
+   0x98F368AA, 0x87DE57CE, 0xBB92BE7A, 0x21F57922,
+   0xF1744809, 0x65D54499, 0xD9E3102D, 0x777B407C,
+   //T[188]
+   0xE746EAA6, 0x09D92A8E, 0x5C0B2593, 0xFE861385,
+   0x658B8EAF, 0x2696F3FF, 0x1A3C51E1, 0x896FCF1C,
+   0xFC538F16, 0x8D8E617E, 0x610922E6, 0x1CD3C38F,
+   0xD6EAC1C9, 0x84C50345, 0xA4205D21, 0x61FF42C1,
+   //T[189]
+   0x8230A9A6, 0x7B741B5D, 0x8BF29BB9, 0xF579DEB9,
+   0x98FFD997, 0x39671277, 0xF4FCB1E1, 0x6DE16859,
+   0xEA723B7F, 0xC6B7A38D, 0xF4FB138F, 0x77D3E0F2,
+   0xA150FA04, 0x9B478F3A, 0x69B0BEED, 0x5B961787,
+   //T[190]
+   0x1D842031, 0x66D0EECB, 0xA5AEDBC6, 0xAFA9C66E,
+   0xFAAD16D1, 0x67515B87, 0x15840989, 0xD827C8B4,
+   0xC8A420ED, 0x5E1B7BB1, 0xDC28E5BD, 0x8EA03CAB,
+   0xD45188D7, 0xFC4D874F, 0xC22ECF90, 0x2F661C17,
+   //T[191]
+   0x328FB9EF, 0xDCEAFEB7, 0x311CB1F3, 0x3478E062,
+   0x03E042EA, 0xB7FBE79E, 0x28A8A8FB, 0xFB0249AA,
+   0xB8EE1B8B, 0x50B4BB44, 0x3D152813, 0x0E540E9F,
+   0x09AA13A2, 0x48E514E1, 0x9C5FBC3E, 0x172F4633,
+   //T[192]
+   0xA37CFBFE, 0xDD8D54F8, 0xF8FFB4A9, 0x7B03CDFE,
+   0x24070DF5, 0xCA347052, 0x99BF4616, 0x0B659251,
+   0xEE44254B, 0xCE2E30D8, 0x415BA4F1, 0xA45C28FD,
+   0x5E8366AA, 0xCC31D2BF, 0x59B2F313, 0x8E249AEB,
+   //T[193]
+   0x56F93781, 0x8874151D, 0x22891225, 0x3B208CDA,
+   0x53F5B5AF, 0x9F9F4B01, 0x457C10BC, 0x60AAA403,
+   0x0300CD5E, 0x52A2BDA0, 0xA7436841, 0xE4503BB0,
+   0x7C7158C1, 0xE34045FE, 0x15AC62A9, 0xDCA8E0D7,
+   //T[194]
+   0x9361CF42, 0xA423DC88, 0xCA111DD0, 0x25953391,
+   0x4509733E, 0xCD1BF722, 0x5E552EAE, 0x62A8F8A7,
+   0x4DFB5704, 0xA6A1A79C, 0xA2ABC546, 0x215F2DE4,
+   0x4DCCA7D6, 0xEE3EDE74, 0x493ED75F, 0xBBD935CD,
+   //T[195]
+   0xAD8FBF6A, 0x228B7867, 0x49F109D0, 0x2B4DCCBA,
+   0x6CEA145C, 0x2EDEDDA5, 0x052D7980, 0x33AE4C04,
+   0xDF1203AF, 0x487E1051, 0x30C418F9, 0x343ED3D8,
+   0x0495EA86, 0x715AD94E, 0xE945824B, 0xC78A5AC5,
+   //T[196]
+   0x8C935E5F, 0x3680071A, 0xF58543C1, 0x7D764E91,
+   0xEE52DF5E, 0x4DB687F0, 0xFECF1D1D, 0x7EAD1E20,
+   0x5FE9A684, 0x453CB994, 0xB65BB00A, 0x1CA6C43F,
+   0xD51630D5, 0x99039A8A, 0x97C7D645, 0x0CA741ED,
+   //T[197]
+   0xF45BE76B, 0x614E1441, 0x177D8E3D, 0xA5EF3EC0,
+   0x45E70812, 0xE3662065, 0xA25EBC68, 0x05D525AC,
+   0x916E827A, 0x11C3041B, 0x868BC04C, 0x7D5AB00A,
+   0x1E80EA45, 0x129F80B1, 0x82AB5457, 0x663C8854,
+   //T[198]
+   0xC4268106, 0x0EA0EF30, 0x9827ED70, 0x9037B2F3,
+   0x583F6310, 0xC3DB4E2F, 0x2AB10678, 0x10A3F54B,
+   0x706E16C5, 0x7097DD2B, 0xAF165242, 0xD4770A89,
+   0x370E1411, 0x9514515E, 0x0DA518EF, 0xAD237305,
+   //T[199]
+   0x1C86789A, 0x1F5BA028, 0xA557050D, 0x53C33FAB,
+   0x401788B3, 0x41D49663, 0xA1636F3B, 0x37FBF41E,
+   0x0F7B0609, 0x07763B95, 0xACAA8D51, 0xBF50BC02,
+   0x6E61B1C6, 0xC2A5C173, 0xF46A6605, 0xA9116C70,
+   //T[200]
+   0x336F30C4, 0x5999001A, 0x504B641A, 0x4D8B3C3B,
+   0x31696B82, 0x3A1A5507, 0xE650FE2B, 0x605A5FD0,
+   0x4624AD94, 0xE45BCF34, 0x42FF1BCF, 0x360522E1,
+   0x0583B20B, 0x0EC6913B, 0xA3E4A361, 0x87004DDC,
+   //T[201]
+   0xB029D3D7, 0x94B476BC, 0x8883A492, 0x355100CB,
+   0x82E9A1DB, 0x1C540464, 0xDB0836B1, 0xE35DF7EB,
+   0x6BA5DDB7, 0x2DB5A7F5, 0x72EF8A86, 0x921BC05B,
+   0x8DDCD14F, 0xD697F63E, 0x19352CE1, 0x0646FE17,
+   //T[202]
+   0x18AC6F86, 0x63DFC0B7, 0xD0531DE8, 0xE2FB9537,
+   0xD0136AE3, 0x481EAF13, 0x8E4BD2F7, 0xE01AF14A,
+   0x88F974EC, 0x49EE4F9F, 0x92AEF323, 0xD764A4C6,
+   0x1E03AFA9, 0x443CB43F, 0x736E1021, 0xC0C7BF9E,
+   //T[203]
+   0x9BB57932, 0x72F792D1, 0x0514514C, 0x1BED9845,
+   0x44C50CB7, 0xA4EB06A6, 0x4EFDCEDD, 0x8254B868,
+   0xC9DADADE, 0x47BB74D9, 0xB3D95615, 0x2D48E4EC,
+   0xC15AA29F, 0xADFC9CF1, 0x78462B89, 0x0CBA2046,
+   //T[204]
+   0x479F4BFE, 0x9B0D9ABB, 0x5E3C4768, 0x3E790D21,
+   0x375C643C, 0xA3AD44CD, 0x6AC0DC43, 0x9DFBBB65,
+   0x55C762EC, 0xDA6FFB79, 0xDE78A5E1, 0x12294F31,
+   0x4D704863, 0x0AE22C68, 0x6C18C02E, 0x61114035,
+   //T[205]
+   0xD96DD1ED, 0x2360D888, 0x0A936C6B, 0x1B99CC55,
+   0x8609F93F, 0x4372A3F5, 0x4DC993C4, 0x0AFC214A,
+   0xA6BF396F, 0xBA08D6C7, 0xAF2235E2, 0xA6D44568,
+   0xBDEC43ED, 0xE3E1C378, 0xD9CA7E1D, 0x00B80A92,
+   //T[206]
+   0xC7AB8183, 0x06750A2A, 0x97F4EB7B, 0x042DD3D6,
+   0x3D0EFA7A, 0x4CC4D792, 0xD9793753, 0xFF36E487,
+   0x4E06E132, 0x104DFF63, 0x6D1706FE, 0x9773AE26,
+   0x3FFEBB01, 0x97299181, 0xDFC694FF, 0x59006DC6,
+   //T[207]
+   0xDC0B1061, 0x2FFBCF19, 0x139AD48C, 0x846730AD,
+   0x12CA3C26, 0xCBBD5F20, 0x8855A59A, 0xEBC3D35E,
+   0x5B93E742, 0x18644A97, 0xF8F4BE3A, 0x0DA658F5,
+   0x3FE32589, 0x4B3C3785, 0x61CE3030, 0x5290BEC1,
+   //T[208]
+   0x3DF40F6F, 0xE6FAD49D, 0xCCA526F5, 0x885DD6DF,
+   0x4A1807A1, 0xC0B00E7C, 0x3404D5A1, 0x3FECD70B,
+   0x6782D8D7, 0xE77BFE48, 0x7155EC7D, 0x54AB18C9,
+   0xB3202407, 0x77CDB71F, 0x67BA5604, 0x8441556C,
+   //T[209]
+   0xE9D78DD4, 0x38694E01, 0xB58C2F9B, 0xF84FBBFB,
+   0xA234C73F, 0x3BD303D3, 0xFF16883F, 0x82396BE5,
+   0xE886DF4E, 0x56ECF3FD, 0x817255A6, 0xCAD118BD,
+   0x1AA338DB, 0xBA6926BA, 0xAA1981FF, 0x2A677961,
+   //T[210]
+   0x05F4CC58, 0x75A1590C, 0xA69F58C8, 0x43F076BC,
+   0x79786C3A, 0x8ADA939B, 0x95A50C0A, 0x3A758D61,
+   0xBA2155EF, 0x22348461, 0xEBFE41AD, 0x5985F593,
+   0x91FB5CF7, 0xADFFAD55, 0xE54E241C, 0xB8891ADC,
+   //T[211]
+   0x24FC05CD, 0x18115178, 0x092D97BE, 0x2C73FD44,
+   0x2BEBB106, 0x5B5A8CBA, 0xEE17D82A, 0x017CC283,
+   0x42EE8FDB, 0x19974730, 0x89433E44, 0xF16121E8,
+   0xA2FF19E7, 0x760EAAD5, 0xA1EC8CAA, 0xD71A2864,
+   //T[212]
+   0x7F42A1BF, 0x26F1CAF3, 0x82F27586, 0xCABD266E,
+   0x6AF484F4, 0x0971375B, 0x0A43E6FA, 0xABF356CC,
+   0x91C5E0F8, 0xC7B50396, 0x3A8EFAC5, 0xBAF618FE,
+   0x15A2316F, 0xCB21FE99, 0x0F2635D3, 0x1565CA3B,
+   //T[213]
+   0x79FB664D, 0x01BABF6D, 0xB9659AA1, 0xA14B4AB5,
+   0xB64DAA60, 0x6FE4C1BD, 0x938EDB85, 0xEA4B209D,
+   0x3290B2F4, 0xE322AF73, 0x292AF72E, 0x4BACDED7,
+   0xB1E09D85, 0xF01824E4, 0xCAA001B1, 0x485C0038,
+   //T[214]
+   0x7C092020, 0x954E5FA8, 0x99A7318D, 0x06591EC9,
+   0x6FC3EA5B, 0xC3506151, 0xDA3E40C7, 0xCFB13598,
+   0x826F6EB1, 0xB447CC06, 0xCC4B15BB, 0xB9176BE6,
+   0xC61599EC, 0x0204E321, 0x4E9FCE6B, 0x66512CBD,
+   //T[215]
+   0x6891EA5A, 0xF59CA041, 0x5A12F3C8, 0xAC0D2CC0,
+   0xEFADECB4, 0x2F827232, 0xC3A86505, 0x743A048F,
+   0xF9AA9765, 0xD0154838, 0x11FEDB76, 0xA548E7EC,
+   0x61E77C87, 0x10A67ED6, 0x5E165BE4, 0xA4394D9E,
+   //T[216]
+   0x012DDF9F, 0x2798852B, 0xBF4FCB96, 0xD5539BE9,
+   0xB08C6B69, 0x198A79B9, 0xA37060D9, 0xE23BD3CB,
+   0x68A6A401, 0xCC7F52C9, 0x57091704, 0xDF697F4B,
+   0x7514ABBE, 0xC429B0B8, 0x3212CA5B, 0x9DFD8B3F,
+   //T[217]
+   0x84A74D26, 0x4C82A438, 0xDC49FEEE, 0x94FC7759,
+   0x73AF33A7, 0xA604D0CA, 0x99993F69, 0xA2028CC5,
+   0x733D26C8, 0x06D21477, 0x3704942E, 0x97EA2867,
+   0xF123FE2D, 0x26FD5FB5, 0x62C4C70E, 0x19D166CC,
+   //T[218]
+   0xABBFE286, 0x4AF25CE1, 0xFCDEED1A, 0xA53341C7,
+   0xCD20E76D, 0xCB1D3464, 0x4AB23D35, 0x56DECF3E,
+   0xE524AAFB, 0xDD832027, 0x05A43863, 0xEE102BE5,
+   0xD463F935, 0xF9A6BFFA, 0x44F43B95, 0xC49EAE38,
+   //T[219]
+   0x8B894F9B, 0x59E60BD8, 0xB510A245, 0x77C0A893,
+   0xAC45E9F3, 0xF6133DED, 0x7E0A7BBA, 0x7F88FC4E,
+   0x751BB0FD, 0x8C615DAA, 0x5623E6E8, 0x64BA7615,
+   0x4BD8DEAC, 0xF6BF0161, 0x3997B513, 0x68C635F0,
+   //T[220]
+   0xE7753698, 0x8D15F49D, 0x166245DD, 0xB1D6F20C,
+   0x92EEA7B3, 0x998AC40B, 0x0C3C0922, 0xE5C81E0B,
+   0x85A9E76A, 0xF65CA633, 0x88A56ACD, 0x2779B4B3,
+   0xEEFB0C07, 0x405BA189, 0xA7D62D55, 0x6591E281,
+   //T[221]
+   0x6BD408B4, 0x48C896D1, 0x9C6BAF95, 0x47CE08A1,
+   0xA887EEBC, 0x4F4DDCE9, 0xAE7398D9, 0x0447F868,
+   0x9CBAA537, 0xB70895FE, 0xE15EFF33, 0xDC935601,
+   0xA2A7C433, 0x035C1D08, 0xF0FB4CAC, 0x5F37CCEF,
+   //T[222]
+   0xA47C229B, 0xF5A4AA87, 0x1136EE1B, 0x19DC19B9,
+   0x51E08C26, 0x1D5DED4C, 0x4F85D804, 0x41AB4614,
+   0x738106CA, 0xF02DD1D4, 0x2AB68AFF, 0x20CC8FF4,
+   0x3C3CE367, 0xC1C053E7, 0x33F9E08D, 0x48517644,
+   //T[223]
+   0xB7F6BE1F, 0x1E3081AB, 0x0D8A6FB0, 0xD7768C94,
+   0x31905283, 0x70E00C75, 0xAE64D738, 0xA176C395,
+   0x1FA3578C, 0x9E5850BC, 0x611FE506, 0x087565CE,
+   0x9FEEEA5C, 0x51AB984B, 0x947B45F1, 0x9EBDEC88,
+   //T[224]
+   0xB792FBEC, 0x587C5DA0, 0xEE9E8ACB, 0x5986356B,
+   0x24E55C73, 0xFAA63B4D, 0x4C985649, 0xCEFB8440,
+   0x540926DF, 0x1C20FE34, 0x79C38DE9, 0x6204487E,
+   0x5881270E, 0x7B5348A9, 0x0767A863, 0xA40C8BAF,
+   //T[225]
+   0xDC53717D, 0x4F0EC8F0, 0xEBB3B85E, 0x42FC6006,
+   0x067977FF, 0x95F962D2, 0xD50AE583, 0x6194BDD5,
+   0x2C4FA8AA, 0x76C2178C, 0x3ABF1768, 0x35277D4F,
+   0xE5E8D851, 0x4A22DB58, 0xBF903362, 0xAF64998D,
+   //T[226]
+   0x7FBEF628, 0xC3C2B412, 0x0008ABB4, 0xA69C7756,
+   0xDD3A1376, 0x3F52438E, 0x7688A086, 0x3A6F4C49,
+   0x126F5476, 0x8DCA1641, 0x5E790B59, 0x7DE645CE,
+   0x45125197, 0x5B51A327, 0xF79973FB, 0x796ABA23,
+   //T[227]
+   0xB78A0575, 0x06129252, 0x031E9F63, 0x6CB9019D,
+   0x01F22992, 0x03928544, 0x6ECA6194, 0xDA7FA95F,
+   0x6346268C, 0x5ABF16BB, 0x8EC5DCA6, 0xAC24E560,
+   0xBC92BC35, 0x72889D45, 0xBBD19859, 0x2C2EFEDB,
+   //T[228]
+   0xD347FECA, 0x89EB1B96, 0xCDA31E4A, 0xC8C78F4F,
+   0x9B5EBEE5, 0x9948CC8C, 0x6F69B457, 0x56952543,
+   0xDAA7367A, 0x6A3B3EF7, 0x3EAE86CD, 0x2BECF2D4,
+   0x8A9BCB17, 0x663509A6, 0xBBBBC36E, 0xC670543E,
+   //T[229]
+   0x28BC89E8, 0x7B292496, 0x376DE4AD, 0xB1AC125E,
+   0xF591522E, 0x4736603B, 0x7C775B6B, 0x9C2C6267,
+   0x8E2A143B, 0xCA91DE65, 0xDC7AB49B, 0x2A626E93,
+   0xE7FBC78F, 0x86320365, 0x6DF16F90, 0x9DDCADC5,
+   //T[230]
+   0x9099B9C9, 0x4131BFD0, 0xEB850DDA, 0x3BF11E70,
+   0xB34F5321, 0x422705C3, 0x082E4D79, 0x21BA3C52,
+   0xE427EBE9, 0x76A27C83, 0x5EEB87B8, 0x2E1D8CD4,
+   0x72955119, 0xECFAA6E5, 0x077CBC91, 0xA2D7916C,
+   //T[231]
+   0x3581C6CD, 0x8CBE4D6E, 0xFD43F5EC, 0x5F07093E,
+   0xB1571512, 0x2FFF27F8, 0x976D2D4B, 0x3D5929B3,
+   0x00B64B81, 0x171DC0C2, 0xF03FCD1E, 0x36F4B114,
+   0x97A014F4, 0x11451B78, 0xB73F2090, 0x277FA77B,
+   //T[232]
+   0xAF5CAB24, 0x6FCDE854, 0x467A04B7, 0xD4E8AA74,
+   0x7BCF3D2C, 0x14D14D59, 0xA0ABCAAE, 0xC56D84F7,
+   0xE9EC1DD7, 0x937608B1, 0x867114F6, 0xDF5054EB,
+   0x6DDF93A6, 0x6B013BC5, 0xDD3E48FC, 0x5BFF4F05,
+   //T[233]
+   0xE8EB9FA6, 0xA6874DA5, 0x5D53D5D9, 0x8717F1D9,
+   0xE775420A, 0x7255DC15, 0xD119777E, 0x71CD2638,
+   0xACA9FC16, 0xED636262, 0x6937763B, 0x5171C1F7,
+   0x037EC77B, 0x1BF18C1D, 0xBF3B8213, 0x63B482DE,
+   //T[234]
+   0x7D6DE321, 0x0BC91E66, 0x7469772E, 0xFAE8DD8F,
+   0x4EF060B6, 0x61EAA825, 0xDDB31399, 0xF46BAD95,
+   0xC21213C9, 0x92708587, 0x7D09EB1C, 0x11D287D0,
+   0x6EA52F68, 0xA79815D8, 0xEDDB10A7, 0xB54BB792,
+   //T[235]
+   0x636D0AE6, 0x2D7C4576, 0x7FCBEEEC, 0x4B387E0B,
+   0x103707CB, 0xA3F9A9D0, 0x1398A20C, 0xD20DA011,
+   0x77BB0455, 0xFD1FAC78, 0x8AFBE9CE, 0x5CC544D7,
+   0x78BACA74, 0x15846D91, 0x4901DD7D, 0x30271D42,
+   //T[236]
+   0x4B037401, 0xEE0AF6DF, 0xF4B85D2D, 0x55CD3618,
+   0x493FB0DC, 0x4EA35646, 0x81BD0405, 0xADFCEAF6,
+   0x5B1DDF0D, 0x342DF99F, 0x605D3BB9, 0x2FE483A7,
+   0x639E33D9, 0xDAADD46A, 0x91623D28, 0x9B4DAAB1,
+   //T[237]
+   0x03C5178A, 0xE7980BD9, 0x72F35B9C, 0x4A5ED035,
+   0x32ED344C, 0x5C0945C0, 0x92A40B28, 0xDCD9F5EB,
+   0x51E6C89A, 0x58D2FB9B, 0x75DDBBBA, 0x3F2BBAF8,
+   0xFFB0A284, 0x4AB9791C, 0x7BAD9A46, 0xE12EC09A,
+   //T[238]
+   0x0B89D4BD, 0x048DF69B, 0xB70FBA85, 0x222888EF,
+   0xCCE017F6, 0x44A0C5F6, 0xC264855C, 0xEBC469D8,
+   0xD7CB56BB, 0xB6420B9D, 0xEA5F6AEC, 0x24F72349,
+   0x86EFE6A9, 0xE35956D8, 0x4B12634F, 0xBAE5FB78,
+   //T[239]
+   0x7BCA0BC1, 0x1BCB36A5, 0xC6AD55F1, 0xDADF6DCE,
+   0x6080E0F8, 0x9DE1E8E7, 0xB2567AC5, 0x681D6BE2,
+   0x763F4FCB, 0xDEB1EDD4, 0xE58790F1, 0x2A6A766E,
+   0xCF14E1B0, 0x263F2166, 0xC48087F3, 0x1DFCAB92,
+   //T[240]
+   0x778189C5, 0xC0C38D52, 0xA201226F, 0x68F81BC5,
+   0x35E974BA, 0x890E8BA3, 0x9B23A1D3, 0xB6634418,
+   0xDA3B7AF3, 0x7CDE9E81, 0x6CA457E4, 0xD7E854A2,
+   0x8E7A3D5E, 0x6D2992BC, 0xD1DA4558, 0xC85B3262,
+   //T[241]
+   0xEE5DF4EB, 0x32FB658A, 0x75A1AEA2, 0x9C82E929,
+   0x90638F38, 0x5079DA88, 0x5A2CC1F6, 0xAC9D5B23,
+   0xA4B6436B, 0x4C315413, 0xE22C0B32, 0x183B4444,
+   0x81769921, 0xFFD20056, 0x8DBB9503, 0x6CBB0B44,
+   //T[242]
+   0xDE1300A9, 0x61F97D99, 0x83953873, 0x41841225,
+   0xDB0C465C, 0x9F249E32, 0xDC2447BE, 0xEFA5CEED,
+   0x6C191D51, 0x9AB30D9A, 0x9005B6A4, 0xDBF4DDED,
+   0x00E670FE, 0x90BD6B03, 0xC8EFD72E, 0x2B961781,
+   //T[243]
+   0x96409EB3, 0x02AC3618, 0x4AC5731B, 0xA9040E46,
+   0x80E8987A, 0x00744FB8, 0xC571FB67, 0x37B726D8,
+   0x7D57D0F1, 0x2AD96A5A, 0x0A8EF52A, 0xDC59D323,
+   0x751B6BEB, 0xA9E01754, 0x49E1C809, 0xBF0DF92F,
+   //T[244]
+   0x39F81C9E, 0xE86E9A3D, 0x7783946A, 0xB47A9004,
+   0x541CB355, 0x72BA430F, 0xAC3FDF37, 0x5B8EE3FA,
+   0x635AE687, 0xDF371FDA, 0xD30BC7D3, 0x75429F37,
+   0x0A90FB23, 0xC0D58D9B, 0xAC1D5E95, 0x59575436,
+   //T[245]
+   0x0C6CE683, 0xB5D21D64, 0x08076B0A, 0xEAA6F725,
+   0x8646FBEC, 0x081D887C, 0x5AF13FF5, 0x9CBA423E,
+   0xF54FC3C0, 0x9BB2FC49, 0x26C5C719, 0x79F37273,
+   0x15CDF0AE, 0x05AF002F, 0x2AA017E0, 0x7562190A,
+   //T[246]
+   0x05A0AF19, 0x64777EFC, 0x6292AC20, 0xC3CDA2ED,
+   0x640D9419, 0xF25592E5, 0xB4BB2E1F, 0x5308B91D,
+   0xBF1444CE, 0xBC5D3721, 0xED42874A, 0xE4B6BD8C,
+   0xABAE0290, 0x2D50B9AF, 0x47C018AB, 0x6B64BF26,
+   //T[247]
+   0xB376CE56, 0x580E9C32, 0x9FD6E193, 0x7D700EE2,
+   0x1EEC566B, 0x12BD427A, 0x61EA45A6, 0xE9F73A45,
+   0x08490971, 0x55617AA8, 0xDBCA1AD2, 0x4A5AA3AB,
+   0x8384B6AC, 0x58BEB1A6, 0x07E4444C, 0x76323EE2,
+   //T[248]
+   0x0C4A3B64, 0xE88F54D3, 0xCE1C832D, 0xF7615B0D,
+   0x973D58FE, 0x2F67ADB0, 0xC3CEF173, 0xB2871E1C,
+   0x7A97569E, 0xED83D2A2, 0xAB59D53A, 0xD11912B4,
+   0xA435918D, 0x10764C79, 0xEF2764C3, 0xCA537A69,
+   //T[249]
+   0x90125DEE, 0x94D56BC8, 0xE778A787, 0xB531F3B8,
+   0xAF58F361, 0x3BD55133, 0xE15C70E5, 0xFE17E49F,
+   0xC6F1D920, 0xDD93B546, 0x36CCB9F9, 0x0C5FF33B,
+   0x28F1575F, 0x43ACA5E6, 0x5C274AD0, 0xA55B4F60,
+   //T[250]
+   0x06589232, 0x5A6FDA9D, 0x560E6363, 0x967F03D6,
+   0x6176FE56, 0x8913E989, 0x543DB0EF, 0xACB44D40,
+   0x8E895B40, 0xAB0E252A, 0xD42959E6, 0xAB32C974,
+   0x44A05AD1, 0xBC3F7E15, 0x6511572E, 0x65271BA1,
+   //T[251]
+   0xBCD91C45, 0xFCF99E08, 0xACA75397, 0xEF84F18B,
+   0x6E525D1F, 0x15464F30, 0x425D091F, 0x0D216A15,
+   0x0AC21D69, 0x1F87DCAF, 0x67416519, 0xAAB24306,
+   0x7F5D18F8, 0x1768A8B8, 0xC40A8C75, 0xCE3E7C99,
+   //T[252]
+   0x37B6D3EE, 0x4F31F586, 0x74AC2BE8, 0x4F6A0343,
+   0xC47589CC, 0x6CB479F4, 0xC8DEA1B6, 0x34F06E15,
+   0x053E171B, 0xE091B4DD, 0x240FDD1F, 0x6989FD6D,
+   0x9FF2123F, 0xDE25A063, 0x513A6DA1, 0x0E04BCC9,
+   //T[253]
+   0xE9343616, 0x64981B01, 0xCB86E631, 0x90502CBC,
+   0x86A5DEFC, 0x44E595EC, 0xC5F1C69E, 0x5684A676,
+   0xC2D85A87, 0xE4B9D8CF, 0x5CCD436B, 0xA9CD9009,
+   0x3D913783, 0x33195343, 0x0AC25661, 0x949349C5,
+   //T[254]
+   0x564EFA22, 0x2BE3F5F5, 0x1EE27DEB, 0xC5F4CEF5,
+   0x0E25BD0D, 0x3B239E56, 0x9BF10706, 0xDAF3F4F1,
+   0x5B919A7D, 0x788294B5, 0xBF83CB15, 0x1BC79C9E,
+   0x1E312DCB, 0xE0642403, 0x051194CD, 0x7FFA38DF
+};
+
+#endif
+
+#endif
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && EC_NIST_FAST_SUPPORT == ENABLED && SECP384R1_SUPPORT == ENABLED)
+
+#if (SECP384R1_COMB_WIDTH == 4)
+
+//Comb table (4 teeth, 96 columns)
+const uint32_t ecNistP384Comb[] =
+{
+   //T[0]
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D,
+   0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE,
+   0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   //T[1]
+   0xD8EE21C9, 0x39C1B328, 0x558717DB, 0x2C3E0C91,
+   0x3F8686A9, 0x4B58808B, 0x18141B1A, 0x43603909,
+   0x37CA7ABC, 0xD6E98B0D, 0x060CBD1B, 0xF532389A,
+   0x23D86ECD, 0x7A7E1839, 0x085A4E9A, 0x31EA31B1,
+   0xBE643603, 0xBC40CE5A, 0xA2124163, 0xBD22CFB2,
+   0xDE3A82BA, 0x6F04CAA2, 0xC3B38E69, 0xB9D2852C,
+   //T[2]
+   0xEB09A0E5, 0x264E5246, 0x32CDF03C, 0xF8F4BE11,
+   0x5FAEFA4F, 0xDA9D5483, 0x17A31B22, 0xBBBC4FD0,
+   0x86F06145, 0xC3DECD0C, 0x0A5F2CAB, 0x528EF167,
+   0xC14F0DD6, 0x8A1E9858, 0x09CB7524, 0x550538A8,
+   0xC87FED22, 0xBD60CAB4, 0x631D058D, 0xF8B76FDD,
+   0x1A1DCF14, 0x5803EAA1, 0x7BCCF56C, 0x7B9B1FBE,
+   //T[3]
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458,
+   0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D,
+   0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   //T[4]
+   0xAA133909, 0x30991560, 0xC6CB0017, 0x9097DBB1,
+   0xB860FAE6, 0xD37DE424, 0x70B375DD, 0x9BB183B2,
+   0xCD6CE3A3, 0x567A6233, 0x0FDC3088, 0xAAB8BB9F,
+   0x600AD5A6, 0x16C5B981, 0xD62FAA44, 0xEBDF73F2,
+   0xC9747BF3, 0x6D955BB3, 0x15EB04AC, 0xF6005FC8,
+   0x282050B5, 0xF0AF01D1, 0x314F6D28, 0x48942F81,
+   //T[5]
+   0x7716605E, 0x20221121, 0x9EF281C8, 0x2347D2C8,
+   0x567D6342, 0x54BA4599, 0x77C0F03F, 0xCE0FBA30,
+   0xCB367444, 0x7022F802, 0xA9A6A052, 0x7334A936,
+   0xD658A01A, 0xB5461F68, 0xC2BD0EFA, 0x0A64D519,
+   0x697A9280, 0x9E2EEE8F, 0x7D0E017A, 0x8E5D9B89,
+   0x7CBD4CCD, 0x1F7C5C36, 0xF632C926, 0x7FFCEFF7,
+   //T[6]
+   0x0E758344, 0x300AE2E6, 0x371A2CA5, 0x451C707A,
+   0x5052DD32, 0x25651D10, 0x4862B954, 0xBF88DE7F,
+   0x0381EF13, 0xFAFCE26E, 0x960E090E, 0xDC916C17,
+   0x026B0889, 0xED17CC44, 0x9B42441B, 0x95C01FF1,
+   0xCC160697, 0x40896478, 0x0BA04A35, 0x52D154B8,
+   0x701C2952, 0xB3D92EA4, 0xD69ECA0A, 0x266E8A40,
+   //T[7]
+   0x4905CA71, 0xE4BFC2C0, 0xD156F761, 0xF33A450A,
+   0xD08848C2, 0x3D8B29DB, 0xA2309686, 0x097DA395,
+   0x5F4972D7, 0x21190503, 0x17CBAA12, 0xB2D10558,
+   0x753EE324, 0xDDCEBB55, 0x6924666F, 0xE87AB07C,
+   0x4ECF1A68, 0x9B475D74, 0x2E6236C0, 0xF82BE8F5,
+   0x3CFD056B, 0x237C0DBA, 0xC3C6CBD2, 0x354CD872,
+   //T[8]
+   0x708D4CEE, 0x8D104D24, 0x819CF043, 0x197D6958,
+   0xF0712210, 0x47FC87FA, 0x5C201558, 0x103DF785,
+   0x611EF638, 0x30B0A9E8, 0xFDFEBFEC, 0x00B19AC8,
+   0xD201E03E, 0xD40E8D6F, 0x2228FF5F, 0xBB7C969C,
+   0x636164C5, 0x68810282, 0xE754220D, 0xCDBB3CD2,
+   0xE9F6EDC4, 0x1418FE25, 0x9EE36031, 0xA72F9105,
+   //T[9]
+   0xB769737A, 0x64D2C273, 0x97D53FFD, 0x2CC02451,
+   0xE86C46BD, 0xC3B6AC4B, 0x685E926D, 0x17E9411F,
+   0x75203A36, 0x136DF36B, 0x8BF0B27E, 0x3F9561E0,
+   0x27E990A7, 0xDD6FF8D5, 0xF9867A60, 0xC34BE586,
+   0x8554E014, 0xEA088747, 0x6F52E4CB, 0xCFCED664,
+   0x412AB641, 0x4B1A5A20, 0x39629587, 0x0B06F006,
+   //T[10]
+   0x85651F82, 0x044C0DD2, 0x785D3EF7, 0x325C51E7,
+   0x88E95532, 0xB83A1861, 0x522C2931, 0x539F94AD,
+   0x8980F137, 0x15274E5B, 0xDF0F66D7, 0x9FD7B010,
+   0x4064E4C0, 0xE4A7B94A, 0x25D7D211, 0xD44EBA45,
+   0xBE8A04E3, 0x0A806B54, 0x149033DE, 0x929226BD,
+   0xC9739246, 0x795F6FA3, 0xB9260225, 0x321AA9A3,
+   //T[11]
+   0x8B707B8E, 0x49BCC2F5, 0x1D928983, 0x2901B519,
+   0x7D49C780, 0x2E4C2956, 0x4C6A9964, 0xEBD1CFF8,
+   0x16EE3E13, 0x2CAEBBD3, 0xA87A68F7, 0x36A543EE,
+   0xB569946D, 0x75B41C29, 0x3EF2267E, 0x1510E7D4,
+   0xD4B3394D, 0x91235072, 0x8FBD85D1, 0x58EAFF04,
+   0x78A67847, 0xD349AB03, 0xA50EE41C, 0xF277BACD,
+   //T[12]
+   0x5F863BBD, 0x10B05658, 0xB483283D, 0xE92CDC5A,
+   0xDC7C421D, 0xEBB31209, 0x6D01A5A8, 0x3AFCBD79,
+   0xA08B6A51, 0xE2B067CA, 0xE8CB7AEB, 0x026E0DC2,
+   0x02DDE18A, 0xD8C35029, 0xD8C6CF36, 0x64C15FAC,
+   0x10781E45, 0x17EA2701, 0x1F3443D8, 0xD68D1FFC,
+   0x8C7461A5, 0x4BE25637, 0xD8EF24E1, 0xAE8866BA,
+   //T[13]
+   0xD265A91C, 0xAC3A78D0, 0x6C8F83D3, 0x1A29F8EF,
+   0x8FD8D817, 0xEF98FDDE, 0xC42BF748, 0xDF459EA1,
+   0x81A73DC7, 0x14DAFC39, 0xC52AFA2D, 0xB03DFA54,
+   0x6C0D2CE7, 0xCC406F6E, 0x41FD72CA, 0xCD120B2B,
+   0x78F602DD, 0xEF5D9006, 0x8ACCF229, 0xF5F8A2D1,
+   0xCE6D908A, 0xAAFD1FCF, 0x0E6D85F2, 0x2CE2885A,
+   //T[14]
+   0xC62666DE, 0x89109A0E, 0x7FFCD01E, 0xC8C12E75,
+   0xC48B5AB0, 0xA8206169, 0xF983AC6C, 0x4BC2FDCF,
+   0x55977D23, 0x59CFCA71, 0x5766C96A, 0x1264CB33,
+   0x2E014B4B, 0x6B691381, 0xE4483EC5, 0x31D28707,
+   0xFFB19758, 0xCBF7190C, 0x65A5F248, 0xB66717A0,
+   0xC53B4F69, 0xD94AD8FA, 0xA1A1A376, 0x119EBEEE
+};
+
+#elif (SECP384R1_COMB_WIDTH == 6)
+
+//Comb table (6 teeth, 64 columns)
+const uint32_t ecNistP384Comb[] =
+{
+   //T[0]
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D,
+   0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE,
+   0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   //T[1]
+   0xD74D9642, 0x06BA5918, 0xDFA0F56D, 0x92DD9CDE,
+   0x8CBAE3EF, 0x74C1AC3D, 0x5F6F39BF, 0x2FCE93BF,
+   0xE2CFE67C, 0xFF348797, 0x510CC718, 0x079DC566,
+   0xC16BB523, 0xA0ECD5D0, 0xCC51C42F, 0x29F49D50,
+   0x892459A9, 0x36275538, 0x8484B5F1, 0x62637770,
+   0x5C806F88, 0x89A8437E, 0x5D9087BC, 0xA64DA09A,
+   //T[2]
+   0x2C009246, 0x371FDB78, 0xB7EBF317, 0xBCB6F706,
+   0xCF2CBC3D, 0xE753EDD8, 0xA37B7552, 0x852CC3AB,
+   0x41789DE5, 0xAC8476F6, 0x52E85654, 0xBDA8CBB3,
+   0xA4AEF26D, 0xDA1B89B6, 0x1CCE0F01, 0x4C50F67C,
+   0xE690EB4C, 0x7AD4C74D, 0x8A2D49D1, 0x94609901,
+   0x9B9B805F, 0xD907B06A, 0x59EEA2C2, 0x23BC95BE,
+   //T[3]
+   0x0020362E, 0x84A2AE35, 0x19BF5F49, 0xEA2B1DF4,
+   0x287C9B53, 0x2BB64E18, 0x2B7B03E9, 0x11C2DF65,
+   0x85D5A524, 0x23A42EA4, 0x11CD506E, 0xE10CB36D,
+   0x2ADAEFC2, 0xE5F50BFE, 0x36ADB53E, 0x64666B55,
+   0xE90ED2A4, 0x7768FB7F, 0x06CC84C0, 0x425D7817,
+   0x31D6AB0B, 0x52EC806A, 0x4697D363, 0xD7E67972,
+   //T[4]
+   0xAE569DE6, 0x981FFB59, 0x8091ACCF, 0x586EA887,
+   0x08A70830, 0x67FC3294, 0x849E299F, 0x7E6EE5F4,
+   0x50B92155, 0xC79CF824, 0xC2010434, 0xDE3E77FB,
+   0xE3EE3800, 0xA6EC9DC7, 0x43CF88B6, 0x8E5E92FA,
+   0xF843CAE9, 0x757E493B, 0x17EBE71C, 0xE1C28645,
+   0x32576992, 0x00D19CE0, 0x4DB810D9, 0xE30DF4B8,
+   //T[5]
+   0x780E56F3, 0xF6DA53E1, 0xAF4D2766, 0xFD5F2FB0,
+   0xE383BF0D, 0x52922DE8, 0x58EE4DDC, 0x1C92ABA0,
+   0x238E7643, 0x3B2384C0, 0x0D6AC898, 0x2D350FA2,
+   0xFB35AA8B, 0x2929929E, 0xA6E54797, 0xA8743694,
+   0xC525C526, 0x67F4174C, 0xE0E2F34D, 0x8CF8B3C9,
+   0x0B8F32EE, 0x80CCBCE7, 0x689DE2FA, 0xF15779E6,
+   //T[6]
+   0xB29ADC60, 0x16273979, 0x3BE4714F, 0xA30C604D,
+   0x4019BD55, 0x5A2A19FA, 0x431EF84D, 0xEF8D50A1,
+   0x417C18A3, 0x581B7CFA, 0xC4245900, 0xADD3B7E9,
+   0x633D01BB, 0xB76F4554, 0xA319B27B, 0x34421D86,
+   0x18870284, 0x711A5292, 0x5DB1186C, 0xFE371B18,
+   0xBA6174F4, 0x3040AF18, 0x523C7DDA, 0x6FB0070F,
+   //T[7]
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458,
+   0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D,
+   0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   //T[8]
+   0xAA133909, 0x30991560, 0xC6CB0017, 0x9097DBB1,
+   0xB860FAE6, 0xD37DE424, 0x70B375DD, 0x9BB183B2,
+   0xCD6CE3A3, 0x567A6233, 0x0FDC3088, 0xAAB8BB9F,
+   0x600AD5A6, 0x16C5B981, 0xD62FAA44, 0xEBDF73F2,
+   0xC9747BF3, 0x6D955BB3, 0x15EB04AC, 0xF6005FC8,
+   0x282050B5, 0xF0AF01D1, 0x314F6D28, 0x48942F81,
+   //T[9]
+   0x4AB018D9, 0xF5B4350F, 0x4F890F56, 0x03D42BFA,
+   0x472ABCBE, 0xA59802AB, 0xAB00B039, 0xC49DC552,
+   0x4905EDEB, 0x5BDBFA1B, 0xAADAF829, 0x8B714479,
+   0x10903577, 0xB69F6121, 0xCAA17043, 0xFFCF3103,
+   0x12B7D6F0, 0x194BEFCC, 0x44FA539F, 0xC2315CA2,
+   0x27D7AA39, 0x330A336C, 0x5E7E1A8E, 0xD67B4141,
+   //T[10]
+   0xB6D82F46, 0x50E97C63, 0x14B98CD9, 0xDE6337D9,
+   0x46B80210, 0x387BCEAD, 0x662D4782, 0x2333E9A7,
+   0x9493F992, 0x4FB348A8, 0x51AC4AE9, 0x1A2F7208,
+   0xF9A0ADDA, 0x9778E181, 0xD8639A3A, 0x171A79BA,
+   0x7A7B3134, 0x2D7D5D5A, 0x4B129683, 0xB7E00919,
+   0xEE578A55, 0xEC7E6E4E, 0xDC699D11, 0x08D8DAB3,
+   //T[11]
+   0x09331EE2, 0x50938B9B, 0x01C84DEA, 0xB5EA6C18,
+   0xD5A6BD1F, 0xBE617A0F, 0x8F79292B, 0x78BB665F,
+   0x58E00408, 0xB942F765, 0x866F2B6E, 0xF8B838B2,
+   0x3780EDA2, 0x2A518D48, 0x5F9FCB09, 0x2A58627F,
+   0x8EB96EB4, 0x48F510FA, 0x15802F8F, 0x97DDED6D,
+   0xAAABA84B, 0xE75CD28D, 0x7EDE1244, 0xACD28AFA,
+   //T[12]
+   0x03034968, 0x4A286F33, 0x05A7DB5D, 0xFB4DF38C,
+   0xA8B1928E, 0x3B640DEC, 0xD0FDFC4E, 0x5D1B884B,
+   0x69519C83, 0xF57371CE, 0x23145AB8, 0x5F63461A,
+   0x44704CBC, 0xEDEFCD18, 0x64DD49C2, 0x924D7E7E,
+   0x097C32A2, 0x2CD63FD0, 0x654FE06D, 0x3E547A0C,
+   0x4AFBFA16, 0x8C5A79B4, 0x2B1B5D04, 0x749ABCDA,
+   //T[13]
+   0x4FEE705E, 0x06F6CFF7, 0x4B772C5B, 0x315FC16F,
+   0x68592FF1, 0x4B2FDF35, 0xE9BCBEBB, 0x0AD35E83,
+   0x690B01A1, 0x1BBCC1E0, 0x0774EA13, 0x69F7B65F,
+   0x68FBC242, 0xEAA68FC8, 0x4C78BCF9, 0x749FA469,
+   0xCBBDFC33, 0xCF3AF279, 0x020525CC, 0x50F52CDE,
+   0x64CBEDC0, 0xCEBE1959, 0x3DF78387, 0x1D8D9C44,
+   //T[14]
+   0xF756AC51, 0x0B68515F, 0xBC1DE0C6, 0x03AC4E13,
+   0xE6C5F5B7, 0xCBBA88D2, 0x23280EFA, 0xEEFA6758,
+   0xD84B809E, 0xE415DFC4, 0xE6580EF1, 0x03C2592C,
+   0x9927269B, 0x0B222B16, 0xC38FF3BA, 0x38FC9B2A,
+   0x3D832EFC, 0x1B3C9EFE, 0x2DCD5708, 0xB53849C1,
+   0x338B4295, 0x01EA1F89, 0xD7131DAA, 0xEB3EBB50,
+   //T[15]
+   0x1A9BB0AA, 0x31EFC132, 0xBB0F6CA7, 0xDA74BDF2,
+   0xCD3D0497, 0x1AF000F8, 0x2AAA3451, 0x39ACB8F2,
+   0xEDFB898D, 0x23EAF4CD, 0xCAD3D109, 0xE7B3F42D,
+   0x5E695394, 0x98CA61B5, 0x0E70A633, 0x6F591102,
+   0x216B71D5, 0x80A93EC7, 0xC463E3B8, 0xBBB25C8F,
+   0x8615E7A5, 0xB18E3FBA, 0xFC212920, 0x5A5D5C5F,
+   //T[16]
+   0xD2529AD2, 0xF2977C54, 0xED6E33E0, 0xC55087D9,
+   0x167E355A, 0xB8831540, 0xABA42B33, 0xFEEA9103,
+   0xEF3947C1, 0x90D05905, 0x760D24BF, 0xAF085311,
+   0xBDDD2F1F, 0xE5B14850, 0x55841C80, 0xF6EB1478,
+   0xA63E5ED9, 0x04C7F6AF, 0x65E211E7, 0x3B9541CA,
+   0xE6D883AE, 0x2D06224D, 0x2A257FFA, 0x974628AA,
+   //T[17]
+   0x45F5B090, 0x1D12EE6D, 0x485B3A1F, 0x4B71091F,
+   0xF5B0B2A7, 0x86D41F81, 0x2613A770, 0x0B230B2A,
+   0xD7C428DB, 0x57D0106C, 0x9DF04A3C, 0xF277B4BC,
+   0x0A32A7E5, 0xFC506E66, 0xD317047C, 0x846CE285,
+   0xCC394C36, 0xCEB4D115, 0x97182DB4, 0xEF860BEC,
+   0x2F49ED16, 0x772D38D7, 0x27E042EA, 0x0CC65D74,
+   //T[18]
+   0x5615DB79, 0x56C0CB84, 0x080EDB56, 0x9ED4F5C9,
+   0x1AD062E6, 0x07D5137C, 0xE053AD7D, 0xC0A02132,
+   0x218138C5, 0xBBD20E23, 0xD005511C, 0x71A9821E,
+   0xBF27C3A7, 0xB9B7AAC6, 0xDF4565CB, 0x461746B9,
+   0xB23F38F5, 0x1CCA5DB1, 0x636C2988, 0xB848D7E9,
+   0x99D7F1BC, 0x9905C28C, 0x825EE66D, 0xD57EE56D,
+   //T[19]
+   0xABE86F94, 0xCD8127FD, 0xC4AA703D, 0x1D082A02,
+   0x856805E7, 0xE4C033A6, 0x4CFFCBDF, 0x7F9803EA,
+   0x456F325C, 0x08F01BE4, 0x56899A2C, 0x14E4E4D0,
+   0x68450D6A, 0xC220C4E3, 0x348C7C8A, 0x7100595D,
+   0x260EB12A, 0x42734E23, 0x5C2DB9E8, 0x6D1B51F8,
+   0xDA5A3AB7, 0x983E3BAF, 0x8E12B7E4, 0x997C7DAA,
+   //T[20]
+   0x7DFA617B, 0x63B6DB01, 0x3958C611, 0x2382C6F4,
+   0x807A5A47, 0xD8AACD08, 0x3FC68CDA, 0xF468A53C,
+   0x17D5F5BB, 0x8AD836AE, 0xC592ADC7, 0x91DA6C57,
+   0xC01767E8, 0x848C7840, 0xAAF49F7E, 0xB27E5CDA,
+   0x3E42DB96, 0x67A06472, 0x1741F927, 0xA8E8E343,
+   0x43CCDD66, 0x0305167E, 0x48CF4B36, 0xE590418F,
+   //T[21]
+   0x87667E11, 0xBB31F603, 0x7E745458, 0xFD4F93F5,
+   0x309A7D39, 0xBF08A73C, 0x23AD2F18, 0xE7E2EEF3,
+   0x40360944, 0x0CAD3305, 0x48664803, 0xA2B3ACA7,
+   0xBA1FCE75, 0x87675CE3, 0x4D64D1CD, 0xBB409FF6,
+   0xDE117C49, 0x0F13E3E4, 0x7414266B, 0x31D85EBC,
+   0x271AB0FE, 0x8CA52DD3, 0x964295DF, 0xC22174F5,
+   //T[22]
+   0x9D6B0C98, 0x5CBC0422, 0x2F796386, 0xDE8A0E6A,
+   0x023F6729, 0x747F91B8, 0xA06414FC, 0x506BF433,
+   0x8771441C, 0x453F88B8, 0x05852B1B, 0x155344C5,
+   0xD1FE2B3E, 0x2EE3731C, 0xD3A13366, 0xD29D1C69,
+   0xB6BA5AE0, 0x04941BAE, 0x5C9074AF, 0x453AB057,
+   0x20932FDD, 0x8D1D5424, 0x719D78FA, 0x98495D67,
+   //T[23]
+   0x9E3303A4, 0xAD7F8AEC, 0xFB283BA5, 0xADCBCA0F,
+   0x03FD29C7, 0x7BA99251, 0x735503EF, 0x2E31CF2A,
+   0x5DAD58FC, 0x60D66A8A, 0x72F7FC70, 0x9C050815,
+   0xC76BFE85, 0x35F5C4F6, 0x4CAFB0E7, 0xBB04BA18,
+   0x828C22D7, 0x8D19A621, 0xFDEF9916, 0x50E7BD15,
+   0x8B0C751C, 0x2185491F, 0xDB05F5AA, 0x1CF397CD,
+   //T[24]
+   0x110EC812, 0x698FE08D, 0x6C797F59, 0xB1BCB75F,
+   0x3C83E188, 0x96EEBB12, 0x1BC4C22A, 0x17B97141,
+   0x1DBBEEB0, 0xF2885089, 0x74551CFC, 0x3F92DEEB,
+   0x0692389C, 0xB2B3D019, 0xA326992A, 0x81C1E25F,
+   0xC3FDFC75, 0x8F2426B6, 0x49E7ADAF, 0x964B64B7,
+   0xAD954E6C, 0x30B6FE07, 0x2DE7154F, 0x1008A919,
+   //T[25]
+   0xFFDCDECE, 0xB5406AEB, 0x1AC67153, 0x505D7D43,
+   0x0433839B, 0xD4CD4991, 0x54540A3F, 0x3D981F00,
+   0x036E1CF2, 0x055F14E6, 0xC33A23E5, 0xFC45ACB0,
+   0x1D129997, 0x04B8D16B, 0xBB8B42C8, 0x086062F1,
+   0x40AECCEE, 0xAEBCF8A0, 0xB96D5265, 0x139CCDBF,
+   0x0134A1D2, 0xBA482874, 0x5F0E60E7, 0xCE949A4C,
+   //T[26]
+   0x0AACBDBE, 0xFAFF6B3F, 0x1474E4E0, 0x711D70D9,
+   0xBB71B0F2, 0x2B9618D8, 0x9019B8DA, 0x01EEB580,
+   0xA6202191, 0x6F034817, 0x6DBB1DE3, 0xF1342094,
+   0x4B678259, 0xE2BE4E8E, 0xF877DABE, 0x2D2B5523,
+   0x25DE025C, 0x51742D35, 0x0BB80CD0, 0x04ADBA39,
+   0x4D280EA6, 0x1BE43DE1, 0xD40AEC5D, 0xB08DC4B8,
+   //T[27]
+   0x9C8E4278, 0xD165CD21, 0xBE3074CF, 0xD464F8BA,
+   0x596C7E37, 0xE880163D, 0x3B71CDBF, 0xFF21CF57,
+   0xABB38EAC, 0x104C1028, 0x092EE0C5, 0x86D1BDCF,
+   0xCD619224, 0x48F6C554, 0xC9B564E6, 0xCBDDA09F,
+   0x40245EE6, 0xD0160020, 0x386AAE10, 0x058DF586,
+   0x8FCF7688, 0x8052FB31, 0xEA5B86C3, 0xF957DAEB,
+   //T[28]
+   0xC2CE683E, 0x6D0C4D55, 0x3293209B, 0x47AED690,
+   0x43AB78DD, 0xAE73EB9E, 0x83C397ED, 0xBFF13CA6,
+   0x6625250F, 0x4BFA2608, 0x5D44FB41, 0xAC3BEC82,
+   0xB5EA9058, 0x69D09904, 0xA022F24A, 0x8745FDEB,
+   0x3281A45D, 0x5BEEFAFC, 0x6AA4BB27, 0x1D5C4177,
+   0x4FAA1EA1, 0x50B310F0, 0x14137409, 0xE6D7909E,
+   //T[29]
+   0xB002667C, 0x9857F321, 0x5F935341, 0x9FC75306,
+   0x7469ADF5, 0xFF0B96FA, 0xFAAB0698, 0xB409FF5B,
+   0x6D15C913, 0x39E82032, 0xEB2CFB46, 0x86DC3FA0,
+   0x3E1E3FD2, 0x69BEE69D, 0x66C61037, 0x2CDBF99D,
+   0xC1B13717, 0x223FA09F, 0x73840224, 0x1D4E2D20,
+   0x18B74223, 0xF8D1807F, 0x1190C01C, 0x107A3BD9,
+   //T[30]
+   0x4F70BDDB, 0x2C06D1A8, 0x682E4E19, 0x50FA35FC,
+   0xED755360, 0xEBC25FF2, 0x9F6B8739, 0x9322E205,
+   0xB7A81A4F, 0x7C6D9E03, 0x8869D0CB, 0x3A9E39A8,
+   0xFE68EFF8, 0x150824EC, 0x924B06A1, 0x7434B70D,
+   0x1ADDF43E, 0x45E44AA0, 0x4F4F63C3, 0xD3D6BBCE,
+   0xDF8DEECD, 0xACB7733F, 0x80B606DF, 0x53D9814D,
+   //T[31]
+   0x968B4A5F, 0x110162F2, 0xBA0F8B3D, 0x1323FEFF,
+   0xB1666EAA, 0x89ACC4C0, 0x3007A482, 0x85DFB383,
+   0x5C7A9BA1, 0x5F5449E7, 0x6BFCF21E, 0x38174A00,
+   0x4F0474FC, 0x9F7DC254, 0x40CB718B, 0x13F390D7,
+   0x3A45AD17, 0xE6091C18, 0x1605976D, 0x9B795D80,
+   0x2055EE90, 0xE0BCD7AF, 0x92EE7C2E, 0xD637FBF6,
+   //T[32]
+   0xDF13F515, 0x94971913, 0x33B3F908, 0xFE218266,
+   0x1639FCF5, 0x0E764323, 0xA1254809, 0x2F1C9564,
+   0x5715AC43, 0x28A0DED9, 0x3DB85F16, 0xCC249148,
+   0x54C8F22D, 0xC4BD32D1, 0xAAF03B8A, 0x20F4D89D,
+   0x6CBBC34F, 0x2D25AC66, 0xB210256F, 0x1DDE41E1,
+   0xB830E83C, 0x982ABC37, 0x4A0157BA, 0x859F781E,
+   //T[33]
+   0xDAF70CC5, 0x3741A3D0, 0x1949DCA9, 0x4F89C256,
+   0x4209B8BB, 0x84D76E8E, 0x61AA033D, 0x89D03A28,
+   0x62EB53A5, 0x2BB8225A, 0xDD131005, 0xF16CAEC4,
+   0xB3F85850, 0xFB3DA605, 0x9705C612, 0xA894E851,
+   0xB6E52255, 0xD3C477F5, 0x609DE217, 0x275B8DC4,
+   0x17CCD6D8, 0x836E2886, 0x7626B688, 0xBEFEB474,
+   //T[34]
+   0x12CD19BD, 0x564F510B, 0x243D4B30, 0x055916A4,
+   0x59D3EBAC, 0x017C752E, 0xA5B4B98C, 0x4C292ED9,
+   0x75051686, 0xEE06B302, 0x799F7CAB, 0x234FF191,
+   0x847C9865, 0x7730FFE1, 0x5FC2E271, 0xCDBD4055,
+   0x3F876569, 0x5724C2C4, 0x600A300E, 0x4824D115,
+   0xB6D99957, 0x1DAFB1AE, 0xA2EE809B, 0xF3B9740F,
+   //T[35]
+   0xAE3C5C76, 0x0A289321, 0xA1A23A44, 0xD35FBDC6,
+   0x27340D10, 0x72BD5E91, 0xFCA6AA42, 0x38DF4F70,
+   0x50546B32, 0xD9F2612F, 0x5C98FDF6, 0xC3819702,
+   0x7476A566, 0x6A2544DF, 0x9A396E7F, 0x5DF6ECFF,
+   0xEAD8F18C, 0x4522F408, 0x3A8C0E3E, 0xCBF8CDA2,
+   0x51C4A7D1, 0x3BE9ABF2, 0xAD0790EA, 0x634CD141,
+   //T[36]
+   0x370FE603, 0x1E9910C1, 0x5D9DAD61, 0xFEA60180,
+   0x2A100FB0, 0xEB38209D, 0xCECB606C, 0x32A7A05A,
+   0xDF14CFBA, 0x2D74E5BF, 0xDD1A12B5, 0xC65D0259,
+   0xF5F8C9C8, 0x7B4D13B6, 0x93B145ED, 0xDC79A2B3,
+   0xF7CFF674, 0xCC9C29E6, 0x80655087, 0x590A59BC,
+   0x3524F00E, 0x0CF046A2, 0x9DC026BD, 0x67625661,
+   //T[37]
+   0x535B9874, 0x217AFFC5, 0xD7396B2B, 0xD0F3DA4A,
+   0x5189F1D9, 0xC2F3120A, 0x13BE9D9D, 0x640D40A5,
+   0x7EA25C0B, 0xC65AEEC0, 0xAC1B42F6, 0x148AC3C9,
+   0x7C4C23E0, 0x949C94D4, 0x75B629E8, 0x4C25D7A6,
+   0xFA279B86, 0xBAA85BFC, 0x2A18AAFD, 0x3E066E81,
+   0x51BBAEAD, 0x9F3AB93D, 0x095C11E2, 0x1665215E,
+   //T[38]
+   0x24C2BB10, 0x54372E43, 0x35CEF78A, 0x3FF377FC,
+   0xD5963475, 0x6B9D764A, 0xEA0F3BB8, 0x220B12A8,
+   0x2D5D3F66, 0xFB9ED41C, 0xC7DD2E7D, 0xDCAFAB6E,
+   0x0C7BB28C, 0x598E839A, 0x92905130, 0xC3193279,
+   0xD0F989EE, 0x8FA52CCF, 0xDE21507B, 0x819D4150,
+   0x9E2B7DE0, 0xE3A8959D, 0x8720A5D8, 0xAA5F9788,
+   //T[39]
+   0xF2185961, 0x69FE6DE0, 0xCAB2F970, 0xAC246678,
+   0xD1FA56CB, 0xEAA8FDC7, 0x95E4CA40, 0xF46115F6,
+   0x884B0B69, 0x408B8231, 0x861CC448, 0x740A16F9,
+   0xE63B89DD, 0x7C2024CD, 0x15B8BC28, 0x43399555,
+   0xE993CCAD, 0x3A25EFB9, 0x35DBB862, 0x0E01859A,
+   0x3521322C, 0x916982EA, 0x19F5F297, 0xD25B20D6,
+   //T[40]
+   0x66B45964, 0x605AE87E, 0xB27E5CA5, 0xDAC9D9AD,
+   0xA3499782, 0x2E078313, 0x13C7265A, 0x6BB00D35,
+   0xFAAB601E, 0x2C18934B, 0x311C2D54, 0xAE61E44C,
+   0x511E4DDE, 0xC5916E59, 0x514D5438, 0x60CC36ED,
+   0xC756A818, 0xC5332778, 0xC995B742, 0xBC6AC88B,
+   0x9613E95E, 0xEEF9E1B3, 0x5EB046F5, 0x050394C3,
+   //T[41]
+   0x292DB8D6, 0xA7336B4C, 0xFB3F71A7, 0x0D03E76F,
+   0xB272DEDF, 0xCFF0E362, 0x46E3FE2C, 0xBA4575E3,
+   0xE7055F43, 0xB38ACD7A, 0x612DB2A9, 0x8510FD43,
+   0x9BC4AAD3, 0x189C8DCD, 0xCBFB868A, 0xDB5D782B,
+   0x37EF7C9A, 0x5B915B8E, 0x702C0828, 0x05698EBC,
+   0x62D4BF9F, 0x687BEAB1, 0x66F63C3E, 0x3F00C98A,
+   //T[42]
+   0x30295B6D, 0xB69E1A41, 0x3183CA76, 0x42CBA75B,
+   0x44504121, 0x8931644D, 0x5DC284CF, 0x183CA597,
+   0xFDA50FF0, 0x2C475A8E, 0x2D02587C, 0xBA0BB140,
+   0x678C33DA, 0x994323CE, 0x72475384, 0x2A5B1F44,
+   0xA4D9C1AE, 0x18638850, 0x6975F27C, 0x31C40073,
+   0xDF1D904B, 0x69D8001A, 0x4889B105, 0xEF6270A8,
+   //T[43]
+   0x1D808BF2, 0x9CB26205, 0x7FA50C45, 0x82DFBF8D,
+   0xFE6665B4, 0xF7615A8B, 0xB0CEB476, 0xFD616CC2,
+   0x0B9AF731, 0xD1BBF01D, 0x322C4CC3, 0x2D429B8F,
+   0x943B6FFB, 0x8B877CC0, 0x26857E49, 0x931B0790,
+   0x7DB914FC, 0x61613D73, 0x325E0B06, 0xE7C95092,
+   0x91C5A80C, 0x4236049C, 0xED476D14, 0x8A6C523C,
+   //T[44]
+   0x50558A7E, 0x3C8AEF7B, 0x48231BFE, 0xB6916323,
+   0x3C54040D, 0x9AC79B24, 0x84C33825, 0x499FFFFB,
+   0x6DE02A66, 0xCB5C8A68, 0x855393C4, 0x63AF0DA1,
+   0x4C95881B, 0x5106D00B, 0x498DAF92, 0xE0B4C8A2,
+   0x09537675, 0xCA874388, 0x3F77A490, 0x0AB4215E,
+   0x64869E35, 0x77C191CC, 0xCB5617C1, 0xB15B7DC3,
+   //T[45]
+   0xEF74F723, 0x94DC664C, 0xCBBAFF21, 0x7BC91861,
+   0x1AE6DFC8, 0x2690C784, 0xDF65AE68, 0x4DF56FBC,
+   0xA3730712, 0xDCB40A65, 0xB51D6A88, 0x2827BF67,
+   0x83DFAC3C, 0xD7ACB374, 0xC9C0488C, 0x45B47C9C,
+   0x0913903C, 0x5C9BAC55, 0x669F2BC7, 0xBA001680,
+   0x187805AE, 0xED4E6D4E, 0x98EABBC9, 0xCA2E18BD,
+   //T[46]
+   0xB59F7464, 0x1CB12191, 0x11E1ED1E, 0xC1AF45EF,
+   0xB2BE31E0, 0x1F6572BC, 0x778C4BB1, 0xB5421ECE,
+   0xB9AAC9FF, 0x559986D9, 0xC6802365, 0x6D0B354E,
+   0x0AA2D847, 0x231D3239, 0xF186C861, 0x054A9A12,
+   0xAA7CF18D, 0x01BC8E70, 0x8F470162, 0xC8A58BDD,
+   0xF42108DB, 0x96F5C7AB, 0x95A5760A, 0x1D880FC4,
+   //T[47]
+   0x9DE8A87C, 0x2FDCB313, 0x5A427D95, 0x5B930738,
+   0x5B8CD3F8, 0xA2B8E9AA, 0xC983DFC7, 0xEB1C24AB,
+   0x88113586, 0xFB9FD3CE, 0x85121157, 0x66C8E652,
+   0x84A0210F, 0xD83BE656, 0x9535D285, 0x59034061,
+   0x84061F0E, 0x18CAF847, 0x60314751, 0xBAB7A9A8,
+   0xE22CD7BE, 0x93A603C9, 0x52B5E890, 0x1EEA6997,
+   //T[48]
+   0x522A423F, 0x495175CD, 0x04E53690, 0xEFC6442B,
+   0x1316EE5C, 0x30B58307, 0xA2C65976, 0xC6D30519,
+   0x16A88BB6, 0xD6EAB709, 0xAF14EE70, 0xEFD0FDB5,
+   0x71CA7C18, 0x75666E3E, 0x3F0E31BE, 0x7FC491E5,
+   0x3EC23D8E, 0x2B583795, 0x03021F01, 0x66EEEFF3,
+   0xFC1A5B28, 0x24E8CD38, 0x85425712, 0x716821C6,
+   //T[49]
+   0x7852A8B0, 0xE5B1A0D5, 0xD0FF8140, 0xD2E22EC0,
+   0x75476490, 0x0DA6B7A8, 0xDA4A513C, 0x53120134,
+   0xAFF54C16, 0x78FBB953, 0xE2A40FAA, 0x3BD530A3,
+   0x087F83D8, 0xA46D2742, 0x7CE1BC46, 0xC47F329C,
+   0xCA917D28, 0x68C4944F, 0xEE1C8C08, 0xE0D8B028,
+   0x20DBF9BE, 0xED86ABE0, 0x7AAE428A, 0xD8B9040A,
+   //T[50]
+   0x664AA28D, 0xC0E60AB1, 0x9D940C86, 0xCEB2995E,
+   0xCA4003AD, 0x5530B3B2, 0x27487874, 0x42E21E34,
+   0xAC5B72AE, 0x82E36DC1, 0xCB46AB57, 0x0B4B5EEA,
+   0x4EAD08FC, 0x522A9F51, 0x4C7D5C68, 0x02DDCFD6,
+   0xE02676D8, 0x7CD9108B, 0x4E23A730, 0x1742D25F,
+   0xECA4E5D1, 0x28342177, 0xEA65145C, 0x2FC3854A,
+   //T[51]
+   0x193F489A, 0x253E8C05, 0x188E2307, 0x24BDF941,
+   0xD2A64C9B, 0xA6CCFB9B, 0x1A71A7E6, 0x26E0868D,
+   0x1D99DFE4, 0x89A2A4FD, 0x12095CF4, 0xA012E8CB,
+   0x1BD5EE20, 0x425A5C1B, 0x212C5B5B, 0x429411F5,
+   0x7D1A996E, 0x100FB60F, 0xED4E5B27, 0xD429D128,
+   0xCDA181A2, 0x1261F141, 0x94C8B1BB, 0x763ABFC4,
+   //T[52]
+   0x2740D819, 0x657E1573, 0x7E53BBF6, 0xD4C8400F,
+   0x731937EA, 0x045E5AEF, 0x492B739C, 0x5C97AC7E,
+   0x1EC3B215, 0x21D2E70E, 0xDDD6088A, 0x3ED621AC,
+   0x6DBE26A9, 0x3F38F26D, 0xA7316C08, 0x893A5049,
+   0xF5C699C3, 0x5A30C2D2, 0x8BF6E42A, 0xB2E9978B,
+   0x0DB721DD, 0x0B5415FC, 0xA41C8365, 0xF29D6BCD,
+   //T[53]
+   0x21228AB2, 0xFAF24E1D, 0xE1452DF2, 0x78DEBE84,
+   0x9E7F135A, 0xBEF7D924, 0xE7F8D0E0, 0x149F1F4A,
+   0x2762544E, 0x128B813D, 0x9C390A58, 0xEBDA14BF,
+   0x2D14FE1B, 0xF4C4561F, 0xB3F24F5E, 0xAE8CFC1C,
+   0x9B76389A, 0x68E81B1E, 0x5E63E131, 0x8F9DDD40,
+   0x734115CD, 0x3FDF4533, 0x2D23CAFE, 0xF2B4AF6D,
+   //T[54]
+   0x484CE8D6, 0x9369AAE4, 0xFC277A27, 0x7B1A9637,
+   0xA530E76F, 0x5C4613CF, 0x74AFD88C, 0x84564D23,
+   0x14443D32, 0xF083971B, 0x5FD747FA, 0xF73898FD,
+   0x366473A3, 0x15C17BFD, 0xD2325DEA, 0x2D899447,
+   0xAC30E951, 0x0465C806, 0x1BB96CFA, 0x534961F7,
+   0x4332FFD7, 0xB1A6DA80, 0x0104F8AC, 0x21CE3595,
+   //T[55]
+   0x241F665B, 0x81A55FA1, 0x64634B7E, 0xA0EA6092,
+   0xEB475504, 0xD0C389C4, 0x8D1E0203, 0x2CD1C98F,
+   0x84A47688, 0xF359AFAB, 0x7A41C64C, 0x59BCD346,
+   0xE64BC28E, 0x3AA100E8, 0xD156E143, 0x6E9EEA3F,
+   0xC8C5471F, 0x9C5A311D, 0xE8940BF8, 0xF0E607EB,
+   0xC47A8F0B, 0x4CDD06D1, 0xCD527795, 0x5106CAA8,
+   //T[56]
+   0x0D46066D, 0xACD8E251, 0x6F1D5714, 0xA6CDA079,
+   0xCA36FBDF, 0x419EF5AD, 0x9E1D7A6F, 0xDC48951D,
+   0xB7A52681, 0xC6C22C15, 0xAA724286, 0xB6C9DC11,
+   0xA7646C3F, 0xD4AB3C62, 0xD8446A48, 0x80A8C060,
+   0x12587682, 0x46893C57, 0xCE834F82, 0x2CD0B8CB,
+   0xB004849A, 0xDFFAEBAD, 0x41C3A434, 0x3E654E44,
+   //T[57]
+   0xB0E01600, 0x7765EBE9, 0x25C62AFC, 0x1492AC19,
+   0x16DB2DB3, 0xF914062A, 0xF9417106, 0x2C552735,
+   0x945F1DCA, 0x675B4089, 0x9590219D, 0x1CB8DFE5,
+   0x41FAB175, 0xCEF9BDCA, 0xE236B88D, 0x349AA2D4,
+   0x466B69D0, 0x07AAEAB6, 0xC27DD5D2, 0xB899491C,
+   0x5099C372, 0x81F42547, 0x510EF1A2, 0x5D60F35E,
+   //T[58]
+   0x1CA916B6, 0xC12065E7, 0xF8325358, 0x2CBDA6C0,
+   0x57E6F0B7, 0x6F26CC31, 0x1C54E327, 0xBC17D334,
+   0xFBEDAEF5, 0x9F1EE7CD, 0x341C165A, 0xB61F0040,
+   0xC200326A, 0x091A3BD4, 0x8F99E034, 0x44164A0C,
+   0x1B187383, 0x622994D4, 0xB12DA429, 0x6732749D,
+   0x0CB1F4BF, 0x668B6237, 0xE2DAFFC9, 0x42B6A335,
+   //T[59]
+   0x4BFB949B, 0x34C95B84, 0x2F8BAC59, 0x4A1156C0,
+   0x95F2A511, 0xBFB266EB, 0x528F0A1D, 0x333C1450,
+   0x361D12B2, 0xC23DC688, 0x3BC7FA44, 0x6575994A,
+   0xC2CCE9ED, 0xC45D8DB0, 0xDED49C21, 0x14D197FE,
+   0xB2C46C12, 0x56C11EB8, 0x8ADD12FC, 0x6B7F9371,
+   0x3B5BD8E4, 0xC3C27C16, 0x40D43DF2, 0xAD81EE03,
+   //T[60]
+   0x65994991, 0xEF16EDC5, 0xF39A4279, 0x2B6F4EA7,
+   0xC07E0A7B, 0x55074ED7, 0x69317AD6, 0x3415B9A6,
+   0xA472E0A8, 0x0CF8B93F, 0x8532752B, 0x1237DEA2,
+   0xCF0DC0BC, 0xF4A44125, 0x48B2FC9B, 0x4B8385C3,
+   0x580BBE2B, 0x629A7A2D, 0x1881F3C5, 0x2C4F741B,
+   0x0AA343E2, 0x1EA38B16, 0x7B81184A, 0x7735A28D,
+   //T[61]
+   0xEBC7A05A, 0xEDFA66B6, 0xD005432C, 0xE12F0B82,
+   0x9051E2A6, 0xEFBC796E, 0x1A964862, 0xC6658E67,
+   0x2D6041D1, 0xC2B42159, 0x557CCA45, 0xC0F39509,
+   0x9509F4CE, 0x42486F73, 0xD60FB23C, 0xFA10BA0D,
+   0x22D97E5C, 0xF55A55A9, 0x8D750955, 0x8EF47B07,
+   0x3F540AA1, 0x1E61B410, 0xC56B7257, 0xFA6F0EB0,
+   //T[62]
+   0x2C3FC486, 0x03995FE7, 0xB6B72BF0, 0xFF565AAD,
+   0x48A40004, 0xBFBAE8C8, 0x13B5A1E8, 0x9C99CD5A,
+   0xFCAD95B0, 0xFEE77EE2, 0x34D16B96, 0x0B635399,
+   0x5D778A19, 0x2801AB2B, 0xD5D0854E, 0x604D8349,
+   0x3091C681, 0x7AAF003B, 0x0761AE3A, 0xC9E2B6E1,
+   0xFE414395, 0xA5F0B69B, 0xADAE97B4, 0x419E8889
+};
+
+#elif (SECP384R1_COMB_WIDTH == 8)
+
+//Comb table (8 teeth, 48 columns)
+const uint32_t ecNistP384Comb[] =
+{
+   //T[0]
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D,
+   0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE,
+   0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   //T[1]
+   0xF47168AC, 0x9112E340, 0x90080705, 0x3917D3A0,
+   0xCC7FDEDF, 0xB6971DA1, 0x8512E48A, 0xCBD8AA25,
+   0xA7F6297E, 0x804100CA, 0x433EB6A3, 0xF19C3F9B,
+   0x2D8B523F, 0x45E0B176, 0x39D2CF6C, 0x1B7078CB,
+   0xEE4928BE, 0xAF40B68B, 0x5A620149, 0x65D24D48,
+   0x5D389045, 0x4A1E9B51, 0xF610090C, 0xAE61A171,
+   //T[2]
+   0xA4F9DA5D, 0xDD532F82, 0xDBFFE31B, 0xCAB1A034,
+   0xCBB228C4, 0x822D3804, 0x93607E1D, 0x7B311CC2,
+   0x33115AAB, 0x4C214D44, 0x57D5BEA2, 0x854C83A7,
+   0xA88301C7, 0xA5F239E6, 0xA2C15340, 0x2B5F5248,
+   0x96722106, 0x63E2943E, 0xE43FB294, 0xA93985DD,
+   0x4D4CF01A, 0x9F200101, 0xE7F01D7E, 0x9FC93CDD,
+   //T[3]
+   0xD8EE21C9, 0x39C1B328, 0x558717DB, 0x2C3E0C91,
+   0x3F8686A9, 0x4B58808B, 0x18141B1A, 0x43603909,
+   0x37CA7ABC, 0xD6E98B0D, 0x060CBD1B, 0xF532389A,
+   0x23D86ECD, 0x7A7E1839, 0x085A4E9A, 0x31EA31B1,
+   0xBE643603, 0xBC40CE5A, 0xA2124163, 0xBD22CFB2,
+   0xDE3A82BA, 0x6F04CAA2, 0xC3B38E69, 0xB9D2852C,
+   //T[4]
+   0xEB09A0E5, 0x264E5246, 0x32CDF03C, 0xF8F4BE11,
+   0x5FAEFA4F, 0xDA9D5483, 0x17A31B22, 0xBBBC4FD0,
+   0x86F06145, 0xC3DECD0C, 0x0A5F2CAB, 0x528EF167,
+   0xC14F0DD6, 0x8A1E9858, 0x09CB7524, 0x550538A8,
+   0xC87FED22, 0xBD60CAB4, 0x631D058D, 0xF8B76FDD,
+   0x1A1DCF14, 0x5803EAA1, 0x7BCCF56C, 0x7B9B1FBE,
+   //T[5]
+   0x7FC65A81, 0x288270B8, 0xFAF3AD47, 0xE7BE86DF,
+   0x56ECB8A2, 0x206C3785, 0xE6DC2671, 0x20E187A1,
+   0x17E13AC2, 0xE1B7AD71, 0x6E84CAC0, 0x299A1A43,
+   0x1E61F5FF, 0xA3594E66, 0xDD73249C, 0x371C2FE2,
+   0xD2136FAB, 0xCF28D74B, 0xD17F0FEF, 0xEAE41AA2,
+   0x749A9D88, 0x94CDCBC4, 0x9A53B06F, 0xDB68722A,
+   //T[6]
+   0x180F0E61, 0x2EEF6F99, 0x53FCE850, 0x5B3F1248,
+   0xC8522BEA, 0xA065DF4F, 0x5AD8EEA6, 0x6D9D85FC,
+   0xACC507AB, 0x61FD71BF, 0x88054BC0, 0x464BC1A2,
+   0xC18BADE3, 0x7A1F67CF, 0xBE98CB6F, 0x5D8CED4C,
+   0x9E5580DA, 0xDD7CC0B7, 0xE90A11A4, 0x040B2DD2,
+   0xEE488256, 0xDEE0742E, 0xAA78B62A, 0xA7036006,
+   //T[7]
+   0x2805E596, 0x6F5E0F5D, 0x26281050, 0x89BBA01D,
+   0xEE0D124B, 0x712E1253, 0xBADC49FB, 0xD214B583,
+   0xAAF0C000, 0x049F9294, 0x6AC2C3EF, 0x4E5A9DFE,
+   0x91013E25, 0x965622C6, 0xCED6E714, 0x4B8F321B,
+   0x0051E057, 0xB5A0603D, 0x7A5E5A25, 0x81A2B658,
+   0x306B5712, 0x7BDD7FA6, 0xF6ACF171, 0x526F1B07,
+   //T[8]
+   0x2001CBFB, 0xB8C6A72A, 0x663A0017, 0x8047729C,
+   0xA97345E6, 0xC348E17B, 0x3B62B60A, 0x523F8B78,
+   0xAEBFF94D, 0x011E7DE3, 0x17EC68FA, 0x4ACFF10D,
+   0x9175CCE7, 0xEE21AAE1, 0x2A5EC79A, 0xDD48D1E4,
+   0xB317612F, 0xC73B8C39, 0x10CFA170, 0x1D9AB63F,
+   0x232976C9, 0x51650E00, 0xD38144FB, 0xE3FC1C71,
+   //T[9]
+   0x88F05154, 0x9BFF5ECE, 0x62091C2C, 0xB008BE4F,
+   0xFC1B7102, 0xBC5CD1B4, 0xBF37E0C6, 0x1EADFDA0,
+   0xE912EB0E, 0x1C4A42AA, 0xE7884FCF, 0xAEF19FB9,
+   0x5B94E7AF, 0xB8127642, 0x98102462, 0xE591A2A3,
+   0x34E2FA7A, 0xCA4D2B58, 0xE9413A45, 0xFE84FC47,
+   0x22783CD6, 0x78149958, 0x9BB5532F, 0x23D1ED95,
+   //T[10]
+   0x789BFE04, 0xBAD1AD60, 0x38DCD616, 0x868B425F,
+   0xE6E8A8F4, 0xD3DB92BB, 0x4D2FCA81, 0xC8C32F56,
+   0xAA55D49A, 0xC20A1610, 0x46A8F8A7, 0x5F2767D7,
+   0xBFF914BD, 0xE237FD0C, 0x1C2A3C5B, 0x94D59087,
+   0x44024DEC, 0x6A4BEC2C, 0x7A08EC59, 0x80D40DFD,
+   0x7DD15726, 0x948173FF, 0x9E6B6468, 0x60421020,
+   //T[11]
+   0x6425E05E, 0xB90FF620, 0x5A8DF77C, 0xF64734A5,
+   0x9A836CAB, 0xE7859963, 0xB45F44F1, 0xA598BE11,
+   0x1CEDE56C, 0xB77D8A95, 0x17C86DDF, 0x5D5E6018,
+   0xE61655CF, 0x93D48A46, 0x6689570B, 0x4EDEDA30,
+   0x59106588, 0xAED74736, 0x4A529A69, 0x45D07EAB,
+   0x9ABD4CC8, 0x23D59F9A, 0x1B172341, 0xBD8BD547,
+   //T[12]
+   0xDD453AC1, 0x20424D2D, 0xE1680D3A, 0xD77566DC,
+   0xA2ED3037, 0xB3E4BA90, 0x2E792269, 0x26A4AA75,
+   0x3CF8622C, 0x515739D3, 0x780EC85D, 0x357F2608,
+   0x1C7D73CA, 0x275EA888, 0x5814EA4E, 0xC0BB6105,
+   0x6B4E31EC, 0x08C56127, 0x60ABE2A1, 0x8613C3FA,
+   0x683F938A, 0x80A92215, 0x70AD914E, 0xE031183A,
+   //T[13]
+   0x3DD9A6B1, 0x3093D0B1, 0xBA19FEB5, 0x5DC73A27,
+   0x98F0A26E, 0xCDA782A1, 0xEF954B48, 0x1918C360,
+   0x971F17B0, 0xEE22A3C6, 0x8FA40F53, 0x3EB54F59,
+   0x65DB2DE4, 0x9DBE6262, 0xB67B59C0, 0x377F070B,
+   0x6639E248, 0x40F26930, 0x2DFC4E0C, 0x3AAF66B0,
+   0x75A58AF5, 0x98AB7CD5, 0x6CC84F3A, 0x98EA8221,
+   //T[14]
+   0x1AF59D55, 0xD9318079, 0xF67D0A09, 0x8BB612D0,
+   0x0A773C61, 0xEB20AEE0, 0x37284A60, 0xCAE3FD93,
+   0x945FBCBD, 0x88D8B3E9, 0x5818B755, 0x537C215F,
+   0xB118C153, 0xE1116FC3, 0x238E4AF8, 0xE539D592,
+   0x3AC58C36, 0xD6A94933, 0xCD5BA7AB, 0xFC7EF3F9,
+   0xB32C44AD, 0x18D99421, 0x82C45E6A, 0x38674C3A,
+   //T[15]
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458,
+   0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D,
+   0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   //T[16]
+   0xAA133909, 0x30991560, 0xC6CB0017, 0x9097DBB1,
+   0xB860FAE6, 0xD37DE424, 0x70B375DD, 0x9BB183B2,
+   0xCD6CE3A3, 0x567A6233, 0x0FDC3088, 0xAAB8BB9F,
+   0x600AD5A6, 0x16C5B981, 0xD62FAA44, 0xEBDF73F2,
+   0xC9747BF3, 0x6D955BB3, 0x15EB04AC, 0xF6005FC8,
+   0x282050B5, 0xF0AF01D1, 0x314F6D28, 0x48942F81,
+   //T[17]
+   0xC333DF7B, 0x732804AD, 0x3BE0AEDB, 0x9B74D7FB,
+   0xEC0B3333, 0x118BC6CB, 0x54E122C9, 0xBDDDC662,
+   0x825085E5, 0x0C6877F7, 0x7CC74B17, 0xD460C19E,
+   0x663A1446, 0x5639BB11, 0x9748A874, 0x3ECBC433,
+   0xA3315588, 0x4E1B2C45, 0xB49722C5, 0x82BAAD14,
+   0xA4B6B956, 0x0B0FD92D, 0xC764DE87, 0x1CA095E1,
+   //T[18]
+   0x609A737D, 0xD53ACCA0, 0x0149A95D, 0x0FA58299,
+   0x7CB8A2A1, 0x52282814, 0x32D8F4BE, 0xA51AB9C7,
+   0x39AE8D9A, 0x69BDF8B9, 0x01697947, 0x29AF55B2,
+   0x0DEA9FA3, 0x49D27640, 0x6A2D2D02, 0xC6F63C5D,
+   0xA33E028F, 0x84919F68, 0xA54A8F77, 0x51884451,
+   0x2CAE25AE, 0x31FB1B77, 0x356CEE37, 0x0F7B72B4,
+   //T[19]
+   0x7716605E, 0x20221121, 0x9EF281C8, 0x2347D2C8,
+   0x567D6342, 0x54BA4599, 0x77C0F03F, 0xCE0FBA30,
+   0xCB367444, 0x7022F802, 0xA9A6A052, 0x7334A936,
+   0xD658A01A, 0xB5461F68, 0xC2BD0EFA, 0x0A64D519,
+   0x697A9280, 0x9E2EEE8F, 0x7D0E017A, 0x8E5D9B89,
+   0x7CBD4CCD, 0x1F7C5C36, 0xF632C926, 0x7FFCEFF7,
+   //T[20]
+   0x0E758344, 0x300AE2E6, 0x371A2CA5, 0x451C707A,
+   0x5052DD32, 0x25651D10, 0x4862B954, 0xBF88DE7F,
+   0x0381EF13, 0xFAFCE26E, 0x960E090E, 0xDC916C17,
+   0x026B0889, 0xED17CC44, 0x9B42441B, 0x95C01FF1,
+   0xCC160697, 0x40896478, 0x0BA04A35, 0x52D154B8,
+   0x701C2952, 0xB3D92EA4, 0xD69ECA0A, 0x266E8A40,
+   //T[21]
+   0x859BDD52, 0x743770D8, 0x4575B8B4, 0x1DFEE5E9,
+   0x584E03ED, 0xF2F9F865, 0xA38B25D4, 0x7ECD812D,
+   0xB3A873C2, 0xD56AC147, 0x86CE0192, 0xFE6256B7,
+   0x6F4546EB, 0xB0C5E39C, 0x841A7FF9, 0x8F6F1C41,
+   0x27901131, 0xBE5D1732, 0xC07958FB, 0x73587764,
+   0x4FDA4260, 0x96F3FBBD, 0xF1BCA91A, 0x3D963FC5,
+   //T[22]
+   0x2C490E39, 0x355C723F, 0x2BBDFB24, 0xBE91CC2A,
+   0x02E3AE06, 0x40D76861, 0x63EB47A0, 0x7B79689C,
+   0x414BF477, 0x81D7A78F, 0x3418345B, 0x107C8062,
+   0x0AC1D593, 0x19DAD947, 0xE86C8D56, 0x862DF5A3,
+   0x4094D23A, 0x0803717C, 0xC026B6CC, 0x0D773203,
+   0x4D164FE7, 0x3C995003, 0x16742CAF, 0x5F491CF6,
+   //T[23]
+   0x4A6DC81B, 0xE3B5957E, 0x2E995780, 0x4AD7A359,
+   0xACF46E9C, 0x15FF98E7, 0xA010367C, 0x708934FA,
+   0x6847CB27, 0xF65CD57B, 0x659D4F3A, 0x17DC49E5,
+   0xF76651D0, 0x04AA9640, 0xCA653E13, 0x9D514B5F,
+   0x0AE78AF8, 0x3B267FA8, 0xB86D9D88, 0x5A6369F5,
+   0x3A3DF793, 0xCA5226E7, 0xAF9179D9, 0xC440965B,
+   //T[24]
+   0x653E9641, 0x43B9D4A6, 0xE3117020, 0xA7F73211,
+   0xF2B7461D, 0x3CB41C8A, 0xE997290D, 0x727FEDB6,
+   0xD267382D, 0x9DC41B93, 0x2A17D250, 0xC09AB1E6,
+   0xB9F8CFC7, 0x6A40FCC8, 0x0E7FB543, 0x7790F956,
+   0x77CC809C, 0x7A2C5BDB, 0x66813393, 0x57501733,
+   0x6F4E4D70, 0xC92F4DB2, 0x3A1C9FDD, 0xAD6EE7C0,
+   //T[25]
+   0xFBB19E7B, 0xB5F03036, 0x60A3F290, 0x8079F0C0,
+   0xC14CB566, 0x65B93829, 0xFC853D80, 0x95D8BBBD,
+   0x4B773B72, 0xE00BC8F7, 0x8F51B43F, 0xDAE1B4F0,
+   0xFC97CDE5, 0x41AC4CED, 0xB803782D, 0x059B3928,
+   0x01FFE96C, 0x248D0565, 0x840463DB, 0x851C1235,
+   0xDDFDCBAA, 0x61B8C734, 0x25041E60, 0xDA59E1FD,
+   //T[26]
+   0x297DE36B, 0x86494AF3, 0xC4ACA206, 0x1F42E0DF,
+   0x3CDFA8FA, 0xC8469943, 0xEE55A20B, 0xBDF182F5,
+   0x1A88B42A, 0xEB1DC97D, 0xF53999E3, 0x1127A7F3,
+   0xBE01D7C7, 0xE0B0B126, 0xE3769B30, 0xE3DD4DFB,
+   0x21C75FE3, 0xCC2C53FE, 0xA0AE80B4, 0xCEE0CA03,
+   0xF744B5B3, 0x8838E9B3, 0x5F629127, 0xFD66E039,
+   //T[27]
+   0xF6CE3D25, 0xD1C0385F, 0xD3ACDE6C, 0x19DD1075,
+   0x3B4514FF, 0xBD73FE40, 0x80E1C78E, 0xAC1B3522,
+   0xEC8ECBE1, 0x7C8379A4, 0xB6B724F4, 0xA46A8907,
+   0x7461EF8E, 0x0E48C315, 0x0629D2FE, 0x89111927,
+   0xC4F8AE56, 0x515AC4BA, 0xAC60F398, 0xCF291FEF,
+   0x80F088C1, 0x4BCE4131, 0xE252445B, 0xCEF56F56,
+   //T[28]
+   0x39E28A36, 0xD37E4769, 0xBF0F15A6, 0xBB4ECE91,
+   0x376844FA, 0x9C504999, 0x6C2D2B76, 0x01276596,
+   0x7DE496C3, 0x3D2AB8F1, 0xD7831B00, 0x08C10B56,
+   0x4A457447, 0xA7700F6A, 0x170F8D4C, 0x76B79CF1,
+   0xBF58B45F, 0x5548A52A, 0x11405570, 0x0505DC22,
+   0x3823EFC1, 0xBD07E67B, 0x9EE7FC66, 0xF018C6E7,
+   //T[29]
+   0x6623D2E1, 0xD5ABEC26, 0xAF337E4A, 0xAB292FDA,
+   0x9160B9AA, 0xDB65C066, 0x0615270E, 0x5FE4A922,
+   0x2EE19BF8, 0xD131907C, 0xBB04891C, 0x6E3B2974,
+   0x9BA4AB32, 0x3711B9C1, 0x71CCB283, 0xC64477BA,
+   0x1A743666, 0x3D2F90CF, 0x272D34C8, 0x69D5AD81,
+   0xB54501BD, 0x2BEEDF54, 0x262B61F1, 0xF9A5CB00,
+   //T[30]
+   0x0F5D6D80, 0x9AA533DD, 0xFADB7C68, 0xBD1A10FB,
+   0x4C2EF988, 0x9F9C9922, 0x94D847D8, 0x390F92F1,
+   0x5D396B66, 0xA275B5BE, 0xD328175F, 0xD82ECDA1,
+   0x0AE91606, 0x52F5C407, 0xC857FB19, 0x7C87A72C,
+   0x36172B8E, 0xB126DD7D, 0x5B58CF3C, 0x034A9207,
+   0x28518132, 0xCD60F05B, 0x32D0BEF2, 0xAEC90CD1,
+   //T[31]
+   0xA213E83B, 0xB3DE52C7, 0x55DB2392, 0x464A92D0,
+   0xA76F70C9, 0x0F54907F, 0x455C1C82, 0xF03811A5,
+   0xA71BFEBC, 0xDBC082AB, 0x8EDFFA7F, 0xC6B40528,
+   0xE3636016, 0xC07BB07D, 0x4C00333A, 0x12B29E9A,
+   0x53EEC121, 0x888E1907, 0x640707C9, 0x64ACC0D1,
+   0x03519FA1, 0xB78CA0FF, 0xC6C4EAFB, 0x5C88FB72,
+   //T[32]
+   0xFF78EB3D, 0xBBA596A9, 0xF23E1F6E, 0xF7EFDBA2,
+   0x9F76A7CD, 0x344245BC, 0xA82EFC52, 0x164D31D9,
+   0xA1E8A414, 0x18A5FA6C, 0xE8BAECCD, 0xFD8847E7,
+   0xA39CF01C, 0xBC3BB802, 0x5E8DF42D, 0x0EE46A56,
+   0x7548332F, 0x89A20960, 0x23344047, 0xF696C219,
+   0x404EA9C6, 0x39475C71, 0x73B49952, 0x859B9528,
+   //T[33]
+   0xF75508FC, 0x58BD2B8E, 0x62BFD0C5, 0xA91BF292,
+   0x142AB328, 0x88D90E30, 0x632C89CF, 0x729F12B6,
+   0x212D6788, 0xC8927502, 0x29154DC6, 0xE5003A3F,
+   0x25010799, 0x0C909533, 0x2BB5FF4B, 0xE70C8D42,
+   0x76AA7B5F, 0x1C1A2A35, 0xA1C6F02E, 0x38569944,
+   0xBC0AB45F, 0xB580CE6A, 0x83C9D7AB, 0x64AA8AE3,
+   //T[34]
+   0xA3BF6550, 0x29525785, 0x6F36773E, 0x7F591380,
+   0x97F84DC8, 0x464B8BC6, 0x3AFA604B, 0xE59A2771,
+   0x6CCDA638, 0x58430BF2, 0x8647BAAB, 0xFAF60516,
+   0x3DCB8D5E, 0x33008519, 0x151D7C9F, 0x58114B30,
+   0x70066F66, 0xB8F343AE, 0x5B8BCF00, 0xA106B27B,
+   0x36785D57, 0x615566F5, 0x82A744F4, 0xA6B63021,
+   //T[35]
+   0xB34E237A, 0x83A43EAD, 0x39DB7D8A, 0xDC64C8C7,
+   0x371F7338, 0x08C115AA, 0xB46F7E23, 0x6899B7FD,
+   0x3101BD48, 0xFD84DA7B, 0x9366FF9F, 0x9479021C,
+   0x3EF19C4E, 0xBD7208C8, 0x16C7B95B, 0x9E279F6B,
+   0xD74C1CC3, 0x5AC90015, 0x23A781C3, 0x9F121520,
+   0x69149AF2, 0xB602B2B5, 0x3DB935D8, 0x835CB548,
+   //T[36]
+   0x224558C2, 0x4939E33D, 0xBDE3E926, 0x12B4D626,
+   0x7BE88B3B, 0xD79EBC42, 0xC50E2B22, 0x9A8BF17C,
+   0x9223312D, 0x6EC62203, 0xC20AD37F, 0x1206EFD8,
+   0x53656B39, 0x0180C53A, 0xD7323C12, 0x7FBE0CB0,
+   0x29AEC913, 0x7C5607F0, 0x419FDBEF, 0x5030F78C,
+   0xEEA95F4B, 0x6C618260, 0xCDD2AD01, 0xE3D5175F,
+   //T[37]
+   0x2763EDCD, 0x2FE393AA, 0x8EA82001, 0x7A320066,
+   0x1E2A8FAC, 0xC489F7C1, 0xE3CB40B0, 0xE197D0DD,
+   0x3074261A, 0x096A3427, 0xB1C240CA, 0xCD059902,
+   0x52C4F149, 0x6A7CE88F, 0x6D9641EB, 0xE6C26CBB,
+   0x226D3470, 0x08D07F51, 0xD48F1853, 0xDF9FD425,
+   0x29E26673, 0xF88219F0, 0xCBAE3667, 0xD3E5B9E3,
+   //T[38]
+   0x903FB6D9, 0x48E87E9F, 0xE942CC6E, 0x140E77E7,
+   0xF6365CEC, 0x06B43646, 0x502010A1, 0xCA1953AF,
+   0x80135660, 0x93AB4D4A, 0xAA0DB67F, 0x683FF258,
+   0x046D218B, 0xF5BB338E, 0x983A34CB, 0xE8E51780,
+   0x92EC438E, 0xC0F7A0DA, 0xB54C22DE, 0xFE2D0BD6,
+   0xC7A43026, 0xDF23CD46, 0xAAD11030, 0x1F06B6FB,
+   //T[39]
+   0x7C41CEC4, 0x586F396E, 0xBDB3029A, 0x6273CF56,
+   0xDC28F3FF, 0x3E31B2FF, 0xADCBFAFC, 0x2084E14D,
+   0xD40A9A63, 0xF39AA51A, 0x8307E1DF, 0xD1AF4382,
+   0xD1474980, 0xF4285854, 0x7BD30CBF, 0x6F9CB3BE,
+   0xBDB54EEB, 0x69EFED16, 0x4202560E, 0xB6456F62,
+   0xF8181994, 0x726EA875, 0x83587BC3, 0xA922C450,
+   //T[40]
+   0x0DDBB25F, 0x52C611C8, 0xEC96151B, 0xDED14163,
+   0x89CE8BCD, 0xCED393C9, 0x043AEF33, 0xCC85985E,
+   0x229D5AA9, 0xF8273F4D, 0x46D65210, 0x1904F224,
+   0x232C2604, 0x95BFE95A, 0x0929D40E, 0x77AEDB15,
+   0x2C269E95, 0x97B5E6FF, 0xC5E76469, 0x52C83CC1,
+   0x619D3DC3, 0x05D9AD0E, 0xE43F79C2, 0xDD2EEBB7,
+   //T[41]
+   0x2360374B, 0x24082982, 0xBAE94084, 0x836895A7,
+   0x74A33F39, 0x8631B510, 0x4266B4FD, 0x8E09378B,
+   0x0FA51BE5, 0xE75930F9, 0xFD035E12, 0xA06EA7D1,
+   0x5CB6A429, 0x4F20AB1E, 0xCB96B0E9, 0x630C4118,
+   0x63EDBA69, 0xA862B089, 0xB2DC37CB, 0xA7A42760,
+   0x3877B186, 0x405292FE, 0x6DD6C396, 0xABC08ADC,
+   //T[42]
+   0xB1BF1E15, 0xC48F77EA, 0xEFA4A016, 0x7B0619C1,
+   0xF9DD2C03, 0xBDB38F74, 0xF1315C18, 0xF8E92FE1,
+   0xD3EBD197, 0x1E96E52F, 0x677C30FD, 0xCF6BD4F5,
+   0x93AA27CB, 0x426DB56D, 0x2CD7A6C6, 0x20A0B257,
+   0xC8062FCF, 0x6EB8CB5C, 0x219A6631, 0x80083D1A,
+   0xBB00BB81, 0xBD206E58, 0xAF269AE2, 0x21C7DB02,
+   //T[43]
+   0xA7F609B5, 0x7B74828D, 0xDC8019FA, 0xE9876D39,
+   0x8E53FC57, 0x8A756BC8, 0x5168D206, 0x882F516B,
+   0x2E6CAFAA, 0x9D8383AA, 0xB0479805, 0xF69765DF,
+   0x9EAF8451, 0xB59FEA75, 0x1CB6FF33, 0xFAE4A097,
+   0xBF5D453B, 0x32874EF3, 0x586C2F31, 0x7F7B6553,
+   0x1EF2B020, 0x3D6D439E, 0x76C93058, 0x83748F4E,
+   //T[44]
+   0xA9B4A5AA, 0x7DF93878, 0xBD289A6F, 0xBD8AEA68,
+   0x801E3655, 0x9B834985, 0xA688569C, 0x9EA8C064,
+   0xBC8D8180, 0x8FC76CD0, 0x228A5DB9, 0x0986167E,
+   0xEF51AA2F, 0x47E0F576, 0x760AD8EC, 0xFA34C8BF,
+   0xCF24E3AB, 0x3948E720, 0xF5204BA3, 0x2B26CD63,
+   0xAC2DEA8E, 0xDD23CD3E, 0x284A0BFF, 0x7F34F966,
+   //T[45]
+   0xBCA4F0AB, 0x09DCE0D7, 0xD9436691, 0xC12F474A,
+   0xC1AA7D7B, 0x3D4CDC4E, 0x600E7D5F, 0x3045D219,
+   0x21070613, 0xF9B5E1FA, 0xA9D3D6D9, 0x6CC88710,
+   0x201A8CBB, 0x957F0A2E, 0xC3F188C8, 0xE47CA5A5,
+   0x271E57E2, 0x1FC9E616, 0x4B23EFA9, 0x07059C8B,
+   0xDD0EE43A, 0xEFD15EB0, 0x2AA4DBD6, 0x532FE1DF,
+   //T[46]
+   0x2ECFC913, 0x0C95A375, 0xB9448208, 0xBF9ACEFC,
+   0xE5CA6921, 0x61F24947, 0x638B01C4, 0xA1D7D020,
+   0x67AF6E62, 0xFE033A41, 0xA08C48E6, 0x83CFCC60,
+   0xA44BE73D, 0x560B6167, 0xBF63AEFC, 0x8ECC1EEE,
+   0xDD944348, 0x475EC0A8, 0x89A3701E, 0xB57C2F15,
+   0x04762BDC, 0xEF16671F, 0x7573EA5D, 0xBBAB0BA5,
+   //T[47]
+   0xE3BB6F75, 0xD2A34D59, 0xB4BCCBA1, 0x650D7895,
+   0x29340803, 0xAC57AD31, 0x524F0F71, 0x53EC30E9,
+   0x81F4D91A, 0x26A5AA01, 0xF985EE33, 0xD431B813,
+   0x77EFE800, 0x2487547D, 0x24D12D6E, 0x0AB822B7,
+   0xDB0851E4, 0x7FCC74A8, 0x517BCD5F, 0x7AF6389A,
+   0xA48875AB, 0x10270D0B, 0x86AC8881, 0xB73246A6,
+   //T[48]
+   0x0C6A0A9D, 0x214972B2, 0x116888FE, 0x92B78FF3,
+   0xD315AFED, 0x29168551, 0x995B867A, 0x3BE67B9C,
+   0x5A46E7EB, 0x100C0759, 0xC79AEC3A, 0x107AA99D,
+   0xC0EEC2C5, 0x04773CF2, 0xD730ECFD, 0xE807E20A,
+   0x1F83C371, 0x3A97854E, 0x6FF927C2, 0x783C62EF,
+   0x9B80622C, 0x8EB973EB, 0x6167ED84, 0x756D5898,
+   //T[49]
+   0x931736F1, 0x332A70F6, 0x32DC5C3B, 0x71C353FB,
+   0x0F05866C, 0x1C9F8FA1, 0x7D7E098A, 0xFCA2EB79,
+   0x12921838, 0xC89D61D6, 0xC082978C, 0xDF196732,
+   0x2B00087D, 0xB1725201, 0x969BE3CB, 0xD1890C00,
+   0x12AAC140, 0xBEBCC690, 0x3633A9CA, 0xFFCEEEC5,
+   0x73D1464A, 0xF4180FDB, 0xF4D96B56, 0xAE81553C,
+   //T[50]
+   0x57B3D969, 0x13C04A3F, 0x33A4AC1F, 0xC4920A42,
+   0x78FF7677, 0x8D3B7102, 0x0EFA8FE8, 0x8BEB0AE3,
+   0x1D00F00B, 0x602DE72E, 0xA4E018CF, 0xD641A064,
+   0x2B1A10EC, 0xD49E998F, 0x84110F92, 0x8F726A2E,
+   0x604D0914, 0xEDCC07A2, 0x1DAC3610, 0x3EE5ECA1,
+   0xAD8EA8E1, 0x3F9FD774, 0x144F72AA, 0xFA2880DB,
+   //T[51]
+   0xAAE8DD2A, 0x1BEACA61, 0x28E4DF9C, 0xEC388CAA,
+   0xF45204B7, 0x9D5D63C8, 0x84088A32, 0xF9FD0833,
+   0xA83B8DC6, 0xB14B80BB, 0xDDD45D6E, 0xB0BF4858,
+   0x9D1CB71C, 0x311774D9, 0x6202B83B, 0xD1EA085A,
+   0x81084ADF, 0x0905DF5F, 0xD4C7D6FE, 0x3EBE7A73,
+   0xB13D5980, 0xB883E39B, 0x9B0BC9F0, 0xA184F44E,
+   //T[52]
+   0x5F45982D, 0x60553FE2, 0xC988C0BD, 0x42D36C45,
+   0xE197BE50, 0x4E1DD16F, 0x70F6DE8A, 0xAA620BF5,
+   0xB45FCEBD, 0x39B4C624, 0x8511B56E, 0x9DF6EC80,
+   0x2FBD3A52, 0x8614E8FD, 0x012ED431, 0x9126C81D,
+   0xF8B606AC, 0xAB7E6E6E, 0x97FAE356, 0x147207C9,
+   0xFF931386, 0x1B36E043, 0x3D6D21EC, 0xB637A0B7,
+   //T[53]
+   0xAA924D53, 0xEB7549C1, 0x943AD771, 0xE2E69608,
+   0x434703C1, 0x29D8EDE8, 0x0EC1ACF4, 0x3D1E3DF8,
+   0xA58BAD24, 0x6403A617, 0x4AC92015, 0x428AA1AC,
+   0xC38081B5, 0xDAAEF9F4, 0xB689B8E5, 0xE6535873,
+   0x0CA3F111, 0xA8BB2407, 0x4002D150, 0x1CB56716,
+   0x2F5A1359, 0xDCB9BC8E, 0x7AAF48F0, 0x91BC2FDA,
+   //T[54]
+   0x3D812C64, 0xEC618C56, 0xD081E43B, 0xF2E64A9E,
+   0xE10DED6B, 0x11984AD7, 0xD8E6F210, 0x928FFE7D,
+   0xEF6F87A7, 0x57692D35, 0x669D55BB, 0x86E4BDDB,
+   0x8C9445B6, 0xFAD1BA37, 0x6BB3F9D1, 0x606ECCD0,
+   0x10DE6844, 0x4D240F26, 0x9255B70D, 0x01C50095,
+   0x9BC071EE, 0x1898957A, 0x83920A36, 0xED7711EC,
+   //T[55]
+   0x986984B0, 0x1A3D990B, 0x490DF630, 0xDEA5B5E0,
+   0xEF208F5C, 0x4BCB59F6, 0xC34845FE, 0x5D09F4ED,
+   0xCB24EC55, 0xE374DEB2, 0xA4E4B350, 0xA8CFC2A8,
+   0xA01470BF, 0xDD058DD8, 0xC925A722, 0x037EA9EA,
+   0x8FFD9FB3, 0x529199D6, 0xDABC399A, 0x13EFC7F1,
+   0x6A6884DD, 0x2712E4F8, 0x466C155D, 0x429B1657,
+   //T[56]
+   0xB7EA740E, 0x8069A9F2, 0x003BB384, 0x3868F07F,
+   0x60E144EB, 0x82E771CD, 0x3E787D59, 0x89E7472E,
+   0xB9ECFEA8, 0x8926D44F, 0x12E41F53, 0x633BD6B6,
+   0x17202652, 0x69A6B531, 0xBFCD2BC4, 0x7A52EADD,
+   0x4CFA043A, 0xC66875EC, 0x8801CE06, 0x7F186007,
+   0x58B4B165, 0xDB6B0315, 0xAF528F1D, 0xA704845F,
+   //T[57]
+   0x05237783, 0x1D4F0DE8, 0x9CA70911, 0x39A3389A,
+   0x72CBBF5C, 0x2438FF3A, 0x28623728, 0xC063E128,
+   0x48595A6E, 0x2A2D9906, 0x56D3A957, 0xE8B0FE78,
+   0xEA841F24, 0xAF207371, 0xC8425DB1, 0x8254EDB7,
+   0x01BEA530, 0xAE896DCA, 0xBB5AD115, 0x1D4F37E1,
+   0xC64DF3CA, 0x236A0D6E, 0x908C08D5, 0x36744091,
+   //T[58]
+   0x96CF901B, 0x9B161C24, 0x8FD02498, 0xE348AEED,
+   0x845ABF51, 0xA1E42C56, 0x1B4344D5, 0x10626AF5,
+   0x94742619, 0xCAB55410, 0xC0F645E6, 0xF911D0FE,
+   0x53F231D8, 0x86D890C3, 0xD55833FB, 0x6596BF5A,
+   0x69E3412C, 0x4F827518, 0x4B23234B, 0x63121ECB,
+   0x998DE5F3, 0x802EDBA2, 0x2AAC7487, 0x0BF6DAAE,
+   //T[59]
+   0x7E486C45, 0x76389A2D, 0x5447337A, 0xDFDF55C4,
+   0x0E572D2C, 0x17FAA600, 0x1E94742A, 0xA070BA65,
+   0x5BCAA6A8, 0x4D07F82F, 0xE485D159, 0xA8A28FEE,
+   0x25E73E09, 0xAC58DCB8, 0xC272F379, 0xCD194474,
+   0x980E0B32, 0x28840655, 0x3487EF41, 0xB95B56CF,
+   0x971A1BB3, 0xE5CEC6A9, 0xFE35029A, 0xB082D30E,
+   //T[60]
+   0xC30F2C3B, 0x56CAF3C6, 0xCB6DACBC, 0x14A64E9B,
+   0xAE3AE9A7, 0xEE5ACE3B, 0x12BE12EF, 0x027D5D42,
+   0x8AD80C96, 0x9FCE0827, 0xEBB9F3DB, 0xD8396536,
+   0xD7BDCD07, 0xAA29E620, 0xBE5FC594, 0xDA528680,
+   0xE604F609, 0x5D18FE63, 0x4DE18783, 0x1BC2B868,
+   0x775A1AF9, 0x9A6663BA, 0xEE776DC2, 0x8A49B3F6,
+   //T[61]
+   0xBD2FBA92, 0xA2FCC5DB, 0x6767F637, 0xC4488143,
+   0x3E8BC978, 0x91E9C30A, 0x1E027E18, 0x7736E0D7,
+   0x5F10C791, 0x39301666, 0x03046685, 0x051729AD,
+   0xDFBF9509, 0x282A5A13, 0x1B0BA3D1, 0x1CCFE9A1,
+   0xE79F5245, 0x10AE52CE, 0x6048F244, 0x1B4886A2,
+   0x30676598, 0x86E92579, 0x85DE3760, 0xC3070323,
+   //T[62]
+   0xE0A4A5D1, 0x09358765, 0x7EF5B1BB, 0x179F451F,
+   0x3A06C0C6, 0x3B1443C9, 0x192C022B, 0x4E419758,
+   0xEC7FC94D, 0xB85955EB, 0x403CDDF6, 0x09A440E5,
+   0xA9A62C09, 0x5C3DE076, 0x44C7BE15, 0x7007F9C9,
+   0x1E0635A9, 0x3957052C, 0xC6B60B32, 0x372FC564,
+   0x81D019CB, 0x4B9A799A, 0x310D98C9, 0xDEF22ED5,
+   //T[63]
+   0x4905CA71, 0xE4BFC2C0, 0xD156F761, 0xF33A450A,
+   0xD08848C2, 0x3D8B29DB, 0xA2309686, 0x097DA395,
+   0x5F4972D7, 0x21190503, 0x17CBAA12, 0xB2D10558,
+   0x753EE324, 0xDDCEBB55, 0x6924666F, 0xE87AB07C,
+   0x4ECF1A68, 0x9B475D74, 0x2E6236C0, 0xF82BE8F5,
+   0x3CFD056B, 0x237C0DBA, 0xC3C6CBD2, 0x354CD872,
+   //T[64]
+   0x708D4CEE, 0x8D104D24, 0x819CF043, 0x197D6958,
+   0xF0712210, 0x47FC87FA, 0x5C201558, 0x103DF785,
+   0x611EF638, 0x30B0A9E8, 0xFDFEBFEC, 0x00B19AC8,
+   0xD201E03E, 0xD40E8D6F, 0x2228FF5F, 0xBB7C969C,
+   0x636164C5, 0x68810282, 0xE754220D, 0xCDBB3CD2,
+   0xE9F6EDC4, 0x1418FE25, 0x9EE36031, 0xA72F9105,
+   //T[65]
+   0x0D22ECC3, 0xDA08687F, 0xDA7302F2, 0x0804E024,
+   0xF4F9BB7F, 0x8FB62CFB, 0xF13FFF3C, 0xC472530F,
+   0xB73D6A75, 0x3C8440DA, 0x61B8C1DB, 0x3A4285D4,
+   0xF1DE5188, 0x4F92D809, 0x86CCF1EB, 0x737A334D,
+   0xEDBF7FBD, 0x18F33380, 0x32E35AA1, 0x52C6BD14,
+   0xE0076EDD, 0x1CB43797, 0xF6DC1312, 0x830E7438,
+   //T[66]
+   0xF48A287B, 0xC425A16B, 0x66FF2DA9, 0xB5BC2923,
+   0x138EF7F0, 0x0D2A16D7, 0xCA047342, 0xC3C8E3EA,
+   0x5C8F4E69, 0x345CD380, 0xD6109E13, 0x36F5E189,
+   0x6F355F40, 0x0FF01997, 0x1EF45466, 0xFDC5393B,
+   0x25611C09, 0xD511CD59, 0x0F585F41, 0x1031D5C0,
+   0x696C6CD6, 0xBFC50C76, 0x792FD20A, 0x54E31CE6,
+   //T[67]
+   0xB769737A, 0x64D2C273, 0x97D53FFD, 0x2CC02451,
+   0xE86C46BD, 0xC3B6AC4B, 0x685E926D, 0x17E9411F,
+   0x75203A36, 0x136DF36B, 0x8BF0B27E, 0x3F9561E0,
+   0x27E990A7, 0xDD6FF8D5, 0xF9867A60, 0xC34BE586,
+   0x8554E014, 0xEA088747, 0x6F52E4CB, 0xCFCED664,
+   0x412AB641, 0x4B1A5A20, 0x39629587, 0x0B06F006,
+   //T[68]
+   0x85651F82, 0x044C0DD2, 0x785D3EF7, 0x325C51E7,
+   0x88E95532, 0xB83A1861, 0x522C2931, 0x539F94AD,
+   0x8980F137, 0x15274E5B, 0xDF0F66D7, 0x9FD7B010,
+   0x4064E4C0, 0xE4A7B94A, 0x25D7D211, 0xD44EBA45,
+   0xBE8A04E3, 0x0A806B54, 0x149033DE, 0x929226BD,
+   0xC9739246, 0x795F6FA3, 0xB9260225, 0x321AA9A3,
+   //T[69]
+   0xF53451A9, 0xE28E2E82, 0x1F2FF8CB, 0x3FCF9C5A,
+   0x7BE3748E, 0x63A6685D, 0x3D8EC1F9, 0x8B439C8A,
+   0x54C77163, 0x61A2B35B, 0x225EBA3B, 0xFAF2E023,
+   0x1336AF56, 0x413D64F6, 0x5CBD17C6, 0x8FA20437,
+   0xE1BBF2B9, 0xE47818F3, 0x7B256E65, 0x1D05C078,
+   0x2EB825DD, 0xC921798A, 0xB93ECB3D, 0x8B2321D9,
+   //T[70]
+   0xABE9FC47, 0xB7E3D11C, 0xA3620342, 0x40C76B8A,
+   0xDA2A359E, 0x5A372EC9, 0xF7D33D57, 0xE6274597,
+   0x1190348F, 0xBFE8213E, 0x4D43190D, 0x3A6F8D5F,
+   0x114B715C, 0xFF90AF51, 0x6FE7F066, 0x68AEAAE2,
+   0x38582167, 0x0EAC537E, 0xF7CE653B, 0xC92A4AA0,
+   0x9FE51011, 0xF1C9B1F5, 0xEED989E8, 0x7E318133,
+   //T[71]
+   0x02214159, 0x908F918F, 0x96E40D25, 0x0F40E021,
+   0x62201A39, 0xB9843F11, 0x9C1F3287, 0x0DFA8F9B,
+   0xF5777579, 0x28948E96, 0xF9605A58, 0x831C64B6,
+   0x51CBFDF1, 0xC173FE50, 0xA312D6D4, 0x48EB1B68,
+   0x2A00CECD, 0x931DD181, 0x3BC1BE8D, 0x8F87CF93,
+   0xFEE7E4C8, 0x3797A078, 0xEADB1CB2, 0x3FDE844B,
+   //T[72]
+   0xEB691C15, 0xDC20DABF, 0x8DD08609, 0x156FEEB9,
+   0x05871042, 0x713152D3, 0x7D49B407, 0x44746759,
+   0xCCA43300, 0xE42AE61A, 0x9473720F, 0xBA6B2A72,
+   0x302BE3D6, 0xCEBF7C9D, 0x5635D1C1, 0x9A9C7547,
+   0x175F8FF1, 0x4826548D, 0x4FFCD152, 0xD34B4E1E,
+   0xA686081A, 0x3E8143BB, 0xB0AC759C, 0xCE400A4A,
+   //T[73]
+   0xEB374C2D, 0x05362D59, 0x54B0F3BB, 0xDE72F0B3,
+   0x61EF395D, 0x5237E56F, 0x14B67CE5, 0x301712DC,
+   0xFDC44D17, 0x38A1683F, 0x158F4170, 0x55C7DC1A,
+   0x70AA62C8, 0xDB614D79, 0x0C64885D, 0xE1BDD632,
+   0x1E9A3158, 0x8D421216, 0x1ED4BFB2, 0x7ED90347,
+   0xE6F81A56, 0xF34E90A3, 0x1F86CC5B, 0xA3D29FAC,
+   //T[74]
+   0xA9ACE333, 0xC2D2B4A1, 0xB1B21DC8, 0x3AA976C4,
+   0x0AD57CD1, 0x613E233F, 0xDEEE3194, 0x1A619224,
+   0xE5E74934, 0x76B2FC49, 0x03848F79, 0x37A25C16,
+   0x8DD202FE, 0xE762B16C, 0xDBA7A550, 0x127BA7A1,
+   0xB716B15B, 0x47834EEF, 0x7624D42C, 0xD036A935,
+   0x78004A8C, 0x895FE04C, 0x37745F78, 0x38E0D773,
+   //T[75]
+   0xA023232A, 0xC7B611A1, 0xA5C14BAD, 0xF89819A6,
+   0x9566AD2E, 0xCBFB6582, 0xD60BA272, 0xEE930B79,
+   0x7334506A, 0x2FAA2912, 0x33F8511F, 0xFC286BA2,
+   0xEC285B6D, 0x9BBA9E8B, 0x1B904395, 0x7B62648C,
+   0x115E82BE, 0xAE2F8373, 0x5D703B46, 0x033215C1,
+   0x9F3A3C26, 0x07E40242, 0xE46A79ED, 0xEAA5E810,
+   //T[76]
+   0x10CA59B0, 0x9717C1FA, 0xD704684B, 0xCFD9000C,
+   0x706830DC, 0xC87B6AB2, 0x4FFD62FA, 0x55AA4EFB,
+   0x2F0A3A1E, 0x93F26289, 0xFF602707, 0x25B5531E,
+   0xE3B63F71, 0x6A76E8D6, 0xDC4DBCD3, 0x56D680DC,
+   0x128DB09E, 0x5035BB98, 0x365B2158, 0x3DAA508E,
+   0x58658D8B, 0x9762162D, 0x2CB2E70D, 0x3A924559,
+   //T[77]
+   0xF52F7BD5, 0x9F70BF76, 0x2349FC47, 0x3A9C69B4,
+   0xFC0F899B, 0x8DECD2AC, 0x61416323, 0xE9D11623,
+   0x9F4FB14C, 0x70361963, 0x592E5088, 0x25B43E0C,
+   0xC973BACE, 0xA6983C27, 0x659000A0, 0xE4B5A883,
+   0xF34BEFCC, 0xAE599CEC, 0x725AF0C9, 0xCAEDCE41,
+   0xEB0CBAB1, 0xF628AF6F, 0x405C5E2B, 0xBEBE2D7F,
+   //T[78]
+   0xC4EE3AF5, 0x1C78F69B, 0xF06A066D, 0xDD79A3F4,
+   0xADD85193, 0x95247503, 0x75070425, 0xB191CA64,
+   0x49DDED66, 0xDE1531B8, 0xA22E04EC, 0x2E3AFB83,
+   0x329491A4, 0x30B10A99, 0xACDA954D, 0x53339463,
+   0x033D6B06, 0x9E8A1180, 0x3C0A58C0, 0xAA3D9364,
+   0xBDD594BF, 0x7C68AACB, 0xB0C9AE55, 0x329D4B1E,
+   //T[79]
+   0x8B707B8E, 0x49BCC2F5, 0x1D928983, 0x2901B519,
+   0x7D49C780, 0x2E4C2956, 0x4C6A9964, 0xEBD1CFF8,
+   0x16EE3E13, 0x2CAEBBD3, 0xA87A68F7, 0x36A543EE,
+   0xB569946D, 0x75B41C29, 0x3EF2267E, 0x1510E7D4,
+   0xD4B3394D, 0x91235072, 0x8FBD85D1, 0x58EAFF04,
+   0x78A67847, 0xD349AB03, 0xA50EE41C, 0xF277BACD,
+   //T[80]
+   0x5F863BBD, 0x10B05658, 0xB483283D, 0xE92CDC5A,
+   0xDC7C421D, 0xEBB31209, 0x6D01A5A8, 0x3AFCBD79,
+   0xA08B6A51, 0xE2B067CA, 0xE8CB7AEB, 0x026E0DC2,
+   0x02DDE18A, 0xD8C35029, 0xD8C6CF36, 0x64C15FAC,
+   0x10781E45, 0x17EA2701, 0x1F3443D8, 0xD68D1FFC,
+   0x8C7461A5, 0x4BE25637, 0xD8EF24E1, 0xAE8866BA,
+   //T[81]
+   0xAC3DD930, 0x16C915C7, 0xCCC2CC7F, 0xA6165985,
+   0x0EDF38DB, 0x0D791A9A, 0x3C2930A3, 0xC50641C0,
+   0xDF58AA4D, 0xE0DB55FB, 0x52532C4C, 0x738BCA1E,
+   0x0F348CE6, 0xAA31F49B, 0x4478594D, 0x1DFA635D,
+   0x73D70E11, 0x56FE55F6, 0xFE1EC1A0, 0xDC298E0A,
+   0x8201FB4B, 0x1D8525F6, 0x8914F08D, 0x84EC5BAF,
+   //T[82]
+   0x8AACFBA7, 0x4FC3F3AE, 0x3A11F004, 0x2B6F7FF8,
+   0x172CC7A5, 0xE8BF9A53, 0xCB6FCC0B, 0x52829B12,
+   0x457A7F75, 0x89D4D81B, 0xE28CBDB5, 0x98335135,
+   0x2255643F, 0x9317B71D, 0xB393FEE2, 0x59863F74,
+   0x3E36A7DD, 0x8932821D, 0xA6618078, 0xE8BF9B4F,
+   0xD42D74C8, 0x645E2FCA, 0x2B617FA0, 0x76FAA072,
+   //T[83]
+   0xD265A91C, 0xAC3A78D0, 0x6C8F83D3, 0x1A29F8EF,
+   0x8FD8D817, 0xEF98FDDE, 0xC42BF748, 0xDF459EA1,
+   0x81A73DC7, 0x14DAFC39, 0xC52AFA2D, 0xB03DFA54,
+   0x6C0D2CE7, 0xCC406F6E, 0x41FD72CA, 0xCD120B2B,
+   0x78F602DD, 0xEF5D9006, 0x8ACCF229, 0xF5F8A2D1,
+   0xCE6D908A, 0xAAFD1FCF, 0x0E6D85F2, 0x2CE2885A,
+   //T[84]
+   0xC62666DE, 0x89109A0E, 0x7FFCD01E, 0xC8C12E75,
+   0xC48B5AB0, 0xA8206169, 0xF983AC6C, 0x4BC2FDCF,
+   0x55977D23, 0x59CFCA71, 0x5766C96A, 0x1264CB33,
+   0x2E014B4B, 0x6B691381, 0xE4483EC5, 0x31D28707,
+   0xFFB19758, 0xCBF7190C, 0x65A5F248, 0xB66717A0,
+   0xC53B4F69, 0xD94AD8FA, 0xA1A1A376, 0x119EBEEE,
+   //T[85]
+   0x69501E96, 0xFF0CBA6E, 0x2EB43742, 0xFF403C66,
+   0xB4279593, 0xB052238B, 0xBDB34F45, 0xA0910C14,
+   0x57DE5699, 0x065DEB6C, 0x2E45AF93, 0xC8BD0501,
+   0x03AFBA8C, 0x10F0BDDF, 0xEA0C10AD, 0x7E9F364D,
+   0xC187EBC0, 0x87B8D5EC, 0x82AB733F, 0x7638ABE2,
+   0x63E113F9, 0x8FAC57B4, 0xF9B0CBB6, 0x298E0156,
+   //T[86]
+   0x18370D5A, 0xCF0DAF5E, 0x7D513315, 0xF22D0316,
+   0x7B3794C7, 0xB0AEEE56, 0x738C04AC, 0x1B959256,
+   0xEF75F641, 0xD3517138, 0x4CB1C0DC, 0x086AFED8,
+   0x2536E32E, 0x743CDD25, 0xF8D69AE5, 0x1C33C150,
+   0xD9B3C8C8, 0x5137E32D, 0x37487BF8, 0x6E6DAE53,
+   0xCB8970B9, 0xC10E1A96, 0xC190D77C, 0xDB292ECE,
+   //T[87]
+   0x500CAC8C, 0x95157D11, 0x7409BB6B, 0x80EE3AF6,
+   0xD647C341, 0x9F3BD5B8, 0x9603D012, 0x128B5366,
+   0xDB328941, 0x5308F898, 0xE84A0F7B, 0xBBE1F31A,
+   0x1E7C58F7, 0xA180D986, 0xFB1C8E54, 0x8316DA6F,
+   0x1E7AF290, 0xD992E034, 0x3DAF20F5, 0x4A5CA2F5,
+   0x478423F2, 0x71DDF6D3, 0x5CF00C2B, 0x9BFA1ED1,
+   //T[88]
+   0xE4A3ED2D, 0x1C85933E, 0x5DA733B9, 0xA3AD0087,
+   0x18C35990, 0xE246402B, 0x238C761E, 0x73030120,
+   0x07634970, 0xC696E7BB, 0x9985B41D, 0xC689FA50,
+   0x2BD79E66, 0xFC894E73, 0xD6B6D271, 0x2E0E7DB6,
+   0x6B090B45, 0x0D2427DB, 0xBA4150EB, 0xAFEB2734,
+   0xCAEB94B6, 0x0FFDC5D7, 0x1A97A194, 0xC09C769B,
+   //T[89]
+   0x539EF7AB, 0xB9D8C83D, 0xE0E422EF, 0x83F117F9,
+   0x1D13ABDA, 0x8EE7FD09, 0x6CDC8134, 0x90A851F9,
+   0x005A3C66, 0xC1EA7D93, 0xB8BA93BF, 0x077751CA,
+   0x60A403D7, 0x7226AEB7, 0x794CC4A5, 0x33D93D9B,
+   0x51A822FC, 0x9EBA1696, 0x4CF099F7, 0xD6437FDC,
+   0x879A826A, 0x85D94E2D, 0xB082730F, 0x050FDF74,
+   //T[90]
+   0xCF6C2DC0, 0xA6F497B6, 0xBB7AA736, 0x30386DDE,
+   0x2D21E1D3, 0x0AB68A92, 0xDA0E6707, 0x7ACB3450,
+   0x05747CB0, 0x5F550AC0, 0xA5AF76A9, 0x0A075604,
+   0xF66D429F, 0x86384348, 0x17E852D7, 0x0973BBEF,
+   0xD970AF79, 0x26D4061A, 0x5BED51E7, 0x44FAF877,
+   0x1F1BA17B, 0x51D7EA95, 0x72F1ECA7, 0x11B591B4,
+   //T[91]
+   0x9AA67787, 0xAF99FCA8, 0x328F405B, 0xB0AE949D,
+   0x08DCF415, 0xBBAF915A, 0x9529A447, 0x23CD86B2,
+   0xC875F580, 0xEBD28B31, 0xAB604935, 0xEA6D2760,
+   0xB5129DFC, 0x2708965C, 0xB55AC907, 0x32CC2F3C,
+   0xFC472545, 0x8FEE65EC, 0xEA8B43B7, 0xDB543BCF,
+   0x80D42E03, 0xB8B6FC70, 0xFE5810A2, 0x7D82EBA6,
+   //T[92]
+   0x06E25712, 0xD34091DE, 0x179B3C42, 0x8FA26695,
+   0x56949B3C, 0x9B8F1DC2, 0x4DD84C94, 0x52B3816B,
+   0x47BC034D, 0x5DAAB7C2, 0x8AD83FBD, 0xFDF86F2D,
+   0x32C20E19, 0x6B6D8543, 0x3B59A75E, 0x3D269035,
+   0xBA9781F5, 0xCF1AA17F, 0x866A824D, 0x0AF9263B,
+   0x52E44CB9, 0x2544A020, 0x18D77195, 0xD384C36F,
+   //T[93]
+   0xE25041CE, 0xCEE924B3, 0xB385A077, 0x6457C460,
+   0xBC7A9001, 0x86341042, 0xC0221C0E, 0x26DDAE30,
+   0xE9120846, 0xBB1E037F, 0x9C72E1DA, 0xDEE98856,
+   0xEA7495F2, 0x6C394558, 0x9EEAE573, 0xF9E9584F,
+   0xCB5D1169, 0xE1A9FB28, 0x864773F6, 0x5E761E02,
+   0xD5E372B9, 0xCD770542, 0xC58BC520, 0x0CCA6295,
+   //T[94]
+   0x30AA6BEB, 0x6D230751, 0x1F46EAB7, 0x845E8019,
+   0x482B8B29, 0x8A9ACDCB, 0x883A6246, 0xFED8BACA,
+   0x870F9CF4, 0x6CEA3178, 0xCBA09693, 0x634509F8,
+   0xF90AE516, 0x73F4574F, 0x4E0CE9A2, 0xB412AEC5,
+   0x515EDE8D, 0x32920553, 0x9A7A58AB, 0x96E402A4,
+   0x90F301BF, 0x2B812B39, 0x1A9317ED, 0x3BA7B9C4,
+   //T[95]
+   0x21B57B04, 0x429ADA0A, 0x9DDAA0D9, 0xF6FAA365,
+   0x8BB571F9, 0xA6E7C0DC, 0xBD5D3C33, 0x87137C91,
+   0x7BA2E489, 0x01A188A3, 0x24BB8D8B, 0xBFB3053B,
+   0x9073A982, 0x1CFE36AF, 0x6D01CA48, 0xB37804EA,
+   0x1B6542DB, 0xADD586D9, 0xEA181A54, 0xA5B2BADE,
+   0x2E31DD56, 0xF06FB5F5, 0xA0F9D761, 0xCD92E534,
+   //T[96]
+   0x9FB5672A, 0xF3435F2C, 0x5BEDBA7B, 0x2E751E35,
+   0xB80BDE42, 0xF74AD34B, 0x5AD9F57B, 0xD89BD3AA,
+   0x1DD1F2FC, 0xDCD95A37, 0xE5CFF7BE, 0x82B0A68D,
+   0xE77EE0E6, 0x77C3DAA5, 0x969E2449, 0x646EA0F8,
+   0xFB575886, 0xE2449DAA, 0x8CE3A940, 0xBB7781D9,
+   0x5727BA12, 0x6B6718D1, 0xA8549129, 0xD2DB7EEE,
+   //T[97]
+   0xEE6893A5, 0x8106596A, 0x9639B7E5, 0x54897292,
+   0x175373AE, 0x40656A4E, 0xA5E133B3, 0x68A7682A,
+   0x6013CB71, 0x7E619042, 0xA64572DA, 0x8960F460,
+   0xEFBC23C9, 0x6F3FED2F, 0xA205302B, 0xF9D64E53,
+   0x6A3A38AD, 0x8E64DA48, 0xE4DC3218, 0x04526A26,
+   0xB3FB829D, 0x650AD7A1, 0x128403AF, 0x338EEEB2,
+   //T[98]
+   0x3F98BB25, 0xB4A703B2, 0xFF3F445B, 0x6CD34896,
+   0x63114997, 0x2150331D, 0x9B48EFC4, 0x370102C5,
+   0xB3F508EF, 0x26516D4E, 0x7DA258B8, 0x5C1D1231,
+   0xD721405F, 0x1559C19F, 0x347A260D, 0x098FCD02,
+   0x28050069, 0x2A9E6378, 0x949159E2, 0x5D602038,
+   0xA17CB8A3, 0x7E6CE2A5, 0x081BD74B, 0xD4188E42,
+   //T[99]
+   0xC042FA4F, 0x195061B2, 0x8B319849, 0xFAC64082,
+   0x893624A8, 0xCD823433, 0xFD715444, 0xDD084ED4,
+   0xA121AEB6, 0x0E8B05C9, 0x7BE43293, 0xB9A6F791,
+   0xE4F328B1, 0x961CEBEF, 0x6B9FED1F, 0x4D792C6C,
+   0x97044A36, 0xC39A41D5, 0xBACAC06D, 0x591DD6AB,
+   0xA1993C19, 0x7038BD61, 0xFC4C42B7, 0x8CF65CE3,
+   //T[100]
+   0xBD4474C3, 0x489E4070, 0x0573C538, 0x2A986EB4,
+   0xAD33FAB5, 0xF3278459, 0xB17F78B8, 0xFA0E4044,
+   0x60FF0825, 0x6AF6C351, 0x3453E22A, 0x3D020F4F,
+   0x992B31BC, 0x200ABF65, 0xADF09F58, 0x95B864D3,
+   0xA701E77F, 0x289F8B41, 0x4F0AF536, 0x88ACD424,
+   0xEAAD0C4F, 0xAA187B90, 0x18D8C1D4, 0x67358FBC,
+   //T[101]
+   0x6980ABF4, 0x8897C845, 0x355B4619, 0xA0208728,
+   0x724C170C, 0x59E89731, 0xBF75BF14, 0x4D4FD489,
+   0x67FE7F4A, 0x15004254, 0x72CC62F3, 0xA4083E51,
+   0xB6B9C0EF, 0x150940C0, 0x74B4296C, 0x56B72881,
+   0xC7B657B1, 0xC943496C, 0x643E550B, 0x41D59582,
+   0xFF457D21, 0xDA3426E2, 0x0084F48B, 0xF8B38022,
+   //T[102]
+   0xE074D399, 0x2B1E234C, 0x3BB4BF92, 0xBE16F9E6,
+   0xE47FC10A, 0x11D5A8BF, 0xEAA4BB95, 0x5FAB9653,
+   0x233C8981, 0x5A98165C, 0x26DD9AD6, 0xADBB7D79,
+   0x218FE0A8, 0xA5C743A1, 0x8B15F1AD, 0xF2CC7457,
+   0x71A329B3, 0xE5DDE3CA, 0x70E4E9D5, 0x43626135,
+   0x300F02FD, 0x0AC78CCE, 0xEC2AA161, 0xFA6ECD78,
+   //T[103]
+   0x70543FDD, 0x7A2C7B9C, 0xAF730549, 0xD748F2A7,
+   0xAC7C0180, 0xDB1CB54D, 0x9452DA48, 0x6BB52FC6,
+   0x71B3C31C, 0x515C8F16, 0x2B03E3D0, 0xA842BFDE,
+   0xA2D78BC7, 0xAFC60F6F, 0x525932BB, 0x87A954B7,
+   0x9A64CEB1, 0xE4A2E240, 0x35B8EC6A, 0x81B08FCB,
+   0xCAB7830E, 0x69E34ADF, 0x1E8A101D, 0x7F9559B9,
+   //T[104]
+   0x514884A2, 0x4DDD1A00, 0x1147E85A, 0x48D55455,
+   0x40B3542F, 0x9EC827E8, 0x219FF42C, 0xEF0E5B01,
+   0x6951478B, 0x6DD748FD, 0xC1DB66AA, 0x5989A636,
+   0x9E441B94, 0x13111965, 0x58E65B35, 0x978649FE,
+   0xF006348D, 0x3C41C0CA, 0x58529B11, 0x6A1EE20A,
+   0x86A99C4D, 0x3CB0C739, 0x30A6E26F, 0x6EB571CE,
+   //T[105]
+   0xF506CC41, 0x54D81FD2, 0x168F87F0, 0x7B35D8B6,
+   0x00788281, 0xA6A78AD0, 0x499B9708, 0x87A74A26,
+   0x42ADE87B, 0xED1C569D, 0xC55EF071, 0xCC61E58E,
+   0xEC35C0EB, 0xA0F0A975, 0x214E3AF2, 0x24F70C4C,
+   0xC53E9BCA, 0x48A612A8, 0x8020B400, 0xDBCAA99B,
+   0xD2731548, 0xC454DE40, 0x54631A80, 0xF0170786,
+   //T[106]
+   0x32E02355, 0x87C4348D, 0x42453DB3, 0x3207C57E,
+   0x159A304F, 0x738BF53A, 0x9FE297E2, 0x01A6E8A5,
+   0xD5212A11, 0x6E9C24BB, 0x17E2C71F, 0x7F5446AF,
+   0xADB7FD36, 0x9EB99A65, 0xC75415AD, 0x13078C48,
+   0x251EAD33, 0xA4E3AFDB, 0x2F8B41A9, 0xCD60F7B6,
+   0x3AFDC0D0, 0x23DF0298, 0x162F910C, 0x976F6AE4,
+   //T[107]
+   0xB485B2FB, 0xECDBD284, 0xF341569F, 0x3CCED37D,
+   0x2DEE20F9, 0x75512A15, 0xFCE61122, 0x9269754A,
+   0x4550EB0F, 0x910A03B3, 0xF99BBDDE, 0xCB5E43F9,
+   0x0EEFB6E9, 0x3B1ECE2C, 0x31C436DD, 0x9FA30256,
+   0x38478C82, 0x8846E381, 0x20F3EBF5, 0x8FCE6376,
+   0x33EDF433, 0x2C882D47, 0x6D9C398E, 0x02D28905,
+   //T[108]
+   0x45E533BA, 0x31B5C3F0, 0xBED0D488, 0x8718C57C,
+   0x6DB39E0A, 0xE623EC10, 0x4EAF68FD, 0x522A9A08,
+   0xD11F1ADB, 0xA531B177, 0xCE6413BD, 0x7DE85131,
+   0x1123B69B, 0xE4B4E58B, 0x43DCA833, 0x65908ED3,
+   0x0D82BA32, 0x63F92525, 0xE4AAE0AE, 0x21A5AE47,
+   0xD0D86F08, 0x7A9611AA, 0xF263E627, 0x53DB1F7B,
+   //T[109]
+   0xDFAF43E3, 0x0693D1ED, 0x7CE3099D, 0xC51C280C,
+   0xC38CD6BF, 0xC823582F, 0x9E312C88, 0xAADD73A9,
+   0xF46158EF, 0x9E33BDFC, 0x52D688FB, 0x42F3303F,
+   0x30346C37, 0x86F2A920, 0xD5C85979, 0x6319A1DF,
+   0xFD989E18, 0xE7326340, 0x8F60D911, 0x1FF88EA4,
+   0x11C38EDF, 0x9859A2EE, 0xD2E4D079, 0x078A406E,
+   //T[110]
+   0xC6AFBB31, 0x0D9DC1D8, 0x6A36A178, 0x0058A705,
+   0x10CCB2C6, 0xCBC03E06, 0x9AA58A86, 0x256D3D38,
+   0x482AF5EC, 0xCAB53CCE, 0x0BAD817C, 0x4CAC6B0D,
+   0xE29208F9, 0xE1D6495A, 0xD781A89C, 0x5EEF40BB,
+   0x89C8DFFF, 0x898B37D3, 0x7A9DCFFB, 0x7F39BFA3,
+   0x46CE1EE2, 0x83463742, 0xEE02F710, 0x71AED62C,
+   //T[111]
+   0xB484FFF4, 0x065FCD16, 0x62B49E8E, 0x8C408597,
+   0x9539859E, 0x9552D07D, 0x6E9DD53D, 0x9BF0E47A,
+   0x5E6EEDAE, 0x5B57C154, 0x77DFFF65, 0x6AF0818D,
+   0xE336CA84, 0x4F39E3F3, 0x94EA98D6, 0xC5737F9E,
+   0x7342497B, 0xD2E85559, 0xFDC03F34, 0x28038B7E,
+   0xD9B1AE69, 0xFE04FBD0, 0xDAB2CDE3, 0xA872B709,
+   //T[112]
+   0xD6BFA531, 0x255E92CC, 0x339D2A00, 0xE5BD4639,
+   0x4A7A7F1B, 0xC5E7311F, 0xFFCC7AA0, 0x1B6AE6A0,
+   0xC447DA96, 0x61CF66DD, 0x52617205, 0x8AA951B8,
+   0x792F5A32, 0x6F02872E, 0xE4ABF84A, 0x948E3CD7,
+   0x0AC552F7, 0x264E5BAB, 0x7B257BFF, 0xF7CD5D97,
+   0x9A88F31E, 0xE83687B0, 0x6F0C913B, 0x1C686969,
+   //T[113]
+   0xA1306DBD, 0x63133D9C, 0xF5D6ABFA, 0xFEB54CCF,
+   0x4881FC2B, 0xE622173D, 0x625A7562, 0xE2EC2F72,
+   0x70E68F39, 0x1CD1A548, 0x1C75802E, 0x2787F638,
+   0x44A73075, 0x2C3D428D, 0x23F3EE10, 0x122D9489,
+   0x74D5283E, 0x78DBEAC4, 0x1917096D, 0xE8E97BE4,
+   0x2A008C76, 0x0FD8BCC1, 0xE81601A3, 0x7B1FDB2D,
+   //T[114]
+   0x72F0DFFC, 0x1FA55BE6, 0xBBFFF53F, 0x163C5FD5,
+   0xED298927, 0xCFDA2C2A, 0x81204764, 0xFDDF6E5C,
+   0x9BF44F86, 0x93F6C890, 0xCC1E5FF3, 0x2555FD7E,
+   0x435902E5, 0xD7BA94B4, 0xEC3FB3E9, 0x828B9C7D,
+   0xE961EA21, 0x39434258, 0x8175565F, 0xA15B5491,
+   0x142B9CED, 0xC71B0412, 0xA61201E5, 0x568350AC,
+   //T[115]
+   0xCE4DCABF, 0x9D836324, 0x7B981AB2, 0xA8C392E7,
+   0x725D30D4, 0x34F50312, 0xA2D8427F, 0x92FA1784,
+   0x21F4C507, 0xB1A0FE32, 0x09C35766, 0xD641A608,
+   0xD3B14CAC, 0x7B1BBFDA, 0x70516658, 0xCB2A9104,
+   0x03DC238F, 0x32CC6547, 0x68696A65, 0x26E0F4B3,
+   0x31C6493D, 0xB1897A43, 0xF575FD38, 0x7D5689BA,
+   //T[116]
+   0xC98AAAF3, 0xEC255518, 0xBE667678, 0x24B60157,
+   0x6275AAAB, 0x9DD2BECF, 0x357B95F2, 0x1DC86B7C,
+   0x7D3A3417, 0xDD794A83, 0x042A92DC, 0x789D2915,
+   0x0809E62C, 0xDCF85779, 0x46C2B84E, 0xFE27FAA7,
+   0x4DEC88DE, 0xC6D233B8, 0xDE0B7EEC, 0x58E94228,
+   0x83E6D2C0, 0xD147BEFD, 0xC7C81043, 0x2E4F1EC6,
+   //T[117]
+   0x5B185C77, 0x4A47E2CE, 0x7B7FAB12, 0xAA5F6F3C,
+   0x4DCF598B, 0x444999FE, 0x459BE432, 0x425076FE,
+   0x5DCF2F7E, 0xCA91909E, 0xA3DAD544, 0xC8DC4178,
+   0x131660EA, 0x1E954441, 0xBA890C3A, 0x35783198,
+   0xE3BB707F, 0x3298080E, 0xD82E22F1, 0x2FA77ECF,
+   0x893F6E2A, 0x60240F46, 0x39BA343F, 0xAD73F378,
+   //T[118]
+   0x33450C99, 0x21071C74, 0xAAD48D03, 0x68E99B56,
+   0xD6870E18, 0x9C03EC94, 0xC9C89BD2, 0xC7C294F6,
+   0xDB33AC06, 0xB590DA7A, 0x18D93AAB, 0xD4827466,
+   0x23F89DA9, 0x1413173C, 0xD5EEF86B, 0x6E8A0F2B,
+   0xA32AC2D5, 0xECD499D2, 0x0DB66260, 0x670CA87D,
+   0x2831B812, 0x44789650, 0x284F8FB5, 0x603E85F9,
+   //T[119]
+   0x75F6B077, 0xA3396D61, 0xC0817340, 0x6E9400D4,
+   0xB3EFD918, 0xF5538D42, 0x6791887D, 0x02F23DCA,
+   0x6DC2DBCC, 0x271A8DC9, 0xEFF1BC8F, 0x2FEE5EC6,
+   0x8E479378, 0x310EAE31, 0x5D0A435F, 0x25F32868,
+   0xBC734AE1, 0xF4297E29, 0xEE21D851, 0xAC28F3A1,
+   0xACB02030, 0xA834EFC6, 0xFC9D9C20, 0xE18C40DC,
+   //T[120]
+   0x18294886, 0x1B94D7F4, 0xE11B5FD5, 0xDB710758,
+   0x938D45D3, 0x03C09D41, 0x63DA6800, 0xD893CBD1,
+   0x46F6E510, 0x75ADFD23, 0x14EA12D7, 0x105A1664,
+   0x15A21AB3, 0x7EA2888A, 0xB3F2F7D8, 0x08AD59E4,
+   0xCD3B27FF, 0x89790353, 0x71A2E235, 0x935404C3,
+   0x965AA7BE, 0x1C675BD1, 0x92C3D30C, 0x41EF6995,
+   //T[121]
+   0xC7F98F15, 0x9D27BE60, 0x5E5EBC1A, 0x3C01FDF3,
+   0xAC7DF403, 0x96460FD0, 0x9FD50FAE, 0x2E9D1CB4,
+   0x5F0736BD, 0xC4349DAF, 0x9F5151C3, 0x247E0BF0,
+   0x46F41CD1, 0x446CDD18, 0x10D0F429, 0x02D850FF,
+   0xBE7B43BF, 0xC54A30D6, 0x693BA19B, 0xE52681FC,
+   0xA3A55531, 0xE3C3EDF9, 0xC5136EF7, 0x980BA820,
+   //T[122]
+   0xCD8A9F13, 0x973A41B6, 0x40AC3580, 0x076EC328,
+   0x5355872E, 0xFCB934DC, 0x900C6B97, 0x2B8D533B,
+   0x1BF90207, 0xA21D0C5F, 0x5506D69C, 0xE44EE06B,
+   0xD1278C4B, 0xA591F7EB, 0xBA25258B, 0xBA20469E,
+   0xC913EC14, 0xF8D9C18F, 0xB34AD894, 0x268CCA0E,
+   0x0D3B0D17, 0x04940CEF, 0xCCF8976F, 0x7214B382,
+   //T[123]
+   0xF89F0EE6, 0x7638EFEC, 0x412B9647, 0xF1E9B3F4,
+   0x7609F691, 0x11C4940A, 0x0384BC4B, 0xC23E8727,
+   0x3560C337, 0x1788DFFC, 0xA53F4EEA, 0xD07CC4AB,
+   0x9E60B760, 0xEF11E8BA, 0x6932FAFC, 0x8B7C10DA,
+   0x4A81141A, 0x9527512B, 0x6B74612A, 0xD292D880,
+   0x37C8238E, 0xCF5E7BCD, 0xAF35C917, 0xABE1E8AB,
+   //T[124]
+   0x326C39A3, 0x896AA65A, 0x98B71CC0, 0x861F9B25,
+   0xFD1AC723, 0xF7224870, 0x85845F8F, 0x8B465334,
+   0xEC1123BC, 0x82DB4506, 0xFC92B23D, 0x085FA5AC,
+   0xD101F024, 0x2CB41A86, 0x837B96AC, 0x85B42588,
+   0x85575E2B, 0xEFE86757, 0x2E2093A4, 0xE52B4503,
+   0xCC15272D, 0xF78ED8C5, 0x42207EE2, 0xD669B889,
+   //T[125]
+   0xBA4D0736, 0xE30EEA89, 0x123773CA, 0x9239950D,
+   0x15F1BAE5, 0x9A4B8766, 0x1A6C324F, 0xE5EE1BF5,
+   0xC14275E1, 0xB9962E17, 0xAC5BD97C, 0x8BD06A86,
+   0x08E41D83, 0x2C3690C0, 0xBD4971EB, 0x1487E623,
+   0x2B2EA0C0, 0x721D3799, 0xB1589C0D, 0xBA07DAC6,
+   0x2963BD8F, 0x9A4A30B2, 0x7C997059, 0x4606496B,
+   //T[126]
+   0xC91976C4, 0x706C4CD8, 0x7EDD0355, 0x25F06D5C,
+   0xD727A133, 0x51D73A06, 0x472D62A0, 0x033D9C04,
+   0x8EE007EC, 0xB3979C05, 0xF5CDC22D, 0xFACBE274,
+   0xB5C13924, 0xDA74D383, 0x03D399E1, 0x96464317,
+   0x16E99682, 0x06B52623, 0xFC7E1C61, 0x4F6CD1C3,
+   0x5F1A87F8, 0x6D2F0E97, 0x79560551, 0x308ADCB4,
+   //T[127]
+   0x3F385D2B, 0x35B2E438, 0x932B516D, 0x6E668AC4,
+   0x51A3599F, 0x8A1646FE, 0xD12C0F3A, 0xAEE309AB,
+   0xC46DA385, 0x0231423B, 0x637EE943, 0xF23C10B4,
+   0x22248E00, 0xC0BC215D, 0xD45F6553, 0x9ED447E3,
+   0xDAAD7D1D, 0xAF084771, 0x1F2D8179, 0xEE94BF70,
+   0x267BB3FD, 0x1E8C72AD, 0x8DE7AC78, 0xC425DE16,
+   //T[128]
+   0x9145CA38, 0x09E8FC46, 0xFB2C052C, 0xBD3E06EC,
+   0xA85878AC, 0xC1DF9E09, 0xA09863F1, 0x9414821C,
+   0x92117961, 0x33EA87EB, 0x561E3A92, 0xDD341607,
+   0xF4853050, 0xA852CFB2, 0x718EB77A, 0x4D160ACE,
+   0x054C76FC, 0x376CB938, 0xC67E90D1, 0xAFF43CCB,
+   0x77A64CF1, 0x0B54AEBB, 0xCDE57A90, 0x8951EDBE,
+   //T[129]
+   0x470F3A77, 0xD8A51C99, 0x25D95DD3, 0x8D6A2281,
+   0x2A5FAB8D, 0x57FA043E, 0x5AC2CB2B, 0x0677506D,
+   0x53628E69, 0x134C04EE, 0x0ECCFE6D, 0x89D95CA2,
+   0x6EE36B40, 0xC4C44393, 0x663F07F9, 0xDDBA6703,
+   0xEB5D4D0B, 0x03E7DD1E, 0x94B962CC, 0xF9D5C477,
+   0x1213CDB6, 0xEB8FFDB3, 0xB76847A5, 0x9D9927DA,
+   //T[130]
+   0x8133791E, 0xAA19E9F9, 0xA851F829, 0xC00384BB,
+   0x5B602E6C, 0x566B6BEF, 0xA181519A, 0xD1665A1A,
+   0xA0773741, 0x31EDEBF4, 0xD35797F1, 0xBE11E243,
+   0x462F4086, 0xF41E4C84, 0x29FE926C, 0xD094411E,
+   0xCAF03B70, 0xBC8051DA, 0x1EE5ACFB, 0x70338071,
+   0x555B7D3F, 0x0CE51430, 0xE2A833BE, 0x5CAB81B7,
+   //T[131]
+   0x192E6075, 0x2E39EE6F, 0x1C8B9FB9, 0x9918489A,
+   0xC4AC13C5, 0x47C196AF, 0xA595358B, 0x26FB7C85,
+   0x5AC03E1D, 0x95EDAD2F, 0x1A32D187, 0x97739779,
+   0x51E0DEC7, 0x40D62F42, 0x82E7EE1B, 0x5AE1A9A3,
+   0xB4206E3B, 0xE3CBD483, 0xDC4BF14A, 0xBF96E99B,
+   0x591061FF, 0x66E3C824, 0x1941F7FD, 0x81A17585,
+   //T[132]
+   0x4C86B84A, 0xF746B1CC, 0x2830825B, 0x9858FA13,
+   0x1423DBD0, 0xBE2672F8, 0x6183A4F1, 0x6C26AD07,
+   0x18747E39, 0xEBE7ED25, 0x62B3575E, 0xD3E02EBA,
+   0xAEDB484B, 0xB65EE04C, 0xBAEF4BDE, 0x8CED5073,
+   0x7905738F, 0x4DF54386, 0xB05D1026, 0xADE589B7,
+   0x0E146C81, 0x1D69186E, 0xBDD3F287, 0xBF0243C7,
+   //T[133]
+   0xE3E51714, 0x09DE752F, 0xC2C7199D, 0x089905A4,
+   0xC2D72D3D, 0x8CFE19FB, 0x5268F7B7, 0xFA55E99C,
+   0xBAAEC4FA, 0x3B1D30C8, 0xB654FC2C, 0x3E942DAC,
+   0x7172F99C, 0x8D95E563, 0xE250B22D, 0xC93DAC7D,
+   0xA23F958E, 0x74AFF2FE, 0x79C0637E, 0x9CF6F19C,
+   0xB2C3D52D, 0x350408E5, 0xB97FB7EA, 0x1EC9EC86,
+   //T[134]
+   0xAD9CEB68, 0x75451CDF, 0xFF5AFF17, 0x74710A7F,
+   0x38988F84, 0x883DDEAD, 0xB5921D1C, 0xA9B953BF,
+   0x82D15B3D, 0x29531EF9, 0x03CA469F, 0x60473DDD,
+   0xE3B240C6, 0xD540CD42, 0x978C9BBF, 0x4AB667A1,
+   0x44CF1C45, 0x9AB49070, 0x10B27A50, 0x476C3C5D,
+   0xC7C0B075, 0x16B41249, 0xB0E11199, 0x9C257997,
+   //T[135]
+   0xC058EC50, 0x96AD4EB3, 0x3165E005, 0x243B3E24,
+   0xC2C17C13, 0xB483CAAB, 0x10135494, 0x97A8DC97,
+   0x0DCC3B8E, 0x24F2C475, 0xF7E769F8, 0x57D89C1F,
+   0x7BC53ACB, 0x3DDA442A, 0x7FB230CD, 0x143B1E5A,
+   0x37B0654B, 0xE8661841, 0x506CAA55, 0xAE713A85,
+   0xEE2EFDDF, 0x4C177B58, 0x354171CA, 0xB3AD8108,
+   //T[136]
+   0xBA0CF453, 0x6070306B, 0x4683B6A0, 0xDCDFCCA5,
+   0x2BDACECF, 0x4F124E93, 0x7A9733EE, 0xE3C05453,
+   0x4E5C1348, 0x1F66E6C1, 0xE4758C13, 0x1FADB5E4,
+   0x47F0F680, 0x8EA4585F, 0x2CE9DCBF, 0x26E69CC5,
+   0x85A6950D, 0x33136258, 0x14C6F869, 0xCEC61DE8,
+   0xD5368D6F, 0xAD54E93D, 0x8CCD885C, 0x8F5E8C6C,
+   //T[137]
+   0x2D4575B7, 0xB6DB7693, 0xC259599A, 0x830D73DF,
+   0xDC10B088, 0xD93C90BB, 0xD4ACE4B2, 0xCEC529B5,
+   0x570B8D5B, 0xDB269D5D, 0x73B11953, 0x1AC4C02A,
+   0x642FD505, 0x034D4A8E, 0x58D23777, 0x0B1D4F3D,
+   0xAEFE54C0, 0x00D28D3E, 0x4D8743D3, 0x31B3A326,
+   0xBF82D9CF, 0x8AC60D5A, 0xE4946204, 0xEBC5ABC0,
+   //T[138]
+   0x1D0B47E8, 0xC1E92CE3, 0x54A0F66A, 0xFDEF20AF,
+   0x3C181003, 0x67FA6C4A, 0x5AB75CCB, 0x3E67C753,
+   0x750078B4, 0x27C39A6C, 0x5179D59D, 0x637CE872,
+   0xCC564065, 0x46955FF2, 0x5C9C330E, 0x39CBB3D0,
+   0x2341ECC4, 0x287EDF0E, 0xBB5B468A, 0xC8FC94C4,
+   0x0F73402A, 0xAF485634, 0x27413464, 0xF51EADA1,
+   //T[139]
+   0xF7497176, 0xDAD71111, 0xF8D0F631, 0xCE402B4F,
+   0x212D2325, 0x6780B23A, 0x81D671B4, 0x5FCEB42E,
+   0xCC5F2791, 0xD4212BD7, 0x80CFC938, 0x8974999F,
+   0xC604EDA1, 0xA21F3C86, 0x5E049F67, 0x3976D0CD,
+   0xC32EF2A7, 0x8DB3DB20, 0xA3A148B9, 0x685A40D6,
+   0x6BC45A2A, 0xB3000040, 0xCE6597D7, 0xD1B83585,
+   //T[140]
+   0x6354443D, 0x05BBF636, 0x7C259136, 0x8CFFE2DD,
+   0x9EFD2B8C, 0x459F4E74, 0xB1DD0593, 0x5BD92FBF,
+   0xAC318E52, 0x2EF4CFDD, 0x7E9E6A26, 0x032FD09F,
+   0x35F2993F, 0x5DB07032, 0x5F020EE9, 0x32656BF6,
+   0xF666AFB3, 0xC2022E06, 0x5FC71862, 0x6E2A6877,
+   0x9B45A7DB, 0x85370B97, 0x2BACFDA2, 0xE6FE77C9,
+   //T[141]
+   0x72171B79, 0xEDAD0DE5, 0x489BD79A, 0xC5F5A0D0,
+   0x3EB0B3B1, 0x872F4D3F, 0xDF27F18E, 0xBC91B628,
+   0x0A037190, 0xF519D825, 0x875AB622, 0x1800EF82,
+   0x46772904, 0xC831D906, 0xBC80FE04, 0x7D273896,
+   0x52916A2B, 0xC23D8943, 0xD0E21964, 0x5F60A72B,
+   0xBE1CDB32, 0xF3AB1100, 0x3AC6FA71, 0x8B849742,
+   //T[142]
+   0x149AB003, 0x488860ED, 0xFC2D9EA0, 0xB0E4778C,
+   0xD47B9CA7, 0x5134CAA6, 0x79F26379, 0x07B45CB5,
+   0x2E0DA20F, 0x69715773, 0x07E368B4, 0xF5A230FB,
+   0x9F887157, 0x1D5BA22B, 0xDB97BEC5, 0x22A84635,
+   0x934DA243, 0x1B79839F, 0x7F89CFA8, 0x9E6E9C68,
+   0x0F18B144, 0x45D79A7B, 0x0EDC8509, 0x51E0F72A,
+   //T[143]
+   0x53928FE0, 0x1AD8824A, 0x6F4D99F6, 0x528C2118,
+   0x5B1B4D41, 0xBB6F5684, 0x5174ABB1, 0x560013C8,
+   0x50B97E5D, 0x6F76DA1C, 0x59A91671, 0x8F4BD976,
+   0xEA751B48, 0x09DE347C, 0x0F6C8D96, 0x55EE2AAF,
+   0x1BD29B04, 0xC7B8B161, 0x653D6F28, 0xA60F758B,
+   0x5271CB1B, 0x6887EC54, 0xB631F3C4, 0x02FDDB96,
+   //T[144]
+   0xCA332AE0, 0x3E0384EA, 0xE7E39F5D, 0xC4A3FB7C,
+   0x5CBBCF46, 0xB29C5B54, 0x5AC33D7A, 0x2DA4CF5B,
+   0x4003CC9F, 0x7592BAAA, 0x1B73BAD5, 0x03775DF4,
+   0xF80F2E6F, 0x199E48CC, 0xC4AD26D0, 0x45A229B1,
+   0x0FC3F3F1, 0xC175CBEF, 0x555B3579, 0xA33B4A32,
+   0x62109598, 0xB15AA205, 0x3E47132C, 0x4AB8A27D,
+   //T[145]
+   0xB2B4A96A, 0x41EACB95, 0x39ADEC56, 0x819D335A,
+   0xFBED45FB, 0x85B63E3A, 0x9B22275D, 0x3DD30818,
+   0x2C30D269, 0xE8F82634, 0x39820D16, 0xC071D836,
+   0xF921CA4E, 0xCE3D42E2, 0x80636F55, 0x2BE46ED0,
+   0xE1B9A8D7, 0x58120DB9, 0x6664AADE, 0xB803F0A0,
+   0x76166DA2, 0x716F117D, 0x6DDB3F05, 0xEEB045C4,
+   //T[146]
+   0xBFD50C80, 0x1F440215, 0x19108EE1, 0x3A4A0334,
+   0x8A09A4ED, 0xE4A0D1FE, 0x73263A63, 0x6368193F,
+   0x90C9ED5D, 0x7382834B, 0xECD647AD, 0x4A0878CB,
+   0x385BF74D, 0x9B606001, 0xD178909F, 0x493CF9E5,
+   0xFA4FBF62, 0xAD3D44CA, 0xD709D6DA, 0xDDFC320B,
+   0x7CCA263D, 0x8856F315, 0x333FCE9A, 0x7ADAD2C5,
+   //T[147]
+   0x7F0635A0, 0xEB2646DC, 0x0728B235, 0x6D601949,
+   0x1F5B858B, 0x85EE9499, 0x8453121E, 0x8A9334E4,
+   0x89223E0A, 0x02BB31BD, 0x1E29A58C, 0xC7AE8EEB,
+   0x215103E0, 0xC71467E2, 0xEE29648C, 0x76678C22,
+   0x7AFFA823, 0xCB0D8F96, 0x96BE5A09, 0xD460B313,
+   0x3F8A2D06, 0xB79DB842, 0x8C126780, 0xEAC7F2D1,
+   //T[148]
+   0x39BA7347, 0xF450B8DC, 0x8F643F6F, 0x3888AAF8,
+   0xBA5BDA4A, 0x981C0C86, 0x34B39F03, 0x9A17D938,
+   0xD376202C, 0x836F5503, 0xA2FB6A53, 0xE3860F08,
+   0xF8559581, 0xE0BA600D, 0xEB231E22, 0xB91A45EB,
+   0x9CC00501, 0xAF538463, 0xEA83F075, 0x79CFE9FA,
+   0x52A49F01, 0x865B9991, 0xE9BEC7AC, 0xF468AF26,
+   //T[149]
+   0xB40F694B, 0xFE9B94C4, 0xF737AB14, 0x7A3E6A22,
+   0x69DB2FA1, 0x512C9909, 0xE16B9044, 0x472ABFB0,
+   0x1B595B5F, 0xD4CA7675, 0xFD6FA2B5, 0x06F0F55F,
+   0x4FC77152, 0x63EB80F7, 0x15344EEB, 0x5848CD2B,
+   0x6A573FA2, 0x5B84C68A, 0xADCA707E, 0x6E11447C,
+   0x47A70431, 0x4EBB20CB, 0xBA2E79A4, 0xE1CEE56B,
+   //T[150]
+   0xE40CDA6B, 0x9DF72AFF, 0xA54EEE37, 0x7A97DE8A,
+   0xC1F7513E, 0xDB5155DF, 0xD20D7BA9, 0x5017411F,
+   0xBED1F4B3, 0xE5FB59C6, 0x461C8FFA, 0x26B71C72,
+   0x6E01D7D3, 0x1E864B57, 0x022526DB, 0x90C1C152,
+   0x85D601D5, 0x18DECA20, 0xC0ADF68D, 0xC81D35C2,
+   0x675B564A, 0xC7B4CF54, 0xB4F83D1C, 0xFD35D83A,
+   //T[151]
+   0xC242EEED, 0xF194A2A1, 0x1A4330A3, 0xEB22698D,
+   0x058C4FF2, 0x791576BB, 0x2BEC5168, 0xCDC57DC9,
+   0x3A1270C4, 0xA344E82C, 0x3CA11DC5, 0xF93CF109,
+   0xBEBF2C58, 0x6CB8BFA7, 0x4E0E5B3A, 0x37CDEE18,
+   0x0F3BBA00, 0x1EC62513, 0x0B8295DC, 0x2F37689A,
+   0xBB9A32DF, 0xC65F0649, 0xFB58346D, 0x3A6B8CD2,
+   //T[152]
+   0x2A70023B, 0xBF0F8B7F, 0xBFEDB0AC, 0x48F97DD1,
+   0xFD4117B9, 0x2214EBBE, 0xCB4DF78E, 0xC2015E7E,
+   0x540188D9, 0xB2AF0789, 0x5374ED09, 0x7696E7F9,
+   0x5BEF7C85, 0x97F7C797, 0x7F526827, 0xD05A497F,
+   0x4D42DA1E, 0x3D7F9E3C, 0x1D49B7B4, 0x997204C0,
+   0xE5DF95CB, 0x344B1709, 0xABE0B7A3, 0xF18220AF,
+   //T[153]
+   0xEF3087AF, 0xD31B0B49, 0x287D332B, 0x93BD29D6,
+   0x3D62DDBF, 0x8DAF4685, 0x99360A1F, 0xB5E11E96,
+   0x18EE9B5A, 0x46B3CEA8, 0xE538F7DB, 0x33B50E26,
+   0xB18C2FDC, 0xA3BC00C2, 0x18F4CF0B, 0xA2F5A811,
+   0x4F0FD711, 0x0014D7C2, 0xCEC8CD99, 0x3BF74FF3,
+   0xDEF75BB6, 0x8243B3CF, 0x1661078C, 0x993FED7C,
+   //T[154]
+   0x0D87C057, 0x941011E2, 0x7EF498A7, 0x2DA8284D,
+   0xE8ED9FCF, 0xE3E782CA, 0x1FCA1ED5, 0x0B921420,
+   0x4D476E4F, 0x913C78B1, 0x17E7E93D, 0x9D76B52D,
+   0x7E4084AD, 0xCCFFBD9F, 0x41905FBB, 0x6661635C,
+   0xF76F89D5, 0xFBBAF714, 0x3EB53152, 0x5C54FB6C,
+   0x28B5A423, 0x6314A1A2, 0x473454F7, 0xDE9F3508,
+   //T[155]
+   0x90D5796D, 0x2D9EAB1B, 0x0788E3E7, 0xD7DE9C09,
+   0xF7EC258E, 0xA8A2A808, 0x74AD4514, 0xF0465466,
+   0x70D9C112, 0xF59D42C1, 0xE39F4E51, 0x0C3C9D5C,
+   0x7E20D2F9, 0x53833797, 0xEE4532A3, 0x05A85BAC,
+   0x1193C3A8, 0x16C3A156, 0xB3C88562, 0x72F1C454,
+   0x341CE451, 0x2B3D5A88, 0x37D970F4, 0x99252079,
+   //T[156]
+   0xD845FAC6, 0x76E9C94E, 0x3A7B1B4C, 0xC22C3DC4,
+   0x7FAE7AD2, 0xC1CD1ACD, 0x0B780D5C, 0xCC97D8CF,
+   0xB6D6D2ED, 0x28FA1863, 0x620693D2, 0xCBF7D28D,
+   0x9BEB7C22, 0xDDF7D577, 0x7CC7F247, 0x359C452B,
+   0x2E046272, 0x6581601A, 0x5964BA28, 0x578AF8BB,
+   0x22FDEEC1, 0x55186168, 0x3F110510, 0x3D300418,
+   //T[157]
+   0x7AB7B083, 0x3B837649, 0x21AFDF66, 0x77080A38,
+   0x44E72688, 0x61F5684C, 0xE3225C58, 0xF1EC5B30,
+   0xA7D0E337, 0x417FDFE3, 0xD32BF127, 0x53C166C6,
+   0xD7462640, 0x97CDCEEC, 0x4BB28516, 0x13FD2E02,
+   0x694A2BB1, 0xD8BB3AE1, 0xCA647791, 0x66A679FE,
+   0x7495539C, 0x38D612B7, 0xF0E60206, 0x162B4C4E,
+   //T[158]
+   0x24F0F0C2, 0x80CC99E2, 0xB4CC03AE, 0xBE6447D5,
+   0xF1E8474C, 0x607FE59A, 0xC7FFA8CF, 0x80E83889,
+   0xFF29800F, 0x90EEA48C, 0x83E005ED, 0x7CC604BC,
+   0xE77E10E2, 0xEF774848, 0xC043C9E2, 0xA6E0D67D,
+   0xEEF4BBB1, 0xE3BD07CD, 0x16AD34C2, 0x9259640C,
+   0xE5F61FAE, 0xB40A73EC, 0x2C60D81A, 0xB9089CD0,
+   //T[159]
+   0xC0539803, 0xD3D0739B, 0xCBBEC2F6, 0xA5126BD6,
+   0x4F8E076B, 0x01497655, 0xA5EF3A9A, 0xFD7BDC2B,
+   0xEFA01BD3, 0x0D2EE2A8, 0x85A390EE, 0xA9058064,
+   0xF93F855D, 0x32AA5CC6, 0x7347E35A, 0x0A586311,
+   0x3141361C, 0x91209B67, 0x0C0CC8B1, 0x38F98F25,
+   0x57F4841D, 0x8DE6FFDD, 0xC2516EDF, 0xF5AF1A9A,
+   //T[160]
+   0x8509E751, 0x1D34156A, 0x50BBED02, 0x0EE22CB6,
+   0x4F45856C, 0xF316E7DF, 0x5370E250, 0x7E3622ED,
+   0xE193F97A, 0x300357B1, 0x6F1479B7, 0x4A94D58C,
+   0xFB7CF886, 0xAE7C8600, 0x7743D531, 0xBDA7BBC2,
+   0xEA47A2DC, 0x4C31BCC1, 0x5474448B, 0xF9696FA7,
+   0xC5E8B330, 0xBD0B20BA, 0xF8097617, 0x08FA8752,
+   //T[161]
+   0x0856EFA9, 0xBDBD9DE8, 0x3C66AD4C, 0xA36F27C0,
+   0xAA0DD7A0, 0x408CA486, 0x1314A5C1, 0x3E877B51,
+   0xEEC4C80F, 0x56FEC23E, 0x324D6429, 0x217186F9,
+   0x470678F0, 0x0BD788AD, 0x55F89526, 0x62B95C35,
+   0x8FDAE641, 0xEF945435, 0x54304321, 0xF8E08661,
+   0x2BE02DC8, 0xFA9CCF77, 0xF12097ED, 0xD419DAE5,
+   //T[162]
+   0xC01B8051, 0x06FAACE2, 0x0EF6011E, 0xC4F0F1B7,
+   0x2B0AF06D, 0x7B51BD13, 0xA91EA043, 0x17712F28,
+   0xEE4CBAE4, 0x96EBEDAF, 0xC0AB9FCB, 0xFC54DA9C,
+   0x7D2D17DA, 0x86107555, 0x813DBB6B, 0x319A1692,
+   0xBD7201F1, 0x207CEBE7, 0xB68B14C5, 0x969BFD4E,
+   0xD99E18FF, 0xE6DFDA6F, 0x8F71B2CA, 0x7D976CD6,
+   //T[163]
+   0x2B3140A9, 0x2FBD0D84, 0x3210524D, 0xB98004F9,
+   0x0437A4BC, 0x499951CC, 0xD6AA492F, 0xC3E93722,
+   0x32F3D68F, 0x5265C1E4, 0x732D6E0F, 0x3B0578EB,
+   0xFCFFACDA, 0x192867B4, 0xAD32ACFF, 0x2B43552D,
+   0xC336668E, 0xD6DE55B0, 0xB41E8A71, 0xB8EEEE1F,
+   0xB8343C42, 0xB744A8A3, 0xA78EAB8F, 0x3192399A,
+   //T[164]
+   0x67402E0D, 0x03520C45, 0x4B874D7F, 0x45B013CF,
+   0x7031A610, 0xCC840DD0, 0xEC212CB4, 0x3205D4B6,
+   0xE8D31926, 0x58470D8B, 0x301E9D2E, 0xE1D3A6A8,
+   0x6C099381, 0x2123301B, 0x331B8350, 0xEBD1C01F,
+   0x5D1BDA11, 0x6D8F1646, 0x2A8C394B, 0xA18669AA,
+   0x1A380F3A, 0x12370154, 0xF0C96865, 0xFBCD2DDF,
+   //T[165]
+   0xC2D45EAB, 0x2524F7B5, 0xF9BDF1C4, 0xE096FA15,
+   0x233A0431, 0x0E827DF4, 0xA132E133, 0xC3290BF2,
+   0x03DB67BE, 0x30EDCB05, 0xF1A22CE4, 0x6768B891,
+   0x3A670BDA, 0x502C1E1C, 0x410152CA, 0xACFC2B67,
+   0x3D158942, 0x5CD4904E, 0x6BF1659C, 0x84D61B36,
+   0x295B9606, 0x57DF6D01, 0xFC93EC02, 0x5080169E,
+   //T[166]
+   0xBF62012C, 0xAD35FAA6, 0x99C8EFA0, 0xC5DB9506,
+   0xF8ACA038, 0x6D279B66, 0x7403772B, 0x5C045102,
+   0xD4BFE498, 0xA0832A48, 0xA51D673F, 0xBD32DC3E,
+   0x2E4E2237, 0xBC5667F6, 0xA7CB95CF, 0xC5B0C8C4,
+   0x7D228D8D, 0x44EDE905, 0xC7160ED8, 0x3FFCB384,
+   0xD92C6C32, 0xB7EE659D, 0x6958BF32, 0xB1C30E8D,
+   //T[167]
+   0x2DC6971D, 0xB9936661, 0xD99B377E, 0xB09D2082,
+   0xEE5F6EE7, 0x9F37597B, 0xE8826C62, 0x6E23D920,
+   0x08CABF53, 0xBEA835AF, 0xEA773FF4, 0x3D245181,
+   0x0506D4C9, 0x4868ABEF, 0xC53F53E1, 0x91A32A29,
+   0x5817BDBC, 0xC1ED17CC, 0x48D6B592, 0x20F09153,
+   0x719A972A, 0x459978DE, 0x05A1A6A5, 0x701432EE,
+   //T[168]
+   0xC16DEA2B, 0xCC59E052, 0x955B9E2D, 0x5582A661,
+   0x0A63FC14, 0xB3FEA8CF, 0xA1D32BF8, 0x463CA71F,
+   0x352A2C26, 0xA2458226, 0xC9438978, 0xCC3995DF,
+   0xFBA1E27D, 0xCBD61C9B, 0x323F84A5, 0x840C470E,
+   0xBBF2E0A0, 0xF21EF0CE, 0xBF8FE621, 0xF1C0A75D,
+   0xBAE2F7CE, 0xC8FAA88C, 0x3E6BC3B9, 0xA5C720D7,
+   //T[169]
+   0x0EF05A18, 0xFA306C55, 0xFF356193, 0x9791C94D,
+   0x27730E60, 0xC0C6A12D, 0x70831C35, 0xF5B0702A,
+   0x32449C11, 0x45872E8C, 0x23A41116, 0x06C21A57,
+   0x04E4DE38, 0xCE704BE0, 0xAAB21335, 0x24C3E051,
+   0xC9D2F3C9, 0xBF3FC7EA, 0x92B962D5, 0x5FFFB892,
+   0x17A8E06C, 0x0660F042, 0xC0BF0E75, 0xB00515A9,
+   //T[170]
+   0xC6B4BDB9, 0xE37EFD4C, 0x5F13858D, 0x474A79A6,
+   0xF2E768ED, 0x9F04B5A0, 0x63B99957, 0xF109513A,
+   0xA92CFDD0, 0x6E0DB30E, 0xAD3684CD, 0x2928A805,
+   0x3937ED1A, 0x1E6D751F, 0x785DDEC0, 0x8D7597E7,
+   0xC700B67C, 0x221DBA1C, 0xA56DCD21, 0xF122715B,
+   0xEAA5BFAE, 0x68CDCC5B, 0xEB94A873, 0x7618FB06,
+   //T[171]
+   0x796A15C8, 0x48EF2E71, 0x1FC7F3D8, 0x0CB89DFF,
+   0x13B8F9CF, 0xEB80F1DA, 0x9DFE4900, 0x96139F74,
+   0xC245B64C, 0x4A0A47DD, 0xEC699095, 0x5DCB645D,
+   0x096C2F6A, 0x26D84643, 0x0DD9AE08, 0xCAB86443,
+   0x66406E31, 0x2869AA37, 0x188BEC15, 0x102E0BD1,
+   0x350528EE, 0x47C64014, 0x6B1A5DCA, 0x348AE7C7,
+   //T[172]
+   0xFB3A96C8, 0x79A71481, 0x1454C1C3, 0x1E4D4990,
+   0x3705BA07, 0x3CABE87E, 0xAF684F31, 0x15FBBD0E,
+   0xAC02323A, 0xAF68FCD1, 0x678ECFA1, 0x90C129E9,
+   0x1885E8B6, 0x44FAEC5F, 0x30B661B4, 0xA2CE10DE,
+   0x3E7351D7, 0x6A41FBC7, 0xFB7F7F47, 0x4C85D221,
+   0x70C1DD3A, 0x02D4E866, 0x4FBDEED8, 0x451E5DC0,
+   //T[173]
+   0x3EFD67A7, 0xF1B7055C, 0x61645B41, 0x05D4B124,
+   0xCFE22BC4, 0x124EA903, 0xFDC190E4, 0xC8FE156A,
+   0xD2F177CF, 0x120F14C5, 0x68B65AF4, 0xB6AA0D82,
+   0xF8A3F53B, 0x8BA4872E, 0x0AD265EF, 0xB4A1EBED,
+   0xAA51B18A, 0xA46B821A, 0xAFA99B1D, 0xD1211996,
+   0xCA6492D0, 0x7EAEF31F, 0x0A53CAF1, 0x3E18CFBD,
+   //T[174]
+   0x32067F96, 0xA64D4C2D, 0x60E27D9D, 0xA5DA84E3,
+   0xEF39BC06, 0x039C07A2, 0xBE27FC95, 0xB9C92B93,
+   0xBB893AB3, 0x7CE959F0, 0x73DDBB23, 0xD75B0B3F,
+   0xB3F654B8, 0x61999080, 0x1FC8E6C2, 0xC7C32318,
+   0x686C7F65, 0x7FF8AE64, 0xE504EC76, 0x2921AAC1,
+   0x781E9BA8, 0x7C976EAC, 0x1461AB04, 0x0877C3F1,
+   //T[175]
+   0xA37F3A98, 0xA19EFC96, 0xF276DA68, 0x45220E3C,
+   0xAF87090F, 0xAC193F19, 0x71054774, 0x9E0B4283,
+   0x433B1950, 0xE40F6C9C, 0x7548B153, 0xB0BA61F1,
+   0x1838BD12, 0x76958DD6, 0x935DDD79, 0x91EAD9EB,
+   0xC28E9539, 0x7258CE66, 0x4D685357, 0x50FAAF23,
+   0x82E9B34D, 0x0721A7E5, 0x385C13E4, 0x042251CD,
+   //T[176]
+   0xE587BD37, 0xAF4A03FA, 0x29CB8104, 0x7D83E738,
+   0xECF09A40, 0xCA19FFB4, 0x0A28E75C, 0xB7931206,
+   0xF04E2782, 0x7E9C4FCF, 0x66F38233, 0x4A6AA4A3,
+   0xF2471853, 0x95F4C5E3, 0x6FEB82EE, 0xD6ED9036,
+   0x91B35EFB, 0x13DFBBB3, 0xC58C3737, 0xA385AC64,
+   0x26A7824F, 0x495E38D7, 0xDA586D4A, 0xBA13A0FA,
+   //T[177]
+   0x69FDBCC2, 0x64C2BAFC, 0xC5AD1841, 0x24721694,
+   0xEBC6A5A2, 0x7C50B834, 0x44E3577C, 0x3AA802E0,
+   0x594309B1, 0xD20E1DC6, 0x90DB982E, 0xD91DD56D,
+   0xDF9E28C7, 0x810C1104, 0xE8EBD158, 0xE55E499D,
+   0x3A8E7228, 0xAA30E920, 0xDD6B4CE4, 0xD4D3675A,
+   0x2299A0DB, 0x98975CAE, 0xB1863F22, 0xF0F83150,
+   //T[178]
+   0x05EFDD0F, 0x478DC29B, 0x23C868C3, 0xB4F747BC,
+   0x3205C9A5, 0x10A4C936, 0x0AA333C7, 0x0890A515,
+   0xC947B694, 0x03421602, 0x0F375BA2, 0xBE8C2CE8,
+   0x8F2522F8, 0x2DFA1AC4, 0x7A4C8F7F, 0x4BCE5A4F,
+   0xB0793AC9, 0x7201497E, 0xBD382CFF, 0x533B03A3,
+   0x69CF7542, 0xF45BAA45, 0x0A790608, 0x8D76F90E,
+   //T[179]
+   0x805A4226, 0xF5037A33, 0x847D52D3, 0x24BA4D9E,
+   0x729B5DF6, 0xEF73C242, 0x1ACABA7E, 0x79D5A55A,
+   0xE95400D8, 0xBA5DC907, 0x6E67CD53, 0xEC284AF1,
+   0xFFB86887, 0xFE026282, 0x0235433D, 0xB44E2226,
+   0x0A8D15D0, 0x8CB34D5D, 0xDC535E20, 0x7DAFDBF9,
+   0x2BC310C8, 0x48D17782, 0x1E503EBD, 0x8074E65F,
+   //T[180]
+   0xF162E323, 0x1932E26C, 0x2006AF38, 0x36B86ECA,
+   0x498424E8, 0x3BADBCA3, 0x0C5150D2, 0xE3DC83CE,
+   0xAAB40A8C, 0x05B88A0F, 0x3E6EE95E, 0x56EF473F,
+   0x3AA2F425, 0xF15D2537, 0x0CADACC3, 0x07183409,
+   0xDBFB6BD4, 0xBFF4E71E, 0xEDE139F0, 0x1DB2A6D9,
+   0x41EA253C, 0x12DB4780, 0xDB89D82D, 0x274D4163,
+   //T[181]
+   0x692F12F3, 0xD47C3197, 0xCBC77F1A, 0x1AA5EDCC,
+   0x1E0B0E3C, 0x1D06ED18, 0x5DAB439A, 0xF4B6A189,
+   0x97A7E72A, 0x3AF1E655, 0x12833CDB, 0x4C7CBFD6,
+   0xFD4D5619, 0xD241DBA4, 0xEDF87C27, 0xF5A1A154,
+   0x5564FBBF, 0x20A7EAFF, 0x3A003C26, 0x37AC11D6,
+   0x63177114, 0x209E45A0, 0xFD063FFB, 0x3F2ECA01,
+   //T[182]
+   0x3135FDB2, 0x60B34FB0, 0x0F4D7D56, 0x4A98B3AB,
+   0xD5368C87, 0x48BE9543, 0xA2588013, 0x01AFDF04,
+   0xA71848B2, 0x49854A8C, 0x5BD3931E, 0x387FF8D7,
+   0x140EFDC3, 0x2339AB24, 0x4E1A6A1E, 0x0E03FFC4,
+   0x49DEFA85, 0x4D3CCDD8, 0x882462E5, 0xF6318AD1,
+   0xD5F30240, 0xA9965E3E, 0x1485CC42, 0xD212C1E6,
+   //T[183]
+   0xCBCC895D, 0x6AD6C5D6, 0xCC9720A5, 0x41908EAC,
+   0x5832285F, 0x87E2F26F, 0x9B8568B5, 0x849FE9EF,
+   0x6B92B64F, 0x7BBA017B, 0x341CED28, 0x6FE33A18,
+   0x92195343, 0x547DF457, 0x21CDE14B, 0xB20BB9A8,
+   0xE66E68B9, 0x8BBE4F91, 0x5744CF35, 0xDADD2C9C,
+   0xBE47F63E, 0x1BB8DE52, 0xF55867B5, 0xB6AC1A6A,
+   //T[184]
+   0xDDC21ACB, 0xD725CFD8, 0xFDA1330C, 0x3BD1BF99,
+   0x156621E7, 0xD8C4ABEA, 0x983C4FC7, 0x2F761CE8,
+   0x74366DC2, 0xF65C8216, 0x571E0867, 0x710C5A77,
+   0x3595552B, 0x2609E4E6, 0xFEB63CF1, 0x5B28E4AB,
+   0x3FD2BA71, 0x203166D6, 0xBE57678D, 0xA317A0CC,
+   0xBC2DB239, 0x4F620DC2, 0x94C4C6A7, 0x08D0D5A7,
+   //T[185]
+   0xED8C9199, 0x90F7D145, 0xDE2C3020, 0x9AD1909D,
+   0x2533CC3F, 0xC8F7BB18, 0xB0E5418C, 0x9CA77882,
+   0x6A6F47A3, 0xB44D893D, 0x3F43AE12, 0xB6B71337,
+   0x53C4115F, 0xF9E2F0F4, 0x39D66752, 0xBEA1B4F0,
+   0x8DC63E2B, 0x19E28D54, 0xCCFCC518, 0x79BB42C5,
+   0xC3880092, 0x7B2C3F20, 0x49138343, 0xDCE60D0B,
+   //T[186]
+   0x44733EF1, 0xE272CDC8, 0xC4B95916, 0x64B0CE5A,
+   0x2104F0EB, 0x117232FD, 0x7011C40F, 0xEDA738BF,
+   0xD2941A9D, 0x6F64C5B6, 0x82815816, 0xE1415FCF,
+   0xD63DFFC7, 0x0B56F15E, 0x0C4BEE91, 0xBFAEFD64,
+   0x8F02BFF3, 0x555D5DF3, 0x2E0705BF, 0x6541F6C6,
+   0x259AAB95, 0xE64B17C7, 0x4AAB0524, 0x4D28AEB2,
+   //T[187]
+   0x13E95D9C, 0x2E823C81, 0xF99CD636, 0x7763E34D,
+   0x02D3FD43, 0xE4613F82, 0x7A28E9B8, 0xC5FEE628,
+   0x0336D149, 0xF595645E, 0x8AE5B28D, 0xBA4EF4AB,
+   0xBDBCA1D8, 0x65CD22F2, 0x2E9618DD, 0xCD54CD36,
+   0x5F0DC609, 0x178FE25A, 0x2CDFD7F6, 0x877A21D7,
+   0x7A818220, 0x5DF8BEF2, 0xD01A6A51, 0xB7562CAB,
+   //T[188]
+   0x145E332B, 0xE95BC7EC, 0xE4729397, 0xA7537C0C,
+   0xD52D1727, 0x2CEF6D9E, 0x1A631621, 0xF3EE1A84,
+   0x0EF1F64E, 0xB868FF6B, 0xBEBEE84D, 0x1B82A1DC,
+   0x21D3B8D8, 0x58BF0187, 0x66678D92, 0xEE6D39D6,
+   0x96ACFA0A, 0xA06D9268, 0x52371A2C, 0xB3D7FE30,
+   0x05C8E053, 0x3F5031F3, 0x3383843C, 0x8A422BF5,
+   //T[189]
+   0xFB54BED0, 0x568EF16D, 0xAA1CF1A8, 0x07E3ADED,
+   0x5B31BD02, 0x3D69DF5C, 0xF5FDB018, 0xD04466D9,
+   0xF5021941, 0xAD5A8328, 0xBAC05E74, 0xEA31018D,
+   0xEF94DE69, 0x38207128, 0xD4F66FCC, 0x6E5A6381,
+   0x759E06C9, 0x526F2EBC, 0x05C1059D, 0x99128AA7,
+   0xB0540AB1, 0x602AB8BC, 0x37856EA6, 0x5A6B62CC,
+   //T[190]
+   0xDD985F10, 0x1915903B, 0xBE7D372A, 0x2E0830AC,
+   0x14C209BF, 0x177AC47E, 0x27B82494, 0xD5F3738A,
+   0x76D7BDF9, 0xCAD7AB07, 0xA1D272B9, 0x6A93AA74,
+   0x38061FE6, 0x15FC3841, 0xAEC3ABA8, 0xEE961BB2,
+   0x4D9822DB, 0x283F89FB, 0x839ACA1C, 0xB14F7C64,
+   0xCB91402F, 0xDB2FDE49, 0x43340A81, 0xF846CFFD,
+   //T[191]
+   0x0D2A9164, 0xEE186C3C, 0x22F811E9, 0x8A90E065,
+   0x2CA52980, 0xFA1725E0, 0xADD1F445, 0xDB752BBF,
+   0x912CF254, 0x9A9682D3, 0x2120F855, 0x784FEA1A,
+   0x11CE2704, 0xAD628770, 0xB1A8DC9B, 0x3A388DD4,
+   0x92858823, 0xC8930F97, 0x198B3A01, 0xD3899502,
+   0x7E449AEC, 0x60D8476D, 0x5F0E14B8, 0x7B0D5B8E,
+   //T[192]
+   0x96F14CC8, 0xDF0FFEE6, 0xABC0CB43, 0x2276D4D3,
+   0xCED5D85D, 0xCD7CA39D, 0x41DAD40D, 0x56186C6D,
+   0x2F7A0AD4, 0xEB27143E, 0x3F31BD4C, 0xB3CA2CD9,
+   0x878F465B, 0x6EC27B7B, 0x3FEF2BF8, 0xF365EE07,
+   0x2E242896, 0xC3D88B17, 0xE955866F, 0x20A897C6,
+   0x02910B04, 0x54E7183A, 0xAEF18DAC, 0xCFE303FF,
+   //T[193]
+   0x286883CF, 0x0CF4F6E2, 0x6A7C5514, 0x31E58AE7,
+   0x57092BEA, 0xF50D905F, 0x3A778AA7, 0x76B1CE84,
+   0x6B12247F, 0x1040DE49, 0x29A20558, 0xA9901878,
+   0x462E61E3, 0x4DDF3691, 0x77C542ED, 0xABBB6CBF,
+   0x74FB1895, 0x13D33501, 0x587799BA, 0x4D25BAC3,
+   0x6EEAEF66, 0x31F7F81E, 0x52FD6D43, 0x406BE8B6,
+   //T[194]
+   0xED8C32E9, 0x0336967D, 0x7AC18C51, 0x96EBF54B,
+   0xEB484A8F, 0x8B9A3BFF, 0x246A532E, 0xBE919D36,
+   0xFA579211, 0xC953171F, 0xDC0B5F99, 0xCBA8005F,
+   0x1FF92DF7, 0xE8C5D8B3, 0x10826BBD, 0xD9B7F2EA,
+   0xA412E7AA, 0x9007D046, 0xA951CD5C, 0x038878D9,
+   0x2CFEAF23, 0x28BA01A2, 0xA815D5F9, 0xA61395FF,
+   //T[195]
+   0x186C4455, 0xE4E08D15, 0x8F073EB6, 0x41DDED62,
+   0xD3071205, 0x3AAEA11E, 0x94224928, 0x8E38E2D2,
+   0x773F1F97, 0x3121A5DC, 0x62B3F664, 0x6A8E40F1,
+   0xE284B651, 0xF953F601, 0xACF2D87B, 0x96B0E8BC,
+   0x364B2D4F, 0xAB04E14A, 0x4D04A8BF, 0x2D62022E,
+   0x36CF049B, 0x77DEB9D3, 0x27F4AA68, 0x6201B44C,
+   //T[196]
+   0xEC0C985E, 0x9244875F, 0x8E1179B7, 0xA65BFFE9,
+   0x8B4C1EBF, 0x473C65AA, 0x4D1E5530, 0x37945319,
+   0xB3BD5361, 0x4268078A, 0xA90A2D35, 0x0D835C1A,
+   0x20128952, 0xFDDEE260, 0x2B4B9B78, 0x6B303A24,
+   0x72C68F24, 0x6CC70EC2, 0x2A952A49, 0x244EAC73,
+   0x27934DDB, 0xED6296AF, 0x6430AAF9, 0x8695E0C7,
+   //T[197]
+   0x8DCF4DBB, 0x95463076, 0x0077302D, 0x304F5FC3,
+   0xCE491DA4, 0x54D99D3D, 0xE01981E5, 0x19D311D0,
+   0x08335CC1, 0x7DAAFA43, 0x13D20C68, 0x642B8B06,
+   0x6F1708DD, 0x02F04683, 0x264CCA6E, 0x24C60A30,
+   0x7BCF14C1, 0xAC4AE80E, 0x7EB79B25, 0x328C2807,
+   0xA090A969, 0x080C24C0, 0xE92C4175, 0x6C0805FD,
+   //T[198]
+   0x1EC4E09A, 0x9F791F30, 0x1DF01C03, 0x26F4A101,
+   0x5BD7C2F3, 0xF451FB1D, 0x76FFB579, 0x0156D73D,
+   0xCA94D27F, 0xA20FB207, 0x68864331, 0xD9F400C6,
+   0x76170D82, 0xDB0637AA, 0xAD32E3BB, 0x4A857C6B,
+   0x7ECEB64D, 0xB8C4D8C2, 0xEE92986E, 0x7F986810,
+   0xFD825C69, 0xF5804E40, 0xDF2FCE68, 0x8D8220B7,
+   //T[199]
+   0x54F9DD65, 0x103FF29F, 0x15B12A89, 0x9F5C922A,
+   0xF7742637, 0xD9EF08EE, 0xFA89676D, 0x2EE42833,
+   0x69BB45DA, 0x8678CD63, 0x159177F5, 0x1D931720,
+   0x016ED0BC, 0x19A0A134, 0xC5440B0B, 0xCA572ADE,
+   0x9565B6D1, 0x382A5D5D, 0x78C537DA, 0xE05E3A30,
+   0xDB97FC07, 0xD1D3376E, 0xC9AA3BB3, 0xDB531459,
+   //T[200]
+   0xD1C30ADB, 0x4E527C19, 0xE6D1970E, 0xAE3DFA10,
+   0xADFADBE8, 0x251F5F2C, 0x668F089B, 0x2EB871F0,
+   0x06125E11, 0x1E69CEBD, 0x6B1BB43E, 0x249ACA5B,
+   0xE4AA859B, 0xB8CC48D4, 0xDADEEA41, 0x38D0FC14,
+   0xCD51DEC8, 0x9CDA7DB7, 0xCC3296EF, 0x39179967,
+   0x43319395, 0x9A691D0C, 0xCCF88050, 0x797DC6C9,
+   //T[201]
+   0x970ADBCC, 0x4A5C612B, 0x7A7A9D41, 0x00E3DBFF,
+   0x1F59A72C, 0x200A9ACD, 0xE7F99B06, 0x551E96FC,
+   0x372C370C, 0xB9EA685E, 0xD7F730AF, 0x43CD306E,
+   0x7F23E775, 0xD5297538, 0xD9B2D4CF, 0x205BAC6A,
+   0x8E9C336F, 0xBB072032, 0xC3BD3E6B, 0x750FB18D,
+   0xA591BC2F, 0x2D6FA5E9, 0xC2D62340, 0xBD307A17,
+   //T[202]
+   0xDFBF4E5B, 0x5F205325, 0x909F699D, 0xFBFA518D,
+   0xA4EA0BC7, 0xB57CF849, 0xC7FEABF7, 0xD9D7BFB3,
+   0x37FF2990, 0x988A0D50, 0xF53FF9D2, 0x5EF036FF,
+   0x169B0D11, 0x68278517, 0x05CAB851, 0x591C9679,
+   0xC28EC5A4, 0x510C6F92, 0x410F4F7C, 0xA2D6B3F5,
+   0xC13E0E2C, 0xDC2A9783, 0x8807879D, 0x361E7DB1,
+   //T[203]
+   0x797DFFB7, 0x93D5F7C8, 0x84DF3DB9, 0x5DA17875,
+   0x74BBE0A4, 0x53533223, 0x788AC2A0, 0x19ABCA91,
+   0x2028256B, 0x21826CCC, 0x9052004D, 0x801D682B,
+   0xB9E828BD, 0x2C834F87, 0x849D315D, 0x85A1DB9C,
+   0xE6B33F33, 0xA22646DC, 0xD4F693D7, 0xA4F7FBBD,
+   0x83B3C196, 0xEF34D082, 0xB862806F, 0xD420DDF3,
+   //T[204]
+   0x852504C3, 0x82569362, 0x5A31DB1A, 0x98959368,
+   0x2A86913C, 0x97FCE9E5, 0x2299B37D, 0x7F36AE8C,
+   0xF409A6D2, 0xDD892AB5, 0xC38A921D, 0xFA4C54B6,
+   0x7CDCB096, 0xCD9AFC18, 0xAF0B86C8, 0x3CE0E817,
+   0x7ED8BE7E, 0x8FD9857F, 0x849EB64B, 0x80D1FCB2,
+   0xFEA5F79E, 0x15E896F5, 0xF6637070, 0x196E0D03,
+   //T[205]
+   0xB75A505A, 0x84223D4E, 0x28711380, 0x9BB6CA58,
+   0x57F36D50, 0xF66FCA36, 0x140FB985, 0xB654C6FF,
+   0xFC50D0FE, 0x7102EBDF, 0x9F3139A2, 0xE6102A08,
+   0x2BF82F5E, 0x1537F2A2, 0x83EED291, 0x40BEE88A,
+   0x848FA1ED, 0x48631F58, 0x0FFAADE8, 0xF3D49953,
+   0x12254B64, 0x3B4097BA, 0xD05AADCE, 0x297A9C25,
+   //T[206]
+   0x19278D70, 0x05DD9088, 0x743BC231, 0xF0C69A2D,
+   0x4295C809, 0x8A5EC72D, 0x66AE20C3, 0xD8EFFAB5,
+   0x7D16FD47, 0x13758451, 0x67FD8E7C, 0x9B4BA94E,
+   0xFE855CE7, 0x6BE3B830, 0x183C2A03, 0x24ACF04D,
+   0x00EE27DC, 0x20DF361E, 0xA610383D, 0x6CBE0388,
+   0x64835F3A, 0x91348478, 0x52FEF72A, 0x28EEFA6E,
+   //T[207]
+   0xED3629F7, 0x97766965, 0xC502C74A, 0x58E9C622,
+   0xDF5BBCD5, 0xB189B6AB, 0x5B2B85F8, 0x9E937CDC,
+   0x9ED0C1D9, 0x5EFF631B, 0xE7F5A1A3, 0x2033EDF6,
+   0x3A597408, 0x6E42990A, 0x075CC602, 0xAF7D68C5,
+   0x80E4E0D5, 0x52B6525D, 0xDE685CC3, 0xCCA3709A,
+   0x842025B2, 0xA6F35129, 0xC9912940, 0x7D26E33E,
+   //T[208]
+   0x7A7D2A5E, 0xB03B2E23, 0x63D6B4F5, 0x8116BA83,
+   0xB0E589BD, 0xF276D787, 0xF6DAFCB6, 0x4968A14A,
+   0xFB9CCDA2, 0x7306E3A2, 0x233FE072, 0xB682836D,
+   0xD3C85218, 0x3E77D8E2, 0x31438810, 0x7557ED21,
+   0xEA5EFF6D, 0x62700852, 0xE1305698, 0xA1B18B37,
+   0x9FAEC7AD, 0x601C2985, 0xBBB41589, 0x77C13500,
+   //T[209]
+   0x7FD107A5, 0xD4327A58, 0x3870E4FC, 0xC8948D4C,
+   0x567B979D, 0xDA5436D4, 0x801B4B04, 0x6F6B8A9C,
+   0x45A52711, 0x709A4AF7, 0x3E36F68F, 0x66FC8EB2,
+   0x1CEAEAB8, 0x4A20D321, 0x7553FB24, 0xF0EFDFC6,
+   0x71649B60, 0x4EA7FC0F, 0x86438E6D, 0xE5D6706F,
+   0x0B3E12F8, 0x79270D02, 0x979A80CF, 0x174BBA71,
+   //T[210]
+   0x9650F913, 0xEDE5FA6A, 0x8B5C920D, 0x418415E9,
+   0x1EBD9884, 0xC37EEFE2, 0xA29B1EA1, 0xFDD34631,
+   0x0F29050A, 0xAD6E1EA7, 0xA3D0F46D, 0xBB2A267F,
+   0xFDAA052B, 0xEA2DEBED, 0xEE7E6008, 0x9C8E25FE,
+   0x42E020C2, 0x16BED8B2, 0x0B3EB086, 0x4AAD7D5E,
+   0xEAAE2E72, 0x00E4BF5B, 0x7995FCCF, 0x0BF0CB2B,
+   //T[211]
+   0x58373B69, 0x70340E61, 0xD6E15AE5, 0x80E84597,
+   0xDE67552F, 0x4ABB647F, 0xAFAC5296, 0x3EED7C70,
+   0xAEB57B3A, 0x9D51C931, 0x1ABD1042, 0x16090A4E,
+   0x6BB40267, 0xCFFCA0A0, 0x7D290EC4, 0x1B5BAD92,
+   0xC68EBE61, 0x3BCF7F2E, 0xC8AD6EBC, 0x76E063EC,
+   0x4F7E853A, 0xFA2514EB, 0xE5524709, 0xF1D95FE3,
+   //T[212]
+   0x394597EE, 0x3A5B7C68, 0xA8DB4AF8, 0xB2958D0B,
+   0x467EDE43, 0xF35981BF, 0xAE2CCF94, 0xA9D69851,
+   0xE19B096A, 0x16B5CE27, 0x9A94133C, 0xA74717C1,
+   0xFDAEC16C, 0x5EAC4E29, 0x720156AB, 0xC13E9466,
+   0x01D7603B, 0xB30EE1AC, 0x85E8C6BA, 0x71E9FF73,
+   0x3225ACEA, 0x5665A684, 0x10F382B3, 0xCBB017DA,
+   //T[213]
+   0x12F67374, 0x76B4D611, 0x18F79C6D, 0xB23F524D,
+   0x6FF4002B, 0x704B6C06, 0x14D9CFAC, 0x55F3976E,
+   0xB80F10EE, 0xB410FF78, 0x5A11AE63, 0xD80DBB08,
+   0xEA991573, 0x56639D81, 0xA9226B25, 0xCC6FB17C,
+   0xFA411BAF, 0x4E8EC299, 0xFBB1B051, 0xBD8C6279,
+   0xFDDA3D87, 0x145AC792, 0x5FF74447, 0x744BF1CE,
+   //T[214]
+   0xF4F255F0, 0x3902C38F, 0x535EAD64, 0xA418715D,
+   0xD51E0DD4, 0xBED99423, 0x6465EA0D, 0x8E57BF3C,
+   0xDEA4528C, 0x4EB540F3, 0x4DD86D10, 0xE725D5D7,
+   0x4DF9BA12, 0xB248AE02, 0xA79FCCC7, 0x8C4005FC,
+   0xEBA7007E, 0x79022586, 0x4C24302B, 0x5EFA6D71,
+   0x2D075F61, 0xD4ABE30A, 0xE218F691, 0x248E0277,
+   //T[215]
+   0x7C3DDE8C, 0x71E917C5, 0xE18718B3, 0x6F0830F1,
+   0x8256FDA4, 0xDD766709, 0xD5FD4E93, 0xC20C9A2C,
+   0x3A9DB815, 0xEE53588A, 0x0BCE2706, 0x9CF6AB50,
+   0xDFB4E523, 0xF0225C5A, 0x8FB4B53A, 0x0E4A70F6,
+   0xA7B62726, 0xFAC3639B, 0xE0DA88B2, 0x9C6B835F,
+   0xCDBEFE89, 0x52A15A7A, 0xE1E146B5, 0xFEE17A83,
+   //T[216]
+   0x38DAB5F2, 0x9D323AA4, 0xE94410C5, 0xC966DE97,
+   0x6A9E24F5, 0x0FAE6519, 0xA2EBB67A, 0xDF74E607,
+   0x00F0071C, 0x229DC83C, 0xD5D4C13D, 0xC2CB3801,
+   0x48513AC5, 0xB2AE4616, 0x27B329AB, 0xEC35730A,
+   0xFC8035D9, 0x31CAFF90, 0x075FB18C, 0x2A0BB94A,
+   0xA86A49BB, 0x90F5668B, 0xE261B969, 0x09DEEBF9,
+   //T[217]
+   0xD0C007EA, 0x6AA63E53, 0x22EF5C1A, 0xED4CF861,
+   0xA3B937FF, 0xD2540B73, 0x18586791, 0x3F3D58BB,
+   0xD4725AA0, 0x842F1201, 0x3AE1BAB5, 0x953EACFA,
+   0x47AA86EE, 0x001AED95, 0x36167775, 0x74B20F01,
+   0xAB1FF8B1, 0x02279D19, 0xA81859BF, 0xE23470FD,
+   0xCE2D4690, 0x6EB6809A, 0x825BF821, 0xFEDA8F4C,
+   //T[218]
+   0xE893FD99, 0x06FBD239, 0x48D54A88, 0xD64DAC1F,
+   0x08FA4488, 0x464AA03B, 0x194BB7E4, 0x8420CFA4,
+   0x1606531D, 0xADFEF850, 0xA92F6A8C, 0x91D5CD84,
+   0xC8642CDD, 0xBC4EFD1B, 0xB3C08421, 0xC6B20B67,
+   0x5B596979, 0xE46E6485, 0xF5B28A74, 0x3F65CC49,
+   0x93E3C36A, 0x9486D812, 0x7231F5BF, 0x10036B22,
+   //T[219]
+   0x0C657B67, 0x4CE645D9, 0xB9474197, 0xAFFEC276,
+   0xA8819433, 0xBD9C4E06, 0xAB6E13C6, 0x967E3F1E,
+   0x9EADDD88, 0xC2D5769D, 0x5DC7CF9D, 0x0F3F30C0,
+   0xB6A0D265, 0xB2B3F38B, 0x43ACB40F, 0x9C5822DC,
+   0x813CA8FF, 0xD6B1864B, 0x95231638, 0x92A0421E,
+   0xE3BBC5B6, 0x5B7CF080, 0x6CF21A7A, 0xD7ECE44A,
+   //T[220]
+   0x16EC3867, 0xDDF8D37F, 0xB967EFF9, 0x252BD757,
+   0xA5ACCD8B, 0x0AC8E8A4, 0x951986A8, 0x5A72AC79,
+   0x98D63E0F, 0x48CE449B, 0xF7E7B69F, 0xB178A028,
+   0xE7B9B5A1, 0xDFA6B9D4, 0xEDA67C76, 0xF29828A3,
+   0x2521EDD2, 0x58A911DB, 0x6414AEF3, 0x5019DF19,
+   0x59C9A221, 0xBDCE4B71, 0x9C878078, 0x2B217318,
+   //T[221]
+   0xB6B51AFE, 0x78EDBF9B, 0xBC8C063F, 0x1FBA40F6,
+   0x7381547C, 0xFE891265, 0xCA6B5B99, 0xE66DA268,
+   0xC5AEF797, 0xAEA55D5E, 0x790563F0, 0x9E357248,
+   0x7C008324, 0x99D320EC, 0x8EB3C854, 0x933F7E2F,
+   0xCF281107, 0x8D89BEFF, 0x8B7618EE, 0x6CDC1917,
+   0xEC92537F, 0x6B0C575A, 0xEDF20351, 0x7671F614,
+   //T[222]
+   0x66C3B234, 0x8FB6D438, 0x962F5B10, 0x1BB84421,
+   0xFD184480, 0xEE69A8C0, 0xE4D14A70, 0x1F058AED,
+   0xB46B9771, 0x4AF4E409, 0x05322D4C, 0x53518E69,
+   0x28D1FDFE, 0x8645BBB0, 0xC75F8D0F, 0xE0F04C8F,
+   0x5B300771, 0xA3F56F02, 0x85F513B6, 0x7B7D032C,
+   0xB2C685EF, 0x785239F1, 0x2A788CF4, 0xB23850E4,
+   //T[223]
+   0x097E1D97, 0xD30EE076, 0x7C4F2FD5, 0x3E61DB18,
+   0x4E634BE5, 0xD571A19C, 0x9C56FF62, 0xCC67FFB4,
+   0x472E2AE5, 0xB03A3965, 0xF0B479C3, 0xDA0E4C73,
+   0x0AA17508, 0x602BC68F, 0xF165544C, 0x0E637F6C,
+   0xF69B0842, 0x389AEC11, 0x3B9EFE21, 0xC721AFD5,
+   0x28DD70E9, 0x0CC3FA93, 0x2908A954, 0x2E7BAEAF,
+   //T[224]
+   0xD7EFFB1C, 0x07DEEB45, 0x69690B5C, 0xBC10C69F,
+   0xB9CB41DA, 0xFB433BA3, 0xDB9CE8C2, 0xC728AE64,
+   0x83C70ED6, 0x5896C2F6, 0xC93604C3, 0x7DB69C60,
+   0x18924797, 0xF2D565DF, 0xC94401C3, 0x05B788EB,
+   0x49154327, 0x1AE34416, 0x0DD46E47, 0xA54D9707,
+   0xCA604996, 0x44379BB3, 0xD80F3949, 0x4504274C,
+   //T[225]
+   0x6DB68B26, 0x75C5173A, 0x98BD23B2, 0x9785EF0B,
+   0x3B7251AF, 0xD5B6FEB9, 0xD1787C8F, 0xA0509DD4,
+   0x91E254D1, 0xDE1F86C8, 0xAABB5E6B, 0x8A90F188,
+   0xCFAF777E, 0xEBE9C4C5, 0xBAF3C255, 0x1EBF0FBA,
+   0x0C995729, 0xDF40FAFA, 0x9A5EF591, 0x36071B63,
+   0xC9E7FE62, 0x0419ECD6, 0xFADFCA7C, 0x0CB563F4,
+   //T[226]
+   0x843A8503, 0x3A07C750, 0x9223B5B9, 0xCA529810,
+   0x52C9EB98, 0xFAC42BFD, 0xA2928A33, 0x8C17FF34,
+   0x3045D7DC, 0xE1789A5A, 0x3B6EDE7A, 0x12354F46,
+   0x992502F8, 0x95FE2D94, 0xA630E4A8, 0xAB4905E3,
+   0x428A30E1, 0xABFEEEE3, 0xE026E6EB, 0x1EF82E5F,
+   0x3945ACF7, 0xB742294B, 0xD81B11A3, 0xBA6F80A3,
+   //T[227]
+   0x1B4EFFFB, 0x03C214B9, 0x54090630, 0xCDB098E8,
+   0x28213E41, 0x64E04659, 0x1D34556E, 0x52B4934A,
+   0xEDFFB93C, 0x24D10800, 0x86DA7481, 0x7A16854A,
+   0x1100FAFC, 0x633F4594, 0xD2105FAA, 0xCC84D3E8,
+   0x7F3B980D, 0xF37E0B2A, 0x2E08F484, 0x7F141D41,
+   0x0BE45035, 0xB137C2C6, 0xE7E8531D, 0xB2BBB089,
+   //T[228]
+   0x78367AF3, 0x853E1231, 0xF78F7FE1, 0xFFF30F87,
+   0xD995D218, 0xBAB00750, 0x7C443540, 0x2D136FE4,
+   0xCFBDC884, 0x185057A7, 0x012BE469, 0xF4F6162C,
+   0x5AE296CF, 0x42C1498D, 0xCAA7EDB6, 0xC8628663,
+   0x16B12110, 0x0D11E3ED, 0x7BD26A22, 0x6E29BE3F,
+   0xF6D1FC0F, 0x0ACFC54F, 0x2ABA6249, 0x060CD3F9,
+   //T[229]
+   0x9FC5FA73, 0xBB81BD21, 0xD3636438, 0x037CA902,
+   0x88625A93, 0x077ED7D2, 0x9E81AE49, 0x29114A11,
+   0xA7A4115F, 0x4DBFF1B6, 0xB2A5C261, 0x74DD9FAD,
+   0x7E1BE671, 0xC2980EEA, 0x8B47D4A6, 0xD8B29926,
+   0x798408E3, 0xE18A8ED7, 0xDEF8A1F1, 0x82BB417D,
+   0x09A8BB56, 0x70C26070, 0x372CB28C, 0x55001FBB,
+   //T[230]
+   0x15969DEC, 0xDE3AF2C0, 0xA023A40D, 0x6526786C,
+   0x6782D071, 0xAFD1F686, 0x67B07302, 0xDF60866F,
+   0x548AAD9B, 0x0F29756F, 0x56FCF350, 0x3C6EF79B,
+   0xEC5C2481, 0xF8FBCDF0, 0x46F531F9, 0x4D140179,
+   0xD44C0720, 0x0A408EC3, 0xF9018A72, 0x219F628E,
+   0x7458BC5F, 0x20F1E2B2, 0x9591891F, 0xA6D943D4,
+   //T[231]
+   0x15D6B69D, 0x0C9543DE, 0x53EFD969, 0x02808F70,
+   0x9433A7FA, 0x5866A0D2, 0xCE3D96DA, 0x11217E9C,
+   0x23FC4AD7, 0xE1F7DB76, 0x55A9976D, 0x60AFC51C,
+   0x91EC3098, 0x9AC975D5, 0x576B4940, 0x1EFE92F4,
+   0xDC502D39, 0x6046F8B9, 0xE138E3EF, 0x46D26335,
+   0x3DD84035, 0x34D2593D, 0x8DA0B0D5, 0x4D633010,
+   //T[232]
+   0x38C80EC4, 0x80CAE549, 0x7C45C531, 0x7C7F7475,
+   0x1649F113, 0x286F1EFF, 0x955D5700, 0xFFC634E3,
+   0xA0568F63, 0x1B55614B, 0xBF11415F, 0xA8929A82,
+   0x098C3152, 0x189C65D6, 0xD8EC8B28, 0x95C2D944,
+   0x8E6D14F7, 0x0DAAD0F9, 0xBC384249, 0xD01AF2D6,
+   0x870A4F8C, 0xBC8367F9, 0x4A67635F, 0x977B3632,
+   //T[233]
+   0x2C93F7CE, 0x9D45CDF9, 0xF13303B6, 0x0EDCBBD0,
+   0xBC612408, 0xB38F0A99, 0x9F6DC7FA, 0x46454D04,
+   0xDEB28748, 0x7635BA61, 0xFFF7A81B, 0xD8D77BA5,
+   0xB8CBC9E0, 0xD5A77658, 0x908AE257, 0x2D8BE719,
+   0xDBF05550, 0xCE9B9B74, 0x7F3512BC, 0xF661DD51,
+   0x362CAFF1, 0x7E56BBFE, 0x13487895, 0xD4783B8B,
+   //T[234]
+   0x8A802F80, 0x7709FBEA, 0xA9EBEC62, 0x398BF2DE,
+   0xF385E13E, 0x28428AA7, 0xB4B848EA, 0xE2166C26,
+   0x977C7C26, 0xB57AA983, 0x697B67C1, 0x17C4E8A8,
+   0x636F5F4C, 0x293F239B, 0x3C867DB1, 0x6BFDFCED,
+   0xF111B474, 0x851FAE2E, 0x51956BAA, 0x02311B09,
+   0x796D0730, 0xA5D44855, 0x743237D8, 0xC0500A67,
+   //T[235]
+   0x47CEF8B4, 0x38E36DDC, 0x1004CA9F, 0xCC8204EE,
+   0xE8FCE412, 0x44C9A5BC, 0xD3D964F4, 0x13B70F17,
+   0xA4483DF3, 0xDC731C22, 0xD202EA7A, 0x7E8C5117,
+   0xDB417186, 0xEAB8AA45, 0x1AEA0B17, 0xF35934D6,
+   0xCC39B5E6, 0xDFE1F96B, 0x56D05C7D, 0xAE006313,
+   0x2E55BA28, 0xFD548659, 0x9FB2AD96, 0x290F6C85,
+   //T[236]
+   0xC2093318, 0xFB4CD6EB, 0x70709D85, 0xF1C3BF1A,
+   0x69A5A33D, 0x3B05E45E, 0x10ACBD09, 0x5CD13744,
+   0x947B42B8, 0xE43CD88D, 0x0F20F3E1, 0x6DBF30FB,
+   0x7ABC6449, 0x387048F6, 0x62AB572E, 0xCB2E8B3D,
+   0x1241126C, 0x22B78F94, 0x05DAF2F8, 0x4AE234D0,
+   0x45EF3BF3, 0x347A60E7, 0x614CB2D5, 0x778737FF,
+   //T[237]
+   0x682F5C49, 0xD473E508, 0x240193EC, 0x2CB95735,
+   0x7CE5D395, 0xA94DAA14, 0x076CB9F8, 0x2A6AB855,
+   0xBC66BEE8, 0x5ACD5F0D, 0xDAA1F7BD, 0x81416379,
+   0xFEC64A00, 0xA83E770C, 0x0967D448, 0x72732725,
+   0x185E00D6, 0x7C5F6A4D, 0xCC5D9C7E, 0xF34CA95B,
+   0xD1299C71, 0x16AE4E32, 0x11C390F4, 0x3BB519E9,
+   //T[238]
+   0xDDB23A71, 0x99C6CA68, 0x00CCE7B8, 0xA986B6EA,
+   0x2079538E, 0xC5D9F6F2, 0x1FD5B3A4, 0x5E43C6D7,
+   0xBE82721E, 0x368C66EA, 0x2D14E807, 0xB6DCA715,
+   0xC10680AB, 0x418ED60D, 0xFCF93797, 0xA3846E9D,
+   0xD93E39EB, 0x31F8A177, 0xEE8A7182, 0x5853D4EC,
+   0x812DAFF7, 0xF4C349FE, 0xC58524BF, 0x7764C4A6,
+   //T[239]
+   0x9F90AD14, 0x9371E4A0, 0xFE3E175B, 0x9B5DB3C5,
+   0xBF4AB690, 0xF1011B9D, 0x5860D9E1, 0x439F2B30,
+   0x598381C3, 0xD24CC715, 0x9F0E4B8B, 0x08F2C25A,
+   0x439046C8, 0x39C181D9, 0x232787E0, 0xAC763FA1,
+   0x836B2603, 0x3D67C0A6, 0x95250D3F, 0x49440901,
+   0x5F10F6CF, 0x73B27328, 0x105AD9AB, 0xC95F1243,
+   //T[240]
+   0xF08BFCCC, 0xD96F44F3, 0x645BD056, 0xCA622DF0,
+   0x95E20F57, 0x5B4ADBCD, 0x7448821D, 0xE0B98F40,
+   0xCE9551AD, 0xAA47EE1F, 0xA16E66EA, 0xBFBF3813,
+   0xE2155809, 0x1513F305, 0x74585FC1, 0xB599BCDE,
+   0x77A53EAA, 0x83F1166A, 0x5BD1BBF4, 0xC814E6BC,
+   0xBB4ED15B, 0x37D5428B, 0x63B294EE, 0x7DF1E7B3,
+   //T[241]
+   0xFA052C95, 0x534D8541, 0xF1F55469, 0xBC063499,
+   0xEC9EDBFB, 0x3B7986F6, 0xD2B64ACC, 0xF1321249,
+   0x9E670780, 0xCE914D9F, 0x7003D1A1, 0x9A032FB5,
+   0x4D4B7847, 0xA890E3FA, 0x9193F6E9, 0x0637F534,
+   0x26FEB46D, 0x282DC978, 0x8263028B, 0x030751CD,
+   0xBBAAC16C, 0xE47F2297, 0xE350E577, 0xEC23076C,
+   //T[242]
+   0xD3F90B47, 0x21923546, 0x68C9BFCB, 0xA9964EB3,
+   0x7918BD64, 0x3D2EC33D, 0xECA88F00, 0x7FBB12D6,
+   0xBB39B122, 0xB917B6D9, 0x12DA4C5A, 0xC9AF45B9,
+   0xB9BAB187, 0x54D12827, 0x94C062DA, 0x6064F2B6,
+   0xB050F90D, 0xC895C849, 0xB6D6B33E, 0xAD28E602,
+   0x490120DD, 0x19E3661B, 0x185DA366, 0xF284D6EC,
+   //T[243]
+   0x8716B3DC, 0x97012806, 0x7DA68CB1, 0x93E917AF,
+   0x981A69CF, 0x959E6B54, 0xAEFEA145, 0xEC8CACA5,
+   0x15C61948, 0xCB2A6F91, 0xEF193F80, 0xBFAD414B,
+   0x6694D036, 0x8155935C, 0x824D308F, 0x7B124AF5,
+   0x2DC7C4B6, 0x344743CE, 0x70F30DE1, 0xA42AD4B5,
+   0xD2677380, 0x7AC95EF2, 0x14C6CE67, 0x73BE4446,
+   //T[244]
+   0xA086DFF8, 0x197267DE, 0x198E5C3C, 0x51602B9F,
+   0x39EE8AE8, 0xF39BF272, 0xFCE8A7B2, 0x6DE10EB0,
+   0x9EC7875A, 0xF7FF625F, 0x4848854C, 0xF0EAE477,
+   0xEC3C7006, 0x5A6DD7DF, 0x2FB26998, 0xD90FC8E4,
+   0x5BCCAB1E, 0x614F32AC, 0xBDD17F35, 0x79560BCA,
+   0x4AD028B4, 0x4C14D0C7, 0xB193BFFA, 0x61F54D0B,
+   //T[245]
+   0x6CDDFD99, 0xF90D87DC, 0x2718C937, 0xFD165FA9,
+   0xE5021F03, 0x2ED6FD59, 0x02959A6A, 0x8F21CF80,
+   0x6D416140, 0x4059EB10, 0x1A2E19E7, 0x3C8FBB4E,
+   0x1C51DCE8, 0xCD8246E2, 0xA2662E41, 0x5F46FBF9,
+   0x3FD67D95, 0x2888DE79, 0x6FE3D945, 0x83E6DC3B,
+   0x00D40CD5, 0x6855CCE5, 0xC9A8E109, 0x40368AF7,
+   //T[246]
+   0x1C3C0141, 0x45DC4694, 0x129E1956, 0xACD2A422,
+   0xAD146F10, 0x5EB3216D, 0x334AF8AE, 0x409123FC,
+   0x9EDD9196, 0x4F6DFE6D, 0xF38A75C7, 0xDCCEB14C,
+   0xE93B7A48, 0x3EA82C7F, 0x16F7C01B, 0x910833FD,
+   0x0111C51A, 0x657CF9BC, 0x8B0226C0, 0x28E9E99A,
+   0x83E52A1D, 0x614F86ED, 0xC7029039, 0xDD9B1057,
+   //T[247]
+   0xF11E637A, 0xDD94B370, 0xEE4B560C, 0x751BC343,
+   0x2EE54278, 0x10EADD09, 0x46FA8C31, 0x29BF3BB6,
+   0x04AC7417, 0x8584EDC4, 0xD8D740FD, 0x299773BD,
+   0xAD92948F, 0xAC23CA48, 0xBF79A504, 0x2B700DB1,
+   0x91E58EE6, 0x78F30343, 0xA981B48B, 0xF38D5929,
+   0xEC29562A, 0x9E6B63DA, 0x445FDBC6, 0x0E8D214C,
+   //T[248]
+   0x12EFDD46, 0x867AD7EA, 0x4F9D7A3F, 0xB4379892,
+   0xB0F45DB4, 0xC3F7D0C9, 0x73B60F41, 0x379F5990,
+   0xED2AC1A7, 0x6D799876, 0xC3F2D652, 0xE9986D9E,
+   0x60414BC9, 0x25FEDDA7, 0x51208551, 0x0CBEEAFD,
+   0x2817491D, 0xF39EEB6A, 0x5E171DB5, 0x279B03A9,
+   0x5D9C7D9D, 0x4DDD8864, 0xB8AB2AFD, 0x3DBEDDEC,
+   //T[249]
+   0xB144BD07, 0xDF1F6567, 0xD142161B, 0xF7121BE2,
+   0x519D0F83, 0xD25F1E75, 0x1441BF87, 0xE11C8823,
+   0x33105AFA, 0xDC075E38, 0xC44EF5DA, 0xBEC0F90C,
+   0xC30F2926, 0x50EFB311, 0x21A39192, 0x19CE13EB,
+   0xECFB11C3, 0xC3C05861, 0x780F33C3, 0x93FEFE64,
+   0xA49AAC41, 0x03BED2F2, 0xD42F8247, 0x2D343F49,
+   //T[250]
+   0xBF995BB1, 0x24EE8678, 0x99D52551, 0x90377D9C,
+   0x32848CC9, 0xDD1EB7C6, 0x6B4CA751, 0x0511EA48,
+   0xBF2689A2, 0x35F4A06D, 0xE266DC99, 0x3E8F808D,
+   0x6BFAF921, 0xEEAE9C0F, 0xDC6815CE, 0x04E632E2,
+   0x31474D7C, 0xBC0DE807, 0x528C6880, 0x1B32CFA2,
+   0x7B18FBB4, 0xCEE39A9A, 0xFB78538D, 0xF7F1A39A,
+   //T[251]
+   0x48358315, 0x81B99ADC, 0x813F676E, 0x916D0F88,
+   0xDE0C4143, 0x3058191B, 0x6FF23B66, 0xCBBF000E,
+   0x5C11CC68, 0x5DEB66DA, 0xEE62B05F, 0xD9A7800B,
+   0x29A284D3, 0x5A1DED5C, 0xB11481BD, 0xA207C5A0,
+   0x875E704F, 0x5FC7D81E, 0x09BD24D1, 0x5C807168,
+   0xC4809AB0, 0xBED1F0A1, 0x94E289BD, 0x72B5C6C1,
+   //T[252]
+   0xA78277F7, 0x7A0279A1, 0x6D4EF6B6, 0x7E058AE4,
+   0x9E82845C, 0xEC4554D5, 0x4F86D72C, 0xEF752E06,
+   0x24F96A8B, 0x089CEB58, 0xA5AA8E09, 0xE02D889D,
+   0x2F6F416E, 0x2A9DC5A5, 0xE0FC1D75, 0x01A1ACE7,
+   0x8ABC2E78, 0xDE1EB559, 0xAF6A0827, 0xB213FBB0,
+   0xFA223640, 0x1773839C, 0x4F8BBC15, 0x033AC918,
+   //T[253]
+   0xD1F9F404, 0xA1F197BF, 0xC7FB763F, 0x9C5EE0B8,
+   0x729FEC60, 0x916449C3, 0x084EFC22, 0x9BFE15B4,
+   0xAA5B9E5D, 0xD83DF25E, 0x4DC0D2B2, 0xC3D0F85B,
+   0x02C6A334, 0x91DD693D, 0x3032D016, 0xDC88DEC3,
+   0x40B76A01, 0x8453B73F, 0x9938929C, 0x69DB8765,
+   0x552715A8, 0x25C46692, 0x5CBC1017, 0x69F1B755,
+   //T[254]
+   0x1154E709, 0xBB42B3B7, 0x4FE1FDC7, 0xA40D70A4,
+   0x230B9567, 0xE5A02EC4, 0x51CD44DC, 0xB703002C,
+   0x9C5D39F9, 0xADA2656F, 0xAD6D4DE1, 0x8E08631C,
+   0xC8A1AE9A, 0x025E7E56, 0xF2856E38, 0x1020590E,
+   0x4A170526, 0x0CCB634D, 0x0422F2A1, 0xC0B61C8A,
+   0xEF6498B9, 0xFE57E322, 0x2F0AE0DD, 0x0D0D3121
+};
+
+#endif
+
+#endif
+
+//Check crypto library configuration
+#if (ED25519_SUPPORT == ENABLED)
+
+#if (ED25519_COMB_WIDTH == 4)
+
+//Comb table (4 teeth, 64 columns)
+const uint32_t ed25519Comb[] =
+{
+   //T[0]
+   0x8F25D51A, 0xC9562D60, 0x9525A7B2, 0x692CC760,
+   0xFDD6DC5C, 0xC0A4E231, 0xCD6E53FE, 0x216936D3,
+   0x66666658, 0x66666666, 0x66666666, 0x66666666,
+   0x66666666, 0x66666666, 0x66666666, 0x66666666,
+   0xA5B7DDA3, 0x6DDE8AB3, 0x775152F5, 0x20F09F80,
+   0x64ABE37D, 0x66EA4E8E, 0xD78B7665, 0x67875F0F,
+   //T[1]
+   0xF4EDA202, 0x3E0B6B8F, 0xD51A35EB, 0x0078DB7E,
+   0xB4A08A96, 0xD44B60CF, 0xBF2DF9D5, 0x6222BD88,
+   0x82E45313, 0x8F1EFA57, 0xBA902B06, 0x5410B608,
+   0x261B7C4F, 0xDD6BDAED, 0xEA4ED025, 0x0325BB42,
+   0xB6740859, 0x2DFD92E9, 0x9CC4BF86, 0x3B0ABE0E,
+   0x40094560, 0xC79980E6, 0xC7D3AE0A, 0x628B09E2,
+   //T[2]
+   0x61CCFBA2, 0x1A700667, 0xFF3A78C4, 0x2CDD6232,
+   0x3B1950AB, 0xB87D9BF2, 0x9C294FFD, 0x0EBA91A7,
+   0xFE515E46, 0xE5E5BF1D, 0x670D959B, 0x5AB5D1F8,
+   0xC32C93A1, 0x85970EDE, 0xABEA7F2D, 0x1830473E,
+   0x82DFFB70, 0xFDD346F6, 0x3FFD32B5, 0x69A10996,
+   0xA2112525, 0x0752B8D9, 0xCE400AF3, 0x38CD1113,
+   //T[3]
+   0x60B7E824, 0xFC8047AE, 0xC2E723E5, 0x98E685C9,
+   0xE14E29A0, 0x952D3984, 0x3C45F32C, 0x4C27AFFF,
+   0x4BF5A66B, 0x5BBABD11, 0x51A4C49E, 0x90D0BE1E,
+   0x26C29C3A, 0x95F11EB6, 0x526DC87D, 0x5F2C99E6,
+   0x46F1338A, 0xE9E731C9, 0x6663ADA9, 0x14786482,
+   0x07924B6A, 0xD4E15600, 0x0BF4602F, 0x05A164FD,
+   //T[4]
+   0x680C969A, 0xFBE2FD29, 0x31ECBCE6, 0xB0E6EC08,
+   0x8CC36053, 0x8AB3C1BE, 0x2B88E48F, 0x6E64E555,
+   0x7BAFD09B, 0x25352A64, 0x9EC55210, 0x36391158,
+   0x39B85145, 0x6A9DFC93, 0xA4CB58BE, 0x383C510F,
+   0x814683A9, 0xA138B0BC, 0x783B8D60, 0x43FE5278,
+   0xA9B93591, 0x57BF2EB8, 0x5104D8F9, 0x475C61F8,
+   //T[5]
+   0x43ABCA05, 0x8BF30E63, 0x9BF8A641, 0x53807053,
+   0xE38F5E86, 0xC8180DC3, 0xD81F344B, 0x6DF2BC1D,
+   0xDFBE3A34, 0x89F3F6D9, 0x9F94E1A1, 0xE95D4C5D,
+   0xEF9249A1, 0x8981530E, 0x37A68758, 0x6062DDF1,
+   0x5A25F8B2, 0x93CED87B, 0xD848FC92, 0xF7E588D0,
+   0xBEF719EC, 0xE6D770E8, 0x25B2CB8A, 0x507C0226,
+   //T[6]
+   0x1B9D5A63, 0x527DC68C, 0x6A0970EA, 0x73F332E1,
+   0x7B071F21, 0xD8499B7C, 0x7225F3C0, 0x31ED9D6F,
+   0x54363667, 0xE6719240, 0xAD112811, 0x7B853293,
+   0x493BB73E, 0xB0071C13, 0xFDAA932E, 0x3D4728FD,
+   0x2865FB39, 0x703BCDDE, 0xE8F44232, 0x0F574737,
+   0x0BAF8FB7, 0xC1B485C5, 0x8E2EA5C4, 0x4E602BAF,
+   //T[7]
+   0xC7DAD28D, 0xDB7AD644, 0xB81D7D26, 0x7A9DDEE1,
+   0x1C7E177D, 0x2D8D0437, 0x38185E7C, 0x1BC7AF1E,
+   0x00314833, 0xCAF2F659, 0x631B270F, 0x1D027E12,
+   0x795DC049, 0x7A5EEF87, 0x55661F2F, 0x61D909D8,
+   0x6636C2C7, 0x51B84521, 0x56DE7EF8, 0x9BB8F236,
+   0x4B1F0FBD, 0xCCB664DE, 0x54B8FA44, 0x1A340B80,
+   //T[8]
+   0x07B06838, 0x85CCFCA3, 0x654C7F10, 0xFAFAB365,
+   0xDB6F53A5, 0x46564C74, 0x7AD5E203, 0x02C61C29,
+   0x04F259BC, 0x84C06375, 0x671C602F, 0x8663FD76,
+   0xDCBFFAF3, 0x91902DD2, 0xE5A933BD, 0x42DA0C66,
+   0x0C62D525, 0x10A39D3A, 0xD20A1CA4, 0x18DA8620,
+   0x61E14F1C, 0x3775E5BD, 0xFE2A7A47, 0x1000B139,
+   //T[9]
+   0x66F4CA27, 0x1492ECC2, 0xD0630657, 0xEB06154D,
+   0x774F5869, 0xF0C78BC5, 0xA064ED8E, 0x71663CB3,
+   0x0ADA2DC6, 0x2770FE0D, 0xFA27F864, 0xA5305FF6,
+   0xF2DA6C0D, 0x47785E62, 0x1C0066D3, 0x5D1F56FD,
+   0x857246F5, 0x5DAA6B49, 0x35DC5FB7, 0xBBEDF373,
+   0xBC0941F9, 0x6FE384E6, 0xDA39A2EC, 0x496C664D,
+   //T[10]
+   0x4CF46F3F, 0x270EFDD8, 0xBC2B5CC9, 0x23E7A4C0,
+   0x319F0229, 0x96D7E9D6, 0x0B5EE0F4, 0x3CEE130E,
+   0x3DF2ED09, 0xA4C39176, 0x87D4AE97, 0x18F65DD0,
+   0x671D1F47, 0xA063CFF2, 0x93F82791, 0x3F237545,
+   0x7C932898, 0x8A144393, 0x80145B2B, 0xE368F6C5,
+   0x2CE7E6E9, 0x437F5BC6, 0x391C3F9A, 0x7508F66C,
+   //T[11]
+   0x23ADF1D1, 0x969364DD, 0xF77F7041, 0xA289A9F5,
+   0x1B8DB034, 0x491519AE, 0x876D2358, 0x76814F15,
+   0xEAB523FB, 0x8D54ACCF, 0xEB2F424E, 0x68DB630F,
+   0x8BCFA837, 0x6EA4F5AB, 0xD6B22A96, 0x0DBD9EBE,
+   0xFDC53B75, 0x7CAF4939, 0xD4939CF1, 0x74952AD4,
+   0x8E613432, 0x231C8937, 0x4D47018E, 0x3E24E5A8,
+   //T[12]
+   0xCFA942B4, 0x178A8301, 0xC6C47647, 0x0B950483,
+   0x62C911FC, 0x84760CB8, 0xFA37B9D9, 0x6DC27CFC,
+   0x04B33E58, 0x488F8CBB, 0xCC2791BC, 0x1922B7F9,
+   0xB5092E83, 0x1C54D972, 0x0BEAA14D, 0x7208C6F1,
+   0x40A20B6B, 0xF6948EDA, 0x14425500, 0xB877862F,
+   0x68DA1F1B, 0x88AD21D8, 0x31EB33FA, 0x56BC37C1,
+   //T[13]
+   0x6E7A8746, 0x8A0A5680, 0x6B11DDC0, 0xDF47DDD6,
+   0xEAD8D910, 0x038FB07C, 0x8FC12E00, 0x30D3A844,
+   0xF9A28906, 0x03DCAD34, 0xA751ED85, 0x5DE79C82,
+   0x320C9352, 0xAAE15B9A, 0x6D02B8CA, 0x3AB1D43A,
+   0x6D080106, 0x53D91C4B, 0x5505C291, 0x2DEBE8AD,
+   0x11801164, 0x3840D793, 0x8206F111, 0x4EE2D2CB,
+   //T[14]
+   0xB5BE5FF0, 0x386B100D, 0x8076AC32, 0x7194CABD,
+   0x35C9F27A, 0x429FDE2A, 0xAB011849, 0x647CEFBC,
+   0x923D583F, 0xDB13DB59, 0xE00A6E58, 0x084A91B7,
+   0x3C2ED620, 0x178BC945, 0x90C7E779, 0x25183A99,
+   0xD8EC9FEF, 0x788943D9, 0x054B27A2, 0x30C27D3B,
+   0x5318621A, 0xF89147B9, 0x5F4C090A, 0x0410E27A
+};
+
+#elif (ED25519_COMB_WIDTH == 6)
+
+//Comb table (6 teeth, 43 columns)
+const uint32_t ed25519Comb[] =
+{
+   //T[0]
+   0x8F25D51A, 0xC9562D60, 0x9525A7B2, 0x692CC760,
+   0xFDD6DC5C, 0xC0A4E231, 0xCD6E53FE, 0x216936D3,
+   0x66666658, 0x66666666, 0x66666666, 0x66666666,
+   0x66666666, 0x66666666, 0x66666666, 0x66666666,
+   0xA5B7DDA3, 0x6DDE8AB3, 0x775152F5, 0x20F09F80,
+   0x64ABE37D, 0x66EA4E8E, 0xD78B7665, 0x67875F0F,
+   //T[1]
+   0xFB135C34, 0x2B78E3C0, 0x9B225854, 0x937F8176,
+   0xD23C259C, 0x262196E9, 0x95EDF508, 0x5A04AE11,
+   0x12C5E8B9, 0xFE831F97, 0xD499943E, 0x5952F92D,
+   0xF0A6825C, 0xECE87E75, 0x2118ACCC, 0x67666709,
+   0x60AF76B1, 0x62F42D38, 0xC16520FB, 0x89CD3D88,
+   0x1A6A926B, 0x0D792EFA, 0xC974F8A4, 0x3C714137,
+   //T[2]
+   0xD9FBAC9B, 0x764A01A9, 0x74A15BE6, 0xDD1C0CD7,
+   0x5C9B0305, 0x94D9546D, 0x88473062, 0x0BC839F9,
+   0x7F77979F, 0xE02A876A, 0x05C966BA, 0x148929EC,
+   0xB29BEB4A, 0x7E868629, 0xE615BFF3, 0x5A07C340,
+   0x5FC5B046, 0x81AC07CB, 0x5D3226EE, 0xD39D55AA,
+   0xE4FE6845, 0x054B2C87, 0x4F99A290, 0x732D59F3,
+   //T[3]
+   0x04B900BD, 0xEBFC357D, 0x32050BD0, 0x24897A52,
+   0x63E15075, 0xE78E8202, 0x56F20C85, 0x25833744,
+   0xCBCEA18F, 0x0212DA60, 0x2A39291E, 0x77EBB703,
+   0x2BC9EA40, 0x7E7DD52C, 0xFD5AC72C, 0x62D1C4FF,
+   0x396C834F, 0xF5643A7D, 0xAF982666, 0x2E0B0823,
+   0xA394A7BB, 0x4BBFF723, 0x69C27C80, 0x18AF0501,
+   //T[4]
+   0x85211131, 0xE1470610, 0x2F0C36BA, 0xBECDC597,
+   0x7B0ACC10, 0xACF5E23A, 0x7DEB7AC3, 0x1EA891E3,
+   0x617D9F4B, 0x32B3B9B5, 0xAF15D6D3, 0x94010C31,
+   0xB65808F1, 0xF0982C36, 0x27155BEC, 0x54257C77,
+   0x1510AF18, 0x9FDDFDD5, 0x6E8D120D, 0x9E37A3FF,
+   0x6A0053CA, 0x1CB60274, 0x1368E4CB, 0x1DB87B48,
+   //T[5]
+   0xAEB05964, 0xD19BECC9, 0x7B9D37E2, 0xEB505954,
+   0x37E8161D, 0xBBB20392, 0xAAA3C19D, 0x5F091330,
+   0x74241DEE, 0x80AD94A0, 0x70BCFBFE, 0x3DB8E3AF,
+   0xFD90A2DC, 0xF8FCB8E8, 0x619E2BD3, 0x287FE33D,
+   0xCF3F16BF, 0x86EA70DD, 0x84F423E5, 0xDD30BF60,
+   0xBA5659B7, 0x0683F7E5, 0x50B91C0F, 0x5AB7D802,
+   //T[6]
+   0xDADA8AEB, 0x91262917, 0x6CE43ACC, 0xD84C483F,
+   0xD9491D7E, 0x0B0839F4, 0x743D072F, 0x7E770E33,
+   0x601A83C3, 0x252DDEE5, 0x516FB005, 0xEAEA275E,
+   0x5F53BECA, 0x2810F782, 0xA4EF09AF, 0x28A1FCB5,
+   0xD2954502, 0xEB99959B, 0xF8BA9F96, 0x8230A3E6,
+   0x90D4FDA1, 0xEA9634E4, 0x040022CB, 0x49137B96,
+   //T[7]
+   0x3224E085, 0xFCEFD1B4, 0x8FBFA269, 0xF6952C72,
+   0x907D6EE4, 0xA08157F7, 0x33EFDAF7, 0x786BE307,
+   0xC63E2736, 0x4EAB0712, 0xB39D69BE, 0x2A7C08BE,
+   0xD4FD0847, 0x34270ECD, 0x2F34985B, 0x653A5F77,
+   0x719F64C8, 0x00C4E817, 0x57BABD6E, 0x96C4EE55,
+   0x5BD3D8EC, 0x0D90669A, 0x4D313E8B, 0x12C73ED3,
+   //T[8]
+   0x2FAE0B08, 0xC3551B73, 0x30D4B548, 0xD73EBF4E,
+   0x215BF276, 0x55671D6F, 0x4DA85260, 0x65ECC6E4,
+   0x09F0AC2E, 0x4907AA06, 0x13443DFD, 0xA018D689,
+   0xDE49C7C4, 0x753EE41F, 0x5840B3A2, 0x37660B27,
+   0x2BC275AE, 0x5FCCA85B, 0x9B8181BF, 0x25E681D9,
+   0x83276224, 0xA87B2B8A, 0xEE814146, 0x1E1E7217,
+   //T[9]
+   0x7A9BA04A, 0xA023D81A, 0xB17604D0, 0x6552A7E6,
+   0x743D004F, 0x5DA44108, 0xB1FB5945, 0x53C9622E,
+   0x56D1CD20, 0x8FE01DE0, 0x174C68EC, 0xEA2D910F,
+   0x0264BE62, 0x94CED948, 0x8892D233, 0x277DD1EF,
+   0xCCCDF306, 0x71AF7639, 0x5F980C58, 0x6E249C10,
+   0x87010E15, 0xC598154C, 0x6D7C5BB1, 0x50746649,
+   //T[10]
+   0x53BD5F10, 0x8E07785C, 0x68D3B24A, 0xF53439FF,
+   0x054E39FF, 0x38587752, 0xC7002605, 0x64A59F2A,
+   0xFCD24375, 0xC446085E, 0x047B5811, 0x63E332A4,
+   0x3BBD7DFE, 0x646BAE75, 0x98BFD4F8, 0x6367BE57,
+   0xE90330F5, 0xB930134D, 0x267C8EBA, 0x7BF8A763,
+   0xE47E60D6, 0xACF2A355, 0x93067B30, 0x65260E56,
+   //T[11]
+   0x74E792F1, 0x3B9E5884, 0xA13951C3, 0x43A664C6,
+   0x87A0645A, 0xFFDA7B3F, 0x101ADFD6, 0x4D81E623,
+   0x1CDC2E0C, 0x67B240C4, 0xF5DC51C7, 0x3916EBA9,
+   0x3A1105FD, 0x389E5110, 0x5C6B1F66, 0x6069CD25,
+   0x26EA9546, 0xADB857D9, 0x5DDD6573, 0xB2B7F4B8,
+   0x6FFDA10A, 0x15E429E6, 0xB08C197B, 0x05E12358,
+   //T[12]
+   0x2D0C8460, 0xF84DCF05, 0x33010DF6, 0x5C3231FD,
+   0x76971447, 0x7F8D4CCB, 0x4BBB1E53, 0x64E9607B,
+   0xC352A02A, 0xD87B46EB, 0x58BBB79B, 0x4D4B2C08,
+   0x677645BD, 0x7F151EBC, 0x9A8F80CC, 0x3FBE04FA,
+   0x9FBDCDA4, 0x19C86236, 0xDD414657, 0xE23B306B,
+   0x46A55FEF, 0x81F7B974, 0x8541CBD2, 0x5DB66411,
+   //T[13]
+   0x975BBD5D, 0xFE367569, 0xFF16BA4A, 0xB365F3AE,
+   0x5F49D163, 0xD42E2F30, 0x7A1ECA59, 0x15B7E51E,
+   0x5AAD48F0, 0xBC07073C, 0xD1C3777D, 0xF6F2D026,
+   0xE8DF2D53, 0x65F52D0D, 0xA7D97799, 0x3BF8624D,
+   0x346561CB, 0x8D53DCB1, 0x7F7D09B6, 0xD9F8268A,
+   0x1EFFFCDB, 0xB5F6CA0A, 0x8904ECD0, 0x2C988DD3,
+   //T[14]
+   0x3C580261, 0xBDC4B0DE, 0xCC8657B7, 0x05877CA6,
+   0xAFFA863E, 0xB09059CB, 0xBE426537, 0x57C1FBA8,
+   0x1922707E, 0x317EC41C, 0x7C0362F0, 0xDAFC7E93,
+   0xBE18810B, 0x33F88E09, 0x4356AFB8, 0x502BCFEB,
+   0x3BD6CEC1, 0x4C829187, 0xE9405245, 0xFF24E9A6,
+   0x142CC19D, 0x7E70FBA6, 0x16F62459, 0x76E33A5B,
+   //T[15]
+   0x0A70AA7B, 0xBFF5FB4B, 0x08CFC580, 0xF4A1DD7A,
+   0x5350549D, 0xF5237723, 0xD122A534, 0x472E960D,
+   0x8932B7CC, 0x7598D057, 0xA99937E4, 0xBAEDBAE8,
+   0x154FC7EB, 0x4C0C0776, 0xFC529FEF, 0x10585D04,
+   0x8E981460, 0x13290415, 0x21F8C8A5, 0xA92D9DB2,
+   0x74E5DCC9, 0xC6133D66, 0xD02B57CC, 0x1014714D,
+   //T[16]
+   0x07507F40, 0x05556D6F, 0x1E67230E, 0x51C495D6,
+   0xFE6AB2A1, 0x927043F8, 0x19666413, 0x45D0C5E1,
+   0x0BBD5AF9, 0x7F2D8FF7, 0x83F45291, 0x6D706841,
+   0x9250187E, 0x6B133C5C, 0xDEB25550, 0x58C3977A,
+   0x87E42598, 0x3C748A8C, 0xC9516B0C, 0x9EA59EA6,
+   0x69D07903, 0xAEC6B86C, 0x31B5FF76, 0x05D8EEE9,
+   //T[17]
+   0xA2395768, 0xE35797A3, 0x2E35E421, 0x7990398F,
+   0x9AE82F75, 0xA2DA7889, 0x8D359F7A, 0x39E959E6,
+   0xF2D0CADE, 0x25C8C6D9, 0x8B6D0B78, 0x94CE14B0,
+   0xA3F25C88, 0x20DC6500, 0x4FBB85F8, 0x41B9FFF1,
+   0x105DF916, 0xAF23845F, 0x91C7137A, 0xE4443268,
+   0x0996A510, 0x7C1A5EE0, 0x8671C455, 0x7DBDAC05,
+   //T[18]
+   0xFFEA9A63, 0xC1DBDF88, 0xD75FF0FE, 0x53A80FE4,
+   0xFEA580F7, 0x620D8447, 0x994D3F02, 0x2A1925CD,
+   0xF96DA168, 0x78358448, 0x73881238, 0xE681FF72,
+   0x3C6EF8C4, 0x56E4CAD5, 0x08025958, 0x6A3CF87A,
+   0x61512D18, 0x20F6A8F9, 0xC1ED8C3E, 0xE674E356,
+   0x27C6AEF4, 0xF15AC64F, 0xB6EFDE40, 0x1DDA20E7,
+   //T[19]
+   0x140BC1D4, 0x55BA4189, 0x466A406A, 0x9CCDA2BE,
+   0x7FCDCF9A, 0x93B2D73B, 0x78367EAF, 0x67C69B24,
+   0x3A4BAAE4, 0x318B644A, 0xD27B3A75, 0xBE022CD3,
+   0x3F14E341, 0x4C49CF0E, 0xDE7979FC, 0x133C25F5,
+   0x0148F051, 0x3FBEFDDD, 0xBE77D2F3, 0xC7A7EFDA,
+   0x772E09C1, 0xD03DABE0, 0x29232019, 0x27A0EB86,
+   //T[20]
+   0x364118E3, 0xC051EE3C, 0x163B2B8A, 0x73D5BDBD,
+   0x272E55A3, 0x3A83DF89, 0x4B359B66, 0x292CE9C9,
+   0xFE025856, 0xE0F354A6, 0x91363D67, 0x2C27662B,
+   0xBED0F2E3, 0xCB4B950D, 0x217E46E2, 0x44028D4E,
+   0xC54A75D6, 0xE7E910D7, 0x93550A4A, 0x153A74E7,
+   0xAC5DEEF7, 0x87036CC1, 0x312997BA, 0x70697310,
+   //T[21]
+   0x08483439, 0xD3C47DFF, 0x17CF29D5, 0x734485A0,
+   0xCE925D06, 0x45EC8CB4, 0x6DD90B80, 0x68C340C2,
+   0x77894ACB, 0x178FC594, 0xE50B9BC7, 0x1AABF29D,
+   0x05453E54, 0x952E7A39, 0x0E8766AC, 0x62B28032,
+   0x50C67738, 0x07C27958, 0x01432E09, 0xE1CB17B8,
+   0x80F9FAFD, 0x864064E9, 0xCBAF797F, 0x184ACAEC,
+   //T[22]
+   0xB3A0CAE4, 0x48215586, 0x5AD6F1E7, 0x3C724676,
+   0x789446D8, 0x5FEDA3AE, 0xDE6E47FD, 0x6D473613,
+   0x54B9CB2C, 0x9E805522, 0x07D7AAD8, 0x36CD9C0F,
+   0x364486F1, 0x2148D6E8, 0x45283F67, 0x12FDF260,
+   0x7B7B953E, 0xB8CD4A9D, 0xBF8C406F, 0x19588F30,
+   0x88CF1B7C, 0xE876AC36, 0x8062431C, 0x6388078F,
+   //T[23]
+   0x094DBC3D, 0x6FB72724, 0x7264E3D9, 0x35547C59,
+   0x166582A1, 0x20267D60, 0x42F67704, 0x1FB999C7,
+   0x2FEE06AC, 0xC6E2D0F7, 0x81A30A47, 0xEF8B4F40,
+   0x05E8B62B, 0xEDDE0883, 0x46DEA7A4, 0x6247C0B7,
+   0x8ABC5661, 0xAF54682F, 0x1E70227C, 0xA53F2D5F,
+   0x9FBE7F27, 0xAC3DFD49, 0xF498E1ED, 0x0EABF979,
+   //T[24]
+   0x927D4B91, 0x9C5A1C81, 0x07385702, 0x88DC8188,
+   0x7E10ECC5, 0x7AEC2950, 0x3955A84E, 0x57DEED43,
+   0x0276C2A2, 0x98F5B6FD, 0xB02A089C, 0xFE666531,
+   0xCA44DDA9, 0xCD247E44, 0xEF0C3CDB, 0x36A45C40,
+   0xAC950FAA, 0xDBF78DDA, 0x4285BA97, 0x6C56E691,
+   0xAD6BC5CD, 0x99A44881, 0xAFEFE05E, 0x3C34E8A3,
+   //T[25]
+   0x278D9111, 0x80D869AB, 0xDDDB06FF, 0x3E308DE0,
+   0x4428A1D3, 0x54751DA7, 0x85A7C942, 0x510152D5,
+   0xBE28114F, 0x5397C162, 0xDECEB52F, 0x87B0118C,
+   0x07D59508, 0x9950CA05, 0x22FE0527, 0x311C3692,
+   0x919920D8, 0xBF7E21FB, 0x4F8DF2DE, 0x796B14B0,
+   0x536D23C3, 0x6DEE59C7, 0x51826EFB, 0x73D19559,
+   //T[26]
+   0x3E1A871D, 0xC430A86A, 0xC5997832, 0xA76AC3C1,
+   0x82CB3B87, 0xD23223E4, 0x845B1B57, 0x79ABCFE4,
+   0x35F0F676, 0x7050F06D, 0xB3D7CDB2, 0x2726C9F1,
+   0xDED533EF, 0xFC98E572, 0x0448C739, 0x5A444642,
+   0x35D827F3, 0x63F3BDB5, 0x94CBE522, 0xF52D3E34,
+   0x9FF5339E, 0xE4F19400, 0xDD8937C5, 0x67D9CE90,
+   //T[27]
+   0x4DE18C7B, 0x65E4847C, 0xC9DEBE00, 0x2F7A43AA,
+   0xBC4FFFA8, 0x97F49CEC, 0xD7A8A68B, 0x58E60B0D,
+   0x9CA28863, 0x0BE49E30, 0xD5A4C162, 0xC45BAA06,
+   0xE5830C55, 0x89F6A30B, 0x16A3BA90, 0x4469EBA8,
+   0xBE8C439C, 0x844428B4, 0x20D8C16F, 0x887687A1,
+   0xBADDDE63, 0x987795E0, 0x2F55DF73, 0x3064481D,
+   //T[28]
+   0x20401A88, 0x36D19D49, 0x68C10090, 0x3BEC89F5,
+   0xB6B73336, 0x7E16814B, 0x484C5668, 0x05D45B16,
+   0xCA1A1A2E, 0x7AF5EB24, 0xF3E558ED, 0xDC40B941,
+   0x27941DB2, 0xB818A2A3, 0x1327602E, 0x27B68CE0,
+   0x59CF402C, 0x8D8EF294, 0xF807FA4C, 0xD4720839,
+   0x94C0A615, 0x56431487, 0xA5BE988A, 0x59D28D85,
+   //T[29]
+   0xA91726D6, 0x7FD37078, 0x3A913360, 0xDA32F9AF,
+   0x0D028476, 0x82DB6D4C, 0xA8BBB6F2, 0x13554C69,
+   0x1D27BDA8, 0x0EF50B2E, 0xC8F3F0AB, 0x7DE607F0,
+   0x85B9E2EF, 0x83BBE9F0, 0xFB34E007, 0x06054D85,
+   0xC5EC0770, 0xCFE78E91, 0x554D9B31, 0x57942823,
+   0x245F39FC, 0x84967514, 0xFCCB5623, 0x0FA7302A,
+   //T[30]
+   0xF10554B1, 0xB3DF71A8, 0xB5A7905E, 0x23992D2C,
+   0xFE9CCFAF, 0xC989BB15, 0x4588E6EE, 0x403565A7,
+   0x36A37831, 0xF5C4ACD6, 0xCB9D8844, 0x1F276BDE,
+   0xF9678051, 0x8665BF25, 0x5430CFDB, 0x4BA0F54B,
+   0xA0714E6A, 0xC3A1A25C, 0x56B0BD08, 0x10E9517A,
+   0x18F062BF, 0x1FB0E7E0, 0xC9702554, 0x448875B3,
+   //T[31]
+   0x7BE967E0, 0xB05C96DB, 0x3159D032, 0x9792DC90,
+   0x313809AC, 0x5DD67E0F, 0x1FB606D0, 0x075BF0EA,
+   0xDEC79F81, 0x3522416B, 0x3E776714, 0xD9B08190,
+   0x9BCA4C85, 0xD659043F, 0x88C317AA, 0x43BA3734,
+   0x5C090BB2, 0xA6138741, 0x81626ED4, 0xA1C51FF7,
+   0x9FC5749E, 0x027FEFFB, 0xC49FBEC5, 0x0CB7376F,
+   //T[32]
+   0x2DDC3B34, 0x18BDCA20, 0x3CC8A0FF, 0xEC0ACB9D,
+   0x2D716EBD, 0xEC2FCC11, 0x7BFB9B97, 0x5EE1F1AA,
+   0x02D0C07E, 0x7609FFD0, 0x87B72513, 0x3D2F0C96,
+   0xFDF766D2, 0xDD1D4847, 0x752185AA, 0x0F29CD61,
+   0x2961B088, 0x9FFFC7A6, 0x40D9FE85, 0x39CA7E00,
+   0xDB573826, 0xB493E266, 0x7B738B13, 0x047645DE,
+   //T[33]
+   0x828CBA28, 0xCCAA09C6, 0x37C103A0, 0x6AFED849,
+   0x09564301, 0x86B8B497, 0xCC2ACA7B, 0x7B80CC12,
+   0xD0AC0A84, 0xAAFF5F34, 0xCE38522D, 0x21FD1381,
+   0x72DC7F45, 0xA61F2759, 0x88B2C3E6, 0x37BF0362,
+   0x5C31E1E5, 0x23FD9778, 0xF7401398, 0x1D1F2859,
+   0xC0E45E3F, 0x7E1C6EAD, 0x2A6B21A3, 0x0EC5901D,
+   //T[34]
+   0xAD65F3DB, 0x9E9BF565, 0x7332E0FA, 0x1556A3E5,
+   0xFAD49501, 0xD79E96B1, 0x4D718566, 0x4E6320BA,
+   0x2563B980, 0x598F27E7, 0x2128B15E, 0x77EE766C,
+   0xE325D478, 0x7FB7EA72, 0xF9E222D8, 0x086E4E7C,
+   0xC695BC82, 0xCA34201E, 0xD42E220F, 0xB15D68E3,
+   0x1044F2D8, 0x3845D0A9, 0x06F3B0FE, 0x00C0E58B,
+   //T[35]
+   0x958738F6, 0xAFA79DAA, 0xE3868D21, 0xD622F7A0,
+   0xB8E24E39, 0x6424B9F3, 0x443E3191, 0x7E1FCB6C,
+   0xB697AE94, 0xDDBE9CD3, 0x10B5D52A, 0x0E777384,
+   0x7E47297D, 0xEF3E7510, 0xF3814955, 0x54CC78EE,
+   0xEAC75A87, 0xE988AC8E, 0xE8A67CC8, 0x665E0BCA,
+   0xEA81A564, 0xE7313768, 0xC72DCBAB, 0x36CEC37B,
+   //T[36]
+   0x0FC5E799, 0xCADEA7E0, 0x315F96AF, 0x8D9C61FD,
+   0x8E654621, 0x08F443E6, 0xC264E22F, 0x6FB2CF23,
+   0x40F2FE08, 0xF38F17D4, 0xAF0F177F, 0xC99981F2,
+   0xB6A20C71, 0x04CAD2D4, 0x3EAB0868, 0x03FF8D95,
+   0xA20FFD02, 0xA4CAFD13, 0x1604F4D3, 0x42200FC7,
+   0xC995704D, 0xC04D51D4, 0xAF358346, 0x10D14ADC,
+   //T[37]
+   0xF1883710, 0xC1E93D9C, 0x50A3E7E5, 0x53BF1C74,
+   0x14082949, 0xBDBE7933, 0x505C52DC, 0x1641FDBB,
+   0x5F082B3F, 0x832132E4, 0x3C3AAA63, 0x78C79277,
+   0x504D4781, 0xE281E398, 0x429D5C29, 0x50FD0D0A,
+   0x0ECB823F, 0x1FE2C459, 0x92E89906, 0x1335441D,
+   0x0F85E88B, 0x188E4032, 0x251E176B, 0x6D50BD89,
+   //T[38]
+   0x969296DB, 0xF031887E, 0x8171D4BE, 0xAED28EB2,
+   0x761D3175, 0xD0B77CE3, 0xF9394581, 0x7D08F4EC,
+   0xE15B4D5E, 0x2B654053, 0xD0556DD0, 0xF763D0BC,
+   0xAA855263, 0xF287A62D, 0x1F54C141, 0x260301C2,
+   0x3EB34C7D, 0xBC11FF8B, 0x99CDAC89, 0xBE2A1767,
+   0x3F123E0D, 0x7DFAE36C, 0x6F4827C3, 0x0C8CE822,
+   //T[39]
+   0xF11F6869, 0x89EDF0EF, 0x4668604E, 0x6211935C,
+   0x2D1AE4AD, 0x2B5C2C67, 0x31593D6D, 0x18C7CEEB,
+   0x04C628A4, 0xD7904777, 0x64E2C822, 0xDA07618A,
+   0x4310D6CA, 0x57462393, 0x38B52910, 0x1AEC9157,
+   0xD1A420BA, 0xACF69CFE, 0x9FD6CD27, 0xB1EDDD28,
+   0xCA85E8FB, 0xFFA7956F, 0x005977FA, 0x2C94CD3D,
+   //T[40]
+   0xF1C6C058, 0x54873124, 0x44064298, 0x25BB818C,
+   0x6FE662EA, 0xACF859F5, 0xC91C387F, 0x07D73F19,
+   0x969234FE, 0xB57AC48D, 0x5812EC98, 0x5F73DE1B,
+   0x97952E83, 0x9CFF8463, 0x41E23447, 0x5DFF2DDC,
+   0x83B3A9B5, 0x5C7767AC, 0x9355ACEC, 0x22EFCF05,
+   0x5EC150DC, 0x2B59454E, 0xC1192C03, 0x21629856,
+   //T[41]
+   0x8B2C68A1, 0x046106E3, 0x734BDE9E, 0xF8D1982B,
+   0x8E9210F2, 0xDD2F75C7, 0x32915D9F, 0x568477D2,
+   0xC5EB5891, 0xC31DE714, 0xFAC53C0B, 0xDC3A5701,
+   0x151E874C, 0xF0C1EFD6, 0xE5F8ECB3, 0x4CFA929D,
+   0x5B720BB6, 0x5F04A25C, 0x886A782E, 0x3A24708E,
+   0xB055BE11, 0x9849EE45, 0xD037DAD8, 0x7C85B1A7,
+   //T[42]
+   0xDBB8A495, 0xCEADB9DE, 0x2A6046E2, 0xA51F4E97,
+   0xE335C805, 0xE630157D, 0xEEEAD9CE, 0x608AC1C2,
+   0x86A472CF, 0x8EBE029B, 0x27656938, 0x8C96F461,
+   0x54172777, 0xD17C999A, 0xF8528BFE, 0x34F68305,
+   0xFD38324B, 0x8307C4DE, 0x95955654, 0xD45FF797,
+   0x6276B2B5, 0xECA56300, 0x14E55CC8, 0x013592D5,
+   //T[43]
+   0x2243A91F, 0x7C8112A1, 0x422B5F98, 0x5BE55FA9,
+   0xB54FFB07, 0xAA025961, 0xA77CA38A, 0x4589F575,
+   0x5710871F, 0xFC6C3635, 0x4AF3F869, 0x3C9BE1B5,
+   0x3A2E6347, 0x7217A947, 0xE3162E6C, 0x517DC15C,
+   0x32B22B20, 0x6338E72F, 0xB99874F6, 0x278D7E01,
+   0xF6D44284, 0xCC3E7F6A, 0x2480264E, 0x26E6E259,
+   //T[44]
+   0x8AEC0DC8, 0xC96660F3, 0xE3A0AE50, 0xC91B2BFE,
+   0x2F71D84F, 0x942D0D92, 0xB1DE63CC, 0x3AE44143,
+   0x5E4A9E11, 0x21806C57, 0xBDEE7678, 0x0377FC57,
+   0xE2FF8139, 0x7BF05581, 0x543F968F, 0x7A2EA4F8,
+   0x40376A32, 0xD027A604, 0x20AEB0AF, 0xB1613702,
+   0xD812B9A8, 0x61DA365D, 0x26A9BD9F, 0x1E37D597,
+   //T[45]
+   0x5C0498B0, 0xCC32DF4C, 0x46F77522, 0x24A1091C,
+   0xADAC6034, 0x7EDF1141, 0x268825DD, 0x16D38197,
+   0xE51CF14D, 0x1688F826, 0x3A33EF4D, 0x876276A9,
+   0xCECFE05A, 0x38A04DD3, 0x2CF2FF1C, 0x19F9CF27,
+   0xB04C9F0B, 0x2F791F46, 0x2CA9373C, 0x8B531A56,
+   0x42E335FB, 0x00D6D5EF, 0x502B9B9C, 0x6FA60BDC,
+   //T[46]
+   0x561C911E, 0x5B6F9F2B, 0xD6F6CEAA, 0x3AEBE8C6,
+   0xBB210A2A, 0xB9DD463C, 0x1F95D020, 0x36666E57,
+   0x6647CEE5, 0xCF1EBC9B, 0x02EA3AE3, 0x7A9496CF,
+   0x693BE2FA, 0xFD6B25D6, 0x28A782DC, 0x7FA90C06,
+   0x5F35F777, 0xFA93AE73, 0x0C130FF2, 0x354E25F7,
+   0x4BACDBE0, 0x5A02EFCB, 0xDF72502B, 0x3C57A24C,
+   //T[47]
+   0xBE021173, 0x57B65A20, 0x8812A8B8, 0x32A09E33,
+   0xF678B27B, 0xCA960A4E, 0x8B8BB2F4, 0x5AC19DFE,
+   0x79BCBC5D, 0x4F718172, 0xDAA6D95C, 0xC2C1D553,
+   0x4A8F2790, 0x516D4A3A, 0xA3C7AF33, 0x3FBDAB41,
+   0x7B425AAC, 0xBF58A8E9, 0x278DA7C4, 0xD53599C4,
+   0xC375891E, 0x88C94FFF, 0x099FACFE, 0x08CB4736,
+   //T[48]
+   0xF60FB612, 0x70C3B2B9, 0x564EB734, 0xE1661BFF,
+   0x5913B21B, 0x75D837AE, 0x1ECE2051, 0x0785DEAD,
+   0x7907DF19, 0x0439693B, 0xF6A3FE0F, 0x01E21DC5,
+   0x9B74602E, 0x087FC211, 0x43752239, 0x254C289D,
+   0xED49B7E5, 0x32DD4117, 0xDAE1CBE9, 0xCCBFBEA0,
+   0x5E59E1F9, 0xE647E562, 0xCD714351, 0x099C1F41,
+   //T[49]
+   0xD510ED9B, 0x0E6B75F4, 0xEA3878B7, 0x464452CC,
+   0x81909762, 0x059BC5AA, 0x317E3BA4, 0x2B05BD19,
+   0xC161C9E7, 0x7FC30F53, 0x805EB543, 0xE6A7DB9C,
+   0x51049268, 0xC22F17E0, 0x3934D049, 0x4C3DFA2B,
+   0x2D0F4CF4, 0x27DADB24, 0x16A4E945, 0x27583062,
+   0x8B58E539, 0x5C6A0E65, 0xB8607400, 0x23DD2339,
+   //T[50]
+   0x45B886BB, 0x8E4E9F31, 0x776C168E, 0xAD123CD2,
+   0xE11DD6C4, 0x382FBAE1, 0xFADF4919, 0x5DBF8D95,
+   0xB160E9F3, 0xC8830E8C, 0x588D40FF, 0x91A0B3E6,
+   0x4C3F74ED, 0x1AE147DC, 0x22B45075, 0x0EBF1300,
+   0x0D6E3921, 0x5A5E8F22, 0x71CEC6B4, 0x9FCDBD4A,
+   0x4587A2E0, 0x58193F90, 0x374CC167, 0x0A2D4F47,
+   //T[51]
+   0x97C04E7A, 0x7CC0A25D, 0x4E176D1B, 0x23F8AF43,
+   0x71A2BD2C, 0xCD3B198F, 0xEEDE915E, 0x3B2ED16B,
+   0x9BCFED55, 0x3EC7C265, 0x45EF3684, 0xE36AF9B3,
+   0x8ED3A932, 0x4AC9F0CF, 0x66A0198D, 0x0798AE36,
+   0xB571690C, 0x6624795C, 0x26960751, 0xFAB4D1F5,
+   0x331B1DAC, 0xAD34FB10, 0xA92A59F9, 0x7BFF81F1,
+   //T[52]
+   0xA632393A, 0xF85E97E5, 0xF04AE664, 0xD3BF5703,
+   0x9690AE3A, 0x49A6127F, 0xD19F046F, 0x7D315A48,
+   0x781B9739, 0xB891252B, 0x8399EC61, 0x9DE52FE7,
+   0x5A830EC9, 0x5A185972, 0xBCB39940, 0x775E38FF,
+   0x738C56AC, 0x9507A394, 0x3CA816F5, 0x505C65F7,
+   0x8E2B9310, 0x167B4AE6, 0x467A9DCC, 0x77ACDA19,
+   //T[53]
+   0x6D6A8F20, 0xFC18E853, 0x5A66FC5D, 0x55484A35,
+   0x58BE0277, 0x61AE7DAC, 0x110353B0, 0x09B46930,
+   0x91F4A5E0, 0xCB2BBDFB, 0x04BFD37B, 0xA801F80D,
+   0x5C203AEA, 0x6EF75E48, 0xE83D5C21, 0x12142239,
+   0x3041FD3D, 0x12815879, 0xFDA2027B, 0xC35BE561,
+   0x633C182C, 0x607E68C2, 0x2A8F8D9B, 0x48CDA9F3,
+   //T[54]
+   0x02E365B6, 0x1BD1F531, 0xC93EF93F, 0xBC1B023B,
+   0x5369DCA4, 0xCED91371, 0xB915E3D3, 0x52164F18,
+   0x324228E8, 0x0E1755CF, 0x707A70BB, 0x5CCBAEF3,
+   0xBDB5E040, 0x4FDDA2CC, 0x1044DE9C, 0x587A31D4,
+   0x3645FE2F, 0xAFBA056B, 0x5F845F79, 0x9386B68C,
+   0x1BF07B61, 0xFC23B2D8, 0x207870A7, 0x67EFF743,
+   //T[55]
+   0x11B1E49A, 0xC69E1AB0, 0x15298ED9, 0xAF800BEC,
+   0x0D92AD76, 0xC20A2BE0, 0x976587A4, 0x41FDA5D3,
+   0xD0C531B0, 0xB049C7A0, 0xF055B510, 0x0C3F42DD,
+   0xDF56DF96, 0xDD48BED9, 0xC14242BC, 0x40FF31A9,
+   0xDD01CD1C, 0xCAB65474, 0x25A95CA8, 0x35FD5DA5,
+   0x97C9FC5A, 0xCD5E15A8, 0x76BB0CF0, 0x51E6DE90,
+   //T[56]
+   0xF8D246C2, 0xC1F08ED9, 0x5EA925F6, 0xADD27F56,
+   0x4E205575, 0x0818E3BA, 0xC1FDA48D, 0x01EB7D90,
+   0x83F3715B, 0xF40D09D1, 0xAD1ADE83, 0x79E25856,
+   0x1C7917CB, 0x22E3CC7E, 0x721F89B0, 0x6EF5FFE5,
+   0x4686E96E, 0x64563D33, 0xEDF293BC, 0x1F7B28D5,
+   0x735087E9, 0x6F2E901D, 0xC9A04477, 0x03457D69,
+   //T[57]
+   0xF622F271, 0x3B7FE197, 0x6571663B, 0x2C6A225B,
+   0x6E5D56F7, 0x8D920298, 0x770C9E14, 0x4F275D15,
+   0x729AF4D5, 0x6E64B2BE, 0x0B19C27F, 0x1B6AD83F,
+   0xB65CBCF3, 0x224D6648, 0x964E26BF, 0x5F3304AB,
+   0x914C19C8, 0x9F1AFDB1, 0x9809FC98, 0x365CA46E,
+   0x57E2EF2E, 0x309C4B71, 0x355CCF8E, 0x48D38A34,
+   //T[58]
+   0x2250D8AD, 0x83D99165, 0xEE33BD2B, 0xCBE862D3,
+   0x4BA332A3, 0x79EF5AD6, 0x13A927E9, 0x2FF78A1A,
+   0x762B92EE, 0x418D2327, 0xF372E4AD, 0x02FD0ECD,
+   0xD38F684C, 0xF504701A, 0xEB8E7943, 0x5C59F631,
+   0xE9137C74, 0x6A529AEC, 0x553A9882, 0x503F961D,
+   0x4915D3F2, 0xED26898E, 0xC89D4E34, 0x0A4CA1E4,
+   //T[59]
+   0x04A5FCDD, 0xEFE2E93B, 0x328A362B, 0x58654D84,
+   0xD80C40C5, 0xF9221AEC, 0x3C7A182C, 0x77A924B6,
+   0xBAF2BA1B, 0x8406E230, 0x98C95EBB, 0x362730E7,
+   0x55F1EBEC, 0xC1F12F2B, 0x0E436E8E, 0x5697053E,
+   0x670F71F5, 0x3E1549AC, 0x9921F340, 0xE0321845,
+   0xCCF93678, 0x586871B9, 0x37A1A350, 0x74DF3CC3,
+   //T[60]
+   0xA749798C, 0x72933A87, 0xA883F59A, 0x38A4F5C9,
+   0x3A797306, 0x25D834FF, 0x068DCB00, 0x6291EEF1,
+   0x02108E4C, 0xABC72B54, 0x0C82F109, 0xC7ECFBA0,
+   0xE37B92B7, 0xF6FC92DC, 0x95C97FCF, 0x08AE78B6,
+   0xFC0CB618, 0x58C2DB0A, 0x91E9EE79, 0x8C672F6B,
+   0x12D33B7C, 0x4835C18A, 0x8BF1C780, 0x52A886A1,
+   //T[61]
+   0xD4D7AF99, 0x60DC8178, 0x038E0FF0, 0x996C1CAC,
+   0xF7831473, 0xEACF9B6B, 0xA4E703D4, 0x7FBE372E,
+   0x320CE63B, 0x320D908A, 0x3780A72C, 0x4C02084F,
+   0x41EA0BC6, 0xA804590D, 0x46CE4EE6, 0x534EE626,
+   0x9D91E785, 0x49068517, 0xD3CF810C, 0xCE2EA6DC,
+   0x15709B9F, 0x1D8BC436, 0xAB3B52EF, 0x26110B5C,
+   //T[62]
+   0xE9C66EA1, 0xC0D5A96A, 0xBE07FAC8, 0x9CF85722,
+   0x5D75D15F, 0xC0AD76DD, 0x9990E496, 0x17DAC96E,
+   0x1E45571C, 0x95B22BF9, 0x1D5FFED8, 0xBD84C6C5,
+   0xC29D5558, 0x56E94E36, 0x4D3D4327, 0x65934C32,
+   0x4E8BE402, 0x5F5AF800, 0xDC9E5447, 0x29BE04EE,
+   0x07C0D486, 0x36112916, 0xF587C078, 0x4BE891DE
+};
+
+#elif (ED25519_COMB_WIDTH == 8)
+
+//Comb table (8 teeth, 32 columns)
+const uint32_t ed25519Comb[] =
+{
+   //T[0]
+   0x8F25D51A, 0xC9562D60, 0x9525A7B2, 0x692CC760,
+   0xFDD6DC5C, 0xC0A4E231, 0xCD6E53FE, 0x216936D3,
+   0x66666658, 0x66666666, 0x66666666, 0x66666666,
+   0x66666666, 0x66666666, 0x66666666, 0x66666666,
+   0xA5B7DDA3, 0x6DDE8AB3, 0x775152F5, 0x20F09F80,
+   0x64ABE37D, 0x66EA4E8E, 0xD78B7665, 0x67875F0F,
+   //T[1]
+   0x6ABC0CBB, 0x931797A4, 0x72DE6F2D, 0x2C081C10,
+   0x6832800F, 0xDDABD427, 0x136158C5, 0x4D1E116D,
+   0x10C9B91A, 0xF44E1EFB, 0x5E8A4B84, 0x43E84B7B,
+   0xB5008F8C, 0x5CC51354, 0x9D4E35B6, 0x6D415BE4,
+   0x5682ED71, 0x657248DB, 0xE3DD4800, 0x81EBC00E,
+   0x742E7885, 0xFFE9EEF5, 0xFF7FA8C2, 0x7A979779,
+   //T[2]
+   0xB1D942F1, 0x18942863, 0xAC3E5EBA, 0x98894A8D,
+   0x016AE20F, 0x99ECD998, 0x2E861900, 0x787D4D15,
+   0xF593542E, 0x68994210, 0x5AFB9993, 0x846357D1,
+   0x3F97D600, 0x8DE392A4, 0xD492EDF6, 0x065ECFB0,
+   0x9FD12445, 0x5BF0A51B, 0xC9A99CA2, 0xE755474F,
+   0xB5EDD3AC, 0xF9DC0A0D, 0x5B15BD46, 0x25326E2D,
+   //T[3]
+   0xF4EDA202, 0x3E0B6B8F, 0xD51A35EB, 0x0078DB7E,
+   0xB4A08A96, 0xD44B60CF, 0xBF2DF9D5, 0x6222BD88,
+   0x82E45313, 0x8F1EFA57, 0xBA902B06, 0x5410B608,
+   0x261B7C4F, 0xDD6BDAED, 0xEA4ED025, 0x0325BB42,
+   0xB6740859, 0x2DFD92E9, 0x9CC4BF86, 0x3B0ABE0E,
+   0x40094560, 0xC79980E6, 0xC7D3AE0A, 0x628B09E2,
+   //T[4]
+   0x61CCFBA2, 0x1A700667, 0xFF3A78C4, 0x2CDD6232,
+   0x3B1950AB, 0xB87D9BF2, 0x9C294FFD, 0x0EBA91A7,
+   0xFE515E46, 0xE5E5BF1D, 0x670D959B, 0x5AB5D1F8,
+   0xC32C93A1, 0x85970EDE, 0xABEA7F2D, 0x1830473E,
+   0x82DFFB70, 0xFDD346F6, 0x3FFD32B5, 0x69A10996,
+   0xA2112525, 0x0752B8D9, 0xCE400AF3, 0x38CD1113,
+   //T[5]
+   0x779A878B, 0x00038CDF, 0x5CF98AA2, 0x48FFE79B,
+   0x81401A58, 0x795A75CE, 0xF3650840, 0x1BAEB7CB,
+   0xFF9DDDDE, 0x0AED0C5C, 0xEA1E9130, 0x60FB62AB,
+   0xBD5EA6F2, 0xDC8371DC, 0x446329DB, 0x6FF0102A,
+   0xD1264E74, 0x04A9860C, 0xF766266A, 0x566AB9DF,
+   0x1BFEC264, 0x7A48A83A, 0x125F5F0F, 0x2CEC70C9,
+   //T[6]
+   0xB67103E0, 0x17F9A929, 0x0C3BEF81, 0x5E32D764,
+   0xA6F93E44, 0x856EE0F4, 0x76D4593D, 0x3D3EF963,
+   0xBE61C9B4, 0xE6BCDEAE, 0xA1EC0BA1, 0x59D1565D,
+   0x859A6F88, 0x8FF57478, 0x6CCD1ED8, 0x540533C5,
+   0x7E94107E, 0xCA319AE6, 0x2E3FAEFC, 0x0B00F27B,
+   0xAE3B29FD, 0xA9215E98, 0x7ADBCBD8, 0x55087F9F,
+   //T[7]
+   0x3B5775D0, 0x56145CEB, 0xB84FC950, 0xF4A31EB8,
+   0x20A9F5AB, 0xDA829415, 0x599B1C96, 0x51F4FF8C,
+   0xD7863AC1, 0x7F8406B0, 0x07D4BD1B, 0xB12E8078,
+   0x3852EEB4, 0xF6F99AEE, 0xD46E41F3, 0x35AC9588,
+   0x08D6C911, 0x8FDB7207, 0x901774B0, 0x0C803155,
+   0xB22566FF, 0xFB894671, 0xDA58F2EA, 0x4DA02F54,
+   //T[8]
+   0x2CF1C251, 0x7C9A9C08, 0xB9BC0907, 0x8C82B3B1,
+   0x67071AE4, 0x0B205F47, 0xDBFB6E67, 0x770C3968,
+   0xEAE1E0D5, 0x395D5A91, 0x7CE41617, 0xF3DBAD93,
+   0x33FA873C, 0xFDC5CC26, 0x5CF61B27, 0x13EBF8E7,
+   0xD097097B, 0x1BB1A00D, 0x826A18B0, 0xF954A87C,
+   0x8DB06FF7, 0xDC8B0F2D, 0x3D3FCE28, 0x6C4B4FA8,
+   //T[9]
+   0xB1E3CBCB, 0x23246812, 0xB51B86B7, 0x4626BA92,
+   0x7C5A82A9, 0xBAD60319, 0xB0A4D421, 0x1A3D5FA5,
+   0xA7F87BC6, 0xD984822E, 0xD61F19A1, 0xC9878318,
+   0xD28F1441, 0x033D3655, 0xA0EE984E, 0x1D5FAA15,
+   0x4C4CD018, 0xC55A92F6, 0x3CC8BE2A, 0x4E14438C,
+   0x1979DF17, 0xC921531D, 0xE10255C8, 0x17A34938,
+   //T[10]
+   0x057B6D3B, 0x0E9320B2, 0x860F4772, 0x10B2C5A4,
+   0xBD81A2E4, 0x0F9197B3, 0xED239AA2, 0x2FBB78D3,
+   0xE6876F8A, 0xBA5654A6, 0xED32CE3E, 0x60340F88,
+   0x0BFD94E8, 0x4B3EAED0, 0xD4B2EB09, 0x7CA591DF,
+   0x6412A41F, 0x472AA9E2, 0x19535AF4, 0xA4953AE8,
+   0x186C159F, 0x8F3AAC29, 0x4BEF31CC, 0x604BC279,
+   //T[11]
+   0xFC05703E, 0x7AD7ED82, 0xB24A546D, 0xAAB53269,
+   0x2DB802F0, 0xBE5BB130, 0x01AFD43B, 0x152144B9,
+   0x277C3CF9, 0xA6EDFC70, 0x07227BE2, 0x188AF5D5,
+   0x0398A8DA, 0x3D833341, 0xC74CC97C, 0x1C910935,
+   0x25B94DD0, 0xB828C916, 0x60F545EC, 0x6292F072,
+   0x61E111ED, 0x6B9DE931, 0xE1D69D5C, 0x5F2DB943,
+   //T[12]
+   0xEBFA7444, 0xA2FBF779, 0x5D42378B, 0x2495535D,
+   0xFB682BBD, 0x2AAB1D9B, 0x8BB17FC1, 0x258C48E9,
+   0xAB2EDE72, 0xB5484D2C, 0x96781AF0, 0xF598F79A,
+   0xC67CC1B7, 0x3029E258, 0xB2C73AAE, 0x26795961,
+   0x933E9C0A, 0xC93C4503, 0x43A06159, 0x2923AB9F,
+   0x5E470438, 0x1BC5936E, 0x0C87AB77, 0x102F72A8,
+   //T[13]
+   0xFD232A79, 0xFEC6D6E4, 0x1FF7D145, 0xE4F8648C,
+   0x46FED176, 0xC7393E44, 0x284F0DC6, 0x7E04FD97,
+   0xB5416F55, 0xA2C2AEF3, 0x1CF38850, 0xDCC3FD7C,
+   0x16F820CD, 0xBBE39C6F, 0x3ABC1275, 0x66925718,
+   0xCC075BCC, 0x6C1B0A47, 0x00625B46, 0xB381E27E,
+   0xCE584A22, 0x4F83CCE3, 0x88730D11, 0x53FC36F4,
+   //T[14]
+   0x1C5A28B4, 0x427F0EA3, 0x422EC038, 0x92F12BB6,
+   0x9118795E, 0xCCF37177, 0x7F2BE5CE, 0x0841EF24,
+   0x14D4A625, 0x5C290295, 0xBADF9765, 0xF2F8A91E,
+   0x92BE151D, 0x561548D8, 0x776C5960, 0x2E707407,
+   0x84F5D228, 0x8E9E8673, 0x050A0957, 0xE2E4E097,
+   0x5F96489F, 0xB5D1A9E9, 0xF8BAF16E, 0x35A1BA28,
+   //T[15]
+   0x60B7E824, 0xFC8047AE, 0xC2E723E5, 0x98E685C9,
+   0xE14E29A0, 0x952D3984, 0x3C45F32C, 0x4C27AFFF,
+   0x4BF5A66B, 0x5BBABD11, 0x51A4C49E, 0x90D0BE1E,
+   0x26C29C3A, 0x95F11EB6, 0x526DC87D, 0x5F2C99E6,
+   0x46F1338A, 0xE9E731C9, 0x6663ADA9, 0x14786482,
+   0x07924B6A, 0xD4E15600, 0x0BF4602F, 0x05A164FD,
+   //T[16]
+   0x680C969A, 0xFBE2FD29, 0x31ECBCE6, 0xB0E6EC08,
+   0x8CC36053, 0x8AB3C1BE, 0x2B88E48F, 0x6E64E555,
+   0x7BAFD09B, 0x25352A64, 0x9EC55210, 0x36391158,
+   0x39B85145, 0x6A9DFC93, 0xA4CB58BE, 0x383C510F,
+   0x814683A9, 0xA138B0BC, 0x783B8D60, 0x43FE5278,
+   0xA9B93591, 0x57BF2EB8, 0x5104D8F9, 0x475C61F8,
+   //T[17]
+   0xD73D147E, 0x8EDAC903, 0x54306603, 0xA4080FD9,
+   0x6506DAB5, 0x30E9C9C6, 0x64AEC9D8, 0x6AB11676,
+   0x9408D609, 0xBC667283, 0xA5D04630, 0x52BC7970,
+   0x1CA5371D, 0xE935599C, 0x78E94070, 0x4642C771,
+   0x9940DC0D, 0x93C8E18D, 0xD4EC2802, 0x291FA31B,
+   0x17BCB59F, 0x91674CA2, 0x5C2B3AC7, 0x6EB311EB,
+   //T[18]
+   0xA26182C9, 0xF88EEEB7, 0x27452594, 0xC2CD4717,
+   0x37DCAEE5, 0x612AC128, 0x6337251D, 0x1C061B27,
+   0x20D4E903, 0xA5DD83DE, 0x8B47E4FA, 0x853B6B16,
+   0x6F2B7A3B, 0x960C9BDE, 0x0F49A680, 0x6B24C91A,
+   0xDEDDC149, 0x09EEAD5D, 0xF93A6D60, 0xF41B5FFF,
+   0x50809278, 0x8095FEC0, 0x6EC93A78, 0x493CFDF0,
+   //T[19]
+   0x43ABCA05, 0x8BF30E63, 0x9BF8A641, 0x53807053,
+   0xE38F5E86, 0xC8180DC3, 0xD81F344B, 0x6DF2BC1D,
+   0xDFBE3A34, 0x89F3F6D9, 0x9F94E1A1, 0xE95D4C5D,
+   0xEF9249A1, 0x8981530E, 0x37A68758, 0x6062DDF1,
+   0x5A25F8B2, 0x93CED87B, 0xD848FC92, 0xF7E588D0,
+   0xBEF719EC, 0xE6D770E8, 0x25B2CB8A, 0x507C0226,
+   //T[20]
+   0x1B9D5A63, 0x527DC68C, 0x6A0970EA, 0x73F332E1,
+   0x7B071F21, 0xD8499B7C, 0x7225F3C0, 0x31ED9D6F,
+   0x54363667, 0xE6719240, 0xAD112811, 0x7B853293,
+   0x493BB73E, 0xB0071C13, 0xFDAA932E, 0x3D4728FD,
+   0x2865FB39, 0x703BCDDE, 0xE8F44232, 0x0F574737,
+   0x0BAF8FB7, 0xC1B485C5, 0x8E2EA5C4, 0x4E602BAF,
+   //T[21]
+   0x6076A21E, 0x4C7BEA2F, 0x79A3FAAF, 0x6C335BFF,
+   0xEBDB954B, 0x3A25E1AD, 0x67636BC6, 0x098228AE,
+   0x4361A525, 0x3EE32C84, 0xA747A548, 0x14693B63,
+   0xF3B8CD78, 0x719F237B, 0x5D69038C, 0x12E26433,
+   0x207422F5, 0xE65194C6, 0xDE702B67, 0x203BBC0A,
+   0x9D1B0198, 0x34182843, 0x107FB252, 0x675998DC,
+   //T[22]
+   0x2AFB8AA3, 0xE1923531, 0xCBFACA67, 0x47B14091,
+   0x84BE2EA9, 0xB0AC12D2, 0x55ABB4E2, 0x215962B7,
+   0xCA7579DA, 0xEDA6DB58, 0x3422374A, 0x65F5F025,
+   0x341C8B94, 0x67DB07D2, 0xA0711805, 0x137CDE64,
+   0x62602799, 0xCCE1FEA7, 0x67A55D9A, 0xE53FEF79,
+   0x38FF715C, 0xE77CFF33, 0x396E5D7A, 0x04D43B24,
+   //T[23]
+   0xE1848129, 0xA8F3DF28, 0x6011F927, 0xEF36AC08,
+   0x1877888B, 0x330CB151, 0x0145FEBE, 0x7DAE1993,
+   0x07338F08, 0xB07F525D, 0xB079B338, 0xF3A97DDB,
+   0x50909CBF, 0x6A913CA3, 0xBE7D192F, 0x51DF214C,
+   0x0F34705F, 0xFC2AD98E, 0xA2B48A41, 0xF2F3239F,
+   0xCE015F21, 0x75BD65E2, 0x99CC1F1A, 0x69667A17,
+   //T[24]
+   0x9E509F05, 0xFF33DBA2, 0xC4E1B9EC, 0xDAE463CC,
+   0x1D02F2C3, 0x6A5D1CE4, 0x9BC01520, 0x00DC7DED,
+   0x1530FBAF, 0xB982896F, 0xFF365B5E, 0x78254C44,
+   0x43DD89EB, 0xE6F25FD1, 0xCAE3E2EA, 0x47208A67,
+   0xEA8112EC, 0x90C51CB4, 0xDD4C426E, 0xA8FA0D62,
+   0x3926618F, 0xA6AD147F, 0xB27E62D9, 0x79F0A44F,
+   //T[25]
+   0x2E3A0568, 0x7DB8A4A2, 0xEA7FAB77, 0x8CCD6214,
+   0x02D39890, 0x81BF59DB, 0x9ED06C41, 0x244B05EE,
+   0xD5C5164C, 0xE8F936E3, 0x64C2C7CE, 0x5FFE9B66,
+   0x703A77D4, 0x7401952D, 0xF9DBBB02, 0x4689E981,
+   0x4759EECF, 0x3111D2C3, 0x620A1B9F, 0x5BFD38B1,
+   0x3BE9665F, 0x9CAE8C7C, 0x6D6E1FCE, 0x79A849B9,
+   //T[26]
+   0x039F9529, 0x0F2D5074, 0x73BA89E3, 0xA4DF18BA,
+   0x77288629, 0x5607B56C, 0x9ED698E5, 0x2037B79D,
+   0x09B4FE5C, 0x4BF34E92, 0xF007ABFD, 0xFBAA5E3C,
+   0xE307CED0, 0xE7449249, 0x30160479, 0x402DD7D0,
+   0x5A77FCFB, 0xD49EF711, 0x1E00EF1F, 0xBE67F27C,
+   0xAB93247D, 0x16A9C773, 0x27FEC268, 0x6B233CDD,
+   //T[27]
+   0xCE226144, 0x005A1DE6, 0x7DEECD78, 0x5A88278F,
+   0x99986467, 0x6050E024, 0x9DCB99A2, 0x091ECF9D,
+   0x26D41A04, 0x6C692983, 0xA72A809E, 0x921E02EC,
+   0x04D979BC, 0xBCDF4A6D, 0x02FF02C3, 0x32462D54,
+   0xBB2EF3D4, 0x290800CE, 0xA5DA211B, 0x90553F53,
+   0xC465913D, 0xC1694057, 0x6BA02A47, 0x415102DF,
+   //T[28]
+   0x35B74FB2, 0xE0AF39B3, 0x255BDA22, 0xD4032830,
+   0x6655755C, 0x66F5A4C6, 0x3D6D405C, 0x24A9F0E5,
+   0x6C23992F, 0xEC378441, 0x7653E13D, 0x016B894C,
+   0xB5D2F034, 0xD6E38AAF, 0x06864A90, 0x39B211F5,
+   0x48D45CC7, 0xEFF7A337, 0xCAE05BDE, 0x04C4AD03,
+   0xB8DE7BA1, 0x7045B14E, 0xA5EF396E, 0x2CECE22C,
+   //T[29]
+   0x99128E66, 0x14386E87, 0x868017CB, 0xC25CC544,
+   0xFCF05F18, 0x0708D258, 0x1521EF75, 0x5F2400BD,
+   0xA7F7D4E9, 0xC87C1B3F, 0x3F742456, 0xF70A0537,
+   0x658DEA64, 0xC10C4B7A, 0x2F2A19E6, 0x1F7D5361,
+   0x5F4583AF, 0x947A24CB, 0x093F0229, 0x2E443FA1,
+   0x8F74403F, 0x7C1F0125, 0xD14BBC88, 0x36319E6E,
+   //T[30]
+   0xFB1ACD39, 0x949E7B31, 0xFC741B89, 0xBCC9335B,
+   0x6F1119CE, 0x3622A715, 0xD9D129CA, 0x6FAC4038,
+   0xFAA0D1EF, 0xC45BD38C, 0xBD2869E9, 0x5CAE8481,
+   0x12BFC659, 0xD1C946A6, 0xEF8F7247, 0x74E57A3E,
+   0x2AFFF99F, 0xE06ED425, 0x6261CF7B, 0x0B661338,
+   0xE475B0F0, 0xADB17623, 0x4A5F1F9A, 0x06BEA486,
+   //T[31]
+   0x52014031, 0x285B9456, 0xEE52AA8A, 0x8D050AD8,
+   0x2EAAB5CD, 0x87B7AA38, 0x04FB2BF7, 0x543D84CB,
+   0xDE59EF20, 0x6E932BA4, 0x9A42EC2E, 0x46F42DD4,
+   0x182B2758, 0x693D838F, 0xB63ED49E, 0x0358FDC5,
+   0x03982220, 0xE5C7264A, 0xDF18D5A7, 0x6A55E29D,
+   0x3CE00C8E, 0x3C9A06A7, 0x3F4B726C, 0x045A56CC,
+   //T[32]
+   0x5D317D11, 0xC37CC528, 0xFA1A978A, 0x2BE2DBD0,
+   0xDB1FDA15, 0xA8FB98DF, 0x03EF6E67, 0x6E941D32,
+   0x30F490E3, 0x76365EE2, 0x686C833D, 0x593D9923,
+   0xC92E2F24, 0x39B7749B, 0x9CBC3C81, 0x576E304E,
+   0x89E46C20, 0x1851FA63, 0x1B5EC6BB, 0x4C1E98C2,
+   0x97F7FBBA, 0x27F412B1, 0xA4AF1A45, 0x55914FB6,
+   //T[33]
+   0xB32F56F0, 0x5682666F, 0x38FD4625, 0xE8BE4BA2,
+   0x649501D6, 0xF78CF0E0, 0xBCCE6BAB, 0x2567450F,
+   0x538B58D7, 0x6581F96E, 0xC25CFDF1, 0x5EB54F3E,
+   0xF899E2CF, 0x84F772F7, 0x4768DF26, 0x7C9CA5B5,
+   0x346BFD42, 0x5B47ADCB, 0x96492329, 0x2EED91FA,
+   0xDE1D1AD1, 0x96795CA9, 0xD0351A40, 0x6DF36DD4,
+   //T[34]
+   0x27428F35, 0x2517D3CA, 0x30CB34E3, 0xF290AB09,
+   0x2ABFCFDB, 0x5BABA2D8, 0x209F3551, 0x1F919D7B,
+   0xDA29FBE7, 0xE01B2446, 0xA06B8561, 0x3C054236,
+   0xBB5165CF, 0x07FA965D, 0x78EEA5F5, 0x25971A9F,
+   0xE46FC462, 0x88906BA1, 0xB22DCAE3, 0x11899E10,
+   0xC4183A1F, 0xBA019A81, 0xDB50CA43, 0x459F41E0,
+   //T[35]
+   0x8FD7279E, 0x6D3E0A8B, 0x76CB7E67, 0xAD6D084D,
+   0x05D2B9A4, 0x63764C36, 0x393CC0FA, 0x32B99F55,
+   0x259A253A, 0xC37CECFE, 0x20845ACF, 0x0B3D3F12,
+   0x0932C15F, 0xDFC95B2F, 0x150EC715, 0x6CAAB6DA,
+   0xA9FDE490, 0xDD9C208B, 0xBF0FFA1C, 0xDD68656E,
+   0x7903E44C, 0xE2C44BC8, 0xE32B3260, 0x56FD78DF,
+   //T[36]
+   0x1AFFF489, 0x89E789A8, 0xFF3F680A, 0xDB34C540,
+   0x775F1B11, 0xF958AB8A, 0xCB49E57E, 0x5D26EEFC,
+   0xA8B00BDF, 0xBD471714, 0x46ABABBA, 0x0647E15D,
+   0x0A3CDF15, 0x691FF4ED, 0xE6D1578B, 0x2CD8D2DD,
+   0xD8FBC668, 0x61F08B52, 0x52B365DE, 0xAED76F7D,
+   0xC3B022DA, 0x9E79DDAD, 0xE9A36273, 0x13FA892C,
+   //T[37]
+   0x858E9805, 0x571D7743, 0xE5BBB63B, 0x122F404F,
+   0x24A17812, 0xFA93F996, 0x5637C0AC, 0x4194F18A,
+   0xDAB6D4B6, 0x67339D25, 0xA7A1D5F3, 0x0D0179AD,
+   0x901ECD77, 0xBDE739EF, 0xED19929F, 0x13AD5649,
+   0x5BABDB27, 0xB2AAB7EE, 0x5A4CDCFD, 0x7BED72D9,
+   0x3322E2DC, 0x4923F4E5, 0xFDEF7631, 0x2A730672,
+   //T[38]
+   0x1C98550C, 0x9FEB4F4A, 0x36BE21DF, 0x64EC6F17,
+   0xA5573883, 0x054A7FB4, 0x1A0849FA, 0x243442A5,
+   0xE2C6A8C3, 0x26B13D70, 0x583AE7B7, 0xC42557EA,
+   0xE13B6451, 0xC3D9DFF1, 0x2633DB0D, 0x43D9B9F2,
+   0xF2D6630D, 0xBD643D65, 0x7F7CBF91, 0x867D2998,
+   0x4572B0C6, 0xD42E9BF1, 0x6D938FD4, 0x5E28EBCD,
+   //T[39]
+   0xA955BBA4, 0x35D5FACE, 0xD1BF9787, 0x13E50D77,
+   0xEFF0EE33, 0xC9B67E36, 0x40EF61CD, 0x32E253BE,
+   0xCC8E3FD4, 0x03FA09FA, 0x57F17D59, 0x04D1DAED,
+   0xE17B4361, 0x6F356428, 0x5D8A9401, 0x2D9ACF86,
+   0xFC8EE226, 0x1041646D, 0xB118EDF9, 0x8C055B07,
+   0x52FC788D, 0x9A2E13B1, 0x3F7EC0D2, 0x053FF9A9,
+   //T[40]
+   0x3AE38B39, 0x2570FADD, 0x6105A81A, 0x925CE361,
+   0x22E08A88, 0xC39AD2CF, 0xE4BCE63B, 0x22F456F4,
+   0xAC8C5014, 0xFE5A692F, 0xDE0360E3, 0xB5862DB1,
+   0xADD2C14E, 0x0A30D934, 0x9EBF3F7D, 0x5C8E8512,
+   0xA81AC2A1, 0x53F50EC2, 0x871C8A60, 0xE4AD5865,
+   0x643C758B, 0x3FA3FE06, 0x74C52395, 0x625218F0,
+   //T[41]
+   0xE9EDD690, 0x06EA63BB, 0xB2D7D5F4, 0x1532536E,
+   0x8E9F5C47, 0xD55C86C3, 0x0077FE28, 0x35E81B03,
+   0xDEB7E5F8, 0xF8F5F35A, 0x9386C94F, 0xF1384675,
+   0xBBF27AE1, 0x89C2F5C7, 0x1BCB5D12, 0x6E2810D6,
+   0x0E8ACC28, 0x43AF974F, 0xE4C152D7, 0x2DDECD2D,
+   0xF2E2398A, 0x1E2F0A95, 0xC57C809E, 0x42FB1BE7,
+   //T[42]
+   0xFF6D6F48, 0xB7061E53, 0xE90C2FF3, 0x14A49F9F,
+   0x97E2A5AF, 0xAE267832, 0x21F92EBF, 0x6B97A500,
+   0xB4DECAD4, 0xD42372E6, 0xC145D81B, 0xB8C4ACBD,
+   0xC2FAE325, 0x6AD2C056, 0x6E2297E7, 0x785305C5,
+   0x09B3A8C9, 0xA45F68F0, 0xFF6374D8, 0xB74A7D74,
+   0x0190F9AD, 0xC42467A8, 0x42E06EBB, 0x22A1F24E,
+   //T[43]
+   0x5654734E, 0x5180914F, 0x1AA35C51, 0x7A9DF5ED,
+   0xE668053A, 0xE77FCB35, 0x9CAE5A7A, 0x3DA03F40,
+   0x2AC5E6F9, 0x4C4E5A6F, 0x77D2F39D, 0x28887119,
+   0x56479370, 0xA8B5CF06, 0x62E849BD, 0x6DE392D3,
+   0x695C0E9B, 0x4B2A0151, 0xA9FCEEED, 0x30A346A0,
+   0x8DD9C899, 0x526E2F95, 0x6F40BFD7, 0x7C845DEC,
+   //T[44]
+   0x209DB61C, 0xEFE2CDD2, 0x54571841, 0xF5D22B7B,
+   0xB1525290, 0x13AAFFE5, 0x73331E0F, 0x66B2DAFE,
+   0xFF692873, 0x95CD39D7, 0xA26480FA, 0xC8124122,
+   0x4D633BA7, 0x6817849C, 0xEEDF863B, 0x120722C4,
+   0x559F182C, 0xC97F2215, 0x562CDD28, 0x74986210,
+   0x50124E8A, 0xC75284D0, 0x3795BDA2, 0x6CDEE046,
+   //T[45]
+   0xBE073933, 0x62D284C6, 0x98E1EAA4, 0x20179A09,
+   0xD3CFE535, 0xA3580C6A, 0x775E2C6B, 0x3E0AFC87,
+   0xE9075EDA, 0x695D5419, 0xEA9FCEAB, 0x4DC7D61F,
+   0x743C99F2, 0x51AE5846, 0xABBC9596, 0x0AFA92F9,
+   0xE385E355, 0x365C9C7D, 0x9EC9E10E, 0xF1341189,
+   0x34DBD949, 0xF79A2EF0, 0x6663C0E9, 0x103275C5,
+   //T[46]
+   0x17176BC0, 0x07306267, 0x6E0F5456, 0xD953CA56,
+   0xFB78F298, 0x377D6BFE, 0x3EBB7CB5, 0x643FF901,
+   0x2D52FD56, 0x0F2214CF, 0xFC61C518, 0x2CFD4B5E,
+   0xF7235C12, 0xA3FF76F8, 0x3911639E, 0x3DA2B515,
+   0xC520F3E6, 0xA64DCFA2, 0x4E0088C0, 0xFA70D9B2,
+   0xE7C5683C, 0x598B3175, 0xE0F79CE6, 0x63E33ACC,
+   //T[47]
+   0xAEFAB6B6, 0x08F7DC9E, 0x876F9176, 0xB57C086B,
+   0xA3AD9F0A, 0x66FCABC2, 0x6E2AFEAD, 0x0739DFC2,
+   0xCC7D909B, 0x91AED5DD, 0xC01F292E, 0x7CCFE3C0,
+   0xC73E6784, 0x82F05D23, 0xA45EEBD2, 0x1AC81375,
+   0x1D7AA917, 0x239D72B1, 0xBBC4B0A0, 0x032A23AB,
+   0x48436E1C, 0x1B4ECDF8, 0x727BCFED, 0x01207B5A,
+   //T[48]
+   0x7B434E9A, 0x2CCCD11B, 0xE8ED95DD, 0xA3A584BC,
+   0xD0D4CB85, 0x176ECE65, 0xFD077C34, 0x7F8BF6D7,
+   0x26137034, 0x007C9753, 0x33300A5E, 0x7F7F63DF,
+   0xDB4B71CA, 0xB8D5436B, 0x1E99141D, 0x4CDB6F4B,
+   0xA2CAC9C7, 0x87FDA094, 0x5657F73B, 0xFC52268B,
+   0x5B5DFA0D, 0xC3528BE7, 0xDC7DE085, 0x1C8BBB2E,
+   //T[49]
+   0xDD9B4569, 0xDA6DC42D, 0xDA5E160C, 0xB231B7C8,
+   0x52A990FE, 0xC4023BBB, 0xAC857666, 0x2D852FFF,
+   0xF5C4B5B8, 0x4BC97480, 0x2E9BBEC1, 0xD0F8641C,
+   0x64F11F5C, 0xC1A66D5E, 0xF5F2C70D, 0x771551E3,
+   0x55D4AE93, 0xD6A457A4, 0x74625D9C, 0x6B1B9592,
+   0x3C0F9D03, 0xE43984B8, 0x011C3B0F, 0x5EDE2ACF,
+   //T[50]
+   0xBC8BE5F8, 0x99DE3029, 0x54D5BD4F, 0x059AC335,
+   0xACAB608C, 0xB89D53F6, 0x1386626B, 0x45BC69E8,
+   0x141D02CF, 0xCB7CAE6A, 0x9EDAF7D8, 0x4E67C88B,
+   0xC3BD1211, 0x464E4A40, 0x504DA240, 0x69B0996F,
+   0x3E51ED96, 0xB5F9BC57, 0xB4B01F73, 0x7CE5BFA5,
+   0x6F322CD3, 0xBD2A87FB, 0xE47CE0B4, 0x75A2CA34,
+   //T[51]
+   0xE8DD984E, 0xDFBA5AFC, 0xEF09429D, 0xEB1EB6B2,
+   0x7572634D, 0x051595C6, 0x8651EA83, 0x5CE29160,
+   0x6056FB14, 0xC00723CE, 0x524F82BE, 0x73547948,
+   0x866A0A9F, 0x824429E5, 0xF534791A, 0x2D229E21,
+   0x3A5419EB, 0x05D1A2A5, 0xE2C1564F, 0x26A30A10,
+   0x39397805, 0x204EB932, 0x82C7E92B, 0x4CF72A4D,
+   //T[52]
+   0x0522E61B, 0xC0E0424A, 0xBC50A6F8, 0x789AF62E,
+   0x71CFA184, 0x68633DE5, 0x20A1FB20, 0x7405EEF2,
+   0x9AA77D6E, 0x0011BE9F, 0x79A749EB, 0xDC357503,
+   0xC46BDBFE, 0x852DE3D6, 0x2A2BB0D0, 0x4A58B3E7,
+   0xF54BB838, 0x19969AF7, 0x56B6136B, 0x1986D91A,
+   0x0C195776, 0x86F98B41, 0x3E3B4EA3, 0x7118BC14,
+   //T[53]
+   0xE19B6C37, 0x08DA0FD2, 0xD2505821, 0x78889342,
+   0x1BE5DDA1, 0xBC2084B5, 0xAD4B05AF, 0x67932BE5,
+   0xF5131A23, 0x2F1BF32B, 0x83F47174, 0xB807295F,
+   0x5C050D40, 0x52AB8397, 0x0782C19F, 0x1625D234,
+   0x1A257908, 0x41D3C1AB, 0xF110D6D4, 0xFD31F16E,
+   0x34AC39E7, 0x43F003C3, 0xDAD44B1E, 0x31EB1276,
+   //T[54]
+   0xE924C02C, 0xB13B584D, 0xA8A036F8, 0xB2C9E11E,
+   0xAF12A168, 0x19418AE7, 0x2EF639C2, 0x6CBD6226,
+   0x6D804D9B, 0x424654ED, 0x4A447002, 0x2414A805,
+   0xB5C53B74, 0x9A34087A, 0x4D382A5C, 0x51EFFAB0,
+   0x57AE1A48, 0x74D28BD4, 0x02F04561, 0xE7582D6C,
+   0xEEB35C50, 0xEABF0179, 0x8306F0A1, 0x66BBBF1A,
+   //T[55]
+   0xF51A519A, 0x88AA829F, 0xC60415E5, 0xB24E8B63,
+   0x2C51FA59, 0xAB53BB4F, 0xFA3EBDBE, 0x30A4C16B,
+   0x7806D748, 0xE83E12D5, 0x4B3A135D, 0x5F645AF9,
+   0x23D82D89, 0x20C096E0, 0x57E51BCB, 0x5DBD9759,
+   0x7FCA4D00, 0xB5A892D5, 0xF6EC9D15, 0x4EA5B69C,
+   0x1E792E30, 0x299A20FC, 0x8C1FA20C, 0x0C6F445D,
+   //T[56]
+   0xDA0A123B, 0x480519A2, 0x718227A1, 0x62B2B202,
+   0xCD2C1456, 0x8F841AD1, 0x27169583, 0x33590316,
+   0x396116C9, 0xDF75F654, 0x375168C4, 0x0CE24BAC,
+   0x88E40783, 0x5A1DF50A, 0x917BDADB, 0x0ECDA82F,
+   0x8AFF45D3, 0x89AA4839, 0xDBF09467, 0x73DC7CFA,
+   0x39BE7E86, 0xC13D3781, 0x8C6DA5DC, 0x3CA7D0D1,
+   //T[57]
+   0xAD11BAC7, 0xA0B1BF55, 0x7AD089D3, 0x13B67F76,
+   0x314921D5, 0xEA4DF5E3, 0x2B2D4711, 0x79849A47,
+   0xB048F719, 0xFFE44A28, 0xB600C279, 0x42302CF4,
+   0x0F6B5172, 0x242A8578, 0x46459C6C, 0x2E795118,
+   0x003FBCDA, 0x8C2671E4, 0x4A70B3E0, 0x2C21DA0B,
+   0x6E1BCCC0, 0x7142FA5C, 0xF120E4FB, 0x0C56F308,
+   //T[58]
+   0x1D0E529B, 0x18B3C257, 0x57C77DA0, 0x77D9264E,
+   0x83686001, 0xCAF2F27E, 0x0D169D26, 0x5EBAAB85,
+   0x410BE6CC, 0x9FA68115, 0x5435E026, 0x6D4216BB,
+   0xB1B5F7A5, 0x3E5DAA3A, 0xA6B256B4, 0x46E71CEE,
+   0x551BCC72, 0xFDC40B24, 0xC2D47B59, 0x0E62F3BD,
+   0x4323251A, 0xC532AB89, 0xA1ABDF08, 0x1FA84D54,
+   //T[59]
+   0x2E47F104, 0x96BDE618, 0x12DC75A1, 0xC2DFE0A0,
+   0xD4A8FB2C, 0x956D6888, 0xCF019410, 0x73A0BC31,
+   0xFBA56A43, 0xAD01911C, 0x89045B38, 0x9BFD2DB1,
+   0x98FD5817, 0xD7D4FBA0, 0xF5882CDC, 0x4106DA69,
+   0xA5B236B6, 0xE7F76B33, 0x81235A2A, 0x55B6A365,
+   0x8C7825BD, 0x8F8F551E, 0x395EA44C, 0x2D75F653,
+   //T[60]
+   0xB91F5FBF, 0x96EC46C7, 0xE89B5969, 0x71B1A7B7,
+   0xABDAD1B3, 0x126220BA, 0xA47BBF86, 0x0B506C25,
+   0x4123DFBD, 0xDF4D2035, 0x80685714, 0x47527D08,
+   0x2269118E, 0x183D7ACE, 0x0471E294, 0x4A845C4C,
+   0xEFC506E7, 0x55E6A1AA, 0xE3CCCF77, 0x85A11A3C,
+   0xDC6FF2B3, 0x1958C132, 0xC69456A9, 0x3C9AE581,
+   //T[61]
+   0x029CB742, 0xC7BE4353, 0x9D8F1A58, 0xAB0D65EF,
+   0x47F712D7, 0xEE6334EA, 0x734FD46F, 0x41476912,
+   0xC95A6AA4, 0xA6A37D49, 0x36EFDC88, 0x042AA734,
+   0xEB97989F, 0x941515F7, 0xA32F7B6E, 0x703A01B6,
+   0x71C97941, 0x34767E98, 0xFF903853, 0x9EF7FE33,
+   0x2A272038, 0xA406977F, 0x95925E95, 0x1696EA6C,
+   //T[62]
+   0x0A4C42BA, 0x0D69F526, 0x03418611, 0xF362FB46,
+   0xABAA78E7, 0xCEE5487F, 0x0B0E009A, 0x4DD948B2,
+   0x24C87DAB, 0x251FC63D, 0x92A16F84, 0xE14521B8,
+   0x004E3CCB, 0xE731835F, 0x6F3BFE64, 0x0EB7366D,
+   0x41E170BC, 0x31BB6981, 0x9EC86880, 0xD4A5B776,
+   0x1590DEA3, 0x4854258F, 0xF1BD2518, 0x108D1394,
+   //T[63]
+   0xC7DAD28D, 0xDB7AD644, 0xB81D7D26, 0x7A9DDEE1,
+   0x1C7E177D, 0x2D8D0437, 0x38185E7C, 0x1BC7AF1E,
+   0x00314833, 0xCAF2F659, 0x631B270F, 0x1D027E12,
+   0x795DC049, 0x7A5EEF87, 0x55661F2F, 0x61D909D8,
+   0x6636C2C7, 0x51B84521, 0x56DE7EF8, 0x9BB8F236,
+   0x4B1F0FBD, 0xCCB664DE, 0x54B8FA44, 0x1A340B80,
+   //T[64]
+   0x07B06838, 0x85CCFCA3, 0x654C7F10, 0xFAFAB365,
+   0xDB6F53A5, 0x46564C74, 0x7AD5E203, 0x02C61C29,
+   0x04F259BC, 0x84C06375, 0x671C602F, 0x8663FD76,
+   0xDCBFFAF3, 0x91902DD2, 0xE5A933BD, 0x42DA0C66,
+   0x0C62D525, 0x10A39D3A, 0xD20A1CA4, 0x18DA8620,
+   0x61E14F1C, 0x3775E5BD, 0xFE2A7A47, 0x1000B139,
+   //T[65]
+   0xBC32F335, 0x8E332F03, 0x1DE11C7D, 0x79DFDBD3,
+   0xEE4F53CD, 0x760F876A, 0xF7C610F5, 0x5ECEB7DE,
+   0x495F9732, 0x9037DB52, 0x07FA4444, 0xA37BB57E,
+   0xE175218D, 0x84780B55, 0x5D7C6C39, 0x41B8401F,
+   0x871D31F8, 0x810FB9E3, 0xBA40F3EC, 0x713D8262,
+   0x296E3F86, 0x45BD0FAA, 0x2830142C, 0x62D9D4AC,
+   //T[66]
+   0x2D3FDF8A, 0x8691F5DF, 0xE7E75D0D, 0x0F2FC669,
+   0xB7285384, 0xC8BD2923, 0x5E6BB231, 0x29E42A1D,
+   0x354EF6AB, 0x68B3A929, 0xA8F9EB5D, 0x4873FF11,
+   0x34414082, 0x8C2DF7AF, 0x1DBEC73D, 0x7FAA10C5,
+   0x21F2EB08, 0xD372E4B2, 0xF4F76941, 0x0E9CB90B,
+   0x4CF20914, 0xADE5C9AE, 0x761456FE, 0x5D8D4581,
+   //T[67]
+   0x66F4CA27, 0x1492ECC2, 0xD0630657, 0xEB06154D,
+   0x774F5869, 0xF0C78BC5, 0xA064ED8E, 0x71663CB3,
+   0x0ADA2DC6, 0x2770FE0D, 0xFA27F864, 0xA5305FF6,
+   0xF2DA6C0D, 0x47785E62, 0x1C0066D3, 0x5D1F56FD,
+   0x857246F5, 0x5DAA6B49, 0x35DC5FB7, 0xBBEDF373,
+   0xBC0941F9, 0x6FE384E6, 0xDA39A2EC, 0x496C664D,
+   //T[68]
+   0x4CF46F3F, 0x270EFDD8, 0xBC2B5CC9, 0x23E7A4C0,
+   0x319F0229, 0x96D7E9D6, 0x0B5EE0F4, 0x3CEE130E,
+   0x3DF2ED09, 0xA4C39176, 0x87D4AE97, 0x18F65DD0,
+   0x671D1F47, 0xA063CFF2, 0x93F82791, 0x3F237545,
+   0x7C932898, 0x8A144393, 0x80145B2B, 0xE368F6C5,
+   0x2CE7E6E9, 0x437F5BC6, 0x391C3F9A, 0x7508F66C,
+   //T[69]
+   0x02554A35, 0xFB449131, 0xA4B5584F, 0xB1134AFD,
+   0xB561511B, 0x7E8830C0, 0xBB40352F, 0x425D84B0,
+   0x0F375BCA, 0x0A7226E5, 0x8615E09E, 0xC515E925,
+   0x1F670C04, 0xBC557AB8, 0x372BB1D5, 0x661562E6,
+   0x53CA8E9D, 0x4AF23184, 0x218EC2F5, 0x2C2B0DFB,
+   0x222E2A67, 0x280AE07B, 0x69734D38, 0x1DB84452,
+   //T[70]
+   0xC5330C32, 0x4A700D70, 0x72EED1F4, 0x80D0EB79,
+   0x919CB61F, 0xC16AFDFD, 0x9D9C77EF, 0x014C341A,
+   0xB85D86D9, 0x99205A9F, 0x96373626, 0x4404D49F,
+   0xED5171F2, 0x295D839A, 0xD3CA3185, 0x355245E8,
+   0xA122F77E, 0xEA668961, 0x0DE2EEB7, 0x4E6A0216,
+   0xC867B086, 0xBD670E8B, 0x5B87020B, 0x3306D141,
+   //T[71]
+   0x5B1204EB, 0x6B275C6E, 0x381AD03B, 0x6B702699,
+   0x2F1DB6CE, 0xC4D30245, 0x7907427E, 0x2142F580,
+   0xC454FB84, 0xE282B433, 0x9AAFF67F, 0xB04D51D5,
+   0x05D163DB, 0x9195E2D6, 0x0BA486AF, 0x558B2DF0,
+   0x7D14D4F9, 0x8987F309, 0x5C1DF18D, 0x96D237B0,
+   0x15AA2CD5, 0xAE95AA76, 0xFA4E0562, 0x1B93BA3A,
+   //T[72]
+   0x0E435B1D, 0x4E1D1635, 0xD6E4A4F2, 0xA7A10398,
+   0x95B79770, 0x12E4E813, 0xEA25CA3D, 0x7C547517,
+   0x325DAEB2, 0x5B6016F2, 0x35763984, 0x47D1A1CB,
+   0xB240FAB4, 0xA0305639, 0xBF9C7AFF, 0x0B02A286,
+   0x3322637F, 0x355069D9, 0xA8C678E4, 0xFF078CE8,
+   0xD7239F65, 0xD40A3BDB, 0xBCD9FA82, 0x6E42D995,
+   //T[73]
+   0x95ACCD1B, 0x4BB0497C, 0x25EF4B25, 0x10F12D0F,
+   0x4456BB1E, 0xE00239A3, 0xC8F9604E, 0x276B3A4B,
+   0x8BD60560, 0x20E9892F, 0xC9BB3AF6, 0xF3891C02,
+   0x52C4337E, 0x305702F6, 0xBED4289C, 0x6FB4EDDD,
+   0x3FE1FFB7, 0x3A97D3A4, 0x16A67645, 0xF28976BF,
+   0xC1C634F2, 0x566CC299, 0xBB277B9E, 0x1E0703EE,
+   //T[74]
+   0x0CE53CEF, 0x9AD37646, 0xE10BAF41, 0x8C38195F,
+   0x2D0756F3, 0xD858ACD5, 0x4E2B79A7, 0x2FDBBB16,
+   0x73AA83D8, 0x1308A3B5, 0xD87368F2, 0xF7070EC0,
+   0xA64B28A6, 0x64556179, 0xCB131F27, 0x08D25C8B,
+   0x6CE8ECEE, 0x0D22BB5E, 0x637175AE, 0xD99BBDCE,
+   0x22BE0E68, 0xCC21A1FA, 0x0B88F7F2, 0x612B0609,
+   //T[75]
+   0x49BAFB73, 0xFF69FE83, 0x218DF692, 0xF87533A2,
+   0x0B8E63CB, 0x5E57DDF6, 0x598F33A0, 0x647E40F7,
+   0x6A870E29, 0x13570096, 0xE9B8E609, 0x3350092B,
+   0x0E3BE800, 0xEC129E7B, 0x3F649CA9, 0x77933488,
+   0x9ABAC908, 0x8468DD21, 0xF4D6B0C5, 0x4A93254D,
+   0xC45DB463, 0x143C468B, 0x33C7ABB5, 0x110E0F7A,
+   //T[76]
+   0xC3913F7A, 0x37A38482, 0xE14E323D, 0xE76C0D09,
+   0x552D09CE, 0xE0C76C71, 0x06462591, 0x35331781,
+   0x5E06CCF2, 0x45AFDDDC, 0x6797D4D4, 0x03F5C8BD,
+   0x17C7D0B2, 0x9272E99B, 0x0ABC1FBB, 0x67974E69,
+   0x247C49DC, 0x6EC4DE5D, 0x5A549608, 0x6C43B5A2,
+   0xCB1AFFC4, 0x04DAE014, 0x34E49F15, 0x44DEC1D1,
+   //T[77]
+   0xA8E98A48, 0x63170B0C, 0x095E8D1D, 0x06212067,
+   0x04E747AB, 0xBD6F583D, 0xA3F2508B, 0x190A6CC2,
+   0x82E10CD7, 0x80A52EBD, 0x927E6A92, 0x13C64D90,
+   0x257E5DD1, 0xF604BC58, 0xAA67BF18, 0x65657264,
+   0x76CA1063, 0x8DAA81E1, 0xB918F7F8, 0x2B641F46,
+   0xDC5AC0A8, 0x8728FDAB, 0x4F8B90A2, 0x5C0ABA33,
+   //T[78]
+   0xD0C07B04, 0xFFB980D6, 0x7A9BB078, 0xE2EE1A18,
+   0x294709AB, 0x6540C04D, 0xD9BF209B, 0x1AA8CE01,
+   0xC2EF9ADE, 0x4625979E, 0xC7261A36, 0xC1C5F91D,
+   0x7A1BC7C7, 0x0FE53980, 0xF45FC6D1, 0x6EC27687,
+   0x40A037EC, 0x28E31ED6, 0x5635AB77, 0x6059872C,
+   0xCAE1F6B2, 0x60B647E9, 0x11B5CABA, 0x13FE3129,
+   //T[79]
+   0x23ADF1D1, 0x969364DD, 0xF77F7041, 0xA289A9F5,
+   0x1B8DB034, 0x491519AE, 0x876D2358, 0x76814F15,
+   0xEAB523FB, 0x8D54ACCF, 0xEB2F424E, 0x68DB630F,
+   0x8BCFA837, 0x6EA4F5AB, 0xD6B22A96, 0x0DBD9EBE,
+   0xFDC53B75, 0x7CAF4939, 0xD4939CF1, 0x74952AD4,
+   0x8E613432, 0x231C8937, 0x4D47018E, 0x3E24E5A8,
+   //T[80]
+   0xCFA942B4, 0x178A8301, 0xC6C47647, 0x0B950483,
+   0x62C911FC, 0x84760CB8, 0xFA37B9D9, 0x6DC27CFC,
+   0x04B33E58, 0x488F8CBB, 0xCC2791BC, 0x1922B7F9,
+   0xB5092E83, 0x1C54D972, 0x0BEAA14D, 0x7208C6F1,
+   0x40A20B6B, 0xF6948EDA, 0x14425500, 0xB877862F,
+   0x68DA1F1B, 0x88AD21D8, 0x31EB33FA, 0x56BC37C1,
+   //T[81]
+   0xDA872A83, 0x51476DF8, 0xDC064D47, 0x06424E9F,
+   0x317D2CFD, 0xB15F904E, 0xABD779C9, 0x0C61526F,
+   0x7FC25BAF, 0x5BC71F45, 0x8A5E75B6, 0xB6122431,
+   0x698C0A5C, 0x2725D443, 0x70931665, 0x02638A73,
+   0x0115EC9A, 0x90A9ED49, 0x225ECF73, 0x16AAA3AA,
+   0x3B2C72E6, 0x0A5A5CEA, 0xB109DDB1, 0x38E6442F,
+   //T[82]
+   0xAAD1138F, 0x48EC8241, 0x930CE4A8, 0x731FE35B,
+   0xED0751FA, 0x9C653A1B, 0x9EF330FE, 0x5561493C,
+   0xE198ABF8, 0xA49CAE25, 0xA64D4252, 0x8307995D,
+   0xC53AE9C9, 0x154F20C9, 0xD4C16A65, 0x6375B564,
+   0x97CD26EC, 0xA67B2AE1, 0x980FCCBC, 0x1BCF36E3,
+   0x3953DB99, 0x1D2E7BD9, 0x51854AB8, 0x2EA4E35F,
+   //T[83]
+   0x6E7A8746, 0x8A0A5680, 0x6B11DDC0, 0xDF47DDD6,
+   0xEAD8D910, 0x038FB07C, 0x8FC12E00, 0x30D3A844,
+   0xF9A28906, 0x03DCAD34, 0xA751ED85, 0x5DE79C82,
+   0x320C9352, 0xAAE15B9A, 0x6D02B8CA, 0x3AB1D43A,
+   0x6D080106, 0x53D91C4B, 0x5505C291, 0x2DEBE8AD,
+   0x11801164, 0x3840D793, 0x8206F111, 0x4EE2D2CB,
+   //T[84]
+   0xB5BE5FF0, 0x386B100D, 0x8076AC32, 0x7194CABD,
+   0x35C9F27A, 0x429FDE2A, 0xAB011849, 0x647CEFBC,
+   0x923D583F, 0xDB13DB59, 0xE00A6E58, 0x084A91B7,
+   0x3C2ED620, 0x178BC945, 0x90C7E779, 0x25183A99,
+   0xD8EC9FEF, 0x788943D9, 0x054B27A2, 0x30C27D3B,
+   0x5318621A, 0xF89147B9, 0x5F4C090A, 0x0410E27A,
+   //T[85]
+   0xD0381AE5, 0xB41ABC2F, 0x9695F4E2, 0xF140E5EB,
+   0xC5F6E144, 0xD7735A05, 0xC5E695EC, 0x7E409DD3,
+   0x23802427, 0xB8822A34, 0x064CB974, 0xFFEDA354,
+   0x6CCDE28B, 0x2D7C6F6C, 0x20B09CCC, 0x61185D7A,
+   0x5CD8E934, 0x2D2A0997, 0xDAF6A421, 0xB65C1BBD,
+   0x0DAFF381, 0xC1E4C43B, 0x8BD4FFA7, 0x4895BBBE,
+   //T[86]
+   0x8E6B6D65, 0x146031EB, 0xEDA0CFEB, 0x5B63FEA4,
+   0x17FC2A52, 0xA734F51E, 0x1678D322, 0x62D0048E,
+   0x0BA4E48D, 0x42023A1D, 0x5F0841A6, 0x0F0485D9,
+   0xF2AFE285, 0x0593A4AA, 0x1969D1FD, 0x562FE100,
+   0x974FC9E0, 0xC9B2AC98, 0xA07D239F, 0x66D34027,
+   0x4C796C2C, 0xEA432214, 0xCD21FB8A, 0x4D00E4D8,
+   //T[87]
+   0x15665EE0, 0x0FD279F7, 0x99F55E91, 0x8B932AF7,
+   0x88E74B47, 0xF33A5CCA, 0xAF5DA3ED, 0x34E52545,
+   0x2DE2F858, 0x67530143, 0x2B28289D, 0x2D5720ED,
+   0xE7524878, 0x4E205E2C, 0xE9204C43, 0x29D123BD,
+   0x303B11BB, 0xC71BAFA8, 0x1D9FBD99, 0x39C91BDF,
+   0xAC4531D9, 0x2374B6E1, 0x3DBD4522, 0x554311D6,
+   //T[88]
+   0x3461C70F, 0x2D303273, 0x1C9DD52E, 0x8B2C9AB9,
+   0xD9DF283F, 0x1F892C85, 0xCF3427AF, 0x3AC258CC,
+   0xA31C605C, 0x889E3CB9, 0x56313772, 0xA74B0C21,
+   0x6E361BDD, 0x8414AD34, 0x151B5576, 0x71EBE2DF,
+   0x8529DEAA, 0xBB001EB6, 0xACF8F194, 0x3F534688,
+   0x7EDEBEA4, 0xBBB2BC68, 0x093DF854, 0x24BDBF26,
+   //T[89]
+   0x6033DA26, 0x13D9D107, 0x301EC428, 0x0D398D64,
+   0x234A07C7, 0x012DD2F2, 0xE692410E, 0x5D3F59E2,
+   0xA0D0DCDC, 0x3CB3386C, 0xC4790762, 0x33A085A3,
+   0xCA524164, 0x4C921E71, 0x3D01F62B, 0x6E985597,
+   0xE8163DD2, 0xFC6BBC25, 0xA060232D, 0x9CDFEF39,
+   0xA9AA74CC, 0x0BE60B5E, 0xB4CAC7FA, 0x72AEA9ED,
+   //T[90]
+   0x35429A04, 0x1E8CD80E, 0x7B9892B1, 0xEBE0DBA6,
+   0xCF01DD25, 0x842919F3, 0x90284D17, 0x00377E2B,
+   0x79206406, 0xFF098205, 0xEF4E270E, 0xF842A2CC,
+   0xD23839C5, 0x4FF14124, 0xBE43D857, 0x33EA285A,
+   0x94C5D0FA, 0xEF5D2A1E, 0x748B98B5, 0xAD9B562D,
+   0xC8272157, 0xE80BB8B7, 0x29A8D392, 0x75DE9EF5,
+   //T[91]
+   0x5A2B87FC, 0x7148D76C, 0x10ED8DEA, 0x4ABC727C,
+   0x88295AF5, 0xB04CD5EE, 0x8383D8CC, 0x4BC9CD8E,
+   0x6D5C1E5D, 0x4956BDA4, 0xF2FFC6A9, 0x8CCC42C6,
+   0x287BFBA6, 0xB7EE89D2, 0x3D7A605C, 0x2DB2C097,
+   0xDDFC1895, 0xE9D2AEF0, 0x1D4492D4, 0xBCFFB219,
+   0x2A7DD90F, 0x8CD94D54, 0x8CBB0E09, 0x61F779EF,
+   //T[92]
+   0x9152DEBB, 0x051D2129, 0x351A55A0, 0xEE0C2326,
+   0xEEABA097, 0x15756B5A, 0x0F99C1BB, 0x59C0EA43,
+   0x8048445D, 0x44B3585F, 0x00112318, 0x8CED01E2,
+   0x372AB628, 0x1422A71B, 0xB273FD64, 0x49F3F641,
+   0x15CD6110, 0xC5B3EDDD, 0x7FA084E7, 0xDB114AB0,
+   0xD767008E, 0x96527068, 0xDBEF8B61, 0x0D64906D,
+   //T[93]
+   0xCAB5FDB9, 0x8CE3FE81, 0xCA5F1352, 0x1BCEBA86,
+   0x73DF87A1, 0xD2AFADC1, 0x8F1F54EC, 0x421EDEBE,
+   0x967361E5, 0xF7C85161, 0xB18E4739, 0x01111BEE,
+   0x34A28B3A, 0x16E47AFB, 0xA5CBB60E, 0x751F2C6B,
+   0x68F5B917, 0x176CFECA, 0x7F0D1FC7, 0x2E5A15F7,
+   0x7C7B5F0A, 0xDC3BE40D, 0x34B96C2A, 0x49539256,
+   //T[94]
+   0xB64C995C, 0x714AE437, 0xD1C4B18F, 0x60A54F28,
+   0xF7FDDBD6, 0x5E44C618, 0x5D4C87C5, 0x7EDB77E8,
+   0xD4152C0F, 0x155E93BD, 0xEDC16261, 0xAD9B1AAC,
+   0xB8DA2BB2, 0x8405B827, 0xAE02D42B, 0x0C41748D,
+   0x1A59CA39, 0x1DA2D324, 0x4B993879, 0x0EA8A56C,
+   0xA69A5E03, 0x20919BB7, 0x9750200A, 0x1E11974A,
+   //T[95]
+   0x5D6ADD7F, 0x86E24F53, 0xB15C81CF, 0xBCDE3729,
+   0xFBBFC324, 0x5EF9F01C, 0xB7D2BB52, 0x2311DE8A,
+   0xD1DE7460, 0xF2F56035, 0xFE4A699D, 0xCBC2378B,
+   0x2905A5BF, 0xF937661F, 0xF6DFB19A, 0x435E9B8E,
+   0x182C6471, 0x3E0ECED7, 0x783EDB1B, 0x6179981B,
+   0x9AE7C000, 0x37A5FF26, 0x49B1AFCA, 0x49582BBD,
+   //T[96]
+   0x2E7D0619, 0x836AB274, 0x0A22ADAC, 0x1F0EF35F,
+   0xFE2B45F5, 0x36983529, 0xC134F7FD, 0x114C81D5,
+   0x188BC68B, 0x1E01D1B2, 0xDA13FCC4, 0x97890FE9,
+   0x47D560F4, 0x188E4EA6, 0x7D3A49EE, 0x35BCDA17,
+   0x630FF4C6, 0x6579BF91, 0x9C1161B1, 0x2515F571,
+   0xB68E584C, 0x23C4ECC1, 0x27160345, 0x5AE92417,
+   //T[97]
+   0xBFE3B910, 0x861E0E8C, 0xBD9012C5, 0x39E91A20,
+   0xA5D0560E, 0xA93428BE, 0xFA8A8523, 0x1EC58FA4,
+   0x7FEF6285, 0x37036CC9, 0x85B27276, 0xC320E0E1,
+   0xA3313D0C, 0xA9B89811, 0xB9E535AF, 0x3459E27B,
+   0x6B93654D, 0xD60272B1, 0x48E4D8F2, 0x3EB27EF9,
+   0x89E87D97, 0x732589EC, 0xE845FB10, 0x2CC6E7B9,
+   //T[98]
+   0x1B8FA17D, 0x6409F7A9, 0xADDFCCFF, 0x0917DCBF,
+   0x538A2AD6, 0x154F12E1, 0x4FF77CD9, 0x000ECD03,
+   0xC4AE717A, 0x4D135D80, 0x3014A217, 0x6CD3BA50,
+   0xA4FBC85E, 0xA8CFF237, 0x18EBC6EE, 0x2D183428,
+   0xF1D9FA21, 0x1BD91493, 0x0CB8E821, 0xF1F1CE75,
+   0x8A8E90B4, 0xDCA10B4C, 0x8FDE2696, 0x2A11E262,
+   //T[99]
+   0x8A78BA50, 0xF02ED963, 0x9F6280E8, 0xE6DCEAF4,
+   0x10C71AA5, 0xC5978F9D, 0x408F3CAD, 0x477ADE6A,
+   0x10DF97CC, 0x6F9C3E65, 0xC6E343B3, 0x96F0BE22,
+   0x4850A2D1, 0x6B9F604E, 0xF5E48713, 0x35E41A3E,
+   0x73E38E53, 0x913D23D6, 0x650A3903, 0xA1B4F2AE,
+   0x60055B02, 0xCC04FDDA, 0x80D915D6, 0x028951B6,
+   //T[100]
+   0x9EFD8B01, 0xFAD8FD03, 0xE9B4FC01, 0x67271D22,
+   0x88E54C73, 0x22A58CBD, 0x4442DCA4, 0x755C1FB2,
+   0xA0F7F571, 0x83990E4E, 0x02B54648, 0x288FEEEE,
+   0xB6E61835, 0x6FBA1C21, 0x6883F1BF, 0x4E21F18B,
+   0x58EA5F77, 0xF34B357D, 0xE8C690FA, 0xC75F8128,
+   0x2B8573F4, 0x53FC9940, 0x5B54F695, 0x4A9ED787,
+   //T[101]
+   0x15F59429, 0x8CBA7BCE, 0xA69BFE6A, 0x05C758E7,
+   0xED5AB3C2, 0x914DE42B, 0x1BED7F0C, 0x3A69B049,
+   0x9372B956, 0x0859AA8F, 0x40B12D53, 0x4F7A4411,
+   0x3BEE0D71, 0xA2F738F1, 0xCF573AA0, 0x69B703D7,
+   0x90956E56, 0xB5E20C08, 0xBE33A0D4, 0xE665F70B,
+   0x66FD86C8, 0x7D727A0A, 0x36B28FFA, 0x6D76F3B0,
+   //T[102]
+   0x7D9DD580, 0xFE7C9425, 0xE126FE2B, 0x79BE4080,
+   0x72090F0D, 0x4B3C7B4D, 0xE1A733EC, 0x5B49B047,
+   0xD956E0F7, 0x7AB17EBE, 0x2AAF2609, 0x67299CD0,
+   0xF015BB9F, 0x08688548, 0xDDE6A063, 0x09D1704B,
+   0x3C5EF55E, 0xE50DD5A5, 0x19619968, 0x83B024D9,
+   0x6CDE7A70, 0xA34D4C21, 0x015112F7, 0x7242A389,
+   //T[103]
+   0x2CB2F547, 0xAB76F86B, 0x5B766DD6, 0x747FAD56,
+   0xC31291E4, 0x0F20BED3, 0xF46C1D09, 0x552E9CBB,
+   0xE453FF6E, 0xFCA5681D, 0xED7456EE, 0x5A259A6F,
+   0xF347B27D, 0xAB9B9F45, 0x9CD7E8B3, 0x49AECEEB,
+   0x37AFA6A0, 0xBA46D723, 0xEFE54EA6, 0x0A9929D2,
+   0x3150BF43, 0xC7162D53, 0xE6EB6261, 0x50DB64DE,
+   //T[104]
+   0x5622D07F, 0x9B0C61D8, 0x28223629, 0xDB72C3A0,
+   0x2C4F4B77, 0x864291BD, 0x508E0F34, 0x4D808793,
+   0x227E1CD4, 0xC0EBCB88, 0x7340B16C, 0xAE0CC14C,
+   0x08CF7263, 0x42FA79B2, 0x46FFB76D, 0x5CD28674,
+   0x58EB6679, 0x8604BAE3, 0x50B9D80E, 0x061B2327,
+   0xB470492F, 0x04C105D5, 0x55991248, 0x489BFF6E,
+   //T[105]
+   0x038F4A61, 0xE1C11D6F, 0xC7B9EBE0, 0x24CDFE57,
+   0x0C5FD7BE, 0x66AE160B, 0xC9042ED0, 0x0D658A9B,
+   0x8177DEE0, 0x2B6DA8CF, 0xAE6FF8FB, 0xCA66D917,
+   0x328BCA85, 0xE67B89A2, 0x5409F85E, 0x0EA7010C,
+   0xBE5C73FB, 0xE38F1C15, 0x71ADB7B5, 0xE5D95157,
+   0x5DAA1234, 0x9A4614D1, 0x828B8356, 0x706E4FF8,
+   //T[106]
+   0xA1ECF92E, 0xAEE178FA, 0x1CA910E7, 0x9CE0BABD,
+   0x69EDB967, 0xD33396C6, 0x00A9B72F, 0x3EEBFAC3,
+   0xD8EA6EB1, 0x75BC9109, 0x86E81E58, 0x76310839,
+   0xD51B7B76, 0xB64B4888, 0x1EB5DF34, 0x421DD709,
+   0xC238922E, 0x096D3F02, 0xDEE77E9E, 0xD68A6160,
+   0x8EB04347, 0xA46EE5E8, 0x8FF26251, 0x68313D7D,
+   //T[107]
+   0xEDD42302, 0xFAE01938, 0x7517E0C0, 0x61CEC047,
+   0x22302766, 0xC41A5907, 0x0BE333E4, 0x10BC081F,
+   0xDF2AF658, 0xDE637CEB, 0x8F924D01, 0x44CB6133,
+   0x559DC444, 0xB73DBA7A, 0x6053BD68, 0x61B45AA4,
+   0xF7B15E1D, 0x89387A1B, 0x89A094B9, 0xE384478E,
+   0xA836A1BE, 0xF12C4793, 0x2E35C4E0, 0x674CE1C0,
+   //T[108]
+   0x1BF6D818, 0x4115788E, 0xB1D3BFF5, 0xAB8DB8B9,
+   0x5AF1EBC4, 0x9BEB5AD5, 0xB70DFDF0, 0x30175E5D,
+   0x948C1853, 0x7B17A5F2, 0xF08396CA, 0x8AFF31B4,
+   0x1FFF40C1, 0xB7BB21E0, 0xFC77F1A1, 0x6701108A,
+   0x55B75C0A, 0x8E27D1C1, 0x97763AB1, 0xE595FC7F,
+   0x2DF87328, 0x6E32E493, 0x95C75728, 0x3CAFE9F8,
+   //T[109]
+   0xBE868125, 0xC8A33CAA, 0x7021768E, 0x96F72C6C,
+   0x9FF41247, 0x15C17CF5, 0x01C918AF, 0x4C2F2470,
+   0x3196DA73, 0x4356E7EF, 0x1EA7A6BF, 0x46BB26D3,
+   0x7BCB44BA, 0x5BA75AF1, 0xC831E59B, 0x316F3689,
+   0x47EBD38C, 0x96EBEFED, 0x0E1906C7, 0xF72FA02C,
+   0x91C92909, 0x28CF6CDD, 0x2E26F613, 0x145A8C7C,
+   //T[110]
+   0xC1505D7C, 0x10443DF4, 0xCCFC75D8, 0x14F0EBCC,
+   0xE11C7825, 0x0D1CD61E, 0x8DF114F5, 0x63B4D898,
+   0xC9047AB6, 0x2EDF1AD8, 0x55068CB2, 0x492BCF4E,
+   0x30E0C16F, 0x56D50203, 0xB517C3B6, 0x538B45CC,
+   0x9FCB5886, 0xFA233783, 0x4FC754D1, 0x8E88BA74,
+   0x5746F498, 0xF44700E6, 0x8734CECD, 0x66037800,
+   //T[111]
+   0xE6980FFB, 0xECD4EFFF, 0x265008AD, 0xDE998307,
+   0x4BEB58DA, 0xDA3DAA4B, 0x7A2802A7, 0x7D910546,
+   0x1B3113DB, 0xE094EB0A, 0x8C9C71A3, 0xE1FC79C4,
+   0xC9662768, 0x919A1D2C, 0x3C95E5AB, 0x1012374D,
+   0xC5B4FEE9, 0x03B30E18, 0x6F39B2F9, 0x3A59F6E4,
+   0x4A5A699D, 0xB8389470, 0x99459259, 0x39FB4548,
+   //T[112]
+   0xE6FBAA23, 0x14382E54, 0x9BA2C584, 0x5BB38878,
+   0x649C1EC9, 0x1B261421, 0xB4678AF5, 0x242C79C5,
+   0x0A5337D1, 0x4260C96A, 0x0D99A5A3, 0x538D77F1,
+   0xCAD6C164, 0xA88C1C69, 0x52301E11, 0x3427502D,
+   0x04E3056C, 0x3469B408, 0x138FE57B, 0xFACBE222,
+   0xDAA84A33, 0x9B179153, 0x9230D9FD, 0x1A117212,
+   //T[113]
+   0xA14D7528, 0x66259666, 0x33B69882, 0x81F8C992,
+   0x9226831A, 0xC4977F48, 0x496434D8, 0x584E9E96,
+   0x380536AA, 0x0F780F79, 0x97702C7B, 0xF6276BD6,
+   0xF4116CDB, 0x36CD727D, 0xBEE9D985, 0x06AD4AD1,
+   0x57A1D515, 0x8A0F7FA5, 0x91B94531, 0xD7A04133,
+   0xB0BDAB1C, 0x373FE5B5, 0x2254DCBF, 0x067CF1E9,
+   //T[114]
+   0x21EE9209, 0x1957E706, 0xF98A0077, 0xFEFC0F9F,
+   0x0512A377, 0x3DD6F655, 0xE39394A5, 0x7D874FBD,
+   0x8AE83112, 0x563F8344, 0xD36A3A4D, 0x31571A45,
+   0x035C692C, 0xC0A651C1, 0xFF561D10, 0x02F5A55B,
+   0x9DC49FAB, 0x13F0985B, 0x5206527A, 0x3A82C063,
+   0x5E3DBF86, 0x0A649E46, 0x6AF072EC, 0x53176355,
+   //T[115]
+   0xF60E43CF, 0xE25A8C84, 0x722F783F, 0x2405E25C,
+   0x362AEE68, 0x0B2E8F0C, 0x81C91A94, 0x44BF2DA0,
+   0x8A611BFA, 0x5F17F785, 0x6F912835, 0x5CC94BC5,
+   0x12ECA46D, 0xFD1705B7, 0x710E19EB, 0x70A473D8,
+   0xDFFC6255, 0xBFC50DC9, 0x7141DE7F, 0x7E0323C2,
+   0xE09F3282, 0x447E21F1, 0x1BD78047, 0x77A5DE3F,
+   //T[116]
+   0xB98FBCE5, 0x16941D3B, 0xF5E3549C, 0xB19238B5,
+   0xB0692D4C, 0x3BE5ABD4, 0x67810E70, 0x5784CADB,
+   0x8916246C, 0x6FA7F4FB, 0x4B1B0DCF, 0x46720B5A,
+   0xAE801674, 0x62C6FAB1, 0x296992C1, 0x6C871911,
+   0x429611CB, 0xA853AD52, 0x5161877A, 0x677A0067,
+   0x3A06DDB0, 0x7A1C3330, 0x3DA4F2C2, 0x21108963,
+   //T[117]
+   0xD7338B1C, 0x63E0D347, 0xED3657CF, 0x3584DE63,
+   0x0C53DBA1, 0x1B76741E, 0xC8CAC944, 0x008381CD,
+   0x4B3D6782, 0xDB899214, 0x8A7529A1, 0x78A2BB98,
+   0x93364299, 0xE19FB718, 0xC7DB0506, 0x4769579C,
+   0xEC278D11, 0x730C5671, 0xEB5C136E, 0x3D0F5D62,
+   0xA9EAEC6B, 0x1E473497, 0xABC1625E, 0x167A637A,
+   //T[118]
+   0x5F2A6D1C, 0x2962C658, 0x92E7C57B, 0x4A506DAE,
+   0x92B43F38, 0xFD95C6E7, 0x703B1550, 0x67BAF11E,
+   0xD7579FF7, 0x7586B58D, 0xDD2E7AF5, 0xE1B84B50,
+   0x679FE1D6, 0x70532BFC, 0x4325DD3A, 0x11558BCC,
+   0x3D36D027, 0xEDF7D021, 0xAED0BD23, 0xAA172CF4,
+   0x8D1B6260, 0x8611FCCD, 0xADFD0A3F, 0x4FB4069D,
+   //T[119]
+   0xECC833C6, 0x88079F8B, 0x5357566F, 0x3DBA5320,
+   0x75A545B4, 0x371B6FC8, 0x6430BF45, 0x39D0110E,
+   0x8E6D53DB, 0x8604A7B9, 0x3E1F40B0, 0x8A87C262,
+   0x88B0E20E, 0x59E4CF8E, 0x842BE6D7, 0x305ADAF3,
+   0xF3CB72F5, 0x0BD9E9E9, 0xB84AD6B1, 0x70D5C6E8,
+   0x6D0176E3, 0x52E8376D, 0x66C31BFC, 0x23366292,
+   //T[120]
+   0x876A167E, 0xBEDA6D9F, 0x760E88FB, 0xE412B705,
+   0x7E6F2272, 0xE382FB5F, 0x824F1EC1, 0x6516CC0C,
+   0xF46E1678, 0x506C640B, 0x28864BB3, 0x368051DE,
+   0x8B1561B3, 0x751B548D, 0xF2B73814, 0x3F9BD193,
+   0xB2C7B1CD, 0x59001B32, 0x1B027921, 0x95FCC2C6,
+   0xBF422D99, 0xF890247C, 0x38A65FD0, 0x27C0DD14,
+   //T[121]
+   0x4280ADA6, 0x47A3AA96, 0xB007ED31, 0x636618E6,
+   0x2A3742B1, 0xE0443F88, 0x9D60DFC9, 0x6B66C005,
+   0x938972CB, 0x303A2693, 0xDE328837, 0xD8619507,
+   0x649FAA27, 0x5CDE4CAD, 0xAC789F53, 0x694F09A3,
+   0x3BFB31C9, 0xED21681C, 0x268FC967, 0xF95232A3,
+   0xF988B220, 0xFD5C274F, 0xD51DC921, 0x06AC2AB8,
+   //T[122]
+   0x25EF1587, 0xA4258877, 0x5F6694AA, 0x15BF2CBF,
+   0x4BC8C994, 0xC1085B86, 0x1ADE9BB1, 0x7EAEE43F,
+   0xB0CBF0B8, 0xCA90A8E3, 0x5C10BD7C, 0x7E865BD1,
+   0xD7D3B248, 0xD7F3AED4, 0xB9EE0FE8, 0x5AECC5FF,
+   0xF0E70EFD, 0xAD8DB4F6, 0x77C0044A, 0x71E2DCE9,
+   0xA753C6E2, 0x70DACCA6, 0xB2EE8C9C, 0x6CD64065,
+   //T[123]
+   0xF43A057A, 0x43473936, 0x6C04B80C, 0x9667778E,
+   0x02D74AB4, 0x41188D3B, 0x9D2FDD1F, 0x6DEE8618,
+   0x1FD43E56, 0x609C7E01, 0x5CF0E8CF, 0xBB1CFA98,
+   0xF6F2F64D, 0xF9A0B342, 0xE5D07536, 0x7FCA3542,
+   0x161A43FB, 0x2FDCB629, 0xB252BE52, 0x24B7DBEF,
+   0x6DB31190, 0x2D4B3A2F, 0x56991C84, 0x6175BA9E,
+   //T[124]
+   0x55C011EF, 0x5762E79F, 0x339FE650, 0xC3D20224,
+   0x35D89176, 0xBE4249DD, 0x688BD1A2, 0x7CD600BE,
+   0x61C282AB, 0x1DEE04A6, 0xCC0E8E2F, 0x2A53B090,
+   0x92E492D8, 0xA71EF59A, 0x96D446F6, 0x57790EC4,
+   0x4CA9AEB9, 0xBD7D47EB, 0x9244B4FF, 0x7ADBBA04,
+   0xA4D0CF80, 0xC0F54232, 0xFA6CF1C3, 0x543AABBB,
+   //T[125]
+   0x3C5B6141, 0xFC349F55, 0xA8736DA8, 0x3CB0B3FF,
+   0x63E2D003, 0xE2F6680A, 0x7355A8D3, 0x3F68BE5B,
+   0xA0A54FB6, 0x82C3DED4, 0xFE2B1658, 0x0A2743FF,
+   0xF193EE14, 0x2DB3327C, 0x7E18ADE0, 0x6C81FDFA,
+   0x10064066, 0xE74F4C51, 0x5A5CC4E6, 0x0228BC31,
+   0xC2DDF0F4, 0x721ACFDE, 0x625469F8, 0x452313FF,
+   //T[126]
+   0x068E73B2, 0xBBAC7577, 0x22738E47, 0x0DF56F4A,
+   0xFD310A83, 0x8019D793, 0xADFD0AF4, 0x20143510,
+   0x2D4BBC2C, 0x849ECBC7, 0xD3F8AB48, 0xB6003239,
+   0x70CBE724, 0x6325C20C, 0x74CF6A0C, 0x34093E5E,
+   0x26B2AD63, 0x7A55849F, 0x58FC8C9B, 0xD7EF2FC0,
+   0x419316BC, 0xFCA8C50C, 0xF788B917, 0x1EBFB48E,
+   //T[127]
+   0xCB05DC3F, 0x23C83C41, 0x99382C04, 0xF95568E3,
+   0xBFC732D3, 0x5D1BD4FA, 0x4210DCDE, 0x75D942C0,
+   0x4E35AB2D, 0x9765C487, 0x47A42467, 0xF38E3FAD,
+   0x771731CB, 0x8FD7E2C5, 0x56CDC13C, 0x696CC148,
+   0x9993C204, 0x1581588C, 0x8583D5E3, 0x684C8A18,
+   0xC5F74338, 0xA116D37F, 0x8686C9B6, 0x6875393B,
+   //T[128]
+   0x4427F40B, 0x601F88A4, 0x0789585A, 0x1C42642C,
+   0x9FFEC023, 0x6905B940, 0x916E5AF8, 0x5288DF14,
+   0x5136CFC5, 0xC243BB41, 0x958E01C0, 0x62B9E4AC,
+   0x018C5A19, 0x2F329957, 0xD1FDE82A, 0x0209DF8C,
+   0x0AD8ADD1, 0x00EA840A, 0x20990977, 0x753A7E55,
+   0x72D55538, 0x31A57D4B, 0x37201FD2, 0x0FF71995,
+   //T[129]
+   0x1C3EAE7B, 0x3FDE9E2A, 0x54665D04, 0xF3BEA8C8,
+   0x0D7E1FDF, 0x11C026D7, 0xE0744E05, 0x7D17C4FF,
+   0x2479704E, 0x71530A4D, 0x70A41133, 0x316B2419,
+   0x3008BF60, 0xE6B151ED, 0x91F4BA0F, 0x3D8ACFB9,
+   0x29C94E91, 0xA75EC8CA, 0x9B8DD561, 0xC43D5178,
+   0x44161A8B, 0xFB30E8EE, 0x3F1E87C1, 0x5C96428A,
+   //T[130]
+   0xE6B1ADD4, 0xD03CC281, 0xF92C2857, 0x7D0907CB,
+   0xD0FED25B, 0xCD096C0E, 0x3AB9966D, 0x0BF5E5B5,
+   0xE6B1F7E8, 0x64B0B44E, 0x266A3877, 0xF7D6B9C9,
+   0x1013A60C, 0x87E8D3E9, 0x18194023, 0x7DF9478A,
+   0xCB49978A, 0x942A7128, 0x35C71286, 0x8AA06114,
+   0x7B231A3A, 0x8B46CB47, 0x44AC6817, 0x21F10188,
+   //T[131]
+   0xD89DA0B2, 0xE74E5D37, 0x55DC20E0, 0xEABE3F92,
+   0x5EB66B62, 0x648693E1, 0x9A5025A9, 0x55D111D7,
+   0xAF0B4C56, 0x14015B87, 0xDF869FE1, 0xFB5FC002,
+   0xD0015893, 0x197A0619, 0xE8E88D9E, 0x762C4003,
+   0x927FD946, 0x4F069DCE, 0xFB666B9B, 0x1F7A07A3,
+   0x2DB190BD, 0x2A77ADFB, 0x189E66AD, 0x5CEC5C03,
+   //T[132]
+   0x6670190C, 0xCC3A0743, 0xF40ABF27, 0x35EFBD50,
+   0x330404FC, 0xA4C83B22, 0x2D0C6056, 0x6D2F184E,
+   0xA481D7B9, 0xD1BAFF2F, 0xBD14DC48, 0x3F6392F0,
+   0x66E88651, 0x43FAFB5E, 0x54BDFDCD, 0x37DBB9A4,
+   0xB2451C45, 0x663BB1DE, 0x20A6917E, 0x037B1097,
+   0x95DF1FC1, 0x6D5B6B7D, 0x2209E362, 0x2C070FAF,
+   //T[133]
+   0x5287E62C, 0xD5DEBE75, 0x0E3C18FD, 0x700C9DD0,
+   0xE22044A9, 0x66499308, 0x6B534BD0, 0x5BAD2B74,
+   0x572A6CC1, 0x16707F78, 0xC249CE04, 0x5BAE1C40,
+   0xBF314776, 0x5C05BAA5, 0x8F1B689D, 0x721160FB,
+   0xE0143D40, 0x7E7DBCDB, 0xE8D63AF5, 0xBA510D87,
+   0x5CE92674, 0xF0A1596F, 0x370ABD07, 0x39F263C0,
+   //T[134]
+   0x174D2364, 0xBA017F3F, 0x48DC2D75, 0x209A4C91,
+   0xCA017139, 0x3C29855E, 0x4616A5E3, 0x4568D1D5,
+   0xB0A5F96D, 0x75F73B37, 0x2A7D6313, 0x513269C7,
+   0x818E86AA, 0x1F5051C1, 0x91C98419, 0x5AB55BD1,
+   0x3B3C458B, 0xCE87D726, 0xEB2B1543, 0x7387680D,
+   0xA65B4CD0, 0xFA6C33C8, 0xEF2096EB, 0x132EF3EB,
+   //T[135]
+   0xFBA75A58, 0xB6859189, 0xEFAD9EC8, 0xB459A9B1,
+   0x6C18AAAD, 0x250970A4, 0x6C9ED604, 0x48540861,
+   0xDBE02F54, 0x51C52ACC, 0x5C87096E, 0xA1FFFF9E,
+   0x5CCA82CD, 0xD7B2B928, 0xA7047F4E, 0x00B7A530,
+   0x2238A32C, 0xA3AFE57C, 0x42AC71C3, 0x3C7387D6,
+   0x5269ECAC, 0xB2FDD75E, 0xFB89EF4B, 0x3ECBA4B0,
+   //T[136]
+   0x543CFB66, 0x3D019A16, 0xC4CF3320, 0x86F92A85,
+   0x409AAD27, 0x42954AA2, 0xC25C3117, 0x3613B8BE,
+   0xE8E7E5E9, 0xA500CD9F, 0xA3D7A252, 0x435F3E9E,
+   0xC3131653, 0x92037F44, 0xD979BA04, 0x6A198C67,
+   0x85A39A20, 0x05758674, 0xF12A9022, 0x18E28375,
+   0x96068ED1, 0x7A719B77, 0xBEAC2001, 0x343F7EA3,
+   //T[137]
+   0xD7A206AD, 0x2FA8B877, 0xC26BE66B, 0xEB0EC8E5,
+   0x6C43ABCF, 0x812D4D32, 0x21B49825, 0x15B95ECE,
+   0x6401BFC5, 0xC5C588CA, 0x26CAA2EB, 0x6C2F708F,
+   0x7B620BE3, 0x5575925C, 0x285EB272, 0x1B8E9998,
+   0xB623202D, 0xFDFCA181, 0xECEE771C, 0x7CC13E90,
+   0xB5CDA220, 0x75434939, 0xBFD179DE, 0x34C45BC4,
+   //T[138]
+   0xDE500296, 0x3E95CC66, 0xFA2BE033, 0xD2464D59,
+   0xB21E8A2F, 0x677C722A, 0xB9376566, 0x6E4C2AF6,
+   0xD8D93F5C, 0xA6908815, 0x7EC6811C, 0x39482893,
+   0x3DE34E6A, 0x68EDFF21, 0x95C2DC5B, 0x7CAB9E42,
+   0x70F448BD, 0x97667D26, 0xC83601B7, 0x8D15DFD9,
+   0x590C5269, 0x25CC84B3, 0x7F5A4886, 0x18707FAC,
+   //T[139]
+   0x3B14F8DF, 0x2728B868, 0x4AE442D6, 0xC3A25334,
+   0x484E1606, 0x1E315F86, 0x18F126F4, 0x0C123AAE,
+   0x431F8AA3, 0x0933817B, 0xCA3B4D1F, 0xE2F3CA2D,
+   0xF6279ABE, 0x7D0A49E7, 0x28B0F6AF, 0x05737812,
+   0x7D4C1ECD, 0x5BD050EC, 0xD330BC4E, 0x1070B10F,
+   0x7CB7EDAA, 0xD162281E, 0x6F4AA0CF, 0x77F799A8,
+   //T[140]
+   0xF3536335, 0xAF17D533, 0xD3D4FC65, 0x19EFB6ED,
+   0x72B4FEFF, 0xC60487FC, 0x2934A994, 0x34BC9810,
+   0x8F4BA329, 0xD021F4E6, 0xDDD9D686, 0xA459C663,
+   0xD21A6040, 0xB6CBD1BB, 0x14C0716E, 0x35003523,
+   0xD76F25BD, 0xC9863EA1, 0xE2C9BBFB, 0xD7562BCD,
+   0x69C65DEE, 0xD313E382, 0x7DBF46BC, 0x10BB6D14,
+   //T[141]
+   0x594B4648, 0x87C8918E, 0xE2A51FF9, 0x4E7388CA,
+   0x9FA47433, 0x32418E86, 0xCB4A3776, 0x59A6C0ED,
+   0x221FBB27, 0xB2350557, 0x24E5E835, 0x0C4C0A22,
+   0x5F5CB4FE, 0x96C46260, 0x22C9D9EE, 0x1C86C7B5,
+   0x380BB5E6, 0x3AD1282F, 0x4D20A7A0, 0xC3EAFF72,
+   0xF10426E1, 0xDA81C609, 0x9829E80E, 0x07FBD174,
+   //T[142]
+   0xAB0436C5, 0xF4AAD1FE, 0x57DF6BD7, 0x6CFD6234,
+   0x8BED75E8, 0xBA5CBFBC, 0xF1B158FE, 0x6F6A3FEC,
+   0x2681940B, 0x1165E5CB, 0xE15EB312, 0xB5BF95C0,
+   0xC4C82EAF, 0x4D3260F9, 0x842963A9, 0x6322CC61,
+   0x0078CC0F, 0xDA1119BD, 0xEAB1A64C, 0xB585F2F2,
+   0xF098F6E4, 0x2605F5D6, 0x791687F6, 0x19551E37,
+   //T[143]
+   0x78B2DACE, 0xB89A5B48, 0xC6C40659, 0xD29F8F06,
+   0xD71DBC6F, 0x8FEA4CED, 0xA6051979, 0x3BEFD93B,
+   0x851ADF90, 0x5004FB5C, 0xCB753364, 0x0A639709,
+   0xF622306F, 0xA012CB15, 0x824D98B9, 0x7918EA19,
+   0xFBD91FEA, 0x8A702525, 0xC5DCBFF1, 0x8E6CE874,
+   0xFD2E9A8D, 0x1D306118, 0xA7C2161A, 0x6EA498A1,
+   //T[144]
+   0x9651C474, 0xE0E18322, 0x3B162B83, 0x03283CC8,
+   0xFFC1346B, 0xC49AEC6E, 0x702A0E17, 0x2C5026CB,
+   0xFEBF0026, 0x6837A7F4, 0x0B2717E7, 0x804D4595,
+   0x0C31DB4F, 0xAAD9A795, 0x8B0F49A2, 0x06533E43,
+   0xF1073E38, 0xE8284911, 0xAE26ED6B, 0x5CFD39AD,
+   0x61699B34, 0x1EF0489B, 0xBC46A1D5, 0x3D5DE9BC,
+   //T[145]
+   0x1E32F8A0, 0x22E0ABE3, 0x37ECC763, 0xA8DA71EF,
+   0x7192305B, 0xD5BA659D, 0x2055C5CA, 0x36E6DCBB,
+   0x054A9F93, 0xC3375853, 0xB34C2DD0, 0xA97C2500,
+   0xEA958A6B, 0x33F6AA2F, 0x1B4BF0D2, 0x29A7C514,
+   0xF4E20E19, 0x795AD252, 0xF933D517, 0xF51991B6,
+   0x4A11B0C1, 0x34DEFF16, 0x80D4F587, 0x015C60AC,
+   //T[146]
+   0x16B53F5E, 0x0BFD5045, 0x15D65730, 0x30E0A7BB,
+   0xF0674758, 0x0F15F7E5, 0x7BB96C22, 0x0A7E101E,
+   0xD9694630, 0x0D159E37, 0x84F6B877, 0x284BE411,
+   0x93E97677, 0x66298877, 0xF4F5C953, 0x6740C0F7,
+   0xBF936F27, 0x29C234EE, 0x839C1110, 0x66558C40,
+   0x2E119A5D, 0x06ADC6A2, 0x262D8939, 0x4A5A0C33,
+   //T[147]
+   0xEA9AEC3E, 0x036B7EED, 0x2C9BBC8B, 0x4A736101,
+   0x96FCCDB9, 0x74C6725A, 0x64664D4C, 0x53B981B5,
+   0xE8B484DE, 0x522F55AE, 0xAC5F795A, 0x043170EE,
+   0x6026ECF3, 0xE4433ACA, 0x600A01D6, 0x5DCA4695,
+   0xA2D08A52, 0xE91A79CE, 0x253B974D, 0x5933D705,
+   0xA424145F, 0x1BC75F5D, 0x0BD7CCEA, 0x7E4413DC,
+   //T[148]
+   0x16610D3D, 0xE74C03CC, 0xF481C3A0, 0x7A7BD3CD,
+   0x26DFF968, 0x2F04A813, 0xD02D1B8B, 0x1ACF2E69,
+   0x6C9EE246, 0x8D889503, 0x0A4B5EC2, 0x726B81D5,
+   0xCDB3F5D6, 0x937CAB77, 0x2203242A, 0x3A024382,
+   0xE93583A7, 0x49BB82AC, 0x596117D3, 0xD844B7FE,
+   0x0D88E6EE, 0x981022CA, 0x305B5FDC, 0x17FA8A30,
+   //T[149]
+   0x8CB13E78, 0x6701D777, 0xE8A83700, 0xC7F31ABC,
+   0xC8377812, 0xF53F6704, 0x4F06470E, 0x7E2E1A9A,
+   0x2D59C541, 0x80877133, 0x700E7CF2, 0x7EB0AAA4,
+   0x53AD09E3, 0x1956D961, 0x3D1F7CE0, 0x3836C582,
+   0xC851EF15, 0x67B092FD, 0xBA377575, 0xD2F3A3FD,
+   0xEF053BD2, 0x73B7655B, 0x575CF6DA, 0x6C884160,
+   //T[150]
+   0xB7615041, 0x02116B16, 0x7646578F, 0x72CB388A,
+   0xC519C9E7, 0x16B8FEC0, 0x0546DC85, 0x0ABF5A60,
+   0x37E5CFBA, 0xDB12A2F4, 0x313F1769, 0xE4A4E889,
+   0x143E25B4, 0xA22D9DDF, 0xB7F5687B, 0x6EEE7752,
+   0x263A8143, 0x45DFD8A8, 0x70695FC5, 0xBB71606C,
+   0xDAC5F773, 0x311447BB, 0xC6DBAA26, 0x4111E50F,
+   //T[151]
+   0xBC03FEFA, 0x0A6936B4, 0x2B8C64A0, 0xE27CA643,
+   0x2F28ED0B, 0xDDF524C3, 0x7395B82A, 0x6A69EF8E,
+   0x685972AE, 0x73B8413C, 0xB8D568D5, 0x697093EF,
+   0x98F52F5B, 0x6AFACF4F, 0x475AE8B6, 0x1CEFE25C,
+   0xE5B5C497, 0x779D116D, 0x8DBE0820, 0x96E949F4,
+   0xBDE44111, 0x7213B09A, 0x851137ED, 0x687D319B,
+   //T[152]
+   0xF7E6CC3D, 0x229C147C, 0x99C794CB, 0xC88995C5,
+   0xAA2358C0, 0x371D3E4E, 0xA521FDFB, 0x2A6CA2AB,
+   0x48F3DF25, 0xE0A258C5, 0x36544F55, 0x3F381EA7,
+   0x033F3AF3, 0x4B52B1C6, 0xC07F793F, 0x530F1582,
+   0x4A043DA8, 0xB8D892CE, 0xE8A6E03E, 0x3B495CAC,
+   0x2DB6267D, 0x63B7C7B7, 0x9DB971FE, 0x2F0FD92D,
+   //T[153]
+   0xCF576635, 0x6AB66539, 0xBBFE9CDA, 0x8B6E54B6,
+   0xBC55AE92, 0xA121F934, 0x9282443C, 0x59A43C87,
+   0x6D3CAD53, 0x2CDE35DD, 0x4B79D3ED, 0x9929E61C,
+   0xE8D59E83, 0x504EE0B4, 0x40D7793C, 0x3A838B2D,
+   0xEA68382F, 0x3EC0870B, 0x2C684F44, 0x2417476F,
+   0x0E08AA97, 0x9F2C1BF9, 0x90B68847, 0x0702B1FF,
+   //T[154]
+   0x96059E1D, 0x201F9D28, 0xEAC84404, 0x509BF70E,
+   0x1FEBE4AD, 0xEE01761B, 0xE320A1C5, 0x55DCBFB7,
+   0x6E9220AF, 0x24FE9BCA, 0x9E9619E2, 0xD4335FD2,
+   0x72C6A9B3, 0xD4AF3180, 0x61CCDF18, 0x71594B36,
+   0x737316A8, 0x5FAD2C0F, 0x9C5D402A, 0xDCB9E295,
+   0x437CEEFB, 0x4FAA86E6, 0xDCA18479, 0x060E77F7,
+   //T[155]
+   0xF7DBEC4A, 0xC88D7C8C, 0xD63334D9, 0x411F5D33,
+   0xB04DD01B, 0x5B1FFED9, 0xE49946B0, 0x53116EE0,
+   0xB9736BAC, 0xB16FDD56, 0xFF374C4C, 0xE147C94B,
+   0x7B6D30AF, 0x94086795, 0x8B9B3982, 0x31D4D836,
+   0xE736735D, 0x6C20CA73, 0x9B656E66, 0x623277A2,
+   0x399DFB35, 0x51670EEE, 0x457F1A1B, 0x638396DA,
+   //T[156]
+   0xAB06E52C, 0xCC2BBDE0, 0xDA6D2356, 0x9BAB66D4,
+   0xC4DE48CA, 0x5B175163, 0x02AF0FA7, 0x578633F5,
+   0xF0881B47, 0xF68D35B8, 0xBDFB2345, 0xA55F67CA,
+   0x45347CA3, 0x726BFAC3, 0x5A932E2B, 0x28C747AE,
+   0xC9C3399C, 0x6BD830BD, 0xF264B2A2, 0x828BBEAF,
+   0x8D076183, 0x44D3EB57, 0x3A9BC111, 0x1CAAC03F,
+   //T[157]
+   0x14760E15, 0x350F14B3, 0xE42113D3, 0xA8471F63,
+   0xB8F51CA8, 0xBA4A746A, 0x1544AE5D, 0x6BAB61F2,
+   0xC875D885, 0xAD43125C, 0x207DE84E, 0x75D6689E,
+   0xD1599319, 0xF4B36A5E, 0xEBD4F307, 0x438A038C,
+   0x3FDEF914, 0x8BC93E2E, 0x4FCF6E68, 0xCCDB4177,
+   0x68D4D979, 0xFB6C51BA, 0x6E614F93, 0x1CB35729,
+   //T[158]
+   0x5390928A, 0x26176F53, 0x675F508C, 0xF4893100,
+   0x1ECB78E8, 0x5F622544, 0x5AC7487C, 0x2A884215,
+   0xFB426A35, 0x3DFF8326, 0xD2D60D52, 0xEE2B9B8F,
+   0x50B1436E, 0x71AE40FB, 0xE682344F, 0x1C3D1515,
+   0x0717B616, 0x0066C735, 0xB0F583AC, 0x4EF39161,
+   0x40763C3C, 0x6439F17E, 0x7E1E8C5E, 0x738AF1C0,
+   //T[159]
+   0xC8C0B25A, 0x3C58FB25, 0xF61DD811, 0x45E69804,
+   0x4F4F3099, 0xE0506D88, 0xF6CB4804, 0x46E5AD62,
+   0x2B3D2D89, 0x3AB72C24, 0x83A0D441, 0xC3547B12,
+   0x6B6B242D, 0x4BC9EF39, 0x8C21D8F4, 0x35DD429A,
+   0x08FC15B2, 0x547225CE, 0x8EB4BA84, 0xE258DB88,
+   0xA661DBA5, 0x18C057FF, 0x1D61D939, 0x2750EF2E,
+   //T[160]
+   0x0F35757E, 0x0100FFE1, 0x7470A779, 0xB4A90BDD,
+   0xDCC12B7B, 0x56D8FE6C, 0x1EF4D77F, 0x49CDFEE7,
+   0xC129B7AB, 0x7BA67232, 0x97C758FE, 0xD5B89561,
+   0xE5FF40BF, 0xE490585D, 0x8BC04FA6, 0x5820030B,
+   0x32EA4F61, 0x3589116D, 0xC0CD75CA, 0xC41FFC46,
+   0xD6EBFF66, 0x084AFF50, 0x06756971, 0x35657E58,
+   //T[161]
+   0x40D5666C, 0xDA6A76E6, 0x02BBBFDD, 0xFE5FB226,
+   0xEC0DB634, 0x335C47D6, 0x27A83AF1, 0x0B3A68E0,
+   0xEB1ED0FE, 0x958EDA03, 0x58CB1B6C, 0x98AD7ED0,
+   0xE6E0887C, 0xC9A8A932, 0x8D10575B, 0x182AE50D,
+   0x34AB481B, 0x2BE0EA97, 0x316B513C, 0x7EC35A26,
+   0xB34EB1B5, 0x35C7AC88, 0xDFBDFC23, 0x595C2BB0,
+   //T[162]
+   0x2B6E7306, 0x4E727DB0, 0xF2C63458, 0x94CD0DF4,
+   0x8883C6FB, 0x4FF1FB88, 0x74F4E22F, 0x239823C5,
+   0x0B00AD4B, 0xC0E6BBCB, 0x0E3989A4, 0x358A900F,
+   0xE539779C, 0xF635C4EB, 0x760C2006, 0x6C82C274,
+   0x5BDFECB4, 0xF0B26C68, 0x669EB1E4, 0x8D5E213A,
+   0xCC1FB79E, 0xC7E573C4, 0x93649410, 0x074D6707,
+   //T[163]
+   0x9B25A651, 0x09CDA667, 0xA40A7901, 0xCA46C2C4,
+   0x9ED39734, 0x4A3359C0, 0xA1F1C53A, 0x5A5695D4,
+   0xE9106057, 0x62EF3784, 0x76F8A509, 0x7CD9C9B5,
+   0xD4F4CB59, 0x3613B712, 0xEA71C481, 0x4A1FE5F9,
+   0x24716DAB, 0x2C2CB113, 0xD26EF872, 0xDC69C12E,
+   0xDD0E0697, 0xEDD13078, 0x0F1899A4, 0x431FEACA,
+   //T[164]
+   0x7D92A325, 0x16CFA8E5, 0x4AABAE98, 0xE646A214,
+   0x806FF597, 0xEB5F6F3B, 0x6C4AEB78, 0x64C52C4E,
+   0xE4D08D6E, 0xF0EBD29C, 0xC5796425, 0x42BFC1B6,
+   0xE98CCEC5, 0x49B2F9E7, 0x04AD3E31, 0x7E9BCBD7,
+   0x19F6EEFA, 0x9DD47499, 0xED919F8E, 0x1077B179,
+   0x0EED2CE2, 0x030D89A4, 0xEEA583D7, 0x46B1C21D,
+   //T[165]
+   0x2F422705, 0xAF7942BE, 0x95C948D2, 0x5AAEB4AB,
+   0x1219E45B, 0x78DBBF6A, 0x31409219, 0x4CFCD004,
+   0x6B94B3CB, 0xAB7BD64A, 0xA967F4D7, 0xE4BAB95F,
+   0x751D25E5, 0x4E5CA565, 0xDDB7A586, 0x25A0BF0D,
+   0x1CF392C2, 0xEC52CAA9, 0x3D674DB4, 0x63CA1E64,
+   0x9F91D361, 0x7B9D0F2D, 0xD9878A71, 0x57BEB376,
+   //T[166]
+   0x194C0A7E, 0xDA3B3506, 0x06EDAA59, 0xF08AD571,
+   0xC0B18C85, 0xCE71045C, 0x97ADE3B9, 0x6410C841,
+   0xC29BB66A, 0x1653F9FB, 0x643B9717, 0xFA2B86CD,
+   0x3727B456, 0xA7ADF3F8, 0x15A865F1, 0x2AC6E537,
+   0x7C63F1EE, 0x8B805FBB, 0xF61D735F, 0xFD9B7302,
+   0x3E71CBBB, 0xE166F80A, 0x810BE6C8, 0x28340CEC,
+   //T[167]
+   0xC80926B5, 0xE85218D5, 0x663244DA, 0x4E3CA84C,
+   0x8C93A82E, 0xD8DD2B95, 0x694D17E6, 0x3BE6208C,
+   0xA3CD685D, 0xBB2F7ABD, 0x9636E5CC, 0x43DDBC27,
+   0x8398ACFD, 0x22CD89DA, 0xA454D187, 0x663FEDE3,
+   0xAF8AFC2A, 0xD5B32977, 0x840571EF, 0x7E450A9E,
+   0x7C28E796, 0xAD466412, 0x5D7084B2, 0x43FB82DA,
+   //T[168]
+   0x56AA8F3A, 0xC52E7759, 0xD26E3BFA, 0x9A840B80,
+   0x90392ACF, 0x48A20ACF, 0x103E8DE3, 0x4B811E36,
+   0x714AE5B8, 0x115A01BC, 0x50660220, 0x696F0FE0,
+   0xBC133C66, 0xA2FEA1FD, 0x735BA8B3, 0x370C3DEB,
+   0x046F60D4, 0x8F98DC43, 0xA0C6A397, 0xB8434C8D,
+   0x7A386F12, 0xAB830216, 0xB332037A, 0x75695C66,
+   //T[169]
+   0xDD12463A, 0x77E83188, 0x10321A86, 0xC29101F7,
+   0x80C4FCAC, 0x739F0DFB, 0x3C0A1C4E, 0x6BB76555,
+   0x4F7A95FD, 0xB6B30C93, 0x28F71108, 0x3070BBE4,
+   0xEE80B79C, 0x1CE155DF, 0xE9BDF1B1, 0x181B445B,
+   0x3FB97DF5, 0x1C5A6D25, 0x14D7F31E, 0x2DEDD2A3,
+   0x0E82F754, 0xF48E68A1, 0xDE8B1050, 0x5D8FB42E,
+   //T[170]
+   0xE235FA66, 0x6E0BF4DA, 0x47DD24E4, 0xD6FEACD3,
+   0x02EB0245, 0x9793F262, 0x33A7204E, 0x48E45384,
+   0xF250F498, 0x0A0138E6, 0x1C7A68E7, 0x06F4E156,
+   0x7145F977, 0x7AB2B149, 0x75262948, 0x04A24D17,
+   0x4CDE2C6C, 0xB615DA38, 0x48368BAF, 0xC1D7D52C,
+   0x81C64AAB, 0x03BC31C3, 0x15E3D84D, 0x079A7544,
+   //T[171]
+   0x9876221A, 0xC34148D1, 0x0270D4EA, 0x3467C7DE,
+   0x58BA46B3, 0x4FF111F2, 0x80225BA0, 0x31D28FEB,
+   0x248C5378, 0x6F8210C1, 0xC7E310EB, 0xCFA52CC7,
+   0x878BF720, 0x39C4F078, 0xE2CFAF72, 0x2102B013,
+   0x86A5AA9D, 0x8B02AFE7, 0x331B305D, 0xFA7F3559,
+   0x36D883C1, 0x5CA01C5C, 0x99322582, 0x07CF695C,
+   //T[172]
+   0xA1B3BCBF, 0xC6771CAD, 0xBBCAD286, 0x1413FF45,
+   0x886DC7C2, 0x5372E5BF, 0x944551A9, 0x4CB11371,
+   0x17E1963B, 0xA20A8432, 0x90228D23, 0x5A6FA282,
+   0x1A58BFD6, 0x88C77766, 0xE1137CC1, 0x47CDBE1E,
+   0x8C1ACDE8, 0x8CEB7DA9, 0x584CBB4D, 0x8F107BCB,
+   0xDF28E63E, 0xB20B0770, 0xDBC4E773, 0x68822BF7,
+   //T[173]
+   0xA41F4122, 0x4A9991CD, 0x2885872B, 0xC7084CA5,
+   0x911F2D2D, 0x84CC5A34, 0xDF5018FA, 0x146AA628,
+   0x6222418A, 0x22104798, 0x214C2363, 0x58376809,
+   0x50B07360, 0xCE0711B1, 0xAB8CF387, 0x08F4AF5D,
+   0x27C1C290, 0xFFE7103B, 0x25B8F6FD, 0x51DF8B27,
+   0xB3DE609A, 0xB07309A2, 0xB11FA974, 0x07E94459,
+   //T[174]
+   0x5F6ED3F9, 0xE8B932C2, 0x158D679B, 0xC0AE70E5,
+   0x8B7B931C, 0x3596B47B, 0xD4D40F32, 0x304888DE,
+   0x0A698BA6, 0x960363C4, 0x7DD935C0, 0xB343E83D,
+   0x31108214, 0xD8697E86, 0xC4888D28, 0x40D254AA,
+   0x86444205, 0x34080C99, 0x79FC994D, 0x05709C6D,
+   0xD14CD74C, 0xA45D740A, 0x583D47B8, 0x6C741C83,
+   //T[175]
+   0x498D5739, 0x544835C8, 0xF2E519E5, 0x481BDA4D,
+   0x78AC5867, 0x041D7AB7, 0xC6A14262, 0x4A41F661,
+   0x78A2702B, 0x310FCDC5, 0xAA7B58F9, 0xA9B91487,
+   0x6D53FC1F, 0x040B9544, 0x7701041F, 0x7FF8A460,
+   0x62FA3EF8, 0x9417AABE, 0x0D952A35, 0xEB66D763,
+   0x02D9AEB0, 0x4FA55B85, 0x0FABB5D1, 0x0D1A8DA3,
+   //T[176]
+   0x83F94D0D, 0xCB2A0914, 0xCECB2EA2, 0x76A7E3E2,
+   0x164A385C, 0xC1A4CBA5, 0x1CC10C2A, 0x2462E69D,
+   0x2381C4F9, 0x3979A915, 0x63A76A62, 0xFD55E62F,
+   0x7609D46E, 0x9A9C1AA0, 0x0A54F51B, 0x240CCAF9,
+   0x0BD3AE5B, 0x99A73B56, 0x86E1F1B6, 0xF9CF1CE5,
+   0xB1EEA924, 0x4504A531, 0xCB84E1EA, 0x50E9180A,
+   //T[177]
+   0xEE099A58, 0x2839B85E, 0xDDB92940, 0xD2CB44BB,
+   0x5CB9582A, 0x52C7F97C, 0x4B804C08, 0x2EE3CB6D,
+   0xA0F4C4E2, 0x2B226B87, 0x835F966D, 0xF6851529,
+   0x6BE58C77, 0x613F853F, 0xEDD36758, 0x0B753A60,
+   0xE7B47B55, 0xC19703BB, 0x8DBDDD18, 0x2C331676,
+   0x20BCC7A1, 0xC976DBC2, 0x10AB344B, 0x6F4F6B96,
+   //T[178]
+   0xAE4DF9A3, 0xE4665B66, 0x5B8556D3, 0x8D1F3C43,
+   0x3DB5487D, 0x549570A2, 0xFAD48ED8, 0x1752D188,
+   0x174ED4E3, 0xC31E7457, 0x9462EF3E, 0x5101A30E,
+   0x991B47B8, 0x72B85021, 0xCB5A989A, 0x058FABBF,
+   0x3F6C0144, 0x3FAEF681, 0xD96FCE22, 0xC837EAF4,
+   0x126F6D0D, 0x81D2307E, 0x7176C6E5, 0x39002215,
+   //T[179]
+   0x12ED9952, 0xE6FAA711, 0x072474EA, 0x89FBC459,
+   0x7E992CCE, 0xDE507DDC, 0x21947A26, 0x29E7E10F,
+   0xD8B0BA23, 0xC31E41F2, 0xFF8C39CF, 0x46307866,
+   0x3709F1D6, 0xF57DC7C2, 0xB0466BE5, 0x2D26FD82,
+   0xE7AF696F, 0x4361F598, 0x139CB7CF, 0xFAA5C9FE,
+   0x692334B7, 0x1DAD4CD1, 0x3C59F3A3, 0x5EB034A3,
+   //T[180]
+   0x0404FB2F, 0x2395D544, 0xC96C8BC2, 0x7A5ECFD9,
+   0x1DA5238F, 0x38FE8236, 0xA6AB69A6, 0x1F10AB17,
+   0x7AFBECA9, 0x7DD6FA38, 0x93C29891, 0xCA75BA42,
+   0xE0E069E7, 0xADA88C85, 0x5A188D26, 0x7D6DE3C5,
+   0xDAF7FCE4, 0xF1711B8E, 0xD93EA356, 0x586CD2D2,
+   0xE2F84BA5, 0x3E4EF85F, 0x857630D1, 0x022E3E10,
+   //T[181]
+   0x80A3ACC7, 0x67B1A0B8, 0x6F0E400F, 0x420EBCD0,
+   0x580B867D, 0x408A1A2C, 0x551FDB17, 0x65507B76,
+   0x0939F715, 0xC4F520D8, 0xD2CE5E9D, 0x89385E7C,
+   0x82C613B8, 0x469560E8, 0x3245F36F, 0x035E71EE,
+   0x08692CF4, 0x345B147B, 0x38F8046E, 0xD5DCF203,
+   0x13AE4E0E, 0x43BC15C3, 0x703E9F31, 0x21FDEDF2,
+   //T[182]
+   0xCB4B2839, 0xBAD8DEA7, 0x533B8327, 0x5AC2B23E,
+   0xF09D548A, 0x832BC825, 0xBC8F20F8, 0x668C37E1,
+   0x1D4E81B6, 0xED1764DC, 0x1609EF20, 0x8FD747B4,
+   0xFA9F33FA, 0x366E089A, 0x5FDB3559, 0x0B4678AE,
+   0xAF50641B, 0x750BCA7D, 0xBB898D46, 0xF593643D,
+   0x09D78C50, 0x4E8C98EE, 0x13DD6289, 0x1795378D,
+   //T[183]
+   0x55277A89, 0x45750B7D, 0x82BA0203, 0x7093DCB0,
+   0xA45A15D0, 0xBB7FB249, 0x5C40E113, 0x57E25E06,
+   0x24CACD7D, 0x77CE0993, 0xE062A923, 0xA7BD8613,
+   0xDB29885A, 0xC4CDE129, 0xEE696329, 0x14B08411,
+   0xE0E3C3E4, 0xC2379964, 0x070CFE01, 0x2A013A28,
+   0x38917F80, 0xCA3CF87F, 0xE5A2AA32, 0x01F16B3E,
+   //T[184]
+   0xE3EC81CC, 0x4590E716, 0x9B14BCE3, 0x8DDEB804,
+   0xBFD52077, 0xF97EAAE4, 0xF33611B7, 0x70725776,
+   0x461E0CE6, 0xE904236C, 0x83535D7C, 0x3DB0E12D,
+   0x92527D04, 0xE41ED520, 0x1692204C, 0x2434F784,
+   0xC95AD724, 0x2455B86E, 0xB416BCD7, 0x9B5A9789,
+   0xCB198756, 0x7DD33F78, 0x1A289B0D, 0x6F52F3A8,
+   //T[185]
+   0x9E792683, 0x4E069488, 0xA7345D6F, 0x484D2F15,
+   0xC2242590, 0x2F426DEE, 0x18D00E78, 0x03C259AA,
+   0xB5DDE15B, 0xF2745893, 0xC00E1B45, 0x90EF36FA,
+   0x6E783DA8, 0xE7714FEF, 0xF855B146, 0x3DE251B8,
+   0x81FAD989, 0x76204134, 0x83E39861, 0xD7CD9BAE,
+   0xF9A7ED94, 0x2ED9AE8B, 0x8279559F, 0x508E72AE,
+   //T[186]
+   0x91E849B2, 0xBF8D73B9, 0x1570F0E0, 0x2EBB5DDC,
+   0x36544666, 0xA677D459, 0x5AAA2200, 0x45D37115,
+   0x97980CE5, 0xF2D10356, 0xB51EC5BD, 0xA912913C,
+   0x756FDDAB, 0x5E4F0B8B, 0x221B67C0, 0x31B7ECA3,
+   0x4E55FD6B, 0xE45F38FC, 0xB249A298, 0x26C1E660,
+   0x147CEF33, 0x15065D9C, 0x5A6BE135, 0x383ABE57,
+   //T[187]
+   0x379CDB36, 0x6A15E32A, 0xE4DB7C18, 0x4E753A8E,
+   0x9F494D33, 0x17FAA7BF, 0x6C65F419, 0x5862AA02,
+   0xF5BD19DD, 0xAC22D068, 0xCA4167CA, 0xB2C9685D,
+   0xA2DF833E, 0x390F780C, 0x8F53A04D, 0x60280391,
+   0x099CD673, 0x92F45810, 0x1C7099DE, 0x3F08A0F9,
+   0x5878A4B9, 0x271C37D9, 0xBF56E5E0, 0x40D07E1C,
+   //T[188]
+   0xEC0ECDC4, 0xF27C4751, 0x1AB47A42, 0x6F0E5C35,
+   0x5A14BC90, 0x59469749, 0xF87D9997, 0x2ADBF0E0,
+   0x8C54BE93, 0xF2B85E4F, 0xF2215010, 0xC1DCCED4,
+   0x9F9EDCC5, 0x940D59D2, 0x7CDA7CDB, 0x51343CE7,
+   0x5F01008C, 0x7A28AA4E, 0x5609534E, 0xD402F020,
+   0xF9B407C8, 0x509CBBB3, 0x3062E274, 0x7FEFC854,
+   //T[189]
+   0xD6584B0B, 0xA45C6765, 0x2DCF66D7, 0xD850FA2B,
+   0xCDD49C9E, 0xB9B26429, 0xB4A81F9F, 0x6E9F81B6,
+   0xFDED47C2, 0xB11E23EA, 0x53737F77, 0x8FBD7D39,
+   0xFA51C0E4, 0x83C5211F, 0xE367F6F1, 0x13ED4909,
+   0x12E2D56D, 0xC6962CB3, 0x2EA21306, 0x292113A5,
+   0x1FDB3047, 0x1BD79869, 0xDCDD666F, 0x0A8B4267,
+   //T[190]
+   0xE8E0EC6D, 0x8F8A277E, 0x6B25BFF5, 0x9DD065AC,
+   0x3FADCC5C, 0xBF43ABFB, 0x7ADCF27A, 0x580A93B9,
+   0x9C5F91DA, 0xFD88209B, 0x1157E4FD, 0x22204982,
+   0xDFCA4AEF, 0x8C0EE896, 0x17BFBCA8, 0x62297ECB,
+   0xC503E0FC, 0x4CE77102, 0xBB61B4CA, 0x92531D41,
+   0x7D56A863, 0x9235C0E1, 0x88037780, 0x621333D9,
+   //T[191]
+   0x7B89B09E, 0xA3EC0650, 0x117B1CEA, 0x56FAA949,
+   0x79D098A2, 0xCC1F4595, 0xA5FFDDDC, 0x3BF696D4,
+   0x51C91B61, 0xEB08F323, 0xF18214CF, 0x64134799,
+   0xF623E1AF, 0x91F5996C, 0x1809FB35, 0x4D8FDC5C,
+   0xC7C8315F, 0x2F6B4859, 0xAA0C35C2, 0x879DF13A,
+   0x34421A6E, 0x8FC97F25, 0x32EA6BDA, 0x71E9EFBB,
+   //T[192]
+   0x67515485, 0x17B09282, 0xEC2C905C, 0x37D93484,
+   0x7B457818, 0x2C465231, 0x78AA15FB, 0x06B47C9C,
+   0xA826A39A, 0x6C19079B, 0xC83C4086, 0x2A3712C9,
+   0x6B8350FC, 0x1BAF756C, 0x1A65A509, 0x1843A203,
+   0x43CB5EF7, 0xBB989F07, 0x5A9F81B3, 0xF172AE31,
+   0x50F13828, 0x51122302, 0x05079F88, 0x4EE4ACB6,
+   //T[193]
+   0x32DE79EA, 0xFDBA8ED9, 0x98B03DB3, 0x4DE0E4C6,
+   0x5CB3CDB9, 0x76CD74EA, 0x4EB371E0, 0x50103B56,
+   0xFFBCB5DE, 0x4A59AEA0, 0x29736C68, 0x7216351C,
+   0x3F86C032, 0x3C4E3FE8, 0x1498D3CD, 0x3F7CCB06,
+   0x8E501B1D, 0x1A44B095, 0x2BB174D1, 0x5CD7B02F,
+   0x0401CA78, 0x03FD7BA7, 0xB716E445, 0x4C926CA7,
+   //T[194]
+   0xB212A3F6, 0xB7E71297, 0x8DCD3A34, 0x773A53C9,
+   0x0E5057DB, 0x1B8CCD84, 0x74138DB9, 0x0A3DD877,
+   0xB5BD9F25, 0xB0F2DFF3, 0x0F266EFB, 0x5032D44B,
+   0xFF2164DB, 0x3B05C19C, 0x4A9AAA65, 0x0CDE5955,
+   0x16650B2C, 0xB750AC42, 0xF58AEA46, 0x9CD958DD,
+   0x08AA902A, 0xE5EEB294, 0x877F8324, 0x0A569901,
+   //T[195]
+   0xE0FD6D84, 0xE6468209, 0x501E3802, 0x14013C98,
+   0xAEB53693, 0xF758E53E, 0xC32A034A, 0x3AA0567A,
+   0x9F533C1C, 0xB04AC0A0, 0x0772E691, 0xBAFC30B2,
+   0xC70242D6, 0x45D434C8, 0x25A80BFD, 0x59DECA81,
+   0x525E4E7D, 0xDA414237, 0x246F0948, 0xFF7ADAB5,
+   0xD1FA912C, 0x9F6B49A4, 0x4C98BB49, 0x0057311C,
+   //T[196]
+   0xE534BDB1, 0xCF8AEC6A, 0x34F0F9F3, 0x2A265AC8,
+   0x2F88FA7F, 0xE626B0D8, 0x685470FC, 0x7C79C863,
+   0x8D142755, 0x4FEF0271, 0xCD2CFA8F, 0x410AFC1C,
+   0x62CC95A2, 0x951AB6B8, 0xA3AE4A36, 0x35559E5D,
+   0x5B2DB6B9, 0x2DC20C5F, 0xA3E5C480, 0xC4C9AB49,
+   0xDEC616AD, 0xE6E8AC7D, 0xAFB4108C, 0x1F5165B8,
+   //T[197]
+   0xB430DDA2, 0x4581DAE7, 0xCB61AE7E, 0x0DB3081F,
+   0xD9739D08, 0x87DE2987, 0xDCB52336, 0x22DBC8FF,
+   0x7ABA0810, 0x76A52FED, 0xBD4152C9, 0x884EFD8B,
+   0x9E8A049D, 0xFBF91C17, 0xBD62222D, 0x0B191751,
+   0x9ABB3577, 0x0EB5E26E, 0x7BA0CDFC, 0x798111CA,
+   0xE3BB2AE4, 0x460A6AE3, 0xB0F69E5D, 0x4F29860B,
+   //T[198]
+   0x63F779AB, 0x1555E401, 0x1F4FB72C, 0x97F6B554,
+   0x9DF60DD0, 0xF2D1AB32, 0x9ED84704, 0x4A06DE25,
+   0x2775D6CF, 0x7DB10BDE, 0x0554ED83, 0xF28ED904,
+   0x25B853C4, 0x9A808E9B, 0x73B550A6, 0x2971EEAE,
+   0x8D89CBBD, 0xD182FCAB, 0xC4CD0E61, 0x47BB649D,
+   0x9C46E080, 0x87B2B52B, 0xDF3C6831, 0x5515AE77,
+   //T[199]
+   0x073C9088, 0xA4AF6CC3, 0x9CC8816A, 0x8B738B7F,
+   0xD006308E, 0x0C8BD11D, 0x3250893E, 0x395F2005,
+   0x750E5867, 0xA29C69BE, 0xA6E11A88, 0x648E8E0A,
+   0x94D6FD9D, 0x816FF59D, 0x8DDBE41B, 0x68F4E699,
+   0xC5D2A20F, 0x6F44F8EF, 0x7AB97EF5, 0x3BC96495,
+   0x44C4AC89, 0xAA7EF34B, 0xBF10892A, 0x257A564D,
+   //T[200]
+   0x99094DB2, 0xD1965DD5, 0x94E97E16, 0x805F7364,
+   0x8DA8BDF2, 0x14875351, 0x15F954F4, 0x1606E61D,
+   0x8B2F3DFE, 0x7EB02DA0, 0x7394F5BB, 0x04BD7298,
+   0x8B736CFB, 0x2226F410, 0x9A185386, 0x7459D5C3,
+   0x41055459, 0xEAC09663, 0x40B33906, 0xB3B7F333,
+   0xAF5B4BDB, 0x5DDD53FE, 0xD4A03D92, 0x1F5E185E,
+   //T[201]
+   0xA63CB9DB, 0x417618CF, 0xAA3E0271, 0x084CC3EE,
+   0x518F255F, 0xD78F3C79, 0x8809AB81, 0x7218FCE8,
+   0x9E7C58A6, 0x4E289830, 0x37162D7C, 0x5EFAC35B,
+   0x01CED5E9, 0xDB0C0A22, 0x5AD8B3F4, 0x3431337E,
+   0xB216732D, 0xD9315E03, 0xC43CCC75, 0x16D45F41,
+   0xA82E8B3E, 0x300569D5, 0x9CAC7A24, 0x5C166A51,
+   //T[202]
+   0x2558F3B3, 0xFD5478F8, 0x0C969711, 0x36C1483B,
+   0xD663616E, 0x6E3572B5, 0x6E66F237, 0x06F17BC1,
+   0x596307F3, 0x229F2B63, 0xC4918E35, 0x721723BC,
+   0x457E6F1E, 0x42A199D6, 0x43B627B6, 0x7FE12D0E,
+   0x33C13636, 0x3A3A1F60, 0x237C5D95, 0xF9B9D1CD,
+   0x6DF1CCAC, 0x948EC9E2, 0xFD776450, 0x107D58E7,
+   //T[203]
+   0x1D4FFFB7, 0x703D8855, 0x8D83141A, 0x6D875EFB,
+   0xC7195AFC, 0x829CA600, 0xE3B86C1C, 0x3298F0EF,
+   0x97BC539B, 0xB9D06CA3, 0x390E91FC, 0x12C751AD,
+   0xDD742BDB, 0x4FA750CD, 0x443E9201, 0x638E7D34,
+   0x9C6E3083, 0x993373F3, 0xC4D96172, 0x983A631F,
+   0xFCC4DC69, 0x328458FB, 0x266AEDBE, 0x64040683,
+   //T[204]
+   0x9D25A6DD, 0x66437FE5, 0x070C80A4, 0xCB9CBBDA,
+   0xD9C4A960, 0x7F3D68D6, 0x210FB620, 0x63B51503,
+   0x982F6990, 0x8781A989, 0x7C15273E, 0x81A68F53,
+   0x0ECF8CCD, 0x40C99792, 0x4C5B8F22, 0x01CD945E,
+   0x24A49500, 0x40F6EBFA, 0x3D7CF10A, 0xC8F059D0,
+   0x5D34D24B, 0x2435D56E, 0x2F954409, 0x02B28D09,
+   //T[205]
+   0x2593FFA9, 0x054CF250, 0x5CFCED31, 0x4E87040A,
+   0xDD298D05, 0x0C98EA7F, 0x42BFBA1F, 0x6D626998,
+   0x4C24EF1B, 0x92A636CD, 0xEA8CF405, 0xCA42E586,
+   0xEBA41DC4, 0xFBBC1A96, 0x45B1E4DD, 0x17D6F52B,
+   0x112E88EC, 0xC98557D5, 0xD76BB766, 0x6964FAF7,
+   0x1C597DAE, 0xBCC7CE0E, 0x41458933, 0x6514EA32,
+   //T[206]
+   0x8F75E648, 0x3A0C1D8B, 0x5FF255A3, 0x983458A2,
+   0xB5D01220, 0x2C877E98, 0x296DC5A5, 0x718493F8,
+   0x0B2ECA7B, 0x752A5797, 0x162C8A64, 0x888F655E,
+   0xAD681DFB, 0xD767997D, 0x69FE0C5C, 0x563623AA,
+   0x1F738315, 0x358C4FCB, 0x27FFDBE8, 0x4CB59B75,
+   0x7E91B1B1, 0xC26D977C, 0x23F084F5, 0x19A9874E,
+   //T[207]
+   0xB370D0C2, 0xCB4AA5CD, 0xBDAAA7CF, 0xBB0F586D,
+   0x3B09E16E, 0x0D4A6B97, 0xEB355057, 0x5276C4BB,
+   0xCDB827A9, 0xCD9A75C2, 0x2932D660, 0x6B2FBB78,
+   0x5B7FD6A2, 0xC320629A, 0x63EE9E3D, 0x04BBCE8C,
+   0x9C840BFD, 0xA95CA12C, 0xEEAE7A5D, 0x3B41651A,
+   0x3C488886, 0xBD591B83, 0x2AEC4CCD, 0x2FE28608,
+   //T[208]
+   0x7FABF59A, 0xF965CD90, 0x8D433588, 0x33E91D2C,
+   0x936FEE06, 0xA1CEF799, 0xC961A80A, 0x7C13F6D9,
+   0xEDBE2F8F, 0x84F8CC6E, 0xA35E3DB3, 0xA5961C4D,
+   0x18288A82, 0xC53F406C, 0x2F237A1C, 0x06F98CF2,
+   0x5DEC308F, 0xF36C6035, 0xD3BDE876, 0xE4EAD446,
+   0x5C5BDC09, 0x3A15B99F, 0x16E37C48, 0x08026CA0,
+   //T[209]
+   0x4C8F2849, 0x62550AA5, 0x6703F181, 0x08BC013E,
+   0x78D1D0C4, 0x7CD75BD7, 0xCB723C78, 0x0C8CD938,
+   0x72D9672C, 0x3FA440E6, 0xDD01DA8B, 0x6F3F6051,
+   0x4F84B0E6, 0x3221743B, 0xC02C5173, 0x67CF5629,
+   0x5A5FDA7F, 0xB53D072F, 0xC306BF82, 0x3CD8F734,
+   0x07B9C568, 0x9C60645F, 0x34974677, 0x2E3B54B7,
+   //T[210]
+   0x86065C87, 0xEA64AB3F, 0x3D73EF57, 0x4DAA8BFD,
+   0xB5638679, 0x2B162907, 0xF2E7CEE0, 0x7D7314FC,
+   0xB623E32C, 0x26B5442D, 0xBFF5A74D, 0x8854E029,
+   0x5626F05B, 0x4CA2A2AA, 0x3EFF5F77, 0x618CBCC7,
+   0x128FA22E, 0x597CDE3E, 0x40468A62, 0x72E981F8,
+   0x1A8D22DC, 0x551E64CD, 0x0F99E726, 0x52249AB1,
+   //T[211]
+   0x6B619BC1, 0x1846F736, 0xA88DBD55, 0x2547F4BA,
+   0xC63EB3CD, 0x9F595335, 0xFF639BCD, 0x2A0FB732,
+   0xE859C213, 0xEEF303DE, 0x150D6B58, 0x7CCE9190,
+   0xF3C7C61B, 0x5C41853E, 0xC42C14AF, 0x78091472,
+   0xD0521563, 0x7F5FEDD9, 0x37826BE1, 0x187BD79C,
+   0x71B624A4, 0x548B610C, 0xDFCA73A0, 0x2FAA9233,
+   //T[212]
+   0xA8C47F99, 0x12D6762F, 0x829C2B6D, 0xBF11F253,
+   0x9BF07390, 0xE59E740B, 0x6BA20C18, 0x5A9AFF39,
+   0xCF0534C2, 0x1B51BC2D, 0x66E83698, 0x20624BA1,
+   0x0C6E9C85, 0x9FC1A736, 0xF2B07784, 0x17C12AE9,
+   0x82BB999A, 0xA0FE04F6, 0x376E3B80, 0xF6A4B8DD,
+   0x9FF3073B, 0xCFFC7F6E, 0x7F3ABA1D, 0x3C221D09,
+   //T[213]
+   0x2742A507, 0x75A3CE79, 0xD6F50A23, 0x5A458F05,
+   0xB19BF60F, 0x01561E09, 0x5DA97917, 0x4A718B1D,
+   0xDCBB3250, 0x1810885E, 0xDB8E6CE9, 0x015891F9,
+   0x07E62297, 0x25A86229, 0x9D894086, 0x64EED5C0,
+   0xA5D92779, 0x7E3CFA11, 0x67491A4F, 0x7F366208,
+   0xAEB2703F, 0x31FECE14, 0xCAA7D786, 0x10BB4512,
+   //T[214]
+   0xBFC680D7, 0x56840E31, 0xE26C1F2D, 0x9694C290,
+   0x36237198, 0xC9D6D2E4, 0x1899CD79, 0x2AC5AE52,
+   0x5AEC1595, 0xE406559D, 0x8921E8F0, 0x8AA43DAF,
+   0xD99D9A6D, 0xABF65E15, 0xA25FB0F4, 0x4A785D6C,
+   0xA0595FC1, 0xF97FF7B1, 0x1B341B09, 0x72EEC2AA,
+   0x98DC9572, 0x981DFB3B, 0xDEB9EC59, 0x7A683AF0,
+   //T[215]
+   0x6BACA741, 0x94B25147, 0x68B0B0F4, 0xF3CFFCC4,
+   0x3DF10405, 0x0E81968C, 0x649014DF, 0x48782086,
+   0xAF37665E, 0x35BDC18A, 0xC7D49621, 0xA4A19B4A,
+   0x7D233682, 0xC29B359A, 0x90DEB450, 0x1E67D099,
+   0x4570232B, 0x8AE46FAC, 0xCA2D2F05, 0x0F30DE8E,
+   0xF9D97D04, 0xC4AE5AD3, 0x5BB87354, 0x6F4E4FC4,
+   //T[216]
+   0xDD1D4D31, 0x36F40D77, 0x29D06352, 0xBD991E3D,
+   0x160BD563, 0xF363D237, 0xFF618EF9, 0x339A9318,
+   0xE92529F8, 0x7170B2A9, 0x7F2F0C0F, 0x16E16628,
+   0xA89CF9F1, 0x3D1A5B3F, 0xF2851B6E, 0x05EEBFF6,
+   0x668F2A54, 0x028FEFA7, 0x036873DC, 0x3B8717A3,
+   0xB17020B1, 0xBCBAD504, 0x0D5DDB53, 0x222B7F5F,
+   //T[217]
+   0xD849148F, 0x4F28B5BD, 0xFF2BF30C, 0xA0AEB008,
+   0x4FF789AD, 0xF1CA3278, 0xA177B57F, 0x31E1765B,
+   0x524F9DC1, 0x3F850648, 0x4F9FCB9D, 0x7298A2D0,
+   0x1755F78C, 0x463EBCF2, 0xED7D46A8, 0x6257FC22,
+   0xB1BF13C8, 0xCC491867, 0xC6CEEB48, 0x2C1F803C,
+   0xBB502A60, 0x5BA5EB6A, 0x3F71729E, 0x3DC44123,
+   //T[218]
+   0x6AE42BF0, 0x6DC4B407, 0xD0C004B3, 0xC24DBED0,
+   0x31E98073, 0xB9298E25, 0x36C57528, 0x1CA1C157,
+   0x303C6D15, 0xDDFA6958, 0x74F96BC7, 0x0A189ACE,
+   0xB618F9D6, 0xAF0D5F52, 0x21ACE6F4, 0x785C354F,
+   0x454E3636, 0xCADEC302, 0x1CD3885F, 0xD350DA25,
+   0xBB91FF7D, 0x71BA6085, 0xE44CE6EB, 0x1038E396,
+   //T[219]
+   0xD9CC25FA, 0x75A9B0BC, 0xEC1CD59F, 0x934F9929,
+   0x52657C7E, 0xC884D9CA, 0xB6D69D2B, 0x2BA0976C,
+   0x14F489FD, 0x6BB18462, 0x07E88B43, 0x729C4557,
+   0xF98E5B1D, 0x8C773B66, 0x8B379E70, 0x7A0C5E94,
+   0x1406A8F8, 0x2816A01D, 0x30E14B07, 0xBECBD7D1,
+   0x1990886F, 0xA98DE1D3, 0x08F1B240, 0x261CED1B,
+   //T[220]
+   0x79DAEA61, 0x4A9E6F30, 0xADF93032, 0x8BE9F2D6,
+   0x0CD58B5D, 0xEDDA9BD5, 0x27D11945, 0x5C999A5D,
+   0xBC760414, 0x20649A49, 0x9BB12BF5, 0x4A5EC632,
+   0x21D73EFA, 0xB9396926, 0xF53A0C52, 0x2EA494D0,
+   0xE2DE640B, 0x144B5ECC, 0x65819F63, 0xD1AE9013,
+   0xD205E42E, 0xC0CE6CC4, 0xAC4D9FAC, 0x024C6B25,
+   //T[221]
+   0x58B2AD16, 0x9A7B1C7C, 0xB77D48D0, 0x746F1078,
+   0x96C2E205, 0x00F53A28, 0x7A35F8A4, 0x1FC56303,
+   0xE996D51C, 0x82E49EAE, 0xACE43230, 0x3B273C5E,
+   0xD17C3FDB, 0xC646972F, 0x4C71717B, 0x1F9669C2,
+   0xD361FE8A, 0xB2D12A4D, 0xB8909955, 0x259C7D88,
+   0x44393689, 0xDF9E5AFF, 0x28FBB7DF, 0x62EC214A,
+   //T[222]
+   0x291E9757, 0xC28BFEB8, 0x18BCE058, 0xDC34EB6B,
+   0xD5E44345, 0xEA9CB1F2, 0x3868731B, 0x06F61CCC,
+   0xB881DAFF, 0xE8B4F885, 0x050D2B6F, 0x76D21DC5,
+   0xF702BDE7, 0xD632AAF3, 0x455019D0, 0x3132452E,
+   0xB3E1E7CB, 0x38173456, 0xA5C66936, 0x64C212DF,
+   0xFAC6DF6B, 0x4769F8EB, 0x299BDC21, 0x166F708C,
+   //T[223]
+   0xDF62836F, 0xF2FA0E7A, 0xB6A12EBC, 0x95345EA1,
+   0xB69C10F0, 0xF944291F, 0x95533323, 0x185A5A90,
+   0xB2BD073C, 0x4A3AD8ED, 0xB84D18D8, 0xA2126001,
+   0xA35E2C06, 0xF4BEA88A, 0x459BDF47, 0x1A1987A4,
+   0x6E2AACEC, 0x3D03019D, 0x5014E97D, 0xB4ABE1F7,
+   0x0A330F68, 0x76FA4E48, 0xE73A5193, 0x63C4FB2D,
+   //T[224]
+   0xEF94DA1C, 0x753BAAA7, 0x02C3C8F9, 0xFE237039,
+   0xDE5CC1A8, 0x93C2624A, 0xA990F9AC, 0x25AF6830,
+   0x777BC3E6, 0xEB12735C, 0x062F0BBF, 0x826275B4,
+   0xEB187278, 0x4CF37306, 0x9614640A, 0x39D9E129,
+   0x08155C32, 0xC58BE51C, 0x0D01E308, 0x564C5F1A,
+   0x3C044640, 0x3ED2FD6E, 0x9F6D923F, 0x142F3D2B,
+   //T[225]
+   0xC760219E, 0x1067C65D, 0x3BEC016A, 0xDCAC0989,
+   0x4F0BBEF1, 0x13F2959F, 0xDE3463AD, 0x55C54055,
+   0x65A2C60B, 0x7C13E807, 0xD10AB10A, 0x0D93A064,
+   0x7C71355C, 0x0F8E3872, 0x4E79E354, 0x3785DE38,
+   0xE6BDB4DD, 0xF53E103C, 0xFFB65825, 0x01835EBF,
+   0xABE7843E, 0x031C508F, 0x1185DEF4, 0x78FD5E38,
+   //T[226]
+   0xFEAF8C22, 0x67C9ECDC, 0xBBAAA08C, 0xD4D87BCC,
+   0x55E42F09, 0xC47BBD50, 0x0D17E5D9, 0x72452B11,
+   0xA8F69DB3, 0xB96A0C85, 0xBDF63128, 0x87C4397C,
+   0xB07B5CFE, 0xAF148E5F, 0xEDB9014F, 0x5A09AE65,
+   0x151522EF, 0x2F255CDF, 0x74AA3B96, 0xB4EB6F76,
+   0xBB9F8C5B, 0x0A50E090, 0x8CCB0CFD, 0x55A8F3B5,
+   //T[227]
+   0x66B5A876, 0x2B4B46C5, 0x67B9CC7D, 0xAF5926D7,
+   0xC11BBC63, 0xAE8D5A4E, 0xF4A9CA56, 0x4E47749F,
+   0x6F6D6645, 0xF1EA8F60, 0xEB215EE5, 0x26DA502B,
+   0x88B6C1E0, 0x3D0B0B09, 0x2D847A3F, 0x1FB6BF7F,
+   0x36F71A49, 0xC335FFD4, 0xBE6B784E, 0x3456E687,
+   0x24745FA3, 0xB671BFA6, 0xE0B91E78, 0x2A7ABA3B,
+   //T[228]
+   0xA92569D7, 0xA408BBE8, 0x6302911A, 0xE687B708,
+   0xFFF86BD7, 0x3A683C5C, 0x09DDEABB, 0x23150656,
+   0xCDC03F48, 0xCEA9B8D3, 0x81E06A3D, 0x8D80DFF5,
+   0x43A0647F, 0x034C605F, 0x5DE19156, 0x04727541,
+   0x72EA592C, 0xB949184D, 0x4E7F2628, 0xA1EA4D3E,
+   0x5B506E9B, 0x2F4E2E7D, 0x875E9834, 0x542CF753,
+   //T[229]
+   0x26808C92, 0xB30C1337, 0xC3B6BBAF, 0xD2814BBC,
+   0x62CEC3A4, 0x3465FE2A, 0x3F040D7B, 0x7242E80F,
+   0xAD98BB31, 0xA702D12E, 0x12AFEDBD, 0xE6A6BF38,
+   0xE54FCF5D, 0xA0ABA5E8, 0xE1811521, 0x2D018537,
+   0xDC09F2E3, 0xF310F2D0, 0xA19AF4B4, 0x1A59E0F0,
+   0xB2662995, 0xA6130F9F, 0x6AFE5671, 0x263EAF1B,
+   //T[230]
+   0x307A83C3, 0x9E474987, 0xAA1F934A, 0x6D308F7D,
+   0xCAE4BEEA, 0xB1B373B1, 0xE5914052, 0x45EA8BD0,
+   0xBF2B1538, 0x92874139, 0xF59390A9, 0x678BC840,
+   0x5AFC8316, 0x1BD7446A, 0xF28EA25A, 0x0B468855,
+   0x263CE11D, 0x95914ECE, 0x23F80F9B, 0x28478AF9,
+   0xA9038C1C, 0xD040DD78, 0xB1CFE302, 0x263B67AC,
+   //T[231]
+   0x4C444B26, 0xC46279D8, 0x1535DCE5, 0xC7A743A4,
+   0xFEC43FCC, 0x02926BD1, 0x74823317, 0x42A245DF,
+   0xBDF366F4, 0xFDCA874F, 0x5BA3971C, 0x8245F439,
+   0xD7A6E87A, 0x3AA58585, 0x966A0C44, 0x2788EF8A,
+   0x26DAA263, 0xC06708D7, 0x598B1D32, 0xAB469BDA,
+   0xE7C86B28, 0xB79B7134, 0xFF5659B9, 0x72499E4B,
+   //T[232]
+   0x80840E6E, 0x9E6D9C50, 0x25D7D6A4, 0xEF5D15B5,
+   0xFCB778BE, 0x19499814, 0x26AA9CF4, 0x54AACA10,
+   0xBCFECB7F, 0x16EB0F53, 0xF4D95EE7, 0x587682D5,
+   0x7C7272E3, 0x884E9F2B, 0xAA0FB8A2, 0x5B10130F,
+   0x7117733D, 0x7D9BD6A8, 0x273B41EE, 0xDB2E1B42,
+   0xB4961095, 0x6C664D0F, 0xA548811F, 0x30515954,
+   //T[233]
+   0x67BB1E75, 0x2CE525D9, 0xB5972998, 0x68A8851B,
+   0xAF1CFD25, 0x4F707767, 0x47C3AFEE, 0x78C78797,
+   0xDBE04B30, 0xE39F004F, 0x5F5B16A9, 0xBB427134,
+   0xBEEE58B9, 0x46177D04, 0xD6519406, 0x04015AD9,
+   0xD11BE251, 0x7E347BEF, 0xE39D1B13, 0x159C7A7E,
+   0xBE7C72D4, 0xBE647DC5, 0xA10F46A8, 0x6CD6F484,
+   //T[234]
+   0xA89D006D, 0xAB3F69A7, 0xA5214966, 0x813D0D79,
+   0xD0189F89, 0x7CCE898F, 0xA5AC73EE, 0x5687BCC1,
+   0xE9FC9360, 0x4BA75C38, 0x2B8BAD3C, 0x035030B5,
+   0xABCEBBF5, 0x1FDF46B8, 0xF2C5FC5D, 0x2F4FB319,
+   0x7576F6EF, 0xEF536161, 0x7A7E8A56, 0xCB809740,
+   0x4DDE58A2, 0x6017D7C4, 0x93452AB8, 0x47785091,
+   //T[235]
+   0xB006A83B, 0xB557DCDB, 0xFD408236, 0xA0D4255D,
+   0x2352B2BD, 0xC0868122, 0x73192A09, 0x43963791,
+   0xA3D63ACA, 0xAF0AF9CB, 0xFA70EBBE, 0x8404FE78,
+   0xDF56DFC3, 0xECA7AD53, 0xB4669437, 0x6AD782B4,
+   0x05E82339, 0x6689F729, 0xBA1824D9, 0x209768E8,
+   0xC2EDEC7F, 0xE5DE0724, 0x38FBADB1, 0x7120D343,
+   //T[236]
+   0xF8B3222E, 0xF00AC23E, 0x3E0685CF, 0x580326C4,
+   0x45C6B027, 0x558337B5, 0x714B1B5C, 0x2966FEED,
+   0xFA337CB0, 0x0F34BD06, 0xA4A6F2CD, 0xFD01C9CB,
+   0x645DA1D8, 0x5B78469B, 0x55B37984, 0x6D0806D0,
+   0x8CEDB575, 0x273E8228, 0x4A9C2442, 0x331ACDFD,
+   0x56529AB0, 0xDC32D706, 0xD15FA7EF, 0x58A6EF20,
+   //T[237]
+   0xE66F19B3, 0x9BAE2C8B, 0xCDBFB3FF, 0xBE9C4209,
+   0x4CDEBBBC, 0x3984D5AF, 0x2AE82412, 0x1B42547D,
+   0xA8C80F87, 0xE8D255CD, 0x0DD5A12B, 0x4C6E45F1,
+   0xE17AE846, 0x3A1169D8, 0x63D54E4E, 0x1B950860,
+   0xC54EEC62, 0x144BAF9D, 0x3DC6C40B, 0xED7DCD78,
+   0x15E7F8E0, 0xF399EDBA, 0xF20810AB, 0x2F908C13,
+   //T[238]
+   0xB0908E19, 0x0B6C1AF5, 0x2887D231, 0x85569B09,
+   0x18B1B24E, 0xC7AAB70F, 0x6BFD5F28, 0x5C7D9B9B,
+   0x40A03EDA, 0xCB760C39, 0x7D74CDE0, 0x391489CD,
+   0xF41689D7, 0xEA99340F, 0x9FCB9D19, 0x5EE8A4FD,
+   0x09E3E4C9, 0x7E2DD8CF, 0x8E935682, 0x58F0B6E3,
+   0xEF987DEA, 0x3910CF8E, 0x3357DDCA, 0x43DB59BB,
+   //T[239]
+   0xCDAB66C6, 0x9CEE82EE, 0xE3DF8BE0, 0xADB38D90,
+   0xC0F986AA, 0x560D9126, 0x7A74B56B, 0x19A83339,
+   0x23E64216, 0x898A0C0C, 0x0346A9AF, 0x3B2C3F6C,
+   0xE926A027, 0xBF6F023B, 0xCFE85EE3, 0x348A9773,
+   0xF912C125, 0xE5DA19AF, 0x28096493, 0x55F40E4D,
+   0xCCACFE75, 0x2EAC6428, 0xD164389A, 0x113C2B8E,
+   //T[240]
+   0x544C623A, 0x8FAF3BF5, 0xBDB14F39, 0x9BB7E5E3,
+   0x3C384B7C, 0x1DE36E79, 0xE9AF8C35, 0x7A2270F1,
+   0x3D210404, 0x19526A59, 0x0B1E4000, 0x1DB0CFBF,
+   0x7C7202C7, 0x3F503630, 0x846EECF8, 0x353C3654,
+   0x697A31E3, 0xCFDF5603, 0xDDA76AAE, 0x073AC516,
+   0x958ECDCD, 0x8BA18582, 0x867D1F64, 0x48B583CF,
+   //T[241]
+   0x71BF95FF, 0xFFED7993, 0x31B7DB9B, 0x8D26D6AC,
+   0x336D37C3, 0x19DEADD0, 0xCFEE7016, 0x6B92BFBB,
+   0x8462603D, 0xE97DD10D, 0xB37A54D5, 0x53E67853,
+   0xE0AC5976, 0xB5DE16AC, 0x104FC1AA, 0x1A64552D,
+   0xDFB6A923, 0x0A0E18EB, 0x0DA85127, 0xD099A87B,
+   0x27721584, 0xF6E251D8, 0x7AB8496B, 0x37440490,
+   //T[242]
+   0x311F043D, 0x65573A79, 0x3D340529, 0xF76F4C71,
+   0x54CF3530, 0x5F40BCCE, 0xC4CC56FB, 0x7D576414,
+   0x0DEE73F1, 0x7CE0062D, 0x99DCA2D3, 0x57D5972F,
+   0x07A80926, 0x51A210E7, 0x5F5400A6, 0x2A103039,
+   0x4C8C3AAB, 0x9F775949, 0x870E5613, 0x7BB6F14E,
+   0xBBDECDA6, 0xC846493C, 0x164116C5, 0x0A0DDB3E,
+   //T[243]
+   0xB2D08E20, 0x1213E2FC, 0xDC1E0BB4, 0x8FE08F41,
+   0xFBC005FD, 0x590498D5, 0x14F30C98, 0x45B2A8F5,
+   0xC845F193, 0x17722444, 0xCD51419C, 0x490DE520,
+   0x0A3A845F, 0x3853C7FA, 0x55CCD7A6, 0x347B11BF,
+   0xA85DE82A, 0xBC5C6C70, 0x9701F9F5, 0xA524DB06,
+   0x5E2A3529, 0x65B4367D, 0x8D54A5BC, 0x528D4547,
+   //T[244]
+   0x82A7CA65, 0x2800B85E, 0xDA1FCB19, 0xD7894B6F,
+   0x85C3C39C, 0xEFE9113B, 0xFB346EC6, 0x612359EE,
+   0x669DE9CE, 0xCDAC00BA, 0x9FDC94C8, 0x435A348A,
+   0x67B7E468, 0xA132B1F8, 0xFFB42F3A, 0x0A6BC74B,
+   0x529DD8DD, 0x3D6E6B39, 0xF67510EA, 0xC9E1767E,
+   0x69E675A0, 0x05E37603, 0x240445B6, 0x75766B88,
+   //T[245]
+   0xDC699124, 0xE4491682, 0x013E0007, 0xC6CAF0CC,
+   0xD84FF410, 0x3126943E, 0xA0232FFC, 0x1657F128,
+   0x9405EFF2, 0xD52211D2, 0x7B8E484C, 0x4CB8010A,
+   0xBA5444DA, 0x21FEEF6E, 0x77524424, 0x5B0E33F8,
+   0x16ABF780, 0x6F13FA6B, 0x6FFB52EC, 0x000FA71A,
+   0xE22E7213, 0x8CB69598, 0xF66E5AA4, 0x45814EF1,
+   //T[246]
+   0x1D61A40A, 0x21EF63F8, 0x5182D578, 0x4B2CFE3F,
+   0xB6BE6E5C, 0x7FCCC16D, 0x3B38391E, 0x5D1B7FE3,
+   0x10A22561, 0x2D39AF82, 0xEA3E4379, 0x2448228C,
+   0x49B7D77D, 0xBC69B73B, 0x3A5F1BD0, 0x62781E9C,
+   0xCFAFE0C2, 0xD2C28462, 0x0585E5D0, 0xED8A8535,
+   0x5B2B9C04, 0x503DBF9E, 0xC747E6C4, 0x3EA38A8D,
+   //T[247]
+   0x57EA2480, 0xD3839C7D, 0x56729B88, 0x7FB74870,
+   0xE13D059F, 0x4DC959CB, 0x5F09BD3B, 0x36C4DB9E,
+   0x38EF705B, 0x3AFF6B6E, 0x181667D0, 0x6804499A,
+   0x54ABFFB2, 0xC8E5E79E, 0xB4495EED, 0x0363E70F,
+   0x962B484C, 0x30C3273B, 0x5527E904, 0xD85FE164,
+   0xAB44638B, 0x22C030C7, 0x6E96DD1B, 0x6506FC7D,
+   //T[248]
+   0x367D0015, 0x73DB66A6, 0x601C02CF, 0x008D9BF8,
+   0x1F316A2A, 0x89465325, 0x770A265F, 0x474C9C61,
+   0x3851A75F, 0xBFB0D0F5, 0xA0C69838, 0xD68011DF,
+   0x23130FA4, 0xDAAB0223, 0x9B45FACA, 0x31C4D124,
+   0xCCAC4EFC, 0x92C19371, 0xA7432522, 0xE090932C,
+   0x599DEB91, 0x267E1C4A, 0x3E356B8E, 0x6BF39616,
+   //T[249]
+   0xBA7934AA, 0xC3DD7A85, 0x0E653538, 0x2FB829C1,
+   0x81B81250, 0x02EA40F3, 0x7EA97548, 0x73EFEEB1,
+   0x944B8996, 0xDFCDA812, 0x1E3E9917, 0x35BEBDBD,
+   0x61876FAF, 0x7131A003, 0x24102978, 0x2E3CBD7B,
+   0xF77CAD50, 0x71122B77, 0xA1A7C671, 0x129E2D11,
+   0x5C3B60FB, 0x81A7F61D, 0x5B402C75, 0x2836EF5E,
+   //T[250]
+   0xB57A5A57, 0xC5A7BAA5, 0x82C727FD, 0x0AA7D06F,
+   0x7879BCE5, 0xD2E78192, 0x0B1A809E, 0x4D6F485E,
+   0x361826C2, 0x672EEC67, 0xC2F81794, 0x1BEB1D74,
+   0x18458CF5, 0xB9752B15, 0xD7269839, 0x30DE2C58,
+   0x6E83B030, 0x2B8B41A7, 0xECE4A904, 0x2F7A7536,
+   0x524ACC68, 0x549A67D9, 0xDAA585D6, 0x1B28C578,
+   //T[251]
+   0xD7EBFF90, 0x5BAEF61F, 0xB4DE3C15, 0x2DC09748,
+   0x83C1110A, 0xFF19ECD5, 0xEEF20CDE, 0x69981DCE,
+   0x3ECF0D94, 0xF1A40A33, 0x4EEE186D, 0x8D01B609,
+   0xD9FFBA44, 0x200EF536, 0x9E146601, 0x2C9859AF,
+   0x90F1D4D2, 0x25975C1A, 0x9DB544E9, 0x5684A594,
+   0x5636DE73, 0x0A780E28, 0x73C74267, 0x1765E565,
+   //T[252]
+   0x83A7C343, 0xA25DA3FC, 0x1AF6E886, 0xCCC8F8E6,
+   0xCE6E30AE, 0x013886E6, 0x9AF50928, 0x75D52919,
+   0xCB93ED64, 0xE07E5EB4, 0xA8273C17, 0x0CCB23A9,
+   0x94BF48A9, 0x2B41C169, 0xDAA4AB4C, 0x3F4D6135,
+   0x04ECF05D, 0x9E88C96C, 0xDBDA4910, 0xDB1EE1E3,
+   0xB5B5EA30, 0x98FC3EC8, 0x16480D7C, 0x3C82F5BF,
+   //T[253]
+   0x5F451E66, 0xD005AB62, 0x8F4259A1, 0x49AA689E,
+   0x126B93CC, 0xFF0626DA, 0x7EE6A09E, 0x5FB186BB,
+   0xC020FBB6, 0x9677AE76, 0x516EE13B, 0x47162912,
+   0xA7645B01, 0x46037DA5, 0x6CF5B3E2, 0x595CBB4E,
+   0x3F2AE1C3, 0x11075344, 0x1F2B5DD6, 0x6D9DE748,
+   0xE0802A3A, 0xE127ACBE, 0x4F51B524, 0x120D73A3,
+   //T[254]
+   0x84E57CA6, 0x81EAB29A, 0x0446579E, 0xB7AAC36B,
+   0x6F883778, 0xD7130458, 0x325EB95F, 0x1D493499,
+   0x0FD5EEEA, 0x1C407C61, 0x4623E843, 0x3E2A0303,
+   0x65F07D75, 0xAB9C53D0, 0x73A7CE37, 0x4A4A9D16,
+   0x5230D24A, 0xBA1D024F, 0x0C5E0AF9, 0x7CBE80BE,
+   0x11CFFD07, 0xDE15CC16, 0xBA4E67D1, 0x549722C7
+};
+
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @file ec_comb_tables.h
+ * @brief Fixed-base comb tables
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _EC_COMB_TABLES_H
+#define _EC_COMB_TABLES_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_curves.h"
+#include "ecc/ec_nist.h"
+
+//Number of teeth of the P-256 comb (0 to disable the table)
+#ifndef SECP256R1_COMB_WIDTH
+   #define SECP256R1_COMB_WIDTH 6
+#elif (SECP256R1_COMB_WIDTH != 0 && SECP256R1_COMB_WIDTH != 4 && \
+   SECP256R1_COMB_WIDTH != 6 && SECP256R1_COMB_WIDTH != 8)
+   #error SECP256R1_COMB_WIDTH parameter is not valid
+#endif
+
+//Number of teeth of the P-384 comb (0 to disable the table)
+#ifndef SECP384R1_COMB_WIDTH
+   #define SECP384R1_COMB_WIDTH 6
+#elif (SECP384R1_COMB_WIDTH != 0 && SECP384R1_COMB_WIDTH != 4 && \
+   SECP384R1_COMB_WIDTH != 6 && SECP384R1_COMB_WIDTH != 8)
+   #error SECP384R1_COMB_WIDTH parameter is not valid
+#endif
+
+//Number of teeth of the Ed25519 comb (0 to disable the table)
+#ifndef ED25519_COMB_WIDTH
+   #define ED25519_COMB_WIDTH 6
+#elif (ED25519_COMB_WIDTH != 0 && ED25519_COMB_WIDTH != 4 && \
+   ED25519_COMB_WIDTH != 6 && ED25519_COMB_WIDTH != 8)
+   #error ED25519_COMB_WIDTH parameter is not valid
+#endif
+
+//Number of comb columns for a given scalar length and number of teeth
+#define EC_COMB_COLUMNS(bitLen, width) (((bitLen) + (width) - 1) / (width))
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Comb tables (refer to tools/gen_comb_tables.py for the layout)
+extern const uint32_t ecNistP256Comb[];
+extern const uint32_t ecNistP384Comb[];
+extern const uint32_t ed25519Comb[];
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1218 @@
+/**
+ * @file ec_nist.c
+ * @brief NIST P-256 and P-384 curves (fixed-width, constant-time implementation)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The generic EC code works on heap-allocated multiple precision integers.
+ * For P-256 and P-384, field elements are instead held in fixed-size arrays
+ * of 32-bit words on the stack, products are reduced with the Solinas
+ * method (refer to FIPS 186-4, appendix D.2) and points are kept in Jacobian
+ * coordinates. Scalar multiplication uses a Montgomery ladder whose sequence
+ * of operations does not depend on the value of the scalar. Multiplications
+ * of the base point use a precomputed comb table instead
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/ec_nist.h"
+#include "ecc/ec_comb_tables.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && EC_NIST_FAST_SUPPORT == ENABLED)
+
+#if (SECP256R1_SUPPORT == ENABLED)
+
+//P-256 prime modulus
+static const uint32_t ecNistP256P[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//P-256 base point order
+static const uint32_t ecNistP256Q[8] =
+{
+   0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD,
+   0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF
+};
+
+#endif
+#if (SECP384R1_SUPPORT == ENABLED)
+
+//P-384 prime modulus
+static const uint32_t ecNistP384P[12] =
+{
+   0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//P-384 base point order
+static const uint32_t ecNistP384Q[12] =
+{
+   0xCCC52973, 0xECEC196A, 0x48B0A77A, 0x581A0DB2,
+   0xF4372DDF, 0xC7634D81, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+#endif
+
+
+/**
+ * @brief Constant-time selection
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Integer selected when c is 0
+ * @param[in] b Integer selected when c is 1
+ * @param[in] c Condition variable (0 or 1)
+ * @param[in] n Length of the integers, in 32-bit words
+ **/
+
+static void ecNistSelectInt(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c, uint_t n)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = 0 - c;
+
+   //Select between A and B
+   for(i = 0; i < n; i++)
+   {
+      r[i] = (a[i] & ~mask) | (b[i] & mask);
+   }
+}
+
+
+/**
+ * @brief Constant-time swap
+ * @param[in,out] a Pointer to the first integer
+ * @param[in,out] b Pointer to the second integer
+ * @param[in] c Condition variable (0 or 1)
+ * @param[in] n Length of the integers, in 32-bit words
+ **/
+
+static void ecNistSwapInt(uint32_t *a, uint32_t *b, uint32_t c, uint_t n)
+{
+   uint_t i;
+   uint32_t mask;
+   uint32_t dummy;
+
+   //The mask is the all-1 or all-0 word
+   mask = 0 - c;
+
+   //Conditional swap
+   for(i = 0; i < n; i++)
+   {
+      dummy = mask & (a[i] ^ b[i]);
+      a[i] ^= dummy;
+      b[i] ^= dummy;
+   }
+}
+
+
+/**
+ * @brief Check whether an integer is zero
+ * @param[in] a Pointer to the integer
+ * @param[in] n Length of the integer, in 32-bit words
+ * @return 1 if A is zero, else 0
+ **/
+
+static uint32_t ecNistIsZeroInt(const uint32_t *a, uint_t n)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //Accumulate the bits of A
+   for(mask = 0, i = 0; i < n; i++)
+   {
+      mask |= a[i];
+   }
+
+   //Return 1 if all the words are zero
+   return ((mask | (0 - mask)) >> 31) ^ 1;
+}
+
+
+/**
+ * @brief Subtract a modulus when an integer is not smaller than it
+ * @param[out] r Resulting integer R = A mod M
+ * @param[in] a An integer such as 0 <= A < 2 * M
+ * @param[in] m Modulus
+ * @param[in] n Length of the integers, in 32-bit words
+ **/
+
+static void ecNistReduceInt(uint32_t *r, const uint32_t *a, const uint32_t *m,
+   uint_t n)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t b[EC_NIST_MAX_WORD_LEN];
+
+   //Compute B = A - M
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += a[i];
+      temp -= m[i];
+      b[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //If A < M, the subtraction borrows and A is kept
+   ecNistSelectInt(r, b, a, temp & 1, n);
+}
+
+
+/**
+ * @brief Propagate the carries of a signed word accumulator
+ * @param[in,out] t Accumulator, normalized to 32-bit words on exit
+ * @param[in] n Length of the accumulator, in words
+ * @return Carry out of the most significant word
+ **/
+
+static int64_t ecNistCarry(int64_t *t, uint_t n)
+{
+   uint_t i;
+   int64_t temp;
+
+   //Propagate the carries upwards
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += t[i];
+      t[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Return the carry
+   return temp;
+}
+
+
+#if (SECP256R1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fast modular reduction (P-256 curve)
+ * @param[out] r Resulting integer R = C mod p
+ * @param[in] c An integer such as 0 <= C < p^2
+ **/
+
+static void ecNistP256Red(uint32_t *r, const uint32_t *c)
+{
+   uint_t i;
+   int64_t carry;
+   int64_t t[8];
+   uint32_t u[8];
+
+   //Compute T = S1 + 2 * S2 + 2 * S3 + S4 + S5 - S6 - S7 - S8 - S9
+   t[0] = (int64_t) c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14];
+   t[1] = (int64_t) c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15];
+   t[2] = (int64_t) c[2] + c[10] + c[11] - c[13] - c[14] - c[15];
+   t[3] = (int64_t) c[3] + 2 * (int64_t) c[11] + 2 * (int64_t) c[12] + c[13] -
+      c[8] - c[9] - c[15];
+   t[4] = (int64_t) c[4] + 2 * (int64_t) c[12] + 2 * (int64_t) c[13] + c[14] -
+      c[9] - c[10];
+   t[5] = (int64_t) c[5] + 2 * (int64_t) c[13] + 2 * (int64_t) c[14] + c[15] -
+      c[10] - c[11];
+   t[6] = (int64_t) c[6] + c[13] + 3 * (int64_t) c[14] + 2 * (int64_t) c[15] -
+      c[8] - c[9];
+   t[7] = (int64_t) c[7] + c[8] + 3 * (int64_t) c[15] - c[10] - c[11] -
+      c[12] - c[13];
+
+   //The carry out of the first pass is a small signed value, and the carry
+   //out of the second pass is -1, 0 or 1. Folding it back cannot overflow
+   for(i = 0; i < 2; i++)
+   {
+      carry = ecNistCarry(t, 8);
+
+      //Reduce the carry (2^256 = 2^224 - 2^192 - 2^96 + 1 mod p)
+      t[0] += carry;
+      t[3] -= carry;
+      t[6] -= carry;
+      t[7] += carry;
+   }
+
+   //Normalize the result (0 <= T < 2^256)
+   ecNistCarry(t, 8);
+
+   //Convert the accumulator to 32-bit words
+   for(i = 0; i < 8; i++)
+   {
+      u[i] = (uint32_t) t[i];
+   }
+
+   //Since p > 2^255, a single subtraction is enough
+   ecNistReduceInt(r, u, ecNistP256P, 8);
+}
+
+
+/**
+ * @brief P-256 curve
+ **/
+
+static const EcNistCurve ecNistP256Curve =
+{
+   8,
+   ecNistP256P,
+   ecNistP256Q,
+   ecNistP256Red,
+#if (SECP256R1_COMB_WIDTH != 0)
+   SECP256R1_COMB_WIDTH,
+   ecNistP256Comb
+#else
+   0,
+   NULL
+#endif
+};
+
+#endif
+#if (SECP384R1_SUPPORT == ENABLED)
+
+/**
+ * @brief Fast modular reduction (P-384 curve)
+ * @param[out] r Resulting integer R = C mod p
+ * @param[in] c An integer such as 0 <= C < p^2
+ **/
+
+static void ecNistP384Red(uint32_t *r, const uint32_t *c)
+{
+   uint_t i;
+   int64_t carry;
+   int64_t t[12];
+   uint32_t u[12];
+
+   //Compute T = S1 + 2 * S2 + S3 + S4 + S5 + S6 + S7 - D1 - D2 - D3
+   t[0] = (int64_t) c[0] + c[12] + c[20] + c[21] - c[23];
+   t[1] = (int64_t) c[1] + c[13] + c[22] + c[23] - c[12] - c[20];
+   t[2] = (int64_t) c[2] + c[14] + c[23] - c[13] - c[21];
+   t[3] = (int64_t) c[3] + c[12] + c[15] + c[20] + c[21] - c[14] - c[22] -
+      c[23];
+   t[4] = (int64_t) c[4] + c[12] + c[13] + c[16] + c[20] + 2 * (int64_t) c[21] +
+      c[22] - c[15] - 2 * (int64_t) c[23];
+   t[5] = (int64_t) c[5] + c[13] + c[14] + c[17] + c[21] + 2 * (int64_t) c[22] +
+      c[23] - c[16];
+   t[6] = (int64_t) c[6] + c[14] + c[15] + c[18] + c[22] + 2 * (int64_t) c[23] -
+      c[17];
+   t[7] = (int64_t) c[7] + c[15] + c[16] + c[19] + c[23] - c[18];
+   t[8] = (int64_t) c[8] + c[16] + c[17] + c[20] - c[19];
+   t[9] = (int64_t) c[9] + c[17] + c[18] + c[21] - c[20];
+   t[10] = (int64_t) c[10] + c[18] + c[19] + c[22] - c[21];
+   t[11] = (int64_t) c[11] + c[19] + c[20] + c[23] - c[22];
+
+   //The carry out of the first pass is a small signed value, and the carry
+   //out of the second pass is -1, 0 or 1. Folding it back cannot overflow
+   for(i = 0; i < 2; i++)
+   {
+      carry = ecNistCarry(t, 12);
+
+      //Reduce the carry (2^384 = 2^128 + 2^96 - 2^32 + 1 mod p)
+      t[0] += carry;
+      t[1] -= carry;
+      t[3] += carry;
+      t[4] += carry;
+   }
+
+   //Normalize the result (0 <= T < 2^384)
+   ecNistCarry(t, 12);
+
+   //Convert the accumulator to 32-bit words
+   for(i = 0; i < 12; i++)
+   {
+      u[i] = (uint32_t) t[i];
+   }
+
+   //Since p > 2^383, a single subtraction is enough
+   ecNistReduceInt(r, u, ecNistP384P, 12);
+}
+
+
+/**
+ * @brief P-384 curve
+ **/
+
+static const EcNistCurve ecNistP384Curve =
+{
+   12,
+   ecNistP384P,
+   ecNistP384Q,
+   ecNistP384Red,
+#if (SECP384R1_COMB_WIDTH != 0)
+   SECP384R1_COMB_WIDTH,
+   ecNistP384Comb
+#else
+   0,
+   NULL
+#endif
+};
+
+#endif
+
+
+/**
+ * @brief Retrieve the fixed-width implementation of a curve
+ * @param[in] params EC domain parameters
+ * @return Curve description, or NULL if the curve is not P-256 or P-384
+ **/
+
+const EcNistCurve *ecNistGetCurve(const EcDomainParameters *params)
+{
+   const EcNistCurve *curve;
+
+   //Default value
+   curve = NULL;
+
+#if (SECP256R1_SUPPORT == ENABLED)
+   //P-256 curve?
+   if(params->mod == secp256r1Mod)
+   {
+      curve = &ecNistP256Curve;
+   }
+#endif
+#if (SECP384R1_SUPPORT == ENABLED)
+   //P-384 curve?
+   if(params->mod == secp384r1Mod)
+   {
+      curve = &ecNistP384Curve;
+   }
+#endif
+
+   //Return the curve description
+   return curve;
+}
+
+
+/**
+ * @brief Modular addition
+ * @param[in] curve Curve description
+ * @param[out] r Resulting integer R = (A + B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void ecNistAddMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t c;
+   int64_t temp;
+   uint32_t u[EC_NIST_MAX_WORD_LEN];
+   uint32_t v[EC_NIST_MAX_WORD_LEN];
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Compute U = A + B
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += a[i];
+      temp += b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Save the carry
+   c = (uint32_t) temp;
+
+   //Compute V = U - p
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += u[i];
+      temp -= curve->p[i];
+      v[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //A + B >= p if the addition carries or the subtraction does not borrow
+   c |= (uint32_t) (temp + 1);
+
+   //Select between U and V
+   ecNistSelectInt(r, u, v, c & 1, n);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[in] curve Curve description
+ * @param[out] r Resulting integer R = (A - B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void ecNistSubMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t c;
+   int64_t temp;
+   uint32_t u[EC_NIST_MAX_WORD_LEN];
+   uint32_t v[EC_NIST_MAX_WORD_LEN];
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Compute U = A - B
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += a[i];
+      temp -= b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //The subtraction borrows if A < B
+   c = (uint32_t) temp & 1;
+
+   //Compute V = U + p
+   for(temp = 0, i = 0; i < n; i++)
+   {
+      temp += u[i];
+      temp += curve->p[i];
+      v[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Select between U and V
+   ecNistSelectInt(r, u, v, c, n);
+}
+
+
+/**
+ * @brief Modular multiplication
+ * @param[in] curve Curve description
+ * @param[out] r Resulting integer R = (A * B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void ecNistMulMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   uint64_t c;
+   uint64_t temp;
+   uint32_t u[2 * EC_NIST_MAX_WORD_LEN];
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Initialize variables
+   temp = 0;
+   c = 0;
+
+   //Comba's method is used to perform multiplication
+   for(i = 0; i < 2 * n; i++)
+   {
+      //The algorithm computes the products, column by column
+      for(j = (i < n) ? 0 : i - n + 1; j <= i && j < n; j++)
+      {
+         temp += (uint64_t) a[j] * b[i - j];
+         c += temp >> 32;
+         temp &= 0xFFFFFFFF;
+      }
+
+      //At the bottom of each column, the final result is written to memory
+      u[i] = temp & 0xFFFFFFFF;
+
+      //Propagate the carry upwards
+      temp = c & 0xFFFFFFFF;
+      c >>= 32;
+   }
+
+   //Perform fast modular reduction
+   curve->red(r, u);
+}
+
+
+/**
+ * @brief Modular squaring
+ * @param[in] curve Curve description
+ * @param[out] r Resulting integer R = (A ^ 2) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void ecNistSqrMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a)
+{
+   //Compute R = (A ^ 2) mod p
+   ecNistMulMod(curve, r, a, a);
+}
+
+
+/**
+ * @brief Modular multiplicative inverse
+ * @param[in] curve Curve description
+ * @param[out] r Resulting integer R = A^-1 mod p
+ * @param[in] a An integer such as 0 < A < p
+ **/
+
+void ecNistInvMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a)
+{
+   int_t i;
+   uint_t n;
+   uint32_t e[EC_NIST_MAX_WORD_LEN];
+   uint32_t u[EC_NIST_MAX_WORD_LEN];
+   uint32_t v[EC_NIST_MAX_WORD_LEN];
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Since p is prime, A^-1 = A^(p - 2) mod p. The least significant word of
+   //p is 0xFFFFFFFF for both curves, so the subtraction does not borrow
+   osMemcpy(e, curve->p, n * sizeof(uint32_t));
+   e[0] -= 2;
+
+   //The most significant bit of the exponent is set
+   osMemcpy(u, a, n * sizeof(uint32_t));
+   osMemcpy(v, a, n * sizeof(uint32_t));
+
+   //Left-to-right binary method. The exponent is public
+   for(i = 32 * n - 2; i >= 0; i--)
+   {
+      ecNistSqrMod(curve, v, v);
+
+      //Check the value of the current bit
+      if((e[i / 32] >> (i % 32)) & 1)
+      {
+         ecNistMulMod(curve, v, v, u);
+      }
+   }
+
+   //Copy the resulting value
+   osMemcpy(r, v, n * sizeof(uint32_t));
+}
+
+
+/**
+ * @brief Point doubling (a = -3)
+ * @param[in] curve Curve description
+ * @param[out] r Resulting point R = 2S
+ * @param[in] s Point S
+ **/
+
+void ecNistDouble(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s)
+{
+   uint32_t alpha[EC_NIST_MAX_WORD_LEN];
+   uint32_t beta[EC_NIST_MAX_WORD_LEN];
+   uint32_t gamma[EC_NIST_MAX_WORD_LEN];
+   uint32_t delta[EC_NIST_MAX_WORD_LEN];
+   uint32_t t1[EC_NIST_MAX_WORD_LEN];
+   uint32_t t2[EC_NIST_MAX_WORD_LEN];
+
+   //Compute delta = Sz^2
+   ecNistSqrMod(curve, delta, s->z);
+   //Compute gamma = Sy^2
+   ecNistSqrMod(curve, gamma, s->y);
+   //Compute beta = Sx * gamma
+   ecNistMulMod(curve, beta, s->x, gamma);
+
+   //Compute alpha = 3 * (Sx - delta) * (Sx + delta)
+   ecNistSubMod(curve, t1, s->x, delta);
+   ecNistAddMod(curve, t2, s->x, delta);
+   ecNistMulMod(curve, alpha, t1, t2);
+   ecNistAddMod(curve, t1, alpha, alpha);
+   ecNistAddMod(curve, alpha, t1, alpha);
+
+   //Compute Rz = (Sy + Sz)^2 - gamma - delta. The point at the infinity
+   //(Sz = 0) is mapped to itself
+   ecNistAddMod(curve, t1, s->y, s->z);
+   ecNistSqrMod(curve, t1, t1);
+   ecNistSubMod(curve, t1, t1, gamma);
+   ecNistSubMod(curve, r->z, t1, delta);
+
+   //Compute Rx = alpha^2 - 8 * beta
+   ecNistAddMod(curve, beta, beta, beta);
+   ecNistAddMod(curve, beta, beta, beta);
+   ecNistSqrMod(curve, t1, alpha);
+   ecNistSubMod(curve, t1, t1, beta);
+   ecNistSubMod(curve, r->x, t1, beta);
+
+   //Compute Ry = alpha * (4 * beta - Rx) - 8 * gamma^2
+   ecNistSubMod(curve, t1, beta, r->x);
+   ecNistMulMod(curve, t1, alpha, t1);
+   ecNistSqrMod(curve, t2, gamma);
+   ecNistAddMod(curve, t2, t2, t2);
+   ecNistAddMod(curve, t2, t2, t2);
+   ecNistAddMod(curve, t2, t2, t2);
+   ecNistSubMod(curve, r->y, t1, t2);
+}
+
+
+/**
+ * @brief Point addition
+ *
+ * The points at the infinity are handled with constant-time selections. The
+ * doubling case (S = T) takes a different path, but it cannot occur in the
+ * Montgomery ladder, where the two points always differ by the input point,
+ * and the comb only hits it for a negligible fraction of the scalars
+ *
+ * @param[in] curve Curve description
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand
+ **/
+
+void ecNistAdd(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s, const EcNistPoint *t)
+{
+   uint_t n;
+   uint32_t c1;
+   uint32_t c2;
+   uint32_t z1z1[EC_NIST_MAX_WORD_LEN];
+   uint32_t z2z2[EC_NIST_MAX_WORD_LEN];
+   uint32_t u1[EC_NIST_MAX_WORD_LEN];
+   uint32_t u2[EC_NIST_MAX_WORD_LEN];
+   uint32_t s1[EC_NIST_MAX_WORD_LEN];
+   uint32_t s2[EC_NIST_MAX_WORD_LEN];
+   uint32_t h[EC_NIST_MAX_WORD_LEN];
+   uint32_t v[EC_NIST_MAX_WORD_LEN];
+   EcNistPoint u;
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Check whether S or T is the point at the infinity
+   c1 = ecNistIsZeroInt(s->z, n);
+   c2 = ecNistIsZeroInt(t->z, n);
+
+   //Compute U1 = Sx * Tz^2 and U2 = Tx * Sz^2
+   ecNistSqrMod(curve, z1z1, s->z);
+   ecNistSqrMod(curve, z2z2, t->z);
+   ecNistMulMod(curve, u1, s->x, z2z2);
+   ecNistMulMod(curve, u2, t->x, z1z1);
+
+   //Compute S1 = Sy * Tz^3 and S2 = Ty * Sz^3
+   ecNistMulMod(curve, s1, t->z, z2z2);
+   ecNistMulMod(curve, s1, s->y, s1);
+   ecNistMulMod(curve, s2, s->z, z1z1);
+   ecNistMulMod(curve, s2, t->y, s2);
+
+   //Compute H = U2 - U1 and r = 2 * (S2 - S1)
+   ecNistSubMod(curve, h, u2, u1);
+   ecNistSubMod(curve, s2, s2, s1);
+   ecNistAddMod(curve, s2, s2, s2);
+
+   //S = T?
+   if(ecNistIsZeroInt(h, n) && ecNistIsZeroInt(s2, n) && !c1 && !c2)
+   {
+      //Compute R = 2S
+      ecNistDouble(curve, r, s);
+   }
+   else
+   {
+      //Compute Uz = ((Sz + Tz)^2 - Sz^2 - Tz^2) * H
+      ecNistAddMod(curve, u.z, s->z, t->z);
+      ecNistSqrMod(curve, u.z, u.z);
+      ecNistSubMod(curve, u.z, u.z, z1z1);
+      ecNistSubMod(curve, u.z, u.z, z2z2);
+      ecNistMulMod(curve, u.z, u.z, h);
+
+      //Compute I = (2 * H)^2, J = H * I and V = U1 * I
+      ecNistAddMod(curve, v, h, h);
+      ecNistSqrMod(curve, v, v);
+      ecNistMulMod(curve, h, h, v);
+      ecNistMulMod(curve, u1, u1, v);
+
+      //Compute Ux = r^2 - J - 2 * V
+      ecNistSqrMod(curve, u.x, s2);
+      ecNistSubMod(curve, u.x, u.x, h);
+      ecNistSubMod(curve, u.x, u.x, u1);
+      ecNistSubMod(curve, u.x, u.x, u1);
+
+      //Compute Uy = r * (V - Ux) - 2 * S1 * J
+      ecNistSubMod(curve, u.y, u1, u.x);
+      ecNistMulMod(curve, u.y, s2, u.y);
+      ecNistMulMod(curve, s1, s1, h);
+      ecNistAddMod(curve, s1, s1, s1);
+      ecNistSubMod(curve, u.y, u.y, s1);
+
+      //If S is the point at the infinity, then R = T
+      ecNistSelectInt(u.x, u.x, t->x, c1, n);
+      ecNistSelectInt(u.y, u.y, t->y, c1, n);
+      ecNistSelectInt(u.z, u.z, t->z, c1, n);
+
+      //If T is the point at the infinity, then R = S
+      ecNistSelectInt(r->x, u.x, s->x, c2, n);
+      ecNistSelectInt(r->y, u.y, s->y, c2, n);
+      ecNistSelectInt(r->z, u.z, s->z, c2, n);
+   }
+}
+
+
+/**
+ * @brief Load an integer
+ * @param[in] curve Curve description
+ * @param[out] r Fixed-width representation of the integer
+ * @param[in] a Multiple precision integer such as 0 <= A < 2^(32 * n)
+ * @return Error code
+ **/
+
+static error_list ecNistImportInt(const EcNistCurve *curve, uint32_t *r,
+   const Mpi *a)
+{
+   error_list error;
+   uint_t i;
+   uint8_t data[EC_NIST_MAX_WORD_LEN * 4];
+
+   //Convert the integer to an octet string
+   error = mpiExport(a, data, curve->wordLen * 4, MPI_FORMAT_LITTLE_ENDIAN);
+
+   //Check status code
+   if(!error)
+   {
+      //Convert the octet string to 32-bit words
+      for(i = 0; i < curve->wordLen; i++)
+      {
+         r[i] = LOAD32LE(data + i * 4);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Store an integer
+ * @param[in] curve Curve description
+ * @param[out] r Multiple precision integer
+ * @param[in] a Fixed-width representation of the integer
+ * @return Error code
+ **/
+
+static error_list ecNistExportInt(const EcNistCurve *curve, Mpi *r,
+   const uint32_t *a)
+{
+   uint_t i;
+   uint8_t data[EC_NIST_MAX_WORD_LEN * 4];
+
+   //Convert the 32-bit words to an octet string
+   for(i = 0; i < curve->wordLen; i++)
+   {
+      STORE32LE(a[i], data + i * 4);
+   }
+
+   //Convert the octet string to a multiple precision integer
+   return mpiImport(r, data, curve->wordLen * 4, MPI_FORMAT_LITTLE_ENDIAN);
+}
+
+
+/**
+ * @brief Load a point given in Jacobian coordinates
+ * @param[in] curve Curve description
+ * @param[out] r Fixed-width representation of the point
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+static error_list ecNistImportPoint(const EcNistCurve *curve, EcNistPoint *r,
+   const EcPoint *s)
+{
+   error_list error;
+
+   //Load the coordinates of the point
+   error = ecNistImportInt(curve, r->x, &s->x);
+
+   if(!error)
+   {
+      error = ecNistImportInt(curve, r->y, &s->y);
+   }
+
+   if(!error)
+   {
+      error = ecNistImportInt(curve, r->z, &s->z);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Make sure the coordinates are reduced modulo p
+      ecNistReduceInt(r->x, r->x, curve->p, curve->wordLen);
+      ecNistReduceInt(r->y, r->y, curve->p, curve->wordLen);
+      ecNistReduceInt(r->z, r->z, curve->p, curve->wordLen);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Store a point in affine coordinates
+ * @param[in] curve Curve description
+ * @param[out] r EC point
+ * @param[in] s Fixed-width representation of the point
+ * @return Error code
+ **/
+
+static error_list ecNistExportPoint(const EcNistCurve *curve, EcPoint *r,
+   const EcNistPoint *s)
+{
+   error_list error;
+   uint32_t a[EC_NIST_MAX_WORD_LEN];
+   uint32_t b[EC_NIST_MAX_WORD_LEN];
+   uint32_t c[EC_NIST_MAX_WORD_LEN];
+
+   //Point at the infinity?
+   if(ecNistIsZeroInt(s->z, curve->wordLen))
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Compute a = 1 / Sz
+      ecNistInvMod(curve, a, s->z);
+
+      //Compute Rx = Sx / Sz^2
+      ecNistSqrMod(curve, b, a);
+      ecNistMulMod(curve, c, s->x, b);
+      EC_CHECK(ecNistExportInt(curve, &r->x, c));
+
+      //Compute Ry = Sy / Sz^3
+      ecNistMulMod(curve, b, b, a);
+      ecNistMulMod(curve, c, s->y, b);
+      EC_CHECK(ecNistExportInt(curve, &r->y, c));
+
+      //Set Rz = 1
+      MPI_CHECK(mpiSetValue(&r->z, 1));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Load a scalar and reduce it modulo q
+ * @param[in] curve Curve description
+ * @param[out] r Fixed-width representation of the scalar
+ * @param[in] d An integer such as 0 <= d < p
+ * @return Error code
+ **/
+
+static error_list ecNistImportScalar(const EcNistCurve *curve, uint32_t *r,
+   const Mpi *d)
+{
+   error_list error;
+
+   //Load the scalar
+   error = ecNistImportInt(curve, r, d);
+
+   //Check status code
+   if(!error)
+   {
+      //Since p < 2q, a single subtraction is enough
+      ecNistReduceInt(r, r, curve->q, curve->wordLen);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Base point multiplication using the comb table (constant-time)
+ *
+ * The scalar is split in w rows of d bits. Column i selects the table entry
+ * whose index is made of bits i, i + d, ..., i + (w - 1) * d, so that the
+ * whole multiplication costs d doublings and d additions. Every entry of
+ * the table is read at each step, whatever the value of the scalar
+ *
+ * @param[in] curve Curve description
+ * @param[out] r Resulting point R = k.G
+ * @param[in] k An integer k such as 0 <= k < q
+ **/
+
+static void ecNistCombMult(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *k)
+{
+   int_t i;
+   uint_t j;
+   uint_t n;
+   uint_t b;
+   uint_t d;
+   uint32_t c;
+   uint32_t m;
+   const uint32_t *t;
+   EcNistPoint u;
+
+   //Length of field elements
+   n = curve->wordLen;
+   //Number of columns
+   d = EC_COMB_COLUMNS(32 * n, curve->combWidth);
+
+   //Set R = (1, 1, 0)
+   osMemset(r, 0, sizeof(EcNistPoint));
+   r->x[0] = 1;
+   r->y[0] = 1;
+
+   //Process the columns from left to right
+   for(i = d - 1; i >= 0; i--)
+   {
+      //Compute R = 2R
+      ecNistDouble(curve, r, r);
+
+      //Gather the bits of the current column
+      for(m = 0, j = 0; j < curve->combWidth; j++)
+      {
+         b = i + j * d;
+
+         if(b < 32 * n)
+         {
+            m |= ((k[b / 32] >> (b % 32)) & 1) << j;
+         }
+      }
+
+      //Load the point at the infinity when the index is zero
+      osMemset(&u, 0, sizeof(EcNistPoint));
+      u.z[0] = (0 - m) >> 31;
+
+      //Constant-time table lookup
+      for(t = curve->comb, j = 1; j < (1U << curve->combWidth); j++)
+      {
+         //Check whether the current entry matches the index
+         c = ((j ^ m) - 1) >> 31;
+
+         //Select the affine coordinates of the entry
+         ecNistSelectInt(u.x, u.x, t, c, n);
+         ecNistSelectInt(u.y, u.y, t + n, c, n);
+
+         //Next entry
+         t += 2 * n;
+      }
+
+      //Compute R = R + T[m - 1]
+      ecNistAdd(curve, r, r, &u);
+   }
+}
+
+
+/**
+ * @brief Scalar multiplication (constant-time)
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.S, in affine coordinates
+ * @param[in] d An integer d such as 0 <= d < p
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_list ecNistMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d, const EcPoint *s)
+{
+   error_list error;
+   int_t i;
+   uint_t j;
+   uint_t n;
+   uint32_t b;
+   uint64_t temp;
+   uint32_t k[EC_NIST_MAX_WORD_LEN + 1];
+   uint32_t u[EC_NIST_MAX_WORD_LEN + 1];
+   EcNistPoint r0;
+   EcNistPoint r1;
+   const EcNistCurve *curve;
+
+   //Retrieve the fixed-width implementation of the curve
+   curve = ecNistGetCurve(params);
+   //Unsupported curve?
+   if(curve == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Load the scalar (0 <= k < q)
+   EC_CHECK(ecNistImportScalar(curve, k, d));
+
+   //Multiplication of the base point?
+   if(curve->comb != NULL && mpiComp(&s->x, &params->g.x) == 0 &&
+      mpiComp(&s->y, &params->g.y) == 0 && mpiCompInt(&s->z, 1) == 0)
+   {
+      //Use the precomputed comb table
+      ecNistCombMult(curve, &r0, k);
+      //Convert the result to affine coordinates
+      EC_CHECK(ecNistExportPoint(curve, r, &r0));
+      //We are done
+      goto end;
+   }
+
+   //Compute K = k + q
+   for(temp = 0, j = 0; j < n; j++)
+   {
+      temp += (uint64_t) k[j] + curve->q[j];
+      k[j] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   k[n] = (uint32_t) temp;
+
+   //Compute U = K + q
+   for(temp = 0, j = 0; j < n; j++)
+   {
+      temp += (uint64_t) k[j] + curve->q[j];
+      u[j] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   u[n] = (uint32_t) temp + k[n];
+
+   //Keep the value whose bit 32n is set, so that the ladder always runs over
+   //the same number of bits whatever the scalar
+   ecNistSelectInt(k, k, u, k[n] ^ 1, n + 1);
+
+   //Set R0 = S and R1 = 2S
+   EC_CHECK(ecNistImportPoint(curve, &r0, s));
+   ecNistDouble(curve, &r1, &r0);
+
+   //Montgomery ladder
+   for(i = 32 * n - 1; i >= 0; i--)
+   {
+      //Retrieve the current bit of the scalar
+      b = (k[i / 32] >> (i % 32)) & 1;
+
+      //Compute R1 = R0 + R1 and R0 = 2 * R0 if the bit is 0, or
+      //R0 = R0 + R1 and R1 = 2 * R1 if the bit is 1
+      ecNistSwapInt(r0.x, r1.x, b, n);
+      ecNistSwapInt(r0.y, r1.y, b, n);
+      ecNistSwapInt(r0.z, r1.z, b, n);
+      ecNistAdd(curve, &r1, &r0, &r1);
+      ecNistDouble(curve, &r0, &r0);
+      ecNistSwapInt(r0.x, r1.x, b, n);
+      ecNistSwapInt(r0.y, r1.y, b, n);
+      ecNistSwapInt(r0.z, r1.z, b, n);
+   }
+
+   //Convert R0 to affine coordinates
+   EC_CHECK(ecNistExportPoint(curve, r, &r0));
+
+end:
+   //Erase the scalar
+   osMemset(k, 0, sizeof(k));
+   osMemset(u, 0, sizeof(u));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Twin multiplication
+ *
+ * The scalars are public (ECDSA signature verification), so that the
+ * simultaneous left-to-right binary method is used
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d0.S + d1.T, in affine coordinates
+ * @param[in] d0 An integer d such as 0 <= d0 < p
+ * @param[in] s EC point
+ * @param[in] d1 An integer d such as 0 <= d1 < p
+ * @param[in] t EC point
+ * @return Error code
+ **/
+
+error_list ecNistTwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t)
+{
+   error_list error;
+   int_t i;
+   uint_t n;
+   uint32_t b0;
+   uint32_t b1;
+   uint32_t k0[EC_NIST_MAX_WORD_LEN];
+   uint32_t k1[EC_NIST_MAX_WORD_LEN];
+   EcNistPoint a[3];
+   EcNistPoint u;
+   const EcNistCurve *curve;
+
+   //Retrieve the fixed-width implementation of the curve
+   curve = ecNistGetCurve(params);
+   //Unsupported curve?
+   if(curve == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Length of field elements
+   n = curve->wordLen;
+
+   //Load the scalars
+   EC_CHECK(ecNistImportScalar(curve, k0, d0));
+   EC_CHECK(ecNistImportScalar(curve, k1, d1));
+
+   //Precompute S, T and S + T
+   EC_CHECK(ecNistImportPoint(curve, &a[0], s));
+   EC_CHECK(ecNistImportPoint(curve, &a[1], t));
+   ecNistAdd(curve, &a[2], &a[0], &a[1]);
+
+   //Set U = (1, 1, 0)
+   osMemset(&u, 0, sizeof(EcNistPoint));
+   u.x[0] = 1;
+   u.y[0] = 1;
+
+   //Skip the leading zero bits
+   for(i = 32 * n - 1; i >= 0; i--)
+   {
+      if(((k0[i / 32] | k1[i / 32]) >> (i % 32)) & 1)
+         break;
+   }
+
+   //Simultaneous left-to-right binary method
+   for(; i >= 0; i--)
+   {
+      //Point doubling
+      ecNistDouble(curve, &u, &u);
+
+      //Retrieve the current bit of each scalar
+      b0 = (k0[i / 32] >> (i % 32)) & 1;
+      b1 = (k1[i / 32] >> (i % 32)) & 1;
+
+      //Add S, T or S + T
+      if(b0 || b1)
+      {
+         ecNistAdd(curve, &u, &u, &a[b0 + 2 * b1 - 1]);
+      }
+   }
+
+   //Convert U to affine coordinates
+   EC_CHECK(ecNistExportPoint(curve, r, &u));
+
+end:
+   //Return status code
+   return error;
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file ec_nist.h
+ * @brief NIST P-256 and P-384 curves (fixed-width, constant-time implementation)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _EC_NIST_H
+#define _EC_NIST_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//Fixed-width arithmetic for NIST P-256 and P-384
+#ifndef EC_NIST_FAST_SUPPORT
+   #define EC_NIST_FAST_SUPPORT ENABLED
+#elif (EC_NIST_FAST_SUPPORT != ENABLED && EC_NIST_FAST_SUPPORT != DISABLED)
+   #error EC_NIST_FAST_SUPPORT parameter is not valid
+#endif
+
+//Maximum length of field elements, in 32-bit words
+#define EC_NIST_MAX_WORD_LEN 12
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Solinas reduction of a double-length integer
+ **/
+
+typedef void (*EcNistRedAlgo)(uint32_t *r, const uint32_t *a);
+
+
+/**
+ * @brief Fixed-width description of a NIST curve
+ **/
+
+typedef struct
+{
+   uint_t wordLen;    ///<Length of field elements, in 32-bit words
+   const uint32_t *p; ///<Prime modulus
+   const uint32_t *q; ///<Order of the base point
+   EcNistRedAlgo red; ///<Solinas reduction
+   uint_t combWidth;  ///<Number of teeth of the base point comb
+   const uint32_t *comb; ///<Base point comb table (NULL if disabled)
+} EcNistCurve;
+
+
+/**
+ * @brief EC point in Jacobian coordinates
+ **/
+
+typedef struct
+{
+   uint32_t x[EC_NIST_MAX_WORD_LEN]; ///<x-coordinate
+   uint32_t y[EC_NIST_MAX_WORD_LEN]; ///<y-coordinate
+   uint32_t z[EC_NIST_MAX_WORD_LEN]; ///<z-coordinate
+} EcNistPoint;
+
+
+//NIST curves related functions
+const EcNistCurve *ecNistGetCurve(const EcDomainParameters *params);
+
+void ecNistAddMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b);
+
+void ecNistSubMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b);
+
+void ecNistMulMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a,
+   const uint32_t *b);
+
+void ecNistSqrMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a);
+void ecNistInvMod(const EcNistCurve *curve, uint32_t *r, const uint32_t *a);
+
+void ecNistDouble(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s);
+
+void ecNistAdd(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s, const EcNistPoint *t);
+
+error_list ecNistMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d, const EcPoint *s);
+
+error_list ecNistTwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
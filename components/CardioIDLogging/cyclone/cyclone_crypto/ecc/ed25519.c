@@ -36,11 +36,14 @@
 #include "ecc/ec_curves.h"
 #include "ecc/curve25519.h"
 #include "ecc/ed25519.h"
+#include "ecc/ec_comb_tables.h"
 #include "debug.h"
 
 //Check crypto library configuration
 #if (ED25519_SUPPORT == ENABLED)
 
+#if (ED25519_COMB_WIDTH == 0)
+
 //Base point B
 static const Ed25519Point ED25519_B =
 {
@@ -62,6 +65,8 @@ static const Ed25519Point ED25519_B =
    }
 };
 
+#endif
+
 //Zero (constant)
 static const uint32_t ED25519_ZERO[8] =
 {
@@ -197,7 +202,7 @@ error_list ed25519GeneratePublicKey(const uint8_t *privateKey, uint8_t *publicKe
    s[31] |= 0x40;
 
    //Perform a fixed-base scalar multiplication s * B
-   ed25519Mul(state, &state->sb, s, &ED25519_B);
+   ed25519MulBase(state, &state->sb, s);
    //The public key A is the encoding of the point s * B
    ed25519Encode(&state->sb, publicKey);
 
@@ -301,7 +306,7 @@ error_list ed25519GenerateSignatureEx(const uint8_t *privateKey,
    if(publicKey == NULL)
    {
       //Perform a fixed-base scalar multiplication s * B
-      ed25519Mul(state, &state->sb, state->s, &ED25519_B);
+      ed25519MulBase(state, &state->sb, state->s);
       //The public key A is the encoding of the point s * B
       ed25519Encode(&state->sb, state->k);
       //Point to the resulting public key
@@ -342,7 +347,7 @@ error_list ed25519GenerateSignatureEx(const uint8_t *privateKey,
    //Reduce the 64-octet digest as a little-endian integer r
    ed25519RedInt(state->r, state->sha512Context.digest);
    //Compute the point r * B
-   ed25519Mul(state, &state->rb, state->r, &ED25519_B);
+   ed25519MulBase(state, &state->rb, state->r);
    //Let the string R be the encoding of this point
    ed25519Encode(&state->rb, signature);
 
@@ -516,7 +521,7 @@ error_list ed25519VerifySignatureEx(const uint8_t *publicKey,
    //Compute the point P = s * B - k * A'
    curve25519Sub(state->ka.x, ED25519_ZERO, state->ka.x);
    curve25519Sub(state->ka.t, ED25519_ZERO, state->ka.t);
-   ed25519Mul(state, &state->sb, state->s, &ED25519_B);
+   ed25519MulBase(state, &state->sb, state->s);
    ed25519Mul(state, &state->ka, state->k, &state->ka);
    ed25519Add(state, &state->ka, &state->sb, &state->ka);
 
@@ -583,6 +588,93 @@ void ed25519Mul(Ed25519State *state, Ed25519Point *r, const uint8_t *k,
 }
 
 
+/**
+ * @brief Scalar multiplication of the base point
+ *
+ * The scalar is split in w rows of d bits. Column i selects the table entry
+ * whose index is made of bits i, i + d, ..., i + (w - 1) * d, so that the
+ * whole multiplication costs d doublings and d additions. Every entry of
+ * the table is read at each step, whatever the value of the scalar
+ *
+ * @param[in] state Pointer to the working state
+ * @param[out] r Resulting point R = k * B
+ * @param[in] k Input scalar
+ **/
+
+void ed25519MulBase(Ed25519State *state, Ed25519Point *r, const uint8_t *k)
+{
+#if (ED25519_COMB_WIDTH != 0)
+   int_t i;
+   uint_t j;
+   uint_t b;
+   uint_t d;
+   uint32_t c;
+   uint32_t m;
+   const uint32_t *t;
+
+   //Number of columns
+   d = EC_COMB_COLUMNS(CURVE25519_BIT_LEN, ED25519_COMB_WIDTH);
+
+   //The neutral element is represented by (0, 1, 1, 0)
+   curve25519SetInt(state->u.x, 0);
+   curve25519SetInt(state->u.y, 1);
+   curve25519SetInt(state->u.z, 1);
+   curve25519SetInt(state->u.t, 0);
+
+   //Process the columns from left to right
+   for(i = d - 1; i >= 0; i--)
+   {
+      //Compute U = 2 * U
+      ed25519Double(state, &state->u, &state->u);
+
+      //Gather the bits of the current column
+      for(m = 0, j = 0; j < ED25519_COMB_WIDTH; j++)
+      {
+         b = i + j * d;
+
+         if(b < CURVE25519_BIT_LEN)
+         {
+            m |= ((k[b / 8] >> (b % 8)) & 1) << j;
+         }
+      }
+
+      //Load the neutral element when the index is zero
+      curve25519SetInt(state->v.x, 0);
+      curve25519SetInt(state->v.y, 1);
+      curve25519SetInt(state->v.z, 1);
+      curve25519SetInt(state->v.t, 0);
+
+      //Constant-time table lookup
+      for(t = ed25519Comb, j = 1; j < (1U << ED25519_COMB_WIDTH); j++)
+      {
+         //Check whether the current entry matches the index
+         c = ((j ^ m) - 1) >> 31;
+
+         //Select the extended coordinates of the entry
+         curve25519Select(state->v.x, state->v.x, t, c);
+         curve25519Select(state->v.y, state->v.y, t + 8, c);
+         curve25519Select(state->v.t, state->v.t, t + 16, c);
+
+         //Next entry
+         t += 24;
+      }
+
+      //Compute U = U + T[m - 1]
+      ed25519Add(state, &state->u, &state->u, &state->v);
+   }
+
+   //Copy result
+   curve25519Copy(r->x, state->u.x);
+   curve25519Copy(r->y, state->u.y);
+   curve25519Copy(r->z, state->u.z);
+   curve25519Copy(r->t, state->u.t);
+#else
+   //Fall back to the generic scalar multiplication
+   ed25519Mul(state, r, k, &ED25519_B);
+#endif
+}
+
+
 /**
  * @brief Point addition
  * @param[in] state Pointer to the working state
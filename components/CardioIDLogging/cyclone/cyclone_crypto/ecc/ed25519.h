@@ -122,6 +122,8 @@ error_list ed25519VerifySignatureEx(const uint8_t *publicKey,
 void ed25519Mul(Ed25519State *state, Ed25519Point *r, const uint8_t *k,
    const Ed25519Point *p);
 
+void ed25519MulBase(Ed25519State *state, Ed25519Point *r, const uint8_t *k);
+
 void ed25519Add(Ed25519State *state, Ed25519Point *r, const Ed25519Point *p,
    const Ed25519Point *q);
 
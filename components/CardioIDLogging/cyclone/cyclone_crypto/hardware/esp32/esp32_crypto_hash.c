@@ -300,23 +300,22 @@ error_list sha1Compute(const void *data, size_t length, uint8_t *digest)
 #if (SHA256_SUPPORT == ENABLED)
 
 /**
- * @brief Digest a message using SHA-256
+ * @brief Digest a message using the SHA-256 engine
+ *
+ * The caller must hold exclusive access to the SHA module
+ *
  * @param[in] data Pointer to the message being hashed
  * @param[in] length Length of the message
  * @param[out] digest Pointer to the calculated digest
- * @return Error code
  **/
 
-error_list sha256Compute(const void *data, size_t length, uint8_t *digest)
+static void esp32Sha256Digest(const void *data, size_t length, uint8_t *digest)
 {
    bool_t first;
    size_t n;
    uint32_t temp;
    uint8_t buffer[64];
 
-   //Acquire exclusive access to the SHA module
-   osAcquireMutex(&esp32CryptoMutex);
-
    //Process the first message block
    first = TRUE;
 
@@ -376,6 +375,64 @@ error_list sha256Compute(const void *data, size_t length, uint8_t *digest)
    temp = DPORT_SEQUENCE_REG_READ(SHA_TEXT_BASE + 28);
    STORE32BE(temp, digest + 28);
    DPORT_INTERRUPT_RESTORE();
+}
+
+
+/**
+ * @brief Digest a message using SHA-256
+ * @param[in] data Pointer to the message being hashed
+ * @param[in] length Length of the message
+ * @param[out] digest Pointer to the calculated digest
+ * @return Error code
+ **/
+
+error_list sha256Compute(const void *data, size_t length, uint8_t *digest)
+{
+   //Acquire exclusive access to the SHA module
+   osAcquireMutex(&esp32CryptoMutex);
+
+   //Digest the message
+   esp32Sha256Digest(data, length, digest);
+
+   //Release exclusive access to the SHA module
+   osReleaseMutex(&esp32CryptoMutex);
+
+   //Sucessful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Digest several independent messages using SHA-256
+ *
+ * The SHA engine cannot save and restore an intermediate state, so the
+ * messages are hashed one after the other. The module is acquired only once
+ * for the whole batch
+ *
+ * @param[in] data Pointers to the messages being hashed
+ * @param[in] length Length of each message
+ * @param[in] count Number of messages
+ * @param[out] digests Calculated digests, stored one after the other
+ * @return Error code
+ **/
+
+error_list sha256ComputeMulti(const void *const data[],
+   const size_t length[], uint_t count, uint8_t *digests)
+{
+   uint_t i;
+
+   //Check parameters
+   if((data == NULL || length == NULL || digests == NULL) && count > 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SHA module
+   osAcquireMutex(&esp32CryptoMutex);
+
+   //Digest the messages
+   for(i = 0; i < count; i++)
+   {
+      esp32Sha256Digest(data[i], length[i], digests + i * SHA256_DIGEST_SIZE);
+   }
 
    //Release exclusive access to the SHA module
    osReleaseMutex(&esp32CryptoMutex);
@@ -190,6 +190,141 @@ error_list mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
 }
 
 
+/**
+ * @brief Modular exponentiation on the RSA accelerator
+ * @param[out] r Resulting integer R = X ^ E mod P
+ * @param[in] x Operand X such as 0 <= X < P
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @param[in] r2 Precomputed value of R^2 mod P, with R = 2^(32 * n)
+ * @param[in] n Length of the operands, in 32-bit words (multiple of 16)
+ * @return Error code
+ **/
+
+static error_list esp32RsaExpMod(Mpi *r, const Mpi *x, const Mpi *e,
+   const Mpi *p, const Mpi *r2, size_t n)
+{
+   error_list error;
+   size_t i;
+   uint32_t m;
+
+   //Acquire exclusive access to the RSA module
+   osAcquireMutex(&esp32CryptoMutex);
+
+   //Clear the interrupt flag
+   DPORT_REG_WRITE(RSA_INTERRUPT_REG, 1);
+   //Set mode register
+   DPORT_REG_WRITE(RSA_MODEXP_MODE_REG, (n / 16) - 1);
+
+   //Copy the operand to RSA_X_MEM
+   for(i = 0; i < n; i++)
+   {
+      if(i < x->size)
+      {
+         DPORT_REG_WRITE(RSA_MEM_X_BLOCK_BASE + i * 4, x->data[i]);
+      }
+      else
+      {
+         DPORT_REG_WRITE(RSA_MEM_X_BLOCK_BASE + i * 4, 0);
+      }
+   }
+
+   //Copy the exponent to RSA_Y_MEM
+   for(i = 0; i < n; i++)
+   {
+      if(i < e->size)
+      {
+         DPORT_REG_WRITE(RSA_MEM_Y_BLOCK_BASE + i * 4, e->data[i]);
+      }
+      else
+      {
+         DPORT_REG_WRITE(RSA_MEM_Y_BLOCK_BASE + i * 4, 0);
+      }
+   }
+
+   //Copy the modulus to RSA_M_MEM
+   for(i = 0; i < n; i++)
+   {
+      if(i < p->size)
+      {
+         DPORT_REG_WRITE(RSA_MEM_M_BLOCK_BASE + i * 4, p->data[i]);
+      }
+      else
+      {
+         DPORT_REG_WRITE(RSA_MEM_M_BLOCK_BASE + i * 4, 0);
+      }
+   }
+
+   //Copy the pre-calculated value of R^2 mod M to RSA_Z_MEM
+   for(i = 0; i < n; i++)
+   {
+      if(i < r2->size)
+      {
+         DPORT_REG_WRITE(RSA_MEM_RB_BLOCK_BASE + i * 4, r2->data[i]);
+      }
+      else
+      {
+         DPORT_REG_WRITE(RSA_MEM_RB_BLOCK_BASE + i * 4, 0);
+      }
+   }
+
+   //Use Newton's method to compute the inverse of M[0] mod 2^32
+   for(m = 2 - p->data[0], i = 0; i < 4; i++)
+   {
+      m = m * (2 - m * p->data[0]);
+   }
+
+   //Precompute M' = -1/M[0] mod 2^32;
+   m = ~m + 1;
+
+   //Write the value of M' to RSA_M_PRIME_REG
+   DPORT_REG_WRITE(RSA_M_DASH_REG, m);
+
+   //Start modular exponentiation
+   DPORT_REG_WRITE(RSA_MODEXP_START_REG, 1);
+
+   //Wait for the operation to complete
+   while(DPORT_REG_READ(RSA_INTERRUPT_REG) == 0)
+   {
+   }
+
+   //Adjust the size of the result if necessary
+   error = mpiGrow(r, n);
+
+   //Check status code
+   if(!error)
+   {
+      //Disable interrupts only on current CPU
+      DPORT_INTERRUPT_DISABLE();
+
+      //Read the result from RSA_Z_MEM
+      for(i = 0; i < r->size; i++)
+      {
+         if(i < n)
+         {
+            r->data[i] = DPORT_SEQUENCE_REG_READ(RSA_MEM_Z_BLOCK_BASE + i * 4);
+         }
+         else
+         {
+            r->data[i] = 0;
+         }
+      }
+
+      //Restore the previous interrupt level
+      DPORT_INTERRUPT_RESTORE();
+   }
+
+   //Clear the interrupt flag
+   DPORT_REG_WRITE(RSA_INTERRUPT_REG, 1);
+
+   //Release exclusive access to the RSA module
+   osReleaseMutex(&esp32CryptoMutex);
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Modular exponentiation
  * @param[out] r Resulting integer R = A ^ E mod P
@@ -202,11 +337,9 @@ error_list mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
 error_list mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
 {
    error_list error;
-   size_t i;
    size_t n;
    size_t modLen;
    size_t expLen;
-   uint32_t m;
    Mpi t;
    Mpi r2;
 
@@ -248,128 +381,76 @@ error_list mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
       //Check status code
       if(!error)
       {
-         //Acquire exclusive access to the RSA module
-         osAcquireMutex(&esp32CryptoMutex);
-
-         //Clear the interrupt flag
-         DPORT_REG_WRITE(RSA_INTERRUPT_REG, 1);
-         //Set mode register
-         DPORT_REG_WRITE(RSA_MODEXP_MODE_REG, (n / 16) - 1);
-
-         //Copy the operand to RSA_X_MEM
-         for(i = 0; i < n; i++)
-         {
-            if(i < t.size)
-            {
-               DPORT_REG_WRITE(RSA_MEM_X_BLOCK_BASE + i * 4, t.data[i]);
-            }
-            else
-            {
-               DPORT_REG_WRITE(RSA_MEM_X_BLOCK_BASE + i * 4, 0);
-            }
-         }
-
-         //Copy the exponent to RSA_Y_MEM
-         for(i = 0; i < n; i++)
-         {
-            if(i < e->size)
-            {
-               DPORT_REG_WRITE(RSA_MEM_Y_BLOCK_BASE + i * 4, e->data[i]);
-            }
-            else
-            {
-               DPORT_REG_WRITE(RSA_MEM_Y_BLOCK_BASE + i * 4, 0);
-            }
-         }
-
-         //Copy the modulus to RSA_M_MEM
-         for(i = 0; i < n; i++)
-         {
-            if(i < p->size)
-            {
-               DPORT_REG_WRITE(RSA_MEM_M_BLOCK_BASE + i * 4, p->data[i]);
-            }
-            else
-            {
-               DPORT_REG_WRITE(RSA_MEM_M_BLOCK_BASE + i * 4, 0);
-            }
-         }
-
-         //Copy the pre-calculated value of R^2 mod M to RSA_Z_MEM
-         for(i = 0; i < n; i++)
-         {
-            if(i < r2.size)
-            {
-               DPORT_REG_WRITE(RSA_MEM_RB_BLOCK_BASE + i * 4, r2.data[i]);
-            }
-            else
-            {
-               DPORT_REG_WRITE(RSA_MEM_RB_BLOCK_BASE + i * 4, 0);
-            }
-         }
+         //Perform modular exponentiation
+         error = esp32RsaExpMod(r, &t, e, p, &r2, n);
+      }
+   }
+   else
+   {
+      //Report an error
+      error = ERROR_FAILURE;
+   }
 
-         //Use Newton's method to compute the inverse of M[0] mod 2^32
-         for(m = 2 - p->data[0], i = 0; i < 4; i++)
-         {
-            m = m * (2 - m * p->data[0]);
-         }
+   //Release previously allocated memory
+   mpiFree(&t);
+   mpiFree(&r2);
 
-         //Precompute M' = -1/M[0] mod 2^32;
-         m = ~m + 1;
+   //Return status code
+   return error;
+}
 
-         //Write the value of M' to RSA_M_PRIME_REG
-         DPORT_REG_WRITE(RSA_M_DASH_REG, m);
 
-         //Start modular exponentiation
-         DPORT_REG_WRITE(RSA_MODEXP_START_REG, 1);
+/**
+ * @brief Modular exponentiation with a precomputed Montgomery context
+ *
+ * The value of R^2 mod P held by the context is loaded into the accelerator
+ * as is, provided that the length of the modulus is a multiple of 512 bits.
+ * Other moduli go through mpiExpMod
+ *
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] context Montgomery context of the modulus P
+ * @return Error code
+ **/
 
-         //Wait for the operation to complete
-         while(DPORT_REG_READ(RSA_INTERRUPT_REG) == 0)
-         {
-         }
+error_list mpiExpModMontgomery(Mpi *r, const Mpi *a, const Mpi *e,
+   const MpiMontgomeryContext *context)
+{
+   error_list error;
+   size_t n;
+   Mpi t;
 
-         //Adjust the size of the result if necessary
-         error = mpiGrow(r, n);
+   //Make sure the context has been loaded
+   if(context->k == 0)
+      return ERROR_INVALID_PARAMETER;
 
-         //Check status code
-         if(!error)
-         {
-            //Disable interrupts only on current CPU
-            DPORT_INTERRUPT_DISABLE();
+   //Length of the modulus, in 32-bit words
+   n = context->k;
 
-            //Read the result from RSA_Z_MEM
-            for(i = 0; i < r->size; i++)
-            {
-               if(i < n)
-               {
-                  r->data[i] = DPORT_SEQUENCE_REG_READ(RSA_MEM_Z_BLOCK_BASE + i * 4);
-               }
-               else
-               {
-                  r->data[i] = 0;
-               }
-            }
+   //The accelerator uses R = 2^(32 * n), with n a multiple of 16
+   if((n % 16) != 0 || n > 128 || mpiGetLength(e) == 0 ||
+      mpiGetLength(e) > n)
+   {
+      //The constants of the context cannot be reused
+      return mpiExpMod(r, a, e, &context->p);
+   }
 
-            //Restore the previous interrupt level
-            DPORT_INTERRUPT_RESTORE();
-         }
+   //Initialize multiple precision integer
+   mpiInit(&t);
 
-         //Clear the interrupt flag
-         DPORT_REG_WRITE(RSA_INTERRUPT_REG, 1);
+   //Reduce the operand first
+   error = mpiMod(&t, a, &context->p);
 
-         //Release exclusive access to the RSA module
-         osReleaseMutex(&esp32CryptoMutex);
-      }
-   }
-   else
+   //Check status code
+   if(!error)
    {
-      //Report an error
-      error = ERROR_FAILURE;
+      //Perform modular exponentiation
+      error = esp32RsaExpMod(r, &t, e, &context->p, &context->r2, n);
    }
 
    //Release previously allocated memory
    mpiFree(&t);
-   mpiFree(&r2);
 
    //Return status code
    return error;
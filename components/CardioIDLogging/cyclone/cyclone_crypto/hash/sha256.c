@@ -47,13 +47,26 @@
 #define W(t) w[(t) & 0x0F]
 
 //SHA-256 auxiliary functions
-#define CH(x, y, z) (((x) & (y)) | (~(x) & (z)))
-#define MAJ(x, y, z) (((x) & (y)) | ((x) & (z)) | ((y) & (z)))
+#define CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define SIGMA1(x) (ROR32(x, 2) ^ ROR32(x, 13) ^ ROR32(x, 22))
 #define SIGMA2(x) (ROR32(x, 6) ^ ROR32(x, 11) ^ ROR32(x, 25))
 #define SIGMA3(x) (ROR32(x, 7) ^ ROR32(x, 18) ^ SHR32(x, 3))
 #define SIGMA4(x) (ROR32(x, 17) ^ ROR32(x, 19) ^ SHR32(x, 10))
 
+//SHA-256 round function (the message schedule is computed on the fly)
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, t) \
+{ \
+   uint32_t temp1; \
+   uint32_t temp2; \
+   if((t) >= 16) \
+      W(t) += SIGMA4(W((t) + 14)) + W((t) + 9) + SIGMA3(W((t) + 1)); \
+   temp1 = h + SIGMA2(e) + CH(e, f, g) + k[t] + W(t); \
+   temp2 = SIGMA1(a) + MAJ(a, b, c); \
+   d += temp1; \
+   h = temp1 + temp2; \
+}
+
 //SHA-256 padding
 static const uint8_t padding[64] =
 {
@@ -148,6 +161,50 @@ __weak_func error_list sha256Compute(const void *data, size_t length, uint8_t *d
 }
 
 
+/**
+ * @brief Digest several independent messages using SHA-256
+ * @param[in] data Pointers to the messages being hashed
+ * @param[in] length Length of each message
+ * @param[in] count Number of messages
+ * @param[out] digests Calculated digests, stored one after the other
+ * @return Error code
+ **/
+
+__weak_func error_list sha256ComputeMulti(const void *const data[],
+   const size_t length[], uint_t count, uint8_t *digests)
+{
+   uint_t i;
+   Sha256Context *context;
+
+   //Check parameters
+   if((data == NULL || length == NULL || digests == NULL) && count > 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Allocate a memory buffer to hold the SHA-256 context
+   context = cryptoAllocMem(sizeof(Sha256Context));
+   //Failed to allocate memory?
+   if(context == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //The same context is reused for all the messages
+   for(i = 0; i < count; i++)
+   {
+      //Initialize the SHA-256 context
+      sha256Init(context);
+      //Digest the current message
+      sha256Update(context, data[i], length[i]);
+      //Finalize the SHA-256 message digest
+      sha256Final(context, digests + i * SHA256_DIGEST_SIZE);
+   }
+
+   //Free previously allocated memory
+   cryptoFreeMem(context);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Initialize SHA-256 message digest context
  * @param[in] context Pointer to the SHA-256 context to initialize
@@ -296,8 +353,6 @@ __weak_func void sha256FinalRaw(Sha256Context *context, uint8_t *digest)
 __weak_func void sha256ProcessBlock(Sha256Context *context)
 {
    uint_t t;
-   uint32_t temp1;
-   uint32_t temp2;
 
    //Initialize the 8 working registers
    uint32_t a = context->h[0];
@@ -318,28 +373,18 @@ __weak_func void sha256ProcessBlock(Sha256Context *context)
       w[t] = betoh32(w[t]);
    }
 
-   //SHA-256 hash computation (alternate method)
-   for(t = 0; t < 64; t++)
+   //The rounds are unrolled by 8, so that the working registers are renamed
+   //instead of being shifted after each round
+   for(t = 0; t < 64; t += 8)
    {
-      //Prepare the message schedule
-      if(t >= 16)
-      {
-         W(t) += SIGMA4(W(t + 14)) + W(t + 9) + SIGMA3(W(t + 1));
-      }
-
-      //Calculate T1 and T2
-      temp1 = h + SIGMA2(e) + CH(e, f, g) + k[t] + W(t);
-      temp2 = SIGMA1(a) + MAJ(a, b, c);
-
-      //Update the working registers
-      h = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
+      SHA256_ROUND(a, b, c, d, e, f, g, h, t);
+      SHA256_ROUND(h, a, b, c, d, e, f, g, t + 1);
+      SHA256_ROUND(g, h, a, b, c, d, e, f, t + 2);
+      SHA256_ROUND(f, g, h, a, b, c, d, e, t + 3);
+      SHA256_ROUND(e, f, g, h, a, b, c, d, t + 4);
+      SHA256_ROUND(d, e, f, g, h, a, b, c, t + 5);
+      SHA256_ROUND(c, d, e, f, g, h, a, b, t + 6);
+      SHA256_ROUND(b, c, d, e, f, g, h, a, t + 7);
    }
 
    //Update the hash value
@@ -84,6 +84,10 @@ extern const HashAlgo sha256HashAlgo;
 
 //SHA-256 related functions
 error_list sha256Compute(const void *data, size_t length, uint8_t *digest);
+
+error_list sha256ComputeMulti(const void *const data[],
+   const size_t length[], uint_t count, uint8_t *digests);
+
 void sha256Init(Sha256Context *context);
 void sha256Update(Sha256Context *context, const void *data, size_t length);
 void sha256Final(Sha256Context *context, uint8_t *digest);
@@ -148,6 +148,8 @@ __weak_func error_list hmacInit(HmacContext *context, const HashAlgo *hash,
 
    //Hash algorithm used to compute HMAC
    context->hash = hash;
+   //The outer pad is computed from the key
+   context->keySchedule = NULL;
 
    //The key is longer than the block size?
    if(keyLen > hash->blockSize)
@@ -187,6 +189,106 @@ __weak_func error_list hmacInit(HmacContext *context, const HashAlgo *hash,
 }
 
 
+/**
+ * @brief Precompute the inner and outer hash states for a given key
+ * @param[out] keySchedule Pointer to the HMAC key schedule
+ * @param[in] hash Hash algorithm used to compute HMAC
+ * @param[in] key Key to use in the hash algorithm
+ * @param[in] keyLen Length of the key
+ * @return Error code
+ **/
+
+error_list hmacInitKeySchedule(HmacKeySchedule *keySchedule,
+   const HashAlgo *hash, const void *key, size_t keyLen)
+{
+   uint_t i;
+   uint8_t paddedKey[MAX_HASH_BLOCK_SIZE];
+
+   //Check parameters
+   if(keySchedule == NULL || hash == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the supplied key is valid
+   if(key == NULL && keyLen != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Hash algorithm used to compute HMAC
+   keySchedule->hash = hash;
+
+   //The key is longer than the block size?
+   if(keyLen > hash->blockSize)
+   {
+      //Digest the original key
+      hash->init(&keySchedule->outerContext);
+      hash->update(&keySchedule->outerContext, key, keyLen);
+      hash->final(&keySchedule->outerContext, paddedKey);
+
+      //Key is padded to the right with extra zeros
+      osMemset(paddedKey + hash->digestSize, 0,
+         hash->blockSize - hash->digestSize);
+   }
+   else
+   {
+      //Copy the key
+      osMemcpy(paddedKey, key, keyLen);
+      //Key is padded to the right with extra zeros
+      osMemset(paddedKey + keyLen, 0, hash->blockSize - keyLen);
+   }
+
+   //XOR the resulting key with ipad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      paddedKey[i] ^= HMAC_IPAD;
+   }
+
+   //Digest the inner pad
+   hash->init(&keySchedule->innerContext);
+   hash->update(&keySchedule->innerContext, paddedKey, hash->blockSize);
+
+   //XOR the original key with opad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      paddedKey[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+   }
+
+   //Digest the outer pad
+   hash->init(&keySchedule->outerContext);
+   hash->update(&keySchedule->outerContext, paddedKey, hash->blockSize);
+
+   //Clear the padded key
+   osMemset(paddedKey, 0, sizeof(paddedKey));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Initialize HMAC calculation from a precomputed key schedule
+ *
+ * The hash state after the inner pad is copied instead of being computed,
+ * which saves one compression function call per message, and hmacFinal
+ * saves another one by resuming from the outer state. The key schedule must
+ * remain valid until hmacFinal has been called
+ *
+ * @param[in] context Pointer to the HMAC context to initialize
+ * @param[in] keySchedule Pointer to the HMAC key schedule
+ **/
+
+void hmacInitWithKeySchedule(HmacContext *context,
+   const HmacKeySchedule *keySchedule)
+{
+   //Hash algorithm used to compute HMAC
+   context->hash = keySchedule->hash;
+   //Save the key schedule for the second pass
+   context->keySchedule = keySchedule;
+
+   //Resume from the state reached after the inner pad
+   osMemcpy(&context->hashContext, &keySchedule->innerContext,
+      keySchedule->hash->contextSize);
+}
+
+
 /**
  * @brief Update the HMAC context with a portion of the message being hashed
  * @param[in] context Pointer to the HMAC context
@@ -221,16 +323,27 @@ __weak_func void hmacFinal(HmacContext *context, uint8_t *digest)
    //Finish the first pass
    hash->final(&context->hashContext, context->digest);
 
-   //XOR the original key with opad
-   for(i = 0; i < hash->blockSize; i++)
+   //Precomputed key schedule?
+   if(context->keySchedule != NULL)
    {
-      context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      //Resume from the state reached after the outer pad
+      osMemcpy(&context->hashContext, &context->keySchedule->outerContext,
+         hash->contextSize);
+   }
+   else
+   {
+      //XOR the original key with opad
+      for(i = 0; i < hash->blockSize; i++)
+      {
+         context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      }
+
+      //Initialize context for the second pass
+      hash->init(&context->hashContext);
+      //Start with outer pad
+      hash->update(&context->hashContext, context->key, hash->blockSize);
    }
 
-   //Initialize context for the second pass
-   hash->init(&context->hashContext);
-   //Start with outer pad
-   hash->update(&context->hashContext, context->key, hash->blockSize);
    //Then digest the result of the first hash
    hash->update(&context->hashContext, context->digest, hash->digestSize);
    //Finish the second pass
@@ -258,16 +371,27 @@ void hmacFinalRaw(HmacContext *context, uint8_t *digest)
    //Hash algorithm used to compute HMAC
    hash = context->hash;
 
-   //XOR the original key with opad
-   for(i = 0; i < hash->blockSize; i++)
+   //Precomputed key schedule?
+   if(context->keySchedule != NULL)
    {
-      context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      //Resume from the state reached after the outer pad
+      osMemcpy(&context->hashContext, &context->keySchedule->outerContext,
+         hash->contextSize);
+   }
+   else
+   {
+      //XOR the original key with opad
+      for(i = 0; i < hash->blockSize; i++)
+      {
+         context->key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+      }
+
+      //Initialize context for the second pass
+      hash->init(&context->hashContext);
+      //Start with outer pad
+      hash->update(&context->hashContext, context->key, hash->blockSize);
    }
 
-   //Initialize context for the second pass
-   hash->init(&context->hashContext);
-   //Start with outer pad
-   hash->update(&context->hashContext, context->key, hash->blockSize);
    //Then digest the result of the first hash
    hash->update(&context->hashContext, context->digest, hash->digestSize);
    //Finish the second pass
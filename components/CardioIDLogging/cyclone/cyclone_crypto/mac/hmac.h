@@ -51,6 +51,21 @@ extern "C" {
 #endif
 
 
+/**
+ * @brief HMAC key schedule
+ *
+ * Hash states reached after digesting the inner and the outer padded key.
+ * They depend on the key only, and can be reused for every message
+ **/
+
+typedef struct
+{
+   const HashAlgo *hash;
+   HashContext innerContext;
+   HashContext outerContext;
+} HmacKeySchedule;
+
+
 /**
  * @brief HMAC algorithm context
  **/
@@ -59,6 +74,7 @@ typedef struct
 {
    const HashAlgo *hash;
    HashContext hashContext;
+   const HmacKeySchedule *keySchedule;
    uint8_t key[MAX_HASH_BLOCK_SIZE];
    uint8_t digest[MAX_HASH_DIGEST_SIZE];
    HMAC_PRIVATE_CONTEXT
@@ -88,6 +104,12 @@ error_list hmacCompute(const HashAlgo *hash, const void *key, size_t keyLen,
 error_list hmacInit(HmacContext *context, const HashAlgo *hash,
    const void *key, size_t keyLen);
 
+error_list hmacInitKeySchedule(HmacKeySchedule *keySchedule,
+   const HashAlgo *hash, const void *key, size_t keyLen);
+
+void hmacInitWithKeySchedule(HmacContext *context,
+   const HmacKeySchedule *keySchedule);
+
 void hmacUpdate(HmacContext *context, const void *data, size_t length);
 void hmacFinal(HmacContext *context, uint8_t *digest);
 void hmacFinalRaw(HmacContext *context, uint8_t *digest);
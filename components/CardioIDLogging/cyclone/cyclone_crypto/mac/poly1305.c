@@ -39,6 +39,9 @@
 //Check crypto library configuration
 #if (POLY1305_SUPPORT == ENABLED)
 
+//Mask of a 26-bit limb
+#define POLY1305_LIMB_MASK 0x03FFFFFF
+
 
 /**
  * @brief Initialize Poly1305 message-authentication code computation
@@ -48,31 +51,27 @@
 
 void poly1305Init(Poly1305Context *context, const uint8_t *key)
 {
-   //The 256-bit key is partitioned into two parts, called r and s
-   context->r[0] = LOAD32LE(key);
-   context->r[1] = LOAD32LE(key + 4);
-   context->r[2] = LOAD32LE(key + 8);
-   context->r[3] = LOAD32LE(key + 12);
+   //The first half of the key is r. Certain bits of r are required to be 0.
+   //r is split into five 26-bit limbs, so that the products of two limbs
+   //fit in 64 bits with room left for the accumulation
+   context->r[0] = LOAD32LE(key) & 0x03FFFFFF;
+   context->r[1] = (LOAD32LE(key + 3) >> 2) & 0x03FFFF03;
+   context->r[2] = (LOAD32LE(key + 6) >> 4) & 0x03FFC0FF;
+   context->r[3] = (LOAD32LE(key + 9) >> 6) & 0x03F03FFF;
+   context->r[4] = (LOAD32LE(key + 12) >> 8) & 0x000FFFFF;
+
+   //The second half of the key is s
    context->s[0] = LOAD32LE(key + 16);
    context->s[1] = LOAD32LE(key + 20);
    context->s[2] = LOAD32LE(key + 24);
    context->s[3] = LOAD32LE(key + 28);
 
-   //Certain bits of r are required to be 0
-   context->r[0] &= 0x0FFFFFFF;
-   context->r[1] &= 0x0FFFFFFC;
-   context->r[2] &= 0x0FFFFFFC;
-   context->r[3] &= 0x0FFFFFFC;
-
    //The accumulator is set to zero
    context->a[0] = 0;
    context->a[1] = 0;
    context->a[2] = 0;
    context->a[3] = 0;
    context->a[4] = 0;
-   context->a[5] = 0;
-   context->a[6] = 0;
-   context->a[7] = 0;
 
    //Number of bytes in the buffer
    context->size = 0;
@@ -90,8 +89,8 @@ void poly1305Update(Poly1305Context *context, const void *data, size_t length)
 {
    size_t n;
 
-   //Process the incoming data
-   while(length > 0)
+   //Complete the pending block first
+   if(context->size != 0)
    {
       //The buffer can hold at most 16 bytes
       n = MIN(length, 16 - context->size);
@@ -115,6 +114,28 @@ void poly1305Update(Poly1305Context *context, const void *data, size_t length)
          context->size = 0;
       }
    }
+
+   //Whole blocks are processed in place, without going through the buffer
+   n = length & ~(size_t) 15;
+
+   //Any whole block to process?
+   if(n > 0)
+   {
+      //Transform the 16-byte blocks
+      poly1305ProcessBlocks(context, data, n, 1);
+
+      //Advance the data pointer
+      data = (uint8_t *) data + n;
+      //Remaining bytes to process
+      length -= n;
+   }
+
+   //Keep the remaining bytes for later
+   if(length > 0)
+   {
+      osMemcpy(context->buffer, data, length);
+      context->size = length;
+   }
 }
 
 
@@ -126,62 +147,88 @@ void poly1305Update(Poly1305Context *context, const void *data, size_t length)
 
 void poly1305Final(Poly1305Context *context, uint8_t *tag)
 {
+   uint32_t c;
    uint32_t mask;
-   uint32_t b[4];
+   uint32_t h[5];
+   uint32_t g[5];
+   uint64_t f;
 
    //Process the last block
    if(context->size != 0)
       poly1305ProcessBlock(context);
 
-   //Save the accumulator
-   b[0] = context->a[0] & 0xFFFFFFFF;
-   b[1] = context->a[1] & 0xFFFFFFFF;
-   b[2] = context->a[2] & 0xFFFFFFFF;
-   b[3] = context->a[3] & 0xFFFFFFFF;
-
-   //Compute a + 5
-   context->a[0] += 5;
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-
-   //If (a + 5) >= 2^130, form a mask with the value 0x00000000. Else,
-   //form a mask with the value 0xffffffff
-   mask = ((context->a[4] & 0x04) >> 2) - 1;
-
-   //Select between ((a - (2^130 - 5)) % 2^128) and (a % 2^128)
-   context->a[0] = (context->a[0] & ~mask) | (b[0] & mask);
-   context->a[1] = (context->a[1] & ~mask) | (b[1] & mask);
-   context->a[2] = (context->a[2] & ~mask) | (b[2] & mask);
-   context->a[3] = (context->a[3] & ~mask) | (b[3] & mask);
+   //Load the accumulator
+   h[0] = context->a[0];
+   h[1] = context->a[1];
+   h[2] = context->a[2];
+   h[3] = context->a[3];
+   h[4] = context->a[4];
+
+   //Fully propagate the carry
+   c = h[1] >> 26;
+   h[1] &= POLY1305_LIMB_MASK;
+   h[2] += c;
+   c = h[2] >> 26;
+   h[2] &= POLY1305_LIMB_MASK;
+   h[3] += c;
+   c = h[3] >> 26;
+   h[3] &= POLY1305_LIMB_MASK;
+   h[4] += c;
+   c = h[4] >> 26;
+   h[4] &= POLY1305_LIMB_MASK;
+   h[0] += c * 5;
+   c = h[0] >> 26;
+   h[0] &= POLY1305_LIMB_MASK;
+   h[1] += c;
+
+   //Compute a + 5 - 2^130
+   g[0] = h[0] + 5;
+   c = g[0] >> 26;
+   g[0] &= POLY1305_LIMB_MASK;
+   g[1] = h[1] + c;
+   c = g[1] >> 26;
+   g[1] &= POLY1305_LIMB_MASK;
+   g[2] = h[2] + c;
+   c = g[2] >> 26;
+   g[2] &= POLY1305_LIMB_MASK;
+   g[3] = h[3] + c;
+   c = g[3] >> 26;
+   g[3] &= POLY1305_LIMB_MASK;
+   g[4] = h[4] + c - (1UL << 26);
+
+   //If (a + 5) >= 2^130, form a mask with the value 0xffffffff. Else,
+   //form a mask with the value 0x00000000
+   mask = (g[4] >> 31) - 1;
+
+   //Select between (a - (2^130 - 5)) and a
+   h[0] = (h[0] & ~mask) | (g[0] & mask);
+   h[1] = (h[1] & ~mask) | (g[1] & mask);
+   h[2] = (h[2] & ~mask) | (g[2] & mask);
+   h[3] = (h[3] & ~mask) | (g[3] & mask);
+   h[4] = (h[4] & ~mask) | (g[4] & mask);
+
+   //Convert the accumulator to four 32-bit words (modulo 2^128)
+   h[0] = h[0] | (h[1] << 26);
+   h[1] = (h[1] >> 6) | (h[2] << 20);
+   h[2] = (h[2] >> 12) | (h[3] << 14);
+   h[3] = (h[3] >> 18) | (h[4] << 8);
 
    //Finally, the value of the secret key s is added to the accumulator
-   context->a[0] += context->s[0];
-   context->a[1] += context->s[1];
-   context->a[2] += context->s[2];
-   context->a[3] += context->s[3];
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-
-   //We only consider the least significant bits
-   b[0] = context->a[0] & 0xFFFFFFFF;
-   b[1] = context->a[1] & 0xFFFFFFFF;
-   b[2] = context->a[2] & 0xFFFFFFFF;
-   b[3] = context->a[3] & 0xFFFFFFFF;
+   f = (uint64_t) h[0] + context->s[0];
+   h[0] = (uint32_t) f;
+   f = (uint64_t) h[1] + context->s[1] + (f >> 32);
+   h[1] = (uint32_t) f;
+   f = (uint64_t) h[2] + context->s[2] + (f >> 32);
+   h[2] = (uint32_t) f;
+   f = (uint64_t) h[3] + context->s[3] + (f >> 32);
+   h[3] = (uint32_t) f;
 
    //The result is serialized as a little-endian number, producing
    //the 16 byte tag
-   STORE32LE(b[0], tag);
-   STORE32LE(b[1], tag + 4);
-   STORE32LE(b[2], tag + 8);
-   STORE32LE(b[3], tag + 12);
+   STORE32LE(h[0], tag);
+   STORE32LE(h[1], tag + 4);
+   STORE32LE(h[2], tag + 8);
+   STORE32LE(h[3], tag + 12);
 
    //Clear the accumulator
    context->a[0] = 0;
@@ -189,15 +236,13 @@ void poly1305Final(Poly1305Context *context, uint8_t *tag)
    context->a[2] = 0;
    context->a[3] = 0;
    context->a[4] = 0;
-   context->a[5] = 0;
-   context->a[6] = 0;
-   context->a[7] = 0;
 
    //Clear r and s
    context->r[0] = 0;
    context->r[1] = 0;
    context->r[2] = 0;
    context->r[3] = 0;
+   context->r[4] = 0;
    context->s[0] = 0;
    context->s[1] = 0;
    context->s[2] = 0;
@@ -206,139 +251,138 @@ void poly1305Final(Poly1305Context *context, uint8_t *tag)
 
 
 /**
- * @brief Process message in 16-byte blocks
+ * @brief Process the block held in the buffer
  * @param[in] context Pointer to the Poly1305 context
  **/
 
 void poly1305ProcessBlock(Poly1305Context *context)
 {
-   uint32_t a[5];
-   uint32_t r[4];
    uint_t n;
 
-   //Retrieve the length of the last block
+   //Retrieve the length of the block
    n = context->size;
 
-   //Add one bit beyond the number of octets. For a 16-byte block,
-   //this is equivalent to adding 2^128 to the number. For the shorter
-   //block, it can be 2^120, 2^112, or any power of two that is evenly
-   //divisible by 8, all the way down to 2^8
-   context->buffer[n++] = 0x01;
+   //Full block?
+   if(n == 16)
+   {
+      //Add 2^128 to the number
+      poly1305ProcessBlocks(context, context->buffer, 16, 1);
+   }
+   else
+   {
+      //Add one bit beyond the number of octets. For the shorter block, it
+      //can be 2^120, 2^112, or any power of two that is evenly divisible
+      //by 8, all the way down to 2^8
+      context->buffer[n++] = 0x01;
+
+      //Pad the last block with zeros
+      while(n < 16)
+      {
+         context->buffer[n++] = 0x00;
+      }
+
+      //The extra bit is already part of the block
+      poly1305ProcessBlocks(context, context->buffer, 16, 0);
+   }
+}
+
 
-   //If the resulting block is not 17 bytes long (the last block),
-   //pad it with zeros
-   while(n < 17)
+/**
+ * @brief Process message in 16-byte blocks
+ *
+ * The accumulator stays in local variables across the blocks, and the
+ * multiplication by r uses 26-bit limbs with the high products folded
+ * back with a factor 5 (2^130 = 5 mod p), so that only 32x32-bit
+ * multiplications are needed
+ *
+ * @param[in] context Pointer to the Poly1305 context
+ * @param[in] data Pointer to the message
+ * @param[in] length Length of the message (multiple of 16 bytes)
+ * @param[in] hiBit 1 to add 2^128 to each block, 0 for a padded last block
+ **/
+
+void poly1305ProcessBlocks(Poly1305Context *context, const uint8_t *data,
+   size_t length, uint_t hiBit)
+{
+   uint32_t c;
+   uint32_t r0, r1, r2, r3, r4;
+   uint32_t s1, s2, s3, s4;
+   uint32_t h0, h1, h2, h3, h4;
+   uint64_t d0, d1, d2, d3, d4;
+
+   //Load r
+   r0 = context->r[0];
+   r1 = context->r[1];
+   r2 = context->r[2];
+   r3 = context->r[3];
+   r4 = context->r[4];
+
+   //Precompute 5 * r
+   s1 = r1 * 5;
+   s2 = r2 * 5;
+   s3 = r3 * 5;
+   s4 = r4 * 5;
+
+   //Load the accumulator
+   h0 = context->a[0];
+   h1 = context->a[1];
+   h2 = context->a[2];
+   h3 = context->a[3];
+   h4 = context->a[4];
+
+   //Process the blocks
+   while(length >= 16)
    {
-      context->buffer[n++] = 0x00;
+      //Add the block to the accumulator
+      h0 += LOAD32LE(data) & POLY1305_LIMB_MASK;
+      h1 += (LOAD32LE(data + 3) >> 2) & POLY1305_LIMB_MASK;
+      h2 += (LOAD32LE(data + 6) >> 4) & POLY1305_LIMB_MASK;
+      h3 += (LOAD32LE(data + 9) >> 6) & POLY1305_LIMB_MASK;
+      h4 += (LOAD32LE(data + 12) >> 8) | (hiBit << 24);
+
+      //Multiply the accumulator by r
+      d0 = (uint64_t) h0 * r0 + (uint64_t) h1 * s4 + (uint64_t) h2 * s3 +
+         (uint64_t) h3 * s2 + (uint64_t) h4 * s1;
+      d1 = (uint64_t) h0 * r1 + (uint64_t) h1 * r0 + (uint64_t) h2 * s4 +
+         (uint64_t) h3 * s3 + (uint64_t) h4 * s2;
+      d2 = (uint64_t) h0 * r2 + (uint64_t) h1 * r1 + (uint64_t) h2 * r0 +
+         (uint64_t) h3 * s4 + (uint64_t) h4 * s3;
+      d3 = (uint64_t) h0 * r3 + (uint64_t) h1 * r2 + (uint64_t) h2 * r1 +
+         (uint64_t) h3 * r0 + (uint64_t) h4 * s4;
+      d4 = (uint64_t) h0 * r4 + (uint64_t) h1 * r3 + (uint64_t) h2 * r2 +
+         (uint64_t) h3 * r1 + (uint64_t) h4 * r0;
+
+      //Perform partial modular reduction
+      c = (uint32_t) (d0 >> 26);
+      h0 = (uint32_t) d0 & POLY1305_LIMB_MASK;
+      d1 += c;
+      c = (uint32_t) (d1 >> 26);
+      h1 = (uint32_t) d1 & POLY1305_LIMB_MASK;
+      d2 += c;
+      c = (uint32_t) (d2 >> 26);
+      h2 = (uint32_t) d2 & POLY1305_LIMB_MASK;
+      d3 += c;
+      c = (uint32_t) (d3 >> 26);
+      h3 = (uint32_t) d3 & POLY1305_LIMB_MASK;
+      d4 += c;
+      c = (uint32_t) (d4 >> 26);
+      h4 = (uint32_t) d4 & POLY1305_LIMB_MASK;
+      h0 += c * 5;
+      c = h0 >> 26;
+      h0 &= POLY1305_LIMB_MASK;
+      h1 += c;
+
+      //Next block
+      data += 16;
+      length -= 16;
    }
 
-   //Read the block as a little-endian number
-   a[0] = LOAD32LE(context->buffer);
-   a[1] = LOAD32LE(context->buffer + 4);
-   a[2] = LOAD32LE(context->buffer + 8);
-   a[3] = LOAD32LE(context->buffer + 12);
-   a[4] = context->buffer[16];
-
-   //Add this number to the accumulator
-   context->a[0] += a[0];
-   context->a[1] += a[1];
-   context->a[2] += a[2];
-   context->a[3] += a[3];
-   context->a[4] += a[4];
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-
-   //We only consider the least significant bits
-   a[0] = context->a[0] & 0xFFFFFFFF;
-   a[1] = context->a[1] & 0xFFFFFFFF;
-   a[2] = context->a[2] & 0xFFFFFFFF;
-   a[3] = context->a[3] & 0xFFFFFFFF;
-   a[4] = context->a[4] & 0xFFFFFFFF;
-
-   //Copy r
-   r[0] = context->r[0];
-   r[1] = context->r[1];
-   r[2] = context->r[2];
-   r[3] = context->r[3];
-
-   //Multiply the accumulator by r
-   context->a[0] = (uint64_t) a[0] * r[0];
-   context->a[1] = (uint64_t) a[0] * r[1] + (uint64_t) a[1] * r[0];
-   context->a[2] = (uint64_t) a[0] * r[2] + (uint64_t) a[1] * r[1] + (uint64_t) a[2] * r[0];
-   context->a[3] = (uint64_t) a[0] * r[3] + (uint64_t) a[1] * r[2] + (uint64_t) a[2] * r[1] + (uint64_t) a[3] * r[0];
-   context->a[4] = (uint64_t) a[1] * r[3] + (uint64_t) a[2] * r[2] + (uint64_t) a[3] * r[1] + (uint64_t) a[4] * r[0];
-   context->a[5] = (uint64_t) a[2] * r[3] + (uint64_t) a[3] * r[2] + (uint64_t) a[4] * r[1];
-   context->a[6] = (uint64_t) a[3] * r[3] + (uint64_t) a[4] * r[2];
-   context->a[7] = (uint64_t) a[4] * r[3];
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-   context->a[5] += context->a[4] >> 32;
-   context->a[6] += context->a[5] >> 32;
-   context->a[7] += context->a[6] >> 32;
-
-   //Save the high part of the accumulator
-   a[0] = context->a[4] & 0xFFFFFFFC;
-   a[1] = context->a[5] & 0xFFFFFFFF;
-   a[2] = context->a[6] & 0xFFFFFFFF;
-   a[3] = context->a[7] & 0xFFFFFFFF;
-
-   //We only consider the least significant bits
-   context->a[0] &= 0xFFFFFFFF;
-   context->a[1] &= 0xFFFFFFFF;
-   context->a[2] &= 0xFFFFFFFF;
-   context->a[3] &= 0xFFFFFFFF;
-   context->a[4] &= 0x00000003;
-
-   //Perform fast modular reduction (first pass)
-   context->a[0] += a[0];
-   context->a[0] += (a[0] >> 2) | (a[1] << 30);
-   context->a[1] += a[1];
-   context->a[1] += (a[1] >> 2) | (a[2] << 30);
-   context->a[2] += a[2];
-   context->a[2] += (a[2] >> 2) | (a[3] << 30);
-   context->a[3] += a[3];
-   context->a[3] += (a[3] >> 2);
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-
-   //Save the high part of the accumulator
-   a[0] = context->a[4] & 0xFFFFFFFC;
-
-   //We only consider the least significant bits
-   context->a[0] &= 0xFFFFFFFF;
-   context->a[1] &= 0xFFFFFFFF;
-   context->a[2] &= 0xFFFFFFFF;
-   context->a[3] &= 0xFFFFFFFF;
-   context->a[4] &= 0x00000003;
-
-   //Perform fast modular reduction (second pass)
-   context->a[0] += a[0];
-   context->a[0] += a[0] >> 2;
-
-   //Propagate the carry
-   context->a[1] += context->a[0] >> 32;
-   context->a[2] += context->a[1] >> 32;
-   context->a[3] += context->a[2] >> 32;
-   context->a[4] += context->a[3] >> 32;
-
-   //We only consider the least significant bits
-   context->a[0] &= 0xFFFFFFFF;
-   context->a[1] &= 0xFFFFFFFF;
-   context->a[2] &= 0xFFFFFFFF;
-   context->a[3] &= 0xFFFFFFFF;
-   context->a[4] &= 0x00000003;
+   //Save the accumulator
+   context->a[0] = h0;
+   context->a[1] = h1;
+   context->a[2] = h2;
+   context->a[3] = h3;
+   context->a[4] = h4;
 }
 
 #endif
@@ -46,10 +46,10 @@ extern "C" {
 
 typedef struct
 {
-   uint32_t r[4];
+   uint32_t r[5];
    uint32_t s[4];
-   uint64_t a[8];
-   uint8_t buffer[17];
+   uint32_t a[5];
+   uint8_t buffer[16];
    size_t size;
 } Poly1305Context;
 
@@ -61,6 +61,9 @@ void poly1305Final(Poly1305Context *context, uint8_t *tag);
 
 void poly1305ProcessBlock(Poly1305Context *context);
 
+void poly1305ProcessBlocks(Poly1305Context *context, const uint8_t *data,
+   size_t length, uint_t hiBit);
+
 //C++ guard
 #ifdef __cplusplus
 }
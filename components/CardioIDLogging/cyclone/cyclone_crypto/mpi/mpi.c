@@ -39,6 +39,30 @@
 //Check crypto library configuration
 #if (MPI_SUPPORT == ENABLED)
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Header of an arena block
+ **/
+
+typedef struct _MpiArenaBlock
+{
+   struct _MpiArenaBlock *prev; ///<Previously allocated block
+   Mpi *owner;                  ///<Integer the block belongs to (NULL for scratch buffers)
+   size_t size;                 ///<Size of the block, including the header
+   bool_t live;                 ///<The block is still in use
+} MpiArenaBlock;
+
+//Arena currently entered
+static MpiArena *volatile mpiCurrentArena = NULL;
+
+#endif
+
+//Internal memory management functions
+static uint_t *mpiAllocData(Mpi *owner, uint_t size);
+static bool_t mpiExtendData(uint_t *data, uint_t size);
+static void mpiFreeData(uint_t *data);
+
 
 /**
  * @brief Initialize a multiple precision integer
@@ -66,7 +90,7 @@ void mpiFree(Mpi *r)
    {
       //Erase contents before releasing memory
       osMemset(r->data, 0, r->size * MPI_INT_SIZE);
-      cryptoFreeMem(r->data);
+      mpiFreeData(r->data);
    }
 
    //Set size to zero
@@ -93,8 +117,20 @@ error_list mpiGrow(Mpi *r, uint_t size)
    if(r->size >= size)
       return NO_ERROR;
 
+   //The most recent block of a scratch arena can be extended in place
+   if(r->size > 0 && mpiExtendData(r->data, size))
+   {
+      //Clear the new words
+      osMemset(r->data + r->size, 0, (size - r->size) * MPI_INT_SIZE);
+      //Update the size of the multiple precision integer
+      r->size = size;
+
+      //Successful operation
+      return NO_ERROR;
+   }
+
    //Allocate a memory buffer
-   data = cryptoAllocMem(size * MPI_INT_SIZE);
+   data = mpiAllocData(r, size);
    //Failed to allocate memory?
    if(data == NULL)
       return ERROR_OUT_OF_MEMORY;
@@ -108,7 +144,7 @@ error_list mpiGrow(Mpi *r, uint_t size)
       //Copy original data
       osMemcpy(data, r->data, r->size * MPI_INT_SIZE);
       //Free previously allocated memory
-      cryptoFreeMem(r->data);
+      mpiFreeData(r->data);
    }
 
    //Update the size of the multiple precision integer
@@ -120,6 +156,338 @@ error_list mpiGrow(Mpi *r, uint_t size)
 }
 
 
+/**
+ * @brief Allocate the data of a multiple precision integer
+ * @param[in] owner Integer the data belongs to (NULL for scratch buffers)
+ * @param[in] size Desired size in words
+ * @return Pointer to the allocated memory, or NULL on failure
+ **/
+
+static uint_t *mpiAllocData(Mpi *owner, uint_t size)
+{
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   size_t n;
+   MpiArena *arena;
+   MpiArenaBlock *block;
+
+   //Point to the arena currently entered, if any
+   arena = mpiCurrentArena;
+
+   //Only the task that entered the arena may allocate from it
+   if(arena != NULL && arena->taskId == osGetCurrentTask())
+   {
+      //Size of the block, including its header
+      n = sizeof(MpiArenaBlock) + ((size * MPI_INT_SIZE + 7) & ~(size_t) 7);
+
+      //Enough room left in the arena?
+      if(n <= (arena->size - arena->used))
+      {
+         //Carve the block out of the arena
+         block = (MpiArenaBlock *) (arena->buffer + arena->used);
+         block->prev = arena->top;
+         block->owner = owner;
+         block->size = n;
+         block->live = TRUE;
+
+         //Update the state of the arena
+         arena->top = block;
+         arena->used += n;
+         arena->peak = MAX(arena->peak, arena->used);
+         arena->allocCount++;
+
+         //Return a pointer to the data
+         return (uint_t *) (block + 1);
+      }
+
+      //The arena is exhausted, fall back to the heap
+      arena->heapCount++;
+   }
+#endif
+
+   //Allocate a memory buffer from the heap
+   return cryptoAllocMem(size * MPI_INT_SIZE);
+}
+
+
+/**
+ * @brief Extend the data of a multiple precision integer in place
+ * @param[in] data Pointer to the current data
+ * @param[in] size Desired size in words
+ * @return TRUE if the data has been extended, else FALSE
+ **/
+
+static bool_t mpiExtendData(uint_t *data, uint_t size)
+{
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   size_t n;
+   MpiArena *arena;
+   MpiArenaBlock *block;
+
+   //Point to the arena currently entered, if any
+   arena = mpiCurrentArena;
+
+   //Only the most recent block of the arena can grow
+   if(arena != NULL && arena->top != NULL &&
+      (uint_t *) ((MpiArenaBlock *) arena->top + 1) == data)
+   {
+      //Point to the block header
+      block = arena->top;
+      //New size of the block, including its header
+      n = sizeof(MpiArenaBlock) + ((size * MPI_INT_SIZE + 7) & ~(size_t) 7);
+
+      //Enough room left in the arena?
+      if(n <= (arena->size - ((uint8_t *) block - arena->buffer)))
+      {
+         //Extend the block
+         arena->used += n - block->size;
+         arena->peak = MAX(arena->peak, arena->used);
+         block->size = n;
+
+         //The data has been extended
+         return TRUE;
+      }
+   }
+#endif
+
+   //The data must be reallocated
+   return FALSE;
+}
+
+
+/**
+ * @brief Release the data of a multiple precision integer
+ * @param[in] data Pointer to the memory to be released
+ **/
+
+static void mpiFreeData(uint_t *data)
+{
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;
+   MpiArenaBlock *block;
+
+   //Point to the arena currently entered, if any
+   arena = mpiCurrentArena;
+
+   //Does the memory belong to the arena?
+   if(arena != NULL && (uint8_t *) data >= arena->buffer &&
+      (uint8_t *) data < (arena->buffer + arena->size))
+   {
+      //Mark the block as free
+      block = (MpiArenaBlock *) data - 1;
+      block->live = FALSE;
+
+      //Reclaim the free blocks at the top of the arena
+      while(arena->top != NULL && !((MpiArenaBlock *) arena->top)->live)
+      {
+         block = arena->top;
+         arena->used = (uint8_t *) block - arena->buffer;
+         arena->top = block->prev;
+      }
+   }
+   else
+#endif
+   {
+      //Release the memory buffer to the heap
+      cryptoFreeMem(data);
+   }
+}
+
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Initialize a scratch arena
+ * @param[out] arena Pointer to the arena to be initialized
+ * @param[in] buffer Memory region backing the arena
+ * @param[in] size Size of the memory region, in bytes
+ **/
+
+void mpiArenaInit(MpiArena *arena, void *buffer, size_t size)
+{
+   size_t offset;
+
+   //Clear the arena
+   osMemset(arena, 0, sizeof(MpiArena));
+   arena->taskId = OS_INVALID_TASK_ID;
+
+   //Blocks are aligned on 8-byte boundaries
+   offset = (8 - ((uintptr_t) buffer & 7)) & 7;
+
+   //Usable part of the memory region
+   if(buffer != NULL && size > offset)
+   {
+      arena->buffer = (uint8_t *) buffer + offset;
+      arena->size = (size - offset) & ~(size_t) 7;
+   }
+}
+
+
+/**
+ * @brief Enter a scratch arena
+ *
+ * Until the arena is left, the multiple precision integers allocated by the
+ * calling task are taken from the arena. Only one arena can be entered at a
+ * time. The statistics of the arena are reset
+ *
+ * @param[in] arena Pointer to the arena
+ * @return Error code
+ **/
+
+error_list mpiArenaEnter(MpiArena *arena)
+{
+   //Check parameters
+   if(arena == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the arena is usable
+   if(arena->size == 0)
+      return ERROR_WRONG_STATE;
+
+   //Claim the arena slot. Another arena may be entered concurrently by a
+   //task running on the other core
+   if(!__sync_bool_compare_and_swap(&mpiCurrentArena, NULL, arena))
+      return ERROR_ALREADY_RUNNING;
+
+   //Reset statistics
+   arena->peak = 0;
+   arena->allocCount = 0;
+   arena->heapCount = 0;
+   arena->moveCount = 0;
+
+   //The arena now serves the calling task
+   arena->used = 0;
+   arena->top = NULL;
+   arena->taskId = osGetCurrentTask();
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Leave a scratch arena
+ *
+ * The integers whose data still lives in the arena are moved to the heap so
+ * that they remain valid, then the whole region is erased and recycled
+ *
+ * @param[in] arena Pointer to the arena
+ * @return Error code
+ **/
+
+error_list mpiArenaLeave(MpiArena *arena)
+{
+   error_list error;
+   size_t offset;
+   uint_t *data;
+   MpiArenaBlock *block;
+
+   //Make sure the arena has been entered by the calling task
+   if(arena == NULL || mpiCurrentArena != arena ||
+      arena->taskId != osGetCurrentTask())
+   {
+      return ERROR_WRONG_STATE;
+   }
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Loop through the blocks
+   for(offset = 0; offset < arena->used; offset += block->size)
+   {
+      //Point to the current block
+      block = (MpiArenaBlock *) (arena->buffer + offset);
+      data = (uint_t *) (block + 1);
+
+      //Integer still in use?
+      if(block->live && block->owner != NULL && block->owner->data == data)
+      {
+         //Move the data to the heap
+         block->owner->data = cryptoAllocMem(block->owner->size * MPI_INT_SIZE);
+
+         //Successful memory allocation?
+         if(block->owner->data != NULL)
+         {
+            osMemcpy(block->owner->data, data, block->owner->size * MPI_INT_SIZE);
+            arena->moveCount++;
+         }
+         else
+         {
+            //The value of the integer is lost
+            block->owner->size = 0;
+            error = ERROR_OUT_OF_MEMORY;
+         }
+      }
+   }
+
+   //The arena may hold sensitive material
+   osMemset(arena->buffer, 0, arena->used);
+
+   //Reset the state of the arena
+   arena->used = 0;
+   arena->top = NULL;
+   arena->taskId = OS_INVALID_TASK_ID;
+
+   //The arena is no longer entered
+   mpiCurrentArena = NULL;
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Suspend the arena entered by the calling task
+ *
+ * While the arena is suspended, new integers are allocated from the heap.
+ * This is used for values that outlive the current computation and may be
+ * shared with other tasks
+ *
+ * @return Arena to be resumed, or NULL if the calling task has not entered
+ *   any arena
+ **/
+
+MpiArena *mpiArenaSuspend(void)
+{
+   MpiArena *arena;
+
+   //Point to the arena currently entered, if any
+   arena = mpiCurrentArena;
+
+   //Make sure the arena has been entered by the calling task
+   if(arena != NULL && arena->taskId == osGetCurrentTask())
+   {
+      //Stop serving allocations. Blocks of the arena can still be released
+      arena->taskId = OS_INVALID_TASK_ID;
+   }
+   else
+   {
+      //Nothing to suspend
+      arena = NULL;
+   }
+
+   //Return the suspended arena
+   return arena;
+}
+
+
+/**
+ * @brief Resume an arena suspended by mpiArenaSuspend
+ * @param[in] arena Arena returned by mpiArenaSuspend (may be NULL)
+ **/
+
+void mpiArenaResume(MpiArena *arena)
+{
+   //Any arena to resume?
+   if(arena != NULL && mpiCurrentArena == arena)
+   {
+      //Serve the allocations of the calling task again
+      arena->taskId = osGetCurrentTask();
+   }
+}
+
+#endif
+
+
 /**
  * @brief Get the actual length in words
  * @param[in] a Pointer to a multiple precision integer
@@ -1166,122 +1534,434 @@ error_list mpiShiftRight(Mpi *r, uint_t n)
 
 
 /**
- * @brief Multiple precision multiplication
- * @param[out] r Resulting integer R = A * B
- * @param[in] a First operand A
- * @param[in] b Second operand B
- * @return Error code
+ * @brief Add two word arrays
+ * @param[in,out] r Integer R of length n, replaced by R + A
+ * @param[in] a Integer A of length m, with m <= n
+ * @param[in] m Length of A, in words
+ * @param[in] n Length of R, in words
+ * @return Carry out of the most significant word
  **/
 
-__weak_func error_list mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
+static uint_t mpiAddCore(uint_t *r, const uint_t *a, uint_t m, uint_t n)
 {
-   error_list error;
-   int_t i;
-   int_t m;
-   int_t n;
-   Mpi ta;
-   Mpi tb;
-
-   //Initialize multiple precision integers
-   mpiInit(&ta);
-   mpiInit(&tb);
+   uint_t i;
+   uint_t c;
+   uint64_t temp;
 
-   //R and A are the same instance?
-   if(r == a)
+   //Add the words of A
+   for(c = 0, i = 0; i < m; i++)
    {
-      //Copy A to TA
-      MPI_CHECK(mpiCopy(&ta, a));
-      //Use TA instead of A
-      a = &ta;
+      temp = (uint64_t) r[i] + a[i] + c;
+      r[i] = (uint_t) temp;
+      c = (uint_t) (temp >> 32);
    }
 
-   //R and B are the same instance?
-   if(r == b)
+   //Propagate the carry
+   for(; i < n && c != 0; i++)
    {
-      //Copy B to TB
-      MPI_CHECK(mpiCopy(&tb, b));
-      //Use TB instead of B
-      b = &tb;
+      r[i] += c;
+      c = (r[i] < c);
    }
 
-   //Determine the actual length of A and B
-   m = mpiGetLength(a);
-   n = mpiGetLength(b);
+   //Return the carry
+   return c;
+}
 
-   //Adjust the size of R
-   MPI_CHECK(mpiGrow(r, m + n));
-   //Set the sign of R
-   r->sign = (a->sign == b->sign) ? 1 : -1;
 
-   //Clear the contents of the destination integer
-   osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+/**
+ * @brief Subtract two word arrays
+ * @param[in,out] r Integer R of length n, replaced by R - A
+ * @param[in] a Integer A of length m, with m <= n
+ * @param[in] m Length of A, in words
+ * @param[in] n Length of R, in words
+ * @return Borrow out of the most significant word
+ **/
 
-   //Perform multiplication
-   if(m < n)
+static uint_t mpiSubCore(uint_t *r, const uint_t *a, uint_t m, uint_t n)
+{
+   uint_t i;
+   uint_t c;
+   uint64_t temp;
+
+   //Subtract the words of A
+   for(c = 0, i = 0; i < m; i++)
    {
-      for(i = 0; i < m; i++)
-      {
-         mpiMulAccCore(&r->data[i], b->data, n, a->data[i]);
-      }
+      temp = (uint64_t) r[i] - a[i] - c;
+      r[i] = (uint_t) temp;
+      c = (uint_t) (temp >> 32) & 1;
    }
-   else
+
+   //Propagate the borrow
+   for(; i < n && c != 0; i++)
    {
-      for(i = 0; i < n; i++)
-      {
-         mpiMulAccCore(&r->data[i], a->data, m, b->data[i]);
-      }
+      c = (r[i] == 0);
+      r[i]--;
    }
 
-end:
-   //Release multiple precision integers
-   mpiFree(&ta);
-   mpiFree(&tb);
-
-   //Return status code
-   return error;
+   //Return the borrow
+   return c;
 }
 
 
 /**
- * @brief Multiply a multiple precision integer by an integer
- * @param[out] r Resulting integer R = A * B
- * @param[in] a First operand A
- * @param[in] b Second operand B
- * @return Error code
+ * @brief Compare two word arrays
+ * @param[in] a First integer
+ * @param[in] b Second integer
+ * @param[in] n Length of the integers, in words
+ * @return Comparison result
  **/
 
-error_list mpiMulInt(Mpi *r, const Mpi *a, int_t b)
+static int_t mpiCompCore(const uint_t *a, const uint_t *b, uint_t n)
 {
-   uint_t value;
-   Mpi t;
-
-   //Convert the second operand to a multiple precision integer
-   value = (b >= 0) ? b : -b;
-   t.sign = (b >= 0) ? 1 : -1;
-   t.size = 1;
-   t.data = &value;
+   //Compare the integers, starting with the most significant word
+   while(n-- > 0)
+   {
+      if(a[n] > b[n])
+         return 1;
+      else if(a[n] < b[n])
+         return -1;
+   }
 
-   //Perform multiplication
-   return mpiMul(r, a, &t);
+   //The integers are equal
+   return 0;
 }
 
 
 /**
- * @brief Multiple precision division
- * @param[out] q The quotient Q = A / B
- * @param[out] r The remainder R = A mod B
- * @param[in] a The dividend A
- * @param[in] b The divisor B
- * @return Error code
+ * @brief Squaring of a word array (schoolbook method)
+ * @param[out] r Resulting integer R = A^2, of length 2n
+ * @param[in] a Integer A
+ * @param[in] n Length of A, in words
  **/
 
-error_list mpiDiv(Mpi *q, Mpi *r, const Mpi *a, const Mpi *b)
+static void mpiSqrCore(uint_t *r, const uint_t *a, uint_t n)
 {
-   error_list error;
-   uint_t m;
-   uint_t n;
-   Mpi c;
-   Mpi d;
+   uint_t i;
+   uint_t c;
+   uint_t v;
+   uint64_t temp;
+
+   //Clear the result
+   osMemset(r, 0, 2 * n * MPI_INT_SIZE);
+
+   //Each cross product A[i] * A[j] (i < j) is computed once
+   for(i = 0; i + 1 < n; i++)
+   {
+      mpiMulAccCore(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+   }
+
+   //Double the cross products
+   for(c = 0, i = 0; i < 2 * n; i++)
+   {
+      v = r[i];
+      r[i] = (v << 1) | c;
+      c = v >> 31;
+   }
+
+   //Add the squares A[i]^2
+   for(c = 0, i = 0; i < n; i++)
+   {
+      temp = (uint64_t) a[i] * a[i] + r[2 * i] + c;
+      r[2 * i] = (uint_t) temp;
+      temp = (temp >> 32) + r[2 * i + 1];
+      r[2 * i + 1] = (uint_t) temp;
+      c = (uint_t) (temp >> 32);
+   }
+}
+
+
+/**
+ * @brief Size of the scratch area required by mpiMulCore
+ * @param[in] n Length of the operands, in words
+ * @return Size of the scratch area, in words
+ **/
+
+static uint_t mpiMulCoreScratchSize(uint_t n)
+{
+   uint_t size;
+
+   //Each level of recursion needs the two sums and their product
+   for(size = 0; n >= MPI_KARATSUBA_THRESHOLD; n -= n / 2)
+   {
+      size += 4 * (n - n / 2) + 2;
+   }
+
+   //Return the size of the scratch area
+   return size;
+}
+
+
+/**
+ * @brief Multiplication of word arrays (Karatsuba method)
+ *
+ * Operands shorter than MPI_KARATSUBA_THRESHOLD words are multiplied with
+ * the schoolbook method. Longer operands are split in two halves and
+ * multiplied with three half-size products instead of four. Squarings
+ * (A and B are the same array) use a dedicated path at each level
+ *
+ * @param[out] r Resulting integer R = A * B, of length 2n
+ * @param[in] a First operand A
+ * @param[in] b Second operand B
+ * @param[in] n Length of the operands, in words
+ * @param[in] t Scratch area (refer to mpiMulCoreScratchSize)
+ **/
+
+static void mpiMulCore(uint_t *r, const uint_t *a, const uint_t *b, uint_t n,
+   uint_t *t)
+{
+   uint_t i;
+   uint_t n0;
+   uint_t n1;
+   uint_t ca;
+   uint_t cb;
+   uint_t *sa;
+   uint_t *sb;
+   uint_t *z1;
+
+   //Small operands?
+   if(n < MPI_KARATSUBA_THRESHOLD)
+   {
+      //Squaring?
+      if(a == b)
+      {
+         mpiSqrCore(r, a, n);
+      }
+      else
+      {
+         //Clear the result
+         osMemset(r, 0, 2 * n * MPI_INT_SIZE);
+
+         //Schoolbook multiplication
+         for(i = 0; i < n; i++)
+         {
+            mpiMulAccCore(r + i, a, n, b[i]);
+         }
+      }
+   }
+   else
+   {
+      //Split the operands (A = A1 * 2^(32 * n0) + A0)
+      n0 = n / 2;
+      n1 = n - n0;
+
+      //Layout of the scratch area
+      sa = t;
+      sb = (a == b) ? sa : t + n1;
+      z1 = t + 2 * n1;
+      t = z1 + 2 * n1 + 2;
+
+      //Compute Z0 = A0 * B0 and Z2 = A1 * B1
+      mpiMulCore(r, a, (a == b) ? a : b, n0, t);
+      mpiMulCore(r + 2 * n0, a + n0, (a == b) ? a + n0 : b + n0, n1, t);
+
+      //Compute SA = A0 + A1
+      osMemcpy(sa, a + n0, n1 * MPI_INT_SIZE);
+      ca = mpiAddCore(sa, a, n0, n1);
+
+      //Compute SB = B0 + B1
+      if(a == b)
+      {
+         cb = ca;
+      }
+      else
+      {
+         osMemcpy(sb, b + n0, n1 * MPI_INT_SIZE);
+         cb = mpiAddCore(sb, b, n0, n1);
+      }
+
+      //Compute Z1 = SA * SB, taking the carries into account
+      mpiMulCore(z1, sa, sb, n1, t);
+      z1[2 * n1] = 0;
+      z1[2 * n1 + 1] = 0;
+
+      if(ca)
+      {
+         mpiAddCore(z1 + n1, sb, n1, n1 + 2);
+      }
+
+      if(cb)
+      {
+         mpiAddCore(z1 + n1, sa, n1, n1 + 2);
+      }
+
+      if(ca && cb)
+      {
+         z1[2 * n1]++;
+      }
+
+      //Compute Z1 = Z1 - Z0 - Z2 = A0 * B1 + A1 * B0
+      mpiSubCore(z1, r, 2 * n0, 2 * n1 + 2);
+      mpiSubCore(z1, r + 2 * n0, 2 * n1, 2 * n1 + 2);
+
+      //Compute R = Z2 * 2^(64 * n0) + Z1 * 2^(32 * n0) + Z0
+      mpiAddCore(r + n0, z1, 2 * n1 + 2, 2 * n - n0);
+   }
+}
+
+
+/**
+ * @brief Multiple precision multiplication
+ * @param[out] r Resulting integer R = A * B
+ * @param[in] a First operand A
+ * @param[in] b Second operand B
+ * @return Error code
+ **/
+
+__weak_func error_list mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
+{
+   error_list error;
+   int_t i;
+   int_t m;
+   int_t n;
+   uint_t l;
+   uint_t *buffer;
+   bool_t square;
+   Mpi ta;
+   Mpi tb;
+
+   //Initialize multiple precision integers
+   mpiInit(&ta);
+   mpiInit(&tb);
+
+   //Squaring?
+   square = (a == b);
+
+   //R and A are the same instance?
+   if(r == a)
+   {
+      //Copy A to TA
+      MPI_CHECK(mpiCopy(&ta, a));
+      //Use TA instead of A
+      a = &ta;
+   }
+
+   //R and B are the same instance?
+   if(r == b)
+   {
+      //Copy B to TB
+      MPI_CHECK(mpiCopy(&tb, b));
+      //Use TB instead of B
+      b = &tb;
+   }
+
+   //Determine the actual length of A and B
+   m = mpiGetLength(a);
+   n = mpiGetLength(b);
+
+   //Large operands of similar lengths?
+   if(m >= MPI_KARATSUBA_THRESHOLD && n >= MPI_KARATSUBA_THRESHOLD &&
+      m <= 2 * n && n <= 2 * m)
+   {
+      //Both operands are padded to the same length
+      l = MAX(m, n);
+
+      //Adjust the size of R
+      MPI_CHECK(mpiGrow(r, 2 * l));
+      //Set the sign of R
+      r->sign = (a->sign == b->sign) ? 1 : -1;
+
+      //Clear the contents of the destination integer
+      osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+
+      //Allocate a memory buffer for the padded operands and the scratch area
+      buffer = mpiAllocData(NULL, 2 * l + mpiMulCoreScratchSize(l));
+
+      //Failed to allocate memory?
+      if(buffer == NULL)
+      {
+         error = ERROR_OUT_OF_MEMORY;
+         goto end;
+      }
+
+      //Copy the operands
+      osMemset(buffer, 0, 2 * l * MPI_INT_SIZE);
+      osMemcpy(buffer, a->data, m * MPI_INT_SIZE);
+      osMemcpy(buffer + l, b->data, n * MPI_INT_SIZE);
+
+      //Perform Karatsuba multiplication
+      mpiMulCore(r->data, buffer, square ? buffer : buffer + l, l,
+         buffer + 2 * l);
+
+      //Release the memory buffer
+      mpiFreeData(buffer);
+   }
+   else
+   {
+      //Adjust the size of R
+      MPI_CHECK(mpiGrow(r, m + n));
+      //Set the sign of R
+      r->sign = (a->sign == b->sign) ? 1 : -1;
+
+      //Clear the contents of the destination integer
+      osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+
+      //Perform multiplication
+      if(m < n)
+      {
+         for(i = 0; i < m; i++)
+         {
+            mpiMulAccCore(&r->data[i], b->data, n, a->data[i]);
+         }
+      }
+      else
+      {
+         for(i = 0; i < n; i++)
+         {
+            mpiMulAccCore(&r->data[i], a->data, m, b->data[i]);
+         }
+      }
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&ta);
+   mpiFree(&tb);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Multiply a multiple precision integer by an integer
+ * @param[out] r Resulting integer R = A * B
+ * @param[in] a First operand A
+ * @param[in] b Second operand B
+ * @return Error code
+ **/
+
+error_list mpiMulInt(Mpi *r, const Mpi *a, int_t b)
+{
+   uint_t value;
+   Mpi t;
+
+   //Convert the second operand to a multiple precision integer
+   value = (b >= 0) ? b : -b;
+   t.sign = (b >= 0) ? 1 : -1;
+   t.size = 1;
+   t.data = &value;
+
+   //Perform multiplication
+   return mpiMul(r, a, &t);
+}
+
+
+/**
+ * @brief Multiple precision division
+ * @param[out] q The quotient Q = A / B
+ * @param[out] r The remainder R = A mod B
+ * @param[in] a The dividend A
+ * @param[in] b The divisor B
+ * @return Error code
+ **/
+
+error_list mpiDiv(Mpi *q, Mpi *r, const Mpi *a, const Mpi *b)
+{
+   error_list error;
+   uint_t m;
+   uint_t n;
+   Mpi c;
+   Mpi d;
    Mpi e;
 
    //Check whether the divisor is equal to zero
@@ -1582,17 +2262,14 @@ __weak_func error_list mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *
    int_t j;
    int_t n;
    uint_t d;
-   uint_t k;
    uint_t u;
    Mpi b;
-   Mpi c2;
-   Mpi t;
    Mpi s[8];
+   MpiMontgomeryContext context;
 
    //Initialize multiple precision integers
    mpiInit(&b);
-   mpiInit(&c2);
-   mpiInit(&t);
+   mpiMontgomeryInit(&context);
 
    //Initialize precomputed values
    for(i = 0; (uint_t) i < arraysize(s); i++)
@@ -1662,88 +2339,18 @@ __weak_func error_list mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *
    }
    else
    {
-      //Compute the smaller C = (2^32)^k such as C > P
-      k = mpiGetLength(p);
-
-      //Compute C^2 mod P
-      MPI_CHECK(mpiSetValue(&c2, 1));
-      MPI_CHECK(mpiShiftLeft(&c2, 2 * k * (MPI_INT_SIZE * 8)));
-      MPI_CHECK(mpiMod(&c2, &c2, p));
-
-      //Let B = A * C mod P
-      if(mpiComp(a, p) >= 0)
-      {
-         MPI_CHECK(mpiMod(&b, a, p));
-         MPI_CHECK(mpiMontgomeryMul(&b, &b, &c2, k, p, &t));
-      }
-      else
-      {
-         MPI_CHECK(mpiMontgomeryMul(&b, a, &c2, k, p, &t));
-      }
-
-      //Let R = B^2 * C^-1 mod P
-      MPI_CHECK(mpiMontgomeryMul(r, &b, &b, k, p, &t));
-      //Let S[0] = B
-      MPI_CHECK(mpiCopy(&s[0], &b));
-
-      //Precompute S[i] = B^(2 * i + 1) * C^-1 mod P
-      for(i = 1; i < (1 << (d - 1)); i++)
-      {
-         MPI_CHECK(mpiMontgomeryMul(&s[i], &s[i - 1], r, k, p, &t));
-      }
-
-      //Let R = C mod P
-      MPI_CHECK(mpiCopy(r, &c2));
-      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
-
-      //The exponent is processed in a left-to-right fashion
-      i = mpiGetBitLength(e) - 1;
-
-      //Perform sliding window exponentiation
-      while(i >= 0)
-      {
-         //The sliding window exponentiation algorithm decomposes E
-         //into zero and nonzero windows
-         if(!mpiGetBitValue(e, i))
-         {
-            //Compute R = R^2 * C^-1 mod P
-            MPI_CHECK(mpiMontgomeryMul(r, r, r, k, p, &t));
-            //Next bit to be processed
-            i--;
-         }
-         else
-         {
-            //Find the longest window
-            n = MAX(i - d + 1, 0);
-
-            //The least significant bit of the window must be equal to 1
-            while(!mpiGetBitValue(e, n)) n++;
-
-            //The algorithm processes more than one bit per iteration
-            for(u = 0, j = i; j >= n; j--)
-            {
-               //Compute R = R^2 * C^-1 mod P
-               MPI_CHECK(mpiMontgomeryMul(r, r, r, k, p, &t));
-               //Compute the relevant index to be used in the precomputed table
-               u = (u << 1) | mpiGetBitValue(e, j);
-            }
-
-            //Compute R = R * T[u/2] * C^-1 mod P
-            MPI_CHECK(mpiMontgomeryMul(r, r, &s[u >> 1], k, p, &t));
-            //Next bit to be processed
-            i = n - 1;
-         }
-      }
-
-      //Compute R = R * C^-1 mod P
-      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
+      //Size the result before the Montgomery context is allocated
+      MPI_CHECK(mpiGrow(r, mpiGetLength(p)));
+      //Precompute the modulus-dependent constants
+      MPI_CHECK(mpiMontgomeryLoadModulus(&context, p));
+      //Perform Montgomery exponentiation
+      MPI_CHECK(mpiExpModMontgomery(r, a, e, &context));
    }
 
 end:
    //Release multiple precision integers
    mpiFree(&b);
-   mpiFree(&c2);
-   mpiFree(&t);
+   mpiMontgomeryFree(&context);
 
    //Release precomputed values
    for(i = 0; (uint_t) i < arraysize(s); i++)
@@ -1888,6 +2495,400 @@ error_list mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t
 }
 
 
+/**
+ * @brief Initialize a Montgomery context
+ * @param[in] context Pointer to the Montgomery context
+ **/
+
+void mpiMontgomeryInit(MpiMontgomeryContext *context)
+{
+   //Initialize the constants
+   context->k = 0;
+   context->m = 0;
+
+   //Initialize multiple precision integers
+   mpiInit(&context->p);
+   mpiInit(&context->r2);
+}
+
+
+/**
+ * @brief Release a Montgomery context
+ * @param[in] context Pointer to the Montgomery context
+ **/
+
+void mpiMontgomeryFree(MpiMontgomeryContext *context)
+{
+   //Release multiple precision integers
+   mpiFree(&context->p);
+   mpiFree(&context->r2);
+
+   //Clear the constants
+   context->k = 0;
+   context->m = 0;
+}
+
+
+/**
+ * @brief Precompute the modulus-dependent constants
+ *
+ * The context can then be reused for any number of exponentiations with
+ * the same modulus
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[in] p Odd modulus P
+ * @return Error code
+ **/
+
+error_list mpiMontgomeryLoadModulus(MpiMontgomeryContext *context,
+   const Mpi *p)
+{
+   error_list error;
+   uint_t i;
+   uint_t k;
+   uint_t m;
+
+   //The modulus must be odd and positive
+   if(mpiIsEven(p) || mpiCompInt(p, 0) <= 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Compute the smaller R = (2^32)^k such as R > P
+   k = mpiGetLength(p);
+
+   //Use Newton's method to compute the inverse of P[0] mod 2^32
+   for(m = 2 - p->data[0], i = 0; i < 4; i++)
+   {
+      m = m * (2 - m * p->data[0]);
+   }
+
+   //Save the modulus. Both integers are at least k words long
+   MPI_CHECK(mpiCopy(&context->p, p));
+   MPI_CHECK(mpiGrow(&context->p, k));
+
+   //Compute R^2 mod P
+   MPI_CHECK(mpiSetValue(&context->r2, 1));
+   MPI_CHECK(mpiShiftLeft(&context->r2, 2 * k * (MPI_INT_SIZE * 8)));
+   MPI_CHECK(mpiMod(&context->r2, &context->r2, p));
+   MPI_CHECK(mpiGrow(&context->r2, k));
+
+   //Save the constants
+   context->k = k;
+   context->m = ~m + 1;
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Montgomery multiplication of word arrays
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A * B / 2^(32 * k) mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ * @param[in] b An integer B such as 0 <= B < P
+ * @param[in] t Scratch area (2k + 2 words, followed by the scratch area
+ *   of mpiMulCore)
+ **/
+
+static void mpiMontgomeryMulCore(const MpiMontgomeryContext *context,
+   uint_t *r, const uint_t *a, const uint_t *b, uint_t *t)
+{
+   uint_t i;
+   uint_t k;
+
+   //Length of the modulus
+   k = context->k;
+
+   //Compute T = A * B
+   mpiMulCore(t, a, b, k, t + 2 * k + 2);
+   t[2 * k] = 0;
+   t[2 * k + 1] = 0;
+
+   //Compute T = (T + Q * P) / 2^(32 * k), with Q chosen so that the lower
+   //words vanish
+   for(i = 0; i < k; i++)
+   {
+      mpiMulAccCore(t + i, context->p.data, k, t[i] * context->m);
+   }
+
+   //A final subtraction is required
+   if(t[2 * k] != 0 || mpiCompCore(t + k, context->p.data, k) >= 0)
+   {
+      mpiSubCore(t + k, context->p.data, k, k + 1);
+   }
+
+   //Copy the result
+   osMemcpy(r, t + k, k * MPI_INT_SIZE);
+}
+
+
+/**
+ * @brief Modular exponentiation with the public exponent E = 65537
+ *
+ * A is brought to the Montgomery domain, squared 16 times, and the final
+ * multiplication by A (taken outside the Montgomery domain) yields the
+ * result directly
+ *
+ * @param[out] r Resulting integer R = A ^ 65537 mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] context Montgomery context of the modulus P
+ * @return Error code
+ **/
+
+static error_list mpiExpModMontgomeryF4(Mpi *r, const Mpi *a,
+   const MpiMontgomeryContext *context)
+{
+   error_list error;
+   uint_t i;
+   uint_t k;
+   size_t size;
+   uint_t *buffer;
+   uint_t *b;
+   uint_t *c;
+   uint_t *t;
+   Mpi ta;
+
+   //Initialize multiple precision integer
+   mpiInit(&ta);
+
+   //Length of the modulus
+   k = context->k;
+
+   //Size the result before the temporaries are allocated
+   error = mpiGrow(r, k);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //B, C and scratch area
+   size = 2 * k + 2 * k + 2 + mpiMulCoreScratchSize(k);
+
+   //Allocate a single memory buffer for the whole computation
+   buffer = mpiAllocData(NULL, size);
+   //Failed to allocate memory?
+   if(buffer == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Layout of the memory buffer
+   b = buffer;
+   c = b + k;
+   t = c + k;
+
+   //Reduce A first
+   if(mpiComp(a, &context->p) >= 0 || a->sign < 0)
+   {
+      MPI_CHECK(mpiMod(&ta, a, &context->p));
+      a = &ta;
+   }
+
+   //Load A
+   osMemset(b, 0, k * MPI_INT_SIZE);
+   osMemcpy(b, a->data, MIN(a->size, k) * MPI_INT_SIZE);
+
+   //Let C = A * R mod P
+   mpiMontgomeryMulCore(context, c, b, context->r2.data, t);
+
+   //Compute C = A^(2^16) * R mod P
+   for(i = 0; i < 16; i++)
+   {
+      mpiMontgomeryMulCore(context, c, c, c, t);
+   }
+
+   //Compute C = A^(2^16) * A mod P
+   mpiMontgomeryMulCore(context, c, c, b, t);
+
+   //Copy the result
+   osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+   osMemcpy(r->data, c, k * MPI_INT_SIZE);
+   r->sign = 1;
+
+end:
+   //Erase the intermediate values before releasing the memory buffer
+   osMemset(buffer, 0, size * MPI_INT_SIZE);
+   mpiFreeData(buffer);
+
+   //Release multiple precision integer
+   mpiFree(&ta);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Modular exponentiation with a precomputed Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] context Montgomery context of the modulus P
+ * @return Error code
+ **/
+
+__weak_func error_list mpiExpModMontgomery(Mpi *r, const Mpi *a, const Mpi *e,
+   const MpiMontgomeryContext *context)
+{
+   error_list error;
+   int_t i;
+   int_t j;
+   int_t n;
+   uint_t d;
+   uint_t k;
+   uint_t u;
+   uint_t bitLen;
+   size_t size;
+   uint_t *buffer;
+   uint_t *s;
+   uint_t *b;
+   uint_t *c;
+   uint_t *t;
+   Mpi ta;
+
+   //Make sure the context has been loaded
+   if(context->k == 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Fast path for the common public exponent E = 65537
+   if(mpiCompInt(e, 65537) == 0)
+      return mpiExpModMontgomeryF4(r, a, context);
+
+   //Initialize multiple precision integer
+   mpiInit(&ta);
+
+   //Length of the modulus
+   k = context->k;
+   //Length of the exponent
+   bitLen = mpiGetBitLength(e);
+
+   //Select the window size. Very small exponents are often selected with
+   //low Hamming weight, so that the sliding window mechanism is disabled
+   if(bitLen > 671 && MPI_EXP_MAX_WINDOW_SIZE >= 6)
+      d = 6;
+   else if(bitLen > 239 && MPI_EXP_MAX_WINDOW_SIZE >= 5)
+      d = 5;
+   else if(bitLen > 79 && MPI_EXP_MAX_WINDOW_SIZE >= 4)
+      d = 4;
+   else if(bitLen > 32 && MPI_EXP_MAX_WINDOW_SIZE >= 3)
+      d = 3;
+   else
+      d = 1;
+
+   //Size the result before the temporaries are allocated, so that their
+   //memory can be reclaimed at once when a scratch arena is entered
+   error = mpiGrow(r, k);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Precomputed values, B, C and scratch area
+   size = ((1 << (d - 1)) + 2) * k + 2 * k + 2 + mpiMulCoreScratchSize(k);
+
+   //Allocate a single memory buffer for the whole computation
+   buffer = mpiAllocData(NULL, size);
+   //Failed to allocate memory?
+   if(buffer == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Layout of the memory buffer
+   s = buffer;
+   b = s + (1 << (d - 1)) * k;
+   c = b + k;
+   t = c + k;
+
+   //Reduce A first
+   if(mpiComp(a, &context->p) >= 0 || a->sign < 0)
+   {
+      MPI_CHECK(mpiMod(&ta, a, &context->p));
+      a = &ta;
+   }
+
+   //Load A
+   osMemset(c, 0, k * MPI_INT_SIZE);
+   osMemcpy(c, a->data, MIN(a->size, k) * MPI_INT_SIZE);
+
+   //Let S[0] = A * R mod P
+   mpiMontgomeryMulCore(context, s, c, context->r2.data, t);
+
+   //Precompute S[i] = A^(2 * i + 1) * R mod P
+   if(d > 1)
+   {
+      //Let B = A^2 * R mod P
+      mpiMontgomeryMulCore(context, b, s, s, t);
+
+      for(i = 1; i < (1 << (d - 1)); i++)
+      {
+         mpiMontgomeryMulCore(context, s + i * k, s + (i - 1) * k, b, t);
+      }
+   }
+
+   //Let B = 1
+   osMemset(b, 0, k * MPI_INT_SIZE);
+   b[0] = 1;
+
+   //Let C = R mod P
+   mpiMontgomeryMulCore(context, c, context->r2.data, b, t);
+
+   //The exponent is processed in a left-to-right fashion
+   i = bitLen - 1;
+
+   //Perform sliding window exponentiation
+   while(i >= 0)
+   {
+      //The sliding window exponentiation algorithm decomposes E
+      //into zero and nonzero windows
+      if(!mpiGetBitValue(e, i))
+      {
+         //Compute C = C^2 / R mod P
+         mpiMontgomeryMulCore(context, c, c, c, t);
+         //Next bit to be processed
+         i--;
+      }
+      else
+      {
+         //Find the longest window
+         n = MAX(i - (int_t) d + 1, 0);
+
+         //The least significant bit of the window must be equal to 1
+         while(!mpiGetBitValue(e, n)) n++;
+
+         //The algorithm processes more than one bit per iteration
+         for(u = 0, j = i; j >= n; j--)
+         {
+            //Compute C = C^2 / R mod P
+            mpiMontgomeryMulCore(context, c, c, c, t);
+            //Compute the relevant index to be used in the precomputed table
+            u = (u << 1) | mpiGetBitValue(e, j);
+         }
+
+         //Compute C = C * S[u/2] / R mod P
+         mpiMontgomeryMulCore(context, c, c, s + (u >> 1) * k, t);
+         //Next bit to be processed
+         i = n - 1;
+      }
+   }
+
+   //Compute C = C / R mod P
+   mpiMontgomeryMulCore(context, c, c, b, t);
+
+   //Copy the result
+   MPI_CHECK(mpiGrow(r, k));
+   osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+   osMemcpy(r->data, c, k * MPI_INT_SIZE);
+   r->sign = 1;
+
+end:
+   //Erase the intermediate values before releasing the memory buffer
+   osMemset(buffer, 0, size * MPI_INT_SIZE);
+   mpiFreeData(buffer);
+
+   //Release multiple precision integer
+   mpiFree(&ta);
+
+   //Return status code
+   return error;
+}
+
+
 #if (MPI_ASM_SUPPORT == DISABLED)
 
 /**
@@ -1902,30 +2903,18 @@ void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b)
 {
    int_t i;
    uint32_t c;
-   uint32_t u;
-   uint32_t v;
    uint64_t p;
 
-   //Clear variables
+   //Clear carry
    c = 0;
-   u = 0;
-   v = 0;
 
-   //Perform multiplication
+   //Perform multiplication. A[i] * B + R[i] + C always fits in 64 bits, so
+   //that the loop needs no conditional carry handling
    for(i = 0; i < m; i++)
    {
-      p = (uint64_t) a[i] * b;
-      u = (uint32_t) p;
-      v = (uint32_t) (p >> 32);
-
-      u += c;
-      if(u < c) v++;
-
-      u += r[i];
-      if(u < r[i]) v++;
-
-      r[i] = u;
-      c = v;
+      p = (uint64_t) a[i] * b + r[i] + c;
+      r[i] = (uint32_t) p;
+      c = (uint32_t) (p >> 32);
    }
 
    //Propagate carry
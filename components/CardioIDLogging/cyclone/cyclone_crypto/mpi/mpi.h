@@ -38,6 +38,27 @@
 //Size of the sub data type
 #define MPI_INT_SIZE sizeof(uint_t)
 
+//Operand length (in words) above which Karatsuba multiplication is used
+#ifndef MPI_KARATSUBA_THRESHOLD
+   #define MPI_KARATSUBA_THRESHOLD 32
+#elif (MPI_KARATSUBA_THRESHOLD < 4)
+   #error MPI_KARATSUBA_THRESHOLD parameter is not valid
+#endif
+
+//Maximum window size for modular exponentiation
+#ifndef MPI_EXP_MAX_WINDOW_SIZE
+   #define MPI_EXP_MAX_WINDOW_SIZE 5
+#elif (MPI_EXP_MAX_WINDOW_SIZE < 1 || MPI_EXP_MAX_WINDOW_SIZE > 6)
+   #error MPI_EXP_MAX_WINDOW_SIZE parameter is not valid
+#endif
+
+//Scratch arena for the temporaries of public-key operations
+#ifndef MPI_ARENA_SUPPORT
+   #define MPI_ARENA_SUPPORT DISABLED
+#elif (MPI_ARENA_SUPPORT != ENABLED && MPI_ARENA_SUPPORT != DISABLED)
+   #error MPI_ARENA_SUPPORT parameter is not valid
+#endif
+
 //Error code checking
 #define MPI_CHECK(f) if((error = f) != NO_ERROR) goto end
 
@@ -74,10 +95,58 @@ typedef struct
 } Mpi;
 
 
+/**
+ * @brief Montgomery context (modulus-dependent constants)
+ **/
+
+typedef struct
+{
+   uint_t k;  ///<Length of the modulus, in words
+   uint_t m;  ///<Precomputed value of -1/P[0] mod 2^32
+   Mpi p;     ///<Odd modulus P
+   Mpi r2;    ///<Precomputed value of R^2 mod P, with R = 2^(32 * k)
+} MpiMontgomeryContext;
+
+
+/**
+ * @brief Scratch arena for multiple precision integers
+ *
+ * While an arena is entered, the memory of the integers and of the internal
+ * scratch buffers allocated by the calling task is carved out of a region
+ * supplied by the caller rather than taken from the heap. Requests that do
+ * not fit fall back to the heap. When the arena is left, the integers that
+ * are still in use are moved to the heap and the whole region is recycled
+ **/
+
+typedef struct
+{
+   uint8_t *buffer;   ///<Memory region supplied by the caller
+   size_t size;       ///<Size of the memory region, in bytes
+   size_t used;       ///<Number of bytes currently in use
+   void *top;         ///<Most recently allocated block
+   OsTaskId taskId;   ///<Task that entered the arena
+   size_t peak;       ///<Highest number of bytes in use since the arena was entered
+   uint_t allocCount; ///<Number of allocations served by the arena
+   uint_t heapCount;  ///<Number of allocations that fell back to the heap
+   uint_t moveCount;  ///<Number of integers moved to the heap when leaving
+} MpiArena;
+
+
 //MPI related functions
 void mpiInit(Mpi *r);
 void mpiFree(Mpi *r);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+void mpiArenaInit(MpiArena *arena, void *buffer, size_t size);
+error_list mpiArenaEnter(MpiArena *arena);
+error_list mpiArenaLeave(MpiArena *arena);
+
+MpiArena *mpiArenaSuspend(void);
+void mpiArenaResume(MpiArena *arena);
+
+#endif
+
 error_list mpiGrow(Mpi *r, uint_t size);
 
 uint_t mpiGetLength(const Mpi *a);
@@ -138,6 +207,15 @@ error_list mpiMontgomeryMul(Mpi *r, const Mpi *a, const Mpi *b, uint_t k,
 
 error_list mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t);
 
+void mpiMontgomeryInit(MpiMontgomeryContext *context);
+void mpiMontgomeryFree(MpiMontgomeryContext *context);
+
+error_list mpiMontgomeryLoadModulus(MpiMontgomeryContext *context,
+   const Mpi *p);
+
+error_list mpiExpModMontgomery(Mpi *r, const Mpi *a, const Mpi *e,
+   const MpiMontgomeryContext *context);
+
 void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b);
 
 void mpiDump(FILE *stream, const char_t *prepend, const Mpi *a);
@@ -108,6 +108,8 @@ void dsaInitPublicKey(DsaPublicKey *key)
    dsaInitDomainParameters(&key->params);
    //Initialize public key value
    mpiInit(&key->y);
+   //No precomputed Montgomery constants
+   key->montContext = NULL;
 }
 
 
@@ -122,6 +124,8 @@ void dsaFreePublicKey(DsaPublicKey *key)
    dsaFreeDomainParameters(&key->params);
    //Free public key value
    mpiFree(&key->y);
+   //The Montgomery constants are not owned by the key
+   key->montContext = NULL;
 }
 
 
@@ -659,8 +663,21 @@ error_list dsaVerifySignature(const DsaPublicKey *key,
    MPI_CHECK(mpiMulMod(&u2, &signature->r, &w, &key->params.q));
 
    //Compute v = ((g ^ u1) * (y ^ u2) mod p) mod q
-   MPI_CHECK(mpiExpModFast(&v, &key->params.g, &u1, &key->params.p));
-   MPI_CHECK(mpiExpModFast(&w, &key->y, &u2, &key->params.p));
+   if(key->montContext != NULL &&
+      key->montContext->k == mpiGetLength(&key->params.p))
+   {
+      //Reuse the precomputed Montgomery constants of p
+      MPI_CHECK(mpiExpModMontgomery(&v, &key->params.g, &u1, key->montContext));
+      MPI_CHECK(mpiExpModMontgomery(&w, &key->y, &u2, key->montContext));
+   }
+   else
+   {
+      //Compute the exponentiations from scratch
+      MPI_CHECK(mpiExpModFast(&v, &key->params.g, &u1, &key->params.p));
+      MPI_CHECK(mpiExpModFast(&w, &key->y, &u2, &key->params.p));
+   }
+
+   //Combine both values
    MPI_CHECK(mpiMulMod(&v, &v, &w, &key->params.p));
    MPI_CHECK(mpiMod(&v, &v, &key->params.q));
 
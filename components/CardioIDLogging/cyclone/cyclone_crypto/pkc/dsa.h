@@ -59,8 +59,9 @@ typedef struct
 
 typedef struct
 {
-   DsaDomainParameters params; ///<DSA domain parameters
-   Mpi y;                      ///<Public key value
+   DsaDomainParameters params;              ///<DSA domain parameters
+   Mpi y;                                   ///<Public key value
+   const MpiMontgomeryContext *montContext; ///<Precomputed Montgomery constants of p (optional)
 } DsaPublicKey;
 
 
@@ -107,6 +107,8 @@ void rsaInitPublicKey(RsaPublicKey *key)
    //Initialize multiple precision integers
    mpiInit(&key->n);
    mpiInit(&key->e);
+   //No precomputed Montgomery constants
+   key->montContext = NULL;
 }
 
 
@@ -120,6 +122,8 @@ void rsaFreePublicKey(RsaPublicKey *key)
    //Free multiple precision integers
    mpiFree(&key->n);
    mpiFree(&key->e);
+   //The Montgomery constants are not owned by the key
+   key->montContext = NULL;
 }
 
 
@@ -759,6 +763,7 @@ error_list rsassaPkcs1v15Sign(const RsaPrivateKey *key, const HashAlgo *hash,
          //Retrieve modulus and public exponent
          publicKey.n = key->n;
          publicKey.e = key->e;
+         publicKey.montContext = NULL;
 
          //Apply the RSAVP1 verification primitive
          error = rsavp1(&publicKey, &s, &t);
@@ -1164,6 +1169,13 @@ __weak_func error_list rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
    if(mpiCompInt(m, 0) < 0 || mpiComp(m, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+   //Precomputed Montgomery constants of the modulus?
+   if(key->montContext != NULL && key->montContext->k == mpiGetLength(&key->n))
+   {
+      //Perform modular exponentiation (c = m ^ e mod n)
+      return mpiExpModMontgomery(c, m, &key->e, key->montContext);
+   }
+
    //Perform modular exponentiation (c = m ^ e mod n)
    return mpiExpModFast(c, m, &key->e, &key->n);
 }
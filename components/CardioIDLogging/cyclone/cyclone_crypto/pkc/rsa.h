@@ -48,8 +48,9 @@ extern "C" {
 
 typedef struct
 {
-   Mpi n; ///<Modulus
-   Mpi e; ///<Public exponent
+   Mpi n;                                   ///<Modulus
+   Mpi e;                                   ///<Public exponent
+   const MpiMontgomeryContext *montContext; ///<Precomputed Montgomery constants of the modulus (optional)
 } RsaPublicKey;
 
 
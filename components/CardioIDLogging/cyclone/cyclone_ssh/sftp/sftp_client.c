@@ -34,6 +34,8 @@
 //Dependencies
 #include "ssh/ssh.h"
 #include "ssh/ssh_transport.h"
+#include "ssh/ssh_request.h"
+#include "ssh/ssh_profiler.h"
 #include "sftp/sftp_client.h"
 #include "sftp/sftp_client_packet.h"
 #include "sftp/sftp_client_misc.h"
@@ -62,6 +64,21 @@ error_list sftpClientInit(SftpClientContext *context)
    context->state = SFTP_CLIENT_STATE_DISCONNECTED;
    //Default timeout
    context->timeout = SFTP_CLIENT_DEFAULT_TIMEOUT;
+   //The SSH connection is owned by the context itself
+   context->owner = context;
+
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //A single SSH channel is available by default
+   context->sshChannels = &context->sshChannel;
+   context->numSshChannels = 1;
+
+   //Create a mutex to prevent simultaneous access to the SSH connection
+   if(!osCreateMutex(&context->mutex))
+   {
+      //Failed to create mutex
+      return ERROR_OUT_OF_RESOURCES;
+   }
+#endif
 
    //Successful processing
    return NO_ERROR;
@@ -111,6 +128,41 @@ error_list sftpClientSetTimeout(SftpClientContext *context, systime_t timeout)
 }
 
 
+/**
+ * @brief Coalesce small writes into full-size SSH packets
+ *
+ * The settings apply to the SSH channel of the session, from the next time
+ * it is opened. Each SFTP request is flushed once complete, so that the
+ * server never waits for the coalescing delay
+ *
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] threshold Amount of buffered data that triggers a transmission
+ *   (0 to disable coalescing)
+ * @param[in] delay Maximum time data may be held in the TX buffer
+ * @return Error code
+ **/
+
+error_list sftpClientSetWriteCoalescing(SftpClientContext *context,
+   size_t threshold, systime_t delay)
+{
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || threshold > SSH_CHANNEL_BUFFER_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Save coalescing parameters
+   context->coalescingThreshold = threshold;
+   context->coalescingDelay = delay;
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Bind the SFTP client to a particular network interface
  * @param[in] context Pointer to the SFTP client context
@@ -183,6 +235,10 @@ error_list sftpClientConnect(SftpClientContext *context,
             //Force the socket to operate in non-blocking mode
             socketSetTimeout(context->sshConnection.socket, 0);
 
+            //The TCP connection is established
+            sshSetConnectionPhase(&context->sshConnection,
+               SSH_CONN_PHASE_VERSION_EXCHANGE);
+
             //Update SFTP client state
             sftpClientChangeState(context, SFTP_CLIENT_STATE_CHANNEL_OPEN);
          }
@@ -221,6 +277,56 @@ error_list sftpClientConnect(SftpClientContext *context,
          //Send the SSH_FXP_INIT request and wait for the server's response
          error = sftpClientSendCommand(context);
 
+         //Check status code
+         if(!error)
+         {
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+            //Query the server's limits if the extension has been advertised
+            if(context->limitsExtSupported)
+            {
+               //Format SSH_FXP_EXTENDED packet
+               error = sftpClientFormatFxpExtended(context,
+                  "limits@openssh.com");
+
+               //Check status code
+               if(!error)
+               {
+                  //Update SFTP client state
+                  sftpClientChangeState(context,
+                     SFTP_CLIENT_STATE_SENDING_COMMAND_3);
+               }
+            }
+            else
+#endif
+            {
+               //Format SSH_FXP_REALPATH packet
+               error = sftpClientFormatFxpRealPath(context, ".");
+
+               //Check status code
+               if(!error)
+               {
+                  //Update SFTP client state
+                  sftpClientChangeState(context,
+                     SFTP_CLIENT_STATE_SENDING_COMMAND_2);
+               }
+            }
+         }
+      }
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+      else if(context->state == SFTP_CLIENT_STATE_SENDING_COMMAND_3)
+      {
+         //Send the "limits@openssh.com" request and wait for the server's
+         //response
+         error = sftpClientSendCommand(context);
+
+         //The server may reject the request with an SSH_FXP_STATUS response
+         if(error == ERROR_UNEXPECTED_RESPONSE)
+         {
+            //Fall back to the default request sizes
+            context->limitsExtSupported = FALSE;
+            error = NO_ERROR;
+         }
+
          //Check status code
          if(!error)
          {
@@ -235,6 +341,7 @@ error_list sftpClientConnect(SftpClientContext *context,
             sftpClientChangeState(context, SFTP_CLIENT_STATE_SENDING_COMMAND_2);
          }
       }
+#endif
       else if(context->state == SFTP_CLIENT_STATE_SENDING_COMMAND_2)
       {
          //Send the SSH_FXP_REALPATH request and wait for the server's response
@@ -274,6 +381,12 @@ error_list sftpClientConnect(SftpClientContext *context,
                osStrcpy(context->currentDir, "");
             }
 
+            //Select the size of read and write requests for this session
+            sftpClientComputeRequestSizes(context);
+
+            //The SFTP session is set up
+            sshCommitConnectionProfile(&context->owner->sshConnection);
+
             //Update SFTP client state
             sftpClientChangeState(context, SFTP_CLIENT_STATE_CONNECTED);
          }
@@ -304,6 +417,94 @@ error_list sftpClientConnect(SftpClientContext *context,
 }
 
 
+/**
+ * @brief Specify the SSH channels that can be opened over the connection
+ *
+ * The table must provide one entry per SFTP session that will share the
+ * connection, including the session established by sftpClientConnect
+ *
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] channels SSH channels
+ * @param[in] numChannels Number of SSH channels
+ * @return Error code
+ **/
+
+error_list sftpClientSetChannels(SftpClientContext *context,
+   SshChannel *channels, uint_t numChannels)
+{
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || channels == NULL || numChannels == 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //The table must be specified before the SSH connection is established
+   if(context->state != SFTP_CLIENT_STATE_DISCONNECTED)
+      return ERROR_WRONG_STATE;
+
+   //Save the table of SSH channels
+   context->sshChannels = channels;
+   context->numSshChannels = numChannels;
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Open an additional SFTP session over an existing connection
+ *
+ * A new "session" channel is opened over the SSH connection of the specified
+ * SFTP client context, and the "sftp" subsystem is started on it. The key
+ * exchange and user authentication are not repeated. Each context may be
+ * driven by its own task
+ *
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] owner SFTP client context that owns the SSH connection
+ * @return Error code
+ **/
+
+error_list sftpClientOpenChannel(SftpClientContext *context,
+   SftpClientContext *owner)
+{
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || owner == NULL || context == owner)
+      return ERROR_INVALID_PARAMETER;
+
+   //Check current state
+   if(context->state == SFTP_CLIENT_STATE_DISCONNECTED)
+   {
+      //The connection must be established and authenticated
+      if(owner->owner != owner ||
+         !sshIsConnectionEstablished(&owner->sshConnection))
+      {
+         return ERROR_NOT_CONNECTED;
+      }
+
+      //Attach the SFTP session to the existing SSH connection
+      context->owner = owner;
+      //Open a new SSH channel
+      sftpClientChangeState(context, SFTP_CLIENT_STATE_CHANNEL_OPEN);
+   }
+   else if(context->owner != owner)
+   {
+      //Invalid state
+      return ERROR_WRONG_STATE;
+   }
+
+   //The remaining steps are the same as for the first SFTP session
+   return sftpClientConnect(context, NULL, 0);
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Get current working directory
  * @param[in] context Pointer to the SFTP client context
@@ -591,7 +792,7 @@ error_list sftpClientReadDir(SftpClientContext *context, SftpDirEntry *dirEntry)
          else if(context->responseLen < n)
          {
             //Receive more data
-            error = sshReadChannel(&context->sshChannel, context->buffer +
+            error = sshReadChannel(context->channel, context->buffer +
                context->responseLen, n - context->responseLen, &n, 0);
 
             //Check status code
@@ -915,6 +1116,7 @@ error_list sftpClientWriteFile(SftpClientContext *context, const void *data,
    error_list error;
    size_t n;
    size_t totalLength;
+   uint_t writeFlags;
 
    //Make sure the SFTP client context is valid
    if(context == NULL)
@@ -938,8 +1140,9 @@ error_list sftpClientWriteFile(SftpClientContext *context, const void *data,
          //Send as much data as possible
          if(totalLength < length)
          {
-            //The maximum size of packets is determined by the client
-            n = MIN(length - totalLength, SFTP_CLIENT_MAX_PACKET_SIZE);
+            //The size of write requests is selected at connection time so
+            //that each request fills whole SSH packets
+            n = sftpClientGetWriteLen(context, length - totalLength);
 
             //Format SSH_FXP_WRITE packet
             error = sftpClientFormatFxpWrite(context, context->handle,
@@ -964,7 +1167,7 @@ error_list sftpClientWriteFile(SftpClientContext *context, const void *data,
          if(context->requestPos < context->requestLen)
          {
             //Send more data
-            error = sshWriteChannel(&context->sshChannel,
+            error = sshWriteChannel(context->channel,
                context->buffer + context->requestPos,
                context->requestLen - context->requestPos, &n, flags);
 
@@ -990,9 +1193,13 @@ error_list sftpClientWriteFile(SftpClientContext *context, const void *data,
             //Check whether there is any data left to write
             if(n > 0)
             {
+               //Flush the channel once the SSH_FXP_WRITE request is complete
+               writeFlags = (n == context->dataLen) ?
+                  (flags | SSH_FLAG_NO_DELAY) : flags;
+
                //Send more data
-               error = sshWriteChannel(&context->sshChannel,
-                  (uint8_t *) data + totalLength, n, &n, flags);
+               error = sshWriteChannel(context->channel,
+                  (uint8_t *) data + totalLength, n, &n, writeFlags);
 
                //Check status code
                if(error == NO_ERROR || error == ERROR_TIMEOUT)
@@ -1107,8 +1314,8 @@ error_list sftpClientReadFile(SftpClientContext *context, void *data, size_t siz
          //Read as much data as possible
          if(*received < size)
          {
-            //The maximum size of packets is determined by the client
-            n = MIN(size - *received, SFTP_CLIENT_MAX_PACKET_SIZE);
+            //The size of read requests is selected at connection time
+            n = MIN(size - *received, context->maxReadLen);
 
             //Format SSH_FXP_READ packet
             error = sftpClientFormatFxpRead(context, context->handle,
@@ -1176,7 +1383,7 @@ error_list sftpClientReadFile(SftpClientContext *context, void *data, size_t siz
          if(n > 0)
          {
             //Receive more data
-            error = sshReadChannel(&context->sshChannel, data, n, &n, flags);
+            error = sshReadChannel(context->channel, data, n, &n, flags);
 
             //Check status code
             if(!error)
@@ -1441,6 +1648,183 @@ SftpStatusCode sftpClientGetStatusCode(SftpClientContext *context)
 }
 
 
+/**
+ * @brief Check whether the connection with the SFTP server is still alive
+ *
+ * A "keepalive@openssh.com" global request is sent over the SSH connection.
+ * Any reply from the server (SSH_MSG_REQUEST_SUCCESS or
+ * SSH_MSG_REQUEST_FAILURE) proves that the connection is still usable
+ *
+ * @param[in] context Pointer to the SFTP client context
+ * @return Error code
+ **/
+
+error_list sftpClientKeepAlive(SftpClientContext *context)
+{
+   error_list error;
+   bool_t requestSent;
+   SshConnection *connection;
+
+   //Make sure the SFTP client context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The connection must be idle
+   if(context->state != SFTP_CLIENT_STATE_CONNECTED)
+      return ERROR_WRONG_STATE;
+
+   //Point to the SSH connection
+   connection = &context->owner->sshConnection;
+
+   //Initialize variables
+   error = NO_ERROR;
+   requestSent = FALSE;
+
+   //Save current time
+   context->timestamp = osGetSystemTime();
+
+   //Send the request and wait for the server's reply
+   while(!error)
+   {
+      //Check the state of the SSH connection
+      if(!sshIsConnectionEstablished(connection))
+      {
+         //The connection has been closed by the peer
+         error = ERROR_CONNECTION_CLOSING;
+      }
+      else if(!requestSent)
+      {
+         //Acquire exclusive access to the SSH connection
+         sftpClientLockConnection(context);
+
+         //The request can be sent only when the connection buffer is idle
+         if(sftpClientIsConnectionReady(context))
+         {
+            //Send an SSH_MSG_GLOBAL_REQUEST message
+            error = sshSendGlobalRequest(connection, "keepalive@openssh.com",
+               NULL, TRUE);
+
+            //Check status code
+            if(!error)
+            {
+               requestSent = TRUE;
+            }
+         }
+
+         //Release exclusive access to the SSH connection
+         sftpClientUnlockConnection(context);
+
+         //Wait for the pending packet to be processed, if any
+         if(!error && !requestSent)
+         {
+            error = sftpClientProcessEvents(context);
+         }
+      }
+      else if(connection->requestState == SSH_REQUEST_STATE_PENDING)
+      {
+         //Wait for the server's reply
+         error = sftpClientProcessEvents(context);
+      }
+      else
+      {
+         //The server has replied to the request
+         connection->requestState = SSH_REQUEST_STATE_IDLE;
+         //We are done
+         break;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Retrieve the limits that apply to the current session
+ * @param[in] context Pointer to the SFTP client context
+ * @param[out] limits Server limits and request sizes in use
+ * @return Error code
+ **/
+
+error_list sftpClientGetLimits(SftpClientContext *context,
+   SftpClientLimits *limits)
+{
+   //Check parameters
+   if(context == NULL || limits == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the SFTP client is connected
+   if(context->state != SFTP_CLIENT_STATE_CONNECTED)
+      return ERROR_WRONG_STATE;
+
+   //Clear structure
+   osMemset(limits, 0, sizeof(SftpClientLimits));
+
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+   //Limits advertised by the server, if any
+   if(context->limitsExtSupported)
+   {
+      *limits = context->limits;
+   }
+   else
+#endif
+   {
+      //The server has not advertised any limit
+      limits->maxPacketLen = SFTP_CLIENT_MAX_PACKET_SIZE;
+   }
+
+   //Return the request sizes actually used by the client
+   limits->maxReadLen = context->maxReadLen;
+   limits->maxWriteLen = context->maxWriteLen;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Retrieve the statistics of the underlying SSH connection
+ * @param[in] context Pointer to the SFTP client context
+ * @param[out] stats Packet and byte counters
+ * @return Error code
+ **/
+
+error_list sftpClientGetConnectionStats(SftpClientContext *context,
+   SshConnectionStats *stats)
+{
+   //Make sure the SFTP client context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Retrieve connection statistics
+   return sshGetConnectionStats(&context->owner->sshConnection, stats);
+}
+
+
+/**
+ * @brief Retrieve the setup profile of the underlying SSH connection
+ * @param[in] context Pointer to the SFTP client context
+ * @param[out] profile Time spent by the connection in each setup phase
+ * @return Error code
+ **/
+
+error_list sftpClientGetConnectionProfile(SftpClientContext *context,
+   SshConnectionProfile *profile)
+{
+#if (SSH_PROFILER_SUPPORT == ENABLED)
+   //Make sure the SFTP client context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Retrieve the profile of the SSH connection
+   return sshGetConnectionProfile(&context->owner->sshConnection, profile);
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Gracefully disconnect from the SFTP server
  * @param[in] context Pointer to the SFTP client context
@@ -1471,20 +1855,34 @@ error_list sftpClientDisconnect(SftpClientContext *context)
       {
          //When either party wishes to terminate the channel, it sends an
          //SSH_MSG_CHANNEL_CLOSE message
-         error = sshCloseChannel(&context->sshChannel);
+         error = sshCloseChannel(context->channel);
 
          //Check status code
          if(error == NO_ERROR)
          {
-            //Send an SSH_MSG_DISCONNECT message
-            error = sshSendDisconnect(&context->sshConnection,
-               SSH_DISCONNECT_BY_APPLICATION, "Connection closed by user");
-
-            //Check status code
-            if(!error)
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+            //The SSH connection is shared with other SFTP sessions?
+            if(context->owner != context)
             {
+               //Release the SSH channel and leave the connection open
+               sftpClientCloseConnection(context);
                //Update SFTP client state
-               sftpClientChangeState(context, SFTP_CLIENT_STATE_DISCONNECTING_2);
+               sftpClientChangeState(context, SFTP_CLIENT_STATE_DISCONNECTED);
+            }
+            else
+#endif
+            {
+               //Send an SSH_MSG_DISCONNECT message
+               error = sshSendDisconnect(&context->sshConnection,
+                  SSH_DISCONNECT_BY_APPLICATION, "Connection closed by user");
+
+               //Check status code
+               if(!error)
+               {
+                  //Update SFTP client state
+                  sftpClientChangeState(context,
+                     SFTP_CLIENT_STATE_DISCONNECTING_2);
+               }
             }
          }
          else if(error == ERROR_WOULD_BLOCK || error == ERROR_TIMEOUT)
@@ -1597,6 +1995,11 @@ void sftpClientDeinit(SftpClientContext *context)
       //Close network connection
       sftpClientCloseConnection(context);
 
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+      //Release previously allocated resources
+      osDeleteMutex(&context->mutex);
+#endif
+
       //Clear SFTP client context
       osMemset(context, 0, sizeof(SftpClientContext));
    }
@@ -70,6 +70,27 @@
    #error SFTP_CLIENT_MAX_PACKET_SIZE parameter is not valid
 #endif
 
+//"limits@openssh.com" extension support
+#ifndef SFTP_CLIENT_LIMITS_EXT_SUPPORT
+   #define SFTP_CLIENT_LIMITS_EXT_SUPPORT ENABLED
+#elif (SFTP_CLIENT_LIMITS_EXT_SUPPORT != ENABLED && SFTP_CLIENT_LIMITS_EXT_SUPPORT != DISABLED)
+   #error SFTP_CLIENT_LIMITS_EXT_SUPPORT parameter is not valid
+#endif
+
+//Multiple SFTP sessions over a single SSH connection
+#ifndef SFTP_CLIENT_CHANNEL_SHARING_SUPPORT
+   #define SFTP_CLIENT_CHANNEL_SHARING_SUPPORT DISABLED
+#elif (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT != ENABLED && SFTP_CLIENT_CHANNEL_SHARING_SUPPORT != DISABLED)
+   #error SFTP_CLIENT_CHANNEL_SHARING_SUPPORT parameter is not valid
+#endif
+
+//Polling interval used when the SSH connection is shared
+#ifndef SFTP_CLIENT_SHARED_POLL_INTERVAL
+   #define SFTP_CLIENT_SHARED_POLL_INTERVAL 20
+#elif (SFTP_CLIENT_SHARED_POLL_INTERVAL < 1)
+   #error SFTP_CLIENT_SHARED_POLL_INTERVAL parameter is not valid
+#endif
+
 //Size of the buffer for input/output operations
 #ifndef SFTP_CLIENT_BUFFER_SIZE
    #define SFTP_CLIENT_BUFFER_SIZE 1024
@@ -124,15 +145,29 @@ typedef enum
    SFTP_CLIENT_STATE_CHANNEL_DATA       = 7,
    SFTP_CLIENT_STATE_SENDING_COMMAND_1  = 8,
    SFTP_CLIENT_STATE_SENDING_COMMAND_2  = 9,
-   SFTP_CLIENT_STATE_SENDING_DATA       = 10,
-   SFTP_CLIENT_STATE_RECEIVING_DATA     = 11,
-   SFTP_CLIENT_STATE_RECEIVING_NAME     = 12,
-   SFTP_CLIENT_STATE_DISCONNECTING_1    = 13,
-   SFTP_CLIENT_STATE_DISCONNECTING_2    = 14,
-   SFTP_CLIENT_STATE_DISCONNECTING_3    = 15
+   SFTP_CLIENT_STATE_SENDING_COMMAND_3  = 10,
+   SFTP_CLIENT_STATE_SENDING_DATA       = 11,
+   SFTP_CLIENT_STATE_RECEIVING_DATA     = 12,
+   SFTP_CLIENT_STATE_RECEIVING_NAME     = 13,
+   SFTP_CLIENT_STATE_DISCONNECTING_1    = 14,
+   SFTP_CLIENT_STATE_DISCONNECTING_2    = 15,
+   SFTP_CLIENT_STATE_DISCONNECTING_3    = 16
 } SftpClientState;
 
 
+/**
+ * @brief Server limits ("limits@openssh.com" extension)
+ **/
+
+typedef struct
+{
+   uint64_t maxPacketLen;   ///<Maximum number of bytes in a single SFTP packet
+   uint64_t maxReadLen;     ///<Largest length in an SSH_FXP_READ request
+   uint64_t maxWriteLen;    ///<Largest length in an SSH_FXP_WRITE request
+   uint64_t maxOpenHandles; ///<Maximum number of active handles (zero means unlimited)
+} SftpClientLimits;
+
+
 /**
  * @brief SSH initialization callback function
  **/
@@ -153,6 +188,10 @@ struct _SftpClientContext
    SftpClientSshInitCallback sshInitCallback;       ///<SSH initialization callback function
    systime_t timeout;                               ///<Timeout value
    systime_t timestamp;                             ///<Timestamp to manage timeout
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   size_t coalescingThreshold;                      ///<Write coalescing threshold of the SSH channel
+   systime_t coalescingDelay;                       ///<Write coalescing delay of the SSH channel
+#endif
    uint8_t buffer[SFTP_CLIENT_BUFFER_SIZE];         ///<Memory buffer for input/output operations
    SftpPacketType requestType;                      ///<Request type
    uint32_t requestId;                              ///<Request identifier
@@ -167,9 +206,22 @@ struct _SftpClientContext
    char_t currentDir[SFTP_CLIENT_MAX_PATH_LEN + 1]; ///<Current directory
    uint8_t handle[SFTP_CLIENT_MAX_HANDLE_SIZE];     ///<File handle (opaque string)
    size_t handleLen;                                ///<Length of the file handle, in bytes
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+   bool_t limitsExtSupported;                       ///<The server supports the "limits@openssh.com" extension
+   SftpClientLimits limits;                         ///<Limits advertised by the server
+#endif
+   size_t maxWriteLen;                              ///<Length of the data field of SSH_FXP_WRITE requests
+   size_t maxReadLen;                               ///<Length of the data requested by SSH_FXP_READ requests
    SshContext sshContext;                           ///<SSH context
    SshConnection sshConnection;                     ///<SSH connection
    SshChannel sshChannel;                           ///<SSH channel
+   SftpClientContext *owner;                        ///<SFTP client context that owns the SSH connection
+   SshChannel *channel;                             ///<SSH channel used by the SFTP session
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   SshChannel *sshChannels;                         ///<SSH channels that can be opened over the connection
+   uint_t numSshChannels;                           ///<Number of SSH channels
+   OsMutex mutex;                                   ///<Mutex preventing simultaneous access to the SSH connection
+#endif
 };
 
 
@@ -195,12 +247,21 @@ error_list sftpClientRegisterSshInitCallback(SftpClientContext *context,
 
 error_list sftpClientSetTimeout(SftpClientContext *context, systime_t timeout);
 
+error_list sftpClientSetWriteCoalescing(SftpClientContext *context,
+   size_t threshold, systime_t delay);
+
 error_list sftpClientBindToInterface(SftpClientContext *context,
    NetInterface *interface);
 
 error_list sftpClientConnect(SftpClientContext *context,
    const IpAddr *serverIpAddr, uint16_t serverPort);
 
+error_list sftpClientSetChannels(SftpClientContext *context,
+   SshChannel *channels, uint_t numChannels);
+
+error_list sftpClientOpenChannel(SftpClientContext *context,
+   SftpClientContext *owner);
+
 const char_t *sftpClientGetWorkingDir(SftpClientContext *context);
 
 error_list sftpClientChangeWorkingDir(SftpClientContext *context,
@@ -233,6 +294,17 @@ error_list sftpClientDeleteFile(SftpClientContext *context, const char_t *path);
 
 SftpStatusCode sftpClientGetStatusCode(SftpClientContext *context);
 
+error_list sftpClientKeepAlive(SftpClientContext *context);
+
+error_list sftpClientGetLimits(SftpClientContext *context,
+   SftpClientLimits *limits);
+
+error_list sftpClientGetConnectionStats(SftpClientContext *context,
+   SshConnectionStats *stats);
+
+error_list sftpClientGetConnectionProfile(SftpClientContext *context,
+   SshConnectionProfile *profile);
+
 error_list sftpClientDisconnect(SftpClientContext *context);
 error_list sftpClientClose(SftpClientContext *context);
 
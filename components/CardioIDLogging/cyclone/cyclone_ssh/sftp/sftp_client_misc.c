@@ -34,8 +34,11 @@
 //Dependencies
 #include "ssh/ssh.h"
 #include "ssh/ssh_connection.h"
+#include "ssh/ssh_channel.h"
 #include "ssh/ssh_request.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_packet.h"
+#include "ssh/ssh_profiler.h"
 #include "sftp/sftp_client.h"
 #include "sftp/sftp_client_packet.h"
 #include "sftp/sftp_client_misc.h"
@@ -75,9 +78,15 @@ error_list sftpClientOpenConnection(SftpClientContext *context)
    Socket *socket;
    SshConnection *connection;
 
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //Initialize SSH context
+   error = sshInit(&context->sshContext, &context->sshConnection, 1,
+      context->sshChannels, context->numSshChannels);
+#else
    //Initialize SSH context
    error = sshInit(&context->sshContext, &context->sshConnection, 1,
       &context->sshChannel, 1);
+#endif
    //Any error to report?
    if(error)
       return error;
@@ -145,50 +154,83 @@ error_list sftpClientEstablishConnection(SftpClientContext *context)
    SshChannel *channel;
 
    //Point to the SSH connection
-   connection = &context->sshConnection;
+   connection = &context->owner->sshConnection;
    //Point to the SSH channel
-   channel = &context->sshChannel;
+   channel = context->channel;
 
    //Check the state of the SSH connection
-   if(context->sshConnection.state < SSH_CONN_STATE_OPEN)
+   if(connection->state < SSH_CONN_STATE_OPEN)
    {
       //Perform SSH key exchange and user authentication
       error = sftpClientProcessEvents(context);
    }
-   else if(context->sshConnection.state == SSH_CONN_STATE_OPEN)
+   else if(connection->state == SSH_CONN_STATE_OPEN)
    {
       //Check the state of the SFTP client
       if(context->state == SFTP_CLIENT_STATE_CHANNEL_OPEN)
       {
-         //Allocate a new SSH channel
-         channel = sshCreateChannel(connection);
+         //Initialize status code
+         error = NO_ERROR;
+
+         //Acquire exclusive access to the SSH connection
+         sftpClientLockConnection(context);
 
-         //Valid channel handle?
-         if(channel != NULL)
+         //Messages are formatted directly in the buffer of the SSH connection,
+         //which may be in use by another SFTP session
+         if(sftpClientIsConnectionReady(context))
          {
-            //Force the channel to operate in non-blocking mode
-            error = sshSetChannelTimeout(channel, 0);
+            //Allocate a new SSH channel
+            channel = sshCreateChannel(connection);
 
-            //Check status code
-            if(!error)
+            //Valid channel handle?
+            if(channel != NULL)
             {
-               //The client sends an SSH_MSG_CHANNEL_OPEN message to the server
-               //in order to open a new channel
-               error = sshSendChannelOpen(channel, "session", NULL);
-            }
+               //Save the channel handle
+               context->channel = channel;
 
-            //Check status code
-            if(!error)
+               //Force the channel to operate in non-blocking mode
+               error = sshSetChannelTimeout(channel, 0);
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+               //Coalesce small writes into full-size SSH packets
+               if(!error && context->coalescingThreshold > 0)
+               {
+                  error = sshSetChannelWriteCoalescing(channel,
+                     context->coalescingThreshold, context->coalescingDelay);
+               }
+#endif
+
+               //Check status code
+               if(!error)
+               {
+                  //The client sends an SSH_MSG_CHANNEL_OPEN message to the
+                  //server in order to open a new channel
+                  error = sshSendChannelOpen(channel, "session", NULL);
+               }
+
+               //Check status code
+               if(!error)
+               {
+                  //Update SFTP client state
+                  sftpClientChangeState(context,
+                     SFTP_CLIENT_STATE_CHANNEL_OPEN_REPLY);
+               }
+            }
+            else
             {
-               //Update SFTP client state
-               sftpClientChangeState(context,
-                  SFTP_CLIENT_STATE_CHANNEL_OPEN_REPLY);
+               //Report an error
+               error = ERROR_OPEN_FAILED;
             }
          }
-         else
+
+         //Release exclusive access to the SSH connection
+         sftpClientUnlockConnection(context);
+
+         //The connection buffer is not available yet?
+         if(!error && context->state == SFTP_CLIENT_STATE_CHANNEL_OPEN)
          {
-            //Report an error
-            error = ERROR_OPEN_FAILED;
+            //Process SSH connection events
+            error = sftpClientProcessEvents(context);
          }
       }
       else if(context->state == SFTP_CLIENT_STATE_CHANNEL_OPEN_REPLY)
@@ -208,6 +250,9 @@ error_list sftpClientEstablishConnection(SftpClientContext *context)
             {
                //An SSH_MSG_CHANNEL_OPEN_CONFIRMATION message has been received
                sftpClientChangeState(context, SFTP_CLIENT_STATE_CHANNEL_REQUEST);
+
+               //The subsystem request and SSH_FXP_INIT exchange follow
+               sshSetConnectionPhase(connection, SSH_CONN_PHASE_SFTP_INIT);
             }
             else if(channel->state == SSH_CHANNEL_STATE_CLOSED)
             {
@@ -229,15 +274,35 @@ error_list sftpClientEstablishConnection(SftpClientContext *context)
          requestParams.subsystemName.value = "sftp";
          requestParams.subsystemName.length = osStrlen("sftp");
 
-         //Send an SSH_MSG_CHANNEL_REQUEST message to the server
-         error = sshSendChannelRequest(channel, "subsystem", &requestParams,
-            TRUE);
+         //Initialize status code
+         error = NO_ERROR;
 
-         //Check status code
-         if(!error)
+         //Acquire exclusive access to the SSH connection
+         sftpClientLockConnection(context);
+
+         //Make sure the connection buffer is available
+         if(sftpClientIsConnectionReady(context))
          {
-            //Update SFTP client state
-            sftpClientChangeState(context, SFTP_CLIENT_STATE_CHANNEL_REPLY);
+            //Send an SSH_MSG_CHANNEL_REQUEST message to the server
+            error = sshSendChannelRequest(channel, "subsystem", &requestParams,
+               TRUE);
+
+            //Check status code
+            if(!error)
+            {
+               //Update SFTP client state
+               sftpClientChangeState(context, SFTP_CLIENT_STATE_CHANNEL_REPLY);
+            }
+         }
+
+         //Release exclusive access to the SSH connection
+         sftpClientUnlockConnection(context);
+
+         //The connection buffer is not available yet?
+         if(!error && context->state == SFTP_CLIENT_STATE_CHANNEL_REQUEST)
+         {
+            //Process SSH connection events
+            error = sftpClientProcessEvents(context);
          }
       }
       else if(context->state == SFTP_CLIENT_STATE_CHANNEL_REPLY)
@@ -294,6 +359,17 @@ error_list sftpClientEstablishConnection(SftpClientContext *context)
 
 void sftpClientCloseConnection(SftpClientContext *context)
 {
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //The SSH connection is shared with other SFTP sessions?
+   if(context->owner != context)
+   {
+      //Release the SSH channel, the connection itself is left open
+      sshDeleteChannel(context->channel);
+      context->channel = NULL;
+      return;
+   }
+#endif
+
    //Check the state of the SSH connection
    if(context->sshConnection.state != SSH_CONN_STATE_CLOSED)
    {
@@ -306,6 +382,99 @@ void sftpClientCloseConnection(SftpClientContext *context)
 }
 
 
+/**
+ * @brief Acquire exclusive access to the SSH connection
+ * @param[in] context Pointer to the SFTP client context
+ **/
+
+void sftpClientLockConnection(SftpClientContext *context)
+{
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //The mutex belongs to the context that owns the connection
+   osAcquireMutex(&context->owner->mutex);
+#endif
+}
+
+
+/**
+ * @brief Release exclusive access to the SSH connection
+ * @param[in] context Pointer to the SFTP client context
+ **/
+
+void sftpClientUnlockConnection(SftpClientContext *context)
+{
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //The mutex belongs to the context that owns the connection
+   osReleaseMutex(&context->owner->mutex);
+#endif
+}
+
+
+/**
+ * @brief Check whether a message can be formatted in the connection buffer
+ *
+ * The same buffer is used to transmit and receive SSH packets. It can only
+ * be used when no packet is pending in either direction
+ *
+ * @param[in] context Pointer to the SFTP client context
+ * @return TRUE if the connection buffer is available, else FALSE
+ **/
+
+bool_t sftpClientIsConnectionReady(SftpClientContext *context)
+{
+   SshConnection *connection;
+
+   //Point to the SSH connection
+   connection = &context->owner->sshConnection;
+
+   //Check whether the connection buffer is idle (no message other than key
+   //exchange messages can be sent while the keys are being renewed)
+   if(connection->state == SSH_CONN_STATE_OPEN &&
+      connection->txBufferLen == 0 && connection->rxBufferLen == 0)
+   {
+      return TRUE;
+   }
+   else
+   {
+      return FALSE;
+   }
+}
+
+
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+
+/**
+ * @brief Get the number of SSH channels in use over the connection
+ * @param[in] context Pointer to the SFTP client context
+ * @return Number of channels that are not free
+ **/
+
+uint_t sftpClientGetNumOpenChannels(SftpClientContext *context)
+{
+   uint_t i;
+   uint_t n;
+   SshContext *sshContext;
+
+   //Point to the SSH context
+   sshContext = &context->owner->sshContext;
+
+   //Loop through SSH channels
+   for(n = 0, i = 0; i < sshContext->numChannels; i++)
+   {
+      //Check whether the current channel is in use
+      if(sshContext->channels[i].state != SSH_CHANNEL_STATE_UNUSED)
+      {
+         n++;
+      }
+   }
+
+   //Return the number of channels in use
+   return n;
+}
+
+#endif
+
+
 /**
  * @brief Send SFTP request and wait for a response
  * @param[in] context Pointer to the SFTP client context
@@ -326,10 +495,11 @@ error_list sftpClientSendCommand(SftpClientContext *context)
       //Send SFTP request
       if(context->requestPos < context->requestLen)
       {
-         //Send more data
-         error = sshWriteChannel(&context->sshChannel,
+         //Send more data. The request is flushed as soon as it has been
+         //written in full, since the server cannot act upon part of it
+         error = sshWriteChannel(context->channel,
             context->buffer + context->requestPos,
-            context->requestLen - context->requestPos, &n, 0);
+            context->requestLen - context->requestPos, &n, SSH_FLAG_NO_DELAY);
 
          //Check status code
          if(error == NO_ERROR || error == ERROR_TIMEOUT)
@@ -344,7 +514,7 @@ error_list sftpClientSendCommand(SftpClientContext *context)
          if(context->responsePos < sizeof(SftpPacketHeader))
          {
             //Receive more data
-            error = sshReadChannel(&context->sshChannel,
+            error = sshReadChannel(context->channel,
                context->buffer + context->responsePos,
                sizeof(SftpPacketHeader) - context->responsePos, &n, 0);
 
@@ -365,7 +535,7 @@ error_list sftpClientSendCommand(SftpClientContext *context)
          else if(context->responsePos < context->responseLen)
          {
             //Receive more data
-            error = sshReadChannel(&context->sshChannel,
+            error = sshReadChannel(context->channel,
                context->buffer + context->responsePos,
                context->responseLen - context->responsePos, &n, 0);
 
@@ -410,11 +580,54 @@ error_list sftpClientProcessEvents(SftpClientContext *context)
 {
    error_list error;
    uint_t i;
+   systime_t timeout;
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   systime_t delay;
+#endif
    SshContext *sshContext;
    SshConnection *connection;
 
    //Point to the SSH context
-   sshContext = &context->sshContext;
+   sshContext = &context->owner->sshContext;
+   //Default timeout
+   timeout = context->timeout;
+
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //Only one SFTP session at a time can process the events of the connection
+   osAcquireMutex(&context->owner->mutex);
+
+   //When several channels are open, do not block for too long, so that the
+   //other SFTP sessions get a chance to check their own channel
+   if(sftpClientGetNumOpenChannels(context) > 1)
+   {
+      timeout = MIN(timeout, SFTP_CLIENT_SHARED_POLL_INTERVAL);
+   }
+#endif
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&sshContext->mutex);
+
+   //Wake up in time to send the data held back by write coalescing. Data
+   //that is due already is covered by the TX_READY event of the socket
+   for(i = 0; i < sshContext->numChannels; i++)
+   {
+      if(sshContext->channels[i].state == SSH_CHANNEL_STATE_OPEN)
+      {
+         //Get the time left before the buffered data must be sent
+         delay = sshGetChannelFlushDelay(&sshContext->channels[i]);
+
+         //Data held back?
+         if(delay > 0)
+         {
+            timeout = MIN(timeout, delay);
+         }
+      }
+   }
+
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&sshContext->mutex);
+#endif
 
    //Clear event descriptor set
    osMemset(sshContext->eventDesc, 0, sizeof(sshContext->eventDesc));
@@ -435,7 +648,7 @@ error_list sftpClientProcessEvents(SftpClientContext *context)
 
    //Wait for one of the set of sockets to become ready to perform I/O
    error = socketPoll(sshContext->eventDesc, sshContext->numConnections,
-      &sshContext->event, context->timeout);
+      &sshContext->event, timeout);
 
    //Verify status code
    if(error == NO_ERROR || error == ERROR_WAIT_CANCELED)
@@ -462,6 +675,11 @@ error_list sftpClientProcessEvents(SftpClientContext *context)
       }
    }
 
+#if (SFTP_CLIENT_CHANNEL_SHARING_SUPPORT == ENABLED)
+   //Release exclusive access to the SSH connection
+   osReleaseMutex(&context->owner->mutex);
+#endif
+
    //Check status code
    if(error == ERROR_WOULD_BLOCK || error == ERROR_TIMEOUT)
    {
@@ -602,6 +820,14 @@ error_list sftpClientParsePacket(SftpClientContext *context, const uint8_t *pack
          //Parse SSH_FXP_ATTRS packet
          error = sftpClientParseFxpAttrs(context, header->payload, fragLen);
       }
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+      else if(header->type == SSH_FXP_EXTENDED_REPLY)
+      {
+         //Parse SSH_FXP_EXTENDED_REPLY packet
+         error = sftpClientParseFxpExtendedReply(context, header->payload,
+            fragLen);
+      }
+#endif
       else
       {
          //Debug message
@@ -621,6 +847,132 @@ error_list sftpClientParsePacket(SftpClientContext *context, const uint8_t *pack
 }
 
 
+/**
+ * @brief Select the size of read and write requests
+ *
+ * The request sizes are derived from the limits advertised by the server
+ * ("limits@openssh.com" extension), the maximum packet size of the SSH
+ * channel and the initial window size. Whenever possible, a request is
+ * sized so that it fills a whole number of SSH packets
+ *
+ * @param[in] context Pointer to the SFTP client context
+ **/
+
+void sftpClientComputeRequestSizes(SftpClientContext *context)
+{
+   size_t n;
+   size_t maxPacketLen;
+   size_t maxWriteLen;
+   size_t maxReadLen;
+   SshChannel *channel;
+
+   //Point to the SSH channel
+   channel = context->channel;
+
+   //The maximum size of SFTP packets is determined by the client
+   maxPacketLen = SFTP_CLIENT_MAX_PACKET_SIZE;
+   maxWriteLen = SFTP_CLIENT_MAX_PACKET_SIZE;
+   maxReadLen = SFTP_CLIENT_MAX_PACKET_SIZE;
+
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+   //Honor the limits advertised by the server
+   if(context->limitsExtSupported)
+   {
+      //A value of zero means the limit is not specified
+      if(context->limits.maxPacketLen > 0)
+      {
+         maxPacketLen = (size_t) MIN(maxPacketLen, context->limits.maxPacketLen);
+      }
+
+      if(context->limits.maxWriteLen > 0)
+      {
+         maxWriteLen = (size_t) MIN(maxWriteLen, context->limits.maxWriteLen);
+      }
+
+      if(context->limits.maxReadLen > 0)
+      {
+         maxReadLen = (size_t) MIN(maxReadLen, context->limits.maxReadLen);
+      }
+   }
+#endif
+
+   //Make sure a complete SSH_FXP_WRITE request fits in the remote window, so
+   //that the transfer does not stall in the middle of a request
+   if(channel->txWindowSize > 0)
+   {
+      maxPacketLen = MIN(maxPacketLen, channel->txWindowSize);
+   }
+
+   //Enforce a sensible lower bound
+   maxPacketLen = MAX(maxPacketLen, SFTP_CLIENT_MIN_REQUEST_SIZE);
+
+   //The length of the data field is bounded by the packet length
+   n = SFTP_CLIENT_FXP_WRITE_OVERHEAD + SFTP_CLIENT_MAX_HANDLE_SIZE;
+   maxWriteLen = MIN(maxWriteLen, maxPacketLen - n);
+
+   //Likewise, the SSH_FXP_DATA response must not exceed the packet length
+   n = SFTP_CLIENT_FXP_DATA_OVERHEAD;
+   maxReadLen = MIN(maxReadLen, maxPacketLen - n);
+
+   //Maximum amount of data carried by an incoming SSH_MSG_CHANNEL_DATA
+   //message
+   n = MIN(channel->connection->maxPacketSize, channel->rxWindowTarget) -
+      SSH_CHANNEL_DATA_MSG_HEADER_SIZE;
+
+   //Round the SSH_FXP_DATA response down to a whole number of SSH packets
+   if((maxReadLen + SFTP_CLIENT_FXP_DATA_OVERHEAD) > n)
+   {
+      maxReadLen = (maxReadLen + SFTP_CLIENT_FXP_DATA_OVERHEAD) / n * n -
+         SFTP_CLIENT_FXP_DATA_OVERHEAD;
+   }
+
+   //Save request sizes
+   context->maxWriteLen = maxWriteLen;
+   context->maxReadLen = maxReadLen;
+
+   //Debug message
+   TRACE_INFO("SFTP request sizes: write = %" PRIuSIZE ", read = %" PRIuSIZE "\r\n",
+      context->maxWriteLen, context->maxReadLen);
+}
+
+
+/**
+ * @brief Get the length of the next SSH_FXP_WRITE request
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] length Number of data bytes that remain to be written
+ * @return Length of the data field of the request
+ **/
+
+size_t sftpClientGetWriteLen(SftpClientContext *context, size_t length)
+{
+   size_t n;
+   size_t m;
+   size_t headerLen;
+
+   //Total length of the SSH_FXP_WRITE header for the current handle
+   headerLen = SFTP_CLIENT_FXP_WRITE_OVERHEAD + context->handleLen;
+
+   //Maximum amount of data carried by an outgoing SSH_MSG_CHANNEL_DATA
+   //message (refer to RFC 4254, section 5.2)
+   m = context->channel->connection->maxPacketSize -
+      SSH_CHANNEL_DATA_MSG_HEADER_SIZE;
+   m = MIN(m, context->channel->maxPacketSize);
+
+   //Largest request permitted for this session
+   n = context->maxWriteLen;
+
+   //Round the request down to a whole number of SSH packets, in order to
+   //avoid sending a small trailing packet for each request
+   if(m > 0 && (n + headerLen) > m)
+   {
+      n = (n + headerLen) / m * m - headerLen;
+   }
+
+   //Short writes are sent as is
+   return MIN(n, length);
+}
+
+
 /**
  * @brief Determine whether a timeout error has occurred
  * @param[in] context Pointer to the SFTP client context
@@ -34,6 +34,13 @@
 //Dependencies
 #include "sftp/sftp_client.h"
 
+//Size of the SSH_FXP_WRITE packet header, excluding the handle
+#define SFTP_CLIENT_FXP_WRITE_OVERHEAD 25
+//Size of the SSH_FXP_DATA packet header
+#define SFTP_CLIENT_FXP_DATA_OVERHEAD 13
+//Smallest packet length used when selecting request sizes
+#define SFTP_CLIENT_MIN_REQUEST_SIZE 256
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +54,11 @@ error_list sftpClientOpenConnection(SftpClientContext *context);
 error_list sftpClientEstablishConnection(SftpClientContext *context);
 void sftpClientCloseConnection(SftpClientContext *context);
 
+void sftpClientLockConnection(SftpClientContext *context);
+void sftpClientUnlockConnection(SftpClientContext *context);
+bool_t sftpClientIsConnectionReady(SftpClientContext *context);
+uint_t sftpClientGetNumOpenChannels(SftpClientContext *context);
+
 error_list sftpClientSendCommand(SftpClientContext *context);
 error_list sftpClientProcessEvents(SftpClientContext *context);
 
@@ -56,6 +68,9 @@ error_list sftpClientParsePacketLength(SftpClientContext *context,
 error_list sftpClientParsePacket(SftpClientContext *context, const uint8_t *packet,
    size_t fragLen, size_t totalLen);
 
+void sftpClientComputeRequestSizes(SftpClientContext *context);
+size_t sftpClientGetWriteLen(SftpClientContext *context, size_t length);
+
 error_list sftpClientCheckTimeout(SftpClientContext *context);
 
 error_list sftpFormatPath(SftpClientContext *context, const char_t *path,
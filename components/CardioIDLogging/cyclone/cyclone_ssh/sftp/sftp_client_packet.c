@@ -1008,6 +1008,78 @@ error_list sftpClientFormatFxpRename(SftpClientContext *context,
 }
 
 
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+
+/**
+ * @brief Format SSH_FXP_EXTENDED packet
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] extendedRequest Name of the extended request
+ * @return Error code
+ **/
+
+error_list sftpClientFormatFxpExtended(SftpClientContext *context,
+   const char_t *extendedRequest)
+{
+   error_list error;
+   size_t n;
+   size_t length;
+   uint8_t *p;
+   SftpPacketHeader *header;
+
+   //Point to the buffer where to format the packet
+   header = (SftpPacketHeader *) context->buffer;
+
+   //Set packet type
+   header->type = SSH_FXP_EXTENDED;
+   //Total length of the packet
+   length = sizeof(uint8_t);
+
+   //Point the data payload
+   p = header->payload;
+
+   //The request identifier is used to match each response with the
+   //corresponding request
+   context->requestId++;
+
+   //Format request identifier
+   STORE32BE(context->requestId, p);
+
+   //Point to the next field
+   p += sizeof(uint32_t);
+   length += sizeof(uint32_t);
+
+   //The extended-request field is a string of the format "name@domain"
+   error = sshFormatString(extendedRequest, p, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Total length of the packet
+   length += n;
+
+   //Convert the length field to network byte order
+   header->length = htonl(length);
+
+   //The packet length does not include the length field itself
+   context->requestLen = length + sizeof(uint32_t);
+   context->requestPos = 0;
+   context->responseLen = 0;
+   context->responsePos = 0;
+
+   //Save the SFTP packet type
+   context->requestType = (SftpPacketType) header->type;
+
+   //Debug message
+   TRACE_INFO("Sending SSH_FXP_EXTENDED packet (%" PRIuSIZE " bytes)...\r\n", context->requestLen);
+   TRACE_VERBOSE_ARRAY("  ", context->buffer, context->requestLen);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Parse SSH_FXP_VERSION packet
  * @param[in] context Pointer to the SFTP client context
@@ -1048,6 +1120,12 @@ error_list sftpClientParseFxpVersion(SftpClientContext *context,
    p += sizeof(uint32_t);
    length -= sizeof(uint32_t);
 
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+   //Extensions are renegotiated for each session
+   context->limitsExtSupported = FALSE;
+   osMemset(&context->limits, 0, sizeof(SftpClientLimits));
+#endif
+
    //Parse extensions
    while(length > 0)
    {
@@ -1070,6 +1148,16 @@ error_list sftpClientParseFxpVersion(SftpClientContext *context,
       //Point to the next field
       p += sizeof(uint32_t) + extensionValue.length;
       length -= sizeof(uint32_t) + extensionValue.length;
+
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+      //The server advertises its limits through the "limits@openssh.com"
+      //extension (version "1")
+      if(sshCompareString(&extensionName, "limits@openssh.com") &&
+         sshCompareString(&extensionValue, "1"))
+      {
+         context->limitsExtSupported = TRUE;
+      }
+#endif
    }
 
    //Sanity check
@@ -1084,6 +1172,75 @@ error_list sftpClientParseFxpVersion(SftpClientContext *context,
 }
 
 
+#if (SFTP_CLIENT_LIMITS_EXT_SUPPORT == ENABLED)
+
+/**
+ * @brief Parse SSH_FXP_EXTENDED_REPLY packet
+ * @param[in] context Pointer to the SFTP client context
+ * @param[in] packet Pointer to packet
+ * @param[in] length Length of the packet, in bytes
+ * @return Error code
+ **/
+
+error_list sftpClientParseFxpExtendedReply(SftpClientContext *context,
+   const uint8_t *packet, size_t length)
+{
+   uint32_t id;
+   const uint8_t *p;
+
+   //Debug message
+   TRACE_INFO("SSH_FXP_EXTENDED_REPLY packet received (%" PRIuSIZE " bytes)...\r\n", length);
+   TRACE_VERBOSE_ARRAY("  ", packet, length);
+
+   //An SSH_FXP_EXTENDED_REPLY packet is sent in response to an
+   //SSH_FXP_EXTENDED request
+   if(context->requestType != SSH_FXP_EXTENDED)
+      return ERROR_INVALID_TYPE;
+
+   //Point to the first field of the packet
+   p = packet;
+
+   //Malformed packet?
+   if(length < sizeof(uint32_t))
+      return ERROR_INVALID_PACKET;
+
+   //Each response packet begins with the request identifier
+   id = LOAD32BE(p);
+
+   //The request identifier is used to match each response with the
+   //corresponding request
+   if(id != context->requestId)
+      return ERROR_WRONG_IDENTIFIER;
+
+   //Point to the next field
+   p += sizeof(uint32_t);
+   length -= sizeof(uint32_t);
+
+   //The only extended request issued by the client is "limits@openssh.com",
+   //whose reply consists of four uint64 fields
+   if(length != (4 * sizeof(uint64_t)))
+      return ERROR_INVALID_PACKET;
+
+   //Decode max-packet-length, max-read-length, max-write-length and
+   //max-open-handles fields
+   context->limits.maxPacketLen = LOAD64BE(p);
+   context->limits.maxReadLen = LOAD64BE(p + 8);
+   context->limits.maxWriteLen = LOAD64BE(p + 16);
+   context->limits.maxOpenHandles = LOAD64BE(p + 24);
+
+   //Debug message
+   TRACE_DEBUG("  Max Packet Length = %" PRIu64 "\r\n", context->limits.maxPacketLen);
+   TRACE_DEBUG("  Max Read Length = %" PRIu64 "\r\n", context->limits.maxReadLen);
+   TRACE_DEBUG("  Max Write Length = %" PRIu64 "\r\n", context->limits.maxWriteLen);
+   TRACE_DEBUG("  Max Open Handles = %" PRIu64 "\r\n", context->limits.maxOpenHandles);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Parse SSH_FXP_STATUS packet
  * @param[in] context Pointer to the SFTP client context
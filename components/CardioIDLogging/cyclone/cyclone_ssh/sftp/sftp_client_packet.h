@@ -79,9 +79,15 @@ error_list sftpClientFormatFxpStat(SftpClientContext *context,
 error_list sftpClientFormatFxpRename(SftpClientContext *context,
    const char_t *oldPath, const char_t *newPath);
 
+error_list sftpClientFormatFxpExtended(SftpClientContext *context,
+   const char_t *extendedRequest);
+
 error_list sftpClientParseFxpVersion(SftpClientContext *context,
    const uint8_t *packet, size_t length);
 
+error_list sftpClientParseFxpExtendedReply(SftpClientContext *context,
+   const uint8_t *packet, size_t length);
+
 error_list sftpClientParseFxpStatus(SftpClientContext *context,
    const uint8_t *packet, size_t length);
 
@@ -38,6 +38,7 @@
 #include "ssh/ssh_key_import.h"
 #include "ssh/ssh_cert_import.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_packet.h"
 #include "pkix/pem_import.h"
 #include "debug.h"
 
@@ -84,6 +85,12 @@ error_list sshInit(SshContext *context, SshConnection *connections,
    context->numChannels = numChannels;
    context->channels = channels;
 
+#if (SSH_MPI_ARENA_SIZE > 0)
+   //Initialize the scratch arena used by key exchange computations
+   mpiArenaInit(&context->mpiArena, context->mpiArenaBuffer,
+      SSH_MPI_ARENA_SIZE);
+#endif
+
    //Start of exception handling block
    do
    {
@@ -607,6 +614,108 @@ error_list sshRegisterEcdhSharedSecretCalcCallback(SshContext *context,
 }
 
 
+/**
+ * @brief Register a pool of precomputed ephemeral key pairs
+ *
+ * The Diffie-Hellman and ECDH key exchanges take their ephemeral key pair
+ * from the pool when one is available for the negotiated algorithm
+ *
+ * @param[in] context Pointer to the SSH context
+ * @param[in] pool Pointer to the key pool, initialized with sshInitKeyPool
+ * @return Error code
+ **/
+
+error_list sshRegisterKeyPool(SshContext *context, SshKeyPool *pool)
+{
+#if (SSH_KEY_POOL_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || pool == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&context->mutex);
+   //Save the key pool
+   context->keyPool = pool;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Register a cache of precomputed host key contexts
+ *
+ * The verification of RSA and DSA host key signatures reuses the Montgomery
+ * constants of the moduli found in the cache
+ *
+ * @param[in] context Pointer to the SSH context
+ * @param[in] cache Pointer to the key cache, initialized with sshInitKeyCache
+ * @return Error code
+ **/
+
+error_list sshRegisterKeyCache(SshContext *context, SshKeyCache *cache)
+{
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || cache == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&context->mutex);
+   //Save the key cache
+   context->keyCache = cache;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Register a connection setup profiler
+ *
+ * The time spent by each connection in the setup phases is accumulated
+ * into the histograms of the profiler
+ *
+ * @param[in] context Pointer to the SSH context
+ * @param[in] profiler Pointer to the profiler, initialized with sshInitProfiler
+ * @return Error code
+ **/
+
+error_list sshRegisterProfiler(SshContext *context, SshProfiler *profiler)
+{
+#if (SSH_PROFILER_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || profiler == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&context->mutex);
+   //Save the profiler
+   context->profiler = profiler;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Register global request callback function
  * @param[in] context Pointer to the SSH context
@@ -1928,6 +2037,235 @@ error_list sshSetPasswordChangePrompt(SshConnection *connection,
 }
 
 
+/**
+ * @brief Set the maximum size of channel data packets
+ *
+ * The value applies to the SSH_MSG_CHANNEL_DATA messages sent over the
+ * connection and is advertised to the peer when a channel is opened
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] maxPacketSize Maximum packet size, in bytes
+ * @return Error code
+ **/
+
+error_list sshSetConnectionMaxPacketSize(SshConnection *connection,
+   size_t maxPacketSize)
+{
+   //Check parameters
+   if(connection == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The packet must fit in the internal buffer
+   if(maxPacketSize <= SSH_CHANNEL_DATA_MSG_HEADER_SIZE ||
+      maxPacketSize > SSH_MAX_PACKET_SIZE)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Save maximum packet size
+   connection->maxPacketSize = maxPacketSize;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Set the flow-control window of the channels
+ *
+ * The initial window size applies to the channels opened afterwards. When
+ * auto-tuning is enabled, the windows may grow up to the size of the channel
+ * buffers as long as their sum does not exceed the memory cap
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] windowSize Initial window size of a channel, in bytes
+ * @param[in] memoryCap Upper bound on the sum of the channel windows, in bytes
+ * @return Error code
+ **/
+
+error_list sshSetConnectionWindowSize(SshConnection *connection,
+   size_t windowSize, size_t memoryCap)
+{
+   //Check parameters
+   if(connection == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The window cannot exceed the capacity of the receive buffer
+   if(windowSize < 128 || windowSize > SSH_CHANNEL_BUFFER_SIZE ||
+      memoryCap < windowSize)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Save window parameters
+   connection->channelWindowSize = windowSize;
+   connection->windowMemoryCap = memoryCap;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Enable or disable channel window auto-tuning
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] enable Grow the channel windows from the measured round-trip
+ *   time and delivery rate
+ * @return Error code
+ **/
+
+error_list sshEnableWindowAutoTuning(SshConnection *connection, bool_t enable)
+{
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+   //Check parameters
+   if(connection == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Enable or disable auto-tuning
+   connection->windowAutoTuning = enable;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Set the thresholds that trigger a key re-exchange
+ *
+ * The keys are renewed as soon as the number of bytes or packets exchanged
+ * with the current keys, or the time since they were taken into use, reaches
+ * its threshold. A zero threshold is ignored
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] bytes Number of bytes sent and received
+ * @param[in] packets Number of packets sent and received
+ * @param[in] interval Time interval, in milliseconds
+ * @return Error code
+ **/
+
+error_list sshSetConnectionRekeyLimits(SshConnection *connection,
+   uint64_t bytes, uint32_t packets, systime_t interval)
+{
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   //Check parameters
+   if(connection == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+
+   //Save thresholds
+   connection->rekeyBytes = bytes;
+   connection->rekeyPackets = packets;
+   connection->rekeyInterval = interval;
+
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Notify the SSH core of the event
+   sshNotifyEvent(connection->context);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Renew the keys of an open connection
+ *
+ * The key re-exchange is started by the SSH core as soon as the connection
+ * is idle. Channel data are held back until the new keys are in use
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @return Error code
+ **/
+
+error_list sshRekeyConnection(SshConnection *connection)
+{
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   //Check parameters
+   if(connection == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Request a key re-exchange
+   connection->rekeyRequest = TRUE;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Notify the SSH core of the event
+   sshNotifyEvent(connection->context);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Check whether a connection is open
+ *
+ * A connection remains open while its keys are being renewed, although
+ * channel data cannot be sent until the key re-exchange completes
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @return TRUE if the user is authenticated and the connection has not been
+ *   closed, else FALSE
+ **/
+
+bool_t sshIsConnectionEstablished(SshConnection *connection)
+{
+   bool_t established;
+
+   //Check the state of the connection
+   if(connection == NULL)
+   {
+      established = FALSE;
+   }
+   else if(connection->state == SSH_CONN_STATE_OPEN)
+   {
+      established = TRUE;
+   }
+   else if(connection->rekeyInProgress &&
+      connection->state != SSH_CONN_STATE_CLOSED &&
+      connection->state != SSH_CONN_STATE_DISCONNECT)
+   {
+      established = TRUE;
+   }
+   else
+   {
+      established = FALSE;
+   }
+
+   //Return TRUE if the connection is open
+   return established;
+}
+
+
 /**
  * @brief Create a new SSH channel
  * @param[in] connection Pointer to the SSH connection
@@ -1966,11 +2304,31 @@ SshChannel *sshCreateChannel(SshConnection *connection)
          //Reuse event objects and avoid recreating them whenever possible
          osMemcpy(&channel->event, &event, sizeof(OsEvent));
 
+         //Allocate TX and RX buffers
+         if(sshAllocChannelBuffers(channel))
+         {
+            //The channel cannot be used
+            channel->state = SSH_CHANNEL_STATE_UNUSED;
+            channel = NULL;
+            break;
+         }
+
          //Initialize channel's parameters
          channel->context = context;
          channel->connection = connection;
          channel->timeout = INFINITE_DELAY;
-         channel->rxWindowSize = SSH_CHANNEL_BUFFER_SIZE;
+         channel->rxWindowTarget = connection->channelWindowSize;
+         channel->rxWindowSize = channel->rxWindowTarget;
+
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+         //Start the first delivery rate sample
+         channel->rxSampleTimestamp = osGetSystemTime();
+#endif
+#if (SSH_STATS_SUPPORT == ENABLED)
+         //Keep track of the largest window in use
+         connection->stats.rxWindowSize = MAX(connection->stats.rxWindowSize,
+            channel->rxWindowTarget);
+#endif
 
          //When the implementation wish to open a new channel, it allocates a
          //local number for the channel (refer to RFC 4254, section 5.1)
@@ -2013,6 +2371,82 @@ error_list sshSetChannelTimeout(SshChannel *channel, systime_t timeout)
 }
 
 
+/**
+ * @brief Coalesce small writes into full-size SSH_MSG_CHANNEL_DATA messages
+ *
+ * Data written to the channel is held in the TX buffer until the buffered
+ * amount reaches the threshold, the oldest byte has been waiting for the
+ * specified delay, or the application flushes the channel
+ *
+ * @param[in] channel SSH channel handle
+ * @param[in] threshold Amount of buffered data that triggers a transmission
+ *   (0 to disable coalescing)
+ * @param[in] delay Maximum time data may be held in the TX buffer
+ * @return Error code
+ **/
+
+error_list sshSetChannelWriteCoalescing(SshChannel *channel, size_t threshold,
+   systime_t delay)
+{
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   //Check parameters
+   if(channel == NULL || threshold > SSH_CHANNEL_BUFFER_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&channel->context->mutex);
+
+   //Save coalescing parameters
+   channel->coalescingThreshold = threshold;
+   channel->coalescingDelay = delay;
+   channel->txTimestamp = osGetSystemTime();
+
+   //Data held back under the previous settings may now be sent
+   sshNotifyEvent(channel->context);
+
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&channel->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Send the data buffered on the specified channel without delay
+ * @param[in] channel SSH channel handle
+ * @return Error code
+ **/
+
+error_list sshFlushChannel(SshChannel *channel)
+{
+   //Make sure the SSH channel handle is valid
+   if(channel == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&channel->context->mutex);
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   //All the data currently in the TX buffer must be sent immediately
+   channel->flushLength = channel->txBuffer.length;
+#endif
+
+   //Notify the SSH core that data is pending in the send buffer
+   sshNotifyEvent(channel->context);
+
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&channel->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Write data to the specified channel
  * @param[in] channel SSH channel handle
@@ -2070,6 +2504,14 @@ error_list sshWriteChannel(SshChannel *channel, const void *data, size_t length,
                n = SSH_CHANNEL_BUFFER_SIZE - txBuffer->writePos;
             }
 
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+            //The coalescing delay runs from the oldest byte in the buffer
+            if(txBuffer->length == 0)
+            {
+               channel->txTimestamp = osGetSystemTime();
+            }
+#endif
+
             //Copy data
             osMemcpy(txBuffer->data + txBuffer->writePos, data, n);
 
@@ -2122,8 +2564,22 @@ error_list sshWriteChannel(SshChannel *channel, const void *data, size_t length,
       {
          channel->eofRequest = TRUE;
       }
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+      //The SSH_FLAG_NO_DELAY flag forces the buffered data to be sent
+      //immediately, whatever the coalescing settings
+      if((flags & SSH_FLAG_NO_DELAY) != 0)
+      {
+         channel->flushLength = txBuffer->length;
+      }
+#endif
    }
 
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Count the application writes
+   channel->connection->stats.txChannelWrites++;
+#endif
+
    //Notify the SSH core that data is pending in the send buffer
    sshNotifyEvent(channel->context);
 
@@ -2486,6 +2942,7 @@ error_list sshCloseChannel(SshChannel *channel)
       //and received SSH_MSG_CHANNEL_CLOSE
       if(channel->context->mode == SSH_OPERATION_MODE_SERVER)
       {
+         sshFreeChannelBuffers(channel);
          channel->state = SSH_CHANNEL_STATE_UNUSED;
       }
    }
@@ -2516,6 +2973,7 @@ void sshDeleteChannel(SshChannel *channel)
       //Acquire exclusive access to the SSH context
       osAcquireMutex(&channel->context->mutex);
       //Release SSH channel
+      sshFreeChannelBuffers(channel);
       channel->state = SSH_CHANNEL_STATE_UNUSED;
       //Release exclusive access to the SSH context
       osReleaseMutex(&channel->context->mutex);
@@ -2523,6 +2981,40 @@ void sshDeleteChannel(SshChannel *channel)
 }
 
 
+/**
+ * @brief Retrieve connection statistics
+ * @param[in] connection Pointer to the SSH connection
+ * @param[out] stats Snapshot of the packet and byte counters
+ * @return Error code
+ **/
+
+error_list sshGetConnectionStats(SshConnection *connection,
+   SshConnectionStats *stats)
+{
+   //Check parameters
+   if(connection == NULL || stats == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Take a consistent snapshot of the counters
+   *stats = connection->stats;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Connection statistics are not maintained
+   osMemset(stats, 0, sizeof(SshConnectionStats));
+
+   //Report an error
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Release SSH context
  * @param[in] context Pointer to the SSH context
@@ -2544,6 +3036,14 @@ void sshDeinit(SshContext *context)
       //Point to the structure describing the current connection
       connection = &context->connections[i];
 
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+      //Release internal buffer
+      if(connection->buffer != NULL)
+      {
+         sshFreeMem(connection->buffer);
+      }
+#endif
+
       //Clear associated structure
       osMemset(connection, 0, sizeof(SshConnection));
    }
@@ -2554,6 +3054,8 @@ void sshDeinit(SshContext *context)
       //Point to the structure describing the current channel
       channel = &context->channels[i];
 
+      //Release TX and RX buffers
+      sshFreeChannelBuffers(channel);
       //Release event object
       osDeleteEvent(&channel->event);
       //Clear associated structure
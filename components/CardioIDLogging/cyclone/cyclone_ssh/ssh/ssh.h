@@ -166,6 +166,113 @@
    #error SSH_ECDH_CALLBACK_SUPPORT parameter is not valid
 #endif
 
+//Connection statistics
+#ifndef SSH_STATS_SUPPORT
+   #define SSH_STATS_SUPPORT ENABLED
+#elif (SSH_STATS_SUPPORT != ENABLED && SSH_STATS_SUPPORT != DISABLED)
+   #error SSH_STATS_SUPPORT parameter is not valid
+#endif
+
+//Single-pass CTR encryption and HMAC computation
+#ifndef SSH_FUSED_CTR_HMAC_SUPPORT
+   #define SSH_FUSED_CTR_HMAC_SUPPORT DISABLED
+#elif (SSH_FUSED_CTR_HMAC_SUPPORT != ENABLED && SSH_FUSED_CTR_HMAC_SUPPORT != DISABLED)
+   #error SSH_FUSED_CTR_HMAC_SUPPORT parameter is not valid
+#endif
+
+//Size of the chunks processed by the cipher and the MAC in turn
+#ifndef SSH_FUSED_CHUNK_SIZE
+   #define SSH_FUSED_CHUNK_SIZE 512
+#elif (SSH_FUSED_CHUNK_SIZE < 16 || (SSH_FUSED_CHUNK_SIZE % 16) != 0)
+   #error SSH_FUSED_CHUNK_SIZE parameter is not valid
+#endif
+
+//Pool of precomputed ephemeral key pairs
+#ifndef SSH_KEY_POOL_SUPPORT
+   #define SSH_KEY_POOL_SUPPORT DISABLED
+#elif (SSH_KEY_POOL_SUPPORT != ENABLED && SSH_KEY_POOL_SUPPORT != DISABLED)
+   #error SSH_KEY_POOL_SUPPORT parameter is not valid
+#endif
+
+//Cache of precomputed host key contexts
+#ifndef SSH_KEY_CACHE_SUPPORT
+   #define SSH_KEY_CACHE_SUPPORT DISABLED
+#elif (SSH_KEY_CACHE_SUPPORT != ENABLED && SSH_KEY_CACHE_SUPPORT != DISABLED)
+   #error SSH_KEY_CACHE_SUPPORT parameter is not valid
+#endif
+
+//zlib@openssh.com compression support
+#ifndef SSH_ZLIB_SUPPORT
+   #define SSH_ZLIB_SUPPORT DISABLED
+#elif (SSH_ZLIB_SUPPORT != ENABLED && SSH_ZLIB_SUPPORT != DISABLED)
+   #error SSH_ZLIB_SUPPORT parameter is not valid
+#endif
+
+//Automatic key re-exchange
+#ifndef SSH_REKEY_SUPPORT
+   #define SSH_REKEY_SUPPORT DISABLED
+#elif (SSH_REKEY_SUPPORT != ENABLED && SSH_REKEY_SUPPORT != DISABLED)
+   #error SSH_REKEY_SUPPORT parameter is not valid
+#endif
+
+//Number of bytes after which the keys are renewed (0 means no limit)
+#ifndef SSH_DEFAULT_REKEY_BYTES
+   #define SSH_DEFAULT_REKEY_BYTES 1073741824
+#elif (SSH_DEFAULT_REKEY_BYTES < 0)
+   #error SSH_DEFAULT_REKEY_BYTES parameter is not valid
+#endif
+
+//Number of packets after which the keys are renewed (0 means no limit)
+#ifndef SSH_DEFAULT_REKEY_PACKETS
+   #define SSH_DEFAULT_REKEY_PACKETS 2147483648U
+#elif (SSH_DEFAULT_REKEY_PACKETS < 0)
+   #error SSH_DEFAULT_REKEY_PACKETS parameter is not valid
+#endif
+
+//Time after which the keys are renewed, in ms (0 means no limit)
+#ifndef SSH_DEFAULT_REKEY_INTERVAL
+   #define SSH_DEFAULT_REKEY_INTERVAL 3600000
+#elif (SSH_DEFAULT_REKEY_INTERVAL < 0)
+   #error SSH_DEFAULT_REKEY_INTERVAL parameter is not valid
+#endif
+
+//Channel window auto-tuning
+#ifndef SSH_WINDOW_AUTO_TUNING_SUPPORT
+   #define SSH_WINDOW_AUTO_TUNING_SUPPORT DISABLED
+#elif (SSH_WINDOW_AUTO_TUNING_SUPPORT != ENABLED && SSH_WINDOW_AUTO_TUNING_SUPPORT != DISABLED)
+   #error SSH_WINDOW_AUTO_TUNING_SUPPORT parameter is not valid
+#endif
+
+//Coalescing of small channel writes into full-size packets
+#ifndef SSH_CHANNEL_COALESCING_SUPPORT
+   #define SSH_CHANNEL_COALESCING_SUPPORT DISABLED
+#elif (SSH_CHANNEL_COALESCING_SUPPORT != ENABLED && SSH_CHANNEL_COALESCING_SUPPORT != DISABLED)
+   #error SSH_CHANNEL_COALESCING_SUPPORT parameter is not valid
+#endif
+
+//Connection setup profiling
+#ifndef SSH_PROFILER_SUPPORT
+   #define SSH_PROFILER_SUPPORT DISABLED
+#elif (SSH_PROFILER_SUPPORT != ENABLED && SSH_PROFILER_SUPPORT != DISABLED)
+   #error SSH_PROFILER_SUPPORT parameter is not valid
+#endif
+
+//Allocate connection and channel buffers only while they are in use
+#ifndef SSH_DYNAMIC_BUFFER_SUPPORT
+   #define SSH_DYNAMIC_BUFFER_SUPPORT DISABLED
+#elif (SSH_DYNAMIC_BUFFER_SUPPORT != ENABLED && SSH_DYNAMIC_BUFFER_SUPPORT != DISABLED)
+   #error SSH_DYNAMIC_BUFFER_SUPPORT parameter is not valid
+#endif
+
+//Size of the scratch arena used by key exchange computations (0 to disable)
+#ifndef SSH_MPI_ARENA_SIZE
+   #define SSH_MPI_ARENA_SIZE 0
+#elif (SSH_MPI_ARENA_SIZE < 0)
+   #error SSH_MPI_ARENA_SIZE parameter is not valid
+#elif (SSH_MPI_ARENA_SIZE > 0 && MPI_ARENA_SUPPORT != ENABLED)
+   #error SSH_MPI_ARENA_SIZE requires MPI_ARENA_SUPPORT
+#endif
+
 //Maximum number of keys the SSH entity can load
 #ifndef SSH_MAX_HOST_KEYS
    #define SSH_MAX_HOST_KEYS 3
@@ -236,6 +343,27 @@
    #error SSH_CHANNEL_BUFFER_SIZE parameter is not valid
 #endif
 
+//Default initial window size of a channel
+#ifndef SSH_DEFAULT_CHANNEL_WINDOW_SIZE
+   #define SSH_DEFAULT_CHANNEL_WINDOW_SIZE SSH_CHANNEL_BUFFER_SIZE
+#elif (SSH_DEFAULT_CHANNEL_WINDOW_SIZE < 128 || SSH_DEFAULT_CHANNEL_WINDOW_SIZE > SSH_CHANNEL_BUFFER_SIZE)
+   #error SSH_DEFAULT_CHANNEL_WINDOW_SIZE parameter is not valid
+#endif
+
+//Default upper bound on the sum of the channel windows of a connection
+#ifndef SSH_DEFAULT_WINDOW_MEMORY_CAP
+   #define SSH_DEFAULT_WINDOW_MEMORY_CAP (4 * SSH_CHANNEL_BUFFER_SIZE)
+#elif (SSH_DEFAULT_WINDOW_MEMORY_CAP < 128)
+   #error SSH_DEFAULT_WINDOW_MEMORY_CAP parameter is not valid
+#endif
+
+//Lower bound on the round-trip time used for window auto-tuning (in ms)
+#ifndef SSH_MIN_WINDOW_TUNING_RTT
+   #define SSH_MIN_WINDOW_TUNING_RTT 10
+#elif (SSH_MIN_WINDOW_TUNING_RTT < 1)
+   #error SSH_MIN_WINDOW_TUNING_RTT parameter is not valid
+#endif
+
 //Maximum length of identification string
 #ifndef SSH_MAX_ID_LEN
    #define SSH_MAX_ID_LEN 80
@@ -833,6 +961,13 @@
 //Size of buffer used for input/output operations
 #define SSH_BUFFER_SIZE (SSH_MAX_PACKET_SIZE + SSH_MAX_PACKET_OVERHEAD)
 
+//Number of socket event descriptors (the server also polls its listening socket)
+#if (SSH_SERVER_SUPPORT == ENABLED)
+   #define SSH_MAX_EVENT_DESC (SSH_MAX_CONNECTIONS + 1)
+#else
+   #define SSH_MAX_EVENT_DESC SSH_MAX_CONNECTIONS
+#endif
+
 //Forward declaration of SshContext structure
 struct _SshContext;
 #define SshContext struct _SshContext
@@ -845,6 +980,26 @@ struct _SshConnection;
 struct _SshChannel;
 #define SshChannel struct _SshChannel
 
+//Forward declaration of SshDeflateContext structure
+struct _SshDeflateContext;
+#define SshDeflateContext struct _SshDeflateContext
+
+//Forward declaration of SshInflateContext structure
+struct _SshInflateContext;
+#define SshInflateContext struct _SshInflateContext
+
+//Forward declaration of SshKeyPool structure
+struct _SshKeyPool;
+#define SshKeyPool struct _SshKeyPool
+
+//Forward declaration of SshKeyCache structure
+struct _SshKeyCache;
+#define SshKeyCache struct _SshKeyCache
+
+//Forward declaration of SshProfiler structure
+struct _SshProfiler;
+#define SshProfiler struct _SshProfiler
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -1030,6 +1185,24 @@ typedef enum
 } SshConnectionState;
 
 
+/**
+ * @brief Connection setup phases
+ **/
+
+typedef enum
+{
+   SSH_CONN_PHASE_DNS_LOOKUP       = 0,
+   SSH_CONN_PHASE_TCP_CONNECT      = 1,
+   SSH_CONN_PHASE_VERSION_EXCHANGE = 2,
+   SSH_CONN_PHASE_KEY_EXCHANGE     = 3,
+   SSH_CONN_PHASE_HOST_KEY_VERIFY  = 4,
+   SSH_CONN_PHASE_USER_AUTH        = 5,
+   SSH_CONN_PHASE_CHANNEL_OPEN     = 6,
+   SSH_CONN_PHASE_SFTP_INIT        = 7,
+   SSH_CONN_PHASE_COUNT            = 8
+} SshConnectionPhase;
+
+
 /**
  * @brief SSH channel state
  **/
@@ -1277,6 +1450,9 @@ typedef struct
    CipherContext cipherContext;              ///<Cipher context
    const HashAlgo *hashAlgo;                 ///<Hash algorithm for MAC operations
    HmacContext *hmacContext;                 ///<HMAC context
+#if (SSH_HMAC_SUPPORT == ENABLED)
+   HmacKeySchedule hmacKeySchedule;          ///<Precomputed HMAC inner and outer states
+#endif
    size_t macSize;                           ///<Size of the MAC tag, in bytes
    bool_t etm;                               ///<Encrypt-then-MAC
    uint8_t iv[SSH_MAX_CIPHER_BLOCK_SIZE];    ///<Initialization vector
@@ -1293,13 +1469,57 @@ typedef struct
 } SshEncryptionEngine;
 
 
+/**
+ * @brief SSH connection statistics
+ **/
+
+typedef struct
+{
+   uint32_t txPackets;        ///<Number of SSH packets sent
+   uint64_t txBytes;          ///<Number of bytes sent on the wire
+   uint64_t txChannelData;    ///<Number of channel data bytes sent
+   uint32_t txChannelPackets; ///<Number of SSH_MSG_CHANNEL_DATA messages sent
+   uint32_t rxPackets;        ///<Number of SSH packets received
+   uint64_t rxBytes;          ///<Number of bytes received from the wire
+   uint64_t rxChannelData;    ///<Number of channel data bytes received
+   uint32_t rxChannelPackets; ///<Number of SSH_MSG_CHANNEL_DATA messages received
+   uint32_t rxWindowAdjusts;  ///<Number of SSH_MSG_CHANNEL_WINDOW_ADJUST messages sent
+   uint32_t rxWindowGrowths;  ///<Number of times a channel window was enlarged
+   uint32_t rxWindowSize;     ///<Largest channel window in use, in bytes
+   uint32_t rtt;              ///<Last round-trip time used for window auto-tuning, in ms
+   uint64_t txPayload;        ///<Number of payload bytes sent, before compression
+   uint64_t txCompressed;     ///<Number of payload bytes sent, after compression
+   uint32_t rekeys;           ///<Number of completed key re-exchanges
+   uint32_t txChannelWrites;  ///<Number of calls to sshWriteChannel
+} SshConnectionStats;
+
+
+/**
+ * @brief Time spent by a connection in each setup phase
+ **/
+
+typedef struct
+{
+   SshConnectionPhase phase;                 ///<Current setup phase
+   systime_t timestamp;                      ///<Time at which the current phase started
+   systime_t startTime;                      ///<Time at which the connection was opened
+   uint32_t duration[SSH_CONN_PHASE_COUNT];  ///<Time spent in each phase, in ms
+   uint_t visited;                           ///<Bitmask of the phases the connection went through
+   bool_t done;                              ///<The profile has been committed
+} SshConnectionProfile;
+
+
 /**
  * @brief SSH channel buffer
  **/
 
 typedef struct
 {
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+   char_t *data;                         ///<Data buffer (allocated while the channel is in use)
+#else
    char_t data[SSH_CHANNEL_BUFFER_SIZE]; ///<Data buffer
+#endif
    size_t length;
    size_t threshold;
    size_t writePos;
@@ -1330,6 +1550,17 @@ struct _SshChannel
    size_t txWindowSize;          ///<TX flow-control window
    size_t rxWindowSize;          ///<RX flow-control window
    size_t rxWindowSizeInc;       ///<Window size increment
+   size_t rxWindowTarget;        ///<Window size maintained by the receiver
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+   systime_t rxSampleTimestamp;  ///<Start of the current delivery rate sample
+   size_t rxSampleBytes;         ///<Number of bytes received during the current sample
+#endif
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   size_t coalescingThreshold;   ///<Amount of buffered data that triggers a transmission
+   systime_t coalescingDelay;    ///<Maximum time data may be held in the TX buffer
+   systime_t txTimestamp;        ///<Time at which the oldest buffered data was written
+   size_t flushLength;           ///<Number of buffered bytes that must be sent without delay
+#endif
    bool_t channelSuccessSent;    ///<An SSH_MSG_CHANNEL_SUCCESS message has been sent
    bool_t eofRequest;            ///<Channel EOF request
    bool_t eofSent;               ///<An SSH_MSG_CHANNEL_EOF message has been sent
@@ -1351,6 +1582,7 @@ struct _SshConnection
    SshContext *context;                         ///<SSH context
    Socket *socket;                              ///<Underlying socket
    systime_t timestamp;                         ///<Time stamp to manage connection timeout
+   uint_t nextChannel;                          ///<Index of the channel served first by the next scheduling round
 
    char_t clientId[SSH_MAX_ID_LEN + 1];         ///<Client's identification string
    char_t serverId[SSH_MAX_ID_LEN + 1];         ///<Server's identification string
@@ -1400,11 +1632,16 @@ struct _SshConnection
 
    SshEncryptionEngine encryptionEngine;        ///<Encryption engine
    SshEncryptionEngine decryptionEngine;        ///<Decryption engine
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   SshDeflateContext *deflateContext;           ///<Compressor (outgoing packets)
+   SshInflateContext *inflateContext;           ///<Decompressor (incoming packets)
+#endif
 
    bool_t kexInitSent;                          ///<An SSH_MSG_KEXINIT message has been sent
    bool_t kexInitReceived;                      ///<An SSH_MSG_KEXINIT message has been received
    bool_t newKeysSent;                          ///<An SSH_MSG_NEWKEYS message has been sent
    bool_t newKeysReceived;                      ///<An SSH_MSG_NEWKEYS message has been received
+   bool_t rekeyInProgress;                      ///<A key re-exchange is in progress on the open connection
    bool_t disconnectRequest;                    ///<Request for disconnection
    bool_t disconnectSent;                       ///<An SSH_MSG_DISCONNECT message has been sent
    bool_t disconnectReceived;                   ///<An SSH_MSG_DISCONNECT message has been received
@@ -1412,12 +1649,45 @@ struct _SshConnection
    uint_t authAttempts;                         ///<Number of authentication attempts
    bool_t publicKeyOk;                          ///<The provided host key is acceptable
    uint32_t localChannelNum;                    ///<Current channel number
+   size_t maxPacketSize;                        ///<Maximum size of channel data packets
+   size_t channelWindowSize;                    ///<Initial window size of new channels
+   size_t windowMemoryCap;                      ///<Upper bound on the sum of the channel windows
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+   bool_t windowAutoTuning;                     ///<Grow channel windows from the measured RTT and delivery rate
+#endif
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   bool_t rekeyRequest;                         ///<Request for key re-exchange
+   uint64_t rekeyBytes;                         ///<Number of bytes after which the keys are renewed
+   uint32_t rekeyPackets;                       ///<Number of packets after which the keys are renewed
+   systime_t rekeyInterval;                     ///<Time after which the keys are renewed
+   uint64_t kexBytes;                           ///<Number of bytes sent and received with the current keys
+   uint32_t kexPackets;                         ///<Number of packets sent and received with the current keys
+   systime_t kexTimestamp;                      ///<Time at which the current keys were taken into use
+#endif
 
 #if (SSH_EXT_INFO_SUPPORT == ENABLED)
    bool_t extInfoReceived;                      ///<"ext-info-c" or "ext-info-s" indicator has been received
 #endif
 
+#if (SSH_STATS_SUPPORT == ENABLED)
+   SshConnectionStats stats;                    ///<Connection statistics
+#endif
+
+#if (SSH_PROFILER_SUPPORT == ENABLED)
+   SshConnectionProfile profile;                ///<Connection setup profile
+#endif
+
+#if (SSH_MPI_ARENA_SIZE > 0)
+   uint32_t kexMpiAllocs;                       ///<MPI allocations served by the scratch arena during the key exchange
+   uint32_t kexMpiHeapAllocs;                   ///<MPI allocations made from the heap during the key exchange
+   uint32_t kexMpiPeak;                         ///<Peak usage of the scratch arena during the key exchange, in bytes
+#endif
+
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+   uint8_t *buffer;                             ///<Internal buffer (allocated while the connection is open)
+#else
    uint8_t buffer[SSH_BUFFER_SIZE];             ///<Internal buffer
+#endif
    size_t txBufferLen;                          ///<Number of bytes that are pending to be sent
    size_t txBufferPos;                          ///<Current position in TX buffer
    size_t rxBufferLen;                          ///<Number of bytes available for reading
@@ -1474,6 +1744,19 @@ struct _SshContext
 #if (SSH_ECDH_CALLBACK_SUPPORT == ENABLED)
    SshEcdhKeyPairGenCallback ecdhKeyPairGenCallback;             ///<ECDH key pair generation callback
    SshEcdhSharedSecretCalcCallback ecdhSharedSecretCalcCallback; ///<ECDH shared secret calculation callback
+#endif
+#if (SSH_KEY_POOL_SUPPORT == ENABLED)
+   SshKeyPool *keyPool;                                          ///<Precomputed ephemeral key pairs
+#endif
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+   SshKeyCache *keyCache;                                        ///<Precomputed host key contexts
+#endif
+#if (SSH_PROFILER_SUPPORT == ENABLED)
+   SshProfiler *profiler;                                        ///<Connection setup profiler
+#endif
+#if (SSH_MPI_ARENA_SIZE > 0)
+   MpiArena mpiArena;                                            ///<Scratch arena for key exchange computations
+   uint8_t mpiArenaBuffer[SSH_MPI_ARENA_SIZE];                   ///<Memory region backing the scratch arena
 #endif
    SshGlobalReqCallback globalReqCallback[SSH_MAX_GLOBAL_REQ_CALLBACKS];             ///<Global request callbacks
    void *globalReqParam[SSH_MAX_GLOBAL_REQ_CALLBACKS];                               ///<Opaque pointer passed to the global request callback
@@ -1488,7 +1771,7 @@ struct _SshContext
 
    OsMutex mutex;                                                ///<Mutex preventing simultaneous access to the context
    OsEvent event;                                                ///<Event object used to poll the sockets
-   SocketEventDesc eventDesc[SSH_MAX_CONNECTIONS + 1];           ///<The events the application is interested in
+   SocketEventDesc eventDesc[SSH_MAX_EVENT_DESC];                ///<The events the application is interested in
 };
 
 
@@ -1549,6 +1832,10 @@ error_list sshRegisterEcdhKeyPairGenCallback(SshContext *context,
 error_list sshRegisterEcdhSharedSecretCalcCallback(SshContext *context,
    SshEcdhSharedSecretCalcCallback callback);
 
+error_list sshRegisterKeyPool(SshContext *context, SshKeyPool *pool);
+error_list sshRegisterKeyCache(SshContext *context, SshKeyCache *cache);
+error_list sshRegisterProfiler(SshContext *context, SshProfiler *profiler);
+
 error_list sshRegisterGlobalRequestCallback(SshContext *context,
    SshGlobalReqCallback callback, void *param);
 
@@ -1605,10 +1892,29 @@ error_list sshUnloadCertificate(SshContext *context, uint_t index);
 error_list sshSetPasswordChangePrompt(SshConnection *connection,
    const char_t *prompt);
 
+error_list sshSetConnectionMaxPacketSize(SshConnection *connection,
+   size_t maxPacketSize);
+
+error_list sshSetConnectionWindowSize(SshConnection *connection,
+   size_t windowSize, size_t memoryCap);
+
+error_list sshEnableWindowAutoTuning(SshConnection *connection, bool_t enable);
+
+error_list sshSetConnectionRekeyLimits(SshConnection *connection,
+   uint64_t bytes, uint32_t packets, systime_t interval);
+
+error_list sshRekeyConnection(SshConnection *connection);
+bool_t sshIsConnectionEstablished(SshConnection *connection);
+
 SshChannel *sshCreateChannel(SshConnection *connection);
 
 error_list sshSetChannelTimeout(SshChannel *channel, systime_t timeout);
 
+error_list sshSetChannelWriteCoalescing(SshChannel *channel, size_t threshold,
+   systime_t delay);
+
+error_list sshFlushChannel(SshChannel *channel);
+
 error_list sshWriteChannel(SshChannel *channel, const void *data, size_t length,
    size_t *written, uint_t flags);
 
@@ -1621,6 +1927,9 @@ error_list sshPollChannels(SshChannelEventDesc *eventDesc, uint_t size,
 error_list sshCloseChannel(SshChannel *channel);
 void sshDeleteChannel(SshChannel *channel);
 
+error_list sshGetConnectionStats(SshConnection *connection,
+   SshConnectionStats *stats);
+
 void sshDeinit(SshContext *context);
 
 //C++ guard
@@ -483,6 +483,9 @@ static const char_t *const sshSupportedMacAlgos[] =
 
 static const char_t *const sshSupportedCompressionAlgos[] =
 {
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   "zlib@openssh.com",
+#endif
    "none"
 };
 
@@ -39,6 +39,8 @@
 #include "ssh/ssh_auth_public_key.h"
 #include "ssh/ssh_packet.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_compress.h"
+#include "ssh/ssh_profiler.h"
 #include "debug.h"
 
 //Check SSH stack configuration
@@ -191,6 +193,16 @@ error_list sshSendUserAuthSuccess(SshConnection *connection)
       error = sshSendPacket(connection, message, length);
    }
 
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   //Check status code
+   if(!error)
+   {
+      //zlib@openssh.com compression applies to the packets that follow the
+      //SSH_MSG_USERAUTH_SUCCESS message
+      error = sshEnableDelayedCompression(connection);
+   }
+#endif
+
    //Check status code
    if(!error)
    {
@@ -203,6 +215,9 @@ error_list sshSendUserAuthSuccess(SshConnection *connection)
       //that resulted in SSH_MSG_USERAUTH_SUCCESS being sent must be passed
       //to the service being run on top of this protocol
       connection->state = SSH_CONN_STATE_OPEN;
+
+      //The connection is set up on the server side
+      sshCommitConnectionProfile(connection);
    }
 
    //Return status code
@@ -930,6 +945,10 @@ error_list sshParseUserAuthSuccess(SshConnection *connection,
    const uint8_t *message, size_t length)
 {
 #if (SSH_CLIENT_SUPPORT == ENABLED)
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   error_list error;
+#endif
+
    //Debug message
    TRACE_INFO("SSH_MSG_USERAUTH_SUCCESS message received (%" PRIuSIZE " bytes)...\r\n", length);
    TRACE_VERBOSE_ARRAY("  ", message, length);
@@ -950,6 +969,15 @@ error_list sshParseUserAuthSuccess(SshConnection *connection,
    if(length != sizeof(uint8_t))
       return ERROR_INVALID_MESSAGE;
 
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   //zlib@openssh.com compression starts after the server has sent its
+   //SSH_MSG_USERAUTH_SUCCESS message
+   error = sshEnableDelayedCompression(connection);
+   //Any error to report?
+   if(error)
+      return error;
+#endif
+
    //Either party may later initiate a key re-exchange by sending a
    //SSH_MSG_KEXINIT message
    connection->kexInitSent = FALSE;
@@ -960,6 +988,9 @@ error_list sshParseUserAuthSuccess(SshConnection *connection,
    //to the service being run on top of this protocol
    connection->state = SSH_CONN_STATE_OPEN;
 
+   //The client may now open channels
+   sshSetConnectionPhase(connection, SSH_CONN_PHASE_CHANNEL_OPEN);
+
    //Successful processing
    return NO_ERROR;
 #else
@@ -176,6 +176,60 @@ bool_t sshCheckRemoteChannelNum(SshConnection *connection,
 }
 
 
+/**
+ * @brief Allocate the TX and RX buffers of a channel
+ * @param[in] channel Handle referencing an SSH channel
+ * @return Error code
+ **/
+
+error_list sshAllocChannelBuffers(SshChannel *channel)
+{
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+   //Allocate TX buffer
+   channel->txBuffer.data = sshAllocMem(SSH_CHANNEL_BUFFER_SIZE);
+   //Allocate RX buffer
+   channel->rxBuffer.data = sshAllocMem(SSH_CHANNEL_BUFFER_SIZE);
+
+   //Failed to allocate memory?
+   if(channel->txBuffer.data == NULL || channel->rxBuffer.data == NULL)
+   {
+      //Clean up side effects
+      sshFreeChannelBuffers(channel);
+      //Report an error
+      return ERROR_OUT_OF_MEMORY;
+   }
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Release the TX and RX buffers of a channel
+ * @param[in] channel Handle referencing an SSH channel
+ **/
+
+void sshFreeChannelBuffers(SshChannel *channel)
+{
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+   //Release TX buffer
+   if(channel->txBuffer.data != NULL)
+   {
+      sshFreeMem(channel->txBuffer.data);
+      channel->txBuffer.data = NULL;
+   }
+
+   //Release RX buffer
+   if(channel->rxBuffer.data != NULL)
+   {
+      sshFreeMem(channel->rxBuffer.data);
+      channel->rxBuffer.data = NULL;
+   }
+#endif
+}
+
+
 /**
  * @brief Register channel events
  * @param[in] channel Handle referencing an SSH channel
@@ -188,12 +242,13 @@ void sshRegisterChannelEvents(SshChannel *channel, SocketEventDesc *eventDesc)
    osAcquireMutex(&channel->context->mutex);
 
    //Check the state of the channel
-   if(channel->rxWindowSizeInc >= (SSH_CHANNEL_BUFFER_SIZE / 2))
+   if(channel->rxWindowSizeInc >= (channel->rxWindowTarget / 2))
    {
       //An SSH_MSG_CHANNEL_WINDOW_ADJUST message is pending for transmission
       eventDesc->eventMask = SOCKET_EVENT_TX_READY;
    }
-   else if(channel->txBuffer.length > 0)
+   else if(channel->txBuffer.length > 0 &&
+      sshGetChannelFlushDelay(channel) == 0)
    {
       //Channels are flow-controlled. No data may be sent to a channel until
       //a message is received to indicate that window space is available
@@ -240,7 +295,7 @@ error_list sshProcessChannelEvents(SshChannel *channel)
    osAcquireMutex(&channel->context->mutex);
 
    //Check the state of the channel
-   if(channel->rxWindowSizeInc >= (SSH_CHANNEL_BUFFER_SIZE / 2))
+   if(channel->rxWindowSizeInc >= (channel->rxWindowTarget / 2))
    {
       //Update flow-control window
       channel->rxWindowSize += channel->rxWindowSizeInc;
@@ -253,9 +308,15 @@ error_list sshProcessChannelEvents(SshChannel *channel)
       {
          //Clear window size increment
          channel->rxWindowSizeInc = 0;
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+         //Count the window adjustments
+         channel->connection->stats.rxWindowAdjusts++;
+#endif
       }
    }
-   else if(channel->txBuffer.length > 0)
+   else if(channel->txBuffer.length > 0 &&
+      sshGetChannelFlushDelay(channel) == 0)
    {
       size_t n;
       SshChannelBuffer *txBuffer;
@@ -267,7 +328,8 @@ error_list sshProcessChannelEvents(SshChannel *channel)
       n = txBuffer->length;
 
       //Limit the number of bytes to send at a time
-      n = MIN(n, SSH_MAX_PACKET_SIZE - SSH_CHANNEL_DATA_MSG_HEADER_SIZE);
+      n = MIN(n, channel->connection->maxPacketSize -
+         SSH_CHANNEL_DATA_MSG_HEADER_SIZE);
 
       //The maximum amount of data allowed is determined by the maximum packet
       //size for the channel, and the current window size, whichever is smaller
@@ -299,6 +361,11 @@ error_list sshProcessChannelEvents(SshChannel *channel)
             //Update flow-control window
             channel->txWindowSize -= n;
 
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+            //Update the amount of data that must be sent without delay
+            channel->flushLength -= MIN(n, channel->flushLength);
+#endif
+
             //Update channel related events
             sshUpdateChannelEvents(channel);
          }
@@ -334,6 +401,57 @@ error_list sshProcessChannelEvents(SshChannel *channel)
 }
 
 
+/**
+ * @brief Get the time left before the buffered data must be sent
+ * @param[in] channel Handle referencing an SSH channel
+ * @return 0 if the data must be sent now, INFINITE_DELAY if the TX buffer
+ *   is empty, or else the remaining coalescing delay
+ **/
+
+systime_t sshGetChannelFlushDelay(SshChannel *channel)
+{
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   size_t n;
+   systime_t time;
+   systime_t deadline;
+#endif
+
+   //Nothing to send?
+   if(channel->txBuffer.length == 0)
+      return INFINITE_DELAY;
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   //Coalescing enabled on this channel?
+   if(channel->coalescingThreshold > 0 && channel->flushLength == 0 &&
+      !channel->eofRequest && !channel->closeRequest)
+   {
+      //A full packet is worth sending, even if it is smaller than the
+      //threshold. The same goes for the whole available window
+      n = MIN(channel->coalescingThreshold, channel->connection->maxPacketSize -
+         SSH_CHANNEL_DATA_MSG_HEADER_SIZE);
+      n = MIN(n, channel->maxPacketSize);
+      n = MIN(n, channel->txWindowSize);
+
+      //Not enough data to fill a packet?
+      if(channel->txBuffer.length < n)
+      {
+         //Get current time
+         time = osGetSystemTime();
+         //The oldest byte may not be held beyond the coalescing delay
+         deadline = channel->txTimestamp + channel->coalescingDelay;
+
+         //Hold the data until the deadline
+         if(timeCompare(deadline, time) > 0)
+            return deadline - time;
+      }
+   }
+#endif
+
+   //The data must be sent now
+   return 0;
+}
+
+
 /**
  * @brief Wait for a particular SSH channel event
  * @param[in] channel Pointer to the SSH channel
@@ -517,6 +635,11 @@ error_list sshProcessChannelData(SshChannel *channel, const uint8_t *data,
       //Update buffer length
       rxBuffer->length += length;
 
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+      //Adapt the window to the bandwidth-delay product of the path
+      sshTuneChannelWindow(channel, length);
+#endif
+
       //Update channel related events
       sshUpdateChannelEvents(channel);
 
@@ -586,4 +709,115 @@ error_list sshUpdateChannelWindow(SshChannel *channel, uint32_t windowSizeInc)
    return NO_ERROR;
 }
 
+
+#if (SSH_WINDOW_AUTO_TUNING_SUPPORT == ENABLED)
+
+/**
+ * @brief Channel window auto-tuning
+ *
+ * The window is doubled whenever the peer delivers more than half of it
+ * within one round-trip time, i.e. when the window rather than the path
+ * limits the throughput. The round-trip time is the smoothed estimate
+ * maintained by the underlying TCP connection. The windows of all the
+ * channels of a connection never exceed its memory cap
+ *
+ * @param[in] channel Pointer to the SSH channel
+ * @param[in] length Number of data bytes received
+ **/
+
+void sshTuneChannelWindow(SshChannel *channel, size_t length)
+{
+   uint_t i;
+   size_t n;
+   size_t bdp;
+   systime_t time;
+   systime_t rtt;
+   systime_t elapsed;
+   SshContext *context;
+   SshConnection *connection;
+
+   //Point to the SSH context
+   context = channel->context;
+   //Point to the SSH connection
+   connection = channel->connection;
+
+   //Auto-tuning is enabled on a per-connection basis
+   if(!connection->windowAutoTuning)
+      return;
+
+   //Get current time
+   time = osGetSystemTime();
+   //Update the current delivery rate sample
+   channel->rxSampleBytes += length;
+
+   //Retrieve the smoothed round-trip time of the TCP connection
+   rtt = SSH_MIN_WINDOW_TUNING_RTT;
+
+   if(connection->socket != NULL)
+   {
+      rtt = MAX(rtt, connection->socket->srtt);
+   }
+
+   //Each sample spans at least one round-trip time
+   elapsed = time - channel->rxSampleTimestamp;
+
+   if(elapsed < rtt)
+      return;
+
+   //Amount of data delivered per round trip
+   bdp = (size_t) ((uint64_t) channel->rxSampleBytes * rtt / elapsed);
+
+   //Start a new sample
+   channel->rxSampleTimestamp = time;
+   channel->rxSampleBytes = 0;
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Save the round-trip time used for the last decision
+   connection->stats.rtt = (uint32_t) rtt;
+#endif
+
+   //The window is not the bottleneck if the peer uses less than half of it
+   if((2 * bdp) < channel->rxWindowTarget)
+      return;
+
+   //Memory committed to the windows of the other channels
+   for(n = 0, i = 0; i < context->numChannels; i++)
+   {
+      if(&context->channels[i] != channel &&
+         context->channels[i].state != SSH_CHANNEL_STATE_UNUSED &&
+         context->channels[i].connection == connection)
+      {
+         n += context->channels[i].rxWindowTarget;
+      }
+   }
+
+   //Double the window, within the limits of the receive buffer and the
+   //memory cap of the connection
+   n = (n < connection->windowMemoryCap) ? (connection->windowMemoryCap - n) : 0;
+   n = MIN(n, channel->rxWindowTarget * 2);
+   n = MIN(n, SSH_CHANNEL_BUFFER_SIZE);
+
+   //Any room left?
+   if(n > channel->rxWindowTarget)
+   {
+      //The additional space is granted to the peer with the next
+      //SSH_MSG_CHANNEL_WINDOW_ADJUST message
+      channel->rxWindowSizeInc += n - channel->rxWindowTarget;
+      channel->rxWindowTarget = n;
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+      //Update statistics
+      connection->stats.rxWindowGrowths++;
+      connection->stats.rxWindowSize = MAX(connection->stats.rxWindowSize, n);
+#endif
+
+      //Debug message
+      TRACE_DEBUG("SSH channel %" PRIu32 ": window size = %" PRIuSIZE
+         " (RTT = %" PRIu32 " ms)\r\n", channel->localChannelNum, n,
+         (uint32_t) rtt);
+   }
+}
+
+#endif
+
 #endif
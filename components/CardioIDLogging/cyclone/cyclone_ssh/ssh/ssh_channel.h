@@ -47,8 +47,12 @@ uint32_t sshAllocateLocalChannelNum(SshConnection *connection);
 bool_t sshCheckRemoteChannelNum(SshConnection *connection,
    uint32_t remoteChannelNum);
 
+error_list sshAllocChannelBuffers(SshChannel *channel);
+void sshFreeChannelBuffers(SshChannel *channel);
+
 void sshRegisterChannelEvents(SshChannel *channel, SocketEventDesc *eventDesc);
 error_list sshProcessChannelEvents(SshChannel *channel);
+systime_t sshGetChannelFlushDelay(SshChannel *channel);
 
 uint_t sshWaitForChannelEvents(SshChannel *channel, uint_t eventMask,
    systime_t timeout);
@@ -62,6 +66,7 @@ error_list sshProcessChannelExtendedData(SshChannel *channel, uint32_t type,
    const uint8_t *data, size_t length);
 
 error_list sshUpdateChannelWindow(SshChannel *channel, uint32_t windowSizeInc);
+void sshTuneChannelWindow(SshChannel *channel, size_t length);
 
 //C++ guard
 #ifdef __cplusplus
@@ -0,0 +1,1146 @@
+/**
+ * @file ssh_compress.c
+ * @brief zlib@openssh.com compression
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_compress.h"
+#include "ssh/ssh_misc.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_ZLIB_SUPPORT == ENABLED)
+
+//Base values of the length codes (refer to RFC 1951, section 3.2.5)
+static const uint16_t sshZlibLengthBase[29] =
+{
+   3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+   35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+//Number of extra bits of the length codes
+static const uint8_t sshZlibLengthExtra[29] =
+{
+   0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+   3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+//Base values of the distance codes
+static const uint16_t sshZlibDistBase[30] =
+{
+   1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+   257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+   8193, 12289, 16385, 24577
+};
+
+//Number of extra bits of the distance codes
+static const uint8_t sshZlibDistExtra[30] =
+{
+   0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+   7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+//Order of the code length code lengths
+static const uint8_t sshZlibCodeLengthOrder[19] =
+{
+   16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+
+/**
+ * @brief Check whether a compression algorithm is zlib@openssh.com
+ * @param[in] compressAlgo Compression algorithm name
+ * @return TRUE if compression is delayed until user authentication succeeds,
+ *   else FALSE
+ **/
+
+bool_t sshIsDelayedCompression(const char_t *compressAlgo)
+{
+   //"none" is the only other supported algorithm
+   return (compressAlgo != NULL &&
+      sshCompareAlgo(compressAlgo, "zlib@openssh.com")) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Start compression once user authentication has succeeded
+ *
+ * With zlib@openssh.com, the client starts compressing the packets it sends
+ * after it receives SSH_MSG_USERAUTH_SUCCESS, and the server after it sends
+ * that message. The compression state is kept across key re-exchanges
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @return Error code
+ **/
+
+error_list sshEnableDelayedCompression(SshConnection *connection)
+{
+   const char_t *txCompressAlgo;
+   const char_t *rxCompressAlgo;
+
+   //Select the algorithm used in each direction
+   if(connection->context->mode == SSH_OPERATION_MODE_CLIENT)
+   {
+      txCompressAlgo = connection->clientCompressAlgo;
+      rxCompressAlgo = connection->serverCompressAlgo;
+   }
+   else
+   {
+      txCompressAlgo = connection->serverCompressAlgo;
+      rxCompressAlgo = connection->clientCompressAlgo;
+   }
+
+   //Compress outgoing packets?
+   if(sshIsDelayedCompression(txCompressAlgo) &&
+      connection->deflateContext == NULL)
+   {
+      //Allocate a memory buffer to hold the compressor context
+      connection->deflateContext = sshAllocMem(sizeof(SshDeflateContext));
+      //Failed to allocate memory?
+      if(connection->deflateContext == NULL)
+         return ERROR_OUT_OF_MEMORY;
+
+      //Initialize compressor context
+      osMemset(connection->deflateContext, 0, sizeof(SshDeflateContext));
+   }
+
+   //Decompress incoming packets?
+   if(sshIsDelayedCompression(rxCompressAlgo) &&
+      connection->inflateContext == NULL)
+   {
+      //Allocate a memory buffer to hold the decompressor context
+      connection->inflateContext = sshAllocMem(sizeof(SshInflateContext));
+      //Failed to allocate memory?
+      if(connection->inflateContext == NULL)
+         return ERROR_OUT_OF_MEMORY;
+
+      //Initialize decompressor context
+      osMemset(connection->inflateContext, 0, sizeof(SshInflateContext));
+   }
+
+   //Debug message
+   TRACE_INFO("SSH compression enabled (tx: %s, rx: %s)\r\n",
+      (connection->deflateContext != NULL) ? "zlib" : "none",
+      (connection->inflateContext != NULL) ? "zlib" : "none");
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Release compression contexts
+ * @param[in] connection Pointer to the SSH connection
+ **/
+
+void sshFreeCompression(SshConnection *connection)
+{
+   //Release compressor context
+   if(connection->deflateContext != NULL)
+   {
+      sshFreeMem(connection->deflateContext);
+      connection->deflateContext = NULL;
+   }
+
+   //Release decompressor context
+   if(connection->inflateContext != NULL)
+   {
+      sshFreeMem(connection->inflateContext);
+      connection->inflateContext = NULL;
+   }
+}
+
+
+/**
+ * @brief Write bits to the compressed stream (LSB first)
+ * @param[in] context Pointer to the compressor context
+ * @param[in] value Bits to be written
+ * @param[in] length Number of bits (up to 16)
+ **/
+
+static void sshDeflatePutBits(SshDeflateContext *context, uint32_t value,
+   uint_t length)
+{
+   //Append the bits to the bit buffer
+   context->bitBuffer |= value << context->bitCount;
+   context->bitCount += length;
+
+   //Flush complete bytes
+   while(context->bitCount >= 8)
+   {
+      //Bytes that do not fit are counted, so that the overflow can be detected
+      if(context->outputLen < context->outputSize)
+      {
+         context->output[context->outputLen] = (uint8_t) context->bitBuffer;
+      }
+
+      context->outputLen++;
+      context->bitBuffer >>= 8;
+      context->bitCount -= 8;
+   }
+}
+
+
+/**
+ * @brief Write a Huffman code to the compressed stream (MSB first)
+ * @param[in] context Pointer to the compressor context
+ * @param[in] code Huffman code
+ * @param[in] length Length of the code, in bits
+ **/
+
+static void sshDeflatePutCode(SshDeflateContext *context, uint_t code,
+   uint_t length)
+{
+   uint_t i;
+   uint32_t value;
+
+   //Huffman codes are packed starting with the most significant bit
+   for(value = 0, i = 0; i < length; i++)
+   {
+      value = (value << 1) | ((code >> i) & 1);
+   }
+
+   //Write the reversed code
+   sshDeflatePutBits(context, value, length);
+}
+
+
+/**
+ * @brief Write a literal/length symbol using the fixed Huffman code
+ * @param[in] context Pointer to the compressor context
+ * @param[in] symbol Literal/length symbol (0-287)
+ **/
+
+static void sshDeflatePutSymbol(SshDeflateContext *context, uint_t symbol)
+{
+   //Fixed Huffman code (refer to RFC 1951, section 3.2.6)
+   if(symbol < 144)
+   {
+      sshDeflatePutCode(context, 0x30 + symbol, 8);
+   }
+   else if(symbol < 256)
+   {
+      sshDeflatePutCode(context, 0x190 + symbol - 144, 9);
+   }
+   else if(symbol < 280)
+   {
+      sshDeflatePutCode(context, symbol - 256, 7);
+   }
+   else
+   {
+      sshDeflatePutCode(context, 0xC0 + symbol - 280, 8);
+   }
+}
+
+
+/**
+ * @brief Write a <length, backward distance> pair
+ * @param[in] context Pointer to the compressor context
+ * @param[in] length Match length (3-258)
+ * @param[in] distance Backward distance
+ **/
+
+static void sshDeflatePutMatch(SshDeflateContext *context, uint_t length,
+   uint_t distance)
+{
+   uint_t i;
+
+   //Length code and extra bits
+   for(i = 28; sshZlibLengthBase[i] > length; i--)
+   {
+   }
+
+   sshDeflatePutSymbol(context, 257 + i);
+   sshDeflatePutBits(context, length - sshZlibLengthBase[i],
+      sshZlibLengthExtra[i]);
+
+   //Distance codes are represented by fixed 5-bit codes
+   for(i = 29; sshZlibDistBase[i] > distance; i--)
+   {
+   }
+
+   sshDeflatePutCode(context, i, 5);
+   sshDeflatePutBits(context, distance - sshZlibDistBase[i],
+      sshZlibDistExtra[i]);
+}
+
+
+/**
+ * @brief Hash the 3 bytes at a given position of the window
+ * @param[in] p Pointer to the bytes
+ * @return Hash value
+ **/
+
+static uint_t sshDeflateHash(const uint8_t *p)
+{
+   uint32_t value;
+
+   //Multiplicative hashing
+   value = ((uint32_t) p[0] << 16) | ((uint32_t) p[1] << 8) | p[2];
+   value *= 0x9E3779B1;
+
+   //Keep the most significant bits
+   return value >> (32 - SSH_ZLIB_HASH_BITS);
+}
+
+
+/**
+ * @brief Compress the payload of an SSH packet
+ *
+ * The payload is encoded with the fixed Huffman code (or as a stored block
+ * when it does not compress). Each packet ends with the end of the current
+ * block followed by the header of the next one, so that the peer can decode
+ * the whole payload while the stream goes on in the next packet (zlib partial
+ * flush). The matches may refer to the payloads of the previous packets
+ *
+ * @param[in] context Pointer to the compressor context
+ * @param[in,out] payload Payload to be compressed in place
+ * @param[in,out] length Length of the payload, in bytes
+ * @param[in] maxLength Size of the payload buffer
+ * @return Error code
+ **/
+
+error_list sshCompressPayload(SshDeflateContext *context, uint8_t *payload,
+   size_t *length, size_t maxLength)
+{
+   uint_t h;
+   uint_t cmf;
+   size_t i;
+   size_t j;
+   size_t n;
+   size_t p;
+   size_t end;
+   size_t delta;
+   size_t matchLen;
+   size_t maxMatchLen;
+   size_t headerLen;
+   uint32_t bitBuffer;
+   uint_t bitCount;
+
+   //Length of the uncompressed payload
+   n = *length;
+
+   //Check parameters
+   if(n > SSH_MAX_PACKET_SIZE)
+      return ERROR_INVALID_LENGTH;
+   if(maxLength < (n + SSH_ZLIB_MAX_OVERHEAD))
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Append the payload to the history window
+   osMemcpy(context->window + context->historyLen, payload, n);
+   end = context->historyLen + n;
+
+   //The compressed stream is written over the payload
+   context->output = payload;
+   context->outputLen = 0;
+
+   //The first packet starts the zlib stream
+   if(!context->headerSent)
+   {
+      //CM = 8 (deflate) and CINFO = log2(window size) - 8
+      for(cmf = 0; (256U << cmf) < SSH_ZLIB_WINDOW_SIZE; cmf++)
+      {
+      }
+
+      cmf = (cmf << 4) | 8;
+
+      //FCHECK is chosen so that CMF * 256 + FLG is a multiple of 31
+      payload[0] = (uint8_t) cmf;
+      payload[1] = (uint8_t) ((31 - ((cmf * 256) % 31)) % 31);
+      context->outputLen = 2;
+
+      //Open the first block (BFINAL = 0, BTYPE = 01)
+      context->bitBuffer = 0;
+      context->bitCount = 0;
+      sshDeflatePutBits(context, 2, 3);
+   }
+
+   //Save the state of the stream, in case a stored block is needed
+   headerLen = context->outputLen;
+   bitBuffer = context->bitBuffer;
+   bitCount = context->bitCount;
+
+   //The fixed Huffman block must not be longer than a stored block
+   context->outputSize = headerLen + n + 4;
+
+   //Encode the payload
+   for(i = context->historyLen; i < end && context->outputLen <=
+      context->outputSize; )
+   {
+      //No match found yet
+      matchLen = 0;
+      p = 0;
+
+      //At least 3 bytes are needed to find a match
+      if((end - i) >= 3)
+      {
+         //Look up the last position with the same hash value
+         h = sshDeflateHash(context->window + i);
+         p = context->hashTable[h];
+         context->hashTable[h] = (uint16_t) (i + 1);
+
+         //Candidate within the window?
+         if(p != 0 && (i - (p - 1)) <= SSH_ZLIB_WINDOW_SIZE)
+         {
+            p--;
+            maxMatchLen = MIN(end - i, 258);
+
+            //Compute the length of the match
+            while(matchLen < maxMatchLen &&
+               context->window[p + matchLen] == context->window[i + matchLen])
+            {
+               matchLen++;
+            }
+         }
+      }
+
+      //Worth a <length, backward distance> pair?
+      if(matchLen >= 3)
+      {
+         sshDeflatePutMatch(context, matchLen, i - p);
+
+         //Insert the positions covered by the match in the hash table
+         for(j = i + 1; j < (i + matchLen) && (end - j) >= 3; j++)
+         {
+            context->hashTable[sshDeflateHash(context->window + j)] =
+               (uint16_t) (j + 1);
+         }
+
+         i += matchLen;
+      }
+      else
+      {
+         //Literal byte
+         sshDeflatePutSymbol(context, context->window[i]);
+         i++;
+      }
+   }
+
+   //Close the block and open the next one, so that the last symbols of the
+   //payload are complete in the bytes sent
+   sshDeflatePutSymbol(context, 256);
+   sshDeflatePutBits(context, 2, 3);
+
+   //Payload not compressible?
+   if(context->outputLen > context->outputSize)
+   {
+      //Restore the state of the stream
+      context->outputLen = headerLen;
+      context->bitBuffer = bitBuffer;
+      context->bitCount = bitCount;
+      context->outputSize = maxLength;
+
+      //Close the current block and send the payload in a stored block
+      sshDeflatePutSymbol(context, 256);
+      sshDeflatePutBits(context, 0, 3);
+
+      //Any bits remaining up to the next byte boundary are ignored
+      if(context->bitCount > 0)
+      {
+         sshDeflatePutBits(context, 0, 8 - context->bitCount);
+      }
+
+      //LEN and NLEN fields
+      sshDeflatePutBits(context, n, 16);
+      sshDeflatePutBits(context, n ^ 0xFFFF, 16);
+
+      //Copy the data
+      osMemcpy(payload + context->outputLen, context->window +
+         context->historyLen, n);
+      context->outputLen += n;
+
+      //Open the next block
+      sshDeflatePutBits(context, 2, 3);
+   }
+
+   //The header of the stream has been sent
+   context->headerSent = TRUE;
+
+   //Keep the last bytes of data as history
+   if(end > SSH_ZLIB_WINDOW_SIZE)
+   {
+      delta = end - SSH_ZLIB_WINDOW_SIZE;
+
+      //Slide the window
+      osMemmove(context->window, context->window + delta,
+         SSH_ZLIB_WINDOW_SIZE);
+
+      //Update the hash table accordingly
+      for(h = 0; h < SSH_ZLIB_HASH_SIZE; h++)
+      {
+         if(context->hashTable[h] > delta)
+         {
+            context->hashTable[h] -= (uint16_t) delta;
+         }
+         else
+         {
+            context->hashTable[h] = 0;
+         }
+      }
+
+      context->historyLen = SSH_ZLIB_WINDOW_SIZE;
+   }
+   else
+   {
+      context->historyLen = end;
+   }
+
+   //Length of the compressed payload
+   *length = context->outputLen;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Read bits from the compressed stream
+ * @param[in] reader Pointer to the bit reader
+ * @param[in] length Number of bits (up to 16)
+ * @param[out] value Bits read
+ * @return Error code
+ **/
+
+static error_list sshInflateGetBits(SshInflateReader *reader, uint_t length,
+   uint_t *value)
+{
+   uint8_t c;
+
+   //Load as many bytes as needed
+   while(reader->bitCount < length)
+   {
+      //Carried bytes are consumed first
+      if(reader->carryPos < reader->carryLen)
+      {
+         c = reader->carry[reader->carryPos++];
+      }
+      else if(reader->dataPos < reader->dataLen)
+      {
+         c = reader->data[reader->dataPos++];
+      }
+      else
+      {
+         //The element continues in the next packet
+         return ERROR_BUFFER_UNDERFLOW;
+      }
+
+      reader->bitBuffer |= (uint32_t) c << reader->bitCount;
+      reader->bitCount += 8;
+   }
+
+   //Extract the bits
+   *value = reader->bitBuffer & ((1U << length) - 1);
+   reader->bitBuffer >>= length;
+   reader->bitCount -= length;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Build a canonical Huffman decoding table
+ * @param[out] table Decoding table
+ * @param[in] lengths Code length of each symbol
+ * @param[in] n Number of symbols
+ * @return Error code
+ **/
+
+static error_list sshInflateBuildTable(SshHuffmanTable *table,
+   const uint8_t *lengths, uint_t n)
+{
+   uint_t i;
+   int_t left;
+   uint16_t offset[16];
+
+   //Count the number of codes of each length
+   osMemset(table->count, 0, sizeof(table->count));
+
+   for(i = 0; i < n; i++)
+   {
+      table->count[lengths[i]]++;
+   }
+
+   //Check whether the set of lengths is over-subscribed
+   for(left = 1, i = 1; i < 16; i++)
+   {
+      left = (left << 1) - table->count[i];
+
+      if(left < 0)
+         return ERROR_DECODING_FAILED;
+   }
+
+   //Offset of the first symbol of each length
+   for(offset[1] = 0, i = 1; i < 15; i++)
+   {
+      offset[i + 1] = offset[i] + table->count[i];
+   }
+
+   //Sort the symbols by code
+   for(i = 0; i < n; i++)
+   {
+      if(lengths[i] != 0)
+      {
+         table->symbol[offset[lengths[i]]++] = i;
+      }
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Decode a symbol
+ * @param[in] reader Pointer to the bit reader
+ * @param[in] table Decoding table
+ * @param[out] symbol Decoded symbol
+ * @return Error code
+ **/
+
+static error_list sshInflateDecode(SshInflateReader *reader,
+   const SshHuffmanTable *table, uint_t *symbol)
+{
+   error_list error;
+   uint_t i;
+   uint_t bit;
+   int_t code;
+   int_t first;
+   int_t index;
+   int_t count;
+
+   //Codes are read one bit at a time
+   for(code = 0, first = 0, index = 0, i = 1; i < 16; i++)
+   {
+      error = sshInflateGetBits(reader, 1, &bit);
+      if(error)
+         return error;
+
+      code |= bit;
+      count = table->count[i];
+
+      //Code of the current length?
+      if((code - count) < first)
+      {
+         *symbol = table->symbol[index + (code - first)];
+         return NO_ERROR;
+      }
+
+      index += count;
+      first = (first + count) << 1;
+      code <<= 1;
+   }
+
+   //Invalid code
+   return ERROR_DECODING_FAILED;
+}
+
+
+/**
+ * @brief Decode the code lengths of a dynamic Huffman block
+ * @param[in] context Pointer to the decompressor context
+ * @param[in] reader Pointer to the bit reader
+ * @return Error code
+ **/
+
+static error_list sshInflateDynamicTables(SshInflateContext *context,
+   SshInflateReader *reader)
+{
+   error_list error;
+   uint_t i;
+   uint_t n;
+   uint_t nlen;
+   uint_t ndist;
+   uint_t ncode;
+   uint_t symbol;
+   uint_t value;
+   uint8_t length;
+   uint8_t lengths[320];
+
+   //HLIT, HDIST and HCLEN fields
+   error = sshInflateGetBits(reader, 5, &nlen);
+   if(error)
+      return error;
+
+   error = sshInflateGetBits(reader, 5, &ndist);
+   if(error)
+      return error;
+
+   error = sshInflateGetBits(reader, 4, &ncode);
+   if(error)
+      return error;
+
+   nlen += 257;
+   ndist += 1;
+   ncode += 4;
+
+   //Check the number of codes
+   if(nlen > 286 || ndist > 30)
+      return ERROR_DECODING_FAILED;
+
+   //Code lengths for the code length alphabet
+   for(i = 0; i < 19; i++)
+   {
+      if(i < ncode)
+      {
+         error = sshInflateGetBits(reader, 3, &value);
+         if(error)
+            return error;
+      }
+      else
+      {
+         value = 0;
+      }
+
+      lengths[sshZlibCodeLengthOrder[i]] = (uint8_t) value;
+   }
+
+   //The distance table is used to decode the code lengths
+   error = sshInflateBuildTable(&context->distTable, lengths, 19);
+   if(error)
+      return error;
+
+   //Decode the code lengths of the literal/length and distance alphabets
+   for(i = 0; i < (nlen + ndist); )
+   {
+      error = sshInflateDecode(reader, &context->distTable, &symbol);
+      if(error)
+         return error;
+
+      //Literal code length?
+      if(symbol < 16)
+      {
+         lengths[i++] = (uint8_t) symbol;
+         continue;
+      }
+
+      //Repeat code
+      if(symbol == 16)
+      {
+         //Copy the previous code length 3-6 times
+         if(i == 0)
+            return ERROR_DECODING_FAILED;
+
+         length = lengths[i - 1];
+         error = sshInflateGetBits(reader, 2, &value);
+         n = 3 + value;
+      }
+      else if(symbol == 17)
+      {
+         //Repeat a code length of 0 for 3-10 times
+         length = 0;
+         error = sshInflateGetBits(reader, 3, &value);
+         n = 3 + value;
+      }
+      else
+      {
+         //Repeat a code length of 0 for 11-138 times
+         length = 0;
+         error = sshInflateGetBits(reader, 7, &value);
+         n = 11 + value;
+      }
+
+      //Check status code
+      if(error)
+         return error;
+
+      //Check the number of code lengths
+      if((i + n) > (nlen + ndist))
+         return ERROR_DECODING_FAILED;
+
+      while(n-- > 0)
+      {
+         lengths[i++] = length;
+      }
+   }
+
+   //The end-of-block code is mandatory
+   if(lengths[256] == 0)
+      return ERROR_DECODING_FAILED;
+
+   //Build the literal/length table
+   error = sshInflateBuildTable(&context->lenTable, lengths, nlen);
+   if(error)
+      return error;
+
+   //Build the distance table
+   return sshInflateBuildTable(&context->distTable, lengths + nlen, ndist);
+}
+
+
+/**
+ * @brief Write a decompressed byte
+ * @param[in] context Pointer to the decompressor context
+ * @param[in] c Byte to be written
+ * @return Error code
+ **/
+
+static error_list sshInflatePutByte(SshInflateContext *context, uint8_t c)
+{
+   //The decompressed payload must fit in a packet
+   if(context->outputLen >= SSH_MAX_PACKET_SIZE)
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Write the byte to the output and the history window
+   context->output[context->outputLen++] = c;
+   context->window[context->windowPos] = c;
+   context->windowPos = (context->windowPos + 1) & (SSH_ZLIB_MAX_DIST - 1);
+
+   //Update the number of valid bytes in the history window
+   if(context->windowLen < SSH_ZLIB_MAX_DIST)
+   {
+      context->windowLen++;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Decode the next element of the compressed stream
+ *
+ * An element is either the zlib header, a block header, a run of stored
+ * bytes or a symbol. If the input ends in the middle of an element, the
+ * caller rewinds the reader to the start of the element
+ *
+ * @param[in] context Pointer to the decompressor context
+ * @param[in] reader Pointer to the bit reader
+ * @return Error code
+ **/
+
+static error_list sshInflateElement(SshInflateContext *context,
+   SshInflateReader *reader)
+{
+   error_list error;
+   uint_t i;
+   uint_t cmf;
+   uint_t flg;
+   uint_t value;
+   uint_t symbol;
+   uint_t length;
+   uint_t distance;
+   uint8_t lengths[288];
+
+   //Check decoding state
+   if(context->state == SSH_INFLATE_STATE_HEADER)
+   {
+      //CMF and FLG fields
+      error = sshInflateGetBits(reader, 8, &cmf);
+      if(error)
+         return error;
+
+      error = sshInflateGetBits(reader, 8, &flg);
+      if(error)
+         return error;
+
+      //Check compression method and window size
+      if((cmf & 0x0F) != 8 || (cmf >> 4) > 7)
+         return ERROR_DECODING_FAILED;
+
+      //Check FCHECK field (preset dictionaries are not used by SSH)
+      if(((cmf << 8) | flg) % 31 != 0 || (flg & 0x20) != 0)
+         return ERROR_DECODING_FAILED;
+
+      //Wait for the first block
+      context->state = SSH_INFLATE_STATE_BLOCK;
+   }
+   else if(context->state == SSH_INFLATE_STATE_BLOCK)
+   {
+      //BFINAL and BTYPE fields
+      error = sshInflateGetBits(reader, 3, &value);
+      if(error)
+         return error;
+
+      //Check block type
+      if((value >> 1) == 0)
+      {
+         //Any bits remaining up to the next byte boundary are ignored
+         reader->bitBuffer = 0;
+         reader->bitCount = 0;
+
+         //LEN and NLEN fields
+         error = sshInflateGetBits(reader, 16, &length);
+         if(error)
+            return error;
+
+         error = sshInflateGetBits(reader, 16, &i);
+         if(error)
+            return error;
+
+         //NLEN is the one's complement of LEN
+         if(length != (i ^ 0xFFFF))
+            return ERROR_DECODING_FAILED;
+
+         context->storedLen = length;
+         context->state = SSH_INFLATE_STATE_STORED;
+      }
+      else if((value >> 1) == 1)
+      {
+         //Fixed Huffman codes (refer to RFC 1951, section 3.2.6)
+         for(i = 0; i < 288; i++)
+         {
+            lengths[i] = (i < 144) ? 8 : (i < 256) ? 9 : (i < 280) ? 7 : 8;
+         }
+
+         sshInflateBuildTable(&context->lenTable, lengths, 288);
+
+         for(i = 0; i < 30; i++)
+         {
+            lengths[i] = 5;
+         }
+
+         sshInflateBuildTable(&context->distTable, lengths, 30);
+         context->state = SSH_INFLATE_STATE_CODES;
+      }
+      else if((value >> 1) == 2)
+      {
+         //Dynamic Huffman codes
+         error = sshInflateDynamicTables(context, reader);
+         if(error)
+            return error;
+
+         context->state = SSH_INFLATE_STATE_CODES;
+      }
+      else
+      {
+         //Reserved block type
+         return ERROR_DECODING_FAILED;
+      }
+
+      //Last block of the stream?
+      context->finalBlock = (value & 1) ? TRUE : FALSE;
+   }
+   else if(context->state == SSH_INFLATE_STATE_STORED)
+   {
+      //Copy the data available in this packet
+      for(i = 0; context->storedLen > 0; i++)
+      {
+         if(reader->carryPos < reader->carryLen)
+         {
+            value = reader->carry[reader->carryPos++];
+         }
+         else if(reader->dataPos < reader->dataLen)
+         {
+            value = reader->data[reader->dataPos++];
+         }
+         else
+         {
+            break;
+         }
+
+         error = sshInflatePutByte(context, (uint8_t) value);
+         if(error)
+            return error;
+
+         context->storedLen--;
+      }
+
+      //End of the block?
+      if(context->storedLen == 0)
+      {
+         context->state = context->finalBlock ? SSH_INFLATE_STATE_END :
+            SSH_INFLATE_STATE_BLOCK;
+      }
+      else if(i == 0)
+      {
+         return ERROR_BUFFER_UNDERFLOW;
+      }
+   }
+   else if(context->state == SSH_INFLATE_STATE_CODES)
+   {
+      //Decode a literal/length symbol
+      error = sshInflateDecode(reader, &context->lenTable, &symbol);
+      if(error)
+         return error;
+
+      //Check symbol value
+      if(symbol < 256)
+      {
+         //Literal byte
+         error = sshInflatePutByte(context, (uint8_t) symbol);
+      }
+      else if(symbol == 256)
+      {
+         //End of block
+         context->state = context->finalBlock ? SSH_INFLATE_STATE_END :
+            SSH_INFLATE_STATE_BLOCK;
+      }
+      else if(symbol < 286)
+      {
+         //Length code and extra bits
+         symbol -= 257;
+         error = sshInflateGetBits(reader, sshZlibLengthExtra[symbol], &value);
+         if(error)
+            return error;
+
+         length = sshZlibLengthBase[symbol] + value;
+
+         //Distance code and extra bits
+         error = sshInflateDecode(reader, &context->distTable, &symbol);
+         if(error)
+            return error;
+
+         if(symbol >= 30)
+            return ERROR_DECODING_FAILED;
+
+         error = sshInflateGetBits(reader, sshZlibDistExtra[symbol], &value);
+         if(error)
+            return error;
+
+         distance = sshZlibDistBase[symbol] + value;
+
+         //The distance cannot refer past the beginning of the stream
+         if(distance > context->windowLen)
+            return ERROR_DECODING_FAILED;
+
+         //Copy the string from the history window
+         for(i = 0; i < length && !error; i++)
+         {
+            error = sshInflatePutByte(context, context->window[(context->windowPos -
+               distance) & (SSH_ZLIB_MAX_DIST - 1)]);
+         }
+      }
+      else
+      {
+         //Invalid symbol
+         error = ERROR_DECODING_FAILED;
+      }
+   }
+   else
+   {
+      //No data is expected after the last block
+      if(reader->carryPos < reader->carryLen ||
+         reader->dataPos < reader->dataLen)
+      {
+         error = ERROR_DECODING_FAILED;
+      }
+      else
+      {
+         error = ERROR_BUFFER_UNDERFLOW;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Decompress the payload of an SSH packet
+ *
+ * The compressed stream goes on from packet to packet. The decompressed
+ * payload is returned in a buffer owned by the decompressor context, which
+ * remains valid until the next packet is decompressed
+ *
+ * @param[in] context Pointer to the decompressor context
+ * @param[in] data Compressed payload
+ * @param[in] length Length of the compressed payload, in bytes
+ * @param[out] payload Pointer to the decompressed payload
+ * @param[out] payloadLen Length of the decompressed payload, in bytes
+ * @return Error code
+ **/
+
+error_list sshDecompressPayload(SshInflateContext *context,
+   const uint8_t *data, size_t length, uint8_t **payload,
+   size_t *payloadLen)
+{
+   error_list error;
+   size_t n;
+   SshInflateReader reader;
+   SshInflateReader checkpoint;
+
+   //The bits left over by the previous packet are read first
+   reader.carry = context->carry;
+   reader.carryLen = context->carryLen;
+   reader.carryPos = 0;
+   reader.data = data;
+   reader.dataLen = length;
+   reader.dataPos = 0;
+   reader.bitBuffer = context->bitBuffer;
+   reader.bitCount = context->bitCount;
+
+   //Start of the decompressed payload
+   context->outputLen = 0;
+
+   //Decode as many elements as possible
+   do
+   {
+      checkpoint = reader;
+      error = sshInflateElement(context, &reader);
+   } while(!error);
+
+   //The end of the packet has been reached?
+   if(error == ERROR_BUFFER_UNDERFLOW)
+   {
+      //Rewind to the start of the incomplete element
+      reader = checkpoint;
+      n = (reader.carryLen - reader.carryPos) + (reader.dataLen - reader.dataPos);
+
+      //Keep the remaining input for the next packet
+      if(n <= SSH_ZLIB_CARRY_SIZE)
+      {
+         osMemmove(context->carry, context->carry + reader.carryPos,
+            reader.carryLen - reader.carryPos);
+         osMemcpy(context->carry + reader.carryLen - reader.carryPos,
+            data + reader.dataPos, reader.dataLen - reader.dataPos);
+
+         context->carryLen = n;
+         context->bitBuffer = reader.bitBuffer;
+         context->bitCount = reader.bitCount;
+
+         //Return the decompressed payload
+         *payload = context->output;
+         *payloadLen = context->outputLen;
+
+         //Successful processing
+         error = NO_ERROR;
+      }
+      else
+      {
+         //The element is too large
+         error = ERROR_DECOMPRESSION_FAILED;
+      }
+   }
+   else
+   {
+      //Debug message
+      TRACE_WARNING("SSH decompression failed (error %u)\r\n", error);
+      //Report an error
+      error = ERROR_DECOMPRESSION_FAILED;
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
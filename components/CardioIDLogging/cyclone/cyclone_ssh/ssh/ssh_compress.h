@@ -0,0 +1,188 @@
+/**
+ * @file ssh_compress.h
+ * @brief zlib@openssh.com compression
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_COMPRESS_H
+#define _SSH_COMPRESS_H
+
+//Dependencies
+#include "ssh/ssh.h"
+
+//Size of the history window used by the compressor
+#ifndef SSH_ZLIB_WINDOW_SIZE
+   #define SSH_ZLIB_WINDOW_SIZE 4096
+#elif (SSH_ZLIB_WINDOW_SIZE < 256 || SSH_ZLIB_WINDOW_SIZE > 32768 || \
+   (SSH_ZLIB_WINDOW_SIZE & (SSH_ZLIB_WINDOW_SIZE - 1)) != 0)
+   #error SSH_ZLIB_WINDOW_SIZE parameter is not valid
+#endif
+
+//Number of bits of the hash used to find matches
+#ifndef SSH_ZLIB_HASH_BITS
+   #define SSH_ZLIB_HASH_BITS 11
+#elif (SSH_ZLIB_HASH_BITS < 8 || SSH_ZLIB_HASH_BITS > 15)
+   #error SSH_ZLIB_HASH_BITS parameter is not valid
+#endif
+
+//Maximum number of input bytes carried over to the next packet
+#ifndef SSH_ZLIB_CARRY_SIZE
+   #define SSH_ZLIB_CARRY_SIZE 512
+#elif (SSH_ZLIB_CARRY_SIZE < 64)
+   #error SSH_ZLIB_CARRY_SIZE parameter is not valid
+#endif
+
+//Positions in the compressor window are stored as 16-bit integers
+#if (SSH_ZLIB_SUPPORT == ENABLED && \
+   (SSH_ZLIB_WINDOW_SIZE + SSH_MAX_PACKET_SIZE) >= 65536)
+   #error SSH_ZLIB_WINDOW_SIZE parameter is not valid
+#endif
+
+//Size of the history window of the decompressor (32 KB as per RFC 1951)
+#define SSH_ZLIB_MAX_DIST 32768
+//Number of entries of the compressor hash table
+#define SSH_ZLIB_HASH_SIZE (1U << SSH_ZLIB_HASH_BITS)
+//Worst case expansion of a payload (zlib header, end of the current block
+//and stored block header)
+#define SSH_ZLIB_MAX_OVERHEAD 8
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Decompressor state
+ **/
+
+typedef enum
+{
+   SSH_INFLATE_STATE_HEADER = 0,
+   SSH_INFLATE_STATE_BLOCK  = 1,
+   SSH_INFLATE_STATE_STORED = 2,
+   SSH_INFLATE_STATE_CODES  = 3,
+   SSH_INFLATE_STATE_END    = 4
+} SshInflateState;
+
+
+/**
+ * @brief Compressor context
+ *
+ * The payload being compressed is appended to the history window, so that
+ * matches can be searched for in a single contiguous buffer
+ **/
+
+struct _SshDeflateContext
+{
+   bool_t headerSent;                            ///<The zlib header has been sent
+   size_t historyLen;                            ///<Number of history bytes in the window
+   uint16_t hashTable[SSH_ZLIB_HASH_SIZE];       ///<Last position of each hash value, plus one
+   uint8_t window[SSH_ZLIB_WINDOW_SIZE + SSH_MAX_PACKET_SIZE]; ///<History followed by the current payload
+   uint8_t *output;                              ///<Output stream
+   size_t outputLen;                             ///<Number of bytes written to the output stream
+   size_t outputSize;                            ///<Maximum number of bytes that can be written
+   uint32_t bitBuffer;                           ///<Pending bits
+   uint_t bitCount;                              ///<Number of pending bits
+};
+
+
+/**
+ * @brief Huffman decoding table
+ **/
+
+typedef struct
+{
+   uint16_t count[16];   ///<Number of codes of each length
+   uint16_t symbol[288]; ///<Symbols ordered by code
+} SshHuffmanTable;
+
+
+/**
+ * @brief Bit reader (carried bytes followed by the packet payload)
+ **/
+
+typedef struct
+{
+   const uint8_t *carry; ///<Bytes carried over from the previous packet
+   size_t carryLen;      ///<Number of carried bytes
+   size_t carryPos;      ///<Current position in the carried bytes
+   const uint8_t *data;  ///<Compressed payload of the current packet
+   size_t dataLen;       ///<Length of the compressed payload
+   size_t dataPos;       ///<Current position in the compressed payload
+   uint32_t bitBuffer;   ///<Bits not consumed yet
+   uint_t bitCount;      ///<Number of bits not consumed yet
+} SshInflateReader;
+
+
+/**
+ * @brief Decompressor context
+ *
+ * Each packet ends on a flush point, so all the data it carries can be
+ * output. The last few bits of a packet may however belong to an element
+ * (block header or symbol) that completes in the next packet: such bits are
+ * carried over and decoding resumes at the start of the element
+ **/
+
+struct _SshInflateContext
+{
+   SshInflateState state;                      ///<Decoding state
+   bool_t finalBlock;                          ///<The current block is the last one
+   size_t storedLen;                           ///<Number of bytes left in the stored block
+   SshHuffmanTable lenTable;                   ///<Literal/length code
+   SshHuffmanTable distTable;                  ///<Distance code
+   uint32_t bitBuffer;                         ///<Bits not consumed yet
+   uint_t bitCount;                            ///<Number of bits not consumed yet
+   uint8_t carry[SSH_ZLIB_CARRY_SIZE];         ///<Input bytes not consumed yet
+   size_t carryLen;                            ///<Number of bytes carried over
+   uint8_t window[SSH_ZLIB_MAX_DIST];          ///<History window
+   size_t windowPos;                           ///<Current position in the history window
+   size_t windowLen;                           ///<Number of valid bytes in the history window
+   uint8_t output[SSH_MAX_PACKET_SIZE];        ///<Decompressed payload
+   size_t outputLen;                           ///<Length of the decompressed payload
+};
+
+
+//SSH compression related functions
+bool_t sshIsDelayedCompression(const char_t *compressAlgo);
+
+error_list sshEnableDelayedCompression(SshConnection *connection);
+void sshFreeCompression(SshConnection *connection);
+
+error_list sshCompressPayload(SshDeflateContext *context, uint8_t *payload,
+   size_t *length, size_t maxLength);
+
+error_list sshDecompressPayload(SshInflateContext *context,
+   const uint8_t *data, size_t length, uint8_t **payload,
+   size_t *payloadLen);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -242,6 +242,16 @@ error_list sshSendChannelData(SshChannel *channel, size_t dataLen)
       error = sshSendPacket(connection, message, length);
    }
 
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Check status code
+   if(!error)
+   {
+      //Update connection statistics
+      connection->stats.txChannelData += dataLen;
+      connection->stats.txChannelPackets++;
+   }
+#endif
+
    //Return status code
    return error;
 }
@@ -390,14 +400,15 @@ error_list sshFormatChannelOpen(SshChannel *channel, const char_t *channelType,
    *length += sizeof(uint32_t);
 
    //Set initial window size
-   STORE32BE(SSH_CHANNEL_BUFFER_SIZE, p);
+   STORE32BE(channel->rxWindowTarget, p);
 
    //Point to the next field
    p += sizeof(uint32_t);
    *length += sizeof(uint32_t);
 
    //Set maximum packet size
-   STORE32BE(SSH_DEFAULT_MAX_PACKET_SIZE, p);
+   STORE32BE(channel->connection->maxPacketSize -
+      SSH_CHANNEL_DATA_MSG_HEADER_SIZE, p);
 
    //Point to the next field
    p += sizeof(uint32_t);
@@ -599,14 +610,15 @@ error_list sshFormatChannelOpenConfirmation(SshChannel *channel, uint8_t *p,
    *length += sizeof(uint32_t);
 
    //Set initial window size
-   STORE32BE(SSH_CHANNEL_BUFFER_SIZE, p);
+   STORE32BE(channel->rxWindowTarget, p);
 
    //Point to the next field
    p += sizeof(uint32_t);
    *length += sizeof(uint32_t);
 
    //Set maximum packet size
-   STORE32BE(SSH_DEFAULT_MAX_PACKET_SIZE, p);
+   STORE32BE(channel->connection->maxPacketSize -
+      SSH_CHANNEL_DATA_MSG_HEADER_SIZE, p);
 
    //Total length of the message
    *length += sizeof(uint32_t);
@@ -740,7 +752,7 @@ error_list sshFormatChannelData(SshChannel *channel, size_t dataLen,
    txBuffer = &channel->txBuffer;
 
    //Check the length of the payload data
-   if((dataLen + SSH_CHANNEL_DATA_MSG_HEADER_SIZE) > SSH_MAX_PACKET_SIZE)
+   if((dataLen + SSH_CHANNEL_DATA_MSG_HEADER_SIZE) > channel->connection->maxPacketSize)
       return ERROR_INVALID_LENGTH;
 
    //Total length of the message
@@ -884,7 +896,7 @@ error_list sshParseChannelOpen(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1183,7 +1195,7 @@ error_list sshParseChannelOpenConfirmation(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1325,7 +1337,7 @@ error_list sshParseChannelOpenFailure(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1451,7 +1463,7 @@ error_list sshParseChannelWindowAdjust(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1555,7 +1567,7 @@ error_list sshParseChannelData(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1607,6 +1619,16 @@ error_list sshParseChannelData(SshConnection *connection,
       {
          //Process payload data
          error = sshProcessChannelData(channel, data.value, data.length);
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+         //Check status code
+         if(!error)
+         {
+            //Update connection statistics
+            connection->stats.rxChannelData += data.length;
+            connection->stats.rxChannelPackets++;
+         }
+#endif
       }
       else
       {
@@ -1651,7 +1673,7 @@ error_list sshParseChannelExtendedData(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1757,7 +1779,7 @@ error_list sshParseChannelEof(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1840,7 +1862,7 @@ error_list sshParseChannelClose(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1908,6 +1930,7 @@ error_list sshParseChannelClose(SshConnection *connection,
          //Release SSH channel
          if(channel->closeRequest || !channel->channelSuccessSent)
          {
+            sshFreeChannelBuffers(channel);
             channel->state = SSH_CHANNEL_STATE_UNUSED;
          }
       }
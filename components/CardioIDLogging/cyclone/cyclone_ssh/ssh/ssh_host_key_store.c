@@ -0,0 +1,307 @@
+/**
+ * @file ssh_host_key_store.c
+ * @brief Trusted host key store indexed by SHA-256 fingerprint
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * sshVerifyHostKey decodes the trusted key file every time a host key is
+ * checked. When many keys are pinned, the keys are better decoded once and
+ * looked up by their SHA-256 fingerprint, which is the digest of the public
+ * key blob sent by the server (refer to RFC 4253, section 6.6)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_host_key_store.h"
+#include "ssh/ssh_key_import.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_SHA256_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Initialize a host key store
+ * @param[in] store Pointer to the host key store
+ * @param[in] entries Hash table
+ * @param[in] size Number of slots of the hash table. Lookups are fastest
+ *   when the table is at most half full
+ * @return Error code
+ **/
+
+error_list sshInitHostKeyStore(SshHostKeyStore *store, SshHostKeyEntry *entries,
+   uint_t size)
+{
+   //Check parameters
+   if(store == NULL || entries == NULL || size == 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the hash table
+   osMemset(entries, 0, size * sizeof(SshHostKeyEntry));
+
+   //Initialize the store
+   store->entries = entries;
+   store->size = size;
+   store->count = 0;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Add a trusted host key to the store
+ * @param[in] store Pointer to the host key store
+ * @param[in] trustedKey Trusted host key (SSH2 or OpenSSH format)
+ * @param[in] trustedKeyLen Length of the trusted host key
+ * @return Error code
+ **/
+
+error_list sshAddTrustedHostKey(SshHostKeyStore *store,
+   const char_t *trustedKey, size_t trustedKeyLen)
+{
+   error_list error;
+   size_t n;
+   uint8_t *buffer;
+   uint8_t fingerprint[SSH_HOST_KEY_FINGERPRINT_SIZE];
+
+   //Check parameters
+   if(store == NULL || trustedKey == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Retrieve the length of the public key structure
+   error = sshDecodePublicKeyFile(trustedKey, trustedKeyLen, NULL, &n);
+
+   //Check status code
+   if(!error)
+   {
+      //Allocate a memory buffer to hold the public key structure
+      buffer = sshAllocMem(n);
+
+      //Successful memory allocation?
+      if(buffer != NULL)
+      {
+         //Decode the content of the SSH public key file
+         error = sshDecodePublicKeyFile(trustedKey, trustedKeyLen, buffer, &n);
+
+         //Check status code
+         if(!error)
+         {
+            //Compute the fingerprint of the public key blob
+            error = sha256Compute(buffer, n, fingerprint);
+         }
+
+         //Release previously allocated memory
+         sshFreeMem(buffer);
+      }
+      else
+      {
+         //Failed to allocate memory
+         error = ERROR_OUT_OF_MEMORY;
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Add the fingerprint to the store
+      error = sshAddTrustedHostKeyFingerprint(store, fingerprint);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Add the fingerprint of a trusted host key to the store
+ * @param[in] store Pointer to the host key store
+ * @param[in] fingerprint SHA-256 digest of the public key blob
+ * @return Error code
+ **/
+
+error_list sshAddTrustedHostKeyFingerprint(SshHostKeyStore *store,
+   const uint8_t *fingerprint)
+{
+   uint_t i;
+   uint_t j;
+   SshHostKeyEntry *entry;
+
+   //Check parameters
+   if(store == NULL || store->size == 0 || fingerprint == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The fingerprint is uniformly distributed, so that its first bytes can
+   //be used as hash value
+   j = LOAD32BE(fingerprint) % store->size;
+
+   //Linear probing
+   for(i = 0; i < store->size; i++)
+   {
+      //Point to the current slot
+      entry = &store->entries[j];
+
+      //Free slot?
+      if(!entry->used)
+      {
+         //Save the fingerprint
+         osMemcpy(entry->fingerprint, fingerprint,
+            SSH_HOST_KEY_FINGERPRINT_SIZE);
+
+         //The slot is now in use
+         entry->used = TRUE;
+         store->count++;
+
+         //Successful processing
+         return NO_ERROR;
+      }
+
+      //The key is already trusted?
+      if(!osMemcmp(entry->fingerprint, fingerprint,
+         SSH_HOST_KEY_FINGERPRINT_SIZE))
+      {
+         return NO_ERROR;
+      }
+
+      //Next slot
+      j = (j + 1) % store->size;
+   }
+
+   //The hash table is full
+   return ERROR_BUFFER_OVERFLOW;
+}
+
+
+/**
+ * @brief Load trusted host key fingerprints from a binary blob
+ *
+ * The blob is the concatenation of the 32-byte SHA-256 fingerprints of the
+ * trusted keys, in binary form
+ *
+ * @param[in] store Pointer to the host key store
+ * @param[in] data Pointer to the blob
+ * @param[in] length Length of the blob, in bytes
+ * @return Error code
+ **/
+
+error_list sshLoadHostKeyStore(SshHostKeyStore *store, const uint8_t *data,
+   size_t length)
+{
+   error_list error;
+
+   //Check parameters
+   if(store == NULL || (data == NULL && length != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //The blob must hold a whole number of fingerprints
+   if((length % SSH_HOST_KEY_FINGERPRINT_SIZE) != 0)
+      return ERROR_INVALID_LENGTH;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Loop through the fingerprints
+   while(length > 0 && !error)
+   {
+      //Add the current fingerprint to the store
+      error = sshAddTrustedHostKeyFingerprint(store, data);
+
+      //Point to the next fingerprint
+      data += SSH_HOST_KEY_FINGERPRINT_SIZE;
+      length -= SSH_HOST_KEY_FINGERPRINT_SIZE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Check if a host key is trusted
+ * @param[in] store Pointer to the host key store
+ * @param[in] hostKey Host key to be checked
+ * @param[in] hostKeyLen Length of the host key, in bytes
+ * @return Error code
+ **/
+
+error_list sshVerifyHostKeyFromStore(const SshHostKeyStore *store,
+   const uint8_t *hostKey, size_t hostKeyLen)
+{
+   error_list error;
+   uint_t i;
+   uint_t j;
+   const SshHostKeyEntry *entry;
+   uint8_t fingerprint[SSH_HOST_KEY_FINGERPRINT_SIZE];
+
+   //Check parameters
+   if(store == NULL || hostKey == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The store has not been initialized?
+   if(store->size == 0)
+      return ERROR_INVALID_KEY;
+
+   //Compute the fingerprint of the host key
+   error = sha256Compute(hostKey, hostKeyLen, fingerprint);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Point to the slot the fingerprint hashes to
+   j = LOAD32BE(fingerprint) % store->size;
+
+   //Linear probing
+   for(i = 0; i < store->size; i++)
+   {
+      //Point to the current slot
+      entry = &store->entries[j];
+
+      //A free slot ends the probe sequence
+      if(!entry->used)
+         break;
+
+      //Matching fingerprint?
+      if(!osMemcmp(entry->fingerprint, fingerprint,
+         SSH_HOST_KEY_FINGERPRINT_SIZE))
+      {
+         //The host key is trusted
+         return NO_ERROR;
+      }
+
+      //Next slot
+      j = (j + 1) % store->size;
+   }
+
+   //The host key is unknown
+   return ERROR_INVALID_KEY;
+}
+
+#endif
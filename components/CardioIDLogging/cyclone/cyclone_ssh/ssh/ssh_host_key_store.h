@@ -0,0 +1,95 @@
+/**
+ * @file ssh_host_key_store.h
+ * @brief Trusted host key store indexed by SHA-256 fingerprint
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_HOST_KEY_STORE_H
+#define _SSH_HOST_KEY_STORE_H
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "hash/sha256.h"
+
+//Size of host key fingerprints
+#define SSH_HOST_KEY_FINGERPRINT_SIZE SHA256_DIGEST_SIZE
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Entry of the host key store
+ **/
+
+typedef struct
+{
+   bool_t used;                                        ///<The slot holds a trusted key
+   uint8_t fingerprint[SSH_HOST_KEY_FINGERPRINT_SIZE]; ///<SHA-256 digest of the public key blob
+} SshHostKeyEntry;
+
+
+/**
+ * @brief Trusted host key store
+ *
+ * The trusted keys are decoded once and only their SHA-256 fingerprint is
+ * kept, in an open-addressing hash table. The store is filled before the
+ * first connection and is read-only afterwards
+ **/
+
+typedef struct
+{
+   SshHostKeyEntry *entries; ///<Hash table
+   uint_t size;              ///<Number of slots of the hash table
+   uint_t count;             ///<Number of trusted keys
+} SshHostKeyStore;
+
+
+//Host key store related functions
+error_list sshInitHostKeyStore(SshHostKeyStore *store, SshHostKeyEntry *entries,
+   uint_t size);
+
+error_list sshAddTrustedHostKey(SshHostKeyStore *store,
+   const char_t *trustedKey, size_t trustedKeyLen);
+
+error_list sshAddTrustedHostKeyFingerprint(SshHostKeyStore *store,
+   const uint8_t *fingerprint);
+
+error_list sshLoadHostKeyStore(SshHostKeyStore *store, const uint8_t *data,
+   size_t length);
+
+error_list sshVerifyHostKeyFromStore(const SshHostKeyStore *store,
+   const uint8_t *hostKey, size_t hostKeyLen);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
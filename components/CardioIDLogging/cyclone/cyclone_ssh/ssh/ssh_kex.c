@@ -44,6 +44,7 @@
 #include "ssh/ssh_key_material.h"
 #include "ssh/ssh_exchange_hash.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_profiler.h"
 #include "debug.h"
 
 //Check SSH stack configuration
@@ -776,6 +777,12 @@ error_list sshParseKexInit(SshConnection *connection, const uint8_t *message,
    //An SSH_MSG_KEXINIT message has been successfully received
    connection->kexInitReceived = TRUE;
 
+   //Key re-exchange initiated by the peer?
+   if(connection->state == SSH_CONN_STATE_OPEN)
+   {
+      connection->rekeyInProgress = TRUE;
+   }
+
    //Debug message
    TRACE_INFO("  Selected kex algo = %s\r\n", connection->kexAlgo);
    TRACE_INFO("  Selected server host key algo = %s\r\n", connection->serverHostKeyAlgo);
@@ -1025,9 +1032,39 @@ error_list sshParseNewKeys(SshConnection *connection, const uint8_t *message,
    //Check status code
    if(!error)
    {
+#if (SSH_MPI_ARENA_SIZE > 0)
+      //Debug message
+      TRACE_INFO("SSH key exchange MPI allocations: arena=%" PRIu32
+         " heap=%" PRIu32 " peak=%" PRIu32 " bytes\r\n",
+         connection->kexMpiAllocs, connection->kexMpiHeapAllocs,
+         connection->kexMpiPeak);
+
+      //Reset the counters for the next key exchange
+      connection->kexMpiAllocs = 0;
+      connection->kexMpiHeapAllocs = 0;
+      connection->kexMpiPeak = 0;
+#endif
+
+#if (SSH_REKEY_SUPPORT == ENABLED)
+      //The thresholds apply to the data protected by the new keys
+      connection->kexBytes = 0;
+      connection->kexPackets = 0;
+      connection->kexTimestamp = osGetSystemTime();
+#endif
+
       //Key re-exchange?
       if(connection->newKeysReceived)
       {
+         //Debug message
+         TRACE_INFO("SSH key re-exchange completed\r\n");
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+         //Update connection statistics
+         connection->stats.rekeys++;
+#endif
+         //Channel data can flow again
+         connection->rekeyInProgress = FALSE;
+
          //Either party may later initiate a key re-exchange by sending a
          //SSH_MSG_KEXINIT message
          connection->kexInitSent = FALSE;
@@ -1043,6 +1080,9 @@ error_list sshParseNewKeys(SshConnection *connection, const uint8_t *message,
          //An SSH_MSG_NEWKEYS message has been successfully received
          connection->newKeysReceived = TRUE;
 
+         //The initial key exchange is complete
+         sshSetConnectionPhase(connection, SSH_CONN_PHASE_USER_AUTH);
+
 #if (SSH_EXT_INFO_SUPPORT == ENABLED)
          //Server operation mode?
          if(connection->context->mode == SSH_OPERATION_MODE_SERVER)
@@ -1095,6 +1135,10 @@ error_list sshParseKexMessage(SshConnection *connection, uint8_t type,
    }
    else
    {
+      //The temporaries of the key exchange computations are taken from the
+      //scratch arena
+      sshEnterMpiArena(connection);
+
 #if (SSH_RSA_KEX_SUPPORT == ENABLED)
       //RSA key exchange algorithm?
       if(sshIsRsaKexAlgo(connection->kexAlgo))
@@ -1145,6 +1189,9 @@ error_list sshParseKexMessage(SshConnection *connection, uint8_t type,
          //Report an error
          error = ERROR_UNSUPPORTED_KEY_EXCH_ALGO;
       }
+
+      //Release the scratch arena
+      error = sshLeaveMpiArena(connection, error);
    }
 
    //Return status code
@@ -1197,4 +1244,180 @@ error_list sshDigestClientKexInit(SshConnection *connection)
    return error;
 }
 
+
+/**
+ * @brief Check whether the keys of an open connection must be renewed
+ * @param[in] connection Pointer to the SSH connection
+ * @return TRUE if a key re-exchange must be initiated, else FALSE
+ **/
+
+bool_t sshIsRekeyRequired(SshConnection *connection)
+{
+   bool_t required;
+
+   //Initialize flag
+   required = FALSE;
+
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   //Keys can only be renewed once the connection is open
+   if(connection->state == SSH_CONN_STATE_OPEN)
+   {
+      //Explicit request?
+      if(connection->rekeyRequest)
+      {
+         required = TRUE;
+      }
+      //Too much data protected by the current keys?
+      else if(connection->rekeyBytes != 0 &&
+         connection->kexBytes >= connection->rekeyBytes)
+      {
+         required = TRUE;
+      }
+      //Too many packets protected by the current keys?
+      else if(connection->rekeyPackets != 0 &&
+         connection->kexPackets >= connection->rekeyPackets)
+      {
+         required = TRUE;
+      }
+      //Keys in use for too long?
+      else if(connection->rekeyInterval != 0 &&
+         timeCompare(osGetSystemTime(), connection->kexTimestamp +
+         connection->rekeyInterval) >= 0)
+      {
+         required = TRUE;
+      }
+      else
+      {
+         //The current keys can still be used
+      }
+   }
+#endif
+
+   //Return TRUE if the keys must be renewed
+   return required;
+}
+
+
+/**
+ * @brief Initiate a key re-exchange
+ *
+ * Either party may initiate the re-exchange by sending an SSH_MSG_KEXINIT
+ * message while the connection is open (refer to RFC 4253, section 9). The
+ * channels are not processed until the new keys are in use, but the
+ * connection-layer messages sent by the peer before its own SSH_MSG_KEXINIT
+ * are still accepted
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @return Error code
+ **/
+
+error_list sshStartRekey(SshConnection *connection)
+{
+   //Debug message
+   TRACE_INFO("Initiating SSH key re-exchange...\r\n");
+
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   //The request is being processed
+   connection->rekeyRequest = FALSE;
+#endif
+
+   //A key re-exchange is in progress
+   connection->rekeyInProgress = TRUE;
+
+   //Send SSH_MSG_KEXINIT message
+   if(connection->context->mode == SSH_OPERATION_MODE_CLIENT)
+   {
+      connection->state = SSH_CONN_STATE_CLIENT_KEX_INIT;
+   }
+   else
+   {
+      connection->state = SSH_CONN_STATE_SERVER_KEX_INIT;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Account for a packet protected by the current keys
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] length Length of the packet on the wire, in bytes
+ **/
+
+void sshUpdateRekeyCounters(SshConnection *connection, size_t length)
+{
+#if (SSH_REKEY_SUPPORT == ENABLED)
+   //Count both directions
+   connection->kexBytes += length;
+   connection->kexPackets++;
+#endif
+}
+
+
+#if (SSH_MPI_ARENA_SIZE > 0)
+
+/**
+ * @brief Enter the scratch arena before a key exchange computation
+ *
+ * The arena is shared by the connections of the SSH context. If it cannot
+ * be entered, the temporaries are simply allocated from the heap
+ *
+ * @param[in] connection Pointer to the SSH connection
+ **/
+
+void sshEnterMpiArena(SshConnection *connection)
+{
+   error_list error;
+
+   //Enter the scratch arena of the SSH context
+   error = mpiArenaEnter(&connection->context->mpiArena);
+
+   //Debug message
+   if(error)
+   {
+      TRACE_DEBUG("MPI scratch arena not available (error %d)\r\n", error);
+   }
+}
+
+
+/**
+ * @brief Leave the scratch arena after a key exchange computation
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] error Status of the key exchange computation
+ * @return Error code
+ **/
+
+error_list sshLeaveMpiArena(SshConnection *connection, error_list error)
+{
+   error_list status;
+   MpiArena *arena;
+
+   //Point to the scratch arena of the SSH context
+   arena = &connection->context->mpiArena;
+
+   //Make sure the arena has been entered by the calling task
+   if(arena->taskId == osGetCurrentTask())
+   {
+      //The integers that outlive the computation are moved to the heap
+      status = mpiArenaLeave(arena);
+
+      //Update the statistics of the key exchange
+      connection->kexMpiAllocs += arena->allocCount;
+      connection->kexMpiHeapAllocs += arena->heapCount + arena->moveCount;
+      connection->kexMpiPeak = MAX(connection->kexMpiPeak, arena->peak);
+
+      //The first error is reported
+      if(!error)
+      {
+         error = status;
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+
 #endif
@@ -60,6 +60,23 @@ error_list sshParseKexMessage(SshConnection *connection, uint8_t type,
 
 error_list sshDigestClientKexInit(SshConnection *connection);
 
+bool_t sshIsRekeyRequired(SshConnection *connection);
+error_list sshStartRekey(SshConnection *connection);
+void sshUpdateRekeyCounters(SshConnection *connection, size_t length);
+
+#if (SSH_MPI_ARENA_SIZE > 0)
+
+void sshEnterMpiArena(SshConnection *connection);
+error_list sshLeaveMpiArena(SshConnection *connection, error_list error);
+
+#else
+
+//Key exchange computations use the heap
+#define sshEnterMpiArena(connection)
+#define sshLeaveMpiArena(connection, error) (error)
+
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -37,6 +37,7 @@
 #include "ssh/ssh_transport.h"
 #include "ssh/ssh_kex.h"
 #include "ssh/ssh_kex_dh.h"
+#include "ssh/ssh_key_pool.h"
 #include "ssh/ssh_packet.h"
 #include "ssh/ssh_exchange_hash.h"
 #include "ssh/ssh_modp_groups.h"
@@ -61,10 +62,6 @@ error_list sshSendKexDhInit(SshConnection *connection)
    error_list error;
    size_t length;
    uint8_t *message;
-   SshContext *context;
-
-   //Point to the SSH context
-   context = connection->context;
 
    //Point to the buffer where to format the message
    message = connection->buffer + SSH_PACKET_HEADER_SIZE;
@@ -77,8 +74,7 @@ error_list sshSendKexDhInit(SshConnection *connection)
    if(!error)
    {
       //Generate an ephemeral key pair
-      error = dhGenerateKeyPair(&connection->dhContext, context->prngAlgo,
-         context->prngContext);
+      error = sshGenerateDhKeyPair(connection);
    }
 
    //Check status code
@@ -127,17 +123,12 @@ error_list sshSendKexDhReply(SshConnection *connection)
    error_list error;
    size_t length;
    uint8_t *message;
-   SshContext *context;
-
-   //Point to the SSH context
-   context = connection->context;
 
    //Point to the buffer where to format the message
    message = connection->buffer + SSH_PACKET_HEADER_SIZE;
 
    //Generate an ephemeral key pair
-   error = dhGenerateKeyPair(&connection->dhContext, context->prngAlgo,
-      context->prngContext);
+   error = sshGenerateDhKeyPair(connection);
 
    //Check status code
    if(!error)
@@ -622,6 +613,48 @@ error_list sshParseKexDhMessage(SshConnection *connection, uint8_t type,
 }
 
 
+/**
+ * @brief Diffie-Hellman key pair generation
+ * @param[in] connection Pointer to the SSH connection
+ * @return Error code
+ **/
+
+error_list sshGenerateDhKeyPair(SshConnection *connection)
+{
+   error_list error;
+   SshContext *context;
+
+   //Point to the SSH context
+   context = connection->context;
+
+#if (SSH_KEY_POOL_SUPPORT == ENABLED)
+   //Any pool of precomputed key pairs?
+   if(context->keyPool != NULL)
+   {
+      //Take a key pair that has been generated ahead of time
+      error = sshTakeDhKeyPair(context->keyPool, connection->kexAlgo,
+         &connection->dhContext);
+   }
+   else
+#endif
+   {
+      //No pool registered
+      error = ERROR_NOT_FOUND;
+   }
+
+   //No key pair available for the negotiated algorithm?
+   if(error == ERROR_NOT_FOUND)
+   {
+      //Generate an ephemeral key pair
+      error = dhGenerateKeyPair(&connection->dhContext, context->prngAlgo,
+         context->prngContext);
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Diffie-Hellman shared secret calculation
  * @param[in] connection Pointer to the SSH connection
@@ -58,6 +58,7 @@ error_list sshParseKexDhReply(SshConnection *connection, const uint8_t *message,
 error_list sshParseKexDhMessage(SshConnection *connection, uint8_t type,
    const uint8_t *message, size_t length);
 
+error_list sshGenerateDhKeyPair(SshConnection *connection);
 error_list sshComputeDhSharedSecret(SshConnection *connection);
 error_list sshDigestClientDhPublicKey(SshConnection *connection);
 
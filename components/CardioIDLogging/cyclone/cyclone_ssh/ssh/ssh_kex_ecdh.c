@@ -37,6 +37,7 @@
 #include "ssh/ssh_transport.h"
 #include "ssh/ssh_kex.h"
 #include "ssh/ssh_kex_ecdh.h"
+#include "ssh/ssh_key_pool.h"
 #include "ssh/ssh_packet.h"
 #include "ssh/ssh_exchange_hash.h"
 #include "ssh/ssh_key_verify.h"
@@ -728,6 +729,22 @@ error_list sshGenerateEcdhKeyPair(SshConnection *connection)
       error = ERROR_UNSUPPORTED_KEY_EXCH_ALGO;
    }
 
+#if (SSH_KEY_POOL_SUPPORT == ENABLED)
+   //Any pool of precomputed key pairs?
+   if(error == ERROR_UNSUPPORTED_KEY_EXCH_ALGO && context->keyPool != NULL)
+   {
+      //Take a key pair that has been generated ahead of time
+      error = sshTakeEcdhKeyPair(context->keyPool, connection->kexAlgo,
+         &connection->ecdhContext);
+
+      //No key pair available for the negotiated algorithm?
+      if(error == ERROR_NOT_FOUND)
+      {
+         error = ERROR_UNSUPPORTED_KEY_EXCH_ALGO;
+      }
+   }
+#endif
+
    //Check status code
    if(error == ERROR_UNSUPPORTED_KEY_EXCH_ALGO)
    {
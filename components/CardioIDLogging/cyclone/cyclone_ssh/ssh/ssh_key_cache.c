@@ -0,0 +1,291 @@
+/**
+ * @file ssh_key_cache.c
+ * @brief Cache of precomputed host key contexts
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The verification of an RSA or DSA signature starts by deriving the
+ * Montgomery constants of the modulus, among which R^2 mod n costs a full
+ * division of a 2k-word integer. The host key of a given server does not
+ * change from one connection to the next, so these constants are kept in a
+ * small cache indexed by a hash of the modulus
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_key_cache.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_KEY_CACHE_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Hash a modulus (FNV-1a over its significant words)
+ * @param[in] modulus Pointer to the modulus
+ * @return Hash value
+ **/
+
+uint32_t sshHashKeyCacheModulus(const Mpi *modulus)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t hash;
+
+   //Retrieve the length of the modulus, in words
+   n = mpiGetLength(modulus);
+
+   //Initialize hash value
+   hash = 2166136261U;
+
+   //Process the modulus word by word
+   for(i = 0; i < n; i++)
+   {
+      hash ^= modulus->data[i];
+      hash *= 16777619U;
+   }
+
+   //Return hash value
+   return hash;
+}
+
+
+/**
+ * @brief Find the entry holding the specified modulus
+ * @param[in] cache Pointer to the key cache
+ * @param[in] modulus Pointer to the modulus
+ * @param[in] hash Hash of the modulus
+ * @return Pointer to the matching entry, if any
+ **/
+
+SshKeyCacheEntry *sshFindKeyCacheEntry(SshKeyCache *cache,
+   const Mpi *modulus, uint32_t hash)
+{
+   uint_t i;
+   SshKeyCacheEntry *entry;
+
+   //Loop through the entries
+   for(i = 0; i < SSH_KEY_CACHE_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &cache->entries[i];
+
+      //The hash only selects the candidates. The moduli are compared in full
+      if(entry->context.k != 0 && entry->hash == hash &&
+         mpiComp(&entry->context.p, modulus) == 0)
+      {
+         return entry;
+      }
+   }
+
+   //Not found
+   return NULL;
+}
+
+
+/**
+ * @brief Initialize a key cache
+ * @param[in] cache Pointer to the key cache
+ * @return Error code
+ **/
+
+error_list sshInitKeyCache(SshKeyCache *cache)
+{
+   uint_t i;
+
+   //Check parameters
+   if(cache == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the cache
+   osMemset(cache, 0, sizeof(SshKeyCache));
+
+   //Initialize entries
+   for(i = 0; i < SSH_KEY_CACHE_SIZE; i++)
+   {
+      mpiMontgomeryInit(&cache->entries[i].context);
+   }
+
+   //Create a mutex to protect the cache
+   if(!osCreateMutex(&cache->mutex))
+   {
+      //Failed to create mutex
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get the precomputed context of a modulus
+ *
+ * On a miss, the context is computed and replaces the least recently used
+ * entry. On success, the cache remains locked until sshReleaseKeyCacheEntry
+ * is called, so that the context cannot be evicted while in use
+ *
+ * @param[in] cache Pointer to the key cache
+ * @param[in] modulus Pointer to the modulus
+ * @return Pointer to the Montgomery context, or NULL if the context could not
+ *   be computed
+ **/
+
+const MpiMontgomeryContext *sshAcquireKeyCacheEntry(SshKeyCache *cache,
+   const Mpi *modulus)
+{
+   error_list error;
+   uint_t i;
+   uint32_t hash;
+   SshKeyCacheEntry *entry;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;
+#endif
+
+   //Only odd moduli have a Montgomery representation
+   if(cache == NULL || mpiIsEven(modulus) || mpiCompInt(modulus, 0) <= 0)
+      return NULL;
+
+   //Hash the modulus
+   hash = sshHashKeyCacheModulus(modulus);
+
+   //Acquire exclusive access to the cache
+   osAcquireMutex(&cache->mutex);
+
+   //Look for the modulus
+   entry = sshFindKeyCacheEntry(cache, modulus, hash);
+
+   //Cache hit?
+   if(entry != NULL)
+   {
+      //Count the verifications served from the cache
+      cache->hits++;
+   }
+   else
+   {
+      //Select a free entry, or the least recently used one
+      for(entry = &cache->entries[0], i = 1; i < SSH_KEY_CACHE_SIZE; i++)
+      {
+         if(entry->context.k == 0)
+            break;
+
+         if(cache->entries[i].context.k == 0 ||
+            (cache->counter - cache->entries[i].lastUse) >
+            (cache->counter - entry->lastUse))
+         {
+            entry = &cache->entries[i];
+         }
+      }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+      //The verification may run inside the scratch arena of a key exchange,
+      //while the entry outlives it
+      arena = mpiArenaSuspend();
+#endif
+
+      //Release the evicted context
+      mpiMontgomeryFree(&entry->context);
+
+      //Compute the constants of the new modulus
+      error = mpiMontgomeryLoadModulus(&entry->context, modulus);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+      //Resume the scratch arena
+      mpiArenaResume(arena);
+#endif
+
+      //Any error to report?
+      if(error)
+      {
+         //The entry is now free
+         mpiMontgomeryFree(&entry->context);
+
+         //Release exclusive access to the cache
+         osReleaseMutex(&cache->mutex);
+
+         //The caller falls back to the regular computation
+         return NULL;
+      }
+
+      //Save the hash of the modulus
+      entry->hash = hash;
+
+      //Count the verifications that loaded a new modulus
+      cache->misses++;
+   }
+
+   //Mark the entry as the most recently used
+   entry->lastUse = ++cache->counter;
+
+   //The cache remains locked until the context is released
+   return &entry->context;
+}
+
+
+/**
+ * @brief Release a context obtained with sshAcquireKeyCacheEntry
+ * @param[in] cache Pointer to the key cache
+ **/
+
+void sshReleaseKeyCacheEntry(SshKeyCache *cache)
+{
+   //Release exclusive access to the cache
+   osReleaseMutex(&cache->mutex);
+}
+
+
+/**
+ * @brief Release a key cache
+ * @param[in] cache Pointer to the key cache
+ **/
+
+void sshDeinitKeyCache(SshKeyCache *cache)
+{
+   uint_t i;
+
+   //Make sure the cache is valid
+   if(cache != NULL)
+   {
+      //Release precomputed contexts
+      for(i = 0; i < SSH_KEY_CACHE_SIZE; i++)
+      {
+         mpiMontgomeryFree(&cache->entries[i].context);
+      }
+
+      //Release previously allocated resources
+      osDeleteMutex(&cache->mutex);
+
+      //Clear the cache
+      osMemset(cache, 0, sizeof(SshKeyCache));
+   }
+}
+
+#endif
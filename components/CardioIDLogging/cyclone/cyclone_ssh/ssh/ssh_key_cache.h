@@ -0,0 +1,102 @@
+/**
+ * @file ssh_key_cache.h
+ * @brief Cache of precomputed host key contexts
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_KEY_CACHE_H
+#define _SSH_KEY_CACHE_H
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "mpi/mpi.h"
+
+//Number of moduli held by the cache
+#ifndef SSH_KEY_CACHE_SIZE
+   #define SSH_KEY_CACHE_SIZE 4
+#elif (SSH_KEY_CACHE_SIZE < 1)
+   #error SSH_KEY_CACHE_SIZE parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Precomputed host key context
+ **/
+
+typedef struct
+{
+   uint32_t hash;                ///<Hash of the modulus
+   uint32_t lastUse;             ///<Value of the use counter when the entry was last used
+   MpiMontgomeryContext context; ///<Montgomery constants of the modulus (k is 0 if the entry is free)
+} SshKeyCacheEntry;
+
+
+/**
+ * @brief Cache of precomputed host key contexts
+ *
+ * The cache outlives the SSH contexts it is registered with, so that the
+ * constants of a host key modulus are computed once and reused by every
+ * subsequent connection to the same server. The least recently used entry
+ * is evicted when the cache is full
+ **/
+
+struct _SshKeyCache
+{
+   OsMutex mutex;                                ///<Mutex protecting the cache
+   uint32_t counter;                             ///<Use counter
+   SshKeyCacheEntry entries[SSH_KEY_CACHE_SIZE]; ///<Precomputed contexts
+   uint32_t hits;                                ///<Number of verifications served from the cache
+   uint32_t misses;                              ///<Number of verifications that loaded a new modulus
+};
+
+
+//Key cache related functions
+error_list sshInitKeyCache(SshKeyCache *cache);
+
+const MpiMontgomeryContext *sshAcquireKeyCacheEntry(SshKeyCache *cache,
+   const Mpi *modulus);
+
+void sshReleaseKeyCacheEntry(SshKeyCache *cache);
+
+void sshDeinitKeyCache(SshKeyCache *cache);
+
+uint32_t sshHashKeyCacheModulus(const Mpi *modulus);
+
+SshKeyCacheEntry *sshFindKeyCacheEntry(SshKeyCache *cache,
+   const Mpi *modulus, uint32_t hash);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -106,6 +106,14 @@ error_list sshInitEncryptionEngine(SshConnection *connection,
             &encryptionEngine->cipherContext, NULL, NULL, 1536);
       }
 
+      //The HMAC inner and outer pads only depend on the integrity key
+      error = hmacInitKeySchedule(&encryptionEngine->hmacKeySchedule,
+         encryptionEngine->hashAlgo, encryptionEngine->macKey,
+         encryptionEngine->hashAlgo->digestSize);
+      //Any error to report?
+      if(error)
+         return error;
+
       //Initialize HMAC context
       encryptionEngine->hmacContext = &connection->hmacContext;
    }
@@ -144,6 +152,14 @@ error_list sshInitEncryptionEngine(SshConnection *connection,
       if(error)
          return error;
 
+      //The HMAC inner and outer pads only depend on the integrity key
+      error = hmacInitKeySchedule(&encryptionEngine->hmacKeySchedule,
+         encryptionEngine->hashAlgo, encryptionEngine->macKey,
+         encryptionEngine->hashAlgo->digestSize);
+      //Any error to report?
+      if(error)
+         return error;
+
       //Initialize HMAC context
       encryptionEngine->hmacContext = &connection->hmacContext;
    }
@@ -246,6 +262,11 @@ void sshFreeEncryptionEngine(SshEncryptionEngine *encryptionEngine)
 
    //Erase integrity key
    osMemset(encryptionEngine->macKey, 0, SSH_MAX_HASH_DIGEST_SIZE);
+
+#if (SSH_HMAC_SUPPORT == ENABLED)
+   //Erase the precomputed HMAC states
+   osMemset(&encryptionEngine->hmacKeySchedule, 0, sizeof(HmacKeySchedule));
+#endif
 }
 
 
@@ -0,0 +1,557 @@
+/**
+ * @file ssh_key_pool.c
+ * @brief Pool of precomputed ephemeral key pairs
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Generating the ephemeral Diffie-Hellman or ECDH key pair is the costliest
+ * step of the client side of the key exchange. The key pairs are computed
+ * ahead of time, while the device is idle, and each of them is used for a
+ * single key exchange
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_algorithms.h"
+#include "ssh/ssh_key_pool.h"
+#include "ssh/ssh_kex_ecdh.h"
+#include "ssh/ssh_modp_groups.h"
+#include "ssh/ssh_misc.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_KEY_POOL_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Initialize a key pool entry
+ * @param[in] entry Pointer to the entry
+ **/
+
+void sshInitKeyPoolEntry(SshKeyPoolEntry *entry)
+{
+   //The entry is free
+   entry->kexAlgo = NULL;
+
+#if (SSH_DH_KEX_SUPPORT == ENABLED)
+   //Initialize Diffie-Hellman key pair
+   mpiInit(&entry->dhPrivateValue);
+   mpiInit(&entry->dhPublicValue);
+#endif
+
+#if (SSH_ECDH_KEX_SUPPORT == ENABLED)
+   //Initialize ECDH key pair
+   ecInitPrivateKey(&entry->ecPrivateKey);
+   ecInitPublicKey(&entry->ecPublicKey);
+#endif
+}
+
+
+/**
+ * @brief Erase a key pool entry
+ * @param[in] entry Pointer to the entry
+ **/
+
+void sshFreeKeyPoolEntry(SshKeyPoolEntry *entry)
+{
+#if (SSH_DH_KEX_SUPPORT == ENABLED)
+   //Release Diffie-Hellman key pair
+   mpiFree(&entry->dhPrivateValue);
+   mpiFree(&entry->dhPublicValue);
+#endif
+
+#if (SSH_ECDH_KEX_SUPPORT == ENABLED)
+   //Release ECDH key pair
+   ecFreePrivateKey(&entry->ecPrivateKey);
+   ecFreePublicKey(&entry->ecPublicKey);
+#endif
+
+   //The entry is now free
+   sshInitKeyPoolEntry(entry);
+}
+
+
+/**
+ * @brief Generate an ephemeral key pair
+ * @param[out] entry Pointer to the entry that receives the key pair
+ * @param[in] kexAlgo Key exchange algorithm name
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @return Error code
+ **/
+
+error_list sshGenerateKeyPoolEntry(SshKeyPoolEntry *entry,
+   const char_t *kexAlgo, const PrngAlgo *prngAlgo, void *prngContext)
+{
+   error_list error;
+
+#if (SSH_DH_KEX_SUPPORT == ENABLED)
+   //Diffie-Hellman key exchange algorithm?
+   if(sshIsDhKexAlgo(kexAlgo))
+   {
+      DhContext dhContext;
+
+      //Initialize Diffie-Hellman context
+      dhInit(&dhContext);
+
+      //Load the MODP group that matches the key exchange algorithm name
+      error = sshLoadDhModpGroup(&dhContext.params, kexAlgo);
+
+      //Check status code
+      if(!error)
+      {
+         //Generate an ephemeral key pair
+         error = dhGenerateKeyPair(&dhContext, prngAlgo, prngContext);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Move the key pair to the entry
+         entry->dhPrivateValue = dhContext.xa;
+         entry->dhPublicValue = dhContext.ya;
+         mpiInit(&dhContext.xa);
+         mpiInit(&dhContext.ya);
+      }
+
+      //Release Diffie-Hellman context
+      dhFree(&dhContext);
+   }
+   else
+#endif
+#if (SSH_ECDH_KEX_SUPPORT == ENABLED)
+   //ECDH key exchange algorithm?
+   if(sshIsEcdhKexAlgo(kexAlgo))
+   {
+      EcdhContext ecdhContext;
+
+      //Initialize ECDH context
+      ecdhInit(&ecdhContext);
+
+      //Load ECDH domain parameters
+      error = sshLoadKexEcdhParams(&ecdhContext.params, kexAlgo);
+
+      //Check status code
+      if(!error)
+      {
+         //Generate an ephemeral key pair
+         error = ecdhGenerateKeyPair(&ecdhContext, prngAlgo, prngContext);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Move the key pair to the entry
+         entry->ecPrivateKey = ecdhContext.da;
+         entry->ecPublicKey = ecdhContext.qa;
+         ecInitPrivateKey(&ecdhContext.da);
+         ecInitPublicKey(&ecdhContext.qa);
+      }
+
+      //Release ECDH context
+      ecdhFree(&ecdhContext);
+   }
+   else
+#endif
+   //Unknown key exchange algorithm?
+   {
+      //Report an error
+      error = ERROR_UNSUPPORTED_KEY_EXCH_ALGO;
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Save the key exchange algorithm the key pair is bound to
+      entry->kexAlgo = kexAlgo;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Find a key pair generated for the specified algorithm
+ *
+ * When no key pair matches, the pool switches to the specified algorithm so
+ * that the next key exchange can be served
+ *
+ * @param[in] pool Pointer to the key pool
+ * @param[in] kexAlgo Key exchange algorithm name
+ * @return Pointer to the matching entry, if any
+ **/
+
+SshKeyPoolEntry *sshFindKeyPoolEntry(SshKeyPool *pool, const char_t *kexAlgo)
+{
+   uint_t i;
+   SshKeyPoolEntry *entry;
+
+   //Loop through the entries
+   for(i = 0; i < SSH_KEY_POOL_SIZE; i++)
+   {
+      //Point to the current entry
+      entry = &pool->entries[i];
+
+      //Matching algorithm?
+      if(entry->kexAlgo != NULL && sshCompareAlgo(entry->kexAlgo, kexAlgo))
+         return entry;
+   }
+
+   //No key pair available for this algorithm
+   TRACE_INFO("No precomputed key pair available for %s\r\n", kexAlgo);
+
+   //Another algorithm has been negotiated. The pool now generates key pairs
+   //for that algorithm, and the key pairs bound to the previous one are
+   //dropped without having been used
+   if(pool->kexAlgo == NULL || !sshCompareAlgo(pool->kexAlgo, kexAlgo))
+   {
+      //Save the new algorithm
+      pool->kexAlgo = kexAlgo;
+
+      //Erase the key pairs that can no longer be used
+      for(i = 0; i < SSH_KEY_POOL_SIZE; i++)
+      {
+         sshFreeKeyPoolEntry(&pool->entries[i]);
+      }
+   }
+
+   //Count the key exchanges that found the pool empty
+   pool->misses++;
+
+   //Not found
+   return NULL;
+}
+
+
+/**
+ * @brief Initialize a key pool
+ * @param[in] pool Pointer to the key pool
+ * @param[in] kexAlgo Key exchange algorithm the key pairs are generated for,
+ *   until another algorithm gets negotiated
+ * @return Error code
+ **/
+
+error_list sshInitKeyPool(SshKeyPool *pool, const char_t *kexAlgo)
+{
+   uint_t i;
+
+   //Check parameters
+   if(pool == NULL || kexAlgo == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the pool
+   osMemset(pool, 0, sizeof(SshKeyPool));
+
+   //Initialize entries
+   for(i = 0; i < SSH_KEY_POOL_SIZE; i++)
+   {
+      sshInitKeyPoolEntry(&pool->entries[i]);
+   }
+
+   //Save the key exchange algorithm
+   pool->kexAlgo = kexAlgo;
+
+   //Create a mutex to protect the pool
+   if(!osCreateMutex(&pool->mutex))
+   {
+      //Failed to create mutex
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //Create an event object to wake up the task that fills the pool
+   if(!osCreateEvent(&pool->event))
+   {
+      //Clean up side effects
+      osDeleteMutex(&pool->mutex);
+
+      //Failed to create event
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+   //The pool is empty
+   osSetEvent(&pool->event);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Generate key pairs until the pool is full
+ *
+ * The key pairs are computed without holding the mutex of the pool, so that
+ * a key exchange is never blocked by the generation of a key pair. This
+ * function is meant to be called from a low-priority task
+ *
+ * @param[in] pool Pointer to the key pool
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @return Error code
+ **/
+
+error_list sshRefillKeyPool(SshKeyPool *pool, const PrngAlgo *prngAlgo,
+   void *prngContext)
+{
+   error_list error;
+   uint_t i;
+   const char_t *kexAlgo;
+   SshKeyPoolEntry newEntry;
+   SshKeyPoolEntry *entry;
+
+   //Check parameters
+   if(pool == NULL || prngAlgo == NULL || prngContext == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Fill the free entries
+   while(!error)
+   {
+      //Acquire exclusive access to the pool
+      osAcquireMutex(&pool->mutex);
+
+      //Look for a free entry
+      for(entry = NULL, i = 0; i < SSH_KEY_POOL_SIZE && entry == NULL; i++)
+      {
+         if(pool->entries[i].kexAlgo == NULL)
+         {
+            entry = &pool->entries[i];
+         }
+      }
+
+      //Get the algorithm currently in use
+      kexAlgo = pool->kexAlgo;
+
+      //Release exclusive access to the pool
+      osReleaseMutex(&pool->mutex);
+
+      //The pool is full?
+      if(entry == NULL)
+         break;
+
+      //Generate a new key pair
+      sshInitKeyPoolEntry(&newEntry);
+      error = sshGenerateKeyPoolEntry(&newEntry, kexAlgo, prngAlgo, prngContext);
+
+      //Check status code
+      if(!error)
+      {
+         //Acquire exclusive access to the pool
+         osAcquireMutex(&pool->mutex);
+
+         //The entry may have been filled in the meantime, or the algorithm
+         //may have changed
+         if(entry->kexAlgo == NULL && pool->kexAlgo == kexAlgo)
+         {
+            //Store the key pair
+            *entry = newEntry;
+            sshInitKeyPoolEntry(&newEntry);
+         }
+
+         //Release exclusive access to the pool
+         osReleaseMutex(&pool->mutex);
+      }
+
+      //Erase the key pair if it has not been stored
+      sshFreeKeyPoolEntry(&newEntry);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Wait until the pool needs refilling
+ * @param[in] pool Pointer to the key pool
+ * @param[in] timeout Maximum time to wait
+ * @return TRUE if some key pairs have been used, else FALSE
+ **/
+
+bool_t sshWaitForKeyPoolEvent(SshKeyPool *pool, systime_t timeout)
+{
+   //Check parameters
+   if(pool == NULL)
+      return FALSE;
+
+   //Wait for a key pair to be used
+   return osWaitForEvent(&pool->event, timeout);
+}
+
+
+/**
+ * @brief Take a precomputed Diffie-Hellman key pair from the pool
+ * @param[in] pool Pointer to the key pool
+ * @param[in] kexAlgo Key exchange algorithm name
+ * @param[in,out] dhContext Diffie-Hellman context that receives the key pair
+ * @return Error code
+ **/
+
+error_list sshTakeDhKeyPair(SshKeyPool *pool, const char_t *kexAlgo,
+   DhContext *dhContext)
+{
+#if (SSH_DH_KEX_SUPPORT == ENABLED)
+   error_list error;
+   SshKeyPoolEntry *entry;
+
+   //Acquire exclusive access to the pool
+   osAcquireMutex(&pool->mutex);
+
+   //Look for a key pair generated for this algorithm
+   entry = sshFindKeyPoolEntry(pool, kexAlgo);
+
+   //Any key pair available?
+   if(entry != NULL)
+   {
+      //Move the key pair to the Diffie-Hellman context
+      mpiFree(&dhContext->xa);
+      mpiFree(&dhContext->ya);
+      dhContext->xa = entry->dhPrivateValue;
+      dhContext->ya = entry->dhPublicValue;
+
+      //The key pair must not be used twice
+      sshInitKeyPoolEntry(entry);
+
+      //Count the key exchanges served from the pool
+      pool->hits++;
+      //Successful processing
+      error = NO_ERROR;
+   }
+   else
+   {
+      //The key pair has to be generated by the caller
+      error = ERROR_NOT_FOUND;
+   }
+
+   //Wake up the task that fills the pool
+   osSetEvent(&pool->event);
+
+   //Release exclusive access to the pool
+   osReleaseMutex(&pool->mutex);
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Take a precomputed ECDH key pair from the pool
+ * @param[in] pool Pointer to the key pool
+ * @param[in] kexAlgo Key exchange algorithm name
+ * @param[in,out] ecdhContext ECDH context that receives the key pair
+ * @return Error code
+ **/
+
+error_list sshTakeEcdhKeyPair(SshKeyPool *pool, const char_t *kexAlgo,
+   EcdhContext *ecdhContext)
+{
+#if (SSH_ECDH_KEX_SUPPORT == ENABLED)
+   error_list error;
+   SshKeyPoolEntry *entry;
+
+   //Acquire exclusive access to the pool
+   osAcquireMutex(&pool->mutex);
+
+   //Look for a key pair generated for this algorithm
+   entry = sshFindKeyPoolEntry(pool, kexAlgo);
+
+   //Any key pair available?
+   if(entry != NULL)
+   {
+      //Move the key pair to the ECDH context
+      ecFreePrivateKey(&ecdhContext->da);
+      ecFreePublicKey(&ecdhContext->qa);
+      ecdhContext->da = entry->ecPrivateKey;
+      ecdhContext->qa = entry->ecPublicKey;
+
+      //The key pair must not be used twice
+      sshInitKeyPoolEntry(entry);
+
+      //Count the key exchanges served from the pool
+      pool->hits++;
+      //Successful processing
+      error = NO_ERROR;
+   }
+   else
+   {
+      //The key pair has to be generated by the caller
+      error = ERROR_NOT_FOUND;
+   }
+
+   //Wake up the task that fills the pool
+   osSetEvent(&pool->event);
+
+   //Release exclusive access to the pool
+   osReleaseMutex(&pool->mutex);
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Release a key pool
+ * @param[in] pool Pointer to the key pool
+ **/
+
+void sshDeinitKeyPool(SshKeyPool *pool)
+{
+   uint_t i;
+
+   //Make sure the pool is valid
+   if(pool != NULL)
+   {
+      //Erase the key pairs that have not been used
+      for(i = 0; i < SSH_KEY_POOL_SIZE; i++)
+      {
+         sshFreeKeyPoolEntry(&pool->entries[i]);
+      }
+
+      //Release previously allocated resources
+      osDeleteMutex(&pool->mutex);
+      osDeleteEvent(&pool->event);
+
+      //Clear the pool
+      osMemset(pool, 0, sizeof(SshKeyPool));
+   }
+}
+
+#endif
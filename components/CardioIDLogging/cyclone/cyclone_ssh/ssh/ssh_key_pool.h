@@ -0,0 +1,118 @@
+/**
+ * @file ssh_key_pool.h
+ * @brief Pool of precomputed ephemeral key pairs
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_KEY_POOL_H
+#define _SSH_KEY_POOL_H
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "pkc/dh.h"
+#include "ecc/ecdh.h"
+
+//Number of key pairs held by the pool
+#ifndef SSH_KEY_POOL_SIZE
+   #define SSH_KEY_POOL_SIZE 2
+#elif (SSH_KEY_POOL_SIZE < 1)
+   #error SSH_KEY_POOL_SIZE parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Precomputed ephemeral key pair
+ **/
+
+typedef struct
+{
+   const char_t *kexAlgo;     ///<Key exchange algorithm (NULL if the entry is free)
+#if (SSH_DH_KEX_SUPPORT == ENABLED)
+   Mpi dhPrivateValue;        ///<Diffie-Hellman private value
+   Mpi dhPublicValue;         ///<Diffie-Hellman public value
+#endif
+#if (SSH_ECDH_KEX_SUPPORT == ENABLED)
+   EcPrivateKey ecPrivateKey; ///<ECDH private key
+   EcPublicKey ecPublicKey;   ///<ECDH public key
+#endif
+} SshKeyPoolEntry;
+
+
+/**
+ * @brief Pool of precomputed ephemeral key pairs
+ *
+ * The pool is filled ahead of time, typically by a low-priority task, and
+ * outlives the SSH contexts it is registered with. Each key pair is handed
+ * out once and erased from the pool
+ **/
+
+struct _SshKeyPool
+{
+   OsMutex mutex;                               ///<Mutex protecting the pool
+   OsEvent event;                               ///<Event signaled when the pool needs refilling
+   const char_t *kexAlgo;                       ///<Key exchange algorithm the key pairs are generated for
+   SshKeyPoolEntry entries[SSH_KEY_POOL_SIZE];  ///<Precomputed key pairs
+   uint32_t hits;                               ///<Number of key exchanges served from the pool
+   uint32_t misses;                             ///<Number of key exchanges that found the pool empty
+};
+
+
+//Key pool related functions
+error_list sshInitKeyPool(SshKeyPool *pool, const char_t *kexAlgo);
+
+error_list sshRefillKeyPool(SshKeyPool *pool, const PrngAlgo *prngAlgo,
+   void *prngContext);
+
+bool_t sshWaitForKeyPoolEvent(SshKeyPool *pool, systime_t timeout);
+
+error_list sshTakeDhKeyPair(SshKeyPool *pool, const char_t *kexAlgo,
+   DhContext *dhContext);
+
+error_list sshTakeEcdhKeyPair(SshKeyPool *pool, const char_t *kexAlgo,
+   EcdhContext *ecdhContext);
+
+void sshDeinitKeyPool(SshKeyPool *pool);
+
+void sshInitKeyPoolEntry(SshKeyPoolEntry *entry);
+void sshFreeKeyPoolEntry(SshKeyPoolEntry *entry);
+
+error_list sshGenerateKeyPoolEntry(SshKeyPoolEntry *entry,
+   const char_t *kexAlgo, const PrngAlgo *prngAlgo, void *prngContext);
+
+SshKeyPoolEntry *sshFindKeyPoolEntry(SshKeyPool *pool, const char_t *kexAlgo);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -38,6 +38,7 @@
 #include "ssh/ssh_key_parse.h"
 #include "ssh/ssh_key_verify.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_profiler.h"
 #include "debug.h"
 
 //Check SSH stack configuration
@@ -196,10 +197,16 @@ error_list sshVerifyServerHostKey(SshConnection *connection,
    //Invoke user-defined callback, if any
    if(context->hostKeyVerifyCallback != NULL)
    {
+      //The lookup is profiled separately from the key exchange
+      sshSetConnectionPhase(connection, SSH_CONN_PHASE_HOST_KEY_VERIFY);
+
       //It is recommended that the client verify that the host key sent is the
       //server's host key (for example, using a local database)
       error = context->hostKeyVerifyCallback(connection, hostKey->value,
          hostKey->length);
+
+      //Resume the key exchange
+      sshSetConnectionPhase(connection, SSH_CONN_PHASE_KEY_EXCHANGE);
    }
    else
    {
@@ -44,7 +44,9 @@
 #include "ssh/ssh_auth.h"
 #include "ssh/ssh_channel.h"
 #include "ssh/ssh_packet.h"
+#include "ssh/ssh_compress.h"
 #include "ssh/ssh_key_material.h"
+#include "ssh/ssh_profiler.h"
 #include "ssh/ssh_key_import.h"
 #include "ssh/ssh_key_format.h"
 #include "ssh/ssh_cert_import.h"
@@ -99,10 +101,30 @@ SshConnection *sshOpenConnection(SshContext *context, Socket *socket)
       connection->hostKeyIndex = -1;
       //Initialize time stamp
       connection->timestamp = osGetSystemTime();
+      //Default flow-control parameters
+      connection->maxPacketSize = SSH_MAX_PACKET_SIZE;
+      connection->channelWindowSize = SSH_DEFAULT_CHANNEL_WINDOW_SIZE;
+      connection->windowMemoryCap = SSH_DEFAULT_WINDOW_MEMORY_CAP;
+#if (SSH_REKEY_SUPPORT == ENABLED)
+      //Default key re-exchange thresholds
+      connection->rekeyBytes = SSH_DEFAULT_REKEY_BYTES;
+      connection->rekeyPackets = SSH_DEFAULT_REKEY_PACKETS;
+      connection->rekeyInterval = SSH_DEFAULT_REKEY_INTERVAL;
+#endif
 
       //Initialize status code
       error = NO_ERROR;
 
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+      //Allocate internal buffer
+      connection->buffer = sshAllocMem(SSH_BUFFER_SIZE);
+      //Failed to allocate memory?
+      if(connection->buffer == NULL)
+      {
+         error = ERROR_OUT_OF_MEMORY;
+      }
+#endif
+
       //Multiple callbacks may be registered
       for(i = 0; i < SSH_MAX_CONN_OPEN_CALLBACKS && !error; i++)
       {
@@ -136,14 +158,27 @@ SshConnection *sshOpenConnection(SshContext *context, Socket *socket)
          if(context->mode == SSH_OPERATION_MODE_CLIENT)
          {
             connection->state = SSH_CONN_STATE_CLIENT_ID;
+            //The socket is not connected yet
+            sshStartConnectionProfile(connection, SSH_CONN_PHASE_TCP_CONNECT);
          }
          else
          {
             connection->state = SSH_CONN_STATE_SERVER_ID;
+            //The socket has already been accepted
+            sshStartConnectionProfile(connection,
+               SSH_CONN_PHASE_VERSION_EXCHANGE);
          }
       }
       else
       {
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+         //Release internal buffer
+         if(connection->buffer != NULL)
+         {
+            sshFreeMem(connection->buffer);
+            connection->buffer = NULL;
+         }
+#endif
          //Clean up side effects
          connection->socket = NULL;
          //Return an invalid handle
@@ -194,6 +229,7 @@ void sshCloseConnection(SshConnection *connection)
             (channel->closeRequest || !channel->channelSuccessSent))
          {
             //Release SSH channel
+            sshFreeChannelBuffers(channel);
             channel->state = SSH_CHANNEL_STATE_UNUSED;
          }
          else
@@ -241,6 +277,11 @@ void sshCloseConnection(SshConnection *connection)
    //Release decryption engine
    sshFreeEncryptionEngine(&connection->decryptionEngine);
 
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   //Release compression contexts
+   sshFreeCompression(connection);
+#endif
+
    //Multiple callbacks may be registered
    for(i = 0; i < SSH_MAX_CONN_CLOSE_CALLBACKS; i++)
    {
@@ -253,6 +294,15 @@ void sshCloseConnection(SshConnection *connection)
       }
    }
 
+#if (SSH_DYNAMIC_BUFFER_SUPPORT == ENABLED)
+   //Release internal buffer
+   if(connection->buffer != NULL)
+   {
+      sshFreeMem(connection->buffer);
+      connection->buffer = NULL;
+   }
+#endif
+
    //Mark the connection as closed
    connection->state = SSH_CONN_STATE_CLOSED;
 
@@ -328,6 +378,13 @@ void sshRegisterConnectionEvents(SshContext *context, SshConnection *connection,
       }
       else if(connection->state == SSH_CONN_STATE_OPEN)
       {
+         //Time to renew the keys?
+         if(sshIsRekeyRequired(connection))
+         {
+            //Wait until there is more room in the send buffer
+            eventDesc->eventMask = SOCKET_EVENT_TX_READY;
+         }
+
          //Loop through SSH channels
          for(i = 0; i < context->numChannels; i++)
          {
@@ -365,6 +422,7 @@ error_list sshProcessConnectionEvents(SshContext *context,
 {
    error_list error;
    uint_t i;
+   uint_t k;
    size_t n;
 
    //Initialize status code
@@ -377,9 +435,23 @@ error_list sshProcessConnectionEvents(SshContext *context,
    //transport layer and user authentication protocols
    if(connection->state == SSH_CONN_STATE_OPEN)
    {
-      //Loop through SSH channels
-      for(i = 0; i < context->numChannels && !error; i++)
+      //The keys are renewed when the connection is idle
+      if(connection->txBufferLen == 0 && connection->rxBufferLen == 0 &&
+         sshIsRekeyRequired(connection))
+      {
+         //Send an SSH_MSG_KEXINIT message
+         error = sshStartRekey(connection);
+      }
+
+      //Loop through SSH channels. The scan starts after the channel that sent
+      //the last packet, so that a channel with a full send buffer cannot
+      //starve the other channels of the connection
+      for(k = 0; k < context->numChannels && !error &&
+         connection->state == SSH_CONN_STATE_OPEN; k++)
       {
+         //Round-robin scheduling
+         i = (connection->nextChannel + k) % context->numChannels;
+
          //Multiple channels can be multiplexed into a single connection
          if(context->channels[i].state != SSH_CHANNEL_STATE_UNUSED &&
             context->channels[i].connection == connection)
@@ -389,6 +461,13 @@ error_list sshProcessConnectionEvents(SshContext *context,
             {
                //Process channel related events
                error = sshProcessChannelEvents(&context->channels[i]);
+
+               //The channel has sent a packet?
+               if(connection->txBufferLen > 0)
+               {
+                  //The next channel is served first in the next round
+                  connection->nextChannel = (i + 1) % context->numChannels;
+               }
             }
          }
       }
@@ -440,8 +519,11 @@ error_list sshProcessConnectionEvents(SshContext *context,
 #if (SSH_DH_KEX_SUPPORT == ENABLED)
             else if(connection->state == SSH_CONN_STATE_KEX_DH_INIT)
             {
-               //Send SSH_MSG_KEX_DH_INIT message
+               //Send SSH_MSG_KEX_DH_INIT message (the key pair is generated
+               //in the scratch arena)
+               sshEnterMpiArena(connection);
                error = sshSendKexDhInit(connection);
+               error = sshLeaveMpiArena(connection, error);
             }
 #endif
 #if (SSH_DH_GEX_KEX_SUPPORT == ENABLED)
@@ -454,8 +536,11 @@ error_list sshProcessConnectionEvents(SshContext *context,
 #if (SSH_ECDH_KEX_SUPPORT == ENABLED)
             else if(connection->state == SSH_CONN_STATE_KEX_ECDH_INIT)
             {
-               //Send SSH_MSG_KEX_ECDH_INIT message
+               //Send SSH_MSG_KEX_ECDH_INIT message (the key pair is generated
+               //in the scratch arena)
+               sshEnterMpiArena(connection);
                error = sshSendKexEcdhInit(connection);
+               error = sshLeaveMpiArena(connection, error);
             }
 #endif
 #if (SSH_HBR_KEX_SUPPORT == ENABLED)
@@ -0,0 +1,936 @@
+/**
+ * @file ssh_mux.c
+ * @brief SSH connection shared by several client subsystems
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Each client subsystem of a device (file upload, remote diagnostics,
+ * metrics...) would otherwise need its own SSH context, connection buffers
+ * and full handshake. The multiplexer establishes one connection, runs it
+ * from its own task and opens "session" channels on behalf of the
+ * subsystems. Outgoing packets are scheduled round-robin across the channels
+ * by the SSH core
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_connection.h"
+#include "ssh/ssh_channel.h"
+#include "ssh/ssh_request.h"
+#include "ssh/ssh_misc.h"
+#include "ssh/ssh_mux.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_CLIENT_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Initialize settings with default values
+ * @param[out] settings Structure that contains SSH multiplexer settings
+ **/
+
+void sshMuxGetDefaultSettings(SshMuxSettings *settings)
+{
+   //Use default interface
+   settings->interface = NULL;
+   //Timeout for connection and channel establishment
+   settings->timeout = 20000;
+
+   //SSH channels
+   settings->numChannels = 0;
+   settings->channels = NULL;
+
+   //SSH initialization callback
+   settings->sshInitCallback = NULL;
+}
+
+
+/**
+ * @brief Initialize SSH multiplexer context
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] settings SSH multiplexer specific settings
+ * @return Error code
+ **/
+
+error_list sshMuxInit(SshMuxContext *context, const SshMuxSettings *settings)
+{
+   error_list error;
+   uint_t i;
+
+   //Debug message
+   TRACE_INFO("Initializing SSH multiplexer...\r\n");
+
+   //Ensure the parameters are valid
+   if(context == NULL || settings == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Invalid number of SSH channels?
+   if(settings->channels == NULL || settings->numChannels < 1)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear SSH multiplexer context
+   osMemset(context, 0, sizeof(SshMuxContext));
+
+   //Initialize SSH context
+   error = sshInit(&context->sshContext, &context->sshConnection, 1,
+      settings->channels, settings->numChannels);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Save settings
+   context->interface = settings->interface;
+   context->timeout = settings->timeout;
+   context->sshInitCallback = settings->sshInitCallback;
+
+   //Start of exception handling block
+   do
+   {
+      //Select client operation mode
+      error = sshSetOperationMode(&context->sshContext,
+         SSH_OPERATION_MODE_CLIENT);
+      //Any error to report?
+      if(error)
+         break;
+
+      //Create a mutex to protect the channel open requests
+      if(!osCreateMutex(&context->mutex))
+      {
+         //Failed to create mutex
+         error = ERROR_OUT_OF_RESOURCES;
+         break;
+      }
+
+      //Create an event object to wait for the connection
+      if(!osCreateEvent(&context->event))
+      {
+         //Failed to create event
+         error = ERROR_OUT_OF_RESOURCES;
+         break;
+      }
+
+      //Loop through the channel open requests
+      for(i = 0; i < SSH_MUX_MAX_REQUESTS && !error; i++)
+      {
+         //Create an event object to wait for the completion of the request
+         if(!osCreateEvent(&context->requests[i].event))
+         {
+            //Failed to create event
+            error = ERROR_OUT_OF_RESOURCES;
+         }
+      }
+
+      //End of exception handling block
+   } while(0);
+
+   //Any error to report?
+   if(error)
+   {
+      //Clean up side effects
+      sshMuxDeinit(context);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Establish the shared connection with the specified SSH server
+ *
+ * The call blocks until the key exchange and user authentication are
+ * complete. The multiplexer task then runs the connection
+ *
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] serverIpAddr IP address of the SSH server to connect to
+ * @param[in] serverPort Port number
+ * @return Error code
+ **/
+
+error_list sshMuxConnect(SshMuxContext *context, const IpAddr *serverIpAddr,
+   uint16_t serverPort)
+{
+   error_list error;
+   Socket *socket;
+   SshConnection *connection;
+
+   //Check parameters
+   if(context == NULL || serverIpAddr == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure the multiplexer is not already running
+   if(context->running)
+      return ERROR_ALREADY_CONNECTED;
+
+   //Debug message
+   TRACE_INFO("SSH multiplexer: connecting...\r\n");
+
+   //Invoke user-defined callback, if any
+   if(context->sshInitCallback != NULL)
+   {
+      //Perform SSH related initialization
+      error = context->sshInitCallback(context, &context->sshContext);
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //Open a TCP socket
+   socket = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   //Failed to open socket?
+   if(socket == NULL)
+      return ERROR_OPEN_FAILED;
+
+   //Associate the socket with the relevant interface
+   socketBindToInterface(socket, context->interface);
+   //Set timeout
+   socketSetTimeout(socket, context->timeout);
+
+   //Open a new SSH connection
+   connection = sshOpenConnection(&context->sshContext, socket);
+
+   //Failed to open connection?
+   if(connection == NULL)
+   {
+      //Clean up side effects
+      socketClose(socket);
+      //Report an error
+      return ERROR_OPEN_FAILED;
+   }
+
+   //Start of exception handling block
+   do
+   {
+      //Establish network connection
+      error = socketConnect(socket, serverIpAddr, serverPort);
+      //Any error to report?
+      if(error)
+         break;
+
+      //The connection is run by the multiplexer task in non-blocking mode
+      socketSetTimeout(socket, 0);
+
+      //Reset the event object
+      osResetEvent(&context->event);
+
+      //Start the multiplexer
+      context->stop = FALSE;
+      context->running = TRUE;
+
+#if (OS_STATIC_TASK_SUPPORT == ENABLED)
+      //Create a task using statically allocated memory
+      context->taskId = osCreateStaticTask("SSH Multiplexer",
+         (OsTaskCode) sshMuxTask, context, &context->taskTcb,
+         context->taskStack, SSH_MUX_STACK_SIZE, SSH_MUX_PRIORITY);
+#else
+      //Create a task
+      context->taskId = osCreateTask("SSH Multiplexer", (OsTaskCode) sshMuxTask,
+         context, SSH_MUX_STACK_SIZE, SSH_MUX_PRIORITY);
+#endif
+
+      //Failed to create task?
+      if(context->taskId == OS_INVALID_TASK_ID)
+      {
+         //Report an error
+         context->running = FALSE;
+         error = ERROR_OUT_OF_RESOURCES;
+         break;
+      }
+
+      //Wait for the key exchange and user authentication to complete
+      osWaitForEvent(&context->event, context->timeout);
+
+      //Check the state of the connection
+      if(!sshIsConnectionEstablished(connection))
+      {
+         //Report an error
+         error = ERROR_CONNECTION_FAILED;
+      }
+
+      //End of exception handling block
+   } while(0);
+
+   //Any error to report?
+   if(error)
+   {
+      //Debug message
+      TRACE_INFO("SSH multiplexer: failed to connect!\r\n");
+
+      //Stop the multiplexer and close the connection
+      sshMuxDisconnect(context);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Check whether the shared connection is established
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @return TRUE if channels can be opened, else FALSE
+ **/
+
+bool_t sshMuxIsConnected(SshMuxContext *context)
+{
+   //Make sure the SSH multiplexer context is valid
+   if(context == NULL)
+      return FALSE;
+
+   //The connection is run by the multiplexer task
+   return context->running &&
+      sshIsConnectionEstablished(&context->sshConnection);
+}
+
+
+/**
+ * @brief Open a channel over the shared connection
+ *
+ * A "session" channel is opened and, optionally, a channel request such as
+ * "subsystem" or "exec" is sent on it. The call blocks until the server has
+ * accepted both. The resulting channel is used with the regular channel API
+ * (sshWriteChannel, sshReadChannel...) and released with sshMuxCloseChannel
+ *
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] requestType Channel request to send once the channel is open
+ *   (NULL if no request is needed)
+ * @param[in] requestParams Parameters of the channel request
+ * @param[out] channel Handle referencing the newly opened channel
+ * @return Error code
+ **/
+
+error_list sshMuxOpenChannel(SshMuxContext *context, const char_t *requestType,
+   const void *requestParams, SshChannel **channel)
+{
+   error_list error;
+   uint_t i;
+   SshMuxRequest *request;
+
+   //Check parameters
+   if(context == NULL || channel == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize handle
+   *channel = NULL;
+
+   //The connection must be established and authenticated
+   if(!sshMuxIsConnected(context))
+      return ERROR_NOT_CONNECTED;
+
+   //Initialize pointer
+   request = NULL;
+
+   //Acquire exclusive access to the channel open requests
+   osAcquireMutex(&context->mutex);
+
+   //Loop through the channel open requests
+   for(i = 0; i < SSH_MUX_MAX_REQUESTS; i++)
+   {
+      //Free entry?
+      if(context->requests[i].state == SSH_MUX_REQUEST_STATE_FREE)
+      {
+         request = &context->requests[i];
+         break;
+      }
+   }
+
+   //Any entry available?
+   if(request != NULL)
+   {
+      //Queue the request for the multiplexer task
+      request->canceled = FALSE;
+      request->channel = NULL;
+      request->requestType = requestType;
+      request->requestParams = requestParams;
+      request->error = NO_ERROR;
+      request->state = SSH_MUX_REQUEST_STATE_PENDING;
+
+      //Reset the event object
+      osResetEvent(&request->event);
+   }
+
+   //Release exclusive access to the channel open requests
+   osReleaseMutex(&context->mutex);
+
+   //Too many simultaneous requests?
+   if(request == NULL)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Notify the multiplexer task that a request is pending
+   sshNotifyEvent(&context->sshContext);
+
+   //Wait for the server's response
+   osWaitForEvent(&request->event, context->timeout);
+
+   //Acquire exclusive access to the channel open requests
+   osAcquireMutex(&context->mutex);
+
+   //Check whether the request has completed
+   if(request->state == SSH_MUX_REQUEST_STATE_DONE)
+   {
+      //Retrieve the outcome of the request
+      error = request->error;
+
+      //Check status code
+      if(!error)
+      {
+         //Return the handle of the channel
+         *channel = request->channel;
+      }
+
+      //Release the entry
+      request->state = SSH_MUX_REQUEST_STATE_FREE;
+   }
+   else
+   {
+      //The multiplexer task releases the entry, and closes the channel if it
+      //gets open. The request parameters may not outlive this call
+      request->canceled = TRUE;
+      request->requestType = NULL;
+      request->requestParams = NULL;
+
+      //Report a timeout error
+      error = ERROR_TIMEOUT;
+   }
+
+   //Release exclusive access to the channel open requests
+   osReleaseMutex(&context->mutex);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Close a channel opened over the shared connection
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] channel Handle referencing the channel
+ * @return Error code
+ **/
+
+error_list sshMuxCloseChannel(SshMuxContext *context, SshChannel *channel)
+{
+   error_list error;
+
+   //Check parameters
+   if(context == NULL || channel == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Send SSH_MSG_CHANNEL_CLOSE and wait for the server's response
+   error = sshCloseChannel(channel);
+
+   //The channel can be reused by other subsystems
+   sshDeleteChannel(channel);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Close the shared connection
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @return Error code
+ **/
+
+error_list sshMuxDisconnect(SshMuxContext *context)
+{
+   //Make sure the SSH multiplexer context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Debug message
+   TRACE_INFO("SSH multiplexer: disconnecting...\r\n");
+
+   //Check whether the multiplexer is running
+   if(context->running)
+   {
+      //Stop the multiplexer
+      context->stop = TRUE;
+      //Send a signal to the task to abort any blocking operation
+      sshNotifyEvent(&context->sshContext);
+
+      //Wait for the task to terminate
+      while(context->running)
+      {
+         osDelayTask(1);
+      }
+   }
+
+   //Check the state of the SSH connection
+   if(context->sshConnection.state != SSH_CONN_STATE_CLOSED)
+   {
+      //Close SSH connection. The channels are closed too, so that any task
+      //blocked on one of them is released
+      sshCloseConnection(&context->sshConnection);
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief SSH multiplexer task
+ * @param[in] context Pointer to the SSH multiplexer context
+ **/
+
+void sshMuxTask(SshMuxContext *context)
+{
+   error_list error;
+   uint_t i;
+   systime_t timeout;
+   SshContext *sshContext;
+   SshConnection *connection;
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+   systime_t delay;
+#endif
+
+   //Point to the SSH context
+   sshContext = &context->sshContext;
+   //Point to the SSH connection
+   connection = &context->sshConnection;
+
+#if (NET_RTOS_SUPPORT == ENABLED)
+   //Task prologue
+   osEnterTask();
+
+   //Process events
+   while(1)
+   {
+#endif
+      //Stop request or connection lost?
+      if(context->stop || connection->state == SSH_CONN_STATE_CLOSED)
+      {
+         //Fail the channel open requests that are still outstanding
+         sshMuxAbortRequests(context);
+         //Release the task waiting for the connection, if any
+         osSetEvent(&context->event);
+
+         //Stop multiplexer operation
+         context->running = FALSE;
+         //Task epilogue
+         osExitTask();
+         //Kill ourselves
+         osDeleteTask(OS_SELF_TASK_ID);
+      }
+
+      //Release the task waiting for the connection, if any
+      if(sshIsConnectionEstablished(connection))
+      {
+         osSetEvent(&context->event);
+      }
+
+      //Send the pending channel open requests
+      sshMuxProcessRequests(context);
+
+      //Default timeout
+      timeout = SSH_MUX_TICK_INTERVAL;
+
+#if (SSH_CHANNEL_COALESCING_SUPPORT == ENABLED)
+      //Acquire exclusive access to the SSH context
+      osAcquireMutex(&sshContext->mutex);
+
+      //Wake up in time to send the data held back by write coalescing
+      for(i = 0; i < sshContext->numChannels; i++)
+      {
+         if(sshContext->channels[i].state == SSH_CHANNEL_STATE_OPEN)
+         {
+            //Get the time left before the buffered data must be sent
+            delay = sshGetChannelFlushDelay(&sshContext->channels[i]);
+
+            //Data held back?
+            if(delay > 0)
+            {
+               timeout = MIN(timeout, delay);
+            }
+         }
+      }
+
+      //Release exclusive access to the SSH context
+      osReleaseMutex(&sshContext->mutex);
+#endif
+
+      //Clear event descriptor set
+      osMemset(sshContext->eventDesc, 0, sizeof(sshContext->eventDesc));
+
+      //Register the events related to the shared connection
+      sshRegisterConnectionEvents(sshContext, connection,
+         &sshContext->eventDesc[0]);
+
+      //Wait for the socket to become ready to perform I/O, or for a channel
+      //to have data to send
+      error = socketPoll(sshContext->eventDesc, 1, &sshContext->event,
+         timeout);
+
+      //Check status code
+      if(error == NO_ERROR || error == ERROR_TIMEOUT ||
+         error == ERROR_WAIT_CANCELED)
+      {
+         //Clear status code
+         error = NO_ERROR;
+
+         //Check whether the socket is ready to perform I/O
+         if(sshContext->eventDesc[0].eventFlags != 0 && !context->stop)
+         {
+            //Connection event handler
+            error = sshProcessConnectionEvents(sshContext, connection);
+         }
+      }
+
+      //Any communication error?
+      if(error != NO_ERROR && error != ERROR_TIMEOUT &&
+         error != ERROR_WOULD_BLOCK)
+      {
+         //Debug message
+         TRACE_INFO("SSH multiplexer: connection lost (error %d)\r\n", error);
+
+         //Close the SSH connection. The channels are closed too, so that the
+         //tasks blocked on them are released
+         sshCloseConnection(connection);
+      }
+
+#if (NET_RTOS_SUPPORT == ENABLED)
+   }
+#endif
+}
+
+
+/**
+ * @brief Release SSH multiplexer context
+ * @param[in] context Pointer to the SSH multiplexer context
+ **/
+
+void sshMuxDeinit(SshMuxContext *context)
+{
+   uint_t i;
+
+   //Make sure the SSH multiplexer context is valid
+   if(context != NULL)
+   {
+      //Stop the multiplexer and close the connection
+      sshMuxDisconnect(context);
+
+      //Release previously allocated resources
+      osDeleteMutex(&context->mutex);
+      osDeleteEvent(&context->event);
+
+      //Loop through the channel open requests
+      for(i = 0; i < SSH_MUX_MAX_REQUESTS; i++)
+      {
+         osDeleteEvent(&context->requests[i].event);
+      }
+
+      //Release SSH context
+      sshDeinit(&context->sshContext);
+
+      //Clear SSH multiplexer context
+      osMemset(context, 0, sizeof(SshMuxContext));
+   }
+}
+
+
+/**
+ * @brief Send the pending channel open requests
+ *
+ * Messages are formatted in the buffer of the connection, which is only
+ * available when no packet is pending in either direction. The function is
+ * called by the multiplexer task, which owns that buffer
+ *
+ * @param[in] context Pointer to the SSH multiplexer context
+ **/
+
+void sshMuxProcessRequests(SshMuxContext *context)
+{
+   error_list error;
+   uint_t i;
+   bool_t ready;
+   SshChannel *channel;
+   SshMuxRequest *request;
+   SshConnection *connection;
+
+   //Point to the SSH connection
+   connection = &context->sshConnection;
+
+   //Acquire exclusive access to the channel open requests
+   osAcquireMutex(&context->mutex);
+
+   //Loop through the channel open requests
+   for(i = 0; i < SSH_MUX_MAX_REQUESTS; i++)
+   {
+      //Point to the current request
+      request = &context->requests[i];
+      //Point to the channel being opened, if any
+      channel = request->channel;
+
+      //No message other than key exchange messages can be sent while the
+      //keys are being renewed
+      ready = (connection->state == SSH_CONN_STATE_OPEN &&
+         connection->txBufferLen == 0 && connection->rxBufferLen == 0);
+
+      //Check the state of the request
+      if(request->state == SSH_MUX_REQUEST_STATE_PENDING)
+      {
+         //The requester gave up before anything was sent?
+         if(request->canceled)
+         {
+            //Release the entry
+            request->state = SSH_MUX_REQUEST_STATE_FREE;
+         }
+         else if(ready)
+         {
+            //Allocate a new SSH channel
+            channel = sshCreateChannel(connection);
+
+            //Valid channel handle?
+            if(channel != NULL)
+            {
+               //Save the channel handle
+               request->channel = channel;
+
+               //Blocking operations on the channel use the same timeout
+               error = sshSetChannelTimeout(channel, context->timeout);
+
+               //Check status code
+               if(!error)
+               {
+                  //Send an SSH_MSG_CHANNEL_OPEN message to the server
+                  error = sshSendChannelOpen(channel, "session", NULL);
+               }
+
+               //Check status code
+               if(!error)
+               {
+                  //Wait for the server's response
+                  request->state = SSH_MUX_REQUEST_STATE_OPENING;
+               }
+               else
+               {
+                  //Release the channel
+                  sshDeleteChannel(channel);
+                  request->channel = NULL;
+
+                  //The request has failed
+                  sshMuxCompleteRequest(context, request, error);
+               }
+            }
+            else
+            {
+               //All the channels are in use
+               sshMuxCompleteRequest(context, request, ERROR_OUT_OF_RESOURCES);
+            }
+         }
+      }
+      else if(request->state == SSH_MUX_REQUEST_STATE_OPENING)
+      {
+         //Check the state of the channel
+         if(channel->state == SSH_CHANNEL_STATE_OPEN)
+         {
+            //No channel request to send?
+            if(request->requestType == NULL)
+            {
+               //The channel is open
+               sshMuxCompleteRequest(context, request, NO_ERROR);
+            }
+            else if(ready)
+            {
+               //Send an SSH_MSG_CHANNEL_REQUEST message to the server
+               error = sshSendChannelRequest(channel, request->requestType,
+                  request->requestParams, TRUE);
+
+               //Check status code
+               if(!error)
+               {
+                  //Wait for the server's response
+                  request->state = SSH_MUX_REQUEST_STATE_REQUESTING;
+               }
+               else
+               {
+                  //Close the channel before reporting the error
+                  sshMuxCloseRequestChannel(context, request, error);
+               }
+            }
+         }
+         else if(channel->state == SSH_CHANNEL_STATE_CLOSED)
+         {
+            //An SSH_MSG_CHANNEL_OPEN_FAILURE message has been received
+            sshDeleteChannel(channel);
+            request->channel = NULL;
+
+            //The request has failed
+            sshMuxCompleteRequest(context, request, ERROR_OPEN_FAILED);
+         }
+      }
+      else if(request->state == SSH_MUX_REQUEST_STATE_REQUESTING)
+      {
+         //Check the state of the channel request
+         if(channel->requestState == SSH_REQUEST_STATE_SUCCESS)
+         {
+            //An SSH_MSG_CHANNEL_SUCCESS message has been received
+            sshMuxCompleteRequest(context, request, NO_ERROR);
+         }
+         else if(channel->requestState == SSH_REQUEST_STATE_FAILURE)
+         {
+            //An SSH_MSG_CHANNEL_FAILURE message has been received
+            sshMuxCloseRequestChannel(context, request, ERROR_OPEN_FAILED);
+         }
+         else if(channel->state == SSH_CHANNEL_STATE_CLOSED)
+         {
+            //The server has closed the channel
+            sshDeleteChannel(channel);
+            request->channel = NULL;
+
+            //The request has failed
+            sshMuxCompleteRequest(context, request, ERROR_OPEN_FAILED);
+         }
+      }
+      else if(request->state == SSH_MUX_REQUEST_STATE_CLOSING)
+      {
+         //The channel is considered closed when it has both sent and
+         //received SSH_MSG_CHANNEL_CLOSE
+         if(channel->state == SSH_CHANNEL_STATE_CLOSED)
+         {
+            //Release the channel
+            sshDeleteChannel(channel);
+            request->channel = NULL;
+
+            //Report the error that caused the channel to be closed
+            sshMuxCompleteRequest(context, request, request->error);
+         }
+      }
+      else
+      {
+         //Just for sanity
+      }
+   }
+
+   //Release exclusive access to the channel open requests
+   osReleaseMutex(&context->mutex);
+}
+
+
+/**
+ * @brief Close the channel of a request that cannot complete
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] request Pointer to the channel open request
+ * @param[in] error Error to report once the channel is closed
+ **/
+
+void sshMuxCloseRequestChannel(SshMuxContext *context, SshMuxRequest *request,
+   error_list error)
+{
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&context->sshContext.mutex);
+   //Request closure of the channel
+   request->channel->closeRequest = TRUE;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&context->sshContext.mutex);
+
+   //Wait for the channel to be closed
+   request->error = error;
+   request->state = SSH_MUX_REQUEST_STATE_CLOSING;
+}
+
+
+/**
+ * @brief Complete a channel open request
+ * @param[in] context Pointer to the SSH multiplexer context
+ * @param[in] request Pointer to the channel open request
+ * @param[in] error Outcome of the request
+ **/
+
+void sshMuxCompleteRequest(SshMuxContext *context, SshMuxRequest *request,
+   error_list error)
+{
+   //Is the requester still waiting?
+   if(!request->canceled)
+   {
+      //Save the outcome of the request
+      request->error = error;
+      request->state = SSH_MUX_REQUEST_STATE_DONE;
+
+      //Release the requester
+      osSetEvent(&request->event);
+   }
+   else if(!error && request->channel != NULL)
+   {
+      //Nobody will use the channel, close it
+      sshMuxCloseRequestChannel(context, request, ERROR_TIMEOUT);
+   }
+   else
+   {
+      //Release the entry
+      request->state = SSH_MUX_REQUEST_STATE_FREE;
+   }
+}
+
+
+/**
+ * @brief Fail the outstanding channel open requests
+ * @param[in] context Pointer to the SSH multiplexer context
+ **/
+
+void sshMuxAbortRequests(SshMuxContext *context)
+{
+   uint_t i;
+   SshMuxRequest *request;
+
+   //Acquire exclusive access to the channel open requests
+   osAcquireMutex(&context->mutex);
+
+   //Loop through the channel open requests
+   for(i = 0; i < SSH_MUX_MAX_REQUESTS; i++)
+   {
+      //Point to the current request
+      request = &context->requests[i];
+
+      //Outstanding request?
+      if(request->state != SSH_MUX_REQUEST_STATE_FREE &&
+         request->state != SSH_MUX_REQUEST_STATE_DONE)
+      {
+         //Release the channel being opened, if any
+         if(request->channel != NULL)
+         {
+            sshDeleteChannel(request->channel);
+            request->channel = NULL;
+         }
+
+         //The connection is no longer available
+         sshMuxCompleteRequest(context, request, ERROR_CONNECTION_CLOSING);
+      }
+   }
+
+   //Release exclusive access to the channel open requests
+   osReleaseMutex(&context->mutex);
+}
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file ssh_mux.h
+ * @brief SSH connection shared by several client subsystems
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_MUX_H
+#define _SSH_MUX_H
+
+//Dependencies
+#include "ssh/ssh.h"
+
+//Stack size required to run the SSH connection multiplexer
+#ifndef SSH_MUX_STACK_SIZE
+   #define SSH_MUX_STACK_SIZE 750
+#elif (SSH_MUX_STACK_SIZE < 1)
+   #error SSH_MUX_STACK_SIZE parameter is not valid
+#endif
+
+//Priority at which the SSH connection multiplexer should run
+#ifndef SSH_MUX_PRIORITY
+   #define SSH_MUX_PRIORITY OS_TASK_PRIORITY_NORMAL
+#endif
+
+//SSH connection multiplexer tick interval
+#ifndef SSH_MUX_TICK_INTERVAL
+   #define SSH_MUX_TICK_INTERVAL 1000
+#elif (SSH_MUX_TICK_INTERVAL < 100)
+   #error SSH_MUX_TICK_INTERVAL parameter is not valid
+#endif
+
+//Maximum number of simultaneous channel open requests
+#ifndef SSH_MUX_MAX_REQUESTS
+   #define SSH_MUX_MAX_REQUESTS 4
+#elif (SSH_MUX_MAX_REQUESTS < 1)
+   #error SSH_MUX_MAX_REQUESTS parameter is not valid
+#endif
+
+//Forward declaration of SshMuxContext structure
+struct _SshMuxContext;
+#define SshMuxContext struct _SshMuxContext
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Channel open request state
+ **/
+
+typedef enum
+{
+   SSH_MUX_REQUEST_STATE_FREE       = 0,
+   SSH_MUX_REQUEST_STATE_PENDING    = 1,
+   SSH_MUX_REQUEST_STATE_OPENING    = 2,
+   SSH_MUX_REQUEST_STATE_REQUESTING = 3,
+   SSH_MUX_REQUEST_STATE_CLOSING    = 4,
+   SSH_MUX_REQUEST_STATE_DONE       = 5
+} SshMuxRequestState;
+
+
+/**
+ * @brief SSH initialization callback function
+ **/
+
+typedef error_list (*SshMuxInitCallback)(SshMuxContext *context,
+   SshContext *sshContext);
+
+
+/**
+ * @brief Channel open request
+ **/
+
+typedef struct
+{
+   SshMuxRequestState state;  ///<State of the request
+   bool_t canceled;           ///<The requester is no longer waiting
+   SshChannel *channel;       ///<SSH channel being opened
+   const char_t *requestType; ///<Channel request sent once the channel is open (optional)
+   const void *requestParams; ///<Parameters of the channel request
+   error_list error;          ///<Outcome of the request
+   OsEvent event;             ///<Event signaled when the request completes
+} SshMuxRequest;
+
+
+/**
+ * @brief SSH connection multiplexer settings
+ **/
+
+typedef struct
+{
+   NetInterface *interface;            ///<Underlying network interface
+   systime_t timeout;                  ///<Timeout for connection and channel establishment
+   uint_t numChannels;                 ///<Maximum number of SSH channels
+   SshChannel *channels;               ///<SSH channels
+   SshMuxInitCallback sshInitCallback; ///<SSH initialization callback
+} SshMuxSettings;
+
+
+/**
+ * @brief SSH connection multiplexer context
+ *
+ * The multiplexer owns a single authenticated SSH connection. Its task runs
+ * the connection and hands out "session" channels to independent clients,
+ * which then use the regular blocking channel API
+ **/
+
+struct _SshMuxContext
+{
+   bool_t running;                               ///<Operational state of the multiplexer
+   bool_t stop;                                  ///<Stop request
+   OsTaskId taskId;                              ///<Task identifier
+#if (OS_STATIC_TASK_SUPPORT == ENABLED)
+   OsTaskTcb taskTcb;                            ///<Task control block
+   OsStackType taskStack[SSH_MUX_STACK_SIZE];    ///<Task stack
+#endif
+   NetInterface *interface;                      ///<Underlying network interface
+   systime_t timeout;                            ///<Timeout for connection and channel establishment
+   SshMuxInitCallback sshInitCallback;           ///<SSH initialization callback
+   OsMutex mutex;                                ///<Mutex protecting the channel open requests
+   OsEvent event;                                ///<Event signaled when the connection is set up or lost
+   SshMuxRequest requests[SSH_MUX_MAX_REQUESTS]; ///<Channel open requests
+   SshContext sshContext;                        ///<SSH context
+   SshConnection sshConnection;                  ///<SSH connection
+};
+
+
+//SSH connection multiplexer related functions
+void sshMuxGetDefaultSettings(SshMuxSettings *settings);
+
+error_list sshMuxInit(SshMuxContext *context, const SshMuxSettings *settings);
+
+error_list sshMuxConnect(SshMuxContext *context, const IpAddr *serverIpAddr,
+   uint16_t serverPort);
+
+bool_t sshMuxIsConnected(SshMuxContext *context);
+
+error_list sshMuxOpenChannel(SshMuxContext *context, const char_t *requestType,
+   const void *requestParams, SshChannel **channel);
+
+error_list sshMuxCloseChannel(SshMuxContext *context, SshChannel *channel);
+
+error_list sshMuxDisconnect(SshMuxContext *context);
+
+void sshMuxTask(SshMuxContext *context);
+
+void sshMuxDeinit(SshMuxContext *context);
+
+void sshMuxProcessRequests(SshMuxContext *context);
+
+void sshMuxCloseRequestChannel(SshMuxContext *context, SshMuxRequest *request,
+   error_list error);
+
+void sshMuxCompleteRequest(SshMuxContext *context, SshMuxRequest *request,
+   error_list error);
+
+void sshMuxAbortRequests(SshMuxContext *context);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
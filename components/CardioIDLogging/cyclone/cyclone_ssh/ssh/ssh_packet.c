@@ -40,6 +40,7 @@
 #include "ssh/ssh_connection.h"
 #include "ssh/ssh_request.h"
 #include "ssh/ssh_packet.h"
+#include "ssh/ssh_compress.h"
 #include "debug.h"
 
 //Check SSH stack configuration
@@ -69,6 +70,29 @@ error_list sshSendPacket(SshConnection *connection, uint8_t *payload,
    //Point to the encryption engine
    encryptionEngine = &connection->encryptionEngine;
 
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Update connection statistics
+   connection->stats.txPayload += payloadLen;
+#endif
+
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+   //Compression enabled in the outgoing direction?
+   if(connection->deflateContext != NULL)
+   {
+      //The payload is compressed in place, before the padding is computed
+      error = sshCompressPayload(connection->deflateContext, payload,
+         &payloadLen, payloadLen + SSH_ZLIB_MAX_OVERHEAD);
+      //Any error to report?
+      if(error)
+         return error;
+   }
+#endif
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Update connection statistics
+   connection->stats.txCompressed += payloadLen;
+#endif
+
    //Check whether an SSH_MSG_NEWKEYS message has been sent
    if(connection->newKeysSent)
    {
@@ -162,6 +186,14 @@ error_list sshSendPacket(SshConnection *connection, uint8_t *payload,
       //incremented after every packet (regardless of whether encryption or MAC
       //is in use)
       sshIncSequenceNumber(connection->encryptionEngine.seqNum);
+      //Count the packet against the key re-exchange thresholds
+      sshUpdateRekeyCounters(connection, connection->txBufferLen);
+
+#if (SSH_STATS_SUPPORT == ENABLED)
+      //Update connection statistics
+      connection->stats.txPackets++;
+      connection->stats.txBytes += connection->txBufferLen;
+#endif
    }
 
    //Return status code
@@ -343,6 +375,15 @@ error_list sshParsePacket(SshConnection *connection, uint8_t *packet,
    TRACE_DEBUG("SSH packet received (%" PRIuSIZE " bytes)...\r\n", length);
    TRACE_VERBOSE_ARRAY("  ", packet, length);
 
+#if (SSH_STATS_SUPPORT == ENABLED)
+   //Update connection statistics
+   connection->stats.rxPackets++;
+   connection->stats.rxBytes += length;
+#endif
+
+   //Count the packet against the key re-exchange thresholds
+   sshUpdateRekeyCounters(connection, length);
+
    //Check whether an SSH_MSG_NEWKEYS message has been received
    if(connection->newKeysReceived)
    {
@@ -372,8 +413,25 @@ error_list sshParsePacket(SshConnection *connection, uint8_t *packet,
                //Retrieve the length of the payload
                n -= paddingLen + sizeof(uint8_t);
 
+#if (SSH_ZLIB_SUPPORT == ENABLED)
+               //Compression enabled in the incoming direction?
+               if(connection->inflateContext != NULL)
+               {
+                  //Decompress the payload
+                  error = sshDecompressPayload(connection->inflateContext,
+                     packet, n, &packet, &n);
+               }
+
+               //Check status code
+               if(!error)
+               {
+                  //Parse the received message
+                  error = sshParseMessage(connection, packet, n);
+               }
+#else
                //Parse the received message
                error = sshParseMessage(connection, packet, n);
+#endif
             }
             else
             {
@@ -434,6 +492,12 @@ error_list sshParsePacket(SshConnection *connection, uint8_t *packet,
          error = sshSendDisconnect(connection, SSH_DISCONNECT_PROTOCOL_ERROR,
             "Flow control error");
       }
+      else if(error == ERROR_DECOMPRESSION_FAILED)
+      {
+         //The compressed stream is corrupted
+         error = sshSendDisconnect(connection, SSH_DISCONNECT_COMPRESSION_ERROR,
+            "Decompression error");
+      }
       else if(error == ERROR_INVALID_GROUP)
       {
          //Diffie-Hellman group out of range
@@ -471,10 +535,13 @@ error_list sshEncryptPacket(SshConnection *connection, uint8_t *packet,
    size_t n;
    uint8_t *data;
    size_t dataLen;
+   bool_t fused;
    SshEncryptionEngine *encryptionEngine;
 
    //Point to the encryption engine
    encryptionEngine = &connection->encryptionEngine;
+   //Check whether the cipher and the MAC can process the packet in one pass
+   fused = sshIsFusedCtrHmac(encryptionEngine);
 
    //Get the actual length of the packet
    n = *length;
@@ -485,7 +552,7 @@ error_list sshEncryptPacket(SshConnection *connection, uint8_t *packet,
 
 #if (SSH_HMAC_SUPPORT == ENABLED)
    //MAC-then-encrypt mode?
-   if(encryptionEngine->hashAlgo != NULL && !encryptionEngine->etm)
+   if(encryptionEngine->hashAlgo != NULL && !encryptionEngine->etm && !fused)
    {
       //The packet_length field and the payload will be encrypted
       data = packet;
@@ -502,6 +569,13 @@ error_list sshEncryptPacket(SshConnection *connection, uint8_t *packet,
       dataLen = n - sizeof(uint32_t);
    }
 
+   //Single-pass CTR encryption and HMAC computation?
+   if(fused)
+   {
+      //Encrypt the packet and compute the MAC chunk by chunk
+      error = sshEncryptCtrHmac(encryptionEngine, packet, n);
+   }
+   else
 #if (SSH_STREAM_CIPHER_SUPPORT == ENABLED)
    //Stream cipher?
    if(encryptionEngine->cipherMode == CIPHER_MODE_STREAM)
@@ -638,7 +712,7 @@ error_list sshEncryptPacket(SshConnection *connection, uint8_t *packet,
    if(!error)
    {
       //Encrypt-then-MAC mode?
-      if(encryptionEngine->hashAlgo != NULL && encryptionEngine->etm)
+      if(encryptionEngine->hashAlgo != NULL && encryptionEngine->etm && !fused)
       {
          //Compute message authentication code
          sshAppendMessageAuthCode(encryptionEngine, packet, n);
@@ -680,6 +754,7 @@ error_list sshDecryptPacket(SshConnection *connection, uint8_t *packet,
    error_list error;
    size_t n;
    size_t blockSize;
+   bool_t fused;
    SshEncryptionEngine *decryptionEngine;
 
    //Initialize status code
@@ -687,6 +762,8 @@ error_list sshDecryptPacket(SshConnection *connection, uint8_t *packet,
 
    //Point to the decryption engine
    decryptionEngine = &connection->decryptionEngine;
+   //Check whether the cipher and the MAC can process the packet in one pass
+   fused = sshIsFusedCtrHmac(decryptionEngine);
 
    //Block cipher algorithm?
    if(decryptionEngine->cipherMode == CIPHER_MODE_CBC ||
@@ -726,7 +803,7 @@ error_list sshDecryptPacket(SshConnection *connection, uint8_t *packet,
 
 #if (SSH_HMAC_SUPPORT == ENABLED)
       //Encrypt-then-MAC mode?
-      if(decryptionEngine->hashAlgo != NULL && decryptionEngine->etm)
+      if(decryptionEngine->hashAlgo != NULL && decryptionEngine->etm && !fused)
       {
          //Verify message authentication code
          error = sshVerifyMessageAuthCode(decryptionEngine, packet, n);
@@ -736,6 +813,13 @@ error_list sshDecryptPacket(SshConnection *connection, uint8_t *packet,
       //Check status code
       if(!error)
       {
+         //Single-pass CTR decryption and HMAC verification?
+         if(fused)
+         {
+            //Verify the MAC and decrypt the packet chunk by chunk
+            error = sshDecryptCtrHmac(decryptionEngine, packet, n, blockSize);
+         }
+         else
 #if (SSH_STREAM_CIPHER_SUPPORT == ENABLED)
          //Stream cipher?
          if(decryptionEngine->cipherMode == CIPHER_MODE_STREAM)
@@ -878,7 +962,7 @@ error_list sshDecryptPacket(SshConnection *connection, uint8_t *packet,
 
 #if (SSH_HMAC_SUPPORT == ENABLED)
       //MAC-then-encrypt mode?
-      if(decryptionEngine->hashAlgo != NULL && !decryptionEngine->etm)
+      if(decryptionEngine->hashAlgo != NULL && !decryptionEngine->etm && !fused)
       {
          //Verify message authentication code
          error = sshVerifyMessageAuthCode(decryptionEngine, packet, n);
@@ -1328,6 +1412,237 @@ error_list sshParseMessage(SshConnection *connection, const uint8_t *message,
 }
 
 
+/**
+ * @brief Check whether a packet can be processed in a single pass
+ * @param[in] encryptionEngine Pointer to the encryption engine
+ * @return TRUE if the engine combines CTR mode with an HMAC, else FALSE
+ **/
+
+bool_t sshIsFusedCtrHmac(SshEncryptionEngine *encryptionEngine)
+{
+#if (SSH_FUSED_CTR_HMAC_SUPPORT == ENABLED && SSH_CTR_CIPHER_SUPPORT == ENABLED && \
+   SSH_HMAC_SUPPORT == ENABLED)
+   //Block cipher in CTR mode with a separate MAC?
+   return (encryptionEngine->cipherMode == CIPHER_MODE_CTR &&
+      encryptionEngine->hashAlgo != NULL) ? TRUE : FALSE;
+#else
+   //Not implemented
+   return FALSE;
+#endif
+}
+
+
+/**
+ * @brief Single-pass CTR encryption and HMAC computation
+ *
+ * The packet is processed in chunks of SSH_FUSED_CHUNK_SIZE bytes. Each chunk
+ * goes through both the cipher and the MAC while it is still in the cache,
+ * instead of making two full passes over the packet. In MAC-then-encrypt
+ * mode, the MAC is computed over the plaintext. In encrypt-then-MAC mode, it
+ * is computed over the unencrypted packet_length field and the ciphertext
+ *
+ * @param[in] encryptionEngine Pointer to the encryption engine
+ * @param[in,out] packet Pointer to the packet, the MAC is appended to it
+ * @param[in] length Length of the packet, in bytes
+ * @return Error code
+ **/
+
+error_list sshEncryptCtrHmac(SshEncryptionEngine *encryptionEngine,
+   uint8_t *packet, size_t length)
+{
+#if (SSH_FUSED_CTR_HMAC_SUPPORT == ENABLED && SSH_CTR_CIPHER_SUPPORT == ENABLED && \
+   SSH_HMAC_SUPPORT == ENABLED)
+   error_list error;
+   uint_t m;
+   size_t n;
+   size_t offset;
+   HmacContext *hmacContext;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Point to the HMAC context
+   hmacContext = encryptionEngine->hmacContext;
+   //Retrieve cipher block size, in bits
+   m = encryptionEngine->cipherAlgo->blockSize * 8;
+
+   //Initialize HMAC calculation from the precomputed key schedule
+   hmacInitWithKeySchedule(hmacContext, &encryptionEngine->hmacKeySchedule);
+
+   //The MAC covers the sequence number and the whole packet
+   hmacUpdate(hmacContext, encryptionEngine->seqNum, 4);
+
+   //Encrypt-then-MAC mode?
+   if(encryptionEngine->etm)
+   {
+      //The packet_length field is not encrypted
+      hmacUpdate(hmacContext, packet, 4);
+      offset = 4;
+   }
+   else
+   {
+      //The packet_length field is encrypted
+      offset = 0;
+   }
+
+   //Process the packet chunk by chunk
+   while(offset < length && !error)
+   {
+      //Chunks are a multiple of the block size, except the last one
+      n = MIN(length - offset, SSH_FUSED_CHUNK_SIZE);
+
+      //Encrypt-then-MAC mode?
+      if(encryptionEngine->etm)
+      {
+         //Encrypt the chunk, then authenticate the ciphertext
+         error = ctrEncrypt(encryptionEngine->cipherAlgo,
+            &encryptionEngine->cipherContext, m, encryptionEngine->iv,
+            packet + offset, packet + offset, n);
+
+         hmacUpdate(hmacContext, packet + offset, n);
+      }
+      else
+      {
+         //Authenticate the plaintext, then encrypt the chunk
+         hmacUpdate(hmacContext, packet + offset, n);
+
+         error = ctrEncrypt(encryptionEngine->cipherAlgo,
+            &encryptionEngine->cipherContext, m, encryptionEngine->iv,
+            packet + offset, packet + offset, n);
+      }
+
+      //Next chunk
+      offset += n;
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //The MAC is transmitted as the last part of the packet
+      hmacFinal(hmacContext, packet + length);
+
+      //Debug message
+      TRACE_VERBOSE("Write sequence number:\r\n");
+      TRACE_VERBOSE_ARRAY("  ", &encryptionEngine->seqNum, 4);
+      TRACE_VERBOSE("Computed MAC:\r\n");
+      TRACE_VERBOSE_ARRAY("  ", packet + length, encryptionEngine->macSize);
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Single-pass CTR decryption and HMAC verification
+ *
+ * The first bytes of the packet have already been processed when its length
+ * was retrieved: they hold either the decrypted first block (MAC-then-encrypt)
+ * or the unencrypted packet_length field (encrypt-then-MAC). The rest of the
+ * packet is processed in chunks of SSH_FUSED_CHUNK_SIZE bytes. The packet
+ * must be discarded if the MAC does not match
+ *
+ * @param[in] decryptionEngine Pointer to the decryption engine
+ * @param[in,out] packet Pointer to the packet, followed by the received MAC
+ * @param[in] length Length of the packet, excluding the MAC, in bytes
+ * @param[in] offset Number of bytes already processed
+ * @return Error code
+ **/
+
+error_list sshDecryptCtrHmac(SshEncryptionEngine *decryptionEngine,
+   uint8_t *packet, size_t length, size_t offset)
+{
+#if (SSH_FUSED_CTR_HMAC_SUPPORT == ENABLED && SSH_CTR_CIPHER_SUPPORT == ENABLED && \
+   SSH_HMAC_SUPPORT == ENABLED)
+   error_list error;
+   uint_t m;
+   size_t i;
+   size_t n;
+   uint8_t mask;
+   uint8_t mac[SSH_MAX_HASH_DIGEST_SIZE];
+   HmacContext *hmacContext;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Point to the HMAC context
+   hmacContext = decryptionEngine->hmacContext;
+   //Retrieve cipher block size, in bits
+   m = decryptionEngine->cipherAlgo->blockSize * 8;
+
+   //Initialize HMAC calculation from the precomputed key schedule
+   hmacInitWithKeySchedule(hmacContext, &decryptionEngine->hmacKeySchedule);
+
+   //The MAC covers the sequence number and the whole packet
+   hmacUpdate(hmacContext, decryptionEngine->seqNum, 4);
+   hmacUpdate(hmacContext, packet, offset);
+
+   //Process the rest of the packet chunk by chunk
+   while(offset < length && !error)
+   {
+      //Chunks are a multiple of the block size, except the last one
+      n = MIN(length - offset, SSH_FUSED_CHUNK_SIZE);
+
+      //Encrypt-then-MAC mode?
+      if(decryptionEngine->etm)
+      {
+         //Authenticate the ciphertext, then decrypt the chunk
+         hmacUpdate(hmacContext, packet + offset, n);
+
+         error = ctrDecrypt(decryptionEngine->cipherAlgo,
+            &decryptionEngine->cipherContext, m, decryptionEngine->iv,
+            packet + offset, packet + offset, n);
+      }
+      else
+      {
+         //Decrypt the chunk, then authenticate the plaintext
+         error = ctrDecrypt(decryptionEngine->cipherAlgo,
+            &decryptionEngine->cipherContext, m, decryptionEngine->iv,
+            packet + offset, packet + offset, n);
+
+         hmacUpdate(hmacContext, packet + offset, n);
+      }
+
+      //Next chunk
+      offset += n;
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Finalize HMAC computation
+      hmacFinal(hmacContext, mac);
+
+      //Debug message
+      TRACE_VERBOSE("Read sequence number:\r\n");
+      TRACE_VERBOSE_ARRAY("  ", &decryptionEngine->seqNum, 4);
+      TRACE_VERBOSE("Computed MAC:\r\n");
+      TRACE_VERBOSE_ARRAY("  ", mac, decryptionEngine->macSize);
+
+      //The calculated MAC is bitwise compared to the received message
+      //authentication code
+      for(mask = 0, i = 0; i < decryptionEngine->macSize; i++)
+      {
+         mask |= mac[i] ^ packet[length + i];
+      }
+
+      //The message is authenticated if and only if the MAC values match
+      error = (mask == 0) ? NO_ERROR : ERROR_DECRYPTION_FAILED;
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Compute message authentication code
  * @param[in] encryptionEngine Pointer to the encryption engine
@@ -1339,9 +1654,9 @@ void sshAppendMessageAuthCode(SshEncryptionEngine *encryptionEngine,
    uint8_t *packet, size_t length)
 {
 #if (SSH_HMAC_SUPPORT == ENABLED)
-   //Initialize HMAC calculation
-   hmacInit(encryptionEngine->hmacContext, encryptionEngine->hashAlgo,
-      encryptionEngine->macKey, encryptionEngine->hashAlgo->digestSize);
+   //Initialize HMAC calculation from the precomputed key schedule
+   hmacInitWithKeySchedule(encryptionEngine->hmacContext,
+      &encryptionEngine->hmacKeySchedule);
 
    //Compute MAC(key, sequence_number || unencrypted_packet)
    hmacUpdate(encryptionEngine->hmacContext, encryptionEngine->seqNum, 4);
@@ -1373,9 +1688,9 @@ error_list sshVerifyMessageAuthCode(SshEncryptionEngine *decryptionEngine,
    uint8_t mask;
    uint8_t mac[SSH_MAX_HASH_DIGEST_SIZE];
 
-   //Initialize HMAC calculation
-   hmacInit(decryptionEngine->hmacContext, decryptionEngine->hashAlgo,
-      decryptionEngine->macKey, decryptionEngine->hashAlgo->digestSize);
+   //Initialize HMAC calculation from the precomputed key schedule
+   hmacInitWithKeySchedule(decryptionEngine->hmacContext,
+      &decryptionEngine->hmacKeySchedule);
 
    //Compute MAC(key, sequence_number || unencrypted_packet)
    hmacUpdate(decryptionEngine->hmacContext, decryptionEngine->seqNum, 4);
@@ -69,6 +69,14 @@ error_list sshDecryptPacketLength(SshConnection *connection, uint8_t *packet);
 error_list sshParseMessage(SshConnection *connection, const uint8_t *message,
    size_t length);
 
+bool_t sshIsFusedCtrHmac(SshEncryptionEngine *encryptionEngine);
+
+error_list sshEncryptCtrHmac(SshEncryptionEngine *encryptionEngine,
+   uint8_t *packet, size_t length);
+
+error_list sshDecryptCtrHmac(SshEncryptionEngine *decryptionEngine,
+   uint8_t *packet, size_t length, size_t offset);
+
 void sshAppendMessageAuthCode(SshEncryptionEngine *encryptionEngine,
    uint8_t *packet, size_t length);
 
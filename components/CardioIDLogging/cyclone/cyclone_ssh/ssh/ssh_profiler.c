@@ -0,0 +1,393 @@
+/**
+ * @file ssh_profiler.c
+ * @brief Connection setup profiler
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Each connection records the time it spends in the successive setup phases
+ * (TCP connection, version exchange, key exchange, host key verification,
+ * user authentication, channel opening and subsystem initialization). Once
+ * the connection is set up, the durations are accumulated into per-phase
+ * histograms shared by all connections
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SSH_TRACE_LEVEL
+
+//Dependencies
+#include "ssh/ssh.h"
+#include "ssh/ssh_profiler.h"
+#include "debug.h"
+
+//Check SSH stack configuration
+#if (SSH_SUPPORT == ENABLED && SSH_PROFILER_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Initialize a connection setup profiler
+ * @param[in] profiler Pointer to the profiler
+ * @param[in] logEnabled Log a record for each profiled connection
+ * @return Error code
+ **/
+
+error_list sshInitProfiler(SshProfiler *profiler, bool_t logEnabled)
+{
+   //Make sure the profiler is valid
+   if(profiler == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the structure
+   osMemset(profiler, 0, sizeof(SshProfiler));
+
+   //Create a mutex to protect the statistics
+   if(!osCreateMutex(&profiler->mutex))
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Save settings
+   profiler->logEnabled = logEnabled;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Add a sample measured outside of the SSH stack
+ *
+ * Phases such as the resolution of the server name happen before the
+ * connection is opened and are reported by the application
+ *
+ * @param[in] profiler Pointer to the profiler
+ * @param[in] phase Setup phase
+ * @param[in] duration Time spent in the phase, in ms
+ * @return Error code
+ **/
+
+error_list sshAddProfilerSample(SshProfiler *profiler,
+   SshConnectionPhase phase, uint32_t duration)
+{
+   //Check parameters
+   if(profiler == NULL || phase >= SSH_CONN_PHASE_COUNT)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the profiler
+   osAcquireMutex(&profiler->mutex);
+   //Update the histogram of the phase
+   sshUpdatePhaseHistogram(&profiler->stats.phases[phase], duration);
+   //Release exclusive access to the profiler
+   osReleaseMutex(&profiler->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Retrieve connection setup statistics
+ * @param[in] profiler Pointer to the profiler
+ * @param[out] stats Snapshot of the histograms
+ * @return Error code
+ **/
+
+error_list sshGetProfilerStats(SshProfiler *profiler, SshProfilerStats *stats)
+{
+   //Check parameters
+   if(profiler == NULL || stats == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the profiler
+   osAcquireMutex(&profiler->mutex);
+   //Take a consistent snapshot of the histograms
+   *stats = profiler->stats;
+   //Release exclusive access to the profiler
+   osReleaseMutex(&profiler->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Clear connection setup statistics
+ * @param[in] profiler Pointer to the profiler
+ **/
+
+void sshResetProfilerStats(SshProfiler *profiler)
+{
+   //Make sure the profiler is valid
+   if(profiler != NULL)
+   {
+      //Acquire exclusive access to the profiler
+      osAcquireMutex(&profiler->mutex);
+      //Clear the histograms
+      osMemset(&profiler->stats, 0, sizeof(SshProfilerStats));
+      //Release exclusive access to the profiler
+      osReleaseMutex(&profiler->mutex);
+   }
+}
+
+
+/**
+ * @brief Release a connection setup profiler
+ * @param[in] profiler Pointer to the profiler
+ **/
+
+void sshDeinitProfiler(SshProfiler *profiler)
+{
+   //Make sure the profiler is valid
+   if(profiler != NULL)
+   {
+      //Release previously allocated resources
+      osDeleteMutex(&profiler->mutex);
+
+      //Clear the structure
+      osMemset(profiler, 0, sizeof(SshProfiler));
+   }
+}
+
+
+/**
+ * @brief Retrieve the setup profile of a connection
+ * @param[in] connection Pointer to the SSH connection
+ * @param[out] profile Time spent by the connection in each setup phase
+ * @return Error code
+ **/
+
+error_list sshGetConnectionProfile(SshConnection *connection,
+   SshConnectionProfile *profile)
+{
+   //Check parameters
+   if(connection == NULL || profile == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Acquire exclusive access to the SSH context
+   osAcquireMutex(&connection->context->mutex);
+   //Take a consistent snapshot of the profile
+   *profile = connection->profile;
+   //Release exclusive access to the SSH context
+   osReleaseMutex(&connection->context->mutex);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get the name of a setup phase
+ * @param[in] phase Setup phase
+ * @return Name of the phase
+ **/
+
+const char_t *sshGetConnPhaseName(SshConnectionPhase phase)
+{
+   static const char_t *const label[SSH_CONN_PHASE_COUNT] =
+   {
+      "dns",
+      "tcp",
+      "version",
+      "kex",
+      "hostkey",
+      "auth",
+      "channel",
+      "sftp"
+   };
+
+   //Check the value of the parameter
+   if(phase < SSH_CONN_PHASE_COUNT)
+      return label[phase];
+   else
+      return "unknown";
+}
+
+
+/**
+ * @brief Start profiling a connection
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] phase First setup phase
+ **/
+
+void sshStartConnectionProfile(SshConnection *connection,
+   SshConnectionPhase phase)
+{
+   SshConnectionProfile *profile;
+
+   //Point to the profile of the connection
+   profile = &connection->profile;
+
+   //Clear the profile
+   osMemset(profile, 0, sizeof(SshConnectionProfile));
+
+   //Enter the first phase
+   profile->phase = phase;
+   profile->visited = 1U << phase;
+   profile->startTime = osGetSystemTime();
+   profile->timestamp = profile->startTime;
+}
+
+
+/**
+ * @brief Move a connection to a new setup phase
+ *
+ * The time elapsed since the previous transition is charged to the phase
+ * being left. Transitions occurring after the profile has been committed
+ * (key re-exchange, additional channels) are ignored
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] phase New setup phase
+ **/
+
+void sshSetConnectionPhase(SshConnection *connection,
+   SshConnectionPhase phase)
+{
+   systime_t time;
+   SshConnectionProfile *profile;
+
+   //Point to the profile of the connection
+   profile = &connection->profile;
+
+   //The connection is already set up?
+   if(profile->done)
+      return;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Charge the elapsed time to the current phase
+   profile->duration[profile->phase] += time - profile->timestamp;
+
+   //Enter the new phase
+   profile->phase = phase;
+   profile->visited |= 1U << phase;
+   profile->timestamp = time;
+}
+
+
+/**
+ * @brief Accumulate the profile of a connection that has been set up
+ * @param[in] connection Pointer to the SSH connection
+ **/
+
+void sshCommitConnectionProfile(SshConnection *connection)
+{
+   uint_t i;
+   uint32_t total;
+   SshProfiler *profiler;
+   SshConnectionProfile *profile;
+
+   //Point to the profile of the connection
+   profile = &connection->profile;
+
+   //The profile can only be committed once
+   if(profile->done)
+      return;
+
+   //Close the current phase
+   sshSetConnectionPhase(connection, profile->phase);
+   profile->done = TRUE;
+
+   //Total connection setup time
+   total = profile->timestamp - profile->startTime;
+
+   //Point to the profiler
+   profiler = connection->context->profiler;
+
+   //Any profiler registered?
+   if(profiler != NULL)
+   {
+      //Acquire exclusive access to the profiler
+      osAcquireMutex(&profiler->mutex);
+
+      //Update the histograms of the phases the connection went through
+      for(i = 0; i < SSH_CONN_PHASE_COUNT; i++)
+      {
+         if((profile->visited & (1U << i)) != 0)
+         {
+            sshUpdatePhaseHistogram(&profiler->stats.phases[i],
+               profile->duration[i]);
+         }
+      }
+
+      //Update the histogram of the total setup time
+      sshUpdatePhaseHistogram(&profiler->stats.total, total);
+      profiler->stats.connections++;
+
+      //Release exclusive access to the profiler
+      osReleaseMutex(&profiler->mutex);
+
+      //Per-connection log record
+      if(profiler->logEnabled)
+      {
+         TRACE_INFO("SSH connection setup: tcp=%" PRIu32 " version=%" PRIu32
+            " kex=%" PRIu32 " hostkey=%" PRIu32 " auth=%" PRIu32
+            " channel=%" PRIu32 " sftp=%" PRIu32 " total=%" PRIu32 " ms\r\n",
+            profile->duration[SSH_CONN_PHASE_TCP_CONNECT],
+            profile->duration[SSH_CONN_PHASE_VERSION_EXCHANGE],
+            profile->duration[SSH_CONN_PHASE_KEY_EXCHANGE],
+            profile->duration[SSH_CONN_PHASE_HOST_KEY_VERIFY],
+            profile->duration[SSH_CONN_PHASE_USER_AUTH],
+            profile->duration[SSH_CONN_PHASE_CHANNEL_OPEN],
+            profile->duration[SSH_CONN_PHASE_SFTP_INIT], total);
+      }
+   }
+}
+
+
+/**
+ * @brief Add a sample to a phase histogram
+ * @param[in] histogram Pointer to the histogram
+ * @param[in] value Duration, in ms
+ **/
+
+void sshUpdatePhaseHistogram(SshPhaseHistogram *histogram, uint32_t value)
+{
+   uint_t n;
+
+   //Select the bucket (base-2 logarithm of the duration)
+   for(n = 0; n < (SSH_PROFILER_NUM_BUCKETS - 1); n++)
+   {
+      //The duration is below the upper bound of the current bucket?
+      if((value >> n) == 0)
+         break;
+   }
+
+   //Update the histogram
+   histogram->buckets[n]++;
+   histogram->total += value;
+
+   //Keep track of the extreme values
+   if(histogram->count == 0 || value < histogram->min)
+      histogram->min = value;
+
+   if(value > histogram->max)
+      histogram->max = value;
+
+   //Number of samples
+   histogram->count++;
+}
+
+#endif
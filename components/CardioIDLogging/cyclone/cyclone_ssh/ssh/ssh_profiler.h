@@ -0,0 +1,136 @@
+/**
+ * @file ssh_profiler.h
+ * @brief Connection setup profiler
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2019-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSH Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+#ifndef _SSH_PROFILER_H
+#define _SSH_PROFILER_H
+
+//Dependencies
+#include "ssh/ssh.h"
+
+//Number of buckets of the phase histograms
+#ifndef SSH_PROFILER_NUM_BUCKETS
+   #define SSH_PROFILER_NUM_BUCKETS 16
+#elif (SSH_PROFILER_NUM_BUCKETS < 2 || SSH_PROFILER_NUM_BUCKETS > 32)
+   #error SSH_PROFILER_NUM_BUCKETS parameter is not valid
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Distribution of the time spent in a setup phase
+ *
+ * Bucket 0 counts the samples below 1 ms. Bucket n counts the samples in
+ * the range [2^(n-1), 2^n) ms, and the last bucket everything above
+ **/
+
+typedef struct
+{
+   uint32_t count;                             ///<Number of samples
+   uint64_t total;                             ///<Sum of the samples, in ms
+   uint32_t min;                               ///<Shortest sample, in ms
+   uint32_t max;                               ///<Longest sample, in ms
+   uint32_t buckets[SSH_PROFILER_NUM_BUCKETS]; ///<Logarithmic histogram
+} SshPhaseHistogram;
+
+
+/**
+ * @brief Connection setup statistics
+ **/
+
+typedef struct
+{
+   uint32_t connections;                           ///<Number of profiled connections
+   SshPhaseHistogram phases[SSH_CONN_PHASE_COUNT]; ///<Time spent in each phase
+   SshPhaseHistogram total;                        ///<Total connection setup time
+} SshProfilerStats;
+
+
+/**
+ * @brief Connection setup profiler
+ *
+ * The profiler outlives the SSH contexts it is registered with, so that the
+ * histograms cover all the connections made by the application
+ **/
+
+struct _SshProfiler
+{
+   OsMutex mutex;          ///<Mutex protecting the statistics
+   SshProfilerStats stats; ///<Accumulated statistics
+   bool_t logEnabled;      ///<Log a record for each profiled connection
+};
+
+
+//Connection setup profiler related functions
+error_list sshInitProfiler(SshProfiler *profiler, bool_t logEnabled);
+
+error_list sshAddProfilerSample(SshProfiler *profiler,
+   SshConnectionPhase phase, uint32_t duration);
+
+error_list sshGetProfilerStats(SshProfiler *profiler, SshProfilerStats *stats);
+void sshResetProfilerStats(SshProfiler *profiler);
+
+void sshDeinitProfiler(SshProfiler *profiler);
+
+error_list sshGetConnectionProfile(SshConnection *connection,
+   SshConnectionProfile *profile);
+
+const char_t *sshGetConnPhaseName(SshConnectionPhase phase);
+
+#if (SSH_PROFILER_SUPPORT == ENABLED)
+
+void sshStartConnectionProfile(SshConnection *connection,
+   SshConnectionPhase phase);
+
+void sshSetConnectionPhase(SshConnection *connection,
+   SshConnectionPhase phase);
+
+void sshCommitConnectionProfile(SshConnection *connection);
+
+void sshUpdatePhaseHistogram(SshPhaseHistogram *histogram, uint32_t value);
+
+#else
+
+//Profiling hooks are compiled out
+#define sshStartConnectionProfile(connection, phase)
+#define sshSetConnectionPhase(connection, phase)
+#define sshCommitConnectionProfile(connection)
+
+#endif
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
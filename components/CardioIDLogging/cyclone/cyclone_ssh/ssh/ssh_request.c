@@ -371,6 +371,13 @@ error_list sshFormatGlobalRequest(SshConnection *connection,
       //Format "elevation" request specific data
       error = sshFormatElevationParams(requestParams, p, &n);
    }
+   else if(!osStrcmp(requestName, "keepalive@openssh.com"))
+   {
+      //The "keepalive@openssh.com" request has no request specific data. The
+      //recipient replies with SSH_MSG_REQUEST_FAILURE if it does not
+      //recognize the request, which is enough to prove that it is alive
+      n = 0;
+   }
    else
    {
       //Report an error
@@ -1004,7 +1011,7 @@ error_list sshParseGlobalRequest(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1215,7 +1222,7 @@ error_list sshParseRequestSuccess(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1250,7 +1257,7 @@ error_list sshParseRequestFailure(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Malformed message?
@@ -1297,7 +1304,7 @@ error_list sshParseChannelRequest(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1769,7 +1776,7 @@ error_list sshParseChannelSuccess(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -1859,7 +1866,7 @@ error_list sshParseChannelFailure(SshConnection *connection,
    TRACE_VERBOSE_ARRAY("  ", message, length);
 
    //Check connection state
-   if(connection->state != SSH_CONN_STATE_OPEN)
+   if(!sshIsConnectionEstablished(connection))
       return ERROR_UNEXPECTED_MESSAGE;
 
    //Sanity check
@@ -38,6 +38,7 @@
 #include "ssh/ssh_cert_import.h"
 #include "ssh/ssh_sign_verify.h"
 #include "ssh/ssh_sign_misc.h"
+#include "ssh/ssh_key_cache.h"
 #include "ssh/ssh_misc.h"
 #include "debug.h"
 
@@ -146,8 +147,8 @@ error_list sshVerifySignature(SshConnection *connection,
          sshCompareString(&signFormatId, "rsa-sha2-512"))
       {
          //RSA signature verification
-         error = sshVerifyRsaSignature(publicKeyAlgo, publicKeyBlob,
-            sessionId, message, &signatureBlob);
+         error = sshVerifyRsaSignature(connection, publicKeyAlgo,
+            publicKeyBlob, sessionId, message, &signatureBlob);
       }
       else
 #endif
@@ -156,8 +157,8 @@ error_list sshVerifySignature(SshConnection *connection,
       if(sshCompareString(&signFormatId, "ssh-dss"))
       {
          //DSA signature verification
-         error = sshVerifyDsaSignature(publicKeyAlgo, publicKeyBlob,
-            sessionId, message, &signatureBlob);
+         error = sshVerifyDsaSignature(connection, publicKeyAlgo,
+            publicKeyBlob, sessionId, message, &signatureBlob);
       }
       else
 #endif
@@ -207,6 +208,7 @@ error_list sshVerifySignature(SshConnection *connection,
 
 /**
  * @brief RSA signature verification
+ * @param[in] connection Pointer to the SSH connection
  * @param[in] publicKeyAlgo Public key algorithm
  * @param[in] publicKeyBlob Signer's public key
  * @param[in] sessionId Session identifier (optional parameter)
@@ -215,9 +217,10 @@ error_list sshVerifySignature(SshConnection *connection,
  * @return Error code
  **/
 
-error_list sshVerifyRsaSignature(const SshString *publicKeyAlgo,
-   const SshBinaryString *publicKeyBlob, const SshBinaryString *sessionId,
-   const SshBinaryString *message, const SshBinaryString *signatureBlob)
+error_list sshVerifyRsaSignature(SshConnection *connection,
+   const SshString *publicKeyAlgo, const SshBinaryString *publicKeyBlob,
+   const SshBinaryString *sessionId, const SshBinaryString *message,
+   const SshBinaryString *signatureBlob)
 {
 #if (SSH_RSA_SIGN_SUPPORT == ENABLED)
    error_list error;
@@ -328,9 +331,23 @@ error_list sshVerifyRsaSignature(const SshString *publicKeyAlgo,
       //Check status code
       if(!error)
       {
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+         //Reuse the precomputed constants of the modulus, if available
+         rsaPublicKey.montContext = sshAcquireKeyCacheEntry(
+            connection->context->keyCache, &rsaPublicKey.n);
+#endif
+
          //Verify RSA signature
          error = rsassaPkcs1v15Verify(&rsaPublicKey, hashAlgo,
             hashContext.digest, signatureBlob->value, signatureBlob->length);
+
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+         //Release the precomputed constants
+         if(rsaPublicKey.montContext != NULL)
+         {
+            sshReleaseKeyCacheEntry(connection->context->keyCache);
+         }
+#endif
       }
 
       //Free previously allocated resources
@@ -353,6 +370,7 @@ error_list sshVerifyRsaSignature(const SshString *publicKeyAlgo,
 
 /**
  * @brief DSA signature verification
+ * @param[in] connection Pointer to the SSH connection
  * @param[in] publicKeyAlgo Public key algorithm
  * @param[in] publicKeyBlob Signer's public key
  * @param[in] sessionId Session identifier (optional parameter)
@@ -361,9 +379,10 @@ error_list sshVerifyRsaSignature(const SshString *publicKeyAlgo,
  * @return Error code
  **/
 
-error_list sshVerifyDsaSignature(const SshString *publicKeyAlgo,
-   const SshBinaryString *publicKeyBlob, const SshBinaryString *sessionId,
-   const SshBinaryString *message, const SshBinaryString *signatureBlob)
+error_list sshVerifyDsaSignature(SshConnection *connection,
+   const SshString *publicKeyAlgo, const SshBinaryString *publicKeyBlob,
+   const SshBinaryString *sessionId, const SshBinaryString *message,
+   const SshBinaryString *signatureBlob)
 {
 #if (SSH_DSA_SIGN_SUPPORT == ENABLED)
    error_list error;
@@ -456,9 +475,23 @@ error_list sshVerifyDsaSignature(const SshString *publicKeyAlgo,
       //Check status code
       if(!error)
       {
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+         //Reuse the precomputed constants of the modulus, if available
+         dsaPublicKey.montContext = sshAcquireKeyCacheEntry(
+            connection->context->keyCache, &dsaPublicKey.params.p);
+#endif
+
          //Verify DSA signature
          error = dsaVerifySignature(&dsaPublicKey, sha1Context.digest,
             SHA1_DIGEST_SIZE, &dsaSignature);
+
+#if (SSH_KEY_CACHE_SUPPORT == ENABLED)
+         //Release the precomputed constants
+         if(dsaPublicKey.montContext != NULL)
+         {
+            sshReleaseKeyCacheEntry(connection->context->keyCache);
+         }
+#endif
       }
 
       //Free previously allocated resources
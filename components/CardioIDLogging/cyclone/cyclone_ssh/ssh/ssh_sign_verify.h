@@ -45,13 +45,15 @@ error_list sshVerifySignature(SshConnection *connection,
    const SshBinaryString *sessionId, const SshBinaryString *message,
    const SshBinaryString *signature);
 
-error_list sshVerifyRsaSignature(const SshString *publicKeyAlgo,
-   const SshBinaryString *publicKeyBlob, const SshBinaryString *sessionId,
-   const SshBinaryString *message, const SshBinaryString *signatureBlob);
+error_list sshVerifyRsaSignature(SshConnection *connection,
+   const SshString *publicKeyAlgo, const SshBinaryString *publicKeyBlob,
+   const SshBinaryString *sessionId, const SshBinaryString *message,
+   const SshBinaryString *signatureBlob);
 
-error_list sshVerifyDsaSignature(const SshString *publicKeyAlgo,
-   const SshBinaryString *publicKeyBlob, const SshBinaryString *sessionId,
-   const SshBinaryString *message, const SshBinaryString *signatureBlob);
+error_list sshVerifyDsaSignature(SshConnection *connection,
+   const SshString *publicKeyAlgo, const SshBinaryString *publicKeyBlob,
+   const SshBinaryString *sessionId, const SshBinaryString *message,
+   const SshBinaryString *signatureBlob);
 
 error_list sshVerifyEcdsaSignature(const SshString *publicKeyAlgo,
    const SshBinaryString *publicKeyBlob, const SshBinaryString *sessionId,
@@ -36,6 +36,7 @@
 #include "ssh/ssh_transport.h"
 #include "ssh/ssh_packet.h"
 #include "ssh/ssh_misc.h"
+#include "ssh/ssh_profiler.h"
 #include "debug.h"
 
 //Check SSH stack configuration
@@ -530,6 +531,9 @@ error_list sshParseIdString(SshConnection *connection, const uint8_t *id,
       connection->state = SSH_CONN_STATE_SERVER_KEX_INIT;
    }
 
+   //The version exchange is complete
+   sshSetConnectionPhase(connection, SSH_CONN_PHASE_KEY_EXCHANGE);
+
    //Successful processing
    return NO_ERROR;
 }
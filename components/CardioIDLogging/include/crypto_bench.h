@@ -0,0 +1 @@
+void CRYPTO_BENCH_RUN(void);
@@ -47,6 +47,8 @@
 #define MPI_SUPPORT ENABLED
 //Assembly optimizations for time-critical routines
 #define MPI_ASM_SUPPORT DISABLED
+//Scratch arena for the temporaries of public-key operations
+#define MPI_ARENA_SUPPORT ENABLED
 
 //Base64 encoding support
 #define BASE64_SUPPORT ENABLED
@@ -257,6 +259,14 @@
 //Ed448 elliptic curve support
 #define ED448_SUPPORT DISABLED
 
+//Base point comb tables, in flash (teeth: 0 to disable, 4, 6 or 8). A table
+//holds 2^teeth - 1 points: 4 KB for P-256, 6 KB for P-384 and Ed25519 with
+//6 teeth. 8 teeth take four times as much and are not faster, since every
+//entry is read at each step
+#define SECP256R1_COMB_WIDTH 6
+#define SECP384R1_COMB_WIDTH 6
+#define ED25519_COMB_WIDTH 6
+
 //HKDF support
 #define HKDF_SUPPORT DISABLED
 //PBKDF support
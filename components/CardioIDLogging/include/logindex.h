@@ -0,0 +1,30 @@
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// Size of the file name field of an index entry (including the terminating NUL)
+#define LOG_INDEX_NAME_SIZE 48
+
+// State of a log file in the pending-upload index
+#define LOG_INDEX_STATE_OPEN 1     // File being written
+#define LOG_INDEX_STATE_SEALED 2   // File closed, waiting to be uploaded
+#define LOG_INDEX_STATE_UPLOADED 3 // File stored on the server and deleted locally
+
+// Most severe level of a file that was indexed by a directory scan
+#define LOG_INDEX_LEVEL_UNKNOWN 0xFF
+
+// Log file tracked by the pending-upload index
+typedef struct
+{
+    char name[LOG_INDEX_NAME_SIZE]; // File name, relative to LOG_FILE_DIR
+    uint32_t size;                  // File size (bytes)
+    uint32_t firstTime;             // Time of the first log event (seconds since the epoch)
+    uint32_t lastTime;              // Time of the last log event (seconds since the epoch)
+    uint8_t maxLevel;               // Most severe level logged (0 = error ... 4 = verbose)
+    uint8_t state;                  // LOG_INDEX_STATE_xxx
+} LogIndexEntry;
+
+esp_err_t LOG_INDEX_APPEND(const LogIndexEntry *entry);
+esp_err_t LOG_INDEX_SET_STATE(const char *name, uint8_t state);
+esp_err_t LOG_INDEX_LOAD(LogIndexEntry **entries, size_t *count);
+esp_err_t LOG_INDEX_COMPACT(void);
@@ -1,2 +1,25 @@
+#include <stdint.h>
+#include "error.h"
+
+// Connection cost counters of the SFTP session
+typedef struct
+{
+    uint32_t connectAttempts;   // Number of connection attempts
+    uint32_t connectFailures;   // Number of failed connection attempts
+    uint32_t dnsLookups;        // Number of server name resolutions
+    uint32_t handshakes;        // Number of completed key exchanges and authentications
+    uint32_t reuses;            // Number of times an already open session was reused
+    uint32_t keepAliveProbes;   // Number of liveness probes sent to the server
+    uint32_t keepAliveFailures; // Number of probes that found the session dead
+    uint32_t lastConnectTime;   // Duration of the last successful connection (ms)
+    uint32_t totalConnectTime;  // Time spent connecting since boot (ms)
+    uint32_t pooledHandshakes;  // Number of handshakes that used a precomputed ephemeral key pair
+    uint32_t pooledConnectTime; // Time spent in those handshakes (ms)
+} SftpSessionStats;
+
 void SSH_INIT();
-void WIFI_INIT();
\ No newline at end of file
+void WIFI_INIT();
+
+error_list SFTP_SESSION_OPEN(void);
+void SFTP_SESSION_CLOSE(void);
+void SFTP_SESSION_GET_STATS(SftpSessionStats *stats);
@@ -68,6 +68,8 @@
 #define SSH_CBC_CIPHER_SUPPORT DISABLED
 //CTR cipher mode support
 #define SSH_CTR_CIPHER_SUPPORT ENABLED
+//Single-pass CTR encryption and HMAC computation
+#define SSH_FUSED_CTR_HMAC_SUPPORT ENABLED
 //GCM AEAD support
 #define SSH_GCM_CIPHER_SUPPORT ENABLED
 //ChaCha20Poly1305 AEAD support
@@ -179,7 +181,48 @@
 //Maximum acceptable size for DSA prime modulus
 #define SSH_MAX_DSA_MODULUS_SIZE 2048
 
+//Maximum packet size
+#define SSH_MAX_PACKET_SIZE 8192
+//Size of channel TX/RX buffers
+#define SSH_CHANNEL_BUFFER_SIZE 8192
+//Initial window size of a channel (may be changed at runtime)
+#define SSH_DEFAULT_CHANNEL_WINDOW_SIZE 2048
+//Channel window auto-tuning
+#define SSH_WINDOW_AUTO_TUNING_SUPPORT ENABLED
+//Automatic key re-exchange
+#define SSH_REKEY_SUPPORT ENABLED
+//Coalescing of small channel writes into full-size packets
+#define SSH_CHANNEL_COALESCING_SUPPORT ENABLED
+
+//Pool of precomputed ephemeral key pairs
+#define SSH_KEY_POOL_SUPPORT ENABLED
+//Number of key pairs held by the pool
+#define SSH_KEY_POOL_SIZE 2
+
+//Cache of precomputed host key contexts
+#define SSH_KEY_CACHE_SUPPORT ENABLED
+//Number of host key moduli held by the cache
+#define SSH_KEY_CACHE_SIZE 2
+
+//Connection setup profiling
+#define SSH_PROFILER_SUPPORT ENABLED
+
+//Maximum number of simultaneous SSH connections (the SFTP sessions share one)
+#define SSH_MAX_CONNECTIONS 1
+//Allocate connection and channel buffers only while they are in use
+#define SSH_DYNAMIC_BUFFER_SUPPORT ENABLED
+//Size of the scratch arena used by key exchange computations (covers a
+//software DH-2048 exchange with RSA-2048 host key verification)
+#define SSH_MPI_ARENA_SIZE 8192
+
+//zlib@openssh.com compression support
+#define SSH_ZLIB_SUPPORT ENABLED
+//Size of the compressor history window
+#define SSH_ZLIB_WINDOW_SIZE 4096
+
 //SFTP client support
 #define SFTP_CLIENT_SUPPORT ENABLED
+//Multiple SFTP sessions over a single SSH connection
+#define SFTP_CLIENT_CHANNEL_SHARING_SUPPORT ENABLED
 
 #endif
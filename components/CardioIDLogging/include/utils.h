@@ -49,6 +49,58 @@
 #define APP_SFTP_TEMP_FILENAME "/home/ganilha/kibana/temp-"
 #define APP_SFTP_FILENAME "/home/ganilha/kibana/"
 #define LOG_FILE_DIR "/sdcard"
+// Append-only index of the log files waiting to be uploaded
+#define APP_LOG_INDEX_FILE LOG_FILE_DIR "/pending.idx"
+#define APP_LOG_INDEX_TEMP_FILE LOG_FILE_DIR "/pending.tmp"
+// Size of the chunks read from the log files and handed to the SFTP client
+#define APP_SFTP_WRITE_BUFFER_SIZE 4096
+// Number of SFTP sessions uploading log files in parallel over the SSH connection
+#define APP_SFTP_UPLOAD_CHANNELS 3
+// Log data read from the SD card and not yet acknowledged by the server, shared by all sessions (bytes)
+#define APP_SFTP_UPLOAD_BYTE_BUDGET (2 * APP_SFTP_WRITE_BUFFER_SIZE)
+// Stack size of the upload tasks (words)
+#define APP_SFTP_UPLOAD_TASK_STACK_SIZE 3072
+// Maximum number of log files packed in a single remote bundle (1 disables bundles)
+#define APP_SFTP_BUNDLE_MAX_SEGMENTS 16
+// Remote bundles are named <APP_SFTP_FILENAME>bundle-<DEVICE_ID>-<first log file>.cidb
+#define APP_SFTP_BUNDLE_PREFIX "bundle-"
+#define APP_SFTP_BUNDLE_SUFFIX ".cidb"
+// Suffix of the bundles being written, so that the server never picks up a partial bundle
+#define APP_SFTP_BUNDLE_TEMP_SUFFIX APP_SFTP_BUNDLE_SUFFIX ".part"
+// Maximum size of the SSH packets carrying channel data (bytes, at most SSH_MAX_PACKET_SIZE)
+#define APP_SSH_MAX_PACKET_SIZE 8192
+// Initial flow-control window of each SSH channel (bytes, at most SSH_CHANNEL_BUFFER_SIZE)
+#define APP_SSH_CHANNEL_WINDOW_SIZE 2048
+// Upper bound on the sum of the channel windows of the SSH connection when auto-tuning (bytes)
+#define APP_SSH_WINDOW_MEMORY_CAP (APP_SFTP_UPLOAD_CHANNELS * 8192)
+// The SSH keys are renewed on the open connection after this many bytes, packets or ms (0 disables a limit)
+#define APP_SSH_REKEY_BYTES (256UL * 1024 * 1024)
+#define APP_SSH_REKEY_PACKETS 0
+#define APP_SSH_REKEY_INTERVAL (60UL * 60 * 1000)
+// Small SFTP channel writes are held until this many bytes or ms have accumulated (bytes, at most SSH_CHANNEL_BUFFER_SIZE)
+#define APP_SSH_COALESCING_THRESHOLD APP_SSH_MAX_PACKET_SIZE
+#define APP_SSH_COALESCING_DELAY 10
+// Number of slots of the trusted host key table (keep it at least twice the number of trusted keys)
+#define APP_SSH_HOST_KEY_STORE_SIZE 16
+// Key exchange algorithm for which ephemeral key pairs are precomputed (the pool follows the negotiated one)
+#define APP_SSH_KEY_POOL_KEX_ALGO "curve25519-sha256"
+// Stack size of the task filling the key pool (words)
+#define APP_SSH_KEY_POOL_TASK_STACK_SIZE 3072
+// The key pool is filled below the priority of the other tasks, while the device is idle
+#define APP_SSH_KEY_POOL_TASK_PRIORITY (OS_TASK_PRIORITY_NORMAL - 1)
+// Log the time spent in each setup phase for every SSH connection (TRUE/FALSE)
+#define APP_SSH_PROFILER_LOG TRUE
+// Measure the crypto algorithms enabled in crypto_config.h before the first upload (ENABLED/DISABLED)
+#define APP_CRYPTO_BENCH DISABLED
+// Print the benchmark results as JSON lines instead of CSV (ENABLED/DISABLED)
+#define APP_CRYPTO_BENCH_JSON DISABLED
+// Minimum time spent measuring each algorithm and message size (ms)
+#define APP_CRYPTO_BENCH_MIN_TIME 250
+// Idle time after which an open SFTP session is probed before being reused (ms)
+#define APP_SFTP_KEEPALIVE_INTERVAL 30000
+// Bounds of the exponential backoff applied between connection attempts (ms)
+#define APP_SFTP_RECONNECT_MIN_DELAY 1000
+#define APP_SFTP_RECONNECT_MAX_DELAY 60000
 
 #define DEVICE_ID "1"
 
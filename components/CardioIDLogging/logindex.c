@@ -0,0 +1,430 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+
+#include "logindex.h"
+#include "utils.h"
+
+/*
+ * The index is an append-only file of fixed-size records. A log file is
+ * described by the last record carrying its name: the writer appends an OPEN
+ * record when it creates the file and a SEALED record when it closes it, the
+ * uploader appends an UPLOADED record once the file is stored on the server.
+ * Replaying the records gives the list of files waiting to be uploaded without
+ * scanning LOG_FILE_DIR. A record cut short by a reset is ignored, any other
+ * damage causes the index to be rebuilt from a directory scan.
+ */
+
+#define LOG_INDEX_MAGIC 0x58444943 // "CIDX"
+
+// On-disk record
+typedef struct __attribute__((packed))
+{
+    uint32_t magic;
+    uint8_t state;
+    uint8_t maxLevel;
+    uint16_t reserved;
+    uint32_t size;
+    uint32_t firstTime;
+    uint32_t lastTime;
+    char name[LOG_INDEX_NAME_SIZE];
+    uint32_t crc; // CRC-32 of the preceding fields
+} LogIndexRecord;
+
+static const char *TAG = "LOGINDEX";
+
+/**
+ * @brief Write a record at the current position of the index file
+ *
+ * @note -
+ *
+ * @param file Index file
+ * @param entry Entry to be written
+ *
+ */
+static esp_err_t WRITE_RECORD(FILE *file, const LogIndexEntry *entry)
+{
+    LogIndexRecord record;
+
+    memset(&record, 0, sizeof(record));
+    record.magic = LOG_INDEX_MAGIC;
+    record.state = entry->state;
+    record.maxLevel = entry->maxLevel;
+    record.size = entry->size;
+    record.firstTime = entry->firstTime;
+    record.lastTime = entry->lastTime;
+    strncpy(record.name, entry->name, LOG_INDEX_NAME_SIZE - 1);
+    record.crc = esp_rom_crc32_le(0, (const uint8_t *)&record, offsetof(LogIndexRecord, crc));
+
+    if (fwrite(&record, sizeof(record), 1, file) != 1)
+    {
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Find an entry by name
+ *
+ * @note -
+ *
+ * @return Index of the entry, or count if not found
+ *
+ */
+static size_t FIND_ENTRY(const LogIndexEntry *entries, size_t count, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (strcmp(entries[i].name, name) == 0)
+            break;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Add or update an entry of a dynamically allocated list
+ *
+ * @note -
+ *
+ */
+static esp_err_t PUT_ENTRY(LogIndexEntry **entries, size_t *count, size_t *capacity, const LogIndexEntry *entry)
+{
+    size_t i = FIND_ENTRY(*entries, *count, entry->name);
+
+    if (i == *count)
+    {
+        // Grow the list if necessary
+        if (*count == *capacity)
+        {
+            size_t n = (*capacity == 0) ? 16 : (*capacity * 2);
+            LogIndexEntry *p = realloc(*entries, n * sizeof(LogIndexEntry));
+            if (p == NULL)
+                return ESP_ERR_NO_MEM;
+            *entries = p;
+            *capacity = n;
+        }
+        (*count)++;
+    }
+
+    (*entries)[i] = *entry;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Replay the index file
+ *
+ * @note The list holds the files that have not been uploaded, in index order
+ *
+ * @param entries List of entries, allocated with malloc
+ * @param count Number of entries
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if there is no index, ESP_ERR_INVALID_CRC if it is damaged
+ *
+ */
+static esp_err_t REPLAY(LogIndexEntry **entries, size_t *count)
+{
+    FILE *file;
+    LogIndexRecord record;
+    LogIndexEntry entry;
+    size_t capacity = 0;
+    size_t i;
+    esp_err_t ret = ESP_OK;
+
+    *entries = NULL;
+    *count = 0;
+
+    file = fopen(APP_LOG_INDEX_FILE, "rb");
+    if (file == NULL)
+        return ESP_ERR_NOT_FOUND;
+
+    // A trailing partial record is the result of an interrupted append
+    while (ret == ESP_OK && fread(&record, sizeof(record), 1, file) == 1)
+    {
+        if (record.magic != LOG_INDEX_MAGIC ||
+            record.crc != esp_rom_crc32_le(0, (const uint8_t *)&record, offsetof(LogIndexRecord, crc)) ||
+            record.name[LOG_INDEX_NAME_SIZE - 1] != '\0')
+        {
+            ret = ESP_ERR_INVALID_CRC;
+        }
+        else if (record.state == LOG_INDEX_STATE_UPLOADED)
+        {
+            // The file is no longer pending
+            i = FIND_ENTRY(*entries, *count, record.name);
+            if (i < *count)
+            {
+                (*count)--;
+                memmove(&(*entries)[i], &(*entries)[i + 1], (*count - i) * sizeof(LogIndexEntry));
+            }
+        }
+        else
+        {
+            memcpy(entry.name, record.name, LOG_INDEX_NAME_SIZE);
+            entry.size = record.size;
+            entry.firstTime = record.firstTime;
+            entry.lastTime = record.lastTime;
+            entry.maxLevel = record.maxLevel;
+            entry.state = record.state;
+            ret = PUT_ENTRY(entries, count, &capacity, &entry);
+        }
+    }
+
+    fclose(file);
+
+    if (ret != ESP_OK)
+    {
+        free(*entries);
+        *entries = NULL;
+        *count = 0;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Replace the index file with the given entries
+ *
+ * @note The new index is written to a temporary file first, so that a reset
+ * leaves either the old or the new index
+ *
+ */
+static esp_err_t REWRITE(const LogIndexEntry *entries, size_t count)
+{
+    FILE *file;
+    size_t i;
+    esp_err_t ret = ESP_OK;
+
+    file = fopen(APP_LOG_INDEX_TEMP_FILE, "wb");
+    if (file == NULL)
+        return ESP_FAIL;
+
+    for (i = 0; i < count && ret == ESP_OK; i++)
+    {
+        ret = WRITE_RECORD(file, &entries[i]);
+    }
+
+    fsync(fileno(file));
+    fclose(file);
+
+    // FAT cannot rename over an existing file
+    if (ret == ESP_OK)
+    {
+        remove(APP_LOG_INDEX_FILE);
+        if (rename(APP_LOG_INDEX_TEMP_FILE, APP_LOG_INDEX_FILE) != 0)
+            ret = ESP_FAIL;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Rebuild the index from a scan of the log directory
+ *
+ * @note Files found this way have no level information and are ordered by
+ * modification time
+ *
+ */
+static esp_err_t REBUILD(LogIndexEntry **entries, size_t *count)
+{
+    DIR *dir;
+    const struct dirent *ent;
+    struct stat st;
+    char path[300];
+    LogIndexEntry entry;
+    size_t capacity = 0;
+    esp_err_t ret = ESP_OK;
+
+    *entries = NULL;
+    *count = 0;
+
+    ESP_LOGW(TAG, "Rebuilding %s from a scan of %s", APP_LOG_INDEX_FILE, LOG_FILE_DIR);
+
+    dir = opendir(LOG_FILE_DIR);
+    if (dir == NULL)
+        return ESP_FAIL;
+
+    while (ret == ESP_OK && (ent = readdir(dir)) != NULL)
+    {
+        if (ent->d_type == DT_REG && ENDSWITH(ent->d_name, ".txt") &&
+            strlen(ent->d_name) < LOG_INDEX_NAME_SIZE)
+        {
+            snprintf(path, sizeof(path), "%s/%s", LOG_FILE_DIR, ent->d_name);
+            if (stat(path, &st) == 0)
+            {
+                memset(&entry, 0, sizeof(entry));
+                strcpy(entry.name, ent->d_name);
+                entry.size = st.st_size;
+                entry.firstTime = st.st_mtime;
+                entry.lastTime = st.st_mtime;
+                entry.maxLevel = LOG_INDEX_LEVEL_UNKNOWN;
+                entry.state = LOG_INDEX_STATE_SEALED;
+                ret = PUT_ENTRY(entries, count, &capacity, &entry);
+            }
+        }
+    }
+
+    closedir(dir);
+
+    if (ret == ESP_OK)
+    {
+        ret = REWRITE(*entries, *count);
+    }
+
+    if (ret != ESP_OK)
+    {
+        free(*entries);
+        *entries = NULL;
+        *count = 0;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Upload priority: most severe level first, then oldest first
+ *
+ * @note -
+ *
+ */
+static int COMPARE_ENTRIES(const void *a, const void *b)
+{
+    const LogIndexEntry *p = a;
+    const LogIndexEntry *q = b;
+
+    if (p->maxLevel != q->maxLevel)
+        return (p->maxLevel < q->maxLevel) ? -1 : 1;
+    if (p->firstTime != q->firstTime)
+        return (p->firstTime < q->firstTime) ? -1 : 1;
+
+    return strcmp(p->name, q->name);
+}
+
+/**
+ * @brief Append an entry to the pending-upload index
+ *
+ * @note Called by the writer when it creates and when it seals a log file
+ *
+ * @param entry Entry to be appended
+ *
+ */
+esp_err_t LOG_INDEX_APPEND(const LogIndexEntry *entry)
+{
+    FILE *file;
+    esp_err_t ret;
+
+    file = fopen(APP_LOG_INDEX_FILE, "ab");
+    if (file == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to open %s", APP_LOG_INDEX_FILE);
+        return ESP_FAIL;
+    }
+
+    ret = WRITE_RECORD(file, entry);
+
+    fsync(fileno(file));
+    fclose(file);
+
+    return ret;
+}
+
+/**
+ * @brief Record a new state for a log file
+ *
+ * @note -
+ *
+ * @param name Name of the log file
+ * @param state New state (LOG_INDEX_STATE_xxx)
+ *
+ */
+esp_err_t LOG_INDEX_SET_STATE(const char *name, uint8_t state)
+{
+    LogIndexEntry entry;
+
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.name, name, LOG_INDEX_NAME_SIZE - 1);
+    entry.state = state;
+
+    return LOG_INDEX_APPEND(&entry);
+}
+
+/**
+ * @brief Get the log files waiting to be uploaded, in upload order
+ *
+ * @note The index is rebuilt from a scan of LOG_FILE_DIR if it is missing or
+ * damaged. Must not be called while a log file is open for writing: files left
+ * OPEN by a reset are considered sealed. The list must be released with free()
+ *
+ * @param entries List of entries
+ * @param count Number of entries
+ *
+ */
+esp_err_t LOG_INDEX_LOAD(LogIndexEntry **entries, size_t *count)
+{
+    struct stat st;
+    char path[300];
+    size_t i;
+    esp_err_t ret;
+
+    ret = REPLAY(entries, count);
+
+    if (ret == ESP_ERR_NOT_FOUND || ret == ESP_ERR_INVALID_CRC)
+    {
+        ESP_LOGW(TAG, "Index %s", ret == ESP_ERR_NOT_FOUND ? "missing" : "damaged");
+        ret = REBUILD(entries, count);
+    }
+
+    if (ret != ESP_OK)
+        return ret;
+
+    for (i = 0; i < *count; i++)
+    {
+        // The writer was interrupted before sealing the file
+        if ((*entries)[i].state == LOG_INDEX_STATE_OPEN)
+        {
+            snprintf(path, sizeof(path), "%s/%s", LOG_FILE_DIR, (*entries)[i].name);
+            if (stat(path, &st) == 0)
+            {
+                (*entries)[i].size = st.st_size;
+                (*entries)[i].lastTime = st.st_mtime;
+            }
+            (*entries)[i].state = LOG_INDEX_STATE_SEALED;
+        }
+    }
+
+    qsort(*entries, *count, sizeof(LogIndexEntry), COMPARE_ENTRIES);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Drop the records of uploaded files from the index
+ *
+ * @note -
+ *
+ */
+esp_err_t LOG_INDEX_COMPACT(void)
+{
+    LogIndexEntry *entries;
+    size_t count;
+    esp_err_t ret;
+
+    ret = REPLAY(&entries, &count);
+
+    if (ret == ESP_OK)
+    {
+        ret = REWRITE(entries, count);
+        free(entries);
+    }
+
+    return ret;
+}
@@ -8,15 +8,23 @@
 #include "dhcp/dhcp_client.h"
 #include "ipv6/slaac.h"
 #include "sftp/sftp_client.h"
-#include "ssh/ssh_key_verify.h"
+#include "ssh/ssh_host_key_store.h"
+#include "ssh/ssh_key_pool.h"
+#include "ssh/ssh_key_cache.h"
+#include "ssh/ssh_profiler.h"
 #include "hardware/esp32/esp32_crypto.h"
 #include "rng/trng.h"
 #include "rng/yarrow.h"
 #include "debug.h"
-#include <dirent.h>
+#include "esp_rom_crc.h"
+#include "esp_system.h"
+#include <sys/stat.h>
 
 #include "sntp.h"
 #include "utils.h"
+#include "ssh.h"
+#include "logindex.h"
+#include "crypto_bench.h"
 
 // List of trusted host keys
 const char_t *trustedHostKeys[] =
@@ -43,6 +51,71 @@ NdpRouterAdvContext ndpRouterAdvContext;
 SftpClientContext sftpClientContext;
 YarrowContext yarrowContext;
 uint8_t seed[32];
+// SSH channels multiplexed over the connection, one per upload session
+static SshChannel sftpChannels[APP_SFTP_UPLOAD_CHANNELS];
+// Additional SFTP sessions opened over the connection of sftpClientContext
+static SftpClientContext sftpChannelContexts[APP_SFTP_UPLOAD_CHANNELS - 1];
+// Fingerprints of the trusted host keys, decoded once
+static SshHostKeyEntry hostKeyEntries[APP_SSH_HOST_KEY_STORE_SIZE];
+static SshHostKeyStore hostKeyStore;
+// Ephemeral key pairs precomputed for the next key exchanges
+static SshKeyPool sshKeyPool;
+static bool_t sshKeyPoolReady;
+// Montgomery constants of the RSA/DSA host keys, reused across connections
+static SshKeyCache sshKeyCache;
+static bool_t sshKeyCacheReady;
+// Time spent in each connection setup phase, across all connections
+static SshProfiler sshProfiler;
+static bool_t sshProfilerReady;
+
+// Log files are uploaded in large chunks, the SFTP client splits them
+// according to the request size negotiated with the server. The number of
+// chunks bounds the amount of data in flight across all sessions
+#define SFTP_WRITE_BUFFER_COUNT (APP_SFTP_UPLOAD_BYTE_BUDGET / APP_SFTP_WRITE_BUFFER_SIZE)
+#if (SFTP_WRITE_BUFFER_COUNT < 1)
+#error APP_SFTP_UPLOAD_BYTE_BUDGET must hold at least one write buffer
+#endif
+static char sftpWriteBuffers[SFTP_WRITE_BUFFER_COUNT][APP_SFTP_WRITE_BUFFER_SIZE];
+
+// Long-lived SFTP session, kept open across upload cycles
+typedef struct
+{
+    bool_t open;            // The SFTP client context holds a connection
+    bool_t ipAddrValid;     // The server name has already been resolved
+    IpAddr ipAddr;          // Address of the SFTP server
+    systime_t lastActivity; // Last time the session was known to be alive
+    systime_t nextAttempt;  // Earliest time for the next connection attempt
+    systime_t backoff;      // Current reconnection backoff (ms)
+    SftpSessionStats stats;
+} SftpSession;
+
+static SftpSession sftpSession;
+
+// Upload session, driven by its own task
+typedef struct
+{
+    SftpClientContext *context; // SFTP session used to upload files
+    error_list error;           // Status of the session
+    uint32_t files;             // Number of files uploaded
+    uint32_t bytes;             // Number of bytes uploaded
+    uint32_t bundles;           // Number of bundles uploaded
+    char names[APP_SFTP_BUNDLE_MAX_SEGMENTS][SFTP_CLIENT_MAX_FILENAME_LEN + 1]; // Files handed out to the session
+} SftpUploadWorker;
+
+// Work shared by the upload sessions
+typedef struct
+{
+    LogIndexEntry *entries;                     // Pending log files, in upload order
+    size_t numEntries;                          // Number of pending log files
+    size_t nextEntry;                           // Next log file to be handed out
+    OsMutex mutex;                              // Protects the pending list, the index and the buffer pool
+    OsSemaphore budget;                         // One token per free write buffer
+    OsSemaphore done;                           // Signaled when an upload task terminates
+    bool_t bufferInUse[SFTP_WRITE_BUFFER_COUNT]; // Write buffers currently owned by a session
+    SftpUploadWorker workers[APP_SFTP_UPLOAD_CHANNELS];
+} SftpUploadQueue;
+
+static SftpUploadQueue sftpUploadQueue;
 
 // Forward declaration of functions
 error_list wifiStaInterfaceInit(void);
@@ -95,23 +168,96 @@ void ioInit(void)
 error_list sftpClientHostKeyVerifyCallback(SshConnection *connection,
                                            const uint8_t *hostKey, size_t hostKeyLen)
 {
-    error_list error;
-    uint_t i;
-
     // Debug message
     TRACE_INFO("SFTP Client: Public key verification callback\r\n");
 
-    // Initialize status code
-    error = ERROR_INVALID_KEY;
+    // One hash of the host key and one probe of the fingerprint table
+    return sshVerifyHostKeyFromStore(&hostKeyStore, hostKey, hostKeyLen);
+}
+
+/**
+ * @brief Decode the trusted host keys into the fingerprint table
+ *
+ * @note The keys that cannot be decoded are skipped, the host key
+ * verification then fails for servers presenting them
+ *
+ * @return Error code
+ *
+ */
+static error_list hostKeyStoreLoad(void)
+{
+    error_list error;
+    uint_t i;
+
+    error = sshInitHostKeyStore(&hostKeyStore, hostKeyEntries, arraysize(hostKeyEntries));
+    // Any error to report?
+    if (error)
+        return error;
 
     // Loop through the list of known host keys
-    for (i = 0; i < arraysize(trustedHostKeys) && error; i++)
+    for (i = 0; i < arraysize(trustedHostKeys); i++)
     {
-        // Check whether the host key is trusted
-        error = sshVerifyHostKey(hostKey, hostKeyLen, trustedHostKeys[i],
-                                 strlen(trustedHostKeys[i]));
+        error = sshAddTrustedHostKey(&hostKeyStore, trustedHostKeys[i], strlen(trustedHostKeys[i]));
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Failed to load trusted host key %u (error %d)\r\n", i, error);
+        }
     }
 
+    // Debug message
+    TRACE_INFO("%u trusted host keys loaded\r\n", hostKeyStore.count);
+
+    // Successful processing
+    return NO_ERROR;
+}
+
+/**
+ * @brief SSH connection open callback
+ *
+ * @note Sets the packet and window sizes of the connection. The channel windows
+ * start at APP_SSH_CHANNEL_WINDOW_SIZE and grow with the bandwidth-delay
+ * product of the link, within APP_SSH_WINDOW_MEMORY_CAP
+ *
+ * @param[in] connection Pointer to the SSH connection
+ * @param[in] param Unused
+ *
+ * @return Error code
+ *
+ */
+error_list sftpClientConnectionOpenCallback(SshConnection *connection, void *param)
+{
+    error_list error;
+
+    // Set the maximum size of SSH_MSG_CHANNEL_DATA packets
+    error = sshSetConnectionMaxPacketSize(connection, APP_SSH_MAX_PACKET_SIZE);
+    // Any error to report?
+    if (error)
+        return error;
+
+    // Set the initial channel window and the memory cap of the connection
+    error = sshSetConnectionWindowSize(connection, APP_SSH_CHANNEL_WINDOW_SIZE,
+                                       APP_SSH_WINDOW_MEMORY_CAP);
+    // Any error to report?
+    if (error)
+        return error;
+
+    // Grow the windows from the measured RTT and delivery rate
+    error = sshEnableWindowAutoTuning(connection, TRUE);
+    // Auto-tuning is optional
+    if (error == ERROR_NOT_IMPLEMENTED)
+        error = NO_ERROR;
+    // Any error to report?
+    if (error)
+        return error;
+
+    // Renew the keys in place so that the session can stay open for days
+    error = sshSetConnectionRekeyLimits(connection, APP_SSH_REKEY_BYTES,
+                                        APP_SSH_REKEY_PACKETS, APP_SSH_REKEY_INTERVAL);
+    // Key re-exchange is optional
+    if (error == ERROR_NOT_IMPLEMENTED)
+        error = NO_ERROR;
+
     // Return status code
     return error;
 }
@@ -159,41 +305,134 @@ error_list sftpClientSshInitCallback(SftpClientContext *context,
     if (error)
         return error;
 
+    // Register connection open callback function
+    error = sshRegisterConnectionOpenCallback(sshContext,
+                                              sftpClientConnectionOpenCallback, NULL);
+
+    // Any error to report?
+    if (error)
+        return error;
+
+    // Take the ephemeral key pair of the key exchange from the pool
+    if (sshKeyPoolReady)
+    {
+        error = sshRegisterKeyPool(sshContext, &sshKeyPool);
+        // Any error to report?
+        if (error)
+            return error;
+    }
+
+    // Reuse the precomputed constants of the host key
+    if (sshKeyCacheReady)
+    {
+        error = sshRegisterKeyCache(sshContext, &sshKeyCache);
+        // Any error to report?
+        if (error)
+            return error;
+    }
+
+    // Record the duration of the connection setup phases
+    if (sshProfilerReady)
+    {
+        error = sshRegisterProfiler(sshContext, &sshProfiler);
+        // Any error to report?
+        if (error)
+            return error;
+    }
+
     // Successful processing
     return NO_ERROR;
 }
 
+////// SFTP SESSION //////
+
+/**
+ * @brief Tear down the current SFTP session and schedule the next connection attempt
+ *
+ * @note The delay before the next attempt grows exponentially up to
+ * APP_SFTP_RECONNECT_MAX_DELAY. Half of it is randomized so that several
+ * devices losing the server at the same time do not reconnect in lockstep
+ *
+ */
+static void sftpSessionAbort(void)
+{
+    systime_t delay;
+
+    // Close the network connection without further exchange with the server
+    if (sftpSession.open)
+    {
+        sftpClientClose(&sftpClientContext);
+        sftpClientDeinit(&sftpClientContext);
+        sftpSession.open = FALSE;
+    }
+
+    // Apply jitter to the current backoff value
+    delay = sftpSession.backoff / 2;
+    delay += netGetRandRange(0, sftpSession.backoff - delay);
+    sftpSession.nextAttempt = osGetSystemTime() + delay;
+
+    // Double the backoff for the next failure
+    sftpSession.backoff = MIN(sftpSession.backoff * 2, APP_SFTP_RECONNECT_MAX_DELAY);
+
+    // Debug message
+    TRACE_INFO("SFTP session closed, next attempt in %" PRIu32 " ms\r\n", (uint32_t)delay);
+}
+
 /**
- * @brief SFTP client test routine
+ * @brief Establish a new SFTP session
  *
  * @note -
  *
  * @return Error code
  *
  */
-error_list sftpClientTest(void)
+static error_list sftpSessionConnect(void)
 {
     error_list error;
-    IpAddr ipAddr;
+    systime_t start;
+    uint32_t poolHits;
+
+    start = osGetSystemTime();
+    sftpSession.stats.connectAttempts++;
+    poolHits = sshKeyPool.hits;
 
     // Initialize SFTP client context
     sftpClientInit(&sftpClientContext);
+    sftpSession.open = TRUE;
+
+    // Reserve one SSH channel per upload session
+    sftpClientSetChannels(&sftpClientContext, sftpChannels, APP_SFTP_UPLOAD_CHANNELS);
 
     // Start of exception handling block
     do
     {
-        // Debug message
-        TRACE_INFO("\r\n\r\nResolving server name...\r\n");
-
-        // Resolve SFTP server name
-        error = getHostByName(NULL, APP_SFTP_SERVER_NAME, &ipAddr, 0);
-        // Any error to report?
-        if (error)
+        // The server name is resolved once per network session
+        if (!sftpSession.ipAddrValid)
         {
             // Debug message
-            TRACE_INFO("Failed to resolve server name!\r\n");
-            break;
+            TRACE_INFO("\r\n\r\nResolving server name...\r\n");
+
+            // Resolve SFTP server name
+            sftpSession.stats.dnsLookups++;
+            error = getHostByName(NULL, APP_SFTP_SERVER_NAME, &sftpSession.ipAddr, 0);
+            // Any error to report?
+            if (error)
+            {
+                // Debug message
+                TRACE_INFO("Failed to resolve server name!\r\n");
+                break;
+            }
+
+            // The name resolution happens before the SSH connection is opened
+            if (sshProfilerReady)
+            {
+                sshAddProfilerSample(&sshProfiler, SSH_CONN_PHASE_DNS_LOOKUP,
+                                     osGetSystemTime() - start);
+            }
+
+            sftpSession.ipAddrValid = TRUE;
         }
+
         // Register SSH initialization callback
         TRACE_INFO("Register SSH initialization callback \r\n");
         error = sftpClientRegisterSshInitCallback(&sftpClientContext,
@@ -208,12 +447,19 @@ error_list sftpClientTest(void)
         if (error)
             break;
 
+        // Merge small writes into full-size SSH packets
+        error = sftpClientSetWriteCoalescing(&sftpClientContext, APP_SSH_COALESCING_THRESHOLD,
+                                             APP_SSH_COALESCING_DELAY);
+        // Any error to report?
+        if (error)
+            break;
+
         // Debug message
         TRACE_INFO("Connecting to SFTP server %s...\r\n",
-                   ipAddrToString(&ipAddr, NULL));
+                   ipAddrToString(&sftpSession.ipAddr, NULL));
 
         // Connect to the SFTP server
-        error = sftpClientConnect(&sftpClientContext, &ipAddr,
+        error = sftpClientConnect(&sftpClientContext, &sftpSession.ipAddr,
                                   APP_SFTP_SERVER_PORT);
         // Any error to report?
         if (error)
@@ -223,192 +469,1139 @@ error_list sftpClientTest(void)
             break;
         }
 
-        TRACE_INFO("Opening log directory\r\n");
+        // End of exception handling block
+    } while (0);
+
+    if (error)
+    {
+        sftpSession.stats.connectFailures++;
+        // The server may have moved, resolve its name again on the next attempt
+        sftpSession.ipAddrValid = FALSE;
+        sftpSessionAbort();
+    }
+    else
+    {
+        // Update connection cost counters
+        sftpSession.stats.handshakes++;
+        sftpSession.stats.lastConnectTime = osGetSystemTime() - start;
+        sftpSession.stats.totalConnectTime += sftpSession.stats.lastConnectTime;
+
+        // Time to first byte with and without a precomputed ephemeral key pair
+        if (sshKeyPool.hits != poolHits)
+        {
+            sftpSession.stats.pooledHandshakes++;
+            sftpSession.stats.pooledConnectTime += sftpSession.stats.lastConnectTime;
+        }
+
+        // The server is reachable again
+        sftpSession.backoff = APP_SFTP_RECONNECT_MIN_DELAY;
+        sftpSession.lastActivity = osGetSystemTime();
+
+        TRACE_INFO("SFTP session established in %" PRIu32 " ms (ephemeral key %s)\r\n",
+                   sftpSession.stats.lastConnectTime,
+                   (sshKeyPool.hits != poolHits) ? "precomputed" : "generated inline");
+    }
+
+    // Return status code
+    return error;
+}
+
+/**
+ * @brief Get an authenticated SFTP session, reusing the current one when it is still alive
+ *
+ * @note The session is probed with a keepalive request only when it has been
+ * idle for more than APP_SFTP_KEEPALIVE_INTERVAL. When no session is open, the
+ * call blocks until the backoff delay of the previous failure has elapsed
+ *
+ * @return Error code
+ *
+ */
+error_list SFTP_SESSION_OPEN(void)
+{
+    error_list error;
+    systime_t time;
+
+    // First use of the session manager?
+    if (sftpSession.backoff == 0)
+    {
+        sftpSession.backoff = APP_SFTP_RECONNECT_MIN_DELAY;
+    }
 
-        DIR *dir;
-        const struct dirent *ent;
+    if (sftpSession.open)
+    {
+        time = osGetSystemTime();
 
-        // Open the directory
-        if ((dir = opendir(LOG_FILE_DIR)) != NULL)
+        // The session must be idle and its SSH connection still open
+        if (sftpClientContext.state != SFTP_CLIENT_STATE_CONNECTED ||
+            !sshIsConnectionEstablished(&sftpClientContext.sshConnection))
+        {
+            sftpSessionAbort();
+        }
+        else if (timeCompare(time, sftpSession.lastActivity + APP_SFTP_KEEPALIVE_INTERVAL) >= 0)
         {
-            TRACE_INFO("Loopping through each file\r\n");
-            while ((ent = readdir(dir)) != NULL)
+            // Check whether the server is still there
+            sftpSession.stats.keepAliveProbes++;
+            error = sftpClientKeepAlive(&sftpClientContext);
+
+            if (error)
             {
-                if (ent->d_type == DT_REG && ENDSWITH(ent->d_name, ".txt"))
-                {
-                    char temp_filename[100];
-                    // Initialize string
-                    strcpy(temp_filename, "");
-                    strcat(temp_filename, APP_SFTP_TEMP_FILENAME);
-                    strcat(temp_filename, "cardioid");
-                    strcat(temp_filename, ent->d_name);
-                    TRACE_INFO("Creating File with %s - %s...\r\n", temp_filename,
-                               ipAddrToString(&ipAddr, NULL));
-                    error = sftpClientOpenFile(&sftpClientContext, temp_filename,
-                                               SSH_FXF_CREAT);
-                    // Any error to report?
-                    if (error)
-                    {
-                        TRACE_INFO("Error while opening File %s...\r\n",
-                                   ipAddrToString(&ipAddr, NULL));
-                        break;
-                    }
-
-                    // Close file
-                    error = sftpClientCloseFile(&sftpClientContext);
-                    // Any error to report?
-                    if (error)
-                    {
-                        TRACE_INFO("Error while closing File %s...\r\n",
-                                   ipAddrToString(&ipAddr, NULL));
-                        break;
-                    }
-
-                    // sleep(1000);
-
-                    TRACE_INFO("Opening File %s - %s...\r\n", temp_filename,
-                               ipAddrToString(&ipAddr, NULL));
-
-                    error = sftpClientOpenFile(&sftpClientContext, temp_filename,
-                                               SSH_FXF_WRITE);
-                    // Any error to report?
-                    if (error)
-                    {
-                        TRACE_INFO("Error while opening File %s...\r\n",
-                                   ipAddrToString(&ipAddr, NULL));
-                        break;
-                    }
-
-                    // Write to file
-                    FILE *file;
-                    size_t write_n;
-                    char write_buffer[1024];
-
-                    char logfilepath[1024];
-                    snprintf(logfilepath, sizeof(logfilepath), "%s/%s", LOG_FILE_DIR, ent->d_name);
-                    file = fopen(logfilepath, "rb");
-                    if (file == NULL)
-                    {
-                        TRACE_INFO("Error opening the local file %s \n", logfilepath);
-                        break;
-                    }
-
-                    // Read the file line by line
-                    while (fgets(write_buffer, sizeof(write_buffer), file))
-                    {
-                        error = sftpClientWriteFile(&sftpClientContext, &write_buffer, strlen(write_buffer), &write_n, 0);
-                        // Any error to report?
-                        if (error)
-                        {
-                            TRACE_INFO("Error while writing to File %s...\r\n",
-                                       ipAddrToString(&ipAddr, NULL));
-                            break;
-                        }
-                    }
-                    // Close the file
-                    fclose(file);
-
-                    // Terminate the string with a line feed
-                    TRACE_INFO("\r\n");
-
-                    // Close file
-                    error = sftpClientCloseFile(&sftpClientContext);
-                    // Any error to report?
-                    if (error)
-                    {
-                        TRACE_INFO("Error while closing File %s...\r\n",
-                                   ipAddrToString(&ipAddr, NULL));
-                        break;
-                    }
-
-                    // Open the specified file for reading
-                    char filename[100];
-                    // Initialize string
-                    strcpy(filename, "");
-                    strcat(filename, APP_SFTP_FILENAME);
-                    strcat(filename, "cardioid");
-                    strcat(filename, ent->d_name);
-
-                    TRACE_INFO("Renaming File %s to %s...\r\n", temp_filename, filename,
-                               ipAddrToString(&ipAddr, NULL));
-                    error = sftpClientRenameFile(&sftpClientContext, temp_filename, filename);
-                    if (error)
-                    {
-                        TRACE_INFO("Error renaming File %s...\r\n",
-                                   ipAddrToString(&ipAddr, NULL));
-                        break;
-                    }
-
-                    // Attempt to delete the file
-                    strcpy(filename, "");
-                    strcat(filename, LOG_FILE_DIR);
-                    strcat(filename, "/");
-                    strcat(filename, ent->d_name);
-                    if (remove(filename) == 0)
-                    {
-                        TRACE_INFO("Log file deleted %s \n", filename);
-                    }
-                    else
-                    {
-                        TRACE_INFO("Failed to delete file %s \n", filename);
-                    }
-                }
+                // Debug message
+                TRACE_INFO("SFTP keepalive failed (error %d)\r\n", error);
+                sftpSession.stats.keepAliveFailures++;
+                sftpSessionAbort();
+
+                // The server has just been seen, do not wait before reconnecting
+                sftpSession.nextAttempt = osGetSystemTime();
             }
         }
-        closedir(dir);
+    }
+
+    if (sftpSession.open)
+    {
+        // Reuse the current session
+        sftpSession.stats.reuses++;
+        sftpSession.lastActivity = osGetSystemTime();
+        return NO_ERROR;
+    }
+
+    // Wait for the end of the backoff period
+    time = osGetSystemTime();
+    if (timeCompare(sftpSession.nextAttempt, time) > 0)
+    {
+        osDelayTask(sftpSession.nextAttempt - time);
+    }
 
+    // Establish a new session
+    return sftpSessionConnect();
+}
+
+/**
+ * @brief Gracefully close the SFTP session
+ *
+ * @note Must be called before the network interfaces are stopped. The cached
+ * server address is discarded along with the session
+ *
+ */
+void SFTP_SESSION_CLOSE(void)
+{
+    if (sftpSession.open)
+    {
         // Gracefully disconnect from the SFTP server
         sftpClientDisconnect(&sftpClientContext);
+        // Release SFTP client context
+        sftpClientDeinit(&sftpClientContext);
+        sftpSession.open = FALSE;
 
         // Debug message
         TRACE_INFO("Connection closed\r\n");
+    }
 
-        // End of exception handling block
-    } while (0);
-
-    // Release SFTP client context
-    sftpClientDeinit(&sftpClientContext);
-
-    // Return status code
-    return error;
+    sftpSession.ipAddrValid = FALSE;
+    sftpSession.backoff = APP_SFTP_RECONNECT_MIN_DELAY;
+    sftpSession.nextAttempt = osGetSystemTime();
 }
 
 /**
- * @brief SSH INIT
+ * @brief Retrieve the connection cost counters of the SFTP session
  *
  * @note -
  *
+ * @param stats Structure receiving the counters
+ *
  */
-void SSH_INIT()
+void SFTP_SESSION_GET_STATS(SftpSessionStats *stats)
 {
-    /*
-    OsTaskId taskId;
-    // Create user task
-    taskId = osCreateTask("User", userTask, NULL, 750, OS_TASK_PRIORITY_NORMAL);
-    // Failed to create the task?
-    if (taskId == OS_INVALID_TASK_ID)
-    {
-        // Debug message
-        TRACE_ERROR("Failed to create task!\r\n");
-    }
-    */
+    *stats = sftpSession.stats;
+}
 
-    osDelayTask(5000);
-    while (1)
+/**
+ * @brief Get the next log file to be uploaded
+ *
+ * @note Files are handed out in index order (most severe level first, then
+ * oldest first) to whichever session asks first, so that a session stuck on a
+ * large file does not hold back the others
+ *
+ * @param name Buffer receiving the file name
+ * @param size Size of the buffer
+ *
+ * @return TRUE if a file was found, FALSE when the list is exhausted
+ *
+ */
+static bool_t sftpUploadNextFile(char *name, size_t size)
+{
+    const LogIndexEntry *entry;
+    struct stat st;
+    char logfilepath[300];
+    bool_t found = FALSE;
+
+    osAcquireMutex(&sftpUploadQueue.mutex);
+
+    while (!found && sftpUploadQueue.nextEntry < sftpUploadQueue.numEntries)
     {
-        // SFTP client test routine
-        error_list error = sftpClientTest();
+        entry = &sftpUploadQueue.entries[sftpUploadQueue.nextEntry++];
+        snprintf(logfilepath, sizeof(logfilepath), "%s/%s", LOG_FILE_DIR, entry->name);
 
-        if (error)
+        if (stat(logfilepath, &st) == 0)
         {
-            osDelayTask(1000);
+            snprintf(name, size, "%s", entry->name);
+            found = TRUE;
         }
         else
         {
-            break;
+            // The file was removed behind the back of the index
+            LOG_INDEX_SET_STATE(entry->name, LOG_INDEX_STATE_UPLOADED);
         }
     }
 
+    osReleaseMutex(&sftpUploadQueue.mutex);
+
+    return found;
+}
+
+/**
+ * @brief Delete an uploaded log file from the SD card
+ *
+ * @note The file is marked as uploaded in the pending-upload index
+ *
+ * @param name Name of the log file
+ *
+ */
+static void sftpUploadReleaseFile(const char *name)
+{
+    char logfilepath[300];
+
+    snprintf(logfilepath, sizeof(logfilepath), "%s/%s", LOG_FILE_DIR, name);
+
+    // Attempt to delete the file
+    if (remove(logfilepath) == 0)
+    {
+        TRACE_INFO("Log file deleted %s \n", logfilepath);
+    }
+    else
+    {
+        TRACE_INFO("Failed to delete file %s \n", logfilepath);
+    }
+
+    // Records are appended to the index by one session at a time
+    osAcquireMutex(&sftpUploadQueue.mutex);
+    LOG_INDEX_SET_STATE(name, LOG_INDEX_STATE_UPLOADED);
+    osReleaseMutex(&sftpUploadQueue.mutex);
+}
+
+/**
+ * @brief Take a write buffer from the shared pool
+ *
+ * @note Blocks until another session returns a buffer. Waiting sessions are
+ * served in turn, which shares the byte budget fairly between them
+ *
+ * @return Index of the buffer
+ *
+ */
+static uint_t sftpUploadTakeBuffer(void)
+{
+    uint_t i;
+
+    osWaitForSemaphore(&sftpUploadQueue.budget, INFINITE_DELAY);
+    osAcquireMutex(&sftpUploadQueue.mutex);
+
+    // The semaphore guarantees that a buffer is free
+    for (i = 0; i < SFTP_WRITE_BUFFER_COUNT - 1 && sftpUploadQueue.bufferInUse[i]; i++)
+    {
+    }
+    sftpUploadQueue.bufferInUse[i] = TRUE;
+
+    osReleaseMutex(&sftpUploadQueue.mutex);
+
+    return i;
+}
+
+/**
+ * @brief Return a write buffer to the shared pool
+ *
+ * @note -
+ *
+ * @param i Index of the buffer
+ *
+ */
+static void sftpUploadGiveBuffer(uint_t i)
+{
+    osAcquireMutex(&sftpUploadQueue.mutex);
+    sftpUploadQueue.bufferInUse[i] = FALSE;
+    osReleaseMutex(&sftpUploadQueue.mutex);
+
+    osReleaseSemaphore(&sftpUploadQueue.budget);
+}
+
+/**
+ * @brief Upload a single log file and delete it from the SD card
+ *
+ * @note The file is written under a temporary name and renamed once complete
+ *
+ * @param worker Upload session
+ * @param name Name of the log file
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpUploadFile(SftpUploadWorker *worker, const char *name)
+{
+    error_list error;
+    SftpClientContext *context = worker->context;
+    FILE *file;
+    size_t read_n;
+    size_t write_n;
+    uint_t i;
+    char temp_filename[100];
+    char filename[100];
+    char logfilepath[1024];
+
+    snprintf(temp_filename, sizeof(temp_filename), "%scardioid%s", APP_SFTP_TEMP_FILENAME, name);
+    snprintf(filename, sizeof(filename), "%scardioid%s", APP_SFTP_FILENAME, name);
+    snprintf(logfilepath, sizeof(logfilepath), "%s/%s", LOG_FILE_DIR, name);
+
+    TRACE_INFO("Creating File with %s...\r\n", temp_filename);
+    error = sftpClientOpenFile(context, temp_filename, SSH_FXF_CREAT);
+    // Any error to report?
+    if (error)
+    {
+        TRACE_INFO("Error while opening File %s...\r\n", temp_filename);
+        return error;
+    }
+
+    // Close file
+    error = sftpClientCloseFile(context);
+    // Any error to report?
+    if (error)
+    {
+        TRACE_INFO("Error while closing File %s...\r\n", temp_filename);
+        return error;
+    }
+
+    TRACE_INFO("Opening File %s...\r\n", temp_filename);
+    error = sftpClientOpenFile(context, temp_filename, SSH_FXF_WRITE);
+    // Any error to report?
+    if (error)
+    {
+        TRACE_INFO("Error while opening File %s...\r\n", temp_filename);
+        return error;
+    }
+
+    file = fopen(logfilepath, "rb");
+    if (file == NULL)
+    {
+        TRACE_INFO("Error opening the local file %s \n", logfilepath);
+        sftpClientCloseFile(context);
+        return ERROR_FILE_NOT_FOUND;
+    }
+
+    // Read the file chunk by chunk, each chunk is charged to the shared budget
+    do
+    {
+        i = sftpUploadTakeBuffer();
+
+        read_n = fread(sftpWriteBuffers[i], 1, APP_SFTP_WRITE_BUFFER_SIZE, file);
+        if (read_n > 0)
+        {
+            error = sftpClientWriteFile(context, sftpWriteBuffers[i], read_n, &write_n, 0);
+            worker->bytes += read_n;
+        }
+
+        sftpUploadGiveBuffer(i);
+
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Error while writing to File %s...\r\n", temp_filename);
+        }
+    } while (!error && read_n > 0);
+
+    // Close the file
+    fclose(file);
+
+    // Close file
+    if (!error)
+    {
+        error = sftpClientCloseFile(context);
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Error while closing File %s...\r\n", temp_filename);
+        }
+    }
+    else
+    {
+        sftpClientCloseFile(context);
+    }
+
+    if (!error)
+    {
+        TRACE_INFO("Renaming File %s to %s...\r\n", temp_filename, filename);
+        error = sftpClientRenameFile(context, temp_filename, filename);
+        if (error)
+        {
+            TRACE_INFO("Error renaming File %s...\r\n", temp_filename);
+        }
+    }
+
+    if (!error)
+    {
+        worker->files++;
+        sftpUploadReleaseFile(name);
+    }
+
+    return error;
+}
+
+////// UPLOAD BUNDLES //////
+
+/*
+ * A bundle packs several log files in a single remote file, so that a backlog
+ * costs one open/close/rename cycle instead of one per file. All integers are
+ * big-endian. The CRC is the IEEE 802.3 CRC-32 (same as zlib.crc32) of the
+ * segment data. See tools/unbundle.py for the host side.
+ *
+ *   Bundle header  : magic "CIDB" (4) | version (1) | flags (1) | reserved (2)
+ *   Segment header : magic "CIDS" (4) | name length (2) | data length (4) | name
+ *   Segment data   : data length bytes, followed by the CRC-32 (4)
+ *   End record     : magic "CIDE" (4) | segment count (4)
+ *
+ * Segments follow each other up to the end record, which closes the file. A
+ * bundle cut short after a complete segment lacks the end record and is
+ * rejected. A bundle is written under a temporary suffix and renamed to its
+ * final name only once complete.
+ */
+#define SFTP_BUNDLE_VERSION 2
+#define SFTP_BUNDLE_HEADER_SIZE 8
+#define SFTP_BUNDLE_SEGMENT_HEADER_SIZE 10
+#define SFTP_BUNDLE_SEGMENT_TRAILER_SIZE 4
+#define SFTP_BUNDLE_END_SIZE 8
+
+// Output stream of a bundle, data is sent in chunks taken from the shared pool
+typedef struct
+{
+    SftpUploadWorker *worker;
+    int buffer;    // Index of the chunk being filled, -1 if none
+    size_t length; // Number of bytes in the chunk
+} SftpBundleWriter;
+
+/**
+ * @brief Send the current chunk of a bundle and return it to the pool
+ *
+ * @note -
+ *
+ * @param writer Bundle output stream
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpBundleFlush(SftpBundleWriter *writer)
+{
+    error_list error = NO_ERROR;
+    size_t written;
+
+    if (writer->buffer >= 0)
+    {
+        if (writer->length > 0)
+        {
+            error = sftpClientWriteFile(writer->worker->context, sftpWriteBuffers[writer->buffer],
+                                        writer->length, &written, 0);
+            writer->worker->bytes += writer->length;
+        }
+
+        sftpUploadGiveBuffer(writer->buffer);
+        writer->buffer = -1;
+        writer->length = 0;
+    }
+
+    return error;
+}
+
+/**
+ * @brief Get free space in the current chunk of a bundle
+ *
+ * @note A chunk is taken from the pool if necessary, a full chunk is sent first
+ *
+ * @param writer Bundle output stream
+ * @param p Pointer to the free space
+ * @param size Number of free bytes
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpBundleReserve(SftpBundleWriter *writer, uint8_t **p, size_t *size)
+{
+    error_list error = NO_ERROR;
+
+    if (writer->buffer >= 0 && writer->length >= APP_SFTP_WRITE_BUFFER_SIZE)
+    {
+        error = sftpBundleFlush(writer);
+    }
+
+    if (!error)
+    {
+        if (writer->buffer < 0)
+        {
+            writer->buffer = sftpUploadTakeBuffer();
+        }
+
+        *p = (uint8_t *)sftpWriteBuffers[writer->buffer] + writer->length;
+        *size = APP_SFTP_WRITE_BUFFER_SIZE - writer->length;
+    }
+
+    return error;
+}
+
+/**
+ * @brief Append data to a bundle
+ *
+ * @note Headers are appended to the data chunks rather than sent on their own,
+ * to avoid extra round trips
+ *
+ * @param writer Bundle output stream
+ * @param data Data to be appended
+ * @param length Number of bytes
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpBundleWrite(SftpBundleWriter *writer, const void *data, size_t length)
+{
+    error_list error = NO_ERROR;
+    const uint8_t *q = data;
+    uint8_t *p;
+    size_t n;
+
+    while (!error && length > 0)
+    {
+        error = sftpBundleReserve(writer, &p, &n);
+
+        if (!error)
+        {
+            n = MIN(n, length);
+            memcpy(p, q, n);
+            writer->length += n;
+            q += n;
+            length -= n;
+        }
+    }
+
+    return error;
+}
+
+/**
+ * @brief Append a log file to a bundle as a new segment
+ *
+ * @note -
+ *
+ * @param writer Bundle output stream
+ * @param name Name of the log file
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpBundleAddSegment(SftpBundleWriter *writer, const char *name)
+{
+    error_list error;
+    char logfilepath[1024];
+    struct stat st;
+    FILE *file;
+    uint8_t header[SFTP_BUNDLE_SEGMENT_HEADER_SIZE];
+    uint8_t trailer[SFTP_BUNDLE_SEGMENT_TRAILER_SIZE];
+    uint8_t *p;
+    size_t n;
+    size_t length;
+    size_t nameLen = strlen(name);
+    uint32_t crc = 0;
+
+    snprintf(logfilepath, sizeof(logfilepath), "%s/%s", LOG_FILE_DIR, name);
+
+    // Log files are sealed, their size does not change while they are uploaded
+    if (stat(logfilepath, &st) != 0 || (file = fopen(logfilepath, "rb")) == NULL)
+    {
+        TRACE_INFO("Error opening the local file %s \n", logfilepath);
+        return ERROR_FILE_NOT_FOUND;
+    }
+
+    length = st.st_size;
+
+    // Format segment header
+    memcpy(header, "CIDS", 4);
+    STORE16BE(nameLen, header + 4);
+    STORE32BE(length, header + 6);
+
+    error = sftpBundleWrite(writer, header, sizeof(header));
+
+    if (!error)
+    {
+        error = sftpBundleWrite(writer, name, nameLen);
+    }
+
+    // Read the file directly into the chunks of the bundle
+    while (!error && length > 0)
+    {
+        error = sftpBundleReserve(writer, &p, &n);
+
+        if (!error)
+        {
+            n = fread(p, 1, MIN(n, length), file);
+
+            if (n == 0)
+            {
+                TRACE_INFO("Error reading the local file %s \n", logfilepath);
+                error = ERROR_READ_FAILED;
+            }
+            else
+            {
+                crc = esp_rom_crc32_le(crc, p, n);
+                writer->length += n;
+                length -= n;
+            }
+        }
+    }
+
+    fclose(file);
+
+    if (!error)
+    {
+        STORE32BE(crc, trailer);
+        error = sftpBundleWrite(writer, trailer, sizeof(trailer));
+    }
+
+    return error;
+}
+
+/**
+ * @brief Upload several log files in a single remote bundle and delete them from the SD card
+ *
+ * @note -
+ *
+ * @param worker Upload session, the file names are in worker->names
+ * @param count Number of files
+ *
+ * @return Error code
+ *
+ */
+static error_list sftpUploadBundle(SftpUploadWorker *worker, uint_t count)
+{
+    error_list error;
+    SftpClientContext *context = worker->context;
+    SftpBundleWriter writer;
+    uint8_t header[SFTP_BUNDLE_HEADER_SIZE];
+    uint8_t end[SFTP_BUNDLE_END_SIZE];
+    uint_t i;
+    char temp_filename[100];
+    char filename[100];
+
+    snprintf(temp_filename, sizeof(temp_filename), "%s" APP_SFTP_BUNDLE_PREFIX "%s-%s" APP_SFTP_BUNDLE_TEMP_SUFFIX,
+             APP_SFTP_TEMP_FILENAME, DEVICE_ID, worker->names[0]);
+    snprintf(filename, sizeof(filename), "%s" APP_SFTP_BUNDLE_PREFIX "%s-%s" APP_SFTP_BUNDLE_SUFFIX,
+             APP_SFTP_FILENAME, DEVICE_ID, worker->names[0]);
+
+    TRACE_INFO("Creating bundle %s with %u log files...\r\n", temp_filename, count);
+    error = sftpClientOpenFile(context, temp_filename, SSH_FXF_CREAT | SSH_FXF_WRITE | SSH_FXF_TRUNC);
+    // Any error to report?
+    if (error)
+    {
+        TRACE_INFO("Error while opening File %s...\r\n", temp_filename);
+        return error;
+    }
+
+    writer.worker = worker;
+    writer.buffer = -1;
+    writer.length = 0;
+
+    // Format bundle header
+    memcpy(header, "CIDB", 4);
+    header[4] = SFTP_BUNDLE_VERSION;
+    header[5] = 0;
+    STORE16BE(0, header + 6);
+
+    error = sftpBundleWrite(&writer, header, sizeof(header));
+
+    for (i = 0; i < count && !error; i++)
+    {
+        error = sftpBundleAddSegment(&writer, worker->names[i]);
+    }
+
+    // Format end record, its absence marks a truncated bundle
+    if (!error)
+    {
+        memcpy(end, "CIDE", 4);
+        STORE32BE(count, end + 4);
+
+        error = sftpBundleWrite(&writer, end, sizeof(end));
+    }
+
+    // Send the last chunk
+    if (!error)
+    {
+        error = sftpBundleFlush(&writer);
+    }
+    else
+    {
+        sftpBundleFlush(&writer);
+    }
+
+    // Close file
+    if (!error)
+    {
+        error = sftpClientCloseFile(context);
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Error while closing File %s...\r\n", temp_filename);
+        }
+    }
+    else
+    {
+        TRACE_INFO("Error while writing to File %s...\r\n", temp_filename);
+        sftpClientCloseFile(context);
+    }
+
+    if (!error)
+    {
+        TRACE_INFO("Renaming File %s to %s...\r\n", temp_filename, filename);
+        error = sftpClientRenameFile(context, temp_filename, filename);
+        if (error)
+        {
+            TRACE_INFO("Error renaming File %s...\r\n", temp_filename);
+        }
+    }
+
+    if (!error)
+    {
+        worker->bundles++;
+        worker->files += count;
+
+        // The log files are safely stored on the server
+        for (i = 0; i < count; i++)
+        {
+            sftpUploadReleaseFile(worker->names[i]);
+        }
+    }
+
+    return error;
+}
+
+/**
+ * @brief Upload log files until the directory is exhausted or an error occurs
+ *
+ * @note Sessions other than the first one open their own channel over the
+ * SSH connection and close it when done
+ *
+ * @param worker Upload session
+ *
+ */
+static void sftpUploadRun(SftpUploadWorker *worker)
+{
+    error_list error = NO_ERROR;
+    SftpClientContext *context = worker->context;
+    uint_t n;
+
+    // Additional session?
+    if (context != &sftpClientContext)
+    {
+        sftpClientInit(context);
+        sftpClientSetTimeout(context, 20000);
+        sftpClientSetWriteCoalescing(context, APP_SSH_COALESCING_THRESHOLD, APP_SSH_COALESCING_DELAY);
+
+        // Open a new channel over the authenticated connection
+        error = sftpClientOpenChannel(context, &sftpClientContext);
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Failed to open SFTP channel (error %d)\r\n", error);
+        }
+    }
+
+    while (!error)
+    {
+        // Take a batch of files from the log directory
+        for (n = 0; n < APP_SFTP_BUNDLE_MAX_SEGMENTS &&
+                    sftpUploadNextFile(worker->names[n], sizeof(worker->names[n]));
+             n++)
+        {
+        }
+
+        if (n == 0)
+        {
+            // Nothing left to upload
+            break;
+        }
+        else if (n == 1)
+        {
+            error = sftpUploadFile(worker, worker->names[0]);
+        }
+        else
+        {
+            error = sftpUploadBundle(worker, n);
+        }
+    }
+
+    // Additional session?
+    if (context != &sftpClientContext)
+    {
+        // Close the channel, the connection is left open
+        sftpClientDisconnect(context);
+        sftpClientDeinit(context);
+    }
+
+    worker->error = error;
+}
+
+/**
+ * @brief Upload task, one per additional SFTP session
+ *
+ * @note -
+ *
+ * @param param Upload session
+ *
+ */
+static void sftpUploadTask(void *param)
+{
+    sftpUploadRun((SftpUploadWorker *)param);
+
+    // Notify the task that started the upload
+    osReleaseSemaphore(&sftpUploadQueue.done);
+    osDeleteTask(OS_SELF_TASK_ID);
+}
+
+/**
+ * @brief Upload the pending log files over the SFTP session
+ *
+ * @note The files are spread across APP_SFTP_UPLOAD_CHANNELS sessions sharing
+ * the same SSH connection, so that the round trips of several files overlap.
+ * The session is left open on success so that the next batch does not pay
+ * for a new handshake
+ *
+ * @return Error code
+ *
+ */
+error_list sftpClientUploadLogs(void)
+{
+    error_list error;
+    uint_t i;
+    uint_t numTasks = 0;
+    uint32_t files = 0;
+    uint32_t bundles = 0;
+    uint32_t bytes = 0;
+    systime_t start;
+
+    // Get a usable SFTP session
+    error = SFTP_SESSION_OPEN();
+    // Any error to report?
+    if (error)
+        return error;
+
+    TRACE_INFO("Loading pending-upload index\r\n");
+    start = osGetSystemTime();
+
+    // Get the sealed log files from the index
+    osMemset(&sftpUploadQueue, 0, sizeof(sftpUploadQueue));
+    if (LOG_INDEX_LOAD(&sftpUploadQueue.entries, &sftpUploadQueue.numEntries) != ESP_OK)
+    {
+        TRACE_INFO("Failed to load pending-upload index\r\n");
+        return NO_ERROR;
+    }
+
+    if (!osCreateMutex(&sftpUploadQueue.mutex) ||
+        !osCreateSemaphore(&sftpUploadQueue.budget, SFTP_WRITE_BUFFER_COUNT) ||
+        !osCreateSemaphore(&sftpUploadQueue.done, 0))
+    {
+        error = ERROR_OUT_OF_RESOURCES;
+    }
+    else
+    {
+        // The first session is driven by the calling task
+        sftpUploadQueue.workers[0].context = &sftpClientContext;
+
+        // Start one task per additional session
+        for (i = 1; i < APP_SFTP_UPLOAD_CHANNELS; i++)
+        {
+            sftpUploadQueue.workers[numTasks + 1].context = &sftpChannelContexts[numTasks];
+
+            if (osCreateTask("SFTP Upload", sftpUploadTask, &sftpUploadQueue.workers[numTasks + 1],
+                             APP_SFTP_UPLOAD_TASK_STACK_SIZE, OS_TASK_PRIORITY_NORMAL) != OS_INVALID_TASK_ID)
+            {
+                numTasks++;
+            }
+            else
+            {
+                TRACE_INFO("Failed to create upload task!\r\n");
+            }
+        }
+
+        TRACE_INFO("Uploading log files over %u SFTP sessions\r\n", numTasks + 1);
+
+        sftpUploadRun(&sftpUploadQueue.workers[0]);
+
+        // Wait for the other sessions to complete
+        for (i = 0; i < numTasks; i++)
+        {
+            osWaitForSemaphore(&sftpUploadQueue.done, INFINITE_DELAY);
+        }
+
+        // Report the first error
+        for (i = 0; i <= numTasks; i++)
+        {
+            files += sftpUploadQueue.workers[i].files;
+            bundles += sftpUploadQueue.workers[i].bundles;
+            bytes += sftpUploadQueue.workers[i].bytes;
+            if (!error)
+                error = sftpUploadQueue.workers[i].error;
+        }
+
+        // End-to-end time of the batch, from the index load to the last rename
+        TRACE_INFO("%" PRIu32 " log files (%" PRIu32 " bundles, %" PRIu32 " bytes) uploaded in %" PRIu32 " ms\r\n",
+                   files, bundles, bytes, (uint32_t)(osGetSystemTime() - start));
+    }
+
+    free(sftpUploadQueue.entries);
+    osDeleteSemaphore(&sftpUploadQueue.done);
+    osDeleteSemaphore(&sftpUploadQueue.budget);
+    osDeleteMutex(&sftpUploadQueue.mutex);
+
+    // Drop the records of the uploaded files so that the index stays small
+    LOG_INDEX_COMPACT();
+
+    // Report the effective number of bytes carried by each SSH packet
+    SshConnectionStats stats;
+    if (!sftpClientGetConnectionStats(&sftpClientContext, &stats) && stats.txChannelPackets > 0)
+    {
+        TRACE_INFO("SFTP Client: %" PRIu64 " bytes sent in %" PRIu32 " SSH packets (%" PRIu64 " bytes/packet)\r\n",
+                   stats.txChannelData, stats.txChannelPackets,
+                   stats.txChannelData / stats.txChannelPackets);
+        TRACE_INFO("SFTP Client: channel window %" PRIu32 " bytes (%" PRIu32 " growths, %" PRIu32 " adjusts), RTT %" PRIu32 " ms\r\n",
+                   stats.rxWindowSize, stats.rxWindowGrowths, stats.rxWindowAdjusts, stats.rtt);
+        // Compare the payloads before and after zlib@openssh.com compression
+        TRACE_INFO("SFTP Client: %" PRIu64 " payload bytes compressed to %" PRIu64 " (%" PRIu32 "%%), %" PRIu64 " bytes on the wire\r\n",
+                   stats.txPayload, stats.txCompressed,
+                   (uint32_t)(stats.txPayload ? stats.txCompressed * 100 / stats.txPayload : 100),
+                   stats.txBytes);
+        TRACE_INFO("SFTP Client: %" PRIu32 " SSH key re-exchanges on this connection\r\n", stats.rekeys);
+        // Ratio of SSH packets to application writes, and average time spent per write in this batch
+        if (stats.txChannelWrites > 0)
+        {
+            TRACE_INFO("SFTP Client: %" PRIu32 " channel writes sent in %" PRIu32 " SSH packets (%" PRIu32 " packets per 100 writes), %" PRIu32 " us/write\r\n",
+                       stats.txChannelWrites, stats.txChannelPackets,
+                       (uint32_t)((uint64_t)stats.txChannelPackets * 100 / stats.txChannelWrites),
+                       (uint32_t)((uint64_t)(osGetSystemTime() - start) * 1000 / stats.txChannelWrites));
+        }
+    }
+
+    // Keep the session open unless the connection itself is broken
+    if (error && (sftpClientContext.state != SFTP_CLIENT_STATE_CONNECTED ||
+                  !sshIsConnectionEstablished(&sftpClientContext.sshConnection)))
+    {
+        sftpSessionAbort();
+    }
+    else
+    {
+        sftpSession.lastActivity = osGetSystemTime();
+    }
+
+    // Return status code
+    return error;
+}
+
+/**
+ * @brief Fill the pool of ephemeral key pairs
+ *
+ * @note The task runs below the priority of the other tasks, so that the key
+ * pairs are generated while the device is idle. It sleeps until a key
+ * exchange takes a key pair from the pool
+ *
+ * @param param Unused
+ *
+ */
+static void sshKeyPoolTask(void *param)
+{
+    error_list error;
+
+    while (1)
+    {
+        error = sshRefillKeyPool(&sshKeyPool, YARROW_PRNG_ALGO, &yarrowContext);
+        // Any error to report?
+        if (error)
+        {
+            TRACE_INFO("Failed to precompute ephemeral key pair (error %d)\r\n", error);
+        }
+
+        sshWaitForKeyPoolEvent(&sshKeyPool, INFINITE_DELAY);
+    }
+}
+
+/**
+ * @brief Log the distribution of the time spent in each connection setup phase
+ *
+ * @note The 90th percentile is the upper bound of the histogram bucket that
+ * holds it, so it is only accurate to a factor of two
+ *
+ */
+static void sshProfilerReport(void)
+{
+    SshProfilerStats stats;
+    const SshPhaseHistogram *histogram;
+    uint32_t count;
+    uint_t i;
+    uint_t n;
+
+    if (sshGetProfilerStats(&sshProfiler, &stats))
+        return;
+
+    TRACE_INFO("SSH setup profile over %" PRIu32 " connections\r\n", stats.connections);
+
+    // One line per phase, followed by the whole setup
+    for (i = 0; i <= SSH_CONN_PHASE_COUNT; i++)
+    {
+        histogram = (i < SSH_CONN_PHASE_COUNT) ? &stats.phases[i] : &stats.total;
+
+        if (histogram->count == 0)
+            continue;
+
+        // Find the bucket holding the 90th percentile
+        for (count = 0, n = 0; n < SSH_PROFILER_NUM_BUCKETS - 1; n++)
+        {
+            count += histogram->buckets[n];
+            if (count * 10 >= histogram->count * 9)
+                break;
+        }
+
+        TRACE_INFO("  %-8s n=%" PRIu32 " avg=%" PRIu32 " min=%" PRIu32 " max=%" PRIu32 " p90<%" PRIu32 " ms\r\n",
+                   (i < SSH_CONN_PHASE_COUNT) ? sshGetConnPhaseName(i) : "total",
+                   histogram->count, (uint32_t)(histogram->total / histogram->count),
+                   histogram->min, histogram->max, (uint32_t)1 << n);
+    }
+}
+
+/**
+ * @brief Log the RAM used by the SSH/SFTP client
+ *
+ * @note The static part is fixed at build time. With dynamic SSH buffers,
+ * the connection and channel buffers come from the heap while a session is
+ * open, so the peak shows up in the minimum free heap
+ *
+ */
+static void sshRamReport(const char *when)
+{
+    size_t staticSize = sizeof(sftpClientContext) + sizeof(sftpChannels) + sizeof(sftpChannelContexts) +
+                        sizeof(sftpWriteBuffers) + sizeof(hostKeyEntries) + sizeof(sshKeyPool) + sizeof(sshKeyCache) +
+                        sizeof(sshProfiler);
+
+    TRACE_INFO("SSH RAM (%s): %u bytes static (connection %u, channel %u), heap %u free, %u minimum free\r\n",
+               when, (unsigned int)staticSize, (unsigned int)sizeof(SshConnection), (unsigned int)sizeof(SshChannel),
+               (unsigned int)esp_get_free_heap_size(), (unsigned int)esp_get_minimum_free_heap_size());
+}
+
+/**
+ * @brief SSH INIT
+ *
+ * @note -
+ *
+ */
+void SSH_INIT()
+{
+    /*
+    OsTaskId taskId;
+    // Create user task
+    taskId = osCreateTask("User", userTask, NULL, 750, OS_TASK_PRIORITY_NORMAL);
+    // Failed to create the task?
+    if (taskId == OS_INVALID_TASK_ID)
+    {
+        // Debug message
+        TRACE_ERROR("Failed to create task!\r\n");
+    }
+    */
+
+#if (APP_CRYPTO_BENCH == ENABLED)
+    // Measure the crypto algorithms before the key pool task competes for the CPU
+    CRYPTO_BENCH_RUN();
+#endif
+
+    // Decode the trusted host keys once for all connections
+    if (hostKeyStore.entries == NULL)
+    {
+        hostKeyStoreLoad();
+    }
+
+    // The profiler accumulates over the network sessions
+    if (!sshProfilerReady && !sshInitProfiler(&sshProfiler, APP_SSH_PROFILER_LOG))
+    {
+        sshProfilerReady = TRUE;
+    }
+
+    // The host key cache survives the network sessions
+    if (!sshKeyCacheReady && !sshInitKeyCache(&sshKeyCache))
+    {
+        sshKeyCacheReady = TRUE;
+    }
+
+    // Precompute the ephemeral key pairs while the network comes up
+    if (!sshKeyPoolReady && !sshInitKeyPool(&sshKeyPool, APP_SSH_KEY_POOL_KEX_ALGO))
+    {
+        if (osCreateTask("SSH Key Pool", sshKeyPoolTask, NULL, APP_SSH_KEY_POOL_TASK_STACK_SIZE,
+                         APP_SSH_KEY_POOL_TASK_PRIORITY) != OS_INVALID_TASK_ID)
+        {
+            sshKeyPoolReady = TRUE;
+        }
+        else
+        {
+            TRACE_INFO("Failed to create key pool task!\r\n");
+            sshDeinitKeyPool(&sshKeyPool);
+        }
+    }
+
+    osDelayTask(5000);
+
+    sshRamReport("start");
+
+    while (sftpClientUploadLogs())
+    {
+        // Connection failures are paced by the backoff of the session manager,
+        // other errors leave the session open and are retried after a short delay
+        if (sftpSession.open)
+        {
+            osDelayTask(APP_SFTP_RECONNECT_MIN_DELAY);
+        }
+    }
+
+    // Report the cost of the connections made during this network session
+    SftpSessionStats sessionStats;
+    SFTP_SESSION_GET_STATS(&sessionStats);
+    TRACE_INFO("SFTP session: %" PRIu32 " attempts, %" PRIu32 " failures, %" PRIu32 " handshakes, %" PRIu32 " reuses, %" PRIu32 " ms connecting\r\n",
+               sessionStats.connectAttempts, sessionStats.connectFailures,
+               sessionStats.handshakes, sessionStats.reuses,
+               sessionStats.totalConnectTime);
+    // Average time to first byte of the connection setup, with and without the key pool
+    if (sessionStats.handshakes > 0)
+    {
+        uint32_t inlineHandshakes = sessionStats.handshakes - sessionStats.pooledHandshakes;
+        TRACE_INFO("SFTP session: %" PRIu32 " ms per handshake with a precomputed key pair (%" PRIu32 "), %" PRIu32 " ms without (%" PRIu32 ")\r\n",
+                   sessionStats.pooledHandshakes ? sessionStats.pooledConnectTime / sessionStats.pooledHandshakes : 0,
+                   sessionStats.pooledHandshakes,
+                   inlineHandshakes ? (sessionStats.totalConnectTime - sessionStats.pooledConnectTime) / inlineHandshakes : 0,
+                   inlineHandshakes);
+    }
+
+    // Host key verifications that reused the constants of a known modulus
+    if (sshKeyCacheReady)
+    {
+        TRACE_INFO("SSH key cache: %" PRIu32 " hits, %" PRIu32 " misses\r\n",
+                   sshKeyCache.hits, sshKeyCache.misses);
+    }
+
+    // Where the connection setup time went
+    if (sshProfilerReady)
+    {
+        sshProfilerReport();
+    }
+
+    // The minimum free heap includes the buffers of the upload sessions
+    sshRamReport("end");
+
+    // The network is about to go down
+    SFTP_SESSION_CLOSE();
+
     dhcpClientRelease(&dhcpClientContext);
     dhcpClientRelease(&dhcpServerContext);
     netStopInterface(&netInterface[0]);
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Generate the fixed-base comb tables used by the Cyclone EC code.
+
+Scalar multiplications by the base point (key generation, ECDSA and EdDSA
+signing) use a Lim-Lee comb. With a width of w teeth, the n-bit scalar is
+split in w rows of d = ceil(n / w) bits (n is 256, 384 or 255 for Ed25519),
+and the table holds the 2^w - 1 points
+
+    T[j - 1] = sum(2^(i * d) * G for each bit i set in j),  1 <= j < 2^w
+
+so that the multiplication only costs d doublings and d additions. Every
+supported width (4, 6 and 8) is emitted under its own #if, and the width of
+each curve is selected in crypto_config.h. Points are stored in affine
+coordinates, as little-endian arrays of 32-bit words:
+
+    P-256, P-384 : x | y
+    Ed25519      : x | y | t (t = x * y, extended coordinates with z = 1)
+
+Usage:
+    gen_comb_tables.py [-o OUTPUT]
+"""
+
+import argparse
+import os
+import sys
+
+WIDTHS = (4, 6, 8)
+
+DEFAULT_OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                              "components", "CardioIDLogging", "cyclone",
+                              "cyclone_crypto", "ecc", "ec_comb_tables.c")
+
+HEADER = """\
+/**
+ * @file ec_comb_tables.c
+ * @brief Fixed-base comb tables (generated by tools/gen_comb_tables.py)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2023 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Do not edit. Each table holds the 2^w - 1 non-trivial combinations of
+ * the points 2^(i * d).G, 0 <= i < w, in affine coordinates
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.2.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_comb_tables.h"
+#include "debug.h"
+"""
+
+
+class WeierstrassCurve:
+    """Short Weierstrass curve y^2 = x^3 - 3x + b, affine arithmetic"""
+
+    def __init__(self, p, gx, gy):
+        self.p = p
+        self.g = (gx, gy)
+
+    def add(self, s, t):
+        if s is None:
+            return t
+        if t is None:
+            return s
+        p = self.p
+        if s[0] == t[0]:
+            if (s[1] + t[1]) % p == 0:
+                return None
+            l = (3 * s[0] * s[0] - 3) * pow(2 * s[1], -1, p) % p
+        else:
+            l = (t[1] - s[1]) * pow(t[0] - s[0], -1, p) % p
+        x = (l * l - s[0] - t[0]) % p
+        return (x, (l * (s[0] - x) - s[1]) % p)
+
+    def coordinates(self, s):
+        return [s[0], s[1]]
+
+
+class EdwardsCurve:
+    """Twisted Edwards curve -x^2 + y^2 = 1 + d.x^2.y^2 (Ed25519)"""
+
+    def __init__(self, p, d, gx, gy):
+        self.p = p
+        self.d = d
+        self.g = (gx, gy)
+
+    def add(self, s, t):
+        if s is None:
+            return t
+        if t is None:
+            return s
+        p = self.p
+        u = self.d * s[0] * t[0] * s[1] * t[1] % p
+        x = (s[0] * t[1] + s[1] * t[0]) * pow(1 + u, -1, p) % p
+        y = (s[1] * t[1] + s[0] * t[0]) * pow(1 - u, -1, p) % p
+        return (x, y)
+
+    def coordinates(self, s):
+        return [s[0], s[1], s[0] * s[1] % self.p]
+
+
+P256 = WeierstrassCurve(
+    2**256 - 2**224 + 2**192 + 2**96 - 1,
+    0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+    0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+
+P384 = WeierstrassCurve(
+    2**384 - 2**128 - 2**96 + 2**32 - 1,
+    int("AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A38"
+        "5502F25DBF55296C3A545E3872760AB7", 16),
+    int("3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C0"
+        "0A60B1CE1D7E819D7A431D7C90EA0E5F", 16))
+
+ED25519 = EdwardsCurve(
+    2**255 - 19,
+    -121665 * pow(121666, -1, 2**255 - 19) % (2**255 - 19),
+    0x216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51A,
+    0x6666666666666666666666666666666666666666666666666666666666666658)
+
+#Table name, curve, scalar length in bits, field length in 32-bit words,
+#width macro
+TABLES = (
+    ("ecNistP256Comb", P256, 256, 8, "SECP256R1"),
+    ("ecNistP384Comb", P384, 384, 12, "SECP384R1"),
+    ("ed25519Comb", ED25519, 255, 8, "ED25519"),
+)
+
+
+def mul(curve, k, s):
+    r = None
+    while k:
+        if k & 1:
+            r = curve.add(r, s)
+        s = curve.add(s, s)
+        k >>= 1
+    return r
+
+
+def comb_table(curve, bits, width):
+    d = (bits + width - 1) // width
+    teeth = [mul(curve, 1 << (i * d), curve.g) for i in range(width)]
+    table = []
+    for j in range(1, 1 << width):
+        r = None
+        for i in range(width):
+            if (j >> i) & 1:
+                r = curve.add(r, teeth[i])
+        table.append(r)
+    return table
+
+
+def format_words(value, n):
+    words = ["0x%08X" % ((value >> (32 * i)) & 0xFFFFFFFF) for i in range(n)]
+    return [", ".join(words[i:i + 4]) for i in range(0, n, 4)]
+
+
+def emit_table(out, name, curve, bits, n, macro, width):
+    table = comb_table(curve, bits, width)
+    d = (bits + width - 1) // width
+    directive = "#if" if width == WIDTHS[0] else "#elif"
+    out.append("%s (%s_COMB_WIDTH == %d)" % (directive, macro, width))
+    out.append("")
+    out.append("//Comb table (%d teeth, %d columns)" % (width, d))
+    out.append("const uint32_t %s[] =" % name)
+    out.append("{")
+    lines = []
+    for j, point in enumerate(table):
+        lines.append("   //T[%d]" % j)
+        for coordinate in curve.coordinates(point):
+            for line in format_words(coordinate, n):
+                lines.append("   " + line + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    out.extend(lines)
+    out.append("};")
+    out.append("")
+
+
+def generate():
+    out = [HEADER]
+    for name, curve, bits, n, macro in TABLES:
+        if macro.startswith("SECP"):
+            guard = "EC_SUPPORT == ENABLED && EC_NIST_FAST_SUPPORT == ENABLED && "
+        else:
+            guard = ""
+        out.append("//Check crypto library configuration")
+        out.append("#if (%s%s_SUPPORT == ENABLED)" % (guard, macro))
+        out.append("")
+        for width in WIDTHS:
+            emit_table(out, name, curve, bits, n, macro, width)
+        out.append("#endif")
+        out.append("")
+        out.append("#endif")
+        out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the fixed-base comb tables")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="output file")
+    args = parser.parse_args()
+
+    with open(args.output, "w", newline="\n") as f:
+        f.write(generate())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
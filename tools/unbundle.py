@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Split the bundles uploaded by the CardioID logging library into log files.
+
+A bundle packs several log files in a single remote file. All integers are
+big-endian, the CRC is the IEEE 802.3 CRC-32 (zlib.crc32) of the segment data.
+
+    Bundle header  : magic "CIDB" (4) | version (1) | flags (1) | reserved (2)
+    Segment header : magic "CIDS" (4) | name length (2) | data length (4) | name
+    Segment data   : data length bytes, followed by the CRC-32 (4)
+    End record     : magic "CIDE" (4) | segment count (4)
+
+Segments follow each other up to the end record, which closes the file. A
+bundle without it, or with a wrong segment count, was cut short and is
+rejected. The device writes a bundle as <name>.cidb.part and renames it once
+complete, so partial bundles are never picked up from a directory.
+
+Each segment is written as <output>/cardioid<name>, the name the device uses
+for files uploaded on their own, so the Logstash file input picks them up
+unchanged. With --concat, all the segments of a bundle are written to a single
+file instead, which keeps the number of files tracked by Logstash low. Files
+are written under a temporary name and renamed once complete.
+
+Usage:
+    unbundle.py [-o OUTPUT_DIR] [--concat] [--delete] [--watch SECONDS] BUNDLE_OR_DIR...
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+BUNDLE_MAGIC = b"CIDB"
+SEGMENT_MAGIC = b"CIDS"
+END_MAGIC = b"CIDE"
+BUNDLE_VERSION = 2
+BUNDLE_SUFFIX = ".cidb"
+BUNDLE_HEADER = struct.Struct(">4sBBH")
+SEGMENT_HEADER = struct.Struct(">4sHI")
+END_RECORD = struct.Struct(">4sI")
+SEGMENT_TRAILER = struct.Struct(">I")
+OUTPUT_PREFIX = "cardioid"
+
+
+class BundleError(Exception):
+    pass
+
+
+def read_exact(f, n):
+    data = f.read(n)
+    if len(data) != n:
+        raise BundleError("truncated bundle")
+    return data
+
+
+def iter_segments(f):
+    """Yield (name, data) for each segment, checking the framing and CRC."""
+    magic, version, _flags, _reserved = BUNDLE_HEADER.unpack(read_exact(f, BUNDLE_HEADER.size))
+    if magic != BUNDLE_MAGIC:
+        raise BundleError("not a bundle")
+    if version != BUNDLE_VERSION:
+        raise BundleError("unsupported bundle version %d" % version)
+
+    count = 0
+    while True:
+        magic = f.read(4)
+        if not magic:
+            raise BundleError("truncated bundle (no end record)")
+        if magic == END_MAGIC:
+            _magic, expected = END_RECORD.unpack(magic + read_exact(f, END_RECORD.size - 4))
+            if expected != count:
+                raise BundleError("%d segments, end record says %d" % (count, expected))
+            if f.read(1):
+                raise BundleError("trailing data after end record")
+            return
+        if len(magic) != 4:
+            raise BundleError("truncated segment header")
+        if magic != SEGMENT_MAGIC:
+            raise BundleError("bad segment magic")
+        _magic, name_len, data_len = SEGMENT_HEADER.unpack(magic + read_exact(f, SEGMENT_HEADER.size - 4))
+        name = read_exact(f, name_len).decode("ascii")
+        # Segment names are plain file names
+        if os.path.basename(name) != name or name in ("", ".", ".."):
+            raise BundleError("invalid segment name %r" % name)
+        data = read_exact(f, data_len)
+        (crc,) = SEGMENT_TRAILER.unpack(read_exact(f, SEGMENT_TRAILER.size))
+        if zlib.crc32(data) & 0xFFFFFFFF != crc:
+            raise BundleError("CRC mismatch in segment %s" % name)
+        count += 1
+        yield name, data
+
+
+def write_atomic(path, data):
+    tmp = path + ".part"
+    with open(tmp, "wb") as out:
+        out.write(data)
+    os.replace(tmp, path)
+
+
+def unbundle(path, output_dir, delete, concat):
+    """Extract one bundle. Returns the number of segments written."""
+    with open(path, "rb") as f:
+        # Validate the whole bundle before writing anything
+        segments = list(iter_segments(f))
+    if concat:
+        name = os.path.basename(path)[:-len(BUNDLE_SUFFIX)] + ".txt"
+        write_atomic(os.path.join(output_dir, OUTPUT_PREFIX + name),
+                     b"".join(data for _name, data in segments))
+    else:
+        for name, data in segments:
+            write_atomic(os.path.join(output_dir, OUTPUT_PREFIX + name), data)
+    if delete:
+        os.remove(path)
+    return len(segments)
+
+
+def collect(paths):
+    for path in paths:
+        if os.path.isdir(path):
+            for entry in sorted(os.listdir(path)):
+                if entry.endswith(BUNDLE_SUFFIX):
+                    yield os.path.join(path, entry)
+        else:
+            yield path
+
+
+def run(args):
+    failures = 0
+    for path in collect(args.paths):
+        output_dir = args.output or os.path.dirname(os.path.abspath(path))
+        try:
+            n = unbundle(path, output_dir, args.delete, args.concat)
+            print("%s: %d segments" % (path, n))
+        except (BundleError, OSError, UnicodeDecodeError) as e:
+            print("%s: %s" % (path, e), file=sys.stderr)
+            failures += 1
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Split CardioID upload bundles into log files")
+    parser.add_argument("paths", nargs="+", help="bundle files or directories containing bundles")
+    parser.add_argument("-o", "--output", help="output directory (default: next to the bundle)")
+    parser.add_argument("--concat", action="store_true",
+                        help="write all the segments of a bundle to a single file")
+    parser.add_argument("--delete", action="store_true", help="delete bundles once extracted")
+    parser.add_argument("--watch", type=float, metavar="SECONDS",
+                        help="keep scanning the directories at this interval (implies --delete)")
+    args = parser.parse_args()
+
+    if args.watch:
+        args.delete = True
+        while True:
+            run(args)
+            time.sleep(args.watch)
+
+    return 1 if run(args) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())